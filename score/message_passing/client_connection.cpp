@@ -19,6 +19,7 @@
 
 #include <score/utility.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <thread>
@@ -37,6 +38,21 @@ constexpr std::int32_t kConnectRetryT = 3;  // new_delay = prev_delay * (1 + 1/T
 constexpr std::int32_t kConnectRetryMsMax = 5000;
 
 constexpr std::chrono::milliseconds kConnectIpcWarningDelay{20};
+
+std::size_t GetReservedSendCount(const IClientFactory::ClientConfig& client_config) noexcept
+{
+    std::size_t reserved_sends{0U};
+    for (const auto& priority_class_config : client_config.priority_classes)
+    {
+        reserved_sends += static_cast<std::size_t>(priority_class_config.max_queued_sends);
+    }
+    return reserved_sends;
+}
+
+std::uint32_t GetDispatchWeight(const IClientFactory::ClientConfig::PriorityClassConfig& priority_class_config) noexcept
+{
+    return std::max(priority_class_config.weight, std::uint32_t{1U});
+}
 }  // namespace
 
 ClientConnection::ClientConnection(std::shared_ptr<ISharedResourceEngine> engine,
@@ -57,10 +73,14 @@ ClientConnection::ClientConnection(std::shared_ptr<ISharedResourceEngine> engine
       send_mutex_{},
       send_condition_{},
       send_storage_{static_cast<std::size_t>(client_config.max_queued_sends) +
-                        static_cast<std::size_t>(client_config.max_async_replies),
+                        static_cast<std::size_t>(client_config.max_async_replies) + GetReservedSendCount(client_config),
                     score::cpp::pmr::polymorphic_allocator<>(engine_->GetMemoryResource())},
-      send_pool_{},
-      send_queue_{},
+      send_pools_{},
+      send_queues_{},
+      queued_sends_{},
+      dispatch_credits_{},
+      high_water_marks_{},
+      rejected_sends_{},
       waiting_for_reply_{},
       connection_timer_{},
       disconnection_command_{},
@@ -68,11 +88,27 @@ ClientConnection::ClientConnection(std::shared_ptr<ISharedResourceEngine> engine
       posix_endpoint_{}
 {
     // TODO: separate max_queued_sends, max_async_replies, and maybe queued SendWaitReply
-    for (auto& send_command : send_storage_)
+    auto send_command = send_storage_.begin();
+    for (std::size_t pool_index = 0U; pool_index < send_pools_.size(); ++pool_index)
+    {
+        std::size_t pool_size{static_cast<std::size_t>(client_config.max_queued_sends) +
+                              static_cast<std::size_t>(client_config.max_async_replies)};
+        if (pool_index != kSharedPoolIndex)
+        {
+            pool_size = static_cast<std::size_t>(client_config.priority_classes[pool_index].max_queued_sends);
+        }
+        for (std::size_t index = 0U; index < pool_size; ++index)
+        {
+            send_command->message.reserve(static_cast<std::size_t>(max_send_size_));
+            send_command->pool_index = pool_index;
+            send_pools_[pool_index].push_back(*send_command);
+            ++send_command;
+        }
+    }
+    for (std::size_t class_index = 0U; class_index < kPriorityClassCount; ++class_index)
     {
-        send_command.message.reserve(static_cast<std::size_t>(max_send_size_));
+        dispatch_credits_[class_index] = GetDispatchWeight(client_config.priority_classes[class_index]);
     }
-    send_pool_.assign(send_storage_.begin(), send_storage_.end());
 }
 
 ClientConnection::~ClientConnection() noexcept
@@ -91,25 +127,107 @@ ClientConnection::~ClientConnection() noexcept
         }
         std::lock_guard<std::recursive_mutex> guard{callback_context_->finalize_mutex};
     }
-    send_pool_.clear();
+    for (auto& send_pool : send_pools_)
+    {
+        send_pool.clear();
+    }
 }
 
-bool ClientConnection::TryQueueMessage(score::cpp::span<const std::uint8_t> message, ReplyCallback callback) noexcept
+bool ClientConnection::TryQueueMessage(score::cpp::span<const std::uint8_t> message,
+                                       ReplyCallback callback,
+                                       PriorityClass priority_class) noexcept
 {
-    if (send_pool_.empty())
-    {
+    const auto class_index = static_cast<std::size_t>(score::cpp::to_underlying(priority_class));
+    // a class with a reserved budget never competes with other classes for the shared slots and vice versa
+    auto& send_pool = (client_config_.priority_classes[class_index].max_queued_sends != 0U)
+                          ? send_pools_[class_index]
+                          : send_pools_[kSharedPoolIndex];
+    if (send_pool.empty())
+    {
+        score::cpp::ignore = rejected_sends_[class_index].fetch_add(1U, std::memory_order_relaxed);
         return false;
     }
-    auto& send_command = send_pool_.front();
-    send_pool_.pop_front();
+    auto& send_command = send_pool.front();
+    send_pool.pop_front();
     send_command.message.assign(message.begin(), message.end());
     send_command.callback = std::move(callback);
-    send_queue_.push_back(send_command);
+    send_queues_[class_index].push_back(send_command);
+    ++queued_sends_[class_index];
+    if (queued_sends_[class_index] > high_water_marks_[class_index].load(std::memory_order_relaxed))
+    {
+        high_water_marks_[class_index].store(queued_sends_[class_index], std::memory_order_relaxed);
+    }
     return true;
 }
 
+ClientConnection::SendCommand* ClientConnection::PopNextQueuedMessageUnderLock() noexcept
+{
+    const bool weighted = client_config_.priority_dispatch == IClientFactory::ClientConfig::PriorityDispatch::kWeighted;
+    // the second round is only needed, if all non-empty classes have used up their weighted dispatch credits
+    for (std::size_t round = 0U; round < 2U; ++round)
+    {
+        for (std::size_t class_index = 0U; class_index < kPriorityClassCount; ++class_index)
+        {
+            auto& send_queue = send_queues_[class_index];
+            if (send_queue.empty() || (weighted && (dispatch_credits_[class_index] == 0U)))
+            {
+                continue;
+            }
+            if (weighted)
+            {
+                --dispatch_credits_[class_index];
+            }
+            auto& send_command = send_queue.front();
+            send_queue.pop_front();
+            --queued_sends_[class_index];
+            return &send_command;
+        }
+        if (!weighted)
+        {
+            break;
+        }
+        for (std::size_t class_index = 0U; class_index < kPriorityClassCount; ++class_index)
+        {
+            dispatch_credits_[class_index] = GetDispatchWeight(client_config_.priority_classes[class_index]);
+        }
+    }
+    return nullptr;
+}
+
+void ClientConnection::ReturnToPoolUnderLock(SendCommand& send_command) noexcept
+{
+    // LIFO for better cache locality
+    send_pools_[send_command.pool_index].push_front(send_command);
+}
+
+bool ClientConnection::IsSendQueueEmptyUnderLock() const noexcept
+{
+    for (const auto& send_queue : send_queues_)
+    {
+        if (!send_queue.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+ClientConnection::QueueStatistics ClientConnection::GetQueueStatistics(PriorityClass priority_class) const noexcept
+{
+    const auto class_index = static_cast<std::size_t>(score::cpp::to_underlying(priority_class));
+    return QueueStatistics{high_water_marks_[class_index].load(std::memory_order_relaxed),
+                           rejected_sends_[class_index].load(std::memory_order_relaxed)};
+}
+
 score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
     score::cpp::span<const std::uint8_t> message) noexcept
+{
+    return SendWithPriority(message, PriorityClass::kDefault);
+}
+
+score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithPriority(
+    score::cpp::span<const std::uint8_t> message,
+    PriorityClass priority_class) noexcept
 {
     if (message.size() > max_send_size_)
     {
@@ -128,7 +246,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
     {
         if (client_config_.truly_async)
         {
-            if (!TryQueueMessage(message, ReplyCallback{}))
+            if (!TryQueueMessage(message, ReplyCallback{}, priority_class))
             {
                 return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
             }
@@ -141,7 +259,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::Send(
     }
     else
     {
-        if (!TryQueueMessage(message, ReplyCallback{}))
+        if (!TryQueueMessage(message, ReplyCallback{}, priority_class))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -200,7 +318,7 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Cli
         // unblocking the send_condition_ while holding send_mutex_. We don't access the referenced values after
         // the send_condition_ is unblocked and we don't leave the SendWaitReply function scope before it's unblocked.
         // coverity[autosar_cpp14_a5_1_4_violation]
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), PriorityClass::kDefault))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -214,7 +332,7 @@ score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> Cli
         lock.lock();
         if (!expected.has_value())
         {
-            if (send_queue_.empty())
+            if (IsSendQueueEmptyUnderLock())
             {
                 // no one managed to get into queue while we were blocking it
                 waiting_for_reply_.reset();
@@ -248,7 +366,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithCallback(
     std::lock_guard<std::mutex> guard(send_mutex_);
     if (waiting_for_reply_.has_value())
     {
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), PriorityClass::kDefault))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -256,7 +374,7 @@ score::cpp::expected_blank<score::os::Error> ClientConnection::SendWithCallback(
     }
     if (client_config_.truly_async)
     {
-        if (!TryQueueMessage(message, std::move(callback)))
+        if (!TryQueueMessage(message, std::move(callback), PriorityClass::kDefault))
         {
             return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
         }
@@ -515,31 +633,31 @@ void ClientConnection::ArmSendQueueUnderLock() noexcept
 
 void ClientConnection::ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& lock) noexcept
 {
-    while (!send_queue_.empty())
+    SendCommand* next_send = PopNextQueuedMessageUnderLock();
+    while (next_send != nullptr)
     {
-        SendCommand& send = send_queue_.front();
-        send_queue_.pop_front();
-        // below, we will need to return the SendCommand to the send_pool_ under lock
-        // (LIFO for better cache locality) right after we use its buffer to send the message
+        SendCommand& send = *next_send;
+        // below, we will need to return the SendCommand to its send pool under lock
+        // right after we use its buffer to send the message
         if (!send.callback.empty())
         {
             waiting_for_reply_ = std::move(send.callback);
             // waiting_for_reply_ is now guaranteed to be occupied. This forces other potential fully_ordered or
-            // truly_async senders to push their messages into the send_queue_. We neeed to unlock that queue
+            // truly_async senders to push their messages into the send_queues_. We neeed to unlock that queue
             // temporarily, as the other side of SendProtocolMessage is not under our control and it may cause
             // indefinite delay.
             lock.unlock();
             const auto expected = engine_->SendProtocolMessage(
                 client_fd_, score::cpp::to_underlying(ClientToServer::REQUEST), send.message);
             lock.lock();
-            send_pool_.push_front(send);
+            ReturnToPoolUnderLock(send);
             if (expected.has_value())
             {
                 break;
             }
             auto callback = std::move(*waiting_for_reply_);
             // We are not releasing waiting_for_reply_ yet. This makes our life easier if the callback and/or some
-            // competing thread wants to queue another message - they will just add it to the send_queue_ and we will
+            // competing thread wants to queue another message - they will just add it to the send_queues_ and we will
             // process it in the next iteration.
             lock.unlock();
             callback(score::cpp::make_unexpected(expected.error()));
@@ -548,7 +666,7 @@ void ClientConnection::ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& l
         }
         else
         {
-            // Temporarily make waiting_for_reply_ occupied to activate send_queue_ for fully_ordered or truly_async
+            // Temporarily make waiting_for_reply_ occupied to activate send_queues_ for fully_ordered or truly_async
             // senders and release the queue lock for the duration of SendProtocolMessage.
             waiting_for_reply_ = ReplyCallback{};
             lock.unlock();
@@ -556,9 +674,10 @@ void ClientConnection::ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& l
             score::cpp::ignore =
                 engine_->SendProtocolMessage(client_fd_, score::cpp::to_underlying(ClientToServer::SEND), send.message);
             lock.lock();
-            send_pool_.push_front(send);
+            ReturnToPoolUnderLock(send);
             waiting_for_reply_.reset();
         }
+        next_send = PopNextQueuedMessageUnderLock();
     }
 }
 
@@ -586,16 +705,18 @@ void ClientConnection::SwitchToStopState() noexcept
         }
         lock.lock();
     }
-    while (!send_queue_.empty())
+    SendCommand* next_send = PopNextQueuedMessageUnderLock();
+    while (next_send != nullptr)
     {
-        auto callback = std::move(send_queue_.front().callback);
-        send_queue_.pop_front();
+        auto callback = std::move(next_send->callback);
+        ReturnToPoolUnderLock(*next_send);
         if (!callback.empty())
         {
             lock.unlock();
             callback(score::cpp::make_unexpected(score::os::Error::createFromErrno(EPIPE)));
             lock.lock();
         }
+        next_send = PopNextQueuedMessageUnderLock();
     }
     lock.unlock();
     ProcessStateChange(State::kStopped);
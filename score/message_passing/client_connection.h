@@ -20,8 +20,11 @@
 #include <score/string.hpp>
 #include <score/vector.hpp>
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <optional>
 
@@ -47,6 +50,9 @@ class ClientConnection final : public IClientConnection
 
     score::cpp::expected_blank<score::os::Error> Send(score::cpp::span<const std::uint8_t> message) noexcept override;
 
+    score::cpp::expected_blank<score::os::Error> SendWithPriority(score::cpp::span<const std::uint8_t> message,
+                                                                  PriorityClass priority_class) noexcept override;
+
     score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> SendWaitReply(
         score::cpp::span<const std::uint8_t> message,
         score::cpp::span<std::uint8_t> reply) noexcept override;
@@ -64,15 +70,28 @@ class ClientConnection final : public IClientConnection
 
     void Restart() noexcept override;
 
+    /// \brief Statistics of the client side send queue of one priority class
+    struct QueueStatistics
+    {
+        std::uint32_t high_water_mark;  ///< Maximum number of messages of the class queued at the same time
+        std::uint32_t rejected_sends;   ///< Number of messages of the class rejected, because the queue was full
+    };
+
+    /// \brief Returns the send queue statistics of the given priority class since the construction of the connection
+    QueueStatistics GetQueueStatistics(PriorityClass priority_class) const noexcept;
+
   private:
     void TryConnect() noexcept;
-    bool TryQueueMessage(score::cpp::span<const std::uint8_t> message, ReplyCallback callback) noexcept;
+    bool TryQueueMessage(score::cpp::span<const std::uint8_t> message,
+                         ReplyCallback callback,
+                         PriorityClass priority_class) noexcept;
     StopReason ProcessInputEvent() noexcept;
 
     // The lock shall be already taken.
     // The function may release it, call a user callback, and then lock it again.
     void ProcessSendQueueUnderLock(std::unique_lock<std::mutex>& lock) noexcept;
     void ArmSendQueueUnderLock() noexcept;
+    bool IsSendQueueEmptyUnderLock() const noexcept;
 
     bool TrySetStopReason(const StopReason stop_reason) noexcept;
 
@@ -115,25 +134,39 @@ class ClientConnection final : public IClientConnection
     // at the time of construction of the connection object, we preallocate the storage for the amount of messages
     // requested in the client_config to be sent asynchronously. The send_storage_ container is responsible for managing
     // the lifetime of these message objects. In addition, we arrange a list of the currently unused message objects
-    // in send_pool_, relying on the allocation-free nature of intrusive lists. When we have a message to send
-    // asynchronously, we borrow an element from the send_pool and put it into the send_queue_, which is also an
-    // intrusive list container. When we send this message later, we return the freed element back to the send_pool_.
+    // in send_pools_, relying on the allocation-free nature of intrusive lists. When we have a message to send
+    // asynchronously, we borrow an element from the send_pool and put it into the send_queues_, which are also
+    // intrusive list containers. When we send this message later, we return the freed element back to its send pool.
     // Thus, we have no extra memory allocation after creation of a ClientConnection object.
+    // With priority classes, there is one send queue per class and, besides the shared send pool, one send pool per
+    // class with a reserved budget. Each SendCommand remembers the pool it belongs to.
     class SendCommand : public score::containers::intrusive_list_element<>
     {
       public:
         using allocator_type = score::cpp::pmr::polymorphic_allocator<SendCommand>;
         explicit SendCommand(const allocator_type& allocator)
-            : score::containers::intrusive_list_element<>{}, message(allocator), callback{}
+            : score::containers::intrusive_list_element<>{}, message(allocator), callback{}, pool_index{}
         {
         }
 
         score::cpp::pmr::vector<std::uint8_t> message;
         ReplyCallback callback;
+        std::size_t pool_index;
     };
+
+    // The last pool is the one shared by the priority classes without a reserved budget
+    static constexpr std::size_t kSharedPoolIndex{kPriorityClassCount};
+
+    SendCommand* PopNextQueuedMessageUnderLock() noexcept;
+    void ReturnToPoolUnderLock(SendCommand& send_command) noexcept;
+
     score::cpp::pmr::vector<SendCommand> send_storage_;
-    score::containers::intrusive_list<SendCommand> send_pool_;
-    score::containers::intrusive_list<SendCommand> send_queue_;
+    std::array<score::containers::intrusive_list<SendCommand>, kPriorityClassCount + 1U> send_pools_;
+    std::array<score::containers::intrusive_list<SendCommand>, kPriorityClassCount> send_queues_;
+    std::array<std::uint32_t, kPriorityClassCount> queued_sends_;
+    std::array<std::uint32_t, kPriorityClassCount> dispatch_credits_;
+    std::array<std::atomic<std::uint32_t>, kPriorityClassCount> high_water_marks_;
+    std::array<std::atomic<std::uint32_t>, kPriorityClassCount> rejected_sends_;
 
     std::optional<ReplyCallback> waiting_for_reply_;
 
@@ -17,8 +17,10 @@
 #include "score/message_passing/client_server_communication.h"
 #include "score/message_passing/mock/shared_resource_engine_mock.h"
 
+#include <algorithm>
 #include <future>
 #include <thread>
+#include <vector>
 
 namespace score
 {
@@ -319,7 +321,8 @@ class ClientConnectionTest : public ::testing::Test
     std::shared_ptr<StrictMock<SharedResourceEngineMock>> engine_{};
     const std::string service_identifier_{"test_identifier"};
     const ServiceProtocolConfig protocol_config_{service_identifier_, kMaxSendSize, kMaxReplySize, kMaxNotifySize};
-    IClientFactory::ClientConfig client_config_{0, 1, false, false, false};
+    IClientFactory::ClientConfig client_config_{
+        0, 1, false, false, false, {}, IClientFactory::ClientConfig::PriorityDispatch::kStrict};
     ISharedResourceEngine::CommandCallback connect_command_callback_{};
     ISharedResourceEngine::CommandCallback endpoint_command_callback_{};
     ISharedResourceEngine::CommandCallback disconnect_command_callback_{};
@@ -755,6 +758,141 @@ TEST_F(ClientConnectionTest, SendIsNotQueuedIfTrulyAsyncButNoSlots)
     StopCurrentConnection(connection);
 }
 
+TEST_F(ClientConnectionTest, GivenMixedTrafficControlMessageIsNeitherDelayedNorRejectedByBulkBurst)
+{
+    ::testing::Test::RecordProperty("lobster-tracing", "MessagePassing.BE_SendQueueExhausted");
+    ::testing::Test::RecordProperty(
+        "given", "truly-async client connection with reserved queue budgets for control and bulk messages");
+    constexpr std::uint32_t kBulkBudget{8U};
+    constexpr std::uint8_t kControlTag{1U};
+    constexpr std::uint8_t kBulkTag{2U};
+    client_config_.truly_async = true;
+    client_config_.max_queued_sends = 0;
+    client_config_.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kControl)] = {2U, 1U};
+    client_config_.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kBulk)] = {kBulkBudget,
+                                                                                                          1U};
+    detail::ClientConnection connection(engine_, protocol_config_, client_config_);
+    MakeSuccessfulConnection(connection);
+
+    CatchSendQueueCommand();
+
+    // Given a burst of bulk messages, which exhausts the bulk budget
+    std::array<std::uint8_t, kMaxSendSize> bulk_message{};
+    bulk_message.fill(kBulkTag);
+    for (std::uint32_t index = 0U; index < kBulkBudget; ++index)
+    {
+        EXPECT_TRUE(connection.SendWithPriority(bulk_message, IClientConnection::PriorityClass::kBulk));
+    }
+    const auto rejected_bulk_result = connection.SendWithPriority(bulk_message, IClientConnection::PriorityClass::kBulk);
+    ASSERT_FALSE(rejected_bulk_result);
+    EXPECT_EQ(rejected_bulk_result.error().GetOsDependentErrorCode(), ENOBUFS);
+
+    ::testing::Test::RecordProperty("when", "a control message is sent after the burst");
+    std::array<std::uint8_t, kMaxSendSize> control_message{};
+    control_message.fill(kControlTag);
+    const auto control_result = connection.SendWithPriority(control_message, IClientConnection::PriorityClass::kControl);
+
+    ::testing::Test::RecordProperty("then", "the control message is accepted and dispatched ahead of the burst");
+    EXPECT_TRUE(control_result);
+
+    std::vector<std::uint8_t> dispatch_order{};
+    EXPECT_CALL(*engine_, SendProtocolMessage(kValidFd, score::cpp::to_underlying(detail::ClientToServer::SEND), _))
+        .Times(kBulkBudget + 1U)
+        .WillRepeatedly([&dispatch_order](auto, auto, auto message) -> score::cpp::expected_blank<score::os::Error> {
+            dispatch_order.push_back(message.front());
+            return {};
+        });
+    InvokeSendQueueCommand();
+
+    // The dispatch latency of the control message is zero messages, instead of the kBulkBudget messages queued before
+    ASSERT_EQ(dispatch_order.size(), kBulkBudget + 1U);
+    EXPECT_EQ(dispatch_order.front(), kControlTag);
+    EXPECT_EQ(std::count(dispatch_order.cbegin(), dispatch_order.cend(), kBulkTag), kBulkBudget);
+
+    // and the statistics reflect the burst per priority class
+    const auto control_statistics = connection.GetQueueStatistics(IClientConnection::PriorityClass::kControl);
+    EXPECT_EQ(control_statistics.high_water_mark, 1U);
+    EXPECT_EQ(control_statistics.rejected_sends, 0U);
+    const auto bulk_statistics = connection.GetQueueStatistics(IClientConnection::PriorityClass::kBulk);
+    EXPECT_EQ(bulk_statistics.high_water_mark, kBulkBudget);
+    EXPECT_EQ(bulk_statistics.rejected_sends, 1U);
+
+    StopCurrentConnection(connection);
+}
+
+TEST_F(ClientConnectionTest, GivenWeightedDispatchLowerPriorityClassesAreNotStarved)
+{
+    ::testing::Test::RecordProperty("given", "truly-async client connection with weighted priority dispatch");
+    constexpr std::uint8_t kControlTag{1U};
+    constexpr std::uint8_t kBulkTag{2U};
+    client_config_.truly_async = true;
+    client_config_.max_queued_sends = 8;
+    client_config_.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kControl)] = {0U, 2U};
+    client_config_.priority_dispatch = IClientFactory::ClientConfig::PriorityDispatch::kWeighted;
+    detail::ClientConnection connection(engine_, protocol_config_, client_config_);
+    MakeSuccessfulConnection(connection);
+
+    CatchSendQueueCommand();
+
+    ::testing::Test::RecordProperty("when", "four bulk and then four control messages are queued");
+    std::array<std::uint8_t, kMaxSendSize> bulk_message{};
+    bulk_message.fill(kBulkTag);
+    std::array<std::uint8_t, kMaxSendSize> control_message{};
+    control_message.fill(kControlTag);
+    for (std::uint32_t index = 0U; index < 4U; ++index)
+    {
+        EXPECT_TRUE(connection.SendWithPriority(bulk_message, IClientConnection::PriorityClass::kBulk));
+    }
+    for (std::uint32_t index = 0U; index < 4U; ++index)
+    {
+        EXPECT_TRUE(connection.SendWithPriority(control_message, IClientConnection::PriorityClass::kControl));
+    }
+
+    std::vector<std::uint8_t> dispatch_order{};
+    EXPECT_CALL(*engine_, SendProtocolMessage(kValidFd, score::cpp::to_underlying(detail::ClientToServer::SEND), _))
+        .Times(8)
+        .WillRepeatedly([&dispatch_order](auto, auto, auto message) -> score::cpp::expected_blank<score::os::Error> {
+            dispatch_order.push_back(message.front());
+            return {};
+        });
+    InvokeSendQueueCommand();
+
+    ::testing::Test::RecordProperty("then", "each round dispatches two control messages and one bulk message");
+    EXPECT_EQ(dispatch_order,
+              (std::vector<std::uint8_t>{
+                  kControlTag, kControlTag, kBulkTag, kControlTag, kControlTag, kBulkTag, kBulkTag, kBulkTag}));
+
+    StopCurrentConnection(connection);
+}
+
+TEST_F(ClientConnectionTest, QueuedSendsOfAllPriorityClassesAreReleasedOnStop)
+{
+    ::testing::Test::RecordProperty("given", "truly-async client connection with a reserved control budget of one");
+    client_config_.truly_async = true;
+    client_config_.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kControl)] = {1U, 1U};
+    detail::ClientConnection connection(engine_, protocol_config_, client_config_);
+    MakeSuccessfulConnection(connection);
+
+    std::array<std::uint8_t, kMaxSendSize> send_buffer{};
+    CatchSendQueueCommand();
+    EXPECT_TRUE(connection.SendWithPriority(send_buffer, IClientConnection::PriorityClass::kControl));
+    EXPECT_TRUE(connection.Send(send_buffer));
+
+    ::testing::Test::RecordProperty("when", "the connection is stopped and restarted with the messages still queued");
+    StopCurrentConnection(connection);
+    send_queue_command_callback_ = ISharedResourceEngine::CommandCallback{};
+    MakeSuccessfulConnection(connection);
+
+    ::testing::Test::RecordProperty("then", "the queue slots of all classes are available again");
+    CatchSendQueueCommand();
+    EXPECT_TRUE(connection.SendWithPriority(send_buffer, IClientConnection::PriorityClass::kControl));
+    EXPECT_TRUE(connection.Send(send_buffer));
+    EXPECT_EQ(connection.GetQueueStatistics(IClientConnection::PriorityClass::kControl).rejected_sends, 0U);
+    EXPECT_EQ(connection.GetQueueStatistics(IClientConnection::PriorityClass::kDefault).rejected_sends, 0U);
+
+    StopCurrentConnection(connection);
+}
+
 TEST_F(ClientConnectionTest, SendWaitReplyFailsWhenCalledInCallback)
 {
     ::testing::Test::RecordProperty("lobster-tracing", "MessagePassing.SendBufferArgumentValidation");
@@ -19,6 +19,9 @@
 #include <score/expected.hpp>
 #include <score/span.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace score
 {
 namespace message_passing
@@ -54,6 +57,30 @@ class IClientConnection
     virtual score::cpp::expected_blank<score::os::Error> Send(
         score::cpp::span<const std::uint8_t> message) noexcept = 0;
 
+    /// \brief Priority class of a fire-and-forget message
+    /// \details The priority class only matters for messages which are queued on the client side. A queued message of
+    ///          a higher priority class (lower value) is dispatched ahead of queued messages of lower priority classes,
+    ///          according to ClientConfig::priority_dispatch. Each priority class can have its own queue budget
+    ///          (ClientConfig::priority_classes), so that e.g. a burst of bulk messages cannot exhaust the queue slots
+    ///          needed by control messages.
+    enum class PriorityClass : std::uint8_t
+    {
+        kControl = 0U,  ///< Messages which shall never be delayed or rejected by other traffic
+        kDefault = 1U,  ///< Messages sent by Send(), SendWaitReply() and SendWithCallback()
+        kBulk = 2U      ///< High volume messages, e.g. event notifications
+    };
+    static constexpr std::size_t kPriorityClassCount{3U};
+
+    /// \brief Send a binary message of the given priority class to the respective server, don't expect a reply
+    /// \details Same as Send(), except for the priority class of the message. The server is guaranteed to receive the
+    ///          messages of the same priority class in the same order as they were sent. Messages of different priority
+    ///          classes may overtake each other while they are queued on the client side.
+    /// \param message The memory span containing the message to send
+    /// \param priority_class The priority class of the message
+    /// \return error if fails
+    virtual score::cpp::expected_blank<score::os::Error> SendWithPriority(score::cpp::span<const std::uint8_t> message,
+                                                                          PriorityClass priority_class) noexcept = 0;
+
     /// \brief Send a binary message to the respective server, wait for reply
     /// \details The call is blocking.
     /// \param message The memory span containing the message to send
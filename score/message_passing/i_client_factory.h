@@ -18,6 +18,7 @@
 
 #include <score/memory.hpp>
 
+#include <array>
 #include <cstdint>
 
 namespace score
@@ -42,6 +43,24 @@ class IClientFactory
     // False positive. These are configuration parameters.
     struct ClientConfig
     {
+        /// \brief Order in which queued messages of different priority classes are dispatched
+        enum class PriorityDispatch : std::uint8_t
+        {
+            kStrict,    ///< always dispatch the queued message of the highest priority class first
+            kWeighted,  ///< dispatch up to PriorityClassConfig::weight messages of each priority class per round,
+                        ///< so that lower priority classes are not starved
+        };
+
+        // Suppress "AUTOSAR C++14 A9-6-1", as above.
+
+        struct PriorityClassConfig
+        {
+            std::uint32_t max_queued_sends;  ///< Number of queue slots reserved for Send messages of this class.
+                                             ///< 0 if the class shares the max_queued_sends slots
+            std::uint32_t weight;            ///< Share of the class per round in PriorityDispatch::kWeighted.
+                                             ///< 0 is treated as 1
+        };
+
         std::uint32_t max_async_replies;  ///< Maximum number of SendWithCallback messages issued concurrently.
                                           ///< 0 if async replies are not used
         std::uint32_t max_queued_sends;   ///< Maximum number of Send messages queued on client side.
@@ -55,6 +74,10 @@ class IClientFactory
         // coverity[autosar_cpp14_a9_6_1_violation : FALSE]
         bool sync_first_connect;  ///< true if the first connection attempt uses the thread on which Start() is called
                                   ///< (can lead to deadlocks if the connection is established from within a callback)
+        std::array<PriorityClassConfig, IClientConnection::kPriorityClassCount>
+            priority_classes;  ///< Per IClientConnection::PriorityClass queue budget and dispatch weight.
+                               ///< Messages with a reply always use the IClientConnection::PriorityClass::kDefault
+        PriorityDispatch priority_dispatch;  ///< Dispatch order of the queued messages of different priority classes
     };
 
     /// \brief Creates an implementation instance of IClientConnection.
@@ -29,6 +29,10 @@ class ClientConnectionMock : public IClientConnection
                 Send,
                 (score::cpp::span<const std::uint8_t>),
                 (noexcept, override));
+    MOCK_METHOD(score::cpp::expected_blank<score::os::Error>,
+                SendWithPriority,
+                (score::cpp::span<const std::uint8_t>, PriorityClass),
+                (noexcept, override));
     MOCK_METHOD((score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error>),
                 SendWaitReply,
                 (score::cpp::span<const std::uint8_t>, score::cpp::span<std::uint8_t>),
@@ -72,6 +76,12 @@ class ClientConnectionMockFacade : public IClientConnection
         return client_connection_mock_.Send(message);
     }
 
+    score::cpp::expected_blank<score::os::Error> SendWithPriority(score::cpp::span<const std::uint8_t> message,
+                                                                  PriorityClass priority_class) noexcept override
+    {
+        return client_connection_mock_.SendWithPriority(message, priority_class);
+    }
+
     score::cpp::expected<score::cpp::span<const std::uint8_t>, score::os::Error> SendWaitReply(
         score::cpp::span<const std::uint8_t> message,
         score::cpp::span<std::uint8_t> reply) noexcept override
@@ -14,6 +14,7 @@
 
 #include "score/message_passing/client_connection.h"
 #include "score/message_passing/unix_domain/unix_domain_engine.h"
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
 
 namespace score
 {
@@ -26,7 +27,12 @@ UnixDomainClientFactory::UnixDomainClientFactory(score::cpp::pmr::memory_resourc
 }
 
 UnixDomainClientFactory::UnixDomainClientFactory(const std::shared_ptr<UnixDomainEngine> engine) noexcept
-    : engine_{engine}
+    : engine_pool_{}, engine_{engine}
+{
+}
+
+UnixDomainClientFactory::UnixDomainClientFactory(const std::shared_ptr<UnixDomainEnginePool> engine_pool) noexcept
+    : engine_pool_{engine_pool}, engine_{engine_pool->GetEngine(0U)}
 {
 }
 
@@ -36,8 +42,14 @@ score::cpp::pmr::unique_ptr<IClientConnection> UnixDomainClientFactory::Create(
     const ServiceProtocolConfig& protocol_config,
     const ClientConfig& client_config) noexcept
 {
+    auto engine = SelectEngine();
     return score::cpp::pmr::make_unique<detail::ClientConnection>(
-        engine_->GetMemoryResource(), engine_, protocol_config, client_config);
+        engine->GetMemoryResource(), std::move(engine), protocol_config, client_config);
+}
+
+std::shared_ptr<UnixDomainEngine> UnixDomainClientFactory::SelectEngine() noexcept
+{
+    return (engine_pool_ != nullptr) ? engine_pool_->GetNextEngine() : engine_;
 }
 
 }  // namespace message_passing
@@ -21,6 +21,7 @@ namespace message_passing
 {
 
 class UnixDomainEngine;
+class UnixDomainEnginePool;
 
 class UnixDomainClientFactory final : public IClientFactory
 {
@@ -28,6 +29,8 @@ class UnixDomainClientFactory final : public IClientFactory
     explicit UnixDomainClientFactory(
         score::cpp::pmr::memory_resource* const resource = score::cpp::pmr::get_default_resource()) noexcept;
     explicit UnixDomainClientFactory(const std::shared_ptr<UnixDomainEngine> engine) noexcept;
+    /// \brief Creates a factory distributing the created connections over the reactors of the pool
+    explicit UnixDomainClientFactory(const std::shared_ptr<UnixDomainEnginePool> engine_pool) noexcept;
     ~UnixDomainClientFactory() noexcept;
 
     score::cpp::pmr::unique_ptr<IClientConnection> Create(const ServiceProtocolConfig& protocol_config,
@@ -38,7 +41,15 @@ class UnixDomainClientFactory final : public IClientFactory
         return engine_;
     }
 
+    std::shared_ptr<UnixDomainEnginePool> GetEnginePool() const noexcept
+    {
+        return engine_pool_;
+    }
+
   private:
+    std::shared_ptr<UnixDomainEngine> SelectEngine() noexcept;
+
+    const std::shared_ptr<UnixDomainEnginePool> engine_pool_;
     const std::shared_ptr<UnixDomainEngine> engine_;
 };
 
@@ -0,0 +1,55 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
+
+#include "score/message_passing/unix_domain/unix_domain_engine.h"
+
+#include <score/assert.hpp>
+
+namespace score
+{
+namespace message_passing
+{
+
+UnixDomainEnginePool::UnixDomainEnginePool(score::cpp::pmr::memory_resource* memory_resource,
+                                           const std::size_t number_of_reactors,
+                                           const LoggerFactory logger_factory) noexcept
+    : engines_{memory_resource}, next_engine_{0U}
+{
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(number_of_reactors > 0U);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(logger_factory != nullptr);
+
+    engines_.reserve(number_of_reactors);
+    for (std::size_t i = 0U; i < number_of_reactors; ++i)
+    {
+        engines_.push_back(score::cpp::pmr::make_shared<UnixDomainEngine>(
+            memory_resource, memory_resource, logger_factory()));
+    }
+}
+
+UnixDomainEnginePool::~UnixDomainEnginePool() noexcept = default;
+
+std::shared_ptr<UnixDomainEngine> UnixDomainEnginePool::GetEngine(const std::size_t index) const noexcept
+{
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(index < engines_.size());
+    return engines_[index];
+}
+
+std::shared_ptr<UnixDomainEngine> UnixDomainEnginePool::GetNextEngine() noexcept
+{
+    const auto index = next_engine_.fetch_add(1U, std::memory_order_relaxed) % engines_.size();
+    return engines_[index];
+}
+
+}  // namespace message_passing
+}  // namespace score
@@ -0,0 +1,70 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_LIB_MESSAGE_PASSING_UNIX_DOMAIN_UNIX_DOMAIN_ENGINE_POOL_H
+#define SCORE_LIB_MESSAGE_PASSING_UNIX_DOMAIN_UNIX_DOMAIN_ENGINE_POOL_H
+
+#include "score/message_passing/log/logging_callback.h"
+
+#include <score/memory.hpp>
+#include <score/vector.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace score
+{
+namespace message_passing
+{
+
+class UnixDomainEngine;
+
+/// \brief Set of UnixDomainEngine reactors sharing the connection load of one process
+/// \details Every reactor is a complete UnixDomainEngine with its own background thread, poll set and timer queue,
+///          so the ISharedResourceEngine contract (callback thread, command queue, owner cleanup) holds per reactor.
+///          Client connections and servers created through a pool-based factory are assigned to the reactors
+///          round-robin; all the connections accepted by a server stay on the reactor of that server.
+///          A pool of size 1 behaves exactly like a single shared UnixDomainEngine.
+class UnixDomainEnginePool final
+{
+  public:
+    using LoggerFactory = LoggingCallback (*)();
+
+    UnixDomainEnginePool(score::cpp::pmr::memory_resource* memory_resource,
+                         std::size_t number_of_reactors,
+                         LoggerFactory logger_factory = &GetCerrLogger) noexcept;
+    ~UnixDomainEnginePool() noexcept;
+
+    UnixDomainEnginePool(const UnixDomainEnginePool&) = delete;
+    UnixDomainEnginePool& operator=(const UnixDomainEnginePool&) = delete;
+
+    std::size_t GetSize() const noexcept
+    {
+        return engines_.size();
+    }
+
+    /// \brief Returns the reactor with the given index; the index shall be less than GetSize()
+    std::shared_ptr<UnixDomainEngine> GetEngine(const std::size_t index) const noexcept;
+
+    /// \brief Returns the next reactor in round-robin order; safe to call from any thread
+    std::shared_ptr<UnixDomainEngine> GetNextEngine() noexcept;
+
+  private:
+    score::cpp::pmr::vector<std::shared_ptr<UnixDomainEngine>> engines_;
+    std::atomic<std::size_t> next_engine_;
+};
+
+}  // namespace message_passing
+}  // namespace score
+
+#endif  // SCORE_LIB_MESSAGE_PASSING_UNIX_DOMAIN_UNIX_DOMAIN_ENGINE_POOL_H
@@ -13,6 +13,7 @@
 #include "score/message_passing/unix_domain/unix_domain_server_factory.h"
 
 #include "score/message_passing/unix_domain/unix_domain_engine.h"
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
 #include "score/message_passing/unix_domain/unix_domain_server.h"
 
 namespace score
@@ -26,7 +27,12 @@ UnixDomainServerFactory::UnixDomainServerFactory(score::cpp::pmr::memory_resourc
 }
 
 UnixDomainServerFactory::UnixDomainServerFactory(const std::shared_ptr<UnixDomainEngine> engine) noexcept
-    : engine_{engine}
+    : engine_pool_{}, engine_{engine}
+{
+}
+
+UnixDomainServerFactory::UnixDomainServerFactory(const std::shared_ptr<UnixDomainEnginePool> engine_pool) noexcept
+    : engine_pool_{engine_pool}, engine_{engine_pool->GetEngine(0U)}
 {
 }
 
@@ -35,8 +41,14 @@ UnixDomainServerFactory::~UnixDomainServerFactory() noexcept {}
 score::cpp::pmr::unique_ptr<IServer> UnixDomainServerFactory::Create(const ServiceProtocolConfig& protocol_config,
                                                                      const ServerConfig& server_config) noexcept
 {
+    auto engine = SelectEngine();
     return score::cpp::pmr::make_unique<detail::UnixDomainServer>(
-        engine_->GetMemoryResource(), engine_, protocol_config, server_config);
+        engine->GetMemoryResource(), std::move(engine), protocol_config, server_config);
+}
+
+std::shared_ptr<UnixDomainEngine> UnixDomainServerFactory::SelectEngine() noexcept
+{
+    return (engine_pool_ != nullptr) ? engine_pool_->GetNextEngine() : engine_;
 }
 
 }  // namespace message_passing
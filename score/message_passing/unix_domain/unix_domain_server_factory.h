@@ -21,6 +21,7 @@ namespace message_passing
 {
 
 class UnixDomainEngine;
+class UnixDomainEnginePool;
 
 class UnixDomainServerFactory final : public IServerFactory
 {
@@ -28,6 +29,8 @@ class UnixDomainServerFactory final : public IServerFactory
     explicit UnixDomainServerFactory(
         score::cpp::pmr::memory_resource* const resource = score::cpp::pmr::get_default_resource()) noexcept;
     explicit UnixDomainServerFactory(const std::shared_ptr<UnixDomainEngine> engine) noexcept;
+    /// \brief Creates a factory distributing the created servers over the reactors of the pool
+    explicit UnixDomainServerFactory(const std::shared_ptr<UnixDomainEnginePool> engine_pool) noexcept;
     ~UnixDomainServerFactory() noexcept;
 
     score::cpp::pmr::unique_ptr<IServer> Create(const ServiceProtocolConfig& protocol_config,
@@ -38,7 +41,15 @@ class UnixDomainServerFactory final : public IServerFactory
         return engine_;
     }
 
+    std::shared_ptr<UnixDomainEnginePool> GetEnginePool() const noexcept
+    {
+        return engine_pool_;
+    }
+
   private:
+    std::shared_ptr<UnixDomainEngine> SelectEngine() noexcept;
+
+    const std::shared_ptr<UnixDomainEnginePool> engine_pool_;
     const std::shared_ptr<UnixDomainEngine> engine_;
 };
 
@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2025 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include <gtest/gtest.h>
+
+#include "score/message_passing/i_server_connection.h"
+#include "score/message_passing/unix_domain/unix_domain_client_factory.h"
+#include "score/message_passing/unix_domain/unix_domain_engine.h"
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
+#include "score/message_passing/unix_domain/unix_domain_server_factory.h"
+
+#include <array>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace score
+{
+namespace message_passing
+{
+namespace
+{
+
+constexpr std::chrono::seconds kFutureWaitTimeout{5};
+
+std::thread::id GetCallbackThreadId(UnixDomainEngine& engine)
+{
+    std::promise<std::thread::id> promise;
+    ISharedResourceEngine::CommandQueueEntry command;
+    engine.EnqueueCommand(
+        command,
+        ISharedResourceEngine::TimePoint{},
+        [&promise, &engine](auto) noexcept {
+            EXPECT_TRUE(engine.IsOnCallbackThread());
+            promise.set_value(std::this_thread::get_id());
+        },
+        &promise);
+    auto future = promise.get_future();
+    EXPECT_EQ(future.wait_for(kFutureWaitTimeout), std::future_status::ready);
+    return future.get();
+}
+
+TEST(UnixDomainEnginePoolTest, EveryReactorRunsOnItsOwnThread)
+{
+    UnixDomainEnginePool pool{score::cpp::pmr::get_default_resource(), 3U};
+    ASSERT_EQ(pool.GetSize(), 3U);
+
+    std::set<std::thread::id> callback_threads{};
+    for (std::size_t i = 0U; i < pool.GetSize(); ++i)
+    {
+        auto engine = pool.GetEngine(i);
+        ASSERT_NE(engine, nullptr);
+        EXPECT_FALSE(engine->IsOnCallbackThread());
+        callback_threads.insert(GetCallbackThreadId(*engine));
+    }
+    EXPECT_EQ(callback_threads.size(), 3U);
+    EXPECT_EQ(callback_threads.count(std::this_thread::get_id()), 0U);
+}
+
+TEST(UnixDomainEnginePoolTest, NextEngineIsSelectedRoundRobin)
+{
+    UnixDomainEnginePool pool{score::cpp::pmr::get_default_resource(), 2U};
+
+    EXPECT_EQ(pool.GetNextEngine(), pool.GetEngine(0U));
+    EXPECT_EQ(pool.GetNextEngine(), pool.GetEngine(1U));
+    EXPECT_EQ(pool.GetNextEngine(), pool.GetEngine(0U));
+}
+
+TEST(UnixDomainEnginePoolTest, FactoriesExposeFirstReactorAsEngine)
+{
+    auto pool = std::make_shared<UnixDomainEnginePool>(score::cpp::pmr::get_default_resource(), 2U);
+    UnixDomainClientFactory client_factory{pool};
+    UnixDomainServerFactory server_factory{pool};
+
+    EXPECT_EQ(client_factory.GetEngine(), pool->GetEngine(0U));
+    EXPECT_EQ(server_factory.GetEngine(), pool->GetEngine(0U));
+    EXPECT_EQ(client_factory.GetEnginePool(), pool);
+    EXPECT_EQ(server_factory.GetEnginePool(), pool);
+
+    UnixDomainClientFactory single_engine_factory{pool->GetEngine(1U)};
+    EXPECT_EQ(single_engine_factory.GetEnginePool(), nullptr);
+}
+
+TEST(UnixDomainEnginePoolTest, ServersAndConnectionsAreShardedOverReactors)
+{
+    constexpr std::size_t kServerCount{2U};
+    auto pool = std::make_shared<UnixDomainEnginePool>(score::cpp::pmr::get_default_resource(), kServerCount);
+    UnixDomainServerFactory server_factory{pool};
+    UnixDomainClientFactory client_factory{pool};
+
+    std::mutex mutex;
+    std::set<std::thread::id> server_threads{};
+    const auto echo_callback = [&mutex, &server_threads](IServerConnection& connection,
+                                                         score::cpp::span<const std::uint8_t> message)
+        -> score::cpp::blank {
+        {
+            std::lock_guard<std::mutex> guard{mutex};
+            server_threads.insert(std::this_thread::get_id());
+        }
+        connection.Reply(message);
+        return {};
+    };
+
+    const std::string prefix{"test_pool_prefix_" + std::to_string(::getpid()) + "_"};
+    std::array<std::string, kServerCount> identifiers{prefix + "0", prefix + "1"};
+    std::array<score::cpp::pmr::unique_ptr<IServer>, kServerCount> servers{};
+    std::array<score::cpp::pmr::unique_ptr<IClientConnection>, kServerCount> clients{};
+    const IClientFactory::ClientConfig client_config{
+        0, 0, false, false, true, {}, IClientFactory::ClientConfig::PriorityDispatch::kStrict};
+
+    for (std::size_t i = 0U; i < kServerCount; ++i)
+    {
+        const ServiceProtocolConfig protocol_config{identifiers[i], 16, 16, 16};
+        servers[i] = server_factory.Create(protocol_config, IServerFactory::ServerConfig{});
+        ASSERT_TRUE(servers[i]);
+        const auto connect_callback = [](IServerConnection&) -> void* {
+            return nullptr;
+        };
+        ASSERT_TRUE(
+            servers[i]->StartListening(connect_callback, DisconnectCallback{}, MessageCallback{}, echo_callback)
+                .has_value());
+    }
+
+    for (std::size_t i = 0U; i < kServerCount; ++i)
+    {
+        const ServiceProtocolConfig protocol_config{identifiers[i], 16, 16, 16};
+        clients[i] = client_factory.Create(protocol_config, client_config);
+        ASSERT_TRUE(clients[i]);
+
+        std::promise<void> ready;
+        clients[i]->Start(
+            [&ready](IClientConnection::State state) noexcept {
+                if (state == IClientConnection::State::kReady)
+                {
+                    ready.set_value();
+                }
+            },
+            IClientConnection::NotifyCallback{});
+        ASSERT_EQ(ready.get_future().wait_for(kFutureWaitTimeout), std::future_status::ready);
+
+        std::array<std::uint8_t, 4> message{1, 2, 3, 4};
+        std::array<std::uint8_t, 16> reply_buffer{};
+        const auto reply_expected = clients[i]->SendWaitReply(message, reply_buffer);
+        ASSERT_TRUE(reply_expected.has_value());
+        EXPECT_EQ(reply_expected.value().size(), message.size());
+    }
+
+    // each server, with all its accepted connections, is served by its own reactor
+    EXPECT_EQ(server_threads.size(), kServerCount);
+
+    for (auto& client : clients)
+    {
+        client.reset();
+    }
+    for (auto& server : servers)
+    {
+        server->StopListening();
+        server.reset();
+    }
+}
+
+}  // namespace
+}  // namespace message_passing
+}  // namespace score
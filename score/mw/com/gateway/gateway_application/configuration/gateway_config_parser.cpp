@@ -15,7 +15,11 @@
 #include "score/json/json_parser.h"
 #include "score/mw/log/logging.h"
 
+#include <chrono>
+#include <cstdint>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace score::mw::com::gateway
@@ -30,6 +34,12 @@ constexpr auto kReceivedServicesKey = "expected-received-services"sv;
 constexpr auto kTransportLayerKey = "transport-layer"sv;
 constexpr auto kTransportLayerIdKey = "id"sv;
 constexpr auto kTransportConfigPathKey = "config-path"sv;
+constexpr auto kEventForwardingPoliciesKey = "event-forwarding-policies"sv;
+constexpr auto kPolicyInstanceSpecifierKey = "instance-specifier"sv;
+constexpr auto kPolicyEventKey = "event"sv;
+constexpr auto kPolicyOnChangeOnlyKey = "on-change-only"sv;
+constexpr auto kPolicyMaxRateKey = "max-rate-hz"sv;
+constexpr auto kPolicyHeartbeatIntervalKey = "heartbeat-interval-ms"sv;
 
 auto ParseForwardedServices(const score::json::Any& json) noexcept -> std::vector<std::string>
 {
@@ -102,6 +112,63 @@ auto ParseTransportLayerRef(const score::json::Any& json) noexcept -> std::pair<
     return {std::move(transport_layer_id), std::move(transport_config_path)};
 }
 
+auto ParseEventForwardingPolicy(const score::json::Object& policy_object) noexcept -> EventForwardingPolicy
+{
+    EventForwardingPolicy policy{};
+
+    const auto& on_change_only_entry = policy_object.find(kPolicyOnChangeOnlyKey.data());
+    if (on_change_only_entry != policy_object.cend())
+    {
+        policy.on_change_only = on_change_only_entry->second.As<bool>().value();
+    }
+
+    const auto& max_rate_entry = policy_object.find(kPolicyMaxRateKey.data());
+    if (max_rate_entry != policy_object.cend())
+    {
+        const auto max_rate_hz = max_rate_entry->second.As<std::uint32_t>().value();
+        if (max_rate_hz > 0U)
+        {
+            // Rounded up, so that the configured rate is never exceeded.
+            constexpr std::uint32_t kMillisecondsPerSecond{1000U};
+            policy.min_forwarding_interval =
+                std::chrono::milliseconds{(kMillisecondsPerSecond + max_rate_hz - 1U) / max_rate_hz};
+        }
+    }
+
+    const auto& heartbeat_entry = policy_object.find(kPolicyHeartbeatIntervalKey.data());
+    if (heartbeat_entry != policy_object.cend())
+    {
+        policy.heartbeat_interval = std::chrono::milliseconds{heartbeat_entry->second.As<std::uint32_t>().value()};
+    }
+    return policy;
+}
+
+auto ParseEventForwardingPolicies(const score::json::Any& json) noexcept
+    -> std::unordered_map<std::string, EventForwardingPolicies>
+{
+    std::unordered_map<std::string, EventForwardingPolicies> policies{};
+
+    if (json.As<score::json::Object>().has_value())
+    {
+        const auto& json_object = json.As<score::json::Object>().value().get();
+        const auto& policies_entry = json_object.find(kEventForwardingPoliciesKey.data());
+
+        if (policies_entry != json_object.cend())
+        {
+            for (const auto& policy_json : policies_entry->second.As<score::json::List>().value().get())
+            {
+                const auto& policy_object = policy_json.As<score::json::Object>().value().get();
+                const auto& instance_specifier =
+                    policy_object.find(kPolicyInstanceSpecifierKey.data())->second.As<std::string>().value().get();
+                const auto& event_name =
+                    policy_object.find(kPolicyEventKey.data())->second.As<std::string>().value().get();
+                policies[instance_specifier][event_name] = ParseEventForwardingPolicy(policy_object);
+            }
+        }
+    }
+    return policies;
+}
+
 }  // namespace
 
 auto ParseGatewayConfig(const std::string_view path) noexcept -> GatewayConfiguration
@@ -130,8 +197,11 @@ auto ParseGatewayConfig(score::json::Any json) noexcept -> GatewayConfiguration
     }
 
     auto [transport_layer_id, transport_config_path] = ParseTransportLayerRef(json);
-    return GatewayConfiguration{
-        ParseForwardedServices(json), ParseReceivedServices(json), transport_layer_id, transport_config_path};
+    return GatewayConfiguration{ParseForwardedServices(json),
+                                ParseReceivedServices(json),
+                                transport_layer_id,
+                                transport_config_path,
+                                ParseEventForwardingPolicies(json)};
 }
 
 }  // namespace score::mw::com::gateway
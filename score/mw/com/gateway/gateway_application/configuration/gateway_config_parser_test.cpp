@@ -15,6 +15,7 @@
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <fstream>
 
 namespace score::mw::com::gateway
@@ -57,6 +58,56 @@ TEST_F(GatewayConfigParserFixture, ParseExampleJson)
 
     EXPECT_EQ("sample_hypervisor", config.GetTransportLayerId());
     EXPECT_EQ("/etc/mw_com/gateway/mw_com_gateway_transport_config.json", config.GetTransportConfigPath());
+
+    const auto policy = config.GetEventForwardingPolicy("abc/abc/TirePressurePort", "tire_pressure");
+    EXPECT_TRUE(policy.on_change_only);
+    EXPECT_EQ(std::chrono::milliseconds{100}, policy.min_forwarding_interval);
+    EXPECT_EQ(std::chrono::milliseconds{1000}, policy.heartbeat_interval);
+}
+
+TEST_F(GatewayConfigParserFixture, ParseEventForwardingPolicies)
+{
+    // Given a configuration with a partial and a complete policy for events of the same service instance
+    auto j = R"({
+        "forwarded-services": ["abc/abc/Service"],
+        "transport-layer": {"id": "sample_hypervisor", "config-path": "/tmp/transport.json"},
+        "event-forwarding-policies": [
+            {"instance-specifier": "abc/abc/Service", "event": "on_change", "on-change-only": true},
+            {"instance-specifier": "abc/abc/Service", "event": "limited",
+             "max-rate-hz": 3, "heartbeat-interval-ms": 500}
+        ]
+    })"_json;
+
+    // When parsing it
+    const auto config = ParseGatewayConfig(std::move(j));
+
+    // Then the omitted fields of a policy keep their defaults
+    const auto on_change_policy = config.GetEventForwardingPolicy("abc/abc/Service", "on_change");
+    EXPECT_TRUE(on_change_policy.on_change_only);
+    EXPECT_EQ(std::chrono::milliseconds{0}, on_change_policy.min_forwarding_interval);
+    EXPECT_EQ(std::chrono::milliseconds{0}, on_change_policy.heartbeat_interval);
+
+    // and the maximum rate is converted into a minimum interval, which is rounded up
+    const auto limited_policy = config.GetEventForwardingPolicy("abc/abc/Service", "limited");
+    EXPECT_FALSE(limited_policy.on_change_only);
+    EXPECT_EQ(std::chrono::milliseconds{334}, limited_policy.min_forwarding_interval);
+    EXPECT_EQ(std::chrono::milliseconds{500}, limited_policy.heartbeat_interval);
+}
+
+TEST_F(GatewayConfigParserFixture, EventsWithoutPolicyForwardAllUpdates)
+{
+    // Given a configuration without any event forwarding policies
+    auto j = R"({
+        "forwarded-services": ["abc/abc/Service"],
+        "transport-layer": {"id": "sample_hypervisor", "config-path": "/tmp/transport.json"}
+    })"_json;
+
+    // When parsing it
+    const auto config = ParseGatewayConfig(std::move(j));
+
+    // Then the policy of any event forwards every update
+    EXPECT_TRUE(config.GetEventForwardingPolicy("abc/abc/Service", "any_event").ForwardsAllUpdates());
+    EXPECT_EQ(std::chrono::milliseconds{0}, config.GetEventForwardingPolicy("other/Service", "e").heartbeat_interval);
 }
 
 TEST_F(GatewayConfigParserFixture, ParseFromInvalidPathDies)
@@ -11,3 +11,24 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/com/gateway/gateway_application/configuration/gateway_configuration.h"
+
+namespace score::mw::com::gateway
+{
+
+EventForwardingPolicy GatewayConfiguration::GetEventForwardingPolicy(const std::string_view instance_specifier,
+                                                                     const std::string_view event_name) const
+{
+    const auto instance_it = event_forwarding_policies_.find(std::string{instance_specifier});
+    if (instance_it == event_forwarding_policies_.cend())
+    {
+        return EventForwardingPolicy{};
+    }
+    const auto event_it = instance_it->second.find(std::string{event_name});
+    if (event_it == instance_it->second.cend())
+    {
+        return EventForwardingPolicy{};
+    }
+    return event_it->second;
+}
+
+}  // namespace score::mw::com::gateway
@@ -13,24 +13,53 @@
 #ifndef SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_CONFIGURATION_GATEWAY_CONFIGURATION_H
 #define SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_CONFIGURATION_GATEWAY_CONFIGURATION_H
 
+#include <chrono>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace score::mw::com::gateway
 {
 
+/// \brief Policy, which limits the forwarding of update notifications of an event to the destination gateway.
+/// \details The default policy forwards every update.
+struct EventForwardingPolicy
+{
+    /// \brief Forward an update only, if the sample differs from the last forwarded one.
+    bool on_change_only{false};
+    /// \brief Minimum interval between two forwarded updates. Updates within the interval are conflated, i.e. a single
+    /// update is forwarded, when the interval has expired, which gives access to the latest sample. Zero disables the
+    /// rate limit.
+    std::chrono::milliseconds min_forwarding_interval{0};
+    /// \brief Maximum interval without a forwarded update, as long as the producer keeps sending. If it is exceeded,
+    /// the next update is forwarded, even if it has been unchanged. Zero disables the heartbeat.
+    std::chrono::milliseconds heartbeat_interval{0};
+
+    /// \brief Returns true, if every update is forwarded immediately.
+    bool ForwardsAllUpdates() const noexcept
+    {
+        return (!on_change_only) && (min_forwarding_interval.count() == 0);
+    }
+};
+
+/// \brief Forwarding policies per event name.
+using EventForwardingPolicies = std::unordered_map<std::string, EventForwardingPolicy>;
+
 class GatewayConfiguration
 {
   public:
     GatewayConfiguration(std::vector<std::string> forwarded_services,
                          std::vector<std::string> received_services,
                          std::string transport_layer_id,
-                         std::string transport_config_path)
+                         std::string transport_config_path,
+                         std::unordered_map<std::string, EventForwardingPolicies> event_forwarding_policies = {})
         : forwarded_services_{std::move(forwarded_services)},
           received_services_{std::move(received_services)},
           transport_layer_id_{std::move(transport_layer_id)},
-          transport_config_path_{std::move(transport_config_path)}
+          transport_config_path_{std::move(transport_config_path)},
+          event_forwarding_policies_{std::move(event_forwarding_policies)}
     {
     }
     ~GatewayConfiguration() noexcept = default;
@@ -55,11 +84,18 @@ class GatewayConfiguration
         return transport_config_path_;
     }
 
+    /// \brief Returns the forwarding policy of the given event of a forwarded service instance. If none has been
+    /// configured, the default policy, which forwards every update, is returned.
+    EventForwardingPolicy GetEventForwardingPolicy(std::string_view instance_specifier,
+                                                   std::string_view event_name) const;
+
   private:
     std::vector<std::string> forwarded_services_;
     std::vector<std::string> received_services_;
     std::string transport_layer_id_;
     std::string transport_config_path_;
+    // Forwarding policies per instance specifier of a forwarded service instance.
+    std::unordered_map<std::string, EventForwardingPolicies> event_forwarding_policies_;
 };
 
 }  // namespace score::mw::com::gateway
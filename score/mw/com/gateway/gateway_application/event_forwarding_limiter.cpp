@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/gateway_application/event_forwarding_limiter.h"
+
+namespace score::mw::com::gateway
+{
+
+namespace
+{
+
+constexpr std::uint64_t kFnvOffsetBasis{14695981039346656037U};
+constexpr std::uint64_t kFnvPrime{1099511628211U};
+
+}  // namespace
+
+EventForwardingLimiter::EventForwardingLimiter(const EventForwardingPolicy& policy) noexcept
+    : policy_{policy}, statistics_{}, last_forward_time_{}, last_forwarded_hash_{}, deferred_update_{}
+{
+}
+
+EventForwardingLimiter::Decision EventForwardingLimiter::OnUpdate(const std::optional<std::uint64_t> sample_hash,
+                                                                  const Clock::time_point now) noexcept
+{
+    const bool is_changed = (!policy_.on_change_only) || (!sample_hash.has_value()) ||
+                            (!last_forwarded_hash_.has_value()) || (sample_hash != last_forwarded_hash_);
+    const bool is_heartbeat_due = (policy_.heartbeat_interval.count() > 0) && last_forward_time_.has_value() &&
+                                  ((now - last_forward_time_.value()) >= policy_.heartbeat_interval);
+
+    if ((!is_changed) && (!is_heartbeat_due))
+    {
+        // The latest sample is the forwarded one again, so a deferred update of an intermediate sample is obsolete.
+        if (deferred_update_.has_value())
+        {
+            deferred_update_.reset();
+            statistics_.conflated++;
+        }
+        statistics_.suppressed_unchanged++;
+        return Decision::kSuppressUnchanged;
+    }
+
+    const bool is_rate_limited = (policy_.min_forwarding_interval.count() > 0) && last_forward_time_.has_value() &&
+                                 ((now - last_forward_time_.value()) < policy_.min_forwarding_interval);
+    if (is_rate_limited)
+    {
+        if (deferred_update_.has_value())
+        {
+            statistics_.conflated++;
+        }
+        deferred_update_ = DeferredUpdate{sample_hash, !is_changed};
+        return Decision::kDefer;
+    }
+
+    // A deferred update is superseded by this one.
+    if (deferred_update_.has_value())
+    {
+        deferred_update_.reset();
+        statistics_.conflated++;
+    }
+    RecordForward(sample_hash, !is_changed, now);
+    return Decision::kForward;
+}
+
+bool EventForwardingLimiter::OnTimer(const Clock::time_point now) noexcept
+{
+    if (!deferred_update_.has_value())
+    {
+        return false;
+    }
+    if (last_forward_time_.has_value() && ((now - last_forward_time_.value()) < policy_.min_forwarding_interval))
+    {
+        return false;
+    }
+    const auto deferred_update = deferred_update_.value();
+    deferred_update_.reset();
+    RecordForward(deferred_update.sample_hash, deferred_update.is_heartbeat, now);
+    return true;
+}
+
+std::uint64_t EventForwardingLimiter::HashSample(const score::cpp::span<const std::byte> sample) noexcept
+{
+    std::uint64_t hash{kFnvOffsetBasis};
+    for (const auto value : sample)
+    {
+        hash ^= std::to_integer<std::uint64_t>(value);
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+void EventForwardingLimiter::RecordForward(const std::optional<std::uint64_t> sample_hash,
+                                           const bool is_heartbeat,
+                                           const Clock::time_point now) noexcept
+{
+    last_forward_time_ = now;
+    last_forwarded_hash_ = sample_hash;
+    statistics_.forwarded++;
+    if (is_heartbeat)
+    {
+        statistics_.heartbeats++;
+    }
+}
+
+}  // namespace score::mw::com::gateway
@@ -0,0 +1,107 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_EVENT_FORWARDING_LIMITER_H
+#define SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_EVENT_FORWARDING_LIMITER_H
+
+#include "score/mw/com/gateway/gateway_application/configuration/gateway_configuration.h"
+
+#include <score/span.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace score::mw::com::gateway
+{
+
+/// \brief Decides, which update notifications of a single event get forwarded to the destination gateway, according
+/// to the EventForwardingPolicy of the event.
+/// \details Not thread-safe. The current time is passed in by the caller, so that the decisions are deterministic.
+class EventForwardingLimiter
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Decision : std::uint8_t
+    {
+        /// \brief The update shall be forwarded now.
+        kForward,
+        /// \brief The sample of the update is equal to the last forwarded one, so the update is dropped.
+        kSuppressUnchanged,
+        /// \brief The update exceeds the maximum forwarding rate. It is forwarded by a later OnTimer() call, unless a
+        /// newer update supersedes it.
+        kDefer,
+    };
+
+    struct Statistics
+    {
+        /// \brief Forwarded updates including heartbeats and deferred updates.
+        std::uint64_t forwarded{0U};
+        /// \brief Updates dropped, as their sample was equal to the last forwarded one.
+        std::uint64_t suppressed_unchanged{0U};
+        /// \brief Deferred updates, which got superseded by a newer update before being forwarded.
+        std::uint64_t conflated{0U};
+        /// \brief Updates forwarded despite an unchanged sample, as the heartbeat interval had expired.
+        std::uint64_t heartbeats{0U};
+    };
+
+    explicit EventForwardingLimiter(const EventForwardingPolicy& policy) noexcept;
+
+    /// \brief Called for each update of the event.
+    /// \param sample_hash Hash of the new sample. Only needed, if the policy forwards on change only. Without a hash,
+    /// the sample is treated as changed.
+    /// \param now Time of the update.
+    Decision OnUpdate(std::optional<std::uint64_t> sample_hash, Clock::time_point now) noexcept;
+
+    /// \brief Called periodically to forward a deferred update, once the minimum forwarding interval has expired.
+    /// \return true, if a deferred update shall be forwarded now.
+    bool OnTimer(Clock::time_point now) noexcept;
+
+    bool HasDeferredUpdate() const noexcept
+    {
+        return deferred_update_.has_value();
+    }
+
+    const EventForwardingPolicy& GetPolicy() const noexcept
+    {
+        return policy_;
+    }
+
+    const Statistics& GetStatistics() const noexcept
+    {
+        return statistics_;
+    }
+
+    /// \brief Cheap, non-cryptographic hash (FNV-1a) of the bytes of a sample.
+    static std::uint64_t HashSample(score::cpp::span<const std::byte> sample) noexcept;
+
+  private:
+    struct DeferredUpdate
+    {
+        std::optional<std::uint64_t> sample_hash;
+        bool is_heartbeat;
+    };
+
+    void RecordForward(std::optional<std::uint64_t> sample_hash, bool is_heartbeat, Clock::time_point now) noexcept;
+
+    EventForwardingPolicy policy_;
+    Statistics statistics_;
+    std::optional<Clock::time_point> last_forward_time_;
+    std::optional<std::uint64_t> last_forwarded_hash_;
+    std::optional<DeferredUpdate> deferred_update_;
+};
+
+}  // namespace score::mw::com::gateway
+
+#endif  // SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_EVENT_FORWARDING_LIMITER_H
@@ -0,0 +1,254 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/gateway_application/event_forwarding_limiter.h"
+
+#include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
+#include "score/mw/com/gateway/transport_layer/sample/messages/transport_message.h"
+#include "score/mw/com/impl/instance_specifier.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace score::mw::com::gateway
+{
+namespace
+{
+
+using Decision = EventForwardingLimiter::Decision;
+using namespace std::chrono_literals;
+
+const EventForwardingLimiter::Clock::time_point kStart{};
+
+EventForwardingPolicy MakePolicy(const bool on_change_only,
+                                 const std::chrono::milliseconds min_forwarding_interval,
+                                 const std::chrono::milliseconds heartbeat_interval)
+{
+    EventForwardingPolicy policy{};
+    policy.on_change_only = on_change_only;
+    policy.min_forwarding_interval = min_forwarding_interval;
+    policy.heartbeat_interval = heartbeat_interval;
+    return policy;
+}
+
+/// \brief Size of an UpdateNotification of the sample transport on the link including its message header.
+std::size_t GetUpdateNotificationWireSize()
+{
+    UpdateNotification notification{impl::InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value(),
+                                    impl::ServiceElementType::EVENT,
+                                    "tire_pressure"};
+    std::array<std::uint8_t, 256U> buffer{};
+    return MessageHeader::kWireSize + notification.Serialize(buffer);
+}
+
+TEST(EventForwardingLimiterTest, DefaultPolicyForwardsEveryUpdate)
+{
+    // Given a limiter with the default policy
+    EventForwardingLimiter unit{EventForwardingPolicy{}};
+
+    // When receiving the same sample several times in a row
+    for (std::uint32_t i = 0U; i < 10U; ++i)
+    {
+        // Then each update is forwarded
+        EXPECT_EQ(unit.OnUpdate(42U, kStart + std::chrono::microseconds{i}), Decision::kForward);
+    }
+    EXPECT_EQ(unit.GetStatistics().forwarded, 10U);
+    EXPECT_EQ(unit.GetStatistics().suppressed_unchanged, 0U);
+}
+
+TEST(EventForwardingLimiterTest, OnChangeOnlySuppressesUnchangedSamples)
+{
+    // Given a limiter, which forwards on change only
+    EventForwardingLimiter unit{MakePolicy(true, 0ms, 0ms)};
+
+    // When receiving a sample, the same sample again and then a changed one
+    // Then only the first and the changed sample are forwarded
+    EXPECT_EQ(unit.OnUpdate(1U, kStart), Decision::kForward);
+    EXPECT_EQ(unit.OnUpdate(1U, kStart + 1ms), Decision::kSuppressUnchanged);
+    EXPECT_EQ(unit.OnUpdate(2U, kStart + 2ms), Decision::kForward);
+
+    // and the suppressed update is counted
+    EXPECT_EQ(unit.GetStatistics().forwarded, 2U);
+    EXPECT_EQ(unit.GetStatistics().suppressed_unchanged, 1U);
+}
+
+TEST(EventForwardingLimiterTest, UpdateWithoutHashIsTreatedAsChanged)
+{
+    // Given a limiter, which forwards on change only and has forwarded a sample
+    EventForwardingLimiter unit{MakePolicy(true, 0ms, 0ms)};
+    EXPECT_EQ(unit.OnUpdate(1U, kStart), Decision::kForward);
+
+    // When receiving an update, whose sample couldn't be hashed
+    // Then it is forwarded
+    EXPECT_EQ(unit.OnUpdate(std::nullopt, kStart + 1ms), Decision::kForward);
+}
+
+TEST(EventForwardingLimiterTest, HeartbeatForwardsUnchangedSample)
+{
+    // Given a limiter, which forwards on change only with a heartbeat interval of 100ms
+    EventForwardingLimiter unit{MakePolicy(true, 0ms, 100ms)};
+    EXPECT_EQ(unit.OnUpdate(1U, kStart), Decision::kForward);
+
+    // When receiving the unchanged sample before and after the heartbeat interval expired
+    // Then only the one after the expiry is forwarded
+    EXPECT_EQ(unit.OnUpdate(1U, kStart + 99ms), Decision::kSuppressUnchanged);
+    EXPECT_EQ(unit.OnUpdate(1U, kStart + 100ms), Decision::kForward);
+    EXPECT_EQ(unit.OnUpdate(1U, kStart + 101ms), Decision::kSuppressUnchanged);
+
+    // and it is counted as heartbeat
+    EXPECT_EQ(unit.GetStatistics().heartbeats, 1U);
+    EXPECT_EQ(unit.GetStatistics().forwarded, 2U);
+}
+
+TEST(EventForwardingLimiterTest, RateLimitDefersAndConflatesUpdates)
+{
+    // Given a limiter with a minimum forwarding interval of 100ms, which has just forwarded an update
+    EventForwardingLimiter unit{MakePolicy(false, 100ms, 0ms)};
+    EXPECT_EQ(unit.OnUpdate(std::nullopt, kStart), Decision::kForward);
+
+    // When receiving three further updates within the interval
+    // Then they are deferred
+    EXPECT_EQ(unit.OnUpdate(std::nullopt, kStart + 10ms), Decision::kDefer);
+    EXPECT_EQ(unit.OnUpdate(std::nullopt, kStart + 20ms), Decision::kDefer);
+    EXPECT_EQ(unit.OnUpdate(std::nullopt, kStart + 30ms), Decision::kDefer);
+
+    // and nothing is forwarded by the timer, before the interval expired
+    EXPECT_FALSE(unit.OnTimer(kStart + 99ms));
+
+    // and a single update is forwarded by the timer after the expiry
+    EXPECT_TRUE(unit.OnTimer(kStart + 100ms));
+    EXPECT_FALSE(unit.OnTimer(kStart + 300ms));
+    EXPECT_FALSE(unit.HasDeferredUpdate());
+
+    // and the two superseded updates are counted as conflated
+    EXPECT_EQ(unit.GetStatistics().forwarded, 2U);
+    EXPECT_EQ(unit.GetStatistics().conflated, 2U);
+}
+
+TEST(EventForwardingLimiterTest, DeferredUpdateIsDroppedIfSampleReturnsToForwardedValue)
+{
+    // Given a limiter, which forwards on change only with a rate limit, and has a deferred changed sample
+    EventForwardingLimiter unit{MakePolicy(true, 100ms, 0ms)};
+    EXPECT_EQ(unit.OnUpdate(1U, kStart), Decision::kForward);
+    EXPECT_EQ(unit.OnUpdate(2U, kStart + 10ms), Decision::kDefer);
+
+    // When the sample changes back to the forwarded one before the interval expired
+    EXPECT_EQ(unit.OnUpdate(1U, kStart + 20ms), Decision::kSuppressUnchanged);
+
+    // Then the deferred update isn't forwarded anymore
+    EXPECT_FALSE(unit.HasDeferredUpdate());
+    EXPECT_FALSE(unit.OnTimer(kStart + 100ms));
+    EXPECT_EQ(unit.GetStatistics().conflated, 1U);
+}
+
+TEST(EventForwardingLimiterTest, HashDiffersForDifferentSamples)
+{
+    const std::array<std::byte, 4U> sample_a{std::byte{1U}, std::byte{2U}, std::byte{3U}, std::byte{4U}};
+    const std::array<std::byte, 4U> sample_b{std::byte{1U}, std::byte{2U}, std::byte{3U}, std::byte{5U}};
+
+    EXPECT_EQ(EventForwardingLimiter::HashSample(sample_a), EventForwardingLimiter::HashSample(sample_a));
+    EXPECT_NE(EventForwardingLimiter::HashSample(sample_a), EventForwardingLimiter::HashSample(sample_b));
+}
+
+TEST(EventForwardingLimiterTest, PolicyReducesLinkBytesOfHighRateEvent)
+{
+    RecordProperty("Description",
+                   "Measures the bytes sent on the link of the sample transport for a 1kHz event, whose value changes "
+                   "every 200ms, with and without an event forwarding policy.");
+
+    // Given a 1kHz event, whose value changes every 200ms, received for 10s
+    constexpr std::uint32_t kUpdates{10000U};
+    constexpr std::uint32_t kUpdatesPerValue{200U};
+    const auto notification_size = GetUpdateNotificationWireSize();
+
+    // and a limiter with the default policy and one with a policy forwarding changes at 10Hz at most with a heartbeat
+    EventForwardingLimiter unlimited{EventForwardingPolicy{}};
+    EventForwardingLimiter limited{MakePolicy(true, 100ms, 1000ms)};
+
+    // When feeding all updates into both limiters and triggering the timer every millisecond
+    std::size_t unlimited_link_bytes{0U};
+    std::size_t limited_link_bytes{0U};
+    for (std::uint32_t update = 0U; update < kUpdates; ++update)
+    {
+        const auto now = kStart + std::chrono::milliseconds{update};
+        const std::array<std::uint32_t, 4U> sample{update / kUpdatesPerValue, 1U, 2U, 3U};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) Viewing the sample as bytes, like in the gateway.
+        const score::cpp::span<const std::byte> sample_bytes{reinterpret_cast<const std::byte*>(sample.data()),
+                                                             sizeof(sample)};
+        const auto sample_hash = EventForwardingLimiter::HashSample(sample_bytes);
+
+        if (unlimited.OnUpdate(sample_hash, now) == Decision::kForward)
+        {
+            unlimited_link_bytes += notification_size;
+        }
+        if (limited.OnUpdate(sample_hash, now) == Decision::kForward)
+        {
+            limited_link_bytes += notification_size;
+        }
+        if (limited.OnTimer(now))
+        {
+            limited_link_bytes += notification_size;
+        }
+    }
+
+    RecordProperty("UnlimitedLinkBytes", std::to_string(unlimited_link_bytes));
+    RecordProperty("LimitedLinkBytes", std::to_string(limited_link_bytes));
+    RecordProperty("SuppressedUpdates", std::to_string(limited.GetStatistics().suppressed_unchanged));
+
+    // Then every update is sent without a policy
+    EXPECT_EQ(unlimited_link_bytes, kUpdates * notification_size);
+
+    // and only the 50 changes are sent with the policy
+    EXPECT_EQ(limited.GetStatistics().forwarded, kUpdates / kUpdatesPerValue);
+    EXPECT_EQ(limited_link_bytes, (kUpdates / kUpdatesPerValue) * notification_size);
+    EXPECT_EQ(limited.GetStatistics().suppressed_unchanged, kUpdates - (kUpdates / kUpdatesPerValue));
+    EXPECT_LT(limited_link_bytes * 40U, unlimited_link_bytes);
+}
+
+TEST(EventForwardingLimiterTest, RateLimitBoundsLinkBytesOfContinuouslyChangingEvent)
+{
+    // Given a 1kHz event, whose value changes with every update, received for 10s
+    constexpr std::uint32_t kUpdates{10000U};
+    const auto notification_size = GetUpdateNotificationWireSize();
+
+    // and a limiter, which forwards at 10Hz at most
+    EventForwardingLimiter limited{MakePolicy(true, 100ms, 0ms)};
+
+    // When feeding all updates into the limiter and triggering the timer every millisecond
+    std::size_t limited_link_bytes{0U};
+    for (std::uint32_t update = 0U; update < kUpdates; ++update)
+    {
+        const auto now = kStart + std::chrono::milliseconds{update};
+        if (limited.OnUpdate(std::uint64_t{update}, now) == Decision::kForward)
+        {
+            limited_link_bytes += notification_size;
+        }
+        if (limited.OnTimer(now))
+        {
+            limited_link_bytes += notification_size;
+        }
+    }
+    RecordProperty("LimitedLinkBytes", std::to_string(limited_link_bytes));
+
+    // Then a single update per 100ms is sent
+    EXPECT_EQ(limited.GetStatistics().forwarded, 100U);
+    EXPECT_EQ(limited_link_bytes, 100U * notification_size);
+}
+
+}  // namespace
+}  // namespace score::mw::com::gateway
@@ -16,14 +16,26 @@
 #include "score/language/safecpp/scoped_function/move_only_scoped_function.h"
 
 #include "score/mw/com/gateway/gateway_application/gateway_error.h"
+#include "score/memory/data_type_size_info.h"
 #include "score/mw/com/gateway/transport_layer/transport_factory.h"
+#include "score/mw/com/impl/runtime.h"
 #include "score/mw/log/logging.h"
 #include <score/assert.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <future>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace score::mw::com::gateway
@@ -35,6 +47,56 @@ namespace
 // actual data is read directly from shared memory by the consumer.
 constexpr std::size_t kGatewaySubscribeSamples = 1U;
 
+// Forwarded method calls of different methods/service instances are executed concurrently by these workers. The calls
+// of the same method are executed by at most one of them at a time (see MethodProxy).
+constexpr std::size_t kMethodCallWorkers = 4U;
+constexpr auto kMethodCallWorkerPoolName = "gateway MethodCall";
+
+// Deferred updates of rate limited events are forwarded with a delay of up to one tick after their interval expired.
+constexpr std::chrono::milliseconds kForwardingTimerTick{5};
+constexpr auto kForwardingTimerPoolName = "gateway EventFwdTimer";
+
+std::optional<memory::DataTypeSizeInfo> CreateMethodArgumentSizeInfo(const std::size_t size)
+{
+    if (size == 0U)
+    {
+        return std::nullopt;
+    }
+    // The actual types are unknown. The serialized in-arguments/return value stem from the shared memory of the
+    // calling proxy, so using the maximum alignment results in the same layout on this side.
+    return memory::DataTypeSizeInfo{size, alignof(std::max_align_t)};
+}
+
+score::Result<std::vector<std::uint8_t>> CallGenericProxyMethod(impl::GenericProxy& proxy,
+                                                                const std::string& method_name,
+                                                                const std::vector<std::uint8_t>& in_args,
+                                                                const std::size_t return_value_size)
+{
+    auto method_map = proxy.GetMethods();
+    auto method_it = method_map.find(method_name);
+    if (method_it == method_map.cend())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Method " << method_name << " not found in proxy";
+        return MakeUnexpected(GatewayErrorc::kUnknownServiceElement);
+    }
+
+    std::vector<std::uint8_t> return_value(return_value_size, 0U);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) uint8_t and std::byte have same representation
+    const score::cpp::span<const std::byte> in_args_span{reinterpret_cast<const std::byte*>(in_args.data()),
+                                                         in_args.size()};
+    const score::cpp::span<std::byte> return_value_span{reinterpret_cast<std::byte*>(return_value.data()),
+                                                        return_value.size()};
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto call_result = method_it->second.Call(in_args_span, return_value_span);
+    if (!call_result.has_value())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Call of method " << method_name
+                                   << " failed: " << call_result.error();
+        return MakeUnexpected(GatewayErrorc::kMethodCallFailed);
+    }
+    return return_value;
+}
+
 }  // namespace
 
 GatewayApplication::~GatewayApplication()
@@ -50,6 +112,10 @@ GatewayApplication::~GatewayApplication()
     {
         transport_layer_->Shutdown();
     }
+    // Join the workers of forwarded method calls, before the proxies they call get destroyed. Their results can't be
+    // sent anymore anyhow.
+    method_call_workers_.reset();
+    forwarding_timer_.reset();
     scope_.Expire();
     find_handles_.clear();
     for (auto& [specifier, skeleton] : skeletons_)
@@ -57,6 +123,7 @@ GatewayApplication::~GatewayApplication()
         skeleton.StopOfferService();
     }
     skeletons_.clear();
+    method_proxies_.clear();
     proxies_.clear();
 }
 
@@ -178,6 +245,9 @@ void GatewayApplication::OnServiceUnavailable(const std::string& specifier_str)
         }
     }
 
+    // Proxies for forwarded method calls get created again on the next call.
+    method_proxies_.erase(specifier_str);
+
     // Note: Do NOT erase the proxy. For MemorySharing gateways the proxy instance holds the
     //  service_usage_marker_file lock, which prevents SHM object unlinking while remote
     //  proxies on the destination domain may still be accessing the shared memory.
@@ -205,13 +275,21 @@ void GatewayApplication::PropagateService(const std::string& specifier_str)
         elements.push_back(impl::EventInfo{it->first, impl::DataTypeMetaInfo{sample_size, 0U}});
     }
 
-    auto provide_result = transport_layer_->ProvideService(std::move(specifier_result).value(), std::move(elements));
+    std::vector<std::string> method_names{};
+    for (const auto method_name : proxy_it->second.GetMethodNames())
+    {
+        method_names.emplace_back(method_name);
+    }
+
+    auto provide_result = transport_layer_->ProvideService(
+        std::move(specifier_result).value(), std::move(elements), std::move(method_names));
     if (!provide_result.has_value())
     {
         score::mw::log::LogError() << "GatewayApplication: ProvideService failed for " << specifier_str
                                    << ", will retry on next discovery";
         // Next time the service instance gets found again, proxy will get recreated and PropagateService
         // will be retried.
+        method_proxies_.erase(specifier_str);
         proxies_.erase(specifier_str);
         return;
     }
@@ -249,6 +327,121 @@ void GatewayApplication::RegisterEventReceiveHandlerCallback(impl::GenericSkelet
     }
 }
 
+void GatewayApplication::RegisterMethodCallForwarding(impl::GenericSkeleton& skeleton,
+                                                      const std::string& specifier_str,
+                                                      const std::vector<std::string>& method_names)
+{
+    auto method_map = skeleton.GetMethods();
+    for (const auto& method_name : method_names)
+    {
+        auto method_it = method_map.find(method_name);
+        if (method_it == method_map.cend())
+        {
+            score::mw::log::LogError() << "GatewayApplication: Method " << method_name << " not found in skeleton for "
+                                       << specifier_str;
+            continue;
+        }
+
+        auto scoped_callback = std::make_shared<MethodCallScopedCb>(
+            scope_,
+            [this, specifier = specifier_str, method = method_name](
+                std::optional<score::cpp::span<std::byte>> in_args,
+                std::optional<score::cpp::span<std::byte>> return_value) {
+                ForwardMethodCall(specifier, method, in_args, return_value);
+            });
+
+        auto result = method_it->second.RegisterHandler(
+            [scoped_callback](std::optional<score::cpp::span<std::byte>> in_args,
+                              std::optional<score::cpp::span<std::byte>> return_value) {
+                (*scoped_callback)(in_args, return_value);
+            });
+        if (!result.has_value())
+        {
+            score::mw::log::LogError() << "GatewayApplication: Failed to register forwarding handler for method "
+                                       << method_name << " of " << specifier_str;
+        }
+    }
+}
+
+void GatewayApplication::ForwardMethodCall(const std::string& specifier_str,
+                                           const std::string& method_name,
+                                           std::optional<score::cpp::span<std::byte>> in_args,
+                                           std::optional<score::cpp::span<std::byte>> return_value)
+{
+    // A method handler can't report an error to the calling proxy. If forwarding fails, the caller gets a zeroed
+    // return value instead of stale data from a previous call.
+    const score::cpp::span<std::byte> return_value_span = return_value.value_or(score::cpp::span<std::byte>{});
+    const auto zero_return_value = [&return_value_span]() {
+        std::fill(return_value_span.begin(), return_value_span.end(), std::byte{0U});
+    };
+
+    auto specifier_result = impl::InstanceSpecifier::Create(std::string{specifier_str});
+    if (!specifier_result.has_value())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Invalid instance specifier in method call: "
+                                   << specifier_str;
+        zero_return_value();
+        return;
+    }
+
+    std::vector<std::uint8_t> in_args_bytes{};
+    if (in_args.has_value())
+    {
+        in_args_bytes.reserve(in_args->size());
+        std::transform(in_args->begin(),
+                       in_args->end(),
+                       std::back_inserter(in_args_bytes),
+                       [](const std::byte value) noexcept {
+                           return std::to_integer<std::uint8_t>(value);
+                       });
+    }
+
+    // A method handler has to provide the return value, when it returns, so it blocks until the result arrives. The
+    // handler is only executed by a method call worker of the binding, if `method-call-worker-threads` is configured in
+    // the mw_com_config.json of the gateway. Otherwise it blocks the message passing thread of the binding for the
+    // whole round trip (see README.md).
+    auto call_result_promise = std::make_shared<std::promise<score::Result<std::vector<std::uint8_t>>>>();
+    auto call_result_future = call_result_promise->get_future();
+    const auto send_result = transport_layer_->CallMethod(
+        std::move(specifier_result).value(),
+        method_name,
+        std::move(in_args_bytes),
+        return_value_span.size(),
+        [call_result_promise](score::Result<std::vector<std::uint8_t>> call_result) noexcept {
+            call_result_promise->set_value(std::move(call_result));
+        });
+    if (!send_result.has_value())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Failed to forward call of method " << method_name << " of "
+                                   << specifier_str;
+        zero_return_value();
+        return;
+    }
+
+    const auto call_result = call_result_future.get();
+    if (!call_result.has_value())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Forwarded call of method " << method_name << " of "
+                                   << specifier_str << " failed: " << call_result.error();
+        zero_return_value();
+        return;
+    }
+    if (call_result->size() != return_value_span.size())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Forwarded call of method " << method_name << " of "
+                                   << specifier_str << " returned " << call_result->size() << " instead of "
+                                   << return_value_span.size() << " bytes";
+        zero_return_value();
+        return;
+    }
+    std::transform(call_result->cbegin(),
+                   call_result->cend(),
+                   return_value_span.begin(),
+                   [](const std::uint8_t value) noexcept {
+                       return std::byte{value};
+                   });
+}
+
 void GatewayApplication::OnSubscriptionStateChanged(const std::string& specifier_str,
                                                     const std::string& event_name,
                                                     bool has_subscribers)
@@ -338,7 +531,8 @@ void GatewayApplication::ReRegisterActiveEventSubscriptions(const std::string& s
 }
 
 score::Result<void> GatewayApplication::ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                                       std::vector<impl::EventInfo> service_elements)
+                                                       std::vector<impl::EventInfo> service_elements,
+                                                       std::vector<std::string> method_names)
 {
     if (!IsServiceInstanceAccepted(service_instance_specifier.ToString()))
     {
@@ -372,8 +566,27 @@ score::Result<void> GatewayApplication::ProvideService(impl::InstanceSpecifier s
         return {};
     }
 
+    // A forwarded method call blocks its thread for the whole round trip over the transport. Without method call
+    // worker threads, this would be the message passing thread of the LoLa binding, which then couldn't deliver any
+    // event notification of the gateway meanwhile.
+    if ((!method_names.empty()) &&
+        (!impl::Runtime::getInstance().GetGlobalConfiguration().GetMethodCallWorkerThreads().has_value()))
+    {
+        score::mw::log::LogError() << "GatewayApplication: Can't forward the methods of " << service_instance_specifier
+                                   << " as <method-call-worker-threads> is not set in the mw_com_config.json of the "
+                                      "gateway.";
+        return MakeUnexpected(GatewayErrorc::kMethodCallWorkersNotConfigured);
+    }
+
+    std::vector<impl::MethodInfo> methods{};
+    for (const auto& method_name : method_names)
+    {
+        methods.push_back(impl::MethodInfo{method_name});
+    }
+
     impl::GenericSkeletonServiceElementInfo skeleton_info;
     skeleton_info.events = service_elements;
+    skeleton_info.methods = methods;
     auto skeleton_result = impl::GenericSkeleton::Create(service_instance_specifier, skeleton_info);
     if (!skeleton_result.has_value())
     {
@@ -394,6 +607,10 @@ score::Result<void> GatewayApplication::ProvideService(impl::InstanceSpecifier s
         RegisterEventReceiveHandlerCallback(skeleton, service_instance_specifier_str, std::string{element.name});
     }
 
+    // Register per-method handlers, which forward each call of a local consumer/proxy to the source gateway. They have
+    // to be registered before offering, as a skeleton can only be offered with handlers for all of its methods.
+    RegisterMethodCallForwarding(skeleton, service_instance_specifier_str, method_names);
+
     auto offer_result = skeleton.OfferService();
     if (!offer_result.has_value())
     {
@@ -476,10 +693,27 @@ score::Result<void> GatewayApplication::RegisterUpdateNotification(impl::Instanc
     auto& proxy_event = event_it->second;
     proxy_event.Subscribe(kGatewaySubscribeSamples);
 
+    const auto policy = app_configuration_.GetEventForwardingPolicy(specifier_str, element_name);
+    const bool is_limited = !policy.ForwardsAllUpdates();
+    if (is_limited)
+    {
+        CreateForwardingLimiter(specifier_str, element_name, policy);
+    }
+
     using ReceiveCallback = safecpp::MoveOnlyScopedFunction<void()>;
     auto scoped_handler = std::make_shared<ReceiveCallback>(
-        scope_, [this, spec = specifier_str, elem_name = std::string(element_name), elem_type = element_type]() {
+        scope_,
+        [this,
+         spec = specifier_str,
+         elem_name = std::string(element_name),
+         elem_type = element_type,
+         is_limited,
+         on_change_only = policy.on_change_only]() {
             std::lock_guard<std::recursive_mutex> lock(mutex_);
+            if (is_limited && (!ShallForwardUpdate(spec, elem_name, on_change_only)))
+            {
+                return;
+            }
             auto specifier_result = impl::InstanceSpecifier::Create(std::string{spec});
             if (specifier_result.has_value())
             {
@@ -527,9 +761,155 @@ score::Result<void> GatewayApplication::UnregisterUpdateNotification(impl::Insta
 
     event_it->second.UnsetReceiveHandler();
     event_it->second.Unsubscribe();
+    RemoveForwardingLimiter(specifier_str, element_name);
     return {};
 }
 
+void GatewayApplication::CreateForwardingLimiter(const std::string& specifier_str,
+                                                 const std::string& event_name,
+                                                 const EventForwardingPolicy& policy)
+{
+    std::lock_guard<std::mutex> lock(forwarding_limiters_mutex_);
+    // A re-registration starts with a fresh limiter, so that the first update after it gets forwarded.
+    forwarding_limiters_[specifier_str].insert_or_assign(event_name, EventForwardingLimiter{policy});
+
+    if ((policy.min_forwarding_interval.count() > 0) && (forwarding_timer_ == nullptr))
+    {
+        forwarding_timer_ = std::make_unique<score::concurrency::ThreadPool>(1U, kForwardingTimerPoolName);
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+        // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". the function Post
+        // throws on allocation failure but this throw directly leads to a termination based on a compiler hook.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        forwarding_timer_->Post([this](const score::cpp::stop_token& stop_token) noexcept {
+            ForwardDeferredUpdates(stop_token);
+        });
+    }
+}
+
+void GatewayApplication::RemoveForwardingLimiter(const std::string& specifier_str, const std::string& event_name)
+{
+    std::lock_guard<std::mutex> lock(forwarding_limiters_mutex_);
+    const auto instance_it = forwarding_limiters_.find(specifier_str);
+    if (instance_it == forwarding_limiters_.end())
+    {
+        return;
+    }
+    const auto limiter_it = instance_it->second.find(event_name);
+    if (limiter_it == instance_it->second.end())
+    {
+        return;
+    }
+
+    const auto& statistics = limiter_it->second.GetStatistics();
+    score::mw::log::LogInfo() << "GatewayApplication: Forwarding statistics of event " << event_name << " of "
+                              << specifier_str << ": forwarded " << statistics.forwarded << ", suppressed unchanged "
+                              << statistics.suppressed_unchanged << ", conflated " << statistics.conflated
+                              << ", heartbeats " << statistics.heartbeats;
+    instance_it->second.erase(limiter_it);
+    if (instance_it->second.empty())
+    {
+        forwarding_limiters_.erase(instance_it);
+    }
+}
+
+bool GatewayApplication::ShallForwardUpdate(const std::string& specifier_str,
+                                            const std::string& event_name,
+                                            const bool on_change_only)
+{
+    // The sample is only read, if it has to be compared with the last forwarded one.
+    const auto sample_hash = on_change_only ? HashNewestSample(specifier_str, event_name) : std::nullopt;
+
+    std::lock_guard<std::mutex> lock(forwarding_limiters_mutex_);
+    const auto instance_it = forwarding_limiters_.find(specifier_str);
+    if (instance_it == forwarding_limiters_.end())
+    {
+        return true;
+    }
+    const auto limiter_it = instance_it->second.find(event_name);
+    if (limiter_it == instance_it->second.end())
+    {
+        return true;
+    }
+    return limiter_it->second.OnUpdate(sample_hash, EventForwardingLimiter::Clock::now()) ==
+           EventForwardingLimiter::Decision::kForward;
+}
+
+std::optional<std::uint64_t> GatewayApplication::HashNewestSample(const std::string& specifier_str,
+                                                                  const std::string& event_name)
+{
+    const auto proxy_it = proxies_.find(specifier_str);
+    if (proxy_it == proxies_.end())
+    {
+        return std::nullopt;
+    }
+    auto event_map = proxy_it->second.GetEvents();
+    auto event_it = event_map.find(event_name);
+    if (event_it == event_map.cend())
+    {
+        return std::nullopt;
+    }
+
+    auto& proxy_event = event_it->second;
+    const auto sample_size = proxy_event.GetSampleSize();
+    std::optional<std::uint64_t> sample_hash{};
+    // With a subscription of a single sample, each call delivers at most one sample, which has to be released before
+    // the next one can be received. So the loop ends with the hash of the newest sample.
+    while (true)
+    {
+        const auto get_samples_result = proxy_event.GetNewSamples(
+            [&sample_hash, sample_size](impl::SamplePtr<void> sample) noexcept {
+                const score::cpp::span<const std::byte> sample_bytes{static_cast<const std::byte*>(sample.get()),
+                                                                     sample_size};
+                sample_hash = EventForwardingLimiter::HashSample(sample_bytes);
+            },
+            kGatewaySubscribeSamples);
+        if ((!get_samples_result.has_value()) || (get_samples_result.value() == 0U))
+        {
+            break;
+        }
+    }
+    return sample_hash;
+}
+
+void GatewayApplication::ForwardDeferredUpdates(const score::cpp::stop_token& stop_token)
+{
+    std::vector<std::pair<std::string, std::string>> due_updates{};
+    while (!stop_token.stop_requested())
+    {
+        {
+            std::lock_guard<std::mutex> lock(forwarding_limiters_mutex_);
+            const auto now = EventForwardingLimiter::Clock::now();
+            for (auto& [specifier_str, instance_limiters] : forwarding_limiters_)
+            {
+                for (auto& [event_name, limiter] : instance_limiters)
+                {
+                    if (limiter.OnTimer(now))
+                    {
+                        due_updates.emplace_back(specifier_str, event_name);
+                    }
+                }
+            }
+        }
+
+        // Forwarded after releasing forwarding_limiters_mutex_, as mutex_ must not be locked while holding it.
+        if (!due_updates.empty())
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex_);
+            for (const auto& [specifier_str, event_name] : due_updates)
+            {
+                auto specifier_result = impl::InstanceSpecifier::Create(std::string{specifier_str});
+                if (specifier_result.has_value())
+                {
+                    transport_layer_->NotifyUpdate(
+                        std::move(specifier_result).value(), impl::ServiceElementType::EVENT, event_name);
+                }
+            }
+            due_updates.clear();
+        }
+        std::this_thread::sleep_for(kForwardingTimerTick);
+    }
+}
+
 score::Result<void> GatewayApplication::NotifyUpdate(impl::InstanceSpecifier service_instance_specifier,
                                                      impl::ServiceElementType updated_element_type,
                                                      std::string updated_element_name)
@@ -559,4 +939,115 @@ score::Result<void> GatewayApplication::NotifyUpdate(impl::InstanceSpecifier ser
     return {};
 }
 
+score::Result<void> GatewayApplication::CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                                                   std::string method_name,
+                                                   std::vector<std::uint8_t> in_args,
+                                                   std::size_t return_value_size,
+                                                   MethodCallResultHandler result_handler)
+{
+    const auto specifier_str = std::string(service_instance_specifier.ToString());
+
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    auto method_proxy_result = GetOrCreateMethodProxy(specifier_str, method_name, in_args.size(), return_value_size);
+    if (!method_proxy_result.has_value())
+    {
+        return MakeUnexpected<void>(method_proxy_result.error());
+    }
+
+    if (method_call_workers_ == nullptr)
+    {
+        method_call_workers_ =
+            std::make_unique<score::concurrency::ThreadPool>(kMethodCallWorkers, kMethodCallWorkerPoolName);
+    }
+
+    // The call is executed asynchronously, so that the transport can receive further calls in the meantime. A worker
+    // is only assigned to the method, if none is executing its calls already.
+    auto method_proxy = std::move(method_proxy_result).value();
+    bool assign_worker{false};
+    {
+        std::lock_guard<std::mutex> method_lock{method_proxy->mutex};
+        method_proxy->pending_calls.push_back(
+            PendingMethodCall{std::move(in_args), return_value_size, std::move(result_handler)});
+        if (!method_proxy->worker_assigned)
+        {
+            method_proxy->worker_assigned = true;
+            assign_worker = true;
+        }
+    }
+    if (assign_worker)
+    {
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+        // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". the function Post
+        // throws on allocation failure but this throw directly leads to a termination based on a compiler hook.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        method_call_workers_->Post([method_proxy](const score::cpp::stop_token& stop_token) noexcept {
+            ExecutePendingMethodCalls(*method_proxy, stop_token);
+        });
+    }
+    return {};
+}
+
+void GatewayApplication::ExecutePendingMethodCalls(MethodProxy& method_proxy,
+                                                   const score::cpp::stop_token& stop_token) noexcept
+{
+    while (!stop_token.stop_requested())
+    {
+        std::optional<PendingMethodCall> call{};
+        {
+            std::lock_guard<std::mutex> method_lock{method_proxy.mutex};
+            if (method_proxy.pending_calls.empty())
+            {
+                method_proxy.worker_assigned = false;
+                return;
+            }
+            call.emplace(std::move(method_proxy.pending_calls.front()));
+            method_proxy.pending_calls.pop_front();
+        }
+        call->result_handler(CallGenericProxyMethod(
+            method_proxy.proxy, method_proxy.method_name, call->in_args, call->return_value_size));
+    }
+}
+
+score::Result<std::shared_ptr<GatewayApplication::MethodProxy>> GatewayApplication::GetOrCreateMethodProxy(
+    const std::string& specifier_str,
+    const std::string& method_name,
+    const std::size_t in_args_size,
+    const std::size_t return_value_size)
+{
+    const auto instance_method_proxies_it = method_proxies_.find(specifier_str);
+    if (instance_method_proxies_it != method_proxies_.cend())
+    {
+        const auto existing_it = instance_method_proxies_it->second.find(method_name);
+        if (existing_it != instance_method_proxies_it->second.cend())
+        {
+            return existing_it->second;
+        }
+    }
+
+    const auto proxy_it = proxies_.find(specifier_str);
+    if (proxy_it == proxies_.cend())
+    {
+        score::mw::log::LogError() << "GatewayApplication: No proxy found for method call of " << specifier_str;
+        return MakeUnexpected(GatewayErrorc::kUnknownServiceInstance);
+    }
+
+    const std::array<impl::GenericProxyMethodInfo, 1U> method_infos{
+        impl::GenericProxyMethodInfo{method_name,
+                                     CreateMethodArgumentSizeInfo(in_args_size),
+                                     CreateMethodArgumentSizeInfo(return_value_size)}};
+    auto generic_proxy_result = impl::GenericProxy::Create(proxy_it->second.GetHandle(), method_infos);
+    if (!generic_proxy_result.has_value())
+    {
+        score::mw::log::LogError() << "GatewayApplication: Failed to create proxy for method " << method_name << " of "
+                                   << specifier_str;
+        return MakeUnexpected(GatewayErrorc::kMethodProxyCreationFailed);
+    }
+
+    auto method_proxy = std::make_shared<MethodProxy>(std::move(generic_proxy_result).value(), method_name);
+    method_proxies_[specifier_str].emplace(method_name, method_proxy);
+    score::mw::log::LogInfo() << "GatewayApplication: Created proxy for method " << method_name << " of "
+                              << specifier_str;
+    return method_proxy;
+}
+
 }  // namespace score::mw::com::gateway
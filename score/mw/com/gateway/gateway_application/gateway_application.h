@@ -13,17 +13,25 @@
 #ifndef SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_GATEWAY_APPLICATION_H
 #define SCORE_MW_COM_GATEWAY_GATEWAY_APPLICATION_GATEWAY_APPLICATION_H
 
+#include "score/concurrency/thread_pool.h"
 #include "score/language/safecpp/scoped_function/move_only_scoped_function.h"
 #include "score/language/safecpp/scoped_function/scope.h"
 #include "score/mw/com/gateway/gateway_application/configuration/gateway_configuration.h"
+#include "score/mw/com/gateway/gateway_application/event_forwarding_limiter.h"
 #include "score/mw/com/gateway/gateway_application/gateway_core.h"
 #include "score/mw/com/gateway/transport_layer/transport.h"
 #include "score/mw/com/impl/generic_proxy.h"
 #include "score/mw/com/impl/generic_skeleton.h"
 #include "score/mw/com/impl/instance_specifier.h"
 
+#include <score/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -53,7 +61,8 @@ class GatewayApplication : public GatewayCore
     score::Result<void> Start();
 
     score::Result<void> ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                       std::vector<impl::EventInfo> service_elements) override;
+                                       std::vector<impl::EventInfo> service_elements,
+                                       std::vector<std::string> method_names) override;
     void StopOfferService(impl::InstanceSpecifier service_instance_specifier) override;
     score::Result<void> OfferService(impl::InstanceSpecifier service_instance_specifier) override;
     score::Result<void> RegisterUpdateNotification(impl::InstanceSpecifier service_instance_specifier,
@@ -65,10 +74,51 @@ class GatewayApplication : public GatewayCore
     score::Result<void> NotifyUpdate(impl::InstanceSpecifier service_instance_specifier,
                                      impl::ServiceElementType updated_element_type,
                                      std::string updated_element_name) override;
+    score::Result<void> CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                                   std::string method_name,
+                                   std::vector<std::uint8_t> in_args,
+                                   std::size_t return_value_size,
+                                   MethodCallResultHandler result_handler) override;
 
   private:
     using FindCallbackScopedCb =
         safecpp::MoveOnlyScopedFunction<void(impl::ServiceHandleContainer<impl::HandleType>, impl::FindServiceHandle)>;
+    using MethodCallScopedCb = safecpp::MoveOnlyScopedFunction<void(std::optional<score::cpp::span<std::byte>>,
+                                                                    std::optional<score::cpp::span<std::byte>>)>;
+
+    /// \brief Forwarded call of a method, which waits for the preceding calls of the same method.
+    struct PendingMethodCall
+    {
+        std::vector<std::uint8_t> in_args;
+        std::size_t return_value_size;
+        MethodCallResultHandler result_handler;
+    };
+
+    /// \brief GenericProxy, which calls a single method of a service instance on behalf of the destination gateway.
+    /// \details The sizes of the in-arguments and the return value of a method are not part of the configuration. So
+    /// the GenericProxy gets created on the first forwarded call of the method, which provides them.
+    /// A GenericProxyMethod has a single call-queue slot only, so the calls of a method are executed one after another
+    /// by at most one method call worker. Further calls wait in pending_calls without occupying a worker, so that a
+    /// flood of calls to one method doesn't delay the calls of other methods.
+    struct MethodProxy
+    {
+        MethodProxy(impl::GenericProxy generic_proxy, std::string name)
+            : proxy{std::move(generic_proxy)},
+              method_name{std::move(name)},
+              mutex{},
+              pending_calls{},
+              worker_assigned{false}
+        {
+        }
+
+        impl::GenericProxy proxy;
+        std::string method_name;
+        /// \brief Guards pending_calls and worker_assigned.
+        std::mutex mutex;
+        std::deque<PendingMethodCall> pending_calls;
+        /// \brief Whether a method call worker currently executes the pending calls of the method.
+        bool worker_assigned;
+    };
 
     GatewayConfiguration app_configuration_;
     std::unique_ptr<Transport> transport_layer_;
@@ -78,6 +128,18 @@ class GatewayApplication : public GatewayCore
     std::unordered_map<std::string, impl::GenericSkeleton> skeletons_;
     std::vector<impl::FindServiceHandle> find_handles_;
     std::unordered_map<std::string, std::unordered_set<std::string>> active_event_subscriptions_;
+    /// \brief Proxies for forwarded method calls: key = instance specifier, inner key = method name.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::shared_ptr<MethodProxy>>> method_proxies_;
+    /// \brief Workers executing forwarded method calls. Created on the first call, so that gateways without method
+    /// forwarding don't spawn any threads.
+    std::unique_ptr<score::concurrency::ThreadPool> method_call_workers_;
+    /// \brief Limiters of forwarded events with an EventForwardingPolicy: key = instance specifier, inner key = event
+    /// name. The mutex may be locked while holding mutex_, but mutex_ must not be locked while holding it.
+    std::mutex forwarding_limiters_mutex_;
+    std::unordered_map<std::string, std::unordered_map<std::string, EventForwardingLimiter>> forwarding_limiters_;
+    /// \brief Runs the timer forwarding deferred updates of rate limited events. Created on the first rate limited
+    /// event, so that gateways without rate limits don't spawn any threads.
+    std::unique_ptr<score::concurrency::ThreadPool> forwarding_timer_;
 
     /// \brief Starts asynchronous service discovery for all forwarded services.
     /// \details Uses StartFindService to continuously monitor for services.
@@ -101,6 +163,30 @@ class GatewayApplication : public GatewayCore
                                     bool has_subscribers);
     void ReRegisterActiveEventSubscriptions(const std::string& specifier_str);
 
+    void RegisterMethodCallForwarding(impl::GenericSkeleton& skeleton,
+                                      const std::string& specifier_str,
+                                      const std::vector<std::string>& method_names);
+    void ForwardMethodCall(const std::string& specifier_str,
+                           const std::string& method_name,
+                           std::optional<score::cpp::span<std::byte>> in_args,
+                           std::optional<score::cpp::span<std::byte>> return_value);
+    /// \brief Executes the pending calls of the method one after another, until none is left or stop is requested.
+    static void ExecutePendingMethodCalls(MethodProxy& method_proxy, const score::cpp::stop_token& stop_token) noexcept;
+    score::Result<std::shared_ptr<MethodProxy>> GetOrCreateMethodProxy(const std::string& specifier_str,
+                                                                       const std::string& method_name,
+                                                                       std::size_t in_args_size,
+                                                                       std::size_t return_value_size);
+
+    void CreateForwardingLimiter(const std::string& specifier_str,
+                                 const std::string& event_name,
+                                 const EventForwardingPolicy& policy);
+    void RemoveForwardingLimiter(const std::string& specifier_str, const std::string& event_name);
+    /// \brief Decides according to the EventForwardingPolicy of the event, whether an update gets forwarded now.
+    bool ShallForwardUpdate(const std::string& specifier_str, const std::string& event_name, bool on_change_only);
+    /// \brief Reads the newest sample of the event from the proxy and returns its hash.
+    std::optional<std::uint64_t> HashNewestSample(const std::string& specifier_str, const std::string& event_name);
+    void ForwardDeferredUpdates(const score::cpp::stop_token& stop_token);
+
     // Test-only: grant unit-test fixtures access to private members and methods.
     friend class GatewayApplicationSubscriptionTest;
     friend class GatewayApplicationRegisterCallbackTest;
@@ -17,6 +17,7 @@
 #include "score/mw/com/gateway/transport_layer/transport_mock.h"
 #include "score/mw/com/impl/bindings/mock_binding/generic_skeleton_event.h"
 #include "score/mw/com/impl/bindings/mock_binding/skeleton.h"
+#include "score/mw/com/impl/configuration/global_configuration.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
 #include "score/mw/com/impl/find_service_handle.h"
 #include "score/mw/com/impl/find_service_handler.h"
@@ -39,6 +40,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
@@ -103,7 +105,7 @@ TEST(GatewayApplicationProvideServiceTest, NonWhitelistedServiceReturnsError)
     GatewayApplication app{MakeConfig({"svc/a"}, {"svc/b"})};
 
     // When ProvideService is called with a specifier that is not on the whitelist
-    const auto result = app.ProvideService(MakeSpecifier("svc/not_whitelisted"), {});
+    const auto result = app.ProvideService(MakeSpecifier("svc/not_whitelisted"), {}, {});
 
     // Then the call must fail with kNonWhitelistedService
     ASSERT_FALSE(result.has_value());
@@ -179,6 +181,28 @@ TEST(GatewayApplicationNotifyUpdateTest, NoSkeletonReturnsUnknownServiceInstance
     EXPECT_EQ(result.error(), GatewayErrorc::kUnknownServiceInstance);
 }
 
+// CallMethod tests
+TEST(GatewayApplicationCallMethodTest, NoProxyReturnsUnknownServiceInstanceWithoutCallingResultHandler)
+{
+    // Given a GatewayApplication with no proxy registered for the specifier
+    GatewayApplication app{MakeConfig({"svc/a"}, {})};
+
+    // When CallMethod is called for that specifier
+    bool handler_called{false};
+    const auto result = app.CallMethod(MakeSpecifier("svc/a"),
+                                       "MethodA",
+                                       {},
+                                       0U,
+                                       [&handler_called](score::Result<std::vector<std::uint8_t>>) noexcept {
+                                           handler_called = true;
+                                       });
+
+    // Then the call must fail with kUnknownServiceInstance and the result handler is not called
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), GatewayErrorc::kUnknownServiceInstance);
+    EXPECT_FALSE(handler_called);
+}
+
 // Setup / Start tests
 TEST(GatewayApplicationSetupTest, SetupDelegatesToTransport)
 {
@@ -625,6 +649,8 @@ class GatewayApplicationFlowTest : public ::testing::Test
         // --- Runtime / service discovery wiring -------------------------------------------------
         ON_CALL(runtime_mock_guard_.runtime_mock_, GetServiceDiscovery())
             .WillByDefault(::testing::ReturnRef(service_discovery_mock_));
+        ON_CALL(runtime_mock_guard_.runtime_mock_, GetGlobalConfiguration())
+            .WillByDefault(::testing::ReturnRef(global_configuration_));
         ON_CALL(runtime_mock_guard_.runtime_mock_, GetBindingRuntime(impl::BindingType::kLoLa))
             .WillByDefault(::testing::Return(&binding_runtime_mock_));
         ON_CALL(binding_runtime_mock_, GetBindingType()).WillByDefault(::testing::Return(impl::BindingType::kLoLa));
@@ -715,7 +741,7 @@ class GatewayApplicationFlowTest : public ::testing::Test
         // --- Transport ---------------------------------------------------------------------------
         auto transport_owned = std::make_unique<::testing::NiceMock<TransportMock>>();
         transport_mock_ = transport_owned.get();
-        ON_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_))
+        ON_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_))
             .WillByDefault(::testing::Return(score::Result<void>{}));
         ON_CALL(*transport_mock_, StopOfferService(::testing::_))
             .WillByDefault(::testing::Return(score::Result<void>{}));
@@ -795,6 +821,7 @@ class GatewayApplicationFlowTest : public ::testing::Test
     std::unique_ptr<GatewayApplication> app_;
     TransportMock* transport_mock_{nullptr};
 
+    impl::GlobalConfiguration global_configuration_{};
     impl::RuntimeMockGuard runtime_mock_guard_{};
     ::testing::NiceMock<impl::ServiceDiscoveryMock> service_discovery_mock_{};
     ::testing::NiceMock<impl::ServiceDiscoveryClientMock> service_discovery_client_mock_{};
@@ -854,7 +881,7 @@ TEST_F(GatewayApplicationFlowTest, ServiceFoundCreatesProxyAndPropagates)
     StartAndCaptureFindHandler();
 
     // Then the gateway creates a proxy and forwards ProvideService to the transport.
-    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_))
+    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(score::Result<void>{}));
 
     impl::ServiceHandleContainer<impl::HandleType> handles{MakeProxyHandle({"EventA"})};
@@ -873,7 +900,7 @@ TEST_F(GatewayApplicationFlowTest, ServiceFoundProxyCreationFailureIsHandled)
 
     // When a service is discovered
     // Then GenericProxy::Create fails, nothing is propagated, and no crash occurs.
-    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_)).Times(0);
     EXPECT_NO_FATAL_FAILURE(
         FireServiceDiscovery(impl::ServiceHandleContainer<impl::HandleType>{MakeProxyHandle({"EventA"})}));
 }
@@ -899,7 +926,7 @@ TEST_F(GatewayApplicationFlowTest, ServiceReFoundRePropagates)
 
     // When the service is found again
     // Then it is re-propagated (ProvideService called again) without creating a new proxy.
-    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_))
+    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(score::Result<void>{}));
     FireServiceDiscovery(impl::ServiceHandleContainer<impl::HandleType>{MakeProxyHandle({"EventA"})});
 }
@@ -908,7 +935,7 @@ TEST_F(GatewayApplicationFlowTest, PropagateServiceFailureErasesProxy)
 {
     // Given discovery started and the transport rejects ProvideService
     StartAndCaptureFindHandler();
-    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_))
+    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(score::MakeUnexpected(GatewayErrorc::kSkeletonCreationFailed)))
         .WillOnce(::testing::Return(score::Result<void>{}));
 
@@ -930,7 +957,7 @@ TEST_F(GatewayApplicationFlowTest, PropagateServiceInvalidSpecifierKeyReturnsEar
 
     // When PropagateService runs for the invalid key
     // Then InstanceSpecifier::Create fails, it logs and returns before touching the transport.
-    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(*transport_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_)).Times(0);
     EXPECT_NO_FATAL_FAILURE(CallPropagateService("svc/"));
 }
 
@@ -1081,7 +1108,7 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceCreatesSkeletonRegistersCallbac
     EXPECT_CALL(service_discovery_mock_, OfferService(::testing::_)).WillOnce(::testing::Return(score::Result<void>{}));
 
     // When ProvideService is called
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
 
     // Then a skeleton is created, the subscription callback is registered (verified by the EXPECT_CALL
     // above), and the service is offered (verified by the OfferService expectation above).
@@ -1090,10 +1117,27 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceCreatesSkeletonRegistersCallbac
     EXPECT_NE(skeleton_event_mocks_.find("EventA"), skeleton_event_mocks_.cend());
 }
 
+TEST_F(GatewayApplicationFlowTest, ProvideServiceWithMethodsFailsWithoutMethodCallWorkerThreads)
+{
+    // Given a gateway whose mw::com configuration doesn't set method-call-worker-threads
+    ASSERT_FALSE(global_configuration_.GetMethodCallWorkerThreads().has_value());
+
+    // Then the service must not be offered.
+    EXPECT_CALL(service_discovery_mock_, OfferService(::testing::_)).Times(0);
+
+    // When ProvideService is called for a service instance with methods
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {"MethodA"});
+
+    // Then it fails, as forwarding the method calls would block the message passing thread of the binding.
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), GatewayErrorc::kMethodCallWorkersNotConfigured);
+    EXPECT_EQ(skeleton_binding_mock_, nullptr);
+}
+
 TEST_F(GatewayApplicationFlowTest, ProvideServiceReuseExistingSkeletonReRegistersSubscriptions)
 {
     // Given a service was already provided and has an active subscription
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
     CallOnSubscriptionStateChanged("svc/a", "EventA", true);
 
     // When ProvideService is called again for the same specifier (skeleton reuse path)
@@ -1102,14 +1146,14 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceReuseExistingSkeletonReRegister
                 RegisterUpdateNotification(::testing::_, impl::ServiceElementType::EVENT, std::string{"EventA"}))
         .WillOnce(::testing::Return(score::Result<void>{}));
 
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     EXPECT_TRUE(result.has_value());
 }
 
 TEST_F(GatewayApplicationFlowTest, OfferServiceWithExistingSkeletonSucceeds)
 {
     // Given a service has been provided (skeleton exists)
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
 
     // When OfferService is called for it
     // Then the call succeeds.
@@ -1120,7 +1164,7 @@ TEST_F(GatewayApplicationFlowTest, OfferServiceWithExistingSkeletonSucceeds)
 TEST_F(GatewayApplicationFlowTest, StopOfferServiceWithExistingSkeletonStopsOffer)
 {
     // Given a service has been provided (skeleton exists)
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
 
     // When StopOfferService is called
     // Then it does not crash and keeps the skeleton for reuse.
@@ -1130,7 +1174,7 @@ TEST_F(GatewayApplicationFlowTest, StopOfferServiceWithExistingSkeletonStopsOffe
 TEST_F(GatewayApplicationFlowTest, NotifyUpdateWithExistingSkeletonNotifiesEvent)
 {
     // Given a service has been provided with "EventA"
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
     ASSERT_NE(skeleton_event_mocks_.find("EventA"), skeleton_event_mocks_.cend());
 
     // When NotifyUpdate is called for that event
@@ -1144,7 +1188,7 @@ TEST_F(GatewayApplicationFlowTest, NotifyUpdateWithExistingSkeletonNotifiesEvent
 TEST_F(GatewayApplicationFlowTest, NotifyUpdateUnknownEventReturnsError)
 {
     // Given a service provided with only "EventA"
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
 
     // When NotifyUpdate targets an unknown event
     // Then it fails with kUnknownServiceElement.
@@ -1167,7 +1211,7 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceOfferFailureErasesSkeleton)
 
     // When ProvideService is called
     // Then it fails with kSkeletonCreationFailed and the skeleton is erased.
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), GatewayErrorc::kSkeletonCreationFailed);
 }
@@ -1177,7 +1221,7 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceOfferFailureErasesSkeleton)
 TEST_F(GatewayApplicationFlowTest, ProvideServiceTearsDownSkeletonsOnDestruction)
 {
     // Given a service has been provided (skeleton exists at destruction)
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
 
     // When the application is destroyed
     // Then StopOfferService runs on the held skeleton without crashing (destructor loop coverage).
@@ -1194,7 +1238,7 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceSkeletonCreationFailureReturnsE
 
     // When ProvideService is called
     // Then GenericSkeleton::Create fails and ProvideService reports kSkeletonCreationFailed.
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     ASSERT_FALSE(result.has_value());
     EXPECT_EQ(result.error(), GatewayErrorc::kSkeletonCreationFailed);
 }
@@ -1217,14 +1261,14 @@ TEST_F(GatewayApplicationFlowTest, ProvideServiceSetReceiveHandlerRegistrationFa
 
     // When ProvideService is called
     // Then the registration failure is only logged and ProvideService still succeeds.
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     EXPECT_TRUE(result.has_value());
 }
 
 TEST_F(GatewayApplicationFlowTest, OfferServiceFailureReturnsError)
 {
     // Given a service has been provided (skeleton exists and offered once)
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
     ASSERT_NE(skeleton_binding_mock_, nullptr);
 
     // and the binding will now reject any further offer
@@ -1241,7 +1285,7 @@ TEST_F(GatewayApplicationFlowTest, OfferServiceFailureReturnsError)
 TEST_F(GatewayApplicationFlowTest, ReusedSkeletonOfferFailureIsToleratedAndResubscribes)
 {
     // Given a service was provided with an active subscription
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
     CallOnSubscriptionStateChanged("svc/a", "EventA", true);
     ASSERT_NE(skeleton_binding_mock_, nullptr);
 
@@ -1255,14 +1299,14 @@ TEST_F(GatewayApplicationFlowTest, ReusedSkeletonOfferFailureIsToleratedAndResub
                 RegisterUpdateNotification(::testing::_, impl::ServiceElementType::EVENT, std::string{"EventA"}))
         .WillOnce(::testing::Return(score::Result<void>{}));
 
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     EXPECT_TRUE(result.has_value());
 }
 
 TEST_F(GatewayApplicationFlowTest, ReusedSkeletonReRegisterFailureIsTolerated)
 {
     // Given a service was provided with an active subscription
-    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"})).has_value());
+    ASSERT_TRUE(app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {}).has_value());
     CallOnSubscriptionStateChanged("svc/a", "EventA", true);
 
     // and re-registering the active subscription via the transport fails
@@ -1272,7 +1316,7 @@ TEST_F(GatewayApplicationFlowTest, ReusedSkeletonReRegisterFailureIsTolerated)
 
     // When ProvideService is called again (skeleton reuse path)
     // Then the re-registration failure is only logged and ProvideService still succeeds.
-    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}));
+    const auto result = app_->ProvideService(MakeSpecifier("svc/a"), MakeElements({"EventA"}), {});
     EXPECT_TRUE(result.has_value());
 }
 
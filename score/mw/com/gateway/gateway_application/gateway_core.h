@@ -18,6 +18,8 @@
 #include "score/mw/com/impl/service_element_type.h"
 #include "score/result/result.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -38,9 +40,12 @@ class GatewayCore
     /// this specifier is configured/existent in the mw_com_config.json at the local gateway side.
     /// \param service_elements description of the service elements (events, fields, methods) which should be provided
     /// for the service instance, which will be realized as a Forwarding Skeleton (GenericSkeleton).
+    /// \param method_names names of the methods of the service instance. Calls of these methods at the Forwarding
+    /// Skeleton are forwarded to the source gateway via Transport::CallMethod().
     /// \return result indicating success or failure.
     virtual score::Result<void> ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                               std::vector<impl::EventInfo> service_elements) = 0;
+                                               std::vector<impl::EventInfo> service_elements,
+                                               std::vector<std::string> method_names) = 0;
 
     /// \brief Stop providing the given service instance locally within the destination domain.
     /// \param service_instance_specifier instance specifier of the service instance to stop offering. It is expected,
@@ -88,6 +93,24 @@ class GatewayCore
     virtual score::Result<void> NotifyUpdate(impl::InstanceSpecifier service_instance_specifier,
                                              impl::ServiceElementType updated_element_type,
                                              std::string updated_element_name) = 0;
+
+    /// \brief Call a method of the given service instance locally within the source domain.
+    /// \details This API is expected to be called by the transport layer implementation, when the transport layer
+    /// receives a method call forwarded by the destination gateway. The call is executed asynchronously, i.e. the API
+    /// returns without waiting for the result of the call. The result_handler is called exactly once with the
+    /// serialized return value or the error, if the call failed.
+    /// \param service_instance_specifier instance specifier of the service instance owning the method. It is expected,
+    /// that this specifier is configured/existent in the mw_com_config.json at the local gateway side.
+    /// \param method_name name of the method to call.
+    /// \param in_args serialized in-arguments of the call.
+    /// \param return_value_size size of the return value in bytes. 0, if the method returns void.
+    /// \param result_handler handler, which receives the serialized return value or the error.
+    /// \return result indicating whether the call has been scheduled. If not, result_handler won't be called.
+    virtual score::Result<void> CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                                           std::string method_name,
+                                           std::vector<std::uint8_t> in_args,
+                                           std::size_t return_value_size,
+                                           MethodCallResultHandler result_handler) = 0;
 };
 
 }  // namespace score::mw::com::gateway
@@ -26,7 +26,7 @@ class GatewayCoreMock : public GatewayCore
   public:
     MOCK_METHOD((score::Result<void>),
                 ProvideService,
-                (impl::InstanceSpecifier, std::vector<impl::EventInfo>),
+                (impl::InstanceSpecifier, std::vector<impl::EventInfo>, std::vector<std::string>),
                 (override));
     MOCK_METHOD((score::Result<void>), OfferService, (impl::InstanceSpecifier), (override));
     MOCK_METHOD(void, StopOfferService, (impl::InstanceSpecifier), (override));
@@ -42,6 +42,10 @@ class GatewayCoreMock : public GatewayCore
                 UnregisterUpdateNotification,
                 (impl::InstanceSpecifier, impl::ServiceElementType, std::string),
                 (override));
+    MOCK_METHOD((score::Result<void>),
+                CallMethod,
+                (impl::InstanceSpecifier, std::string, std::vector<std::uint8_t>, std::size_t, MethodCallResultHandler),
+                (override));
 };
 
 }  // namespace score::mw::com::gateway
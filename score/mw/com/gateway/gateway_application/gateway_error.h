@@ -29,6 +29,9 @@ enum class GatewayErrorc : score::result::ErrorCode
     kUnknownServiceElement,
     kReceiveHandlerRegistrationFailed,
     kNonWhitelistedService,
+    kMethodProxyCreationFailed,
+    kMethodCallFailed,
+    kMethodCallWorkersNotConfigured,
 };
 
 score::result::Error MakeError(const GatewayErrorc code, const std::string_view message = "");
@@ -53,6 +56,13 @@ class GatewayErrorDomain final : public score::result::ErrorDomain
                        "notifications.";
             case static_cast<score::result::ErrorCode>(GatewayErrorc::kNonWhitelistedService):
                 return "Gateway received request to provide a non-whitelised service.";
+            case static_cast<score::result::ErrorCode>(GatewayErrorc::kMethodProxyCreationFailed):
+                return "Gateway couldn't create a generic proxy to forward method calls.";
+            case static_cast<score::result::ErrorCode>(GatewayErrorc::kMethodCallFailed):
+                return "Forwarded method call failed.";
+            case static_cast<score::result::ErrorCode>(GatewayErrorc::kMethodCallWorkersNotConfigured):
+                return "Gateway can't forward method calls without method-call-worker-threads in its mw::com "
+                       "configuration.";
             default:
                 return "unknown gateway error";
         }
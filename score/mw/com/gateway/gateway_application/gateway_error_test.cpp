@@ -74,6 +74,24 @@ TEST_F(GatewayErrorTest, MessageForNonWhitelistedService)
                      "Gateway received request to provide a non-whitelised service.");
 }
 
+TEST_F(GatewayErrorTest, MessageForMethodProxyCreationFailed)
+{
+    TestErrorMessage(GatewayErrorc::kMethodProxyCreationFailed,
+                     "Gateway couldn't create a generic proxy to forward method calls.");
+}
+
+TEST_F(GatewayErrorTest, MessageForMethodCallFailed)
+{
+    TestErrorMessage(GatewayErrorc::kMethodCallFailed, "Forwarded method call failed.");
+}
+
+TEST_F(GatewayErrorTest, MessageForMethodCallWorkersNotConfigured)
+{
+    TestErrorMessage(GatewayErrorc::kMethodCallWorkersNotConfigured,
+                     "Gateway can't forward method calls without method-call-worker-threads in its mw::com "
+                     "configuration.");
+}
+
 TEST_F(GatewayErrorTest, MessageForDefault)
 {
     TestErrorMessage(static_cast<GatewayErrorc>(-1), "unknown gateway error");
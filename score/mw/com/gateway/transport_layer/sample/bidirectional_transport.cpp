@@ -223,6 +223,14 @@ void BidirectionalTransport::ConnectionLoop(score::cpp::stop_token stop_token)
             break;  // Shutdown has been requested or setup failed.
         }
 
+        // Queued before any message of the new connection, so the connection handler is called after all messages of
+        // the previous connection have been dispatched.
+        {
+            std::lock_guard<std::mutex> lock(dispatch_mutex_);
+            dispatch_queue_.push(nullptr);
+        }
+        dispatch_cv_.notify_one();
+
         is_connected_ = true;
         ReceiveUntilDisconnect(stop_token);
 
@@ -360,6 +368,15 @@ void BidirectionalTransport::DispatchLoop(const score::cpp::stop_token& stop_tok
             dispatch_queue_.pop();
         }
 
+        if (message == nullptr)
+        {
+            if (!connection_handler_.empty())
+            {
+                connection_handler_();
+            }
+            continue;
+        }
+
         message_handler_(std::move(message));  // COV_JUSTIFIED gateway-dispatch-loop-calls-handler
     }
 }
@@ -464,6 +481,11 @@ void BidirectionalTransport::SetMessageHandler(MessageHandler handler)
     has_message_handler_ = true;
 }
 
+void BidirectionalTransport::SetConnectionHandler(ConnectionHandler handler)
+{
+    connection_handler_ = std::move(handler);
+}
+
 bool BidirectionalTransport::IsConnected() const
 {
     return is_connected_.load();
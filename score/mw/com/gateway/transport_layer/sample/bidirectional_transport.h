@@ -71,6 +71,10 @@ class BidirectionalTransport : public IBidirectionalTransport
     /// \param handler The callback to handle incoming messages.
     void SetMessageHandler(MessageHandler handler) override;
 
+    /// \brief Set a callback that is called by the dispatch thread, whenever a connection has been (re-)established.
+    /// Has to be set before Setup().
+    void SetConnectionHandler(ConnectionHandler handler) override;
+
   private:
     /// \brief Send the given message and wait for the ACK response with the same sequence number.
     /// Returns error if unknown sequence number, timeout ocurres or disconnect happens.
@@ -110,10 +114,12 @@ class BidirectionalTransport : public IBidirectionalTransport
 
     MessageHandler message_handler_;
     bool has_message_handler_{false};
+    ConnectionHandler connection_handler_;
 
     // Dispatch queue: incoming non-ACK messages are pushed here by the receive loop and
     // processed by a dedicated dispatch thread. This decouples the receive loop from the
     // message handler, so the handler can call SendRequest() without blocking ACK reception.
+    // A nullptr is pushed, whenever a connection has been established, to call the connection handler.
     std::queue<std::unique_ptr<TransportMessage>> dispatch_queue_;
     std::mutex dispatch_mutex_;
     std::condition_variable dispatch_cv_;
@@ -16,19 +16,42 @@
 #include "score/network/ipv4_address.h"
 
 #include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
 
 namespace score::mw::com::gateway
 {
 
+/// \brief Key, by which the messages are assigned to a lane, if they don't have an explicit lane mapping.
+enum class LaneAssignment : std::uint8_t
+{
+    /// All messages of a service instance share one lane.
+    kByService = 0U,
+    /// Each service element (event, field or method) of a service instance gets its own lane.
+    kByElement = 1U,
+};
+
 class HyperVisorSocketConfiguration
 {
   public:
+    /// \brief Key of an explicit lane mapping: instance specifier and element name. An empty element name maps the
+    ///        whole service instance.
+    using LaneMappingKey = std::pair<std::string, std::string>;
+
     HyperVisorSocketConfiguration() = default;
 
     score::os::Ipv4Address remote_ip_{};
     std::uint16_t local_port_{0};
     std::uint16_t remote_port_{0};
     std::uint32_t request_timeout_ms_{5000};
+
+    /// \brief Number of parallel connections (lanes) to the remote gateway. Lane i uses local_port_ + i and
+    ///        remote_port_ + i.
+    std::uint16_t number_of_lanes_{1};
+    LaneAssignment lane_assignment_{LaneAssignment::kByService};
+    /// \brief Explicit lanes of service instances or single elements, which take precedence over lane_assignment_.
+    std::map<LaneMappingKey, std::uint16_t> lane_mapping_{};
 };
 
 }  // namespace score::mw::com::gateway
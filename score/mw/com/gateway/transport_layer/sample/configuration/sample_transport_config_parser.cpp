@@ -18,6 +18,8 @@
 
 #include <score/assert.hpp>
 
+#include <cstdint>
+#include <string>
 #include <string_view>
 
 namespace score::mw::com::gateway
@@ -32,6 +34,70 @@ constexpr auto kRemoteIpKey = "remote-ip"sv;
 constexpr auto kLocalPortKey = "local-port"sv;
 constexpr auto kRemotePortKey = "remote-port"sv;
 constexpr auto kRequestTimeoutMsKey = "request-timeout-ms"sv;
+constexpr auto kLanesKey = "lanes"sv;
+constexpr auto kNumberOfLanesKey = "number-of-lanes"sv;
+constexpr auto kLaneAssignmentKey = "assignment"sv;
+constexpr auto kLaneAssignmentService = "service"sv;
+constexpr auto kLaneAssignmentElement = "element"sv;
+constexpr auto kLaneMappingKey = "mapping"sv;
+constexpr auto kLaneMappingInstanceSpecifierKey = "instance-specifier"sv;
+constexpr auto kLaneMappingElementKey = "element"sv;
+constexpr auto kLaneMappingLaneKey = "lane"sv;
+
+void ParseLanes(const score::json::Object& lanes_obj, HyperVisorSocketConfiguration& config) noexcept
+{
+    const auto number_of_lanes = lanes_obj.find(kNumberOfLanesKey.data());
+    if (number_of_lanes != lanes_obj.cend())
+    {
+        config.number_of_lanes_ = number_of_lanes->second.As<std::uint16_t>().value();
+    }
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(config.number_of_lanes_ > 0U,
+                                                "number-of-lanes must be at least 1 in lanes configuration.");
+    // Lane i uses local-port + i and remote-port + i, so the last lane must still get valid ports.
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+        (static_cast<std::uint32_t>(config.local_port_) + config.number_of_lanes_ - 1U <= 0xFFFFU) &&
+            (static_cast<std::uint32_t>(config.remote_port_) + config.number_of_lanes_ - 1U <= 0xFFFFU),
+        "number-of-lanes exceeds the available port range in lanes configuration.");
+
+    const auto assignment = lanes_obj.find(kLaneAssignmentKey.data());
+    if (assignment != lanes_obj.cend())
+    {
+        const std::string_view assignment_value{assignment->second.As<std::string>().value().get()};
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+            (assignment_value == kLaneAssignmentService) || (assignment_value == kLaneAssignmentElement),
+            "assignment must be either service or element in lanes configuration.");
+        config.lane_assignment_ =
+            (assignment_value == kLaneAssignmentElement) ? LaneAssignment::kByElement : LaneAssignment::kByService;
+    }
+
+    const auto mapping = lanes_obj.find(kLaneMappingKey.data());
+    if (mapping != lanes_obj.cend())
+    {
+        for (const auto& mapping_json : mapping->second.As<score::json::List>().value().get())
+        {
+            const auto& mapping_obj = mapping_json.As<score::json::Object>().value().get();
+            const auto instance_specifier = mapping_obj.find(kLaneMappingInstanceSpecifierKey.data());
+            const auto lane = mapping_obj.find(kLaneMappingLaneKey.data());
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(instance_specifier != mapping_obj.cend(),
+                                                        "instance-specifier is mandatory in a lane mapping.");
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(lane != mapping_obj.cend(),
+                                                        "lane is mandatory in a lane mapping.");
+
+            const auto lane_index = lane->second.As<std::uint16_t>().value();
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(lane_index < config.number_of_lanes_,
+                                                        "lane of a lane mapping must be below number-of-lanes.");
+
+            std::string element_name{};
+            const auto element = mapping_obj.find(kLaneMappingElementKey.data());
+            if (element != mapping_obj.cend())
+            {
+                element_name = element->second.As<std::string>().value().get();
+            }
+            config.lane_mapping_[{instance_specifier->second.As<std::string>().value().get(), element_name}] =
+                lane_index;
+        }
+    }
+}
 
 }  // namespace
 
@@ -90,6 +156,12 @@ auto ParseSampleTransportConfig(score::json::Any json) noexcept -> HyperVisorSoc
         config.request_timeout_ms_ = request_timeout->second.As<std::uint32_t>().value();
     }
 
+    const auto lanes = socket_obj.find(kLanesKey.data());
+    if (lanes != socket_obj.cend())
+    {
+        ParseLanes(lanes->second.As<score::json::Object>().value().get(), config);
+    }
+
     return config;
 }
 
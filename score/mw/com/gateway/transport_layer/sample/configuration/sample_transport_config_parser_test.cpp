@@ -98,6 +98,84 @@ TEST_F(SampleTransportConfigParserFixture, ParseHvSocketDefaultRequestTimeout)
     EXPECT_EQ(5000U, config.request_timeout_ms_);
 }
 
+TEST_F(SampleTransportConfigParserFixture, ParseHvSocketDefaultsToOneLane)
+{
+    // Given a sample transport config JSON without lanes
+    auto j = R"(
+{
+  "hypervisor-socket": {
+    "remote-ip": "192.168.0.1",
+    "local-port": 8080,
+    "remote-port": 9090
+  }
+}
+)"_json;
+
+    // When the config is parsed
+    const auto config = ParseSampleTransportConfig(std::move(j));
+
+    // Then a single lane assigned by service without explicit mappings is configured
+    EXPECT_EQ(1U, config.number_of_lanes_);
+    EXPECT_EQ(LaneAssignment::kByService, config.lane_assignment_);
+    EXPECT_TRUE(config.lane_mapping_.empty());
+}
+
+TEST_F(SampleTransportConfigParserFixture, ParseHvSocketWithLanes)
+{
+    // Given a sample transport config JSON with lanes assigned by element and explicit mappings
+    auto j = R"(
+{
+  "hypervisor-socket": {
+    "remote-ip": "192.168.0.1",
+    "local-port": 8080,
+    "remote-port": 9090,
+    "lanes": {
+      "number-of-lanes": 4,
+      "assignment": "element",
+      "mapping": [
+        {"instance-specifier": "camera/front", "lane": 3},
+        {"instance-specifier": "radar/front", "element": "objects", "lane": 1}
+      ]
+    }
+  }
+}
+)"_json;
+
+    // When the config is parsed
+    const auto config = ParseSampleTransportConfig(std::move(j));
+
+    // Then the lanes are configured as given
+    EXPECT_EQ(4U, config.number_of_lanes_);
+    EXPECT_EQ(LaneAssignment::kByElement, config.lane_assignment_);
+    ASSERT_EQ(2U, config.lane_mapping_.size());
+    EXPECT_EQ(3U, config.lane_mapping_.at({"camera/front", ""}));
+    EXPECT_EQ(1U, config.lane_mapping_.at({"radar/front", "objects"}));
+}
+
+TEST_F(SampleTransportConfigParserFixture, ParseLaneMappingBeyondNumberOfLanesDies)
+{
+    // Given a sample transport config JSON mapping a service to a lane, which doesn't exist
+    auto j = R"(
+{
+  "hypervisor-socket": {
+    "remote-ip": "192.168.0.1",
+    "local-port": 8080,
+    "remote-port": 9090,
+    "lanes": {
+      "number-of-lanes": 2,
+      "mapping": [
+        {"instance-specifier": "camera/front", "lane": 2}
+      ]
+    }
+  }
+}
+)"_json;
+
+    // When the config is parsed
+    // Then the program terminates
+    EXPECT_DEATH(ParseSampleTransportConfig(std::move(j)), ".*");
+}
+
 TEST_F(SampleTransportConfigParserFixture, ParseFromInvalidPathDies)
 {
     EXPECT_DEATH(ParseSampleTransportConfig("/nonexistent/transport_config.json"), ".*");
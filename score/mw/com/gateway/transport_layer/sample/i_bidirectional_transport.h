@@ -28,6 +28,7 @@ class IBidirectionalTransport
 {
   public:
     using MessageHandler = score::cpp::callback<void(std::unique_ptr<TransportMessage>), 64>;
+    using ConnectionHandler = score::cpp::callback<void()>;
 
     virtual ~IBidirectionalTransport() = default;
 
@@ -40,6 +41,11 @@ class IBidirectionalTransport
     virtual score::ResultBlank SendNotification(TransportMessage& message) = 0;
 
     virtual void SetMessageHandler(MessageHandler handler) = 0;
+
+    /// \brief Set a callback that is called, whenever a connection has been (re-)established. It is called in order
+    /// with the incoming messages, i.e. after all messages received on the previous connection have been passed to the
+    /// message handler.
+    virtual void SetConnectionHandler(ConnectionHandler handler) = 0;
 };
 
 }  // namespace score::mw::com::gateway
@@ -0,0 +1,113 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/transport_layer/sample/lane_selector.h"
+
+#include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
+
+#include <functional>
+#include <string_view>
+
+namespace score::mw::com::gateway
+{
+
+namespace
+{
+
+/// \brief Combines the hash of the element name into the hash of the instance specifier (boost::hash_combine).
+std::size_t CombineHashes(const std::size_t seed, const std::size_t hash) noexcept
+{
+    constexpr std::size_t kGoldenRatio{0x9E3779B9U};
+    return seed ^ (hash + kGoldenRatio + (seed << 6U) + (seed >> 2U));
+}
+
+}  // namespace
+
+LaneSelector::LaneSelector(const HyperVisorSocketConfiguration& socket_config) noexcept
+    : number_of_lanes_{socket_config.number_of_lanes_},
+      lane_assignment_{socket_config.lane_assignment_},
+      lane_mapping_{socket_config.lane_mapping_}
+{
+}
+
+bool LaneSelector::IsSentOnAllLanes(const MessageType message_type) noexcept
+{
+    return (message_type == MessageType::kProvideServiceRequest) ||
+           (message_type == MessageType::kOfferServiceRequest) ||
+           (message_type == MessageType::kStopOfferServiceRequest);
+}
+
+std::size_t LaneSelector::SelectLane(const TransportMessage& message) const noexcept
+{
+    if (number_of_lanes_ <= 1U)
+    {
+        return 0U;
+    }
+
+    switch (message.GetType())
+    {
+        case MessageType::kProvideServiceRequest:
+            return SelectLane(dynamic_cast<const ProvideServiceRequest&>(message).GetInstanceSpecifier(), {});
+        case MessageType::kOfferServiceRequest:
+            return SelectLane(dynamic_cast<const OfferServiceRequest&>(message).GetInstanceSpecifier(), {});
+        case MessageType::kStopOfferServiceRequest:
+            return SelectLane(dynamic_cast<const StopOfferServiceRequest&>(message).GetInstanceSpecifier(), {});
+        case MessageType::kRegisterNotificationRequest:
+        case MessageType::kUnregisterNotificationRequest:
+        case MessageType::kUpdateNotification:
+        {
+            const auto& element_message = dynamic_cast<const ServiceElementMessage&>(message);
+            return SelectLane(element_message.GetInstanceSpecifier(), element_message.GetElementName());
+        }
+        case MessageType::kMethodCallRequest:
+        {
+            const auto& request = dynamic_cast<const MethodCallRequest&>(message);
+            return SelectLane(request.GetInstanceSpecifier(), request.GetMethodName());
+        }
+        case MessageType::kMethodCallResponse:
+            return dynamic_cast<const MethodCallResponse&>(message).GetCallId() % number_of_lanes_;
+        case MessageType::kAckResponse:
+        case MessageType::kInvalid:
+        default:
+            return 0U;
+    }
+}
+
+std::size_t LaneSelector::SelectLane(const std::string& instance_specifier,
+                                     const std::string& element_name) const noexcept
+{
+    if (!lane_mapping_.empty())
+    {
+        if (!element_name.empty())
+        {
+            const auto element_mapping = lane_mapping_.find({instance_specifier, element_name});
+            if (element_mapping != lane_mapping_.cend())
+            {
+                return element_mapping->second;
+            }
+        }
+        const auto service_mapping = lane_mapping_.find({instance_specifier, std::string{}});
+        if (service_mapping != lane_mapping_.cend())
+        {
+            return service_mapping->second;
+        }
+    }
+
+    auto hash = std::hash<std::string_view>{}(instance_specifier);
+    if (lane_assignment_ == LaneAssignment::kByElement)
+    {
+        hash = CombineHashes(hash, std::hash<std::string_view>{}(element_name));
+    }
+    return hash % number_of_lanes_;
+}
+
+}  // namespace score::mw::com::gateway
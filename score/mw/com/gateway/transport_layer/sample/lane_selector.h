@@ -0,0 +1,63 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_LANE_SELECTOR_H_
+#define SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_LANE_SELECTOR_H_
+
+#include "score/mw/com/gateway/transport_layer/sample/configuration/hypervisor_socket_configuration.h"
+#include "score/mw/com/gateway/transport_layer/sample/messages/transport_message.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace score::mw::com::gateway
+{
+
+/// \brief Selects the lane, on which a message is sent, if the transport stripes its messages over several lanes.
+/// \details The lane key of a message is its instance specifier and, for messages of a service element, the name of
+/// the event, field or method. An explicit mapping of the element takes precedence over an explicit mapping of the
+/// service instance. Otherwise the lane is selected by hashing the service instance (LaneAssignment::kByService) or
+/// the service element (LaneAssignment::kByElement). So all messages with the same lane key use the same lane and keep
+/// their order. MethodCallResponses are matched by their call id and may use any lane, so they are spread by call id.
+/// The lifecycle messages of a service instance (ProvideService, OfferService, StopOfferService) are ordered against
+/// the messages of all its elements, which may use other lanes. So they are sent on every lane instead (see
+/// IsSentOnAllLanes()).
+class LaneSelector
+{
+  public:
+    explicit LaneSelector(const HyperVisorSocketConfiguration& socket_config) noexcept;
+
+    /// \brief Returns true for the lifecycle messages of a service instance, which are sent on every lane and act as a
+    ///        barrier between the messages sent on any lane before and after them.
+    static bool IsSentOnAllLanes(const MessageType message_type) noexcept;
+
+    std::size_t GetNumberOfLanes() const noexcept
+    {
+        return number_of_lanes_;
+    }
+
+    /// \brief Returns the index of the lane, on which the given message shall be sent, if it isn't sent on all lanes.
+    std::size_t SelectLane(const TransportMessage& message) const noexcept;
+
+  private:
+    std::size_t SelectLane(const std::string& instance_specifier, const std::string& element_name) const noexcept;
+
+    std::size_t number_of_lanes_;
+    LaneAssignment lane_assignment_;
+    std::map<HyperVisorSocketConfiguration::LaneMappingKey, std::uint16_t> lane_mapping_;
+};
+
+}  // namespace score::mw::com::gateway
+
+#endif  // SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_LANE_SELECTOR_H_
@@ -0,0 +1,153 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/transport_layer/sample/lane_selector.h"
+
+#include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::gateway
+{
+namespace
+{
+
+constexpr std::uint16_t kNumberOfLanes{8U};
+constexpr std::size_t kNumberOfElements{64U};
+
+impl::InstanceSpecifier CreateInstanceSpecifier(const std::string& specifier)
+{
+    return impl::InstanceSpecifier::Create(std::string{specifier}).value();
+}
+
+UpdateNotification CreateUpdateNotification(const std::string& specifier, std::string element_name)
+{
+    return UpdateNotification{
+        CreateInstanceSpecifier(specifier), impl::ServiceElementType::EVENT, std::move(element_name)};
+}
+
+class LaneSelectorFixture : public ::testing::Test
+{
+  protected:
+    LaneSelectorFixture()
+    {
+        config_.number_of_lanes_ = kNumberOfLanes;
+    }
+
+    HyperVisorSocketConfiguration config_{};
+};
+
+TEST_F(LaneSelectorFixture, SelectsLaneZeroForASingleLane)
+{
+    // Given a lane selector for one lane
+    config_.number_of_lanes_ = 1U;
+    const LaneSelector lane_selector{config_};
+
+    // When selecting the lane of a message
+    // Then lane 0 is selected
+    EXPECT_EQ(lane_selector.SelectLane(CreateUpdateNotification("camera/front", "image")), 0U);
+}
+
+TEST_F(LaneSelectorFixture, AssignmentByServiceSelectsTheSameLaneForAllMessagesOfAService)
+{
+    // Given a lane selector, which assigns the lanes by service
+    config_.lane_assignment_ = LaneAssignment::kByService;
+    const LaneSelector lane_selector{config_};
+
+    // When selecting the lanes of the service-level and element messages of a service
+    const auto service_lane = lane_selector.SelectLane(OfferServiceRequest{CreateInstanceSpecifier("camera/front")});
+    const auto request_lane = lane_selector.SelectLane(MethodCallRequest{
+        1U, CreateInstanceSpecifier("camera/front"), "Calibrate", 0U, std::vector<std::uint8_t>{}});
+
+    // Then all of them use the same lane
+    EXPECT_LT(service_lane, kNumberOfLanes);
+    EXPECT_EQ(request_lane, service_lane);
+    for (std::size_t element = 0U; element < kNumberOfElements; ++element)
+    {
+        EXPECT_EQ(lane_selector.SelectLane(CreateUpdateNotification("camera/front", std::to_string(element))),
+                  service_lane);
+    }
+}
+
+TEST_F(LaneSelectorFixture, AssignmentByElementSpreadsTheElementsOfAServiceOverTheLanes)
+{
+    // Given a lane selector, which assigns the lanes by element
+    config_.lane_assignment_ = LaneAssignment::kByElement;
+    const LaneSelector lane_selector{config_};
+
+    // When selecting the lanes of many elements of one service
+    std::set<std::size_t> used_lanes{};
+    for (std::size_t element = 0U; element < kNumberOfElements; ++element)
+    {
+        const auto element_name = std::to_string(element);
+        const auto lane = lane_selector.SelectLane(CreateUpdateNotification("camera/front", element_name));
+
+        // Then each element keeps its lane
+        EXPECT_EQ(lane_selector.SelectLane(RegisterNotificationRequest{
+                      CreateInstanceSpecifier("camera/front"), impl::ServiceElementType::EVENT, element_name}),
+                  lane);
+        EXPECT_LT(lane, kNumberOfLanes);
+        used_lanes.insert(lane);
+    }
+
+    // and the elements are spread over more than one lane
+    EXPECT_GT(used_lanes.size(), 1U);
+}
+
+TEST_F(LaneSelectorFixture, ElementMappingTakesPrecedenceOverServiceMapping)
+{
+    // Given a lane selector with an explicit lane for a service and a different one for one of its elements
+    config_.lane_mapping_[{"camera/front", ""}] = 2U;
+    config_.lane_mapping_[{"camera/front", "image"}] = 5U;
+    const LaneSelector lane_selector{config_};
+
+    // When selecting the lanes of messages of the service
+    // Then the mapped element uses its lane and everything else uses the lane of the service
+    EXPECT_EQ(lane_selector.SelectLane(CreateUpdateNotification("camera/front", "image")), 5U);
+    EXPECT_EQ(lane_selector.SelectLane(CreateUpdateNotification("camera/front", "status")), 2U);
+    EXPECT_EQ(lane_selector.SelectLane(StopOfferServiceRequest{CreateInstanceSpecifier("camera/front")}), 2U);
+}
+
+TEST(LaneSelectorTest, OnlyLifecycleMessagesAreSentOnAllLanes)
+{
+    // When checking, which messages are sent on all lanes
+    // Then these are the lifecycle messages of a service instance
+    EXPECT_TRUE(LaneSelector::IsSentOnAllLanes(MessageType::kProvideServiceRequest));
+    EXPECT_TRUE(LaneSelector::IsSentOnAllLanes(MessageType::kOfferServiceRequest));
+    EXPECT_TRUE(LaneSelector::IsSentOnAllLanes(MessageType::kStopOfferServiceRequest));
+
+    // and not the messages of a service element
+    EXPECT_FALSE(LaneSelector::IsSentOnAllLanes(MessageType::kRegisterNotificationRequest));
+    EXPECT_FALSE(LaneSelector::IsSentOnAllLanes(MessageType::kUpdateNotification));
+    EXPECT_FALSE(LaneSelector::IsSentOnAllLanes(MessageType::kMethodCallRequest));
+    EXPECT_FALSE(LaneSelector::IsSentOnAllLanes(MessageType::kMethodCallResponse));
+}
+
+TEST_F(LaneSelectorFixture, MethodCallResponsesAreSpreadByCallId)
+{
+    // Given a lane selector
+    const LaneSelector lane_selector{config_};
+
+    // When selecting the lanes of method call responses
+    // Then the lane is given by the call id
+    EXPECT_EQ(lane_selector.SelectLane(MethodCallResponse{3U, true, {}}), 3U);
+    EXPECT_EQ(lane_selector.SelectLane(MethodCallResponse{kNumberOfLanes + 1U, true, {}}), 1U);
+}
+
+}  // namespace
+}  // namespace score::mw::com::gateway
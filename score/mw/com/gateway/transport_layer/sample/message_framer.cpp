@@ -90,6 +90,10 @@ std::unique_ptr<TransportMessage> MessageFramer::CreateMessageForType(MessageTyp
             return std::make_unique<UnregisterNotificationRequest>();
         case MessageType::kUpdateNotification:
             return std::make_unique<UpdateNotification>();
+        case MessageType::kMethodCallRequest:
+            return std::make_unique<MethodCallRequest>();
+        case MessageType::kMethodCallResponse:
+            return std::make_unique<MethodCallResponse>();
         case MessageType::kAckResponse:
             return std::make_unique<AckResponse>();
         case MessageType::kInvalid:
@@ -132,6 +132,20 @@ TEST_F(MessageFramerFixture, CreateMessageForTypeReturnsUpdateNotification)
     EXPECT_EQ(msg->GetType(), MessageType::kUpdateNotification);
 }
 
+TEST_F(MessageFramerFixture, CreateMessageForTypeReturnsMethodCallRequest)
+{
+    auto msg = MessageFramer::CreateMessageForType(MessageType::kMethodCallRequest);
+    ASSERT_NE(msg, nullptr);
+    EXPECT_EQ(msg->GetType(), MessageType::kMethodCallRequest);
+}
+
+TEST_F(MessageFramerFixture, CreateMessageForTypeReturnsMethodCallResponse)
+{
+    auto msg = MessageFramer::CreateMessageForType(MessageType::kMethodCallResponse);
+    ASSERT_NE(msg, nullptr);
+    EXPECT_EQ(msg->GetType(), MessageType::kMethodCallResponse);
+}
+
 TEST_F(MessageFramerFixture, CreateMessageForTypeReturnsAckResponse)
 {
     auto msg = MessageFramer::CreateMessageForType(MessageType::kAckResponse);
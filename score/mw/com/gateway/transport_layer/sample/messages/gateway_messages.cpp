@@ -103,4 +103,24 @@ bool ServiceElementMessage::Deserialize(score::cpp::span<const std::uint8_t> dat
     return DeserializeWithTemplate(*this, data);
 }
 
+std::size_t MethodCallRequest::Serialize(score::cpp::span<std::uint8_t> buffer) const
+{
+    return SerializeWithTemplate(*this, buffer);
+}
+
+bool MethodCallRequest::Deserialize(score::cpp::span<const std::uint8_t> data)
+{
+    return DeserializeWithTemplate(*this, data);
+}
+
+std::size_t MethodCallResponse::Serialize(score::cpp::span<std::uint8_t> buffer) const
+{
+    return SerializeWithTemplate(*this, buffer);
+}
+
+bool MethodCallResponse::Deserialize(score::cpp::span<const std::uint8_t> data)
+{
+    return DeserializeWithTemplate(*this, data);
+}
+
 }  // namespace score::mw::com::gateway
@@ -26,10 +26,33 @@
 namespace score::mw::com::gateway
 {
 
+/// \brief Base class of the lifecycle messages of a service instance, which a MultiLaneTransport sends on every lane.
+/// \details The barrier sequence is set by the sending MultiLaneTransport. The receiving one uses it to tell the copies
+/// of one lifecycle message on the different lanes apart from the copies of other lifecycle messages, e.g. of a message
+/// which has been delivered on some lanes only.
+class LifecycleMessage : public TransportMessage
+{
+  public:
+    using TransportMessage::TransportMessage;
+
+    std::uint32_t GetBarrierSequence() const
+    {
+        return barrier_sequence_;
+    }
+
+    void SetBarrierSequence(const std::uint32_t barrier_sequence)
+    {
+        barrier_sequence_ = barrier_sequence;
+    }
+
+  protected:
+    std::uint32_t barrier_sequence_{0U};
+};
+
 /// \brief Message to propagate service instance metadata (instance specifier + service element configurations)
 /// from the source gateway to the destination gateway. The destination gateway uses this information to create a
 /// (generic) skeleton for the given service instance.
-class ProvideServiceRequest : public TransportMessage
+class ProvideServiceRequest : public LifecycleMessage
 {
     template <typename Self>
     static auto GetSerializeMembersImpl(Self& self)
@@ -39,22 +62,31 @@ class ProvideServiceRequest : public TransportMessage
         using VectorType = std::
             conditional_t<std::is_const_v<SelfNoRef>, const std::vector<impl::EventInfo>, std::vector<impl::EventInfo>>;
         using Uint32Type = std::conditional_t<std::is_const_v<SelfNoRef>, const std::uint32_t, std::uint32_t>;
-        return std::tuple<StringType&, VectorType&, Uint32Type&, Uint32Type&>(
-            self.instance_specifier_, self.elements_, self.shm_control_size_, self.shm_data_size_);
+        using StringVectorType =
+            std::conditional_t<std::is_const_v<SelfNoRef>, const std::vector<std::string>, std::vector<std::string>>;
+        return std::tuple<StringType&, VectorType&, Uint32Type&, Uint32Type&, StringVectorType&, Uint32Type&>(
+            self.instance_specifier_,
+            self.elements_,
+            self.shm_control_size_,
+            self.shm_data_size_,
+            self.method_names_,
+            self.barrier_sequence_);
     }
 
   public:
-    ProvideServiceRequest() : TransportMessage(MessageType::kProvideServiceRequest) {}
+    ProvideServiceRequest() : LifecycleMessage(MessageType::kProvideServiceRequest) {}
 
     ProvideServiceRequest(impl::InstanceSpecifier service_instance_specifier,
                           std::vector<impl::EventInfo> service_elements,
                           std::uint32_t shm_control_size = 0U,
-                          std::uint32_t shm_data_size = 0U)
-        : TransportMessage(MessageType::kProvideServiceRequest),
+                          std::uint32_t shm_data_size = 0U,
+                          std::vector<std::string> method_names = {})
+        : LifecycleMessage(MessageType::kProvideServiceRequest),
           instance_specifier_(std::string{service_instance_specifier.ToString()}),
           elements_(std::move(service_elements)),
           shm_control_size_(shm_control_size),
-          shm_data_size_(shm_data_size)
+          shm_data_size_(shm_data_size),
+          method_names_(std::move(method_names))
     {
     }
 
@@ -81,6 +113,11 @@ class ProvideServiceRequest : public TransportMessage
         return shm_data_size_;
     }
 
+    const std::vector<std::string>& GetMethodNames() const
+    {
+        return method_names_;
+    }
+
     auto GetSerializeMembers() const
     {
         return GetSerializeMembersImpl(*this);
@@ -95,6 +132,7 @@ class ProvideServiceRequest : public TransportMessage
     std::vector<impl::EventInfo> elements_;
     std::uint32_t shm_control_size_{0U};
     std::uint32_t shm_data_size_{0U};
+    std::vector<std::string> method_names_;
 };
 
 /// \brief Acknowledgement response message, sent to confirm receipt of a request with a given sequence number.
@@ -137,13 +175,13 @@ class AckResponse : public TransportMessage
 /// \brief Message to trigger service-instance offering at the destination gateway side.
 /// The service instance is expected to be already created at the destination gateway side,
 /// e.g. by a previous ProvideServiceRequest.
-class OfferServiceRequest : public TransportMessage
+class OfferServiceRequest : public LifecycleMessage
 {
   public:
-    OfferServiceRequest() : TransportMessage(MessageType::kOfferServiceRequest) {}
+    OfferServiceRequest() : LifecycleMessage(MessageType::kOfferServiceRequest) {}
 
     explicit OfferServiceRequest(impl::InstanceSpecifier service_instance_specifier)
-        : TransportMessage(MessageType::kOfferServiceRequest),
+        : LifecycleMessage(MessageType::kOfferServiceRequest),
           instance_specifier_(std::string{service_instance_specifier.ToString()})
     {
     }
@@ -156,13 +194,13 @@ class OfferServiceRequest : public TransportMessage
         return instance_specifier_;
     }
 
-    std::tuple<const std::string&> GetSerializeMembers() const
+    std::tuple<const std::string&, const std::uint32_t&> GetSerializeMembers() const
     {
-        return {instance_specifier_};
+        return {instance_specifier_, barrier_sequence_};
     }
-    std::tuple<std::string&> GetSerializeMembers()
+    std::tuple<std::string&, std::uint32_t&> GetSerializeMembers()
     {
-        return {instance_specifier_};
+        return {instance_specifier_, barrier_sequence_};
     }
 
   private:
@@ -170,13 +208,13 @@ class OfferServiceRequest : public TransportMessage
 };
 
 /// \brief Message to trigger service-instance stop-offer at the destination gateway side.
-class StopOfferServiceRequest : public TransportMessage
+class StopOfferServiceRequest : public LifecycleMessage
 {
   public:
-    StopOfferServiceRequest() : TransportMessage(MessageType::kStopOfferServiceRequest) {}
+    StopOfferServiceRequest() : LifecycleMessage(MessageType::kStopOfferServiceRequest) {}
 
     explicit StopOfferServiceRequest(impl::InstanceSpecifier service_instance_specifier)
-        : TransportMessage(MessageType::kStopOfferServiceRequest),
+        : LifecycleMessage(MessageType::kStopOfferServiceRequest),
           instance_specifier_(std::string{service_instance_specifier.ToString()})
     {
     }
@@ -189,13 +227,13 @@ class StopOfferServiceRequest : public TransportMessage
         return instance_specifier_;
     }
 
-    std::tuple<const std::string&> GetSerializeMembers() const
+    std::tuple<const std::string&, const std::uint32_t&> GetSerializeMembers() const
     {
-        return {instance_specifier_};
+        return {instance_specifier_, barrier_sequence_};
     }
-    std::tuple<std::string&> GetSerializeMembers()
+    std::tuple<std::string&, std::uint32_t&> GetSerializeMembers()
     {
-        return {instance_specifier_};
+        return {instance_specifier_, barrier_sequence_};
     }
 
   private:
@@ -314,6 +352,145 @@ class UpdateNotification final : public ServiceElementMessage
     }
 };
 
+/// \brief Message to forward a method call from the destination gateway to the source gateway, which calls the method
+/// of the service instance.
+/// \details The call_id is chosen by the sender and returned in the related MethodCallResponse. It allows several
+/// calls to be in flight at the same time, whose responses may arrive in any order.
+class MethodCallRequest final : public TransportMessage
+{
+    template <typename Self>
+    static auto GetSerializeMembersImpl(Self& self)
+    {
+        using SelfNoRef = std::remove_reference_t<Self>;
+        using StringType = std::conditional_t<std::is_const_v<SelfNoRef>, const std::string, std::string>;
+        using Uint32Type = std::conditional_t<std::is_const_v<SelfNoRef>, const std::uint32_t, std::uint32_t>;
+        using ByteVectorType =
+            std::conditional_t<std::is_const_v<SelfNoRef>, const std::vector<std::uint8_t>, std::vector<std::uint8_t>>;
+        return std::tuple<Uint32Type&, StringType&, StringType&, Uint32Type&, ByteVectorType&>(
+            self.call_id_, self.instance_specifier_, self.method_name_, self.return_value_size_, self.in_args_);
+    }
+
+  public:
+    MethodCallRequest() : TransportMessage(MessageType::kMethodCallRequest) {}
+
+    MethodCallRequest(std::uint32_t call_id,
+                      impl::InstanceSpecifier service_instance_specifier,
+                      std::string method_name,
+                      std::uint32_t return_value_size,
+                      std::vector<std::uint8_t> in_args)
+        : TransportMessage(MessageType::kMethodCallRequest),
+          call_id_(call_id),
+          instance_specifier_(std::string{service_instance_specifier.ToString()}),
+          method_name_(std::move(method_name)),
+          return_value_size_(return_value_size),
+          in_args_(std::move(in_args))
+    {
+    }
+
+    std::size_t Serialize(score::cpp::span<std::uint8_t> buffer) const override;
+    bool Deserialize(score::cpp::span<const std::uint8_t> data) override;
+
+    std::uint32_t GetCallId() const
+    {
+        return call_id_;
+    }
+
+    const std::string& GetInstanceSpecifier() const
+    {
+        return instance_specifier_;
+    }
+
+    const std::string& GetMethodName() const
+    {
+        return method_name_;
+    }
+
+    std::uint32_t GetReturnValueSize() const
+    {
+        return return_value_size_;
+    }
+
+    const std::vector<std::uint8_t>& GetInArgs() const
+    {
+        return in_args_;
+    }
+
+    auto GetSerializeMembers() const
+    {
+        return GetSerializeMembersImpl(*this);
+    }
+    auto GetSerializeMembers()
+    {
+        return GetSerializeMembersImpl(*this);
+    }
+
+  private:
+    std::uint32_t call_id_{0U};
+    std::string instance_specifier_;
+    std::string method_name_;
+    std::uint32_t return_value_size_{0U};
+    std::vector<std::uint8_t> in_args_;
+};
+
+/// \brief Message to return the result of a forwarded method call from the source gateway to the destination gateway.
+/// \details If the call failed, the return value is empty.
+class MethodCallResponse final : public TransportMessage
+{
+    template <typename Self>
+    static auto GetSerializeMembersImpl(Self& self)
+    {
+        using SelfNoRef = std::remove_reference_t<Self>;
+        using Uint32Type = std::conditional_t<std::is_const_v<SelfNoRef>, const std::uint32_t, std::uint32_t>;
+        using BoolType = std::conditional_t<std::is_const_v<SelfNoRef>, const bool, bool>;
+        using ByteVectorType =
+            std::conditional_t<std::is_const_v<SelfNoRef>, const std::vector<std::uint8_t>, std::vector<std::uint8_t>>;
+        return std::tuple<Uint32Type&, BoolType&, ByteVectorType&>(self.call_id_, self.succeeded_, self.return_value_);
+    }
+
+  public:
+    MethodCallResponse() : TransportMessage(MessageType::kMethodCallResponse) {}
+
+    MethodCallResponse(std::uint32_t call_id, bool succeeded, std::vector<std::uint8_t> return_value)
+        : TransportMessage(MessageType::kMethodCallResponse),
+          call_id_(call_id),
+          succeeded_(succeeded),
+          return_value_(std::move(return_value))
+    {
+    }
+
+    std::size_t Serialize(score::cpp::span<std::uint8_t> buffer) const override;
+    bool Deserialize(score::cpp::span<const std::uint8_t> data) override;
+
+    std::uint32_t GetCallId() const
+    {
+        return call_id_;
+    }
+
+    bool HasSucceeded() const
+    {
+        return succeeded_;
+    }
+
+    const std::vector<std::uint8_t>& GetReturnValue() const
+    {
+        return return_value_;
+    }
+
+    auto GetSerializeMembers() const
+    {
+        return GetSerializeMembersImpl(*this);
+    }
+    auto GetSerializeMembers()
+    {
+        return GetSerializeMembersImpl(*this);
+    }
+
+  private:
+    std::uint32_t call_id_{0U};
+    bool succeeded_{false};
+    std::vector<std::uint8_t> return_value_;
+};
+
 }  // namespace score::mw::com::gateway
 
 #endif  // SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_GATEWAY_MESSAGES_H_
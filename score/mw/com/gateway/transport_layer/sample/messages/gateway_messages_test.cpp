@@ -41,6 +41,7 @@ TEST(GatewayMessagesTest, ProvideServiceRequestRoundTrip)
     };
 
     ProvideServiceRequest original{std::move(specifier).value(), elements, 4U, 8U};
+    original.SetBarrierSequence(3U);
 
     std::array<std::uint8_t, kTestBufferSize> buffer{};
     const auto size = original.Serialize(buffer);
@@ -59,6 +60,7 @@ TEST(GatewayMessagesTest, ProvideServiceRequestRoundTrip)
     EXPECT_EQ(deserialized.GetServiceElements()[1].data_type_meta_info.alignment, 4U);
     EXPECT_EQ(deserialized.GetShmControlSize(), 4U);
     EXPECT_EQ(deserialized.GetShmDataSize(), 8U);
+    EXPECT_EQ(deserialized.GetBarrierSequence(), 3U);
 }
 
 TEST(GatewayMessagesTest, ProvideServiceRequestEmptyElements)
@@ -79,12 +81,69 @@ TEST(GatewayMessagesTest, ProvideServiceRequestEmptyElements)
     EXPECT_TRUE(deserialized.GetServiceElements().empty());
 }
 
+TEST(GatewayMessagesTest, ProvideServiceRequestWithMethodNamesRoundTrip)
+{
+    auto specifier = impl::InstanceSpecifier::Create(std::string{"SpeedService/Instance42"});
+    ASSERT_TRUE(specifier.has_value());
+
+    ProvideServiceRequest original{std::move(specifier).value(), {}, 4U, 8U, {"SetSpeed", "Reset"}};
+
+    std::array<std::uint8_t, kTestBufferSize> buffer{};
+    const auto size = original.Serialize(buffer);
+    ASSERT_GT(size, 0U);
+
+    ProvideServiceRequest deserialized;
+    ASSERT_TRUE(deserialized.Deserialize(score::cpp::span<const std::uint8_t>(buffer.data(), size)));
+
+    EXPECT_EQ(deserialized.GetMethodNames(), (std::vector<std::string>{"SetSpeed", "Reset"}));
+}
+
+TEST(GatewayMessagesTest, MethodCallRequestRoundTrip)
+{
+    auto specifier = impl::InstanceSpecifier::Create(std::string{"SpeedService/Instance42"});
+    ASSERT_TRUE(specifier.has_value());
+
+    MethodCallRequest original{17U, std::move(specifier).value(), "SetSpeed", 8U, {1U, 2U, 3U}};
+
+    std::array<std::uint8_t, kTestBufferSize> buffer{};
+    const auto size = original.Serialize(buffer);
+    ASSERT_GT(size, 0U);
+
+    MethodCallRequest deserialized;
+    ASSERT_TRUE(deserialized.Deserialize(score::cpp::span<const std::uint8_t>(buffer.data(), size)));
+
+    EXPECT_EQ(deserialized.GetType(), MessageType::kMethodCallRequest);
+    EXPECT_EQ(deserialized.GetCallId(), 17U);
+    EXPECT_EQ(deserialized.GetInstanceSpecifier(), "SpeedService/Instance42");
+    EXPECT_EQ(deserialized.GetMethodName(), "SetSpeed");
+    EXPECT_EQ(deserialized.GetReturnValueSize(), 8U);
+    EXPECT_EQ(deserialized.GetInArgs(), (std::vector<std::uint8_t>{1U, 2U, 3U}));
+}
+
+TEST(GatewayMessagesTest, MethodCallResponseRoundTrip)
+{
+    MethodCallResponse original{17U, true, {4U, 5U}};
+
+    std::array<std::uint8_t, kTestBufferSize> buffer{};
+    const auto size = original.Serialize(buffer);
+    ASSERT_GT(size, 0U);
+
+    MethodCallResponse deserialized;
+    ASSERT_TRUE(deserialized.Deserialize(score::cpp::span<const std::uint8_t>(buffer.data(), size)));
+
+    EXPECT_EQ(deserialized.GetType(), MessageType::kMethodCallResponse);
+    EXPECT_EQ(deserialized.GetCallId(), 17U);
+    EXPECT_TRUE(deserialized.HasSucceeded());
+    EXPECT_EQ(deserialized.GetReturnValue(), (std::vector<std::uint8_t>{4U, 5U}));
+}
+
 TEST(GatewayMessagesTest, OfferServiceRequestRoundTrip)
 {
     auto specifier = impl::InstanceSpecifier::Create(std::string{"SpeedService/Instance42"});
     ASSERT_TRUE(specifier.has_value());
 
     OfferServiceRequest original{std::move(specifier).value()};
+    original.SetBarrierSequence(7U);
 
     std::array<std::uint8_t, kTestBufferSize> buffer{};
     const auto size = original.Serialize(buffer);
@@ -94,6 +153,7 @@ TEST(GatewayMessagesTest, OfferServiceRequestRoundTrip)
     ASSERT_TRUE(deserialized.Deserialize(score::cpp::span<const std::uint8_t>(buffer.data(), size)));
 
     EXPECT_EQ(deserialized.GetInstanceSpecifier(), "SpeedService/Instance42");
+    EXPECT_EQ(deserialized.GetBarrierSequence(), 7U);
 }
 
 TEST(GatewayMessagesTest, StopOfferServiceRequestRoundTrip)
@@ -102,6 +162,7 @@ TEST(GatewayMessagesTest, StopOfferServiceRequestRoundTrip)
     ASSERT_TRUE(specifier.has_value());
 
     StopOfferServiceRequest original{std::move(specifier).value()};
+    original.SetBarrierSequence(7U);
 
     std::array<std::uint8_t, kTestBufferSize> buffer{};
     const auto size = original.Serialize(buffer);
@@ -111,6 +172,7 @@ TEST(GatewayMessagesTest, StopOfferServiceRequestRoundTrip)
     ASSERT_TRUE(deserialized.Deserialize(score::cpp::span<const std::uint8_t>(buffer.data(), size)));
 
     EXPECT_EQ(deserialized.GetInstanceSpecifier(), "SpeedService/Instance42");
+    EXPECT_EQ(deserialized.GetBarrierSequence(), 7U);
 }
 
 TEST(GatewayMessagesTest, UpdateNotificationRoundTrip)
@@ -301,6 +363,8 @@ TEST(GatewayMessageTest, IsRequestIdentifiesRequestTypes)
     EXPECT_TRUE(IsRequest(MessageType::kRegisterNotificationRequest));
     EXPECT_TRUE(IsRequest(MessageType::kUnregisterNotificationRequest));
     EXPECT_FALSE(IsRequest(MessageType::kUpdateNotification));
+    EXPECT_FALSE(IsRequest(MessageType::kMethodCallRequest));
+    EXPECT_FALSE(IsRequest(MessageType::kMethodCallResponse));
     EXPECT_FALSE(IsRequest(MessageType::kAckResponse));
 }
 
@@ -312,6 +376,8 @@ TEST(GatewayMessageTest, IsNotificationIdentifiesNotificationTypes)
     EXPECT_FALSE(IsNotification(MessageType::kRegisterNotificationRequest));
     EXPECT_FALSE(IsNotification(MessageType::kUnregisterNotificationRequest));
     EXPECT_TRUE(IsNotification(MessageType::kUpdateNotification));
+    EXPECT_TRUE(IsNotification(MessageType::kMethodCallRequest));
+    EXPECT_TRUE(IsNotification(MessageType::kMethodCallResponse));
     EXPECT_FALSE(IsNotification(MessageType::kAckResponse));
 }
 
@@ -323,6 +389,8 @@ TEST(GatewayMessageTest, IsResponseIdentifiesResponseTypes)
     EXPECT_FALSE(IsResponse(MessageType::kRegisterNotificationRequest));
     EXPECT_FALSE(IsResponse(MessageType::kUnregisterNotificationRequest));
     EXPECT_FALSE(IsResponse(MessageType::kUpdateNotification));
+    EXPECT_FALSE(IsResponse(MessageType::kMethodCallRequest));
+    EXPECT_FALSE(IsResponse(MessageType::kMethodCallResponse));
     EXPECT_TRUE(IsResponse(MessageType::kAckResponse));
 }
 
@@ -334,6 +402,8 @@ TEST(GatewayMessageTest, RequiresResponseIdentifiesRequestTypes)
     EXPECT_TRUE(RequiresResponse(MessageType::kRegisterNotificationRequest));
     EXPECT_TRUE(RequiresResponse(MessageType::kUnregisterNotificationRequest));
     EXPECT_FALSE(RequiresResponse(MessageType::kUpdateNotification));
+    EXPECT_FALSE(RequiresResponse(MessageType::kMethodCallRequest));
+    EXPECT_FALSE(RequiresResponse(MessageType::kMethodCallResponse));
     EXPECT_FALSE(RequiresResponse(MessageType::kAckResponse));
 }
 }  // namespace
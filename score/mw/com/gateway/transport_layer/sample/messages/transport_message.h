@@ -33,6 +33,8 @@ enum class RequestType : std::uint8_t
 enum class NotificationType : std::uint8_t
 {
     kUpdate = 0x40,
+    kMethodCall = 0x41,
+    kMethodCallResult = 0x42,
 };
 
 enum class ResponseType : std::uint8_t
@@ -54,6 +56,10 @@ enum class MessageType : std::uint8_t
 
     // Notifications
     kUpdateNotification = static_cast<std::uint8_t>(NotificationType::kUpdate),
+    // Method calls are sent without ACK, as the MethodCallResponse confirms the reception. This allows many calls to be
+    // in flight on a link at the same time.
+    kMethodCallRequest = static_cast<std::uint8_t>(NotificationType::kMethodCall),
+    kMethodCallResponse = static_cast<std::uint8_t>(NotificationType::kMethodCallResult),
     // Invalid message type, e.g. for uninitialized messages or in case of deserialization failures.
     kInvalid = 0xFFU
 };
@@ -67,7 +73,8 @@ inline bool IsRequest(MessageType type)
 
 inline bool IsNotification(MessageType type)
 {
-    return (type == MessageType::kUpdateNotification);
+    return (type == MessageType::kUpdateNotification) || (type == MessageType::kMethodCallRequest) ||
+           (type == MessageType::kMethodCallResponse);
 }
 
 inline bool IsResponse(MessageType type)
@@ -0,0 +1,287 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/transport_layer/sample/multi_lane_transport.h"
+
+#include "score/mw/com/gateway/transport_layer/sample/bidirectional_transport.h"
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace score::mw::com::gateway
+{
+
+namespace
+{
+
+/// \brief Returns true, if barrier sequence a has been assigned after barrier sequence b, taking the wrap around of the
+/// sequence into account.
+bool IsLaterBarrierSequence(const std::uint32_t a, const std::uint32_t b) noexcept
+{
+    return static_cast<std::int32_t>(a - b) > 0;
+}
+
+}  // namespace
+
+std::unique_ptr<IBidirectionalTransport> MultiLaneTransport::Create(
+    const HyperVisorSocketConfiguration& socket_config)
+{
+    if (socket_config.number_of_lanes_ <= 1U)
+    {
+        return std::make_unique<BidirectionalTransport>(socket_config);
+    }
+
+    std::vector<std::unique_ptr<IBidirectionalTransport>> lanes{};
+    lanes.reserve(socket_config.number_of_lanes_);
+    for (std::uint16_t lane = 0U; lane < socket_config.number_of_lanes_; ++lane)
+    {
+        auto lane_config = socket_config;
+        lane_config.local_port_ = static_cast<std::uint16_t>(socket_config.local_port_ + lane);
+        lane_config.remote_port_ = static_cast<std::uint16_t>(socket_config.remote_port_ + lane);
+        lanes.push_back(std::make_unique<BidirectionalTransport>(std::move(lane_config)));
+    }
+    return std::make_unique<MultiLaneTransport>(std::move(lanes), LaneSelector{socket_config});
+}
+
+MultiLaneTransport::MultiLaneTransport(std::vector<std::unique_ptr<IBidirectionalTransport>> lanes,
+                                       LaneSelector lane_selector) noexcept
+    : lanes_{std::move(lanes)},
+      lane_selector_{std::move(lane_selector)},
+      message_handler_{},
+      connection_handler_{},
+      lifecycle_send_mutex_{},
+      last_sent_barrier_sequence_{0U},
+      barrier_mutex_{},
+      barrier_passed_{},
+      barrier_arrived_(lanes_.size(), false),
+      barrier_arrived_lanes_{0U},
+      barrier_sequence_{0U},
+      last_passed_barrier_sequence_{},
+      barrier_generation_{0U},
+      barrier_released_{false}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(lanes_.size() == lane_selector_.GetNumberOfLanes(),
+                                                      "MultiLaneTransport: a transport is needed for each lane.");
+}
+
+MultiLaneTransport::~MultiLaneTransport()
+{
+    Shutdown();
+}
+
+score::ResultBlank MultiLaneTransport::Setup()
+{
+    {
+        std::lock_guard<std::mutex> lock{barrier_mutex_};
+        barrier_arrived_.assign(lanes_.size(), false);
+        barrier_arrived_lanes_ = 0U;
+        last_passed_barrier_sequence_.reset();
+        barrier_released_ = false;
+    }
+
+    // The remote side sets up its lanes in the same order, so that each Setup() can connect to its counterpart.
+    for (std::size_t lane = 0U; lane < lanes_.size(); ++lane)
+    {
+        const auto setup_result = lanes_[lane]->Setup();
+        if (!setup_result.has_value())
+        {
+            ::score::mw::log::LogError() << "MultiLaneTransport: failed to set up lane " << lane;
+            Shutdown();
+            return setup_result;
+        }
+    }
+    return {};
+}
+
+void MultiLaneTransport::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock{barrier_mutex_};
+        barrier_released_ = true;
+    }
+    barrier_passed_.notify_all();
+
+    for (auto& lane : lanes_)
+    {
+        lane->Shutdown();
+    }
+}
+
+bool MultiLaneTransport::IsConnected() const
+{
+    for (const auto& lane : lanes_)
+    {
+        if (!lane->IsConnected())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+score::ResultBlank MultiLaneTransport::SendRequest(TransportMessage& message)
+{
+    if (LaneSelector::IsSentOnAllLanes(message.GetType()))
+    {
+        return SendOnAllLanes(message, [&message](IBidirectionalTransport& lane) {
+            return lane.SendRequest(message);
+        });
+    }
+    return GetLane(message).SendRequest(message);
+}
+
+score::ResultBlank MultiLaneTransport::SendNotification(TransportMessage& message)
+{
+    if (LaneSelector::IsSentOnAllLanes(message.GetType()))
+    {
+        return SendOnAllLanes(message, [&message](IBidirectionalTransport& lane) {
+            return lane.SendNotification(message);
+        });
+    }
+    return GetLane(message).SendNotification(message);
+}
+
+template <typename SendFunction>
+score::ResultBlank MultiLaneTransport::SendOnAllLanes(TransportMessage& message, SendFunction send)
+{
+    std::lock_guard<std::mutex> lock{lifecycle_send_mutex_};
+    // Only lifecycle messages are sent on all lanes, see LaneSelector::IsSentOnAllLanes().
+    ++last_sent_barrier_sequence_;
+    static_cast<LifecycleMessage&>(message).SetBarrierSequence(last_sent_barrier_sequence_);
+    for (std::size_t lane = 0U; lane < lanes_.size(); ++lane)
+    {
+        const auto send_result = send(*lanes_[lane]);
+        if (!send_result.has_value())
+        {
+            // The lanes, which have received the message, drop it, once the next lifecycle message arrives on this lane
+            // or the lane reconnects.
+            ::score::mw::log::LogError() << "MultiLaneTransport: failed to send message of type "
+                                         << static_cast<int>(message.GetType()) << " on lane " << lane;
+            return send_result;
+        }
+    }
+    return {};
+}
+
+void MultiLaneTransport::SetMessageHandler(MessageHandler handler)
+{
+    message_handler_ = std::move(handler);
+    for (std::size_t lane = 0U; lane < lanes_.size(); ++lane)
+    {
+        lanes_[lane]->SetMessageHandler([this, lane](std::unique_ptr<TransportMessage> message) {
+            if (LaneSelector::IsSentOnAllLanes(message->GetType()))
+            {
+                PassLifecycleMessage(lane, std::move(message));
+                return;
+            }
+            message_handler_(std::move(message));
+        });
+        lanes_[lane]->SetConnectionHandler([this, lane]() {
+            OnLaneConnected(lane);
+        });
+    }
+}
+
+void MultiLaneTransport::SetConnectionHandler(ConnectionHandler handler)
+{
+    connection_handler_ = std::move(handler);
+}
+
+void MultiLaneTransport::PassLifecycleMessage(const std::size_t lane, std::unique_ptr<TransportMessage> message)
+{
+    const auto sequence = static_cast<const LifecycleMessage&>(*message).GetBarrierSequence();
+
+    std::unique_lock<std::mutex> lock{barrier_mutex_};
+    if (last_passed_barrier_sequence_.has_value() &&
+        (!IsLaterBarrierSequence(sequence, last_passed_barrier_sequence_.value())))
+    {
+        ::score::mw::log::LogWarn() << "MultiLaneTransport: dropping lifecycle message " << sequence << " on lane "
+                                    << lane << ", which has already been handled";
+        return;
+    }
+
+    if ((barrier_arrived_lanes_ > 0U) && (sequence != barrier_sequence_))
+    {
+        if (!IsLaterBarrierSequence(sequence, barrier_sequence_))
+        {
+            ::score::mw::log::LogWarn() << "MultiLaneTransport: dropping lifecycle message " << sequence << " on lane "
+                                        << lane << ", which hasn't arrived on every lane";
+            return;
+        }
+        // Lifecycle messages are sent one after another, so this lane won't receive the waiting one anymore.
+        ::score::mw::log::LogWarn() << "MultiLaneTransport: dropping lifecycle message " << barrier_sequence_
+                                    << ", which hasn't arrived on lane " << lane;
+        DropWaitingLifecycleMessage();
+    }
+
+    barrier_sequence_ = sequence;
+    barrier_arrived_[lane] = true;
+    ++barrier_arrived_lanes_;
+    if (barrier_arrived_lanes_ < lanes_.size())
+    {
+        // The copy of the last arriving lane gets passed to the message handler, this one is dropped.
+        const auto generation = barrier_generation_;
+        barrier_passed_.wait(lock, [this, generation]() {
+            return (barrier_generation_ != generation) || barrier_released_;
+        });
+        return;
+    }
+
+    // All other lanes wait, so none of them can arrive, until the generation has been incremented.
+    barrier_arrived_.assign(lanes_.size(), false);
+    barrier_arrived_lanes_ = 0U;
+    last_passed_barrier_sequence_ = sequence;
+    lock.unlock();
+    message_handler_(std::move(message));
+    lock.lock();
+    ++barrier_generation_;
+    lock.unlock();
+    barrier_passed_.notify_all();
+}
+
+void MultiLaneTransport::OnLaneConnected(const std::size_t lane)
+{
+    {
+        std::lock_guard<std::mutex> lock{barrier_mutex_};
+        if (barrier_arrived_lanes_ > 0U)
+        {
+            ::score::mw::log::LogWarn() << "MultiLaneTransport: dropping lifecycle message " << barrier_sequence_
+                                        << " as lane " << lane << " has reconnected";
+            DropWaitingLifecycleMessage();
+        }
+        // The remote gateway may have been restarted and then starts its barrier sequence again.
+        last_passed_barrier_sequence_.reset();
+    }
+
+    if (!connection_handler_.empty())
+    {
+        connection_handler_();
+    }
+}
+
+void MultiLaneTransport::DropWaitingLifecycleMessage()
+{
+    barrier_arrived_.assign(lanes_.size(), false);
+    barrier_arrived_lanes_ = 0U;
+    ++barrier_generation_;
+    barrier_passed_.notify_all();
+}
+
+IBidirectionalTransport& MultiLaneTransport::GetLane(const TransportMessage& message)
+{
+    return *lanes_[lane_selector_.SelectLane(message)];
+}
+
+}  // namespace score::mw::com::gateway
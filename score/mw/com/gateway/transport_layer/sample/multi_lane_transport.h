@@ -0,0 +1,126 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_MULTI_LANE_TRANSPORT_H_
+#define SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_MULTI_LANE_TRANSPORT_H_
+
+#include "score/mw/com/gateway/transport_layer/sample/configuration/hypervisor_socket_configuration.h"
+#include "score/mw/com/gateway/transport_layer/sample/i_bidirectional_transport.h"
+#include "score/mw/com/gateway/transport_layer/sample/lane_selector.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace score::mw::com::gateway
+{
+
+/// \brief Stripes the messages to the remote gateway over several parallel lanes, i.e. independent transports with
+/// their own connection, sender and dispatch thread.
+/// \details Each message is sent on the lane selected by the LaneSelector, so a large or slowly processed stream of one
+/// service (element) doesn't delay the messages of others, which are assigned to a different lane. Messages received on
+/// any lane are passed to the one message handler. The order is kept only between messages of the same lane, except for
+/// the lifecycle messages of a service instance (see LaneSelector::IsSentOnAllLanes()): they are sent on every lane and
+/// are passed to the message handler once, after they have arrived on every lane. Until the message handler returned,
+/// the dispatch threads of all lanes wait. So a lifecycle message is handled after all messages, which have been sent
+/// on any lane before it, and before all messages, which are sent on any lane after it. The copies on the different
+/// lanes are matched by the barrier sequence of the message (see LifecycleMessage). A lifecycle message, which has been
+/// delivered on some lanes only, is dropped as soon as a later lifecycle message arrives or a lane reconnects. Both
+/// gateways have to use a MultiLaneTransport with the same number of lanes.
+class MultiLaneTransport : public IBidirectionalTransport
+{
+  public:
+    /// \brief Creates the transport for the given configuration: a single BidirectionalTransport for one lane and a
+    /// MultiLaneTransport of BidirectionalTransports otherwise, where lane i uses local_port_ + i and remote_port_ + i.
+    static std::unique_ptr<IBidirectionalTransport> Create(const HyperVisorSocketConfiguration& socket_config);
+
+    MultiLaneTransport(std::vector<std::unique_ptr<IBidirectionalTransport>> lanes,
+                       LaneSelector lane_selector) noexcept;
+    ~MultiLaneTransport() override;
+
+    MultiLaneTransport(const MultiLaneTransport&) = delete;
+    MultiLaneTransport& operator=(const MultiLaneTransport&) = delete;
+    MultiLaneTransport(MultiLaneTransport&&) = delete;
+    MultiLaneTransport& operator=(MultiLaneTransport&&) = delete;
+
+    /// \brief Sets up all lanes one after another. Blocks until all of them are connected. If one lane fails, all
+    /// lanes are shut down again.
+    score::ResultBlank Setup() override;
+    void Shutdown() override;
+
+    /// \brief Returns true, if all lanes are connected.
+    bool IsConnected() const override;
+
+    score::ResultBlank SendRequest(TransportMessage& message) override;
+    score::ResultBlank SendNotification(TransportMessage& message) override;
+
+    /// \brief Set a callback that will handle incoming messages of all lanes. The callback is called concurrently from
+    /// the dispatch threads of the lanes. Also sets the connection handlers of the lanes, so has to be called before
+    /// Setup().
+    void SetMessageHandler(MessageHandler handler) override;
+
+    /// \brief Set a callback that is called, whenever any of the lanes has (re-)established its connection.
+    void SetConnectionHandler(ConnectionHandler handler) override;
+
+  private:
+    IBidirectionalTransport& GetLane(const TransportMessage& message);
+
+    /// \brief Sends the message with the next barrier sequence on every lane. Lifecycle messages are sent one after
+    ///        another, so that every lane receives them in the same order.
+    template <typename SendFunction>
+    score::ResultBlank SendOnAllLanes(TransportMessage& message, SendFunction send);
+
+    /// \brief Called by the dispatch thread of a lane with a lifecycle message. Waits until the message with the same
+    ///        barrier sequence has arrived on every lane. The last lane passes it to the message handler and then
+    ///        releases the other lanes.
+    void PassLifecycleMessage(std::size_t lane, std::unique_ptr<TransportMessage> message);
+
+    /// \brief Called by the dispatch thread of a lane after it has (re-)established its connection. Drops a lifecycle
+    ///        message, which has arrived on some lanes only, as the lane won't receive it anymore.
+    void OnLaneConnected(std::size_t lane);
+
+    /// \brief Releases the lanes waiting for a lifecycle message without passing it to the message handler. Has to be
+    ///        called with barrier_mutex_ locked.
+    void DropWaitingLifecycleMessage();
+
+    std::vector<std::unique_ptr<IBidirectionalTransport>> lanes_;
+    LaneSelector lane_selector_;
+    MessageHandler message_handler_;
+    ConnectionHandler connection_handler_;
+
+    std::mutex lifecycle_send_mutex_;
+    /// \brief Barrier sequence of the last sent lifecycle message, guarded by lifecycle_send_mutex_.
+    std::uint32_t last_sent_barrier_sequence_;
+
+    /// \brief Guards the state of the barrier of received lifecycle messages.
+    std::mutex barrier_mutex_;
+    std::condition_variable barrier_passed_;
+    /// \brief Per lane, whether the lifecycle message with barrier_sequence_ has arrived on it.
+    std::vector<bool> barrier_arrived_;
+    std::size_t barrier_arrived_lanes_;
+    std::uint32_t barrier_sequence_;
+    /// \brief Barrier sequence of the last lifecycle message passed to the message handler. A copy, which arrives on a
+    ///        lane again, e.g. as its ACK timed out, is dropped.
+    std::optional<std::uint32_t> last_passed_barrier_sequence_;
+    /// \brief Incremented, whenever the lanes waiting for a lifecycle message are released.
+    std::uint64_t barrier_generation_;
+    /// \brief Set on shutdown, so that no dispatch thread waits for lanes, which won't receive anything anymore.
+    bool barrier_released_;
+};
+
+}  // namespace score::mw::com::gateway
+
+#endif  // SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_MULTI_LANE_TRANSPORT_H_
@@ -0,0 +1,395 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/transport_layer/sample/multi_lane_transport.h"
+
+#include "score/mw/com/gateway/transport_layer/sample/bidirectional_transport_mock.h"
+#include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
+#include "score/mw/com/gateway/transport_layer/transport_error.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::gateway
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+constexpr std::size_t kNumberOfLanes{2U};
+constexpr auto kBulkService = "bulk/service";
+constexpr auto kSmallService = "small/service";
+
+UpdateNotification CreateUpdateNotification(const std::string& specifier)
+{
+    return UpdateNotification{
+        impl::InstanceSpecifier::Create(std::string{specifier}).value(), impl::ServiceElementType::EVENT, "event"};
+}
+
+OfferServiceRequest CreateOfferServiceRequest(const std::string& specifier)
+{
+    return OfferServiceRequest{impl::InstanceSpecifier::Create(std::string{specifier}).value()};
+}
+
+std::unique_ptr<OfferServiceRequest> CreateLifecycleMessage(const std::uint32_t barrier_sequence)
+{
+    auto message = std::make_unique<OfferServiceRequest>(CreateOfferServiceRequest(kBulkService));
+    message->SetBarrierSequence(barrier_sequence);
+    return message;
+}
+
+class MultiLaneTransportFixture : public ::testing::Test
+{
+  protected:
+    MultiLaneTransportFixture()
+    {
+        HyperVisorSocketConfiguration config{};
+        config.number_of_lanes_ = kNumberOfLanes;
+        config.lane_mapping_[{kBulkService, ""}] = 0U;
+        config.lane_mapping_[{kSmallService, ""}] = 1U;
+
+        std::vector<std::unique_ptr<IBidirectionalTransport>> lanes{};
+        for (auto& lane_mock : lane_mocks_)
+        {
+            auto lane = std::make_unique<NiceMock<BidirectionalTransportMock>>();
+            lane_mock = lane.get();
+            lanes.push_back(std::move(lane));
+        }
+        transport_ = std::make_unique<MultiLaneTransport>(std::move(lanes), LaneSelector{config});
+    }
+
+    /// \brief Sets the given message handler at the transport and returns the handlers, which the lanes get. The
+    /// connection handlers, which the lanes get, are stored in lane_connection_handlers_.
+    std::array<IBidirectionalTransport::MessageHandler, kNumberOfLanes> SetMessageHandler(
+        IBidirectionalTransport::MessageHandler handler)
+    {
+        std::array<IBidirectionalTransport::MessageHandler, kNumberOfLanes> lane_handlers{};
+        for (std::size_t lane = 0U; lane < kNumberOfLanes; ++lane)
+        {
+            EXPECT_CALL(*lane_mocks_[lane], SetMessageHandler(_))
+                .WillOnce([&lane_handlers, lane](IBidirectionalTransport::MessageHandler lane_handler) {
+                    lane_handlers[lane] = std::move(lane_handler);
+                });
+            EXPECT_CALL(*lane_mocks_[lane], SetConnectionHandler(_))
+                .WillOnce([this, lane](IBidirectionalTransport::ConnectionHandler connection_handler) {
+                    lane_connection_handlers_[lane] = std::move(connection_handler);
+                });
+        }
+        transport_->SetMessageHandler(std::move(handler));
+        return lane_handlers;
+    }
+
+    std::array<NiceMock<BidirectionalTransportMock>*, kNumberOfLanes> lane_mocks_{};
+    std::array<IBidirectionalTransport::ConnectionHandler, kNumberOfLanes> lane_connection_handlers_{};
+    std::unique_ptr<MultiLaneTransport> transport_{};
+};
+
+TEST_F(MultiLaneTransportFixture, SendsEachMessageOnItsLane)
+{
+    // Given a transport with a lane for the bulk and for the small service
+    auto bulk_notification = CreateUpdateNotification(kBulkService);
+    auto small_request = RegisterNotificationRequest{
+        impl::InstanceSpecifier::Create(std::string{kSmallService}).value(), impl::ServiceElementType::EVENT, "event"};
+
+    // Expecting that each message is only sent on its lane
+    EXPECT_CALL(*lane_mocks_[0], SendNotification(::testing::Ref(bulk_notification)))
+        .WillOnce(Return(score::ResultBlank{}));
+    EXPECT_CALL(*lane_mocks_[1], SendNotification(_)).Times(0);
+    EXPECT_CALL(*lane_mocks_[1], SendRequest(::testing::Ref(small_request))).WillOnce(Return(score::ResultBlank{}));
+    EXPECT_CALL(*lane_mocks_[0], SendRequest(_)).Times(0);
+
+    // When sending a notification of the bulk service and a request of the small service
+    // Then both are sent successfully
+    EXPECT_TRUE(transport_->SendNotification(bulk_notification).has_value());
+    EXPECT_TRUE(transport_->SendRequest(small_request).has_value());
+}
+
+TEST_F(MultiLaneTransportFixture, PassesMessagesOfAllLanesToTheMessageHandler)
+{
+    // Given a transport, whose lanes capture the message handler they get
+    std::size_t received_messages{0U};
+    auto lane_handlers = SetMessageHandler([&received_messages](std::unique_ptr<TransportMessage> message) {
+        ASSERT_NE(message, nullptr);
+        ++received_messages;
+    });
+
+    // When each lane receives a message
+    for (auto& lane_handler : lane_handlers)
+    {
+        lane_handler(std::make_unique<UpdateNotification>(CreateUpdateNotification(kBulkService)));
+    }
+
+    // Then the message handler of the transport is called for each of them
+    EXPECT_EQ(received_messages, kNumberOfLanes);
+}
+
+TEST_F(MultiLaneTransportFixture, SendsLifecycleMessagesOnEveryLane)
+{
+    // Given a transport with a lane for the bulk and for the small service
+    auto offer_request = CreateOfferServiceRequest(kSmallService);
+
+    // Expecting that the lifecycle message of the small service is sent on every lane
+    for (auto* const lane_mock : lane_mocks_)
+    {
+        EXPECT_CALL(*lane_mock, SendRequest(::testing::Ref(offer_request))).WillOnce(Return(score::ResultBlank{}));
+    }
+
+    // When sending it
+    // Then it is sent successfully
+    EXPECT_TRUE(transport_->SendRequest(offer_request).has_value());
+}
+
+TEST_F(MultiLaneTransportFixture, SendsEachLifecycleMessageWithTheNextBarrierSequence)
+{
+    // Given a transport, whose lanes record the barrier sequence of the messages they send
+    std::array<std::vector<std::uint32_t>, kNumberOfLanes> sent_barrier_sequences{};
+    for (std::size_t lane = 0U; lane < kNumberOfLanes; ++lane)
+    {
+        EXPECT_CALL(*lane_mocks_[lane], SendRequest(_))
+            .Times(2)
+            .WillRepeatedly([&sent_barrier_sequences, lane](TransportMessage& message) {
+                sent_barrier_sequences[lane].push_back(static_cast<LifecycleMessage&>(message).GetBarrierSequence());
+                return score::ResultBlank{};
+            });
+    }
+    auto offer_request = CreateOfferServiceRequest(kSmallService);
+    auto stop_offer_request =
+        StopOfferServiceRequest{impl::InstanceSpecifier::Create(std::string{kSmallService}).value()};
+
+    // When sending two lifecycle messages
+    ASSERT_TRUE(transport_->SendRequest(offer_request).has_value());
+    ASSERT_TRUE(transport_->SendRequest(stop_offer_request).has_value());
+
+    // Then every lane sends them with the same, increasing barrier sequence
+    for (const auto& lane_barrier_sequences : sent_barrier_sequences)
+    {
+        EXPECT_EQ(lane_barrier_sequences, (std::vector<std::uint32_t>{1U, 2U}));
+    }
+}
+
+TEST_F(MultiLaneTransportFixture, SendingLifecycleMessageFailsIfALaneFails)
+{
+    // Given a transport, whose second lane fails to send
+    auto offer_request = CreateOfferServiceRequest(kSmallService);
+    EXPECT_CALL(*lane_mocks_[0], SendRequest(_)).WillOnce(Return(score::ResultBlank{}));
+    EXPECT_CALL(*lane_mocks_[1], SendRequest(_)).WillOnce(Return(MakeUnexpected(TransportErrorc::kNotConnected)));
+
+    // When sending a lifecycle message
+    const auto send_result = transport_->SendRequest(offer_request);
+
+    // Then the error of the lane is returned
+    ASSERT_FALSE(send_result.has_value());
+    EXPECT_EQ(send_result.error(), TransportErrorc::kNotConnected);
+}
+
+TEST_F(MultiLaneTransportFixture, PassesLifecycleMessageOnceAfterItArrivedOnEveryLane)
+{
+    // Given a transport, whose lanes capture the message handler they get
+    std::promise<void> message_handled{};
+    std::size_t received_messages{0U};
+    auto lane_handlers =
+        SetMessageHandler([&received_messages, &message_handled](std::unique_ptr<TransportMessage> message) {
+            EXPECT_EQ(message->GetType(), MessageType::kOfferServiceRequest);
+            ++received_messages;
+            message_handled.set_value();
+        });
+
+    // When the first lane receives a lifecycle message
+    auto first_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[0](std::make_unique<OfferServiceRequest>(CreateOfferServiceRequest(kBulkService)));
+    });
+
+    // Then the first lane waits for the other lane without passing the message on
+    EXPECT_EQ(first_lane_returned.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+
+    // and once the other lane receives it as well, it is passed to the message handler exactly once
+    lane_handlers[1](std::make_unique<OfferServiceRequest>(CreateOfferServiceRequest(kBulkService)));
+    first_lane_returned.wait();
+    EXPECT_EQ(received_messages, 1U);
+}
+
+TEST_F(MultiLaneTransportFixture, ShutdownReleasesLanesWaitingForLifecycleMessage)
+{
+    // Given a transport, whose first lane waits for a lifecycle message to arrive on the other lane
+    std::size_t received_messages{0U};
+    auto lane_handlers = SetMessageHandler([&received_messages](std::unique_ptr<TransportMessage>) {
+        ++received_messages;
+    });
+    auto first_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[0](std::make_unique<OfferServiceRequest>(CreateOfferServiceRequest(kBulkService)));
+    });
+
+    // When shutting down the transport
+    transport_->Shutdown();
+
+    // Then the first lane returns without passing the message on
+    first_lane_returned.wait();
+    EXPECT_EQ(received_messages, 0U);
+}
+
+TEST_F(MultiLaneTransportFixture, DropsPartiallyDeliveredLifecycleMessageOnceTheNextOneArrives)
+{
+    // Given a transport, whose lanes capture the message handler they get
+    std::mutex handled_mutex{};
+    std::vector<MessageType> handled_types{};
+    std::vector<std::uint32_t> handled_barrier_sequences{};
+    auto lane_handlers = SetMessageHandler(
+        [&handled_mutex, &handled_types, &handled_barrier_sequences](std::unique_ptr<TransportMessage> message) {
+            std::lock_guard<std::mutex> lock{handled_mutex};
+            handled_types.push_back(message->GetType());
+            if (message->GetType() == MessageType::kOfferServiceRequest)
+            {
+                handled_barrier_sequences.push_back(static_cast<LifecycleMessage&>(*message).GetBarrierSequence());
+            }
+        });
+
+    // and a lifecycle message, which has only been delivered on the first lane, as sending it on the other one failed
+    auto first_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[0](CreateLifecycleMessage(1U));
+    });
+    EXPECT_EQ(first_lane_returned.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+
+    // When the next lifecycle message arrives on the other lane
+    auto second_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[1](CreateLifecycleMessage(2U));
+    });
+
+    // Then the first lane drops the partially delivered message and continues with its next messages
+    first_lane_returned.wait();
+    lane_handlers[0](std::make_unique<UpdateNotification>(CreateUpdateNotification(kBulkService)));
+
+    // and the next lifecycle message is passed on once, after it arrived on the first lane as well
+    EXPECT_EQ(second_lane_returned.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+    lane_handlers[0](CreateLifecycleMessage(2U));
+    second_lane_returned.wait();
+
+    EXPECT_EQ(handled_types,
+              (std::vector<MessageType>{MessageType::kUpdateNotification, MessageType::kOfferServiceRequest}));
+    EXPECT_EQ(handled_barrier_sequences, (std::vector<std::uint32_t>{2U}));
+}
+
+TEST_F(MultiLaneTransportFixture, DropsStaleCopyOfPartiallyDeliveredLifecycleMessage)
+{
+    // Given a transport, whose second lane waits for the lifecycle message with barrier sequence 2
+    std::size_t received_messages{0U};
+    auto lane_handlers = SetMessageHandler([&received_messages](std::unique_ptr<TransportMessage>) {
+        ++received_messages;
+    });
+    auto second_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[1](CreateLifecycleMessage(2U));
+    });
+    EXPECT_EQ(second_lane_returned.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+
+    // When the first lane receives the previous lifecycle message, which hasn't been delivered on the second lane
+    lane_handlers[0](CreateLifecycleMessage(1U));
+
+    // Then it is dropped without waiting, and the lifecycle message 2 is passed on once it arrived on the first lane
+    EXPECT_EQ(received_messages, 0U);
+    lane_handlers[0](CreateLifecycleMessage(2U));
+    second_lane_returned.wait();
+    EXPECT_EQ(received_messages, 1U);
+}
+
+TEST_F(MultiLaneTransportFixture, DropsLifecycleMessageWhichArrivesOnALaneAgain)
+{
+    // Given a transport, which has passed on a lifecycle message
+    std::size_t received_messages{0U};
+    auto lane_handlers = SetMessageHandler([&received_messages](std::unique_ptr<TransportMessage>) {
+        ++received_messages;
+    });
+    auto first_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[0](CreateLifecycleMessage(1U));
+    });
+    lane_handlers[1](CreateLifecycleMessage(1U));
+    first_lane_returned.wait();
+    ASSERT_EQ(received_messages, 1U);
+
+    // When the same message arrives on a lane again, e.g. as it has been resent after its ACK timed out
+    lane_handlers[1](CreateLifecycleMessage(1U));
+
+    // Then it is dropped without waiting for the other lane
+    EXPECT_EQ(received_messages, 1U);
+}
+
+TEST_F(MultiLaneTransportFixture, LaneReconnectDropsPartiallyDeliveredLifecycleMessage)
+{
+    // Given a transport, whose first lane waits for a lifecycle message to arrive on the other lane
+    std::size_t received_messages{0U};
+    auto lane_handlers = SetMessageHandler([&received_messages](std::unique_ptr<TransportMessage>) {
+        ++received_messages;
+    });
+    std::size_t connections{0U};
+    transport_->SetConnectionHandler([&connections]() {
+        ++connections;
+    });
+    auto first_lane_returned = std::async(std::launch::async, [&lane_handlers]() {
+        lane_handlers[0](CreateLifecycleMessage(1U));
+    });
+    EXPECT_EQ(first_lane_returned.wait_for(std::chrono::milliseconds{50}), std::future_status::timeout);
+
+    // When the other lane reconnects
+    lane_connection_handlers_[1]();
+
+    // Then the first lane returns without passing the message on, and the connection handler is called
+    first_lane_returned.wait();
+    EXPECT_EQ(received_messages, 0U);
+    EXPECT_EQ(connections, 1U);
+
+    // and the next messages of the first lane are passed on again
+    lane_handlers[0](std::make_unique<UpdateNotification>(CreateUpdateNotification(kBulkService)));
+    EXPECT_EQ(received_messages, 1U);
+}
+
+TEST_F(MultiLaneTransportFixture, SetupFailsAndShutsDownAllLanesIfALaneFails)
+{
+    // Given a transport, whose second lane fails to connect
+    EXPECT_CALL(*lane_mocks_[0], Setup()).WillOnce(Return(score::ResultBlank{}));
+    EXPECT_CALL(*lane_mocks_[1], Setup()).WillOnce(Return(MakeUnexpected(TransportErrorc::kConnectionFailure)));
+
+    // Expecting that all lanes get shut down
+    EXPECT_CALL(*lane_mocks_[0], Shutdown()).Times(::testing::AtLeast(1));
+    EXPECT_CALL(*lane_mocks_[1], Shutdown()).Times(::testing::AtLeast(1));
+
+    // When setting up the transport
+    const auto setup_result = transport_->Setup();
+
+    // Then the error of the lane is returned
+    ASSERT_FALSE(setup_result.has_value());
+    EXPECT_EQ(setup_result.error(), TransportErrorc::kConnectionFailure);
+}
+
+TEST_F(MultiLaneTransportFixture, IsOnlyConnectedIfAllLanesAreConnected)
+{
+    // Given a transport, whose first lane is connected and whose second lane is not
+    ON_CALL(*lane_mocks_[0], IsConnected()).WillByDefault(Return(true));
+    ON_CALL(*lane_mocks_[1], IsConnected()).WillByDefault(Return(false));
+
+    // When checking the connection
+    // Then the transport isn't connected
+    EXPECT_FALSE(transport_->IsConnected());
+}
+
+}  // namespace
+}  // namespace score::mw::com::gateway
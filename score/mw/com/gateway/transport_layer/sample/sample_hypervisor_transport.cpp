@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/com/gateway/transport_layer/sample/sample_hypervisor_transport.h"
 
+#include "score/concurrency/simple_task.h"
 #include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
@@ -19,12 +20,25 @@
 #include "score/mw/com/impl/runtime.h"
 #include "score/mw/log/logging.h"
 
+#include <score/utility.hpp>
+
+#include <chrono>
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace score::mw::com::gateway
 {
 
+namespace
+{
+
+// Interval in which pending method calls are checked for an expired deadline.
+constexpr std::chrono::milliseconds kMethodCallTimeoutCheckPeriod{100};
+
+}  // namespace
+
 ShmPaths ResolveShmPaths(const impl::InstanceSpecifier& specifier)
 {
     auto& runtime = impl::Runtime::getInstance();
@@ -90,6 +104,10 @@ score::ResultBlank SampleHyperVisorTransport::Setup()
     message_transport_->SetMessageHandler([this](std::unique_ptr<TransportMessage> message) {
         OnMessageReceived(std::move(message));
     });
+    threads_.Enqueue(score::concurrency::SimpleTaskFactory::Make(score::cpp::pmr::get_default_resource(),
+                                                                 [this](const score::cpp::stop_token stop_token) {
+                                                                     this->MethodCallTimeoutLoop(stop_token);
+                                                                 }));
     return message_transport_->Setup();
 }
 
@@ -125,6 +143,14 @@ void SampleHyperVisorTransport::OnMessageReceived(std::unique_ptr<TransportMessa
     {
         HandleUpdateNotification(std::move(message));
     }
+    else if (message->GetType() == MessageType::kMethodCallRequest)
+    {
+        HandleMethodCallRequest(std::move(message));
+    }
+    else if (message->GetType() == MessageType::kMethodCallResponse)
+    {
+        HandleMethodCallResponse(std::move(message));
+    }
     else
     {
         log::LogError("LoLa") << "SampleTransport: Unexpected TransportMessage received: "
@@ -142,7 +168,7 @@ void SampleHyperVisorTransport::HandleProvideServiceRequest(std::unique_ptr<Tran
         return;
     }
     PreCreateInterVmSharedMemory(specifier_result.value(), request.GetShmControlSize(), request.GetShmDataSize());
-    gateway_app_.ProvideService(specifier_result.value(), request.GetServiceElements());
+    gateway_app_.ProvideService(specifier_result.value(), request.GetServiceElements(), request.GetMethodNames());
 }
 
 void SampleHyperVisorTransport::HandleStopOfferServiceRequest(std::unique_ptr<TransportMessage> message)
@@ -207,18 +233,143 @@ void SampleHyperVisorTransport::HandleUnregisterNotificationRequest(std::unique_
         specifier_result.value(), request.GetElementType(), request.GetElementName());
 }
 
+void SampleHyperVisorTransport::HandleMethodCallRequest(std::unique_ptr<TransportMessage> message)
+{
+    auto& request = dynamic_cast<MethodCallRequest&>(*message);
+    const auto call_id = request.GetCallId();
+    auto specifier_result = impl::InstanceSpecifier::Create(std::string{request.GetInstanceSpecifier()});
+    if (!specifier_result.has_value())
+    {
+        log::LogError("LoLa") << "SampleTransport: Invalid instance specifier in MethodCallRequest!";
+        MethodCallResponse response{call_id, false, {}};
+        score::cpp::ignore = message_transport_->SendNotification(response);
+        return;
+    }
+
+    // The response is sent by the gateway application, when the call has been executed. Meanwhile further messages
+    // (and method calls) are dispatched.
+    const auto call_result = gateway_app_.CallMethod(
+        specifier_result.value(),
+        request.GetMethodName(),
+        request.GetInArgs(),
+        request.GetReturnValueSize(),
+        [this, call_id](score::Result<std::vector<std::uint8_t>> result) noexcept {
+            const bool succeeded = result.has_value();
+            MethodCallResponse response{
+                call_id, succeeded, succeeded ? std::move(result).value() : std::vector<std::uint8_t>{}};
+            const auto send_result = message_transport_->SendNotification(response);
+            if (!send_result.has_value())
+            {
+                log::LogError("LoLa") << "SampleTransport: Failed to send MethodCallResponse for call " << call_id;
+            }
+        });
+    if (!call_result.has_value())
+    {
+        log::LogError("LoLa") << "SampleTransport: Method call " << request.GetMethodName() << " of "
+                              << request.GetInstanceSpecifier() << " couldn't be executed: " << call_result.error();
+        MethodCallResponse response{call_id, false, {}};
+        score::cpp::ignore = message_transport_->SendNotification(response);
+    }
+}
+
+void SampleHyperVisorTransport::HandleMethodCallResponse(std::unique_ptr<TransportMessage> message)
+{
+    auto& response = dynamic_cast<MethodCallResponse&>(*message);
+    auto result_handler = TakePendingMethodCall(response.GetCallId());
+    if (!result_handler.has_value())
+    {
+        log::LogWarn("LoLa") << "SampleTransport: Received MethodCallResponse for unknown call "
+                             << response.GetCallId() << ", which might have timed out already.";
+        return;
+    }
+
+    if (!response.HasSucceeded())
+    {
+        (*result_handler)(MakeUnexpected(TransportErrorc::kRemoteMethodCallFailed));
+        return;
+    }
+    (*result_handler)(response.GetReturnValue());
+}
+
+std::optional<MethodCallResultHandler> SampleHyperVisorTransport::TakePendingMethodCall(const std::uint32_t call_id)
+{
+    std::lock_guard<std::mutex> lock(pending_method_calls_mutex_);
+    const auto pending_call_it = pending_method_calls_.find(call_id);
+    if (pending_call_it == pending_method_calls_.end())
+    {
+        return std::nullopt;
+    }
+    auto result_handler = std::move(pending_call_it->second.result_handler);
+    pending_method_calls_.erase(pending_call_it);
+    return result_handler;
+}
+
+void SampleHyperVisorTransport::MethodCallTimeoutLoop(const score::cpp::stop_token& stop_token)
+{
+    while (!stop_token.stop_requested())
+    {
+        std::vector<MethodCallResultHandler> expired_calls{};
+        {
+            std::unique_lock<std::mutex> lock(pending_method_calls_mutex_);
+            score::cpp::ignore = pending_method_calls_cv_.wait_for(lock, kMethodCallTimeoutCheckPeriod);
+
+            const auto now = std::chrono::steady_clock::now();
+            for (auto pending_call_it = pending_method_calls_.begin(); pending_call_it != pending_method_calls_.end();)
+            {
+                if (pending_call_it->second.deadline <= now)
+                {
+                    expired_calls.push_back(std::move(pending_call_it->second.result_handler));
+                    pending_call_it = pending_method_calls_.erase(pending_call_it);
+                }
+                else
+                {
+                    ++pending_call_it;
+                }
+            }
+        }
+
+        // Handlers are called without holding the lock, as they may forward further calls.
+        for (auto& result_handler : expired_calls)
+        {
+            result_handler(MakeUnexpected(TransportErrorc::kTimeout));
+        }
+    }
+}
+
+void SampleHyperVisorTransport::FailAllPendingMethodCalls(const TransportErrorc error)
+{
+    std::unordered_map<std::uint32_t, PendingMethodCall> pending_calls{};
+    {
+        std::lock_guard<std::mutex> lock(pending_method_calls_mutex_);
+        pending_calls.swap(pending_method_calls_);
+    }
+    for (auto& pending_call : pending_calls)
+    {
+        pending_call.second.result_handler(MakeUnexpected(error));
+    }
+}
+
 void SampleHyperVisorTransport::Shutdown()
 {
     message_transport_->Shutdown();
+
+    pending_method_calls_cv_.notify_all();
+    threads_.Shutdown();
+    // No response can be received anymore.
+    FailAllPendingMethodCalls(TransportErrorc::kNotConnected);
 }
 
 score::ResultBlank SampleHyperVisorTransport::ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                                             std::vector<impl::EventInfo> service_elements)
+                                                             std::vector<impl::EventInfo> service_elements,
+                                                             std::vector<std::string> method_names)
 {
     const auto shm_sizes = GetShmSizes(service_instance_specifier);
 
-    ProvideServiceRequest request{
-        std::move(service_instance_specifier), std::move(service_elements), shm_sizes.control, shm_sizes.data};
+    ProvideServiceRequest request{std::move(service_instance_specifier),
+                                  std::move(service_elements),
+                                  shm_sizes.control,
+                                  shm_sizes.data,
+                                  std::move(method_names)};
     return message_transport_->SendRequest(request);
 }
 
@@ -261,6 +412,37 @@ score::ResultBlank SampleHyperVisorTransport::UnregisterUpdateNotification(
     return message_transport_->SendRequest(request);
 }
 
+score::ResultBlank SampleHyperVisorTransport::CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                                                         std::string method_name,
+                                                         std::vector<std::uint8_t> in_args,
+                                                         std::size_t return_value_size,
+                                                         MethodCallResultHandler result_handler)
+{
+    const auto call_id = next_method_call_id_.fetch_add(1U);
+    {
+        std::lock_guard<std::mutex> lock(pending_method_calls_mutex_);
+        pending_method_calls_.emplace(
+            call_id,
+            PendingMethodCall{std::move(result_handler), std::chrono::steady_clock::now() + kMethodCallTimeout});
+    }
+
+    // Sent as notification: the MethodCallResponse confirms the reception, so that the next call can be sent without
+    // waiting for an ACK.
+    MethodCallRequest request{call_id,
+                              std::move(service_instance_specifier),
+                              std::move(method_name),
+                              static_cast<std::uint32_t>(return_value_size),
+                              std::move(in_args)};
+    const auto send_result = message_transport_->SendNotification(request);
+    if (!send_result.has_value())
+    {
+        // The result_handler must not be called, if the call hasn't been sent.
+        score::cpp::ignore = TakePendingMethodCall(call_id);
+        return send_result;
+    }
+    return {};
+}
+
 void SampleHyperVisorTransport::PreCreateInterVmSharedMemory(const impl::InstanceSpecifier& specifier,
                                                              std::uint32_t /* shm_control_size */,
                                                              std::uint32_t /* shm_data_size */)
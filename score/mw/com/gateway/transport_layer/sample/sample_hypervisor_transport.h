@@ -13,11 +13,20 @@
 #ifndef SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_HYPERVISOR_TRANSPORT_H_
 #define SCORE_MW_COM_GATEWAY_TRANSPORT_LAYER_SAMPLE_HYPERVISOR_TRANSPORT_H_
 
+#include "score/concurrency/long_running_threads_container.h"
 #include "score/mw/com/gateway/gateway_application/gateway_core.h"
 #include "score/mw/com/gateway/transport_layer/sample/i_bidirectional_transport.h"
 #include "score/mw/com/gateway/transport_layer/transport.h"
+#include "score/mw/com/gateway/transport_layer/transport_error.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 namespace score::mw::com::gateway
 {
@@ -57,7 +66,8 @@ class SampleHyperVisorTransport : public Transport
     // Methods to create the related TransportMessage and call SendMessage of BidirectionalTransport
 
     Result<void> ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                std::vector<impl::EventInfo> service_elements) override;
+                                std::vector<impl::EventInfo> service_elements,
+                                std::vector<std::string> method_names) override;
     Result<void> OfferService(impl::InstanceSpecifier service_instance_specifier) override;
     Result<void> StopOfferService(impl::InstanceSpecifier service_instance_specifier) override;
 
@@ -71,7 +81,36 @@ class SampleHyperVisorTransport : public Transport
                                               impl::ServiceElementType element_type,
                                               std::string element_name) override;
 
+    /// \brief Sends a MethodCallRequest without waiting for the response. The result_handler is called, when the
+    /// related MethodCallResponse has been received, kMethodCallTimeout has expired or on Shutdown().
+    Result<void> CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                            std::string method_name,
+                            std::vector<std::uint8_t> in_args,
+                            std::size_t return_value_size,
+                            MethodCallResultHandler result_handler) override;
+
+    static constexpr std::chrono::milliseconds kMethodCallTimeout{5000};
+
   private:
+    struct PendingMethodCall
+    {
+        MethodCallResultHandler result_handler;
+        std::chrono::steady_clock::time_point deadline;
+    };
+
+    void HandleMethodCallRequest(std::unique_ptr<TransportMessage> message);
+
+    void HandleMethodCallResponse(std::unique_ptr<TransportMessage> message);
+
+    /// \brief Completes pending method calls, whose deadline has expired, with kTimeout until stopped.
+    void MethodCallTimeoutLoop(const score::cpp::stop_token& stop_token);
+
+    /// \brief Removes the pending method call with the given id and returns its result handler, if it is still pending.
+    std::optional<MethodCallResultHandler> TakePendingMethodCall(std::uint32_t call_id);
+
+    /// \brief Completes all pending method calls with the given error.
+    void FailAllPendingMethodCalls(TransportErrorc error);
+
     void HandleProvideServiceRequest(std::unique_ptr<TransportMessage> message);
 
     void HandleStopOfferServiceRequest(std::unique_ptr<TransportMessage> message);
@@ -98,6 +137,15 @@ class SampleHyperVisorTransport : public Transport
 
     GatewayCore& gateway_app_;
     std::unique_ptr<IBidirectionalTransport> message_transport_;
+
+    // Method calls forwarded by this side, which wait for their MethodCallResponse, indexed by their call id.
+    std::unordered_map<std::uint32_t, PendingMethodCall> pending_method_calls_;
+    std::mutex pending_method_calls_mutex_;
+    std::condition_variable pending_method_calls_cv_;
+    std::atomic<std::uint32_t> next_method_call_id_{0U};
+
+    // Intentionally keeping at the end to ensure that it's destroyed first during shutdown.
+    score::concurrency::LongRunningThreadsContainer threads_;
 };
 
 }  // namespace score::mw::com::gateway
@@ -22,7 +22,10 @@
 #include "score/mw/log/recorder_mock.h"
 
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <iostream>
+#include <optional>
+#include <vector>
 
 namespace score::mw::com::gateway
 {
@@ -356,7 +359,7 @@ TEST_F(SampleHyperVisorTransportTest,
 
     // Then ProvideService should be called on the gateway core with the matching instance specifier and service
     // elements
-    EXPECT_CALL(gateway_core_mock_, ProvideService(::testing::_, ::testing::_))
+    EXPECT_CALL(gateway_core_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_))
         .WillOnce(::testing::Return(score::ResultBlank{}));
 
     // Invoke the captured handler to trigger OnMessageReceived
@@ -375,7 +378,7 @@ TEST_F(SampleHyperVisorTransportTest,
     auto request = CreateMessageOfType(MessageType::kProvideServiceRequest, false);
 
     // Then ProvideService should not be called
-    EXPECT_CALL(gateway_core_mock_, ProvideService(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(gateway_core_mock_, ProvideService(::testing::_, ::testing::_, ::testing::_)).Times(0);
 
     // Invoke the captured handler to trigger OnMessageReceived
     captured_handler_(std::move(request));
@@ -574,6 +577,209 @@ TEST_F(SampleHyperVisorTransportTest,
     captured_handler_(std::move(request));
 }
 
+TEST_F(SampleHyperVisorTransportTest, CallMethodSendsMethodCallRequestWithoutWaitingForResponse)
+{
+    // Given a SampleHyperVisorTransport with a mocked BidirectionalTransport and a valid instance specifier
+    this->WithASampleHyperVisorTransport();
+    const auto specifier = CreateValidInstanceSpecifier();
+
+    // Then a MethodCallRequest is sent as notification, i.e. without waiting for an ACK
+    EXPECT_CALL(*bi_directional_transport_mock_,
+                SendNotification(::testing::Property(&TransportMessage::GetType, MessageType::kMethodCallRequest)))
+        .WillOnce(::testing::Return(score::ResultBlank{}));
+
+    // When calling CallMethod
+    bool handler_called{false};
+    const auto result = transport_->CallMethod(
+        specifier, "SetSpeed", {1U, 2U}, 4U, [&handler_called](score::Result<std::vector<std::uint8_t>>) noexcept {
+            handler_called = true;
+        });
+
+    // Then the call has been sent, but the result handler is not called before the response has been received
+    EXPECT_TRUE(result.has_value());
+    EXPECT_FALSE(handler_called);
+
+    // Shutting down completes the pending call, before handler_called goes out of scope
+    transport_->Shutdown();
+}
+
+TEST_F(SampleHyperVisorTransportTest, MethodCallResponseCallsResultHandlerOfPendingCall)
+{
+    // Given a SampleHyperVisorTransport, whose message handler callback has been set
+    this->WithASampleHyperVisorTransport().WithARegisteredOnSetupCallback();
+
+    // and a method call, which has been sent
+    std::uint32_t call_id{0U};
+    EXPECT_CALL(*bi_directional_transport_mock_, SendNotification(::testing::_))
+        .WillOnce([&call_id](TransportMessage& message) {
+            call_id = dynamic_cast<MethodCallRequest&>(message).GetCallId();
+            return score::ResultBlank{};
+        });
+    std::optional<score::Result<std::vector<std::uint8_t>>> call_result{};
+    ASSERT_TRUE(transport_
+                    ->CallMethod(CreateValidInstanceSpecifier(),
+                                 "SetSpeed",
+                                 {},
+                                 2U,
+                                 [&call_result](score::Result<std::vector<std::uint8_t>> result) noexcept {
+                                     call_result = std::move(result);
+                                 })
+                    .has_value());
+
+    // When the MethodCallResponse for the call is received
+    captured_handler_(std::make_unique<MethodCallResponse>(call_id, true, std::vector<std::uint8_t>{7U, 8U}));
+
+    // Then the result handler is called with the return value
+    ASSERT_TRUE(call_result.has_value());
+    ASSERT_TRUE(call_result->has_value());
+    EXPECT_EQ(call_result->value(), (std::vector<std::uint8_t>{7U, 8U}));
+}
+
+TEST_F(SampleHyperVisorTransportTest, FailedMethodCallResponseCallsResultHandlerWithError)
+{
+    // Given a SampleHyperVisorTransport, whose message handler callback has been set
+    this->WithASampleHyperVisorTransport().WithARegisteredOnSetupCallback();
+
+    // and a method call, which has been sent
+    std::uint32_t call_id{0U};
+    EXPECT_CALL(*bi_directional_transport_mock_, SendNotification(::testing::_))
+        .WillOnce([&call_id](TransportMessage& message) {
+            call_id = dynamic_cast<MethodCallRequest&>(message).GetCallId();
+            return score::ResultBlank{};
+        });
+    std::optional<score::Result<std::vector<std::uint8_t>>> call_result{};
+    ASSERT_TRUE(transport_
+                    ->CallMethod(CreateValidInstanceSpecifier(),
+                                 "SetSpeed",
+                                 {},
+                                 2U,
+                                 [&call_result](score::Result<std::vector<std::uint8_t>> result) noexcept {
+                                     call_result = std::move(result);
+                                 })
+                    .has_value());
+
+    // When a MethodCallResponse reporting a failure is received
+    captured_handler_(std::make_unique<MethodCallResponse>(call_id, false, std::vector<std::uint8_t>{}));
+
+    // Then the result handler is called with kRemoteMethodCallFailed
+    ASSERT_TRUE(call_result.has_value());
+    ASSERT_FALSE(call_result->has_value());
+    EXPECT_EQ(call_result->error(), TransportErrorc::kRemoteMethodCallFailed);
+}
+
+TEST_F(SampleHyperVisorTransportTest, CallMethodReturnsErrorWithoutCallingResultHandlerIfSendFails)
+{
+    // Given a SampleHyperVisorTransport, whose BidirectionalTransport fails to send
+    this->WithASampleHyperVisorTransport();
+    EXPECT_CALL(*bi_directional_transport_mock_, SendNotification(::testing::_))
+        .WillOnce(::testing::Return(score::MakeUnexpected(TransportErrorc::kNotConnected)));
+
+    // When calling CallMethod
+    bool handler_called{false};
+    const auto result = transport_->CallMethod(CreateValidInstanceSpecifier(),
+                                               "SetSpeed",
+                                               {},
+                                               0U,
+                                               [&handler_called](score::Result<std::vector<std::uint8_t>>) noexcept {
+                                                   handler_called = true;
+                                               });
+
+    // Then an error is returned and the result handler is neither called now nor on shutdown
+    EXPECT_FALSE(result.has_value());
+    transport_->Shutdown();
+    EXPECT_FALSE(handler_called);
+}
+
+TEST_F(SampleHyperVisorTransportTest, PendingMethodCallsAreFailedOnShutdown)
+{
+    // Given a SampleHyperVisorTransport with a method call, which has been sent
+    this->WithASampleHyperVisorTransport();
+    EXPECT_CALL(*bi_directional_transport_mock_, SendNotification(::testing::_))
+        .WillOnce(::testing::Return(score::ResultBlank{}));
+    std::optional<score::Result<std::vector<std::uint8_t>>> call_result{};
+    ASSERT_TRUE(transport_
+                    ->CallMethod(CreateValidInstanceSpecifier(),
+                                 "SetSpeed",
+                                 {},
+                                 0U,
+                                 [&call_result](score::Result<std::vector<std::uint8_t>> result) noexcept {
+                                     call_result = std::move(result);
+                                 })
+                    .has_value());
+
+    // When shutting down the transport
+    transport_->Shutdown();
+
+    // Then the result handler is called with kNotConnected
+    ASSERT_TRUE(call_result.has_value());
+    ASSERT_FALSE(call_result->has_value());
+    EXPECT_EQ(call_result->error(), TransportErrorc::kNotConnected);
+}
+
+TEST_F(SampleHyperVisorTransportTest, OnMessageReceivedMethodCallRequestCallsCallMethodOnGatewayCoreAndSendsResponse)
+{
+    // Given a SampleHyperVisorTransport, whose message handler callback has been set
+    this->WithASampleHyperVisorTransport().WithARegisteredOnSetupCallback();
+
+    // Expecting, that CallMethod is called on the gateway core, which calls the result handler
+    EXPECT_CALL(gateway_core_mock_,
+                CallMethod(::testing::_, std::string{"SetSpeed"}, std::vector<std::uint8_t>{1U}, 2U, ::testing::_))
+        .WillOnce([](impl::InstanceSpecifier,
+                     std::string,
+                     std::vector<std::uint8_t>,
+                     std::size_t,
+                     MethodCallResultHandler&& result_handler) {
+            result_handler(std::vector<std::uint8_t>{3U, 4U});
+            return score::ResultBlank{};
+        });
+
+    // and that a MethodCallResponse with the call id and the return value is sent
+    std::optional<MethodCallResponse> sent_response{};
+    EXPECT_CALL(*bi_directional_transport_mock_,
+                SendNotification(::testing::Property(&TransportMessage::GetType, MessageType::kMethodCallResponse)))
+        .WillOnce([&sent_response](TransportMessage& message) {
+            const auto& response = dynamic_cast<MethodCallResponse&>(message);
+            sent_response.emplace(response.GetCallId(), response.HasSucceeded(), response.GetReturnValue());
+            return score::ResultBlank{};
+        });
+
+    // When a MethodCallRequest is received
+    captured_handler_(std::make_unique<MethodCallRequest>(
+        42U, CreateValidInstanceSpecifier(), "SetSpeed", 2U, std::vector<std::uint8_t>{1U}));
+
+    // Then the response belongs to the call and contains the return value
+    ASSERT_TRUE(sent_response.has_value());
+    EXPECT_EQ(sent_response->GetCallId(), 42U);
+    EXPECT_TRUE(sent_response->HasSucceeded());
+    EXPECT_EQ(sent_response->GetReturnValue(), (std::vector<std::uint8_t>{3U, 4U}));
+}
+
+TEST_F(SampleHyperVisorTransportTest, OnMessageReceivedMethodCallRequestSendsFailedResponseIfCallCannotBeScheduled)
+{
+    // Given a SampleHyperVisorTransport, whose message handler callback has been set
+    this->WithASampleHyperVisorTransport().WithARegisteredOnSetupCallback();
+
+    // Expecting, that the gateway core can't schedule the call
+    EXPECT_CALL(gateway_core_mock_, CallMethod(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(score::MakeUnexpected(TransportErrorc::kNotSupported)));
+
+    // and that a failed MethodCallResponse is sent
+    bool response_succeeded{true};
+    EXPECT_CALL(*bi_directional_transport_mock_,
+                SendNotification(::testing::Property(&TransportMessage::GetType, MessageType::kMethodCallResponse)))
+        .WillOnce([&response_succeeded](TransportMessage& message) {
+            response_succeeded = dynamic_cast<MethodCallResponse&>(message).HasSucceeded();
+            return score::ResultBlank{};
+        });
+
+    // When a MethodCallRequest is received
+    captured_handler_(std::make_unique<MethodCallRequest>(
+        1U, CreateValidInstanceSpecifier(), "SetSpeed", 0U, std::vector<std::uint8_t>{}));
+
+    // Then the response reports the failure
+    EXPECT_FALSE(response_succeeded);
+}
+
 TEST_F(SampleHyperVisorTransportTest, UnsupportedMessageWillBeLogged)
 {
     // Given a SampleHyperVisorTransport, a mocked runtime and a message handler callback has been set for the
@@ -622,7 +828,7 @@ TEST_F(SampleHyperVisorTransportTest, ProvideServiceDeathTest)
     // When calling ProvideService with a valid instance specifier, then it is expected to terminate.
     // TODO This test needs to be adapted when implementing ResolveShmPaths() and GetShmSizes() based on the actual
     // HyperVisor SHM technology.
-    EXPECT_DEATH(transport_->ProvideService(CreateValidInstanceSpecifier(), std::vector<impl::EventInfo>{}), ".*");
+    EXPECT_DEATH(transport_->ProvideService(CreateValidInstanceSpecifier(), std::vector<impl::EventInfo>{}, {}), ".*");
 }
 
 }  // namespace
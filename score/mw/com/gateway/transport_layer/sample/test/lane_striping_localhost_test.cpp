@@ -0,0 +1,214 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/transport_layer/sample/configuration/hypervisor_socket_configuration.h"
+#include "score/mw/com/gateway/transport_layer/sample/messages/gateway_messages.h"
+#include "score/mw/com/gateway/transport_layer/sample/multi_lane_transport.h"
+#include "score/mw/com/impl/instance_specifier.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::gateway
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto kBulkService = "BulkService/Instance1";
+constexpr auto kSmallService = "SmallService/Instance1";
+constexpr std::size_t kBulkMessages{2000U};
+constexpr std::size_t kBulkPayloadSize{900U};
+constexpr std::chrono::microseconds kBulkProcessingTime{50};
+constexpr std::size_t kSmallMessages{100U};
+constexpr std::chrono::milliseconds kSmallMessagePeriod{1};
+constexpr std::chrono::seconds kMaxTestDuration{30};
+
+HyperVisorSocketConfiguration CreateConfiguration(const std::uint16_t local_port,
+                                                  const std::uint16_t remote_port,
+                                                  const std::uint16_t number_of_lanes)
+{
+    HyperVisorSocketConfiguration config{};
+    config.remote_ip_ = score::os::Ipv4Address{"127.0.0.1"};
+    config.local_port_ = local_port;
+    config.remote_port_ = remote_port;
+    config.number_of_lanes_ = number_of_lanes;
+    if (number_of_lanes > 1U)
+    {
+        config.lane_mapping_[{kBulkService, ""}] = 0U;
+        config.lane_mapping_[{kSmallService, ""}] = 1U;
+    }
+    return config;
+}
+
+/// \brief Latencies of the small messages received on the destination side.
+struct SmallMessageLatencies
+{
+    std::mutex mutex{};
+    std::condition_variable all_received{};
+    std::vector<Clock::time_point> send_times = std::vector<Clock::time_point>(kSmallMessages);
+    std::vector<Clock::duration> latencies{};
+};
+
+/// \brief Source and destination side of a gateway link over the sample TCP transport on localhost. The source side
+/// streams bulk messages of one service, whose processing on the destination side takes kBulkProcessingTime each, like
+/// copying a large sample. Meanwhile it sends small update notifications of another service, whose latency is measured.
+class LaneStripingLocalhostFixture : public ::testing::Test
+{
+  protected:
+    void SetUpLink(const std::uint16_t source_port, const std::uint16_t destination_port, const std::uint16_t lanes)
+    {
+        source_transport_ = MultiLaneTransport::Create(CreateConfiguration(source_port, destination_port, lanes));
+        destination_transport_ = MultiLaneTransport::Create(CreateConfiguration(destination_port, source_port, lanes));
+        destination_transport_->SetMessageHandler([this](std::unique_ptr<TransportMessage> message) {
+            OnDestinationMessage(std::move(message));
+        });
+
+        // Setup() blocks until the connection is established, so both sides have to be set up concurrently.
+        auto source_setup = std::async(std::launch::async, [this]() {
+            return source_transport_->Setup();
+        });
+        ASSERT_TRUE(destination_transport_->Setup().has_value());
+        ASSERT_TRUE(source_setup.get().has_value());
+    }
+
+    void TearDown() override
+    {
+        if (destination_transport_ != nullptr)
+        {
+            destination_transport_->Shutdown();
+        }
+        if (source_transport_ != nullptr)
+        {
+            source_transport_->Shutdown();
+        }
+    }
+
+    void OnDestinationMessage(std::unique_ptr<TransportMessage> message)
+    {
+        if (message->GetType() == MessageType::kMethodCallRequest)
+        {
+            const auto processing_end = Clock::now() + kBulkProcessingTime;
+            while (Clock::now() < processing_end)
+            {
+            }
+            return;
+        }
+
+        const auto receive_time = Clock::now();
+        const auto& notification = dynamic_cast<const UpdateNotification&>(*message);
+        const auto index = std::stoul(notification.GetElementName());
+        std::lock_guard<std::mutex> lock{small_messages_.mutex};
+        small_messages_.latencies.push_back(receive_time - small_messages_.send_times.at(index));
+        if (small_messages_.latencies.size() == kSmallMessages)
+        {
+            small_messages_.all_received.notify_all();
+        }
+    }
+
+    /// \brief Streams the bulk messages in a background thread and sends the small messages meanwhile.
+    void RunTraffic()
+    {
+        const auto bulk_specifier = impl::InstanceSpecifier::Create(std::string{kBulkService}).value();
+        const auto small_specifier = impl::InstanceSpecifier::Create(std::string{kSmallService}).value();
+
+        auto bulk_stream = std::async(std::launch::async, [this, &bulk_specifier]() {
+            for (std::size_t call_id = 0U; call_id < kBulkMessages; ++call_id)
+            {
+                MethodCallRequest request{static_cast<std::uint32_t>(call_id),
+                                          bulk_specifier,
+                                          "Bulk",
+                                          0U,
+                                          std::vector<std::uint8_t>(kBulkPayloadSize, 0xA5U)};
+                if (!source_transport_->SendNotification(request).has_value())
+                {
+                    return false;
+                }
+            }
+            return true;
+        });
+
+        for (std::size_t index = 0U; index < kSmallMessages; ++index)
+        {
+            UpdateNotification notification{small_specifier, impl::ServiceElementType::EVENT, std::to_string(index)};
+            {
+                std::lock_guard<std::mutex> lock{small_messages_.mutex};
+                small_messages_.send_times.at(index) = Clock::now();
+            }
+            ASSERT_TRUE(source_transport_->SendNotification(notification).has_value());
+            std::this_thread::sleep_for(kSmallMessagePeriod);
+        }
+        ASSERT_TRUE(bulk_stream.get());
+
+        // Then all small messages are received
+        std::unique_lock<std::mutex> lock{small_messages_.mutex};
+        ASSERT_TRUE(small_messages_.all_received.wait_for(lock, kMaxTestDuration, [this]() {
+            return small_messages_.latencies.size() == kSmallMessages;
+        }));
+    }
+
+    void RecordLatencies()
+    {
+        std::lock_guard<std::mutex> lock{small_messages_.mutex};
+        auto& latencies = small_messages_.latencies;
+        std::sort(latencies.begin(), latencies.end());
+        const auto to_us = [](const Clock::duration duration) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        };
+        RecordProperty("small_latency_median_us", std::to_string(to_us(latencies.at(latencies.size() / 2U))));
+        RecordProperty("small_latency_p99_us", std::to_string(to_us(latencies.at((latencies.size() * 99U) / 100U))));
+        RecordProperty("small_latency_max_us", std::to_string(to_us(latencies.back())));
+    }
+
+    std::unique_ptr<IBidirectionalTransport> source_transport_{};
+    std::unique_ptr<IBidirectionalTransport> destination_transport_{};
+    SmallMessageLatencies small_messages_{};
+};
+
+TEST_F(LaneStripingLocalhostFixture, SmallMessageLatencyBehindBulkStreamOnOneLane)
+{
+    // Given a gateway link over localhost with a single lane
+    SetUpLink(19420U, 19421U, 1U);
+
+    // When small messages are sent, while a bulk stream is sent on the same lane
+    RunTraffic();
+
+    // Then the small messages wait behind the bulk messages sent before them
+    RecordLatencies();
+}
+
+TEST_F(LaneStripingLocalhostFixture, SmallMessageLatencyBesideBulkStreamOnTwoLanes)
+{
+    // Given a gateway link over localhost with a lane for the bulk and one for the small service
+    SetUpLink(19430U, 19440U, 2U);
+
+    // When small messages are sent, while a bulk stream is sent on the other lane
+    RunTraffic();
+
+    // Then the small messages are delivered independent of the bulk stream
+    RecordLatencies();
+}
+
+}  // namespace
+}  // namespace score::mw::com::gateway
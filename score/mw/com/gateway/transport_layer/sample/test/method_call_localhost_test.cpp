@@ -0,0 +1,185 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/gateway/gateway_application/gateway_core_mock.h"
+#include "score/mw/com/gateway/transport_layer/sample/bidirectional_transport.h"
+#include "score/mw/com/gateway/transport_layer/sample/configuration/hypervisor_socket_configuration.h"
+#include "score/mw/com/gateway/transport_layer/sample/sample_hypervisor_transport.h"
+#include "score/mw/com/impl/instance_specifier.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::gateway
+{
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+constexpr std::uint16_t kSourcePort{19410U};
+constexpr std::uint16_t kDestinationPort{19411U};
+constexpr std::size_t kInArgsSize{64U};
+constexpr std::size_t kSequentialCalls{1000U};
+constexpr std::size_t kPipelinedCalls{10000U};
+constexpr std::chrono::seconds kMaxTestDuration{30};
+
+HyperVisorSocketConfiguration CreateConfiguration(const std::uint16_t local_port, const std::uint16_t remote_port)
+{
+    HyperVisorSocketConfiguration config{};
+    config.remote_ip_ = score::os::Ipv4Address{"127.0.0.1"};
+    config.local_port_ = local_port;
+    config.remote_port_ = remote_port;
+    return config;
+}
+
+/// \brief Source and destination side of a gateway link over the sample TCP transport on localhost. The source side
+/// gateway core executes each forwarded method call immediately by returning the in-arguments as return value, so that
+/// only the transport is measured.
+class MethodCallLocalhostFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        ON_CALL(source_core_, CallMethod(::testing::_, ::testing::_, ::testing::_, ::testing::_, ::testing::_))
+            .WillByDefault([](impl::InstanceSpecifier,
+                              std::string,
+                              std::vector<std::uint8_t> in_args,
+                              std::size_t,
+                              MethodCallResultHandler&& result_handler) {
+                result_handler(std::move(in_args));
+                return score::ResultBlank{};
+            });
+
+        source_transport_ = std::make_unique<SampleHyperVisorTransport>(
+            source_core_,
+            std::make_unique<BidirectionalTransport>(CreateConfiguration(kSourcePort, kDestinationPort)));
+        destination_transport_ = std::make_unique<SampleHyperVisorTransport>(
+            destination_core_,
+            std::make_unique<BidirectionalTransport>(CreateConfiguration(kDestinationPort, kSourcePort)));
+
+        // Setup() blocks until the connection is established, so both sides have to be set up concurrently.
+        auto source_setup = std::async(std::launch::async, [this]() {
+            return source_transport_->Setup();
+        });
+        ASSERT_TRUE(destination_transport_->Setup().has_value());
+        ASSERT_TRUE(source_setup.get().has_value());
+    }
+
+    void TearDown() override
+    {
+        destination_transport_->Shutdown();
+        source_transport_->Shutdown();
+    }
+
+    score::Result<void> CallMethod(MethodCallResultHandler result_handler)
+    {
+        return destination_transport_->CallMethod(
+            instance_specifier_, "Echo", in_args_, in_args_.size(), std::move(result_handler));
+    }
+
+    ::testing::NiceMock<GatewayCoreMock> source_core_{};
+    ::testing::NiceMock<GatewayCoreMock> destination_core_{};
+    std::unique_ptr<SampleHyperVisorTransport> source_transport_{};
+    std::unique_ptr<SampleHyperVisorTransport> destination_transport_{};
+    impl::InstanceSpecifier instance_specifier_{
+        impl::InstanceSpecifier::Create(std::string{"EchoService/Instance1"}).value()};
+    std::vector<std::uint8_t> in_args_ = std::vector<std::uint8_t>(kInArgsSize, 0xA5U);
+};
+
+TEST_F(MethodCallLocalhostFixture, SequentialCallLatency)
+{
+    // Given a gateway link over localhost
+
+    // When calling a method sequentially, i.e. waiting for the result before the next call
+    std::vector<Clock::duration> latencies{};
+    latencies.reserve(kSequentialCalls);
+    for (std::size_t call = 0U; call < kSequentialCalls; ++call)
+    {
+        auto result_promise = std::make_shared<std::promise<score::Result<std::vector<std::uint8_t>>>>();
+        auto result_future = result_promise->get_future();
+        const auto start = Clock::now();
+        ASSERT_TRUE(CallMethod([result_promise](score::Result<std::vector<std::uint8_t>> result) noexcept {
+                        result_promise->set_value(std::move(result));
+                    }).has_value());
+        ASSERT_EQ(result_future.wait_for(kMaxTestDuration), std::future_status::ready);
+        latencies.push_back(Clock::now() - start);
+
+        // Then each call returns the in-arguments
+        const auto result = result_future.get();
+        ASSERT_TRUE(result.has_value());
+        ASSERT_EQ(result.value(), in_args_);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto to_us = [](const Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    };
+    RecordProperty("latency_median_us", std::to_string(to_us(latencies.at(latencies.size() / 2U))));
+    RecordProperty("latency_p99_us", std::to_string(to_us(latencies.at((latencies.size() * 99U) / 100U))));
+    RecordProperty("latency_max_us", std::to_string(to_us(latencies.back())));
+}
+
+TEST_F(MethodCallLocalhostFixture, PipelinedCallThroughput)
+{
+    // Given a gateway link over localhost
+
+    // When sending many calls without waiting for the results of the previous ones
+    // The state is shared with the result handlers, as they may still be called on shutdown if the test fails.
+    struct PipelineState
+    {
+        std::atomic<std::size_t> succeeded_calls{0U};
+        std::atomic<std::size_t> completed_calls{0U};
+        std::promise<void> all_completed{};
+    };
+    auto state = std::make_shared<PipelineState>();
+    auto all_completed = state->all_completed.get_future();
+    const auto start = Clock::now();
+    for (std::size_t call = 0U; call < kPipelinedCalls; ++call)
+    {
+        ASSERT_TRUE(CallMethod([this, state](score::Result<std::vector<std::uint8_t>> result) noexcept {
+                        if (result.has_value() && (result.value() == in_args_))
+                        {
+                            state->succeeded_calls.fetch_add(1U);
+                        }
+                        if ((state->completed_calls.fetch_add(1U) + 1U) == kPipelinedCalls)
+                        {
+                            state->all_completed.set_value();
+                        }
+                    }).has_value());
+    }
+
+    // Then all calls complete successfully
+    ASSERT_EQ(all_completed.wait_for(kMaxTestDuration), std::future_status::ready);
+    const auto duration = Clock::now() - start;
+    EXPECT_EQ(state->succeeded_calls.load(), kPipelinedCalls);
+
+    const auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    const auto calls_per_second = (static_cast<double>(kPipelinedCalls) * 1'000'000.0) /
+                                  static_cast<double>(std::max<std::int64_t>(duration_us, 1));
+    RecordProperty("pipelined_calls", std::to_string(kPipelinedCalls));
+    RecordProperty("pipelined_duration_us", std::to_string(duration_us));
+    RecordProperty("calls_per_second", std::to_string(static_cast<std::int64_t>(calls_per_second)));
+}
+
+}  // namespace
+}  // namespace score::mw::com::gateway
@@ -18,12 +18,20 @@
 #include "score/mw/com/impl/service_element_type.h"
 #include "score/result/result.h"
 
+#include <score/callback.hpp>
+
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace score::mw::com::gateway
 {
 
+/// \brief Handler, which receives the serialized return value of a forwarded method call or the error, why the call
+/// failed.
+using MethodCallResultHandler = score::cpp::callback<void(score::Result<std::vector<std::uint8_t>>), 64U>;
+
 /// \brief Abstract base class for gateway transport layer implementations.
 class Transport
 {
@@ -50,11 +58,14 @@ class Transport
     /// shared memory is visible/accessible on the destination gateway side, when the (generic) skeleton gets created.
     /// \param service_instance_specifier instance specifier of the service to provide. It is expected, that this
     /// specifier is configured/existent in the mw_com_config.json at the destination gateway side.
-    /// \param service_elements configuration of the service elements (events, fields, methods) of the service to
-    /// provide. This information is needed to create the (generic) skeleton on the destination gateway side.
+    /// \param service_elements configuration of the events of the service to provide. This information is needed to
+    /// create the (generic) skeleton on the destination gateway side.
+    /// \param method_names names of the methods of the service to provide. Calls to these methods on the destination
+    /// gateway side are forwarded via CallMethod() to the source gateway.
     /// \return result indicating success or failure.
     virtual score::Result<void> ProvideService(impl::InstanceSpecifier service_instance_specifier,
-                                               std::vector<impl::EventInfo> service_elements) = 0;
+                                               std::vector<impl::EventInfo> service_elements,
+                                               std::vector<std::string> method_names) = 0;
 
     /// \brief OfferService API to trigger service-instance offering at the destination gateway side.
     /// \details Transport layer implementation shall "forward" this call to the destination gateway and trigger the
@@ -114,6 +125,23 @@ class Transport
     virtual score::Result<void> UnregisterUpdateNotification(impl::InstanceSpecifier service_instance_specifier,
                                                              impl::ServiceElementType element_type,
                                                              std::string element_name) = 0;
+
+    /// \brief API to forward a method call to the source gateway, which calls the method of the service instance.
+    /// \details The transport layer implementation shall "forward" this call to the source gateway and call the
+    /// result_handler, when the result has been received. The call is asynchronous, i.e. it shall return without
+    /// waiting for the result, so that many calls can be in flight on a link at the same time. The result_handler shall
+    /// be called exactly once, also if the call times out or the transport is shut down.
+    /// \param service_instance_specifier instance specifier of the service instance owning the method.
+    /// \param method_name name of the method to call.
+    /// \param in_args serialized in-arguments of the call as stored by mw::com in the shared memory of the caller.
+    /// \param return_value_size size of the return value in bytes. 0, if the method returns void.
+    /// \param result_handler handler, which receives the serialized return value or the error.
+    /// \return result indicating whether the call has been sent. If not, result_handler won't be called.
+    virtual score::Result<void> CallMethod(impl::InstanceSpecifier service_instance_specifier,
+                                           std::string method_name,
+                                           std::vector<std::uint8_t> in_args,
+                                           std::size_t return_value_size,
+                                           MethodCallResultHandler result_handler) = 0;
 };
 
 }  // namespace score::mw::com::gateway
@@ -33,6 +33,7 @@ enum class TransportErrorc : score::result::ErrorCode
     kNotSupported,
     kSendFailure,
     kReceiveFailure,
+    kRemoteMethodCallFailed,
 };
 
 score::result::Error MakeError(const TransportErrorc code, const std::string_view message = "");
@@ -66,6 +67,8 @@ class TransportErrorDomain final : public score::result::ErrorDomain
                 return "Failed to send message.";
             case static_cast<score::result::ErrorCode>(TransportErrorc::kReceiveFailure):
                 return "Failed to receive message.";
+            case static_cast<score::result::ErrorCode>(TransportErrorc::kRemoteMethodCallFailed):
+                return "Forwarded method call failed at the remote side.";
             default:
                 return "unknown transport error";
         }
@@ -87,6 +87,11 @@ TEST_F(TransportErrorTest, MessageForReceiveFailure)
     TestErrorMessage(TransportErrorc::kReceiveFailure, "Failed to receive message.");
 }
 
+TEST_F(TransportErrorTest, MessageForRemoteMethodCallFailed)
+{
+    TestErrorMessage(TransportErrorc::kRemoteMethodCallFailed, "Forwarded method call failed at the remote side.");
+}
+
 TEST_F(TransportErrorTest, MessageForDefault)
 {
     TestErrorMessage(static_cast<TransportErrorc>(-1), "unknown transport error");
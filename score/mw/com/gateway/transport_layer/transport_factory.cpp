@@ -12,8 +12,8 @@
  *******************************************************************************/
 #include "score/mw/com/gateway/transport_layer/transport_factory.h"
 
-#include "score/mw/com/gateway/transport_layer/sample/bidirectional_transport.h"
 #include "score/mw/com/gateway/transport_layer/sample/configuration/sample_transport_config_parser.h"
+#include "score/mw/com/gateway/transport_layer/sample/multi_lane_transport.h"
 #include "score/mw/com/gateway/transport_layer/sample/sample_hypervisor_transport.h"
 
 #include <cstdlib>
@@ -32,7 +32,8 @@ std::unique_ptr<Transport> TransportFactory::Create(GatewayCore& gateway_core,
         const HyperVisorSocketConfiguration socket_cfg = ParseSampleTransportConfig(transport_config_path);
         (void)socket_cfg;
 
-        auto bidirectional = std::make_unique<BidirectionalTransport>(socket_cfg);
+        // A single BidirectionalTransport, unless several lanes are configured.
+        auto bidirectional = MultiLaneTransport::Create(socket_cfg);
         return std::make_unique<SampleHyperVisorTransport>(gateway_core, std::move(bidirectional));
     }
 
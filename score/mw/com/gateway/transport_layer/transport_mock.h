@@ -28,7 +28,7 @@ class TransportMock : public Transport
     MOCK_METHOD(void, Shutdown, (), (override));
     MOCK_METHOD(score::Result<void>,
                 ProvideService,
-                (impl::InstanceSpecifier, std::vector<impl::EventInfo>),
+                (impl::InstanceSpecifier, std::vector<impl::EventInfo>, std::vector<std::string>),
                 (override));
     MOCK_METHOD(score::Result<void>, StopOfferService, (impl::InstanceSpecifier), (override));
     MOCK_METHOD(score::Result<void>, OfferService, (impl::InstanceSpecifier), (override));
@@ -44,6 +44,10 @@ class TransportMock : public Transport
                 NotifyUpdate,
                 (impl::InstanceSpecifier, impl::ServiceElementType, std::string),
                 (override));
+    MOCK_METHOD(score::Result<void>,
+                CallMethod,
+                (impl::InstanceSpecifier, std::string, std::vector<std::uint8_t>, std::size_t, MethodCallResultHandler),
+                (override));
 };
 
 }  // namespace score::mw::com::gateway
@@ -34,7 +34,8 @@ constexpr auto MAX_REFERENCE_RETRIES = 100U;
 template <template <class> class AtomicIndirectorType>
 ConsumerEventDataControlLocalView<AtomicIndirectorType>::ConsumerEventDataControlLocalView(
     EventDataControl& event_data_control_shared) noexcept
-    : state_slots_{event_data_control_shared.state_slots_.begin(), event_data_control_shared.state_slots_.size()}
+    : state_slots_{event_data_control_shared.state_slots_.begin(), event_data_control_shared.state_slots_.size()},
+      last_send_time_ns_{event_data_control_shared.last_send_time_ns_}
 {
 }
 
@@ -60,6 +61,10 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvent
     // function can only finish with result, if use count was able to be increased
     std::optional<SlotIndexType> possible_index{};
 
+    // If the provider revoked the sample lease of a slot, which we still reference, the provider may already have
+    // reused the slot for a newer sample. We can't reference it again, until our old reference has been dropped.
+    const bool has_sample_leases{transaction_log_local_view_->HasSampleLeases()};
+
     // possible optimization: We can remember a history of possible candidates, then we don't need to fully reiterate
     std::uint64_t counter = 0U;
     for (; counter < MAX_REFERENCE_RETRIES; counter++)
@@ -79,7 +84,8 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvent
         {
             // coverity[autosar_cpp14_a5_3_2_violation]
             const EventSlotStatus slot_status{slot.load(std::memory_order_relaxed)};
-            if (slot_status.IsTimeStampBetween(candidate_slot_status.GetTimeStamp(), upper_limit))
+            if (slot_status.IsTimeStampBetween(candidate_slot_status.GetTimeStamp(), upper_limit) &&
+                !(has_sample_leases && transaction_log_local_view_->IsSampleLeaseRevoked(current_index)))
             {
                 possible_index = current_index;
                 candidate_slot_status = slot_status;
@@ -127,6 +133,7 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceNextEvent
                 slot_value, candidate_slot_status_value, status_new_val, std::memory_order_acq_rel))
         {
             transaction_log_local_view_->ReferenceTransactionCommit(possible_index_value);
+            transaction_log_local_view_->StartSampleLease(possible_index_value, GetCurrentSendTime());
             break;
         }
         transaction_log_local_view_->ReferenceTransactionAbort(possible_index_value);
@@ -187,6 +194,7 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::ReferenceSpecificE
                                                           std::numeric_limits<EventSlotStatus::SubscriberCount>::max(),
                                                       "Reference count overflowed which cannot be recovered from.");
     transaction_log_local_view_->ReferenceTransactionCommit(slot_index);
+    transaction_log_local_view_->StartSampleLease(slot_index, GetCurrentSendTime());
 }
 
 template <template <class> class AtomicIndirectorType>
@@ -221,7 +229,11 @@ auto ConsumerEventDataControlLocalView<AtomicIndirectorType>::DereferenceEvent(
     const SlotIndexType event_slot_index) noexcept -> void
 {
     transaction_log_local_view_->DereferenceTransactionBegin(event_slot_index);
-    DereferenceEventWithoutTransactionLogging(event_slot_index);
+    // If the provider revoked our sample lease, it already released the reference on our behalf.
+    if (transaction_log_local_view_->EndSampleLease(event_slot_index))
+    {
+        DereferenceEventWithoutTransactionLogging(event_slot_index);
+    }
     transaction_log_local_view_->DereferenceTransactionCommit(event_slot_index);
 }
 
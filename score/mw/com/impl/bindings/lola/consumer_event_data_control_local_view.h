@@ -124,6 +124,13 @@ class ConsumerEventDataControlLocalView final
     /// \brief Directly access EventSlotStatus for one specific slot
     EventSlotStatus operator[](const SlotIndexType slot_index) const noexcept;
 
+    /// \brief Returns the send time of the latest sample as written by the provider (see
+    ///        EventDataControl::last_send_time_ns_).
+    const std::atomic<std::uint64_t>& GetLastSendTime() const noexcept
+    {
+        return last_send_time_ns_;
+    }
+
     /// \brief Returns the max sample slots set on creation of EventDataControl
     std::size_t GetMaxSampleSlots() const noexcept
     {
@@ -153,6 +160,7 @@ class ConsumerEventDataControlLocalView final
     }
 
     LocalEventControlSlots state_slots_;
+    std::atomic<std::uint64_t>& last_send_time_ns_;
 
     /// \brief Cached TransactionLogLocalView used by a ProxyEvent (and SkeletonEvent when tracing is enabled) to avoid
     /// looking up the log in the TransactionLogSet.
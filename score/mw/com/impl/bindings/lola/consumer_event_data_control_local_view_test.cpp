@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cstdint>
 #include <limits>
 #include <mutex>
 #include <random>
@@ -250,6 +251,48 @@ TEST_F(ConsumerEventDataControlLocalViewFixture, ReferenceNextEventWithFullRange
     EXPECT_FALSE(latest_slot.has_value());
 }
 
+TEST_F(ConsumerEventDataControlLocalViewFixture, RevokedSampleLeaseIsNotReleasedTwiceAndBlocksReuseOfTheSlot)
+{
+    // Given an EventDataControl with one ready slot and a consumer, whose TransactionLog records sample leases
+    auto& transaction_log = transaction_log_.emplace(1U, memory_, true);
+    event_data_control_ = std::make_unique<EventDataControl>(1U, memory_);
+    unit_ = std::make_unique<ConsumerEventDataControlLocalView<>>(*event_data_control_, transaction_log);
+    provider_event_data_control_local_ = std::make_unique<ProviderEventDataControlLocalView<>>(*event_data_control_);
+    ConsumerEventDataControlLocalView<> provider_side_consumer_view{*event_data_control_};
+    const auto first_slot = WithAnAllocatedSlot(1);
+
+    // and the consumer referenced the slot and stalled
+    const auto referenced_slot = unit_->ReferenceNextEvent(0);
+    ASSERT_TRUE(referenced_slot.has_value());
+    ASSERT_EQ(referenced_slot.value(), first_slot);
+
+    // When the provider revokes the expired lease and releases the reference on behalf of the consumer
+    TransactionLogLocalView transaction_log_local_view{transaction_log};
+    ASSERT_EQ(transaction_log_local_view.RevokeExpiredSampleLeases(
+                  std::numeric_limits<std::uint64_t>::max(),
+                  [&provider_side_consumer_view](const TransactionLog::SlotIndexType slot_index) noexcept {
+                      provider_side_consumer_view.DereferenceEventWithoutTransactionLogging(slot_index);
+                  }),
+              1U);
+
+    // Then the provider can reuse the slot for a new sample
+    const auto reused_slot = WithAnAllocatedSlot(2);
+    EXPECT_EQ(reused_slot, first_slot);
+
+    // and the consumer doesn't reference the slot again, as long as it still holds its old reference
+    EXPECT_FALSE(unit_->ReferenceNextEvent(1).has_value());
+
+    // and when the consumer finally drops its old reference, the reference count of the new sample stays untouched
+    unit_->DereferenceEvent(first_slot);
+    EXPECT_EQ((*unit_)[first_slot].GetReferenceCount(), 0U);
+
+    // and the consumer can reference the new sample
+    const auto new_slot = unit_->ReferenceNextEvent(1);
+    ASSERT_TRUE(new_slot.has_value());
+    EXPECT_EQ((*unit_)[new_slot.value()].GetTimeStamp(), 2U);
+    EXPECT_EQ((*unit_)[new_slot.value()].GetReferenceCount(), 1U);
+}
+
 using EventDataControlReferenceSpecificEventFixture = ConsumerEventDataControlLocalViewFixture;
 TEST_F(EventDataControlReferenceSpecificEventFixture, ReferenceSpecificEvents)
 {
@@ -0,0 +1,104 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/deadline_checker.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+DeadlineChecker::Clock::time_point ToTimePoint(const std::uint64_t send_time_ns) noexcept
+{
+    return DeadlineChecker::Clock::time_point{
+        std::chrono::duration_cast<DeadlineChecker::Clock::duration>(std::chrono::nanoseconds{send_time_ns})};
+}
+
+}  // namespace
+
+DeadlineChecker::DeadlineChecker() noexcept : registrations_{}, next_registration_id_{0U} {}
+
+auto DeadlineChecker::Register(const std::atomic<std::uint64_t>& last_send_time_ns,
+                               const std::chrono::nanoseconds expected_period,
+                               DeadlineMissedHandler handler,
+                               const Clock::time_point now) noexcept -> RegistrationId
+{
+    const auto registration_id = next_registration_id_;
+    ++next_registration_id_;
+    // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function shall
+    // have automatic storage duration". The handler is shared with the thread calling it, so it is allocated in the
+    // heap.
+    // coverity[autosar_cpp14_a18_5_8_violation]
+    auto shared_handler = std::make_shared<DeadlineMissedHandler>(std::move(handler));
+    score::cpp::ignore = registrations_.emplace(registration_id,
+                                                Registration{last_send_time_ns,
+                                                             expected_period,
+                                                             std::move(shared_handler),
+                                                             last_send_time_ns.load(std::memory_order_acquire),
+                                                             now,
+                                                             false});
+    return registration_id;
+}
+
+void DeadlineChecker::Unregister(const RegistrationId registration_id) noexcept
+{
+    score::cpp::ignore = registrations_.erase(registration_id);
+}
+
+bool DeadlineChecker::IsRegistered(const RegistrationId registration_id) const noexcept
+{
+    return registrations_.find(registration_id) != registrations_.cend();
+}
+
+bool DeadlineChecker::IsEmpty() const noexcept
+{
+    return registrations_.empty();
+}
+
+auto DeadlineChecker::CheckDeadlines(const Clock::time_point now,
+                                     std::vector<MissedDeadline>& missed_deadlines) noexcept -> Clock::time_point
+{
+    auto next_deadline = Clock::time_point::max();
+    for (auto& registration_entry : registrations_)
+    {
+        auto& registration = registration_entry.second;
+        const auto last_send_time_ns = registration.last_send_time_ns.get().load(std::memory_order_acquire);
+        if (last_send_time_ns != registration.last_seen_send_time_ns)
+        {
+            registration.last_seen_send_time_ns = last_send_time_ns;
+            registration.last_update = std::max(registration.last_update, ToTimePoint(last_send_time_ns));
+            registration.deadline_missed = false;
+        }
+
+        const auto deadline = registration.last_update + registration.expected_period;
+        if ((!registration.deadline_missed) && (now > deadline))
+        {
+            registration.deadline_missed = true;
+            missed_deadlines.push_back(
+                MissedDeadline{registration_entry.first, registration.handler, now - registration.last_update});
+        }
+
+        // After a missed deadline, the event is polled with its expected period, to detect that it arrives again.
+        const auto next_registration_check =
+            registration.deadline_missed ? (now + registration.expected_period) : deadline;
+        next_deadline = std::min(next_deadline, next_registration_check);
+    }
+    return next_deadline;
+}
+
+}  // namespace score::mw::com::impl::lola
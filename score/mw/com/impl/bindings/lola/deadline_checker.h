@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_CHECKER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_CHECKER_H
+
+#include "score/mw/com/impl/deadline_missed_handler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Keeps track of the deadlines of periodic events and decides, which of them have been missed.
+/// \details Used by the DeadlineMonitor, which owns the thread and the locking. Not thread-safe. The current time is
+/// passed in by the caller, so that the decisions are deterministic.
+class DeadlineChecker final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using RegistrationId = std::uint32_t;
+
+    /// \brief A missed deadline, whose handler has to be called by the caller of CheckDeadlines().
+    struct MissedDeadline
+    {
+        RegistrationId registration_id;
+        /// \brief Shared with the registration, so that the handler can be called without holding any lock, while
+        ///        the registration might get removed concurrently.
+        std::shared_ptr<DeadlineMissedHandler> handler;
+        std::chrono::nanoseconds time_since_last_update;
+    };
+
+    DeadlineChecker() noexcept;
+
+    /// \brief Starts tracking the deadline of an event.
+    /// \param last_send_time_ns send time of the latest sample of the event in shared memory. Has to stay valid until
+    ///        the registration is removed via Unregister().
+    /// \param expected_period maximum expected time between two consecutive samples
+    /// \param handler handler of the registration, which is returned with a missed deadline
+    /// \param now current time, from which the time before the first sample is measured
+    /// \return identifier of the registration
+    RegistrationId Register(const std::atomic<std::uint64_t>& last_send_time_ns,
+                            const std::chrono::nanoseconds expected_period,
+                            DeadlineMissedHandler handler,
+                            const Clock::time_point now) noexcept;
+
+    /// \brief Stops tracking the deadline of an event. Unknown registrations are ignored.
+    void Unregister(const RegistrationId registration_id) noexcept;
+
+    bool IsRegistered(const RegistrationId registration_id) const noexcept;
+
+    bool IsEmpty() const noexcept;
+
+    /// \brief Checks the deadlines of all registrations.
+    /// \details Each missed deadline is reported once. It is reported again only after a new sample has been sent and
+    ///          the deadline has been missed again.
+    /// \param now current time
+    /// \param missed_deadlines the newly missed deadlines are appended to it
+    /// \return point in time, when the deadlines shall be checked next
+    Clock::time_point CheckDeadlines(const Clock::time_point now,
+                                     std::vector<MissedDeadline>& missed_deadlines) noexcept;
+
+  private:
+    struct Registration
+    {
+        std::reference_wrapper<const std::atomic<std::uint64_t>> last_send_time_ns;
+        std::chrono::nanoseconds expected_period;
+        std::shared_ptr<DeadlineMissedHandler> handler;
+        std::uint64_t last_seen_send_time_ns;
+        Clock::time_point last_update;
+        bool deadline_missed;
+    };
+
+    std::unordered_map<RegistrationId, Registration> registrations_;
+    RegistrationId next_registration_id_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_CHECKER_H
@@ -0,0 +1,193 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/deadline_checker.h"
+
+#include <gtest/gtest.h>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using Clock = DeadlineChecker::Clock;
+
+constexpr std::chrono::milliseconds kExpectedPeriod{20};
+
+class DeadlineCheckerFixture : public ::testing::Test
+{
+  protected:
+    /// \brief Publishes a sample, which was sent at the given time, like the provider does in shared memory.
+    void Send(const Clock::time_point send_time)
+    {
+        last_send_time_ns_.store(static_cast<std::uint64_t>(
+                                     std::chrono::duration_cast<std::chrono::nanoseconds>(send_time.time_since_epoch())
+                                         .count()),
+                                 std::memory_order_release);
+    }
+
+    std::vector<DeadlineChecker::MissedDeadline> CheckDeadlines(const Clock::time_point now)
+    {
+        std::vector<DeadlineChecker::MissedDeadline> missed_deadlines{};
+        next_check_ = unit_.CheckDeadlines(now, missed_deadlines);
+        return missed_deadlines;
+    }
+
+    static DeadlineMissedHandler KeepingHandler()
+    {
+        return [](const std::chrono::nanoseconds) noexcept {
+            return true;
+        };
+    }
+
+    // Any point in time works, as long as all times of a test are derived from it.
+    const Clock::time_point start_{std::chrono::hours{1}};
+    DeadlineChecker unit_{};
+    std::atomic<std::uint64_t> last_send_time_ns_{0U};
+    Clock::time_point next_check_{};
+};
+
+TEST_F(DeadlineCheckerFixture, DoesNotReportDeadlineWhileSamplesArriveWithinExpectedPeriod)
+{
+    // Given a registration of an event with an expected period
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+
+    for (auto now = start_; now < start_ + 10 * kExpectedPeriod; now += kExpectedPeriod / 2)
+    {
+        // When the provider sends samples more often than the expected period
+        Send(now);
+
+        // Then no deadline is reported as missed
+        EXPECT_TRUE(CheckDeadlines(now + kExpectedPeriod / 4).empty());
+    }
+}
+
+TEST_F(DeadlineCheckerFixture, ReportsMissedDeadlineOnceWhenNoSampleIsSent)
+{
+    // Given a registration of an event with an expected period
+    const auto registration_id = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+
+    // When no sample is sent until after the deadline
+    const auto missed_deadlines = CheckDeadlines(start_ + kExpectedPeriod + std::chrono::milliseconds{1});
+
+    // Then the missed deadline is reported with the time since the registration
+    ASSERT_EQ(missed_deadlines.size(), 1U);
+    EXPECT_EQ(missed_deadlines.front().registration_id, registration_id);
+    EXPECT_EQ(missed_deadlines.front().time_since_last_update, kExpectedPeriod + std::chrono::milliseconds{1});
+    EXPECT_NE(missed_deadlines.front().handler, nullptr);
+
+    // and it is not reported again, while still no sample is sent
+    EXPECT_TRUE(CheckDeadlines(start_ + 5 * kExpectedPeriod).empty());
+}
+
+TEST_F(DeadlineCheckerFixture, DoesNotReportDeadlineAtExactlyTheExpectedPeriod)
+{
+    // Given a registration of an event with an expected period
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+
+    // When checking exactly at the deadline
+    // Then it is not reported as missed
+    EXPECT_TRUE(CheckDeadlines(start_ + kExpectedPeriod).empty());
+}
+
+TEST_F(DeadlineCheckerFixture, MeasuresTimeSinceTheLatestSample)
+{
+    // Given a registration of an event, whose provider sent a sample after the registration
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+    Send(start_ + kExpectedPeriod / 2);
+    EXPECT_TRUE(CheckDeadlines(start_ + kExpectedPeriod).empty());
+
+    // When no further sample is sent until after the deadline
+    const auto missed_deadlines = CheckDeadlines(start_ + 2 * kExpectedPeriod);
+
+    // Then the missed deadline is reported with the time since the sample
+    ASSERT_EQ(missed_deadlines.size(), 1U);
+    EXPECT_EQ(missed_deadlines.front().time_since_last_update, kExpectedPeriod + kExpectedPeriod / 2);
+}
+
+TEST_F(DeadlineCheckerFixture, ReportsMissedDeadlineAgainWhenSamplesStopAfterRecovery)
+{
+    // Given a registration of an event, whose deadline was already missed
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+    ASSERT_EQ(CheckDeadlines(start_ + 2 * kExpectedPeriod).size(), 1U);
+
+    // When the provider sends a sample again
+    Send(start_ + 3 * kExpectedPeriod);
+    EXPECT_TRUE(CheckDeadlines(start_ + 3 * kExpectedPeriod).empty());
+
+    // and then stops
+    const auto missed_deadlines = CheckDeadlines(start_ + 5 * kExpectedPeriod);
+
+    // Then the missed deadline is reported a second time
+    EXPECT_EQ(missed_deadlines.size(), 1U);
+}
+
+TEST_F(DeadlineCheckerFixture, NextCheckIsTheEarliestDeadline)
+{
+    // Given two registrations with different expected periods
+    std::atomic<std::uint64_t> other_last_send_time_ns{0U};
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+    score::cpp::ignore = unit_.Register(other_last_send_time_ns, 2 * kExpectedPeriod, KeepingHandler(), start_);
+
+    // When checking the deadlines before any of them is missed
+    EXPECT_TRUE(CheckDeadlines(start_).empty());
+
+    // Then the next check is due at the earlier deadline
+    EXPECT_EQ(next_check_, start_ + kExpectedPeriod);
+}
+
+TEST_F(DeadlineCheckerFixture, MissedDeadlineIsPolledWithExpectedPeriod)
+{
+    // Given a registration, whose deadline was missed
+    score::cpp::ignore = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+    const auto now = start_ + 2 * kExpectedPeriod;
+    ASSERT_EQ(CheckDeadlines(now).size(), 1U);
+
+    // Then the next check is due one expected period later, to detect that the event arrives again
+    EXPECT_EQ(next_check_, now + kExpectedPeriod);
+}
+
+TEST_F(DeadlineCheckerFixture, DoesNotReportUnregisteredRegistration)
+{
+    // Given a registration of an event
+    const auto registration_id = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+
+    // When the registration is removed before its deadline
+    unit_.Unregister(registration_id);
+
+    // Then it is neither registered nor reported after its deadline
+    EXPECT_FALSE(unit_.IsRegistered(registration_id));
+    EXPECT_TRUE(unit_.IsEmpty());
+    EXPECT_TRUE(CheckDeadlines(start_ + 2 * kExpectedPeriod).empty());
+    EXPECT_EQ(next_check_, Clock::time_point::max());
+}
+
+TEST_F(DeadlineCheckerFixture, UnregisteringUnknownRegistrationIsIgnored)
+{
+    // Given a registration of an event
+    const auto registration_id = unit_.Register(last_send_time_ns_, kExpectedPeriod, KeepingHandler(), start_);
+
+    // When unregistering a different registration
+    unit_.Unregister(registration_id + 1U);
+
+    // Then the registration is kept
+    EXPECT_TRUE(unit_.IsRegistered(registration_id));
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
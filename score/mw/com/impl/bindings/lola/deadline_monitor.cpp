@@ -0,0 +1,145 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/deadline_monitor.h"
+
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+DeadlineMonitor::DeadlineMonitor(concurrency::Executor& long_running_threads,
+                                 const std::chrono::nanoseconds check_resolution) noexcept
+    : long_running_threads_{long_running_threads},
+      check_resolution_{check_resolution},
+      mutex_{},
+      registrations_changed_{},
+      handler_finished_{},
+      checker_{},
+      missed_deadlines_{},
+      running_registration_id_{},
+      worker_thread_id_{},
+      worker_result_{}
+{
+}
+
+DeadlineMonitor::~DeadlineMonitor() noexcept
+{
+    // Shut down worker thread correctly to avoid concurrency issues during destruction
+    if (worker_result_.has_value())
+    {
+        worker_result_->Abort();
+        score::cpp::ignore = worker_result_->Wait();
+    }
+}
+
+auto DeadlineMonitor::Register(const std::atomic<std::uint64_t>& last_send_time_ns,
+                               const std::chrono::nanoseconds expected_period,
+                               DeadlineMissedHandler handler) noexcept -> RegistrationId
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (!worker_result_.has_value())
+    {
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
+        // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
+        // By design, if `long_running_threads_.Submit()` ever fails, we expect program termination.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        score::cpp::ignore = worker_result_.emplace(
+            long_running_threads_.Submit([this](const auto stop_token) noexcept {
+                Run(stop_token);
+            }));
+    }
+
+    const auto registration_id =
+        checker_.Register(last_send_time_ns, expected_period, std::move(handler), Clock::now());
+    // The new registration might have an earlier deadline than the one the worker is currently waiting for.
+    registrations_changed_.notify_one();
+    return registration_id;
+}
+
+void DeadlineMonitor::Unregister(const RegistrationId registration_id) noexcept
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    checker_.Unregister(registration_id);
+    // A handler calling us would wait for itself.
+    if (std::this_thread::get_id() != worker_thread_id_)
+    {
+        handler_finished_.wait(lock, [this, registration_id]() noexcept {
+            return running_registration_id_ != registration_id;
+        });
+    }
+}
+
+void DeadlineMonitor::Run(const score::cpp::stop_token& stop_token) noexcept
+{
+    // Suppress "AUTOSAR C++14 M0-1-3" and "AUTOSAR C++14 M0-1-9" rule violations. The rule states
+    // "A project shall not contain unused variables." and "There shall be no dead code.", respectively.
+    // Tolerated, this is a stop callback.
+    // score::cpp::stop_callback is an RAII class which registers a callback with stop_token on construction
+    // and deregisters it on destruction. Therefore, it is used again when it goes out of scope.
+    // coverity[autosar_cpp14_m0_1_9_violation : FALSE]
+    // coverity[autosar_cpp14_m0_1_3_violation : FALSE]
+    score::cpp::stop_callback wake_up_on_stop{stop_token, [this]() noexcept {
+                                                  std::lock_guard<std::mutex> lock{mutex_};
+                                                  registrations_changed_.notify_all();
+                                              }};
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    worker_thread_id_ = std::this_thread::get_id();
+    while (!stop_token.stop_requested())
+    {
+        if (checker_.IsEmpty())
+        {
+            registrations_changed_.wait(lock);
+            continue;
+        }
+        const auto now = Clock::now();
+        const auto next_check = checker_.CheckDeadlines(now, missed_deadlines_);
+        if (!missed_deadlines_.empty())
+        {
+            CallHandlers(lock);
+            // The handlers might have changed the registrations, so the next check is recalculated.
+            continue;
+        }
+        score::cpp::ignore = registrations_changed_.wait_until(lock, std::max(next_check, now + check_resolution_));
+    }
+}
+
+void DeadlineMonitor::CallHandlers(std::unique_lock<std::mutex>& lock) noexcept
+{
+    for (auto& missed_deadline : missed_deadlines_)
+    {
+        // The registration might have been removed by a handler called before.
+        if (!checker_.IsRegistered(missed_deadline.registration_id))
+        {
+            continue;
+        }
+        running_registration_id_ = missed_deadline.registration_id;
+        lock.unlock();
+        const bool keep_handler = (*missed_deadline.handler)(missed_deadline.time_since_last_update);
+        lock.lock();
+        running_registration_id_.reset();
+        handler_finished_.notify_all();
+        if (!keep_handler)
+        {
+            checker_.Unregister(missed_deadline.registration_id);
+        }
+    }
+    // releases our references to the handlers
+    missed_deadlines_.clear();
+}
+
+}  // namespace score::mw::com::impl::lola
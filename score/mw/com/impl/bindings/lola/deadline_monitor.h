@@ -0,0 +1,108 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_MONITOR_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_MONITOR_H
+
+#include "score/mw/com/impl/bindings/lola/deadline_checker.h"
+#include "score/mw/com/impl/deadline_missed_handler.h"
+
+#include "score/concurrency/executor.h"
+
+#include <score/stop_token.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Runtime-wide monitor of the deadlines of periodic events on proxy side.
+///
+/// \details Instead of every consumer running its own timer to detect that a periodic event stopped arriving, proxy
+/// events register the expected period of their event here. A single worker thread checks the send time of the latest
+/// sample, which the provider publishes in shared memory (EventDataControl::last_send_time_ns_), of all registered
+/// events and only calls the registered DeadlineMissedHandler, if a deadline has been missed. The worker thread sleeps
+/// until the earliest deadline of all registered events, but wakes up at most once per check resolution, so that the
+/// number of wake-ups does not grow with the number of monitored events. A missed deadline is therefore detected with
+/// a delay of at most the check resolution.
+/// The handlers are called without holding the lock of the monitor, so they may register and unregister handlers.
+/// The worker thread is only started with the first registration.
+class DeadlineMonitor final
+{
+  public:
+    using Clock = DeadlineChecker::Clock;
+    using RegistrationId = DeadlineChecker::RegistrationId;
+
+    /// \brief Default resolution, in which the deadlines are checked.
+    static constexpr std::chrono::milliseconds kDefaultCheckResolution{10};
+
+    /// \brief Creates the monitor.
+    /// \param long_running_threads executor, which provides the worker thread
+    /// \param check_resolution minimal time between two checks of the deadlines
+    explicit DeadlineMonitor(concurrency::Executor& long_running_threads,
+                             const std::chrono::nanoseconds check_resolution = kDefaultCheckResolution) noexcept;
+    ~DeadlineMonitor() noexcept;
+
+    DeadlineMonitor(const DeadlineMonitor&) = delete;
+    DeadlineMonitor(DeadlineMonitor&&) = delete;
+    DeadlineMonitor& operator=(const DeadlineMonitor&) = delete;
+    DeadlineMonitor& operator=(DeadlineMonitor&&) = delete;
+
+    /// \brief Starts monitoring the deadline of an event.
+    /// \param last_send_time_ns send time of the latest sample of the event in shared memory. Has to stay valid until
+    ///        the registration is removed via Unregister().
+    /// \param expected_period maximum expected time between two consecutive samples
+    /// \param handler called in case no sample has been sent within expected_period. The time before the first sample
+    ///        is measured from this call.
+    /// \return identifier of the registration
+    RegistrationId Register(const std::atomic<std::uint64_t>& last_send_time_ns,
+                            const std::chrono::nanoseconds expected_period,
+                            DeadlineMissedHandler handler) noexcept;
+
+    /// \brief Stops monitoring the deadline of an event.
+    /// \details After return, the handler of the registration is neither running nor will be called anymore. The only
+    ///          exception is a call from within a DeadlineMissedHandler: it does not wait for the calling handler to
+    ///          return. A registration, which has already been removed, because its handler returned false, is
+    ///          ignored.
+    /// \param registration_id identifier returned by Register()
+    void Unregister(const RegistrationId registration_id) noexcept;
+
+  private:
+    void Run(const score::cpp::stop_token& stop_token) noexcept;
+
+    /// \brief Calls the handlers of the missed deadlines with mutex_ being unlocked.
+    /// \pre lock holds mutex_, which is held again on return
+    void CallHandlers(std::unique_lock<std::mutex>& lock) noexcept;
+
+    concurrency::Executor& long_running_threads_;
+    const std::chrono::nanoseconds check_resolution_;
+    std::mutex mutex_;
+    std::condition_variable registrations_changed_;
+    std::condition_variable handler_finished_;
+    DeadlineChecker checker_;
+    /// \brief Only accessed by the worker thread.
+    std::vector<DeadlineChecker::MissedDeadline> missed_deadlines_;
+    std::optional<RegistrationId> running_registration_id_;
+    std::thread::id worker_thread_id_;
+    std::optional<concurrency::TaskResult<void>> worker_result_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_DEADLINE_MONITOR_H
@@ -0,0 +1,147 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/deadline_monitor.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+
+#include <benchmark/benchmark.h>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr std::chrono::milliseconds kExpectedPeriod{20};
+
+std::uint64_t Now() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(DeadlineMonitor::Clock::now().time_since_epoch())
+            .count());
+}
+
+/// \brief CPU time consumed by all threads of the process
+double GetProcessCpuTimeSeconds() noexcept
+{
+    return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+}
+
+/// \brief Sends all events with half of the expected period, so that no deadline is missed. One iteration is one
+///        expected period.
+/// \details Reports the CPU time of the whole process, i.e. including the threads monitoring the deadlines, per
+///          iteration as counter "process_cpu_time".
+void SendInTime(benchmark::State& state, std::vector<std::atomic<std::uint64_t>>& last_send_times)
+{
+    const auto cpu_time_start = GetProcessCpuTimeSeconds();
+    for (auto _ : state)
+    {
+        std::ignore = _;
+        for (std::uint32_t half_period = 0U; half_period < 2U; ++half_period)
+        {
+            const auto send_time = Now();
+            for (auto& last_send_time : last_send_times)
+            {
+                last_send_time.store(send_time, std::memory_order_release);
+            }
+            std::this_thread::sleep_for(kExpectedPeriod / 2);
+        }
+    }
+    state.counters["process_cpu_time"] =
+        benchmark::Counter(GetProcessCpuTimeSeconds() - cpu_time_start, benchmark::Counter::kAvgIterations);
+}
+
+/// \brief Baseline: every consumer runs its own timer thread, which checks the send time once per expected period.
+void BM_OneTimerThreadPerConsumer(benchmark::State& state)
+{
+    std::vector<std::atomic<std::uint64_t>> last_send_times(static_cast<std::size_t>(state.range(0)));
+    std::atomic<std::uint64_t> missed_deadlines{0U};
+
+    std::mutex mutex{};
+    std::condition_variable stop_condition{};
+    bool stop{false};
+    std::vector<std::thread> timers{};
+    for (auto& last_send_time : last_send_times)
+    {
+        timers.emplace_back([&mutex, &stop_condition, &stop, &last_send_time, &missed_deadlines]() {
+            std::uint64_t last_seen_send_time{last_send_time.load(std::memory_order_acquire)};
+            std::unique_lock<std::mutex> lock{mutex};
+            while (!stop_condition.wait_for(lock, kExpectedPeriod, [&stop]() {
+                return stop;
+            }))
+            {
+                const auto send_time = last_send_time.load(std::memory_order_acquire);
+                if (send_time == last_seen_send_time)
+                {
+                    ++missed_deadlines;
+                }
+                last_seen_send_time = send_time;
+            }
+        });
+    }
+
+    SendInTime(state, last_send_times);
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stop = true;
+    }
+    stop_condition.notify_all();
+    for (auto& timer : timers)
+    {
+        timer.join();
+    }
+    state.counters["missed_deadlines"] = static_cast<double>(missed_deadlines.load());
+}
+
+/// \brief All consumers register their deadline with the runtime-wide DeadlineMonitor.
+void BM_DeadlineMonitor(benchmark::State& state)
+{
+    std::vector<std::atomic<std::uint64_t>> last_send_times(static_cast<std::size_t>(state.range(0)));
+    std::atomic<std::uint64_t> missed_deadlines{0U};
+
+    {
+        concurrency::LongRunningThreadsContainer long_running_threads{};
+        DeadlineMonitor unit{long_running_threads};
+        for (auto& last_send_time : last_send_times)
+        {
+            score::cpp::ignore = unit.Register(
+                last_send_time, kExpectedPeriod, [&missed_deadlines](const std::chrono::nanoseconds) noexcept {
+                    ++missed_deadlines;
+                    return true;
+                });
+        }
+
+        SendInTime(state, last_send_times);
+    }
+    state.counters["missed_deadlines"] = static_cast<double>(missed_deadlines.load());
+}
+
+BENCHMARK(BM_OneTimerThreadPerConsumer)->Arg(50)->Arg(500)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeadlineMonitor)->Arg(50)->Arg(500)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
+
+BENCHMARK_MAIN();
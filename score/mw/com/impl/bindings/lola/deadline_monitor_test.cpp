@@ -0,0 +1,143 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/deadline_monitor.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+
+#include <gtest/gtest.h>
+#include <score/utility.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <thread>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+// The deadline logic itself is tested deterministically in deadline_checker_test.cpp. These tests only cover the
+// calling of the handlers by the worker thread, so that no sample is ever sent and every deadline is missed right
+// away.
+constexpr std::chrono::nanoseconds kExpectedPeriod{1};
+constexpr std::chrono::milliseconds kCheckResolution{1};
+
+class DeadlineMonitorFixture : public ::testing::Test
+{
+  protected:
+    std::atomic<std::uint64_t> last_send_time_ns_{0U};
+    std::atomic<std::uint64_t> other_last_send_time_ns_{0U};
+
+    // The handlers only capture `this`, so that they fit into the DeadlineMissedHandler. The monitor is declared last,
+    // so that its worker thread is stopped before the state used by the handlers is destroyed.
+    std::promise<DeadlineMonitor::RegistrationId> registration_id_{};
+    std::shared_future<DeadlineMonitor::RegistrationId> registration_id_future_{registration_id_.get_future().share()};
+    std::promise<std::chrono::nanoseconds> handler_called_{};
+    std::promise<void> release_handler_{};
+    std::shared_future<void> release_handler_future_{release_handler_.get_future().share()};
+    std::atomic<bool> handler_finished_{false};
+
+    concurrency::LongRunningThreadsContainer long_running_threads_{};
+    DeadlineMonitor unit_{long_running_threads_, kCheckResolution};
+};
+
+TEST_F(DeadlineMonitorFixture, CallsHandlerWhenDeadlineIsMissed)
+{
+    // Given a registration of an event, whose provider does not send any sample
+    score::cpp::ignore = unit_.Register(
+        last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds time_since_last_update) noexcept {
+            handler_called_.set_value(time_since_last_update);
+            return false;
+        });
+
+    // Then the handler is called with the time since the registration
+    EXPECT_GT(handler_called_.get_future().get(), kExpectedPeriod);
+}
+
+TEST_F(DeadlineMonitorFixture, HandlerCanUnregisterItself)
+{
+    // Given a registration, whose handler unregisters itself
+    registration_id_.set_value(
+        unit_.Register(last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds) noexcept {
+            unit_.Unregister(registration_id_future_.get());
+            handler_called_.set_value({});
+            return true;
+        }));
+
+    // When its deadline is missed
+    // Then the handler returns instead of waiting for itself
+    handler_called_.get_future().wait();
+}
+
+TEST_F(DeadlineMonitorFixture, HandlerCanRegisterAnotherHandler)
+{
+    // Given a registration, whose handler registers another handler
+    score::cpp::ignore =
+        unit_.Register(last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds) noexcept {
+            score::cpp::ignore = unit_.Register(
+                other_last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds) noexcept {
+                    handler_called_.set_value({});
+                    return false;
+                });
+            return false;
+        });
+
+    // When its deadline is missed
+    // Then the other handler gets registered and called on its missed deadline
+    handler_called_.get_future().wait();
+}
+
+TEST_F(DeadlineMonitorFixture, UnregisterWaitsForRunningHandler)
+{
+    // Given a registration, whose handler is running
+    const auto registration_id =
+        unit_.Register(last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds) noexcept {
+            handler_called_.set_value({});
+            release_handler_future_.wait();
+            handler_finished_ = true;
+            return false;
+        });
+    handler_called_.get_future().wait();
+
+    // When unregistering it from another thread
+    bool handler_finished_when_unregister_returned{false};
+    std::thread unregistering_thread{[this, registration_id, &handler_finished_when_unregister_returned]() {
+        unit_.Unregister(registration_id);
+        handler_finished_when_unregister_returned = handler_finished_.load();
+    }};
+    release_handler_.set_value();
+    unregistering_thread.join();
+
+    // Then Unregister() only returned after the handler
+    EXPECT_TRUE(handler_finished_when_unregister_returned);
+}
+
+TEST_F(DeadlineMonitorFixture, UnregisteringRegistrationRemovedByItsHandlerIsIgnored)
+{
+    // Given a registration, whose handler returned false
+    const auto registration_id =
+        unit_.Register(last_send_time_ns_, kExpectedPeriod, [this](const std::chrono::nanoseconds) noexcept {
+            handler_called_.set_value({});
+            return false;
+        });
+    handler_called_.get_future().wait();
+
+    // When unregistering it
+    // Then nothing happens
+    unit_.Unregister(registration_id);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
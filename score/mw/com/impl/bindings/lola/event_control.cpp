@@ -18,10 +18,12 @@ namespace score::mw::com::impl::lola
 EventControl::EventControl(const SlotIndexType number_of_slots,
                            const SubscriberCountType max_subscribers,
                            const bool enforce_max_samples,
-                           score::memory::shared::ManagedMemoryResource& resource) noexcept
+                           const SubscriptionControlWidth subscription_control_width,
+                           score::memory::shared::ManagedMemoryResource& resource,
+                           const bool with_sample_leases) noexcept
     : data_control{number_of_slots, resource},
-      subscription_control{number_of_slots, max_subscribers, enforce_max_samples},
-      transaction_log_set_{max_subscribers, number_of_slots, resource}
+      subscription_control{number_of_slots, max_subscribers, enforce_max_samples, subscription_control_width},
+      transaction_log_set_{max_subscribers, number_of_slots, resource, with_sample_leases}
 {
 }
 
@@ -25,10 +25,13 @@ class EventControl
 {
   public:
     using SubscriberCountType = EventSubscriptionControl<>::SubscriberCountType;
+    using SubscriptionControlWidth = EventSubscriptionControl<>::SubscriptionControlWidth;
     EventControl(const SlotIndexType number_of_slots,
                  const SubscriberCountType max_subscribers,
                  const bool enforce_max_samples,
-                 score::memory::shared::ManagedMemoryResource& resource) noexcept;
+                 const SubscriptionControlWidth subscription_control_width,
+                 score::memory::shared::ManagedMemoryResource& resource,
+                 const bool with_sample_leases = false) noexcept;
 
     // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
     // be private.". There are no class invariants to maintain which could be violated by directly accessing member
@@ -18,9 +18,23 @@
 #include "score/containers/dynamic_array.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
 namespace score::mw::com::impl::lola
 {
 
+/// \brief Returns the current time in the representation of EventDataControl::last_send_time_ns_.
+/// \details std::chrono::steady_clock is based on a system-wide monotonic clock, so that the send time written by the
+/// provider can be compared to the current time of the consumer.
+inline std::uint64_t GetCurrentSendTime() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
 /// \brief EventDataControl encapsulates the overall control information for one event. It is stored in Shared Memory.
 ///
 /// \details EventDataControl holds a dynamic array of multiple slots, which hold EventSlotStatus. The
@@ -47,6 +61,11 @@ class EventDataControl
     }
 
     EventControlSlots state_slots_;
+
+    /// \brief Send time (see GetCurrentSendTime()) of the latest sample or 0, if no sample has been sent yet.
+    /// \details Written by the provider on every send, so that consumers can detect missed deadlines of periodic events
+    ///          without receiving or polling samples (see DeadlineMonitor).
+    std::atomic<std::uint64_t> last_send_time_ns_{0U};
 };
 
 }  // namespace score::mw::com::impl::lola
@@ -165,14 +165,18 @@ auto EventDataControlComposite<AtomicIndirectorType>::EventReady(const SlotIndex
                                                                  EventSlotStatus::EventTimeStamp time_stamp) noexcept
     -> void
 {
+    // Read the clock only once for both control sections.
+    const auto send_time_ns = GetCurrentSendTime();
     if (asil_b_control_local_ != nullptr)
     {
         asil_b_control_local_->EventReady(slot_index, time_stamp);
+        asil_b_control_local_->SetLastSendTime(send_time_ns);
     }
 
     if (!ignore_qm_control_)
     {
         asil_qm_control_local_.get().EventReady(slot_index, time_stamp);
+        asil_qm_control_local_.get().SetLastSendTime(send_time_ns);
     }
 }
 
@@ -87,6 +87,7 @@ class EventDataControlComposite
     AllocationResult AllocateNextSlot() noexcept;
 
     /// \brief Indicates that a slot is ready for reading - writing has finished. (thread-safe, wait-free)
+    /// \details Also publishes the current time as send time of the latest sample in all underlying control structures.
     /// \pre AllocateNextSlot() was invoked to obtain write-ownership
     void EventReady(const SlotIndexType slot_index, EventSlotStatus::EventTimeStamp time_stamp) noexcept;
 
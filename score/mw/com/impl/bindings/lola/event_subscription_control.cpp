@@ -12,8 +12,14 @@
  ********************************************************************************/
 #include "score/mw/com/impl/bindings/lola/event_subscription_control.h"
 #include "score/language/safecpp/safe_math/safe_math.h"
+#include "score/mw/com/impl/hot_path_diagnostics.h"
 #include "score/mw/log/logging.h"
 
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <limits>
+
 namespace score::mw::com::impl::lola
 {
 namespace
@@ -48,21 +54,88 @@ inline std::uint32_t CreateState(EventSubscriptionControl<>::SubscriberCountType
     return result;
 }
 
+/// \brief Value to be added to the 64 bit subscription state for one subscriber with the given number of slots.
+inline std::uint64_t CreateWideStateIncrement(EventSubscriptionControl<>::SlotNumberType subscribed_slots) noexcept
+{
+    std::uint64_t result{1U};
+    result = result << 32U;
+    result += subscribed_slots;
+    return result;
+}
+
+/// \brief Value to be added to the 64 bit subscription state to remove the given increment again.
+/// \details Modular unsigned arithmetic lets us express the subtraction via fetch_add, so that both directions use the
+///          same atomic operation.
+inline std::uint64_t NegateWideStateIncrement(std::uint64_t increment) noexcept
+{
+    return (std::numeric_limits<std::uint64_t>::max() - increment) + 1U;
+}
+
+inline std::uint32_t GetSubscribersFromWideState(std::uint64_t subscription_state) noexcept
+{
+    // Suppress "AUTOSAR C++14 A4-7-1" rule finding. This rule states: "An integer expression shall
+    // not lead to data loss.".
+    // This is an in purpose casting to get the subscribers from the subscription state.
+    // coverity[autosar_cpp14_a4_7_1_violation]
+    return static_cast<std::uint32_t>(subscription_state >> 32U);
+}
+
+inline std::uint32_t GetSubscribedSamplesFromWideState(std::uint64_t subscription_state) noexcept
+{
+    // Suppress "AUTOSAR C++14 A4-7-1" rule finding. This rule states: "An integer expression shall
+    // not lead to data loss.".
+    // This is an in purpose casting to get the subscribed samples from the subscription state.
+    // coverity[autosar_cpp14_a4_7_1_violation]
+    return static_cast<std::uint32_t>(subscription_state & 0x00000000FFFFFFFFU);
+}
+
 }  // namespace
 
 template <template <class> class AtomicIndirectorType>
-EventSubscriptionControl<AtomicIndirectorType>::EventSubscriptionControl(const SlotNumberType max_slot_count,
-                                                                         const SubscriberCountType max_subscribers,
-                                                                         const bool enforce_max_samples) noexcept
+EventSubscriptionControl<AtomicIndirectorType>::EventSubscriptionControl(
+    const SlotNumberType max_slot_count,
+    const SubscriberCountType max_subscribers,
+    const bool enforce_max_samples,
+    const SubscriptionControlWidth subscription_control_width) noexcept
     : current_subscription_state_{0U},
+      current_wide_subscription_state_{0U},
       max_subscribable_slots_{max_slot_count},
       max_subscribers_{max_subscribers},
-      enforce_max_samples_{enforce_max_samples}
+      enforce_max_samples_{enforce_max_samples},
+      subscription_control_width_{subscription_control_width}
 {
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+        (subscription_control_width_ == SubscriptionControlWidth::k64Bit) ||
+            (max_subscribers_ <= LolaEventInstanceDeployment::kMaxSubscribersOf32BitSubscriptionControl),
+        "max_subscribers exceeds the capacity of a 32 bit subscription control.");
 }
 
 template <template <class> class AtomicIndirectorType>
 auto EventSubscriptionControl<AtomicIndirectorType>::Subscribe(SlotNumberType slot_count) noexcept -> SubscribeResult
+{
+    if (subscription_control_width_ == SubscriptionControlWidth::k64Bit)
+    {
+        return Subscribe64Bit(slot_count);
+    }
+    return Subscribe32Bit(slot_count);
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventSubscriptionControl<AtomicIndirectorType>::Unsubscribe(SlotNumberType slot_count) noexcept -> void
+{
+    if (subscription_control_width_ == SubscriptionControlWidth::k64Bit)
+    {
+        Unsubscribe64Bit(slot_count);
+    }
+    else
+    {
+        Unsubscribe32Bit(slot_count);
+    }
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventSubscriptionControl<AtomicIndirectorType>::Subscribe32Bit(SlotNumberType slot_count) noexcept
+    -> SubscribeResult
 {
     // Suppress "AUTOSAR C++14 M5-0-8" rule finding. This rule declares: "An explicit integral or
     // floating-point conversion shall not increase the size of the underlying type of a cvalue expression.".
@@ -81,15 +154,13 @@ auto EventSubscriptionControl<AtomicIndirectorType>::Subscribe(SlotNumberType sl
         const auto current_subscribers = GetSubscribersFromState(current_state);
         if (current_subscribers >= max_subscribers_)
         {
-            mw::log::LogInfo("lola")
-                << "EventSubscriptionControl<>::Subscribe() rejected as already max_subscribers_ are subscribed.";
+            HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kSubscribeMaxSubscribersOverflow);
             return SubscribeResult::kMaxSubscribersOverflow;
         }
         SlotNumberType current_subscribed_slots = GetSubscribedSamplesFromState(current_state);
         if ((enforce_max_samples_) && ((current_subscribed_slots + slot_count) > max_subscribable_slots_))
         {
-            mw::log::LogInfo("lola")
-                << "EventSubscriptionControl<>::Subscribe() rejected as max_subscribable_slots_ would overflow.";
+            HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kSubscribeSlotOverflow);
             return SubscribeResult::kSlotOverflow;
         }
 
@@ -111,7 +182,7 @@ auto EventSubscriptionControl<AtomicIndirectorType>::Subscribe(SlotNumberType sl
 }
 
 template <template <class> class AtomicIndirectorType>
-auto EventSubscriptionControl<AtomicIndirectorType>::Unsubscribe(SlotNumberType slot_count) noexcept -> void
+auto EventSubscriptionControl<AtomicIndirectorType>::Unsubscribe32Bit(SlotNumberType slot_count) noexcept -> void
 {
     /// some heuristics for retry count: we take into account max_subscribers_ as one dimension of the likelihood of
     /// a concurrent try to change the atomic state. The factor in front is resembling the "activity" of this subscriber
@@ -160,6 +231,57 @@ auto EventSubscriptionControl<AtomicIndirectorType>::Unsubscribe(SlotNumberType
     std::terminate();
 }
 
+template <template <class> class AtomicIndirectorType>
+auto EventSubscriptionControl<AtomicIndirectorType>::Subscribe64Bit(SlotNumberType slot_count) noexcept
+    -> SubscribeResult
+{
+    // The new subscriber is accounted for optimistically. Since the 32 bit subscriber and slot counters can't overflow
+    // with 16 bit max_subscribers_ and slot counts, a single fetch_add is sufficient and no retry is needed.
+    const auto increment = CreateWideStateIncrement(slot_count);
+    const auto previous_state = AtomicIndirectorType<std::uint64_t>::fetch_add(
+        current_wide_subscription_state_, increment, std::memory_order_acq_rel);
+
+    if (GetSubscribersFromWideState(previous_state) >= max_subscribers_)
+    {
+        score::cpp::ignore = AtomicIndirectorType<std::uint64_t>::fetch_add(
+            current_wide_subscription_state_, NegateWideStateIncrement(increment), std::memory_order_acq_rel);
+        HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kSubscribeMaxSubscribersOverflow);
+        return SubscribeResult::kMaxSubscribersOverflow;
+    }
+    const auto subscribed_slots = static_cast<std::uint64_t>(GetSubscribedSamplesFromWideState(previous_state));
+    if ((enforce_max_samples_) && ((subscribed_slots + slot_count) > max_subscribable_slots_))
+    {
+        score::cpp::ignore = AtomicIndirectorType<std::uint64_t>::fetch_add(
+            current_wide_subscription_state_, NegateWideStateIncrement(increment), std::memory_order_acq_rel);
+        HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kSubscribeSlotOverflow);
+        return SubscribeResult::kSlotOverflow;
+    }
+    return SubscribeResult::kSuccess;
+}
+
+template <template <class> class AtomicIndirectorType>
+auto EventSubscriptionControl<AtomicIndirectorType>::Unsubscribe64Bit(SlotNumberType slot_count) noexcept -> void
+{
+    const auto previous_state = AtomicIndirectorType<std::uint64_t>::fetch_add(
+        current_wide_subscription_state_,
+        NegateWideStateIncrement(CreateWideStateIncrement(slot_count)),
+        std::memory_order_acq_rel);
+
+    // Subscriptions, which are about to be rolled back, can only increase the counters. So an underflow detected here
+    // is always a real one.
+    if (GetSubscribersFromWideState(previous_state) == 0U)
+    {
+        mw::log::LogFatal("lola") << "EventSubscriptionControl<>::Unsubscribe() Current subscriber count is already 0!";
+        std::terminate();
+    }
+    if (GetSubscribedSamplesFromWideState(previous_state) < slot_count)
+    {
+        mw::log::LogFatal("lola") << "EventSubscriptionControl<>::Unsubscribe() rejected as currently subscribed slots "
+                                     "are smaller than slot_count.";
+        std::terminate();
+    }
+}
+
 template class EventSubscriptionControl<memory::shared::AtomicIndirectorReal>;
 template class EventSubscriptionControl<memory::shared::AtomicIndirectorMock>;
 
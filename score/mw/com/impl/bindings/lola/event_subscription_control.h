@@ -40,6 +40,14 @@ enum class SubscribeResult : std::uint8_t
 /// \details Underlying EventSubscriptionControl holds the subscription state (currently subscribed slots, current
 ///          number of subscribers) in an atomic member and also max slots and subscribers as constants. It provides
 ///          functionality to subscribe/unsubscribe in a lock-free manner.
+///          The width of the atomic state is selected per event via SubscriptionControlWidth:
+///          - k32Bit packs an 8 bit subscriber count and a 16 bit slot count. State updates are done via a bounded
+///            compare-exchange retry loop.
+///          - k64Bit packs a 32 bit subscriber count and a 32 bit slot count. State updates are done via a single
+///            fetch_add, which never has to be retried, independent of the number of concurrently (un)subscribing
+///            consumers. A subscription, which exceeds a limit, is rolled back with a second fetch_add. While such a
+///            rejected subscription is not yet rolled back, a concurrent Subscribe() close to the limits may be
+///            rejected as well.
 ///          template arg AtomicIndirectorType is used for testing to enable mocking of std::atomic functionality.
 template <template <class> class AtomicIndirectorType = memory::shared::AtomicIndirectorReal>
 class EventSubscriptionControl final
@@ -54,16 +62,20 @@ class EventSubscriptionControl final
   public:
     /// \brief Represents the type for the number of sample slots - lola deployment is the master of this type.
     using SlotNumberType = LolaEventInstanceDeployment::SampleSlotCountType;
-    /// \brief Represents the type for the number of sample slots - needs to be in sync with
-    ///        LolaEventInstanceDeployment::max_subscribers_
-    using SubscriberCountType = std::uint8_t;
+    /// \brief Represents the type for the number of subscribers - lola deployment is the master of this type.
+    using SubscriberCountType = LolaEventInstanceDeployment::SubscriberCountType;
+    using SubscriptionControlWidth = LolaEventInstanceDeployment::SubscriptionControlWidth;
 
     /// \brief Will construct EventSubscriptionControl
     /// \param max_slot_count maximum/initial number of subscribable slots.
-    /// \param max_subscribers maximum number of allowed subscribers.
+    /// \param max_subscribers maximum number of allowed subscribers. For SubscriptionControlWidth::k32Bit it must not
+    ///        exceed LolaEventInstanceDeployment::kMaxSubscribersOf32BitSubscriptionControl.
+    /// \param subscription_control_width width of the atomic subscription state.
     EventSubscriptionControl(const SlotNumberType max_slot_count,
                              const SubscriberCountType max_subscribers,
-                             const bool enforce_max_samples) noexcept;
+                             const bool enforce_max_samples,
+                             const SubscriptionControlWidth subscription_control_width =
+                                 SubscriptionControlWidth::k32Bit) noexcept;
 
     /// \brief Subscribe with given number of slots
     /// \param slot_count number of slots to subscribe for
@@ -74,12 +86,27 @@ class EventSubscriptionControl final
     /// \param slot_count number of slots to unsubscribe
     void Unsubscribe(SlotNumberType slot_count) noexcept;
 
+    SubscriptionControlWidth GetSubscriptionControlWidth() const noexcept
+    {
+        return subscription_control_width_;
+    }
+
   private:
-    /// \brief holds the current number of subscribed slots and the number of current subscribers combined.
+    SubscribeResult Subscribe32Bit(SlotNumberType slot_count) noexcept;
+    void Unsubscribe32Bit(SlotNumberType slot_count) noexcept;
+    SubscribeResult Subscribe64Bit(SlotNumberType slot_count) noexcept;
+    void Unsubscribe64Bit(SlotNumberType slot_count) noexcept;
+
+    /// \brief holds the current number of subscribed slots and the number of current subscribers combined. Only used
+    ///        with SubscriptionControlWidth::k32Bit.
     std::atomic_uint32_t current_subscription_state_;
+    /// \brief holds the current number of subscribed slots and the number of current subscribers combined. Only used
+    ///        with SubscriptionControlWidth::k64Bit.
+    std::atomic_uint64_t current_wide_subscription_state_;
     const SlotNumberType max_subscribable_slots_;
     const SubscriberCountType max_subscribers_;
     const bool enforce_max_samples_;
+    const SubscriptionControlWidth subscription_control_width_;
 };
 
 std::string_view ToString(SubscribeResult subscribe_result) noexcept;
@@ -0,0 +1,112 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/event_subscription_control.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using SubscriptionControlWidth = EventSubscriptionControl<>::SubscriptionControlWidth;
+
+constexpr EventSubscriptionControl<>::SlotNumberType kSlotsPerSubscriber{1U};
+
+// Shared by all benchmark threads. It is (re)created by thread 0 before the benchmark loop, which google benchmark
+// only enters, after all threads have reached it.
+std::optional<EventSubscriptionControl<>> gSubscriptionControl{};
+std::atomic<std::uint64_t> gFailedSubscribes{0U};
+
+/// \brief All benchmark threads together repeatedly subscribe and unsubscribe max_subscribers consumers on one event.
+/// \details Mimics a large number of lightweight consumers (re)connecting to one hot event at the same time, e.g. after
+///          a provider restart. Each thread handles its share of the subscribers, so that the subscription state is
+///          always close to its limit and all threads contend on the same atomic state.
+void SubscribeUnsubscribeContention(benchmark::State& state,
+                                    const SubscriptionControlWidth subscription_control_width,
+                                    const EventSubscriptionControl<>::SubscriberCountType max_subscribers)
+{
+    if (state.thread_index() == 0)
+    {
+        gSubscriptionControl.emplace(static_cast<EventSubscriptionControl<>::SlotNumberType>(max_subscribers),
+                                     max_subscribers,
+                                     true,
+                                     subscription_control_width);
+        gFailedSubscribes = 0U;
+    }
+
+    const auto subscribers_per_thread =
+        static_cast<std::size_t>(max_subscribers) / static_cast<std::size_t>(state.threads());
+    std::uint64_t failed_subscribes{0U};
+    for (auto _ : state)
+    {
+        std::ignore = _;
+        std::size_t successful_subscribes{0U};
+        for (std::size_t subscriber = 0U; subscriber < subscribers_per_thread; ++subscriber)
+        {
+            if (gSubscriptionControl->Subscribe(kSlotsPerSubscriber) == SubscribeResult::kSuccess)
+            {
+                ++successful_subscribes;
+            }
+            else
+            {
+                ++failed_subscribes;
+            }
+        }
+        for (std::size_t subscriber = 0U; subscriber < successful_subscribes; ++subscriber)
+        {
+            gSubscriptionControl->Unsubscribe(kSlotsPerSubscriber);
+        }
+    }
+    gFailedSubscribes += failed_subscribes;
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(2U * subscribers_per_thread));
+    if (state.thread_index() == 0)
+    {
+        // The counter of thread 0 is the only one, which is non-zero, so that the summed up counter reports the
+        // failed subscribe calls of all threads. Since the other threads may still be running, the value is a lower
+        // bound.
+        state.counters["failed_subscribes"] =
+            benchmark::Counter(static_cast<double>(gFailedSubscribes.load()), benchmark::Counter::kAvgIterations);
+    }
+}
+
+void BM_Subscribe64Bit1000Subscribers(benchmark::State& state)
+{
+    SubscribeUnsubscribeContention(state, SubscriptionControlWidth::k64Bit, 1000U);
+}
+
+// The 32 bit subscription control is limited to 255 subscribers. It serves as the baseline of the CAS retry loop.
+void BM_Subscribe32Bit255Subscribers(benchmark::State& state)
+{
+    SubscribeUnsubscribeContention(state, SubscriptionControlWidth::k32Bit, 255U);
+}
+
+void BM_Subscribe64Bit255Subscribers(benchmark::State& state)
+{
+    SubscribeUnsubscribeContention(state, SubscriptionControlWidth::k64Bit, 255U);
+}
+
+BENCHMARK(BM_Subscribe64Bit1000Subscribers)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Subscribe32Bit255Subscribers)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Subscribe64Bit255Subscribers)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
+
+BENCHMARK_MAIN();
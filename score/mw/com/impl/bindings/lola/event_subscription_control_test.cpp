@@ -19,8 +19,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <random>
 #include <thread>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -233,6 +236,126 @@ TEST(EventSubscriptionControlDeathTest, Unsubscribe_SlotUnderflow_Dies)
     EXPECT_DEATH(unsubscribe_with_slot_underflow(), ".*");
 }
 
+using SubscriptionControlWidth = EventSubscriptionControl<>::SubscriptionControlWidth;
+
+TEST(EventSubscriptionControl64BitTest, SubscribeSupportsMoreThan255Subscribers)
+{
+    // Given a 64 bit unit with 1000 max subscribers
+    EventSubscriptionControl unit{1000U, 1000U, true, SubscriptionControlWidth::k64Bit};
+    EXPECT_EQ(unit.GetSubscriptionControlWidth(), SubscriptionControlWidth::k64Bit);
+
+    // expect, that 1000 subscribers can subscribe
+    for (auto subscriber = 0U; subscriber < 1000U; ++subscriber)
+    {
+        ASSERT_EQ(unit.Subscribe(1U), SubscribeResult::kSuccess);
+    }
+
+    // but expect, that an additional subscribe call overflowing max subscribers fails
+    EXPECT_EQ(unit.Subscribe(0U), SubscribeResult::kMaxSubscribersOverflow);
+
+    // and that a subscriber can subscribe again, after another one unsubscribed
+    unit.Unsubscribe(1U);
+    EXPECT_EQ(unit.Subscribe(1U), SubscribeResult::kSuccess);
+}
+
+TEST(EventSubscriptionControl64BitTest, RejectedSubscribeIsRolledBack)
+{
+    // Given a 64 bit unit with a given slot count and max subscribers
+    EventSubscriptionControl unit{20U, 3U, true, SubscriptionControlWidth::k64Bit};
+
+    // and all slots being subscribed
+    EXPECT_EQ(unit.Subscribe(20U), SubscribeResult::kSuccess);
+
+    // expect, that an additional subscribe call overflowing slot count fails
+    EXPECT_EQ(unit.Subscribe(1U), SubscribeResult::kSlotOverflow);
+    EXPECT_EQ(unit.Subscribe(1U), SubscribeResult::kSlotOverflow);
+
+    // and that after unsubscribing, the rejected calls did not occupy any subscriber or slot
+    unit.Unsubscribe(20U);
+    EXPECT_EQ(unit.Subscribe(10U), SubscribeResult::kSuccess);
+    EXPECT_EQ(unit.Subscribe(5U), SubscribeResult::kSuccess);
+    EXPECT_EQ(unit.Subscribe(5U), SubscribeResult::kSuccess);
+    EXPECT_EQ(unit.Subscribe(0U), SubscribeResult::kMaxSubscribersOverflow);
+}
+
+TEST(EventSubscriptionControl64BitTest, SubscribeNotEnforceMaxSamples)
+{
+    // Given a 64 bit unit, which doesn't enforce max samples
+    EventSubscriptionControl unit{20U, 3U, false, SubscriptionControlWidth::k64Bit};
+
+    // expect, that a subscribe call overflowing the slot count is successful
+    EXPECT_EQ(unit.Subscribe(20U), SubscribeResult::kSuccess);
+    EXPECT_EQ(unit.Subscribe(1U), SubscribeResult::kSuccess);
+}
+
+TEST(EventSubscriptionControl64BitTest, ConcurrentAccessNeverFailsWithinLimits)
+{
+    // Given a 64 bit unit, which can hold all concurrent subscribers
+    constexpr std::size_t kNumberOfThreads{8U};
+    EventSubscriptionControl unit{static_cast<std::uint16_t>(kNumberOfThreads * 5U),
+                                  static_cast<std::uint16_t>(kNumberOfThreads),
+                                  true,
+                                  SubscriptionControlWidth::k64Bit};
+
+    auto thread_action = [&unit]() -> void {
+        for (auto i = 0; i < 1000; ++i)
+        {
+            // expect, that no subscribe call fails, since there are no retries which could be exhausted
+            ASSERT_EQ(unit.Subscribe(5U), SubscribeResult::kSuccess);
+            unit.Unsubscribe(5U);
+        }
+    };
+
+    std::vector<std::thread> threads{};
+    for (std::size_t thread = 0U; thread < kNumberOfThreads; ++thread)
+    {
+        threads.emplace_back(thread_action);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // and that all subscribers are gone afterwards
+    for (std::size_t subscriber = 0U; subscriber < kNumberOfThreads; ++subscriber)
+    {
+        EXPECT_EQ(unit.Subscribe(5U), SubscribeResult::kSuccess);
+    }
+    EXPECT_EQ(unit.Subscribe(0U), SubscribeResult::kMaxSubscribersOverflow);
+}
+
+TEST(EventSubscriptionControl64BitDeathTest, Unsubscribe_SubscriberUnderflow_Dies)
+{
+    auto unsubscribe_without_subscribe = []() -> void {
+        // Given a 64 bit unit without any subscriber
+        EventSubscriptionControl unit{20U, 3U, true, SubscriptionControlWidth::k64Bit};
+        // If we unsubscribe
+        unit.Unsubscribe(0U);
+    };
+    // then expect, that we die.
+    EXPECT_DEATH(unsubscribe_without_subscribe(), ".*");
+}
+
+TEST(EventSubscriptionControl64BitDeathTest, Unsubscribe_SlotUnderflow_Dies)
+{
+    auto unsubscribe_with_slot_underflow = []() -> void {
+        // Given a 64 bit unit with one subscriber
+        EventSubscriptionControl unit{20U, 3U, true, SubscriptionControlWidth::k64Bit};
+        EXPECT_EQ(unit.Subscribe(5U), SubscribeResult::kSuccess);
+        // and if we unsubscribe, with a higher number of slot than subscribed
+        unit.Unsubscribe(6U);
+    };
+    // then expect, that we die.
+    EXPECT_DEATH(unsubscribe_with_slot_underflow(), ".*");
+}
+
+TEST(EventSubscriptionControlDeathTest, CreatingA32BitUnitWithMoreThan255SubscribersDies)
+{
+    // When creating a 32 bit unit with more subscribers than its state can hold
+    // then expect, that we die.
+    EXPECT_DEATH((EventSubscriptionControl{20U, 256U, true, SubscriptionControlWidth::k32Bit}), ".*");
+}
+
 TEST(EventSubscriptionControlTest, ToStringShouldReturnExpectedStringForAllSubscribeResultTypes)
 {
     // When converting each enum value to string
@@ -16,12 +16,14 @@
 ///
 
 #include "score/mw/com/impl/bindings/lola/generic_proxy_event.h"
+#include "score/mw/com/impl/bindings/lola/sample_prefetch.h"
 
 #include "score/language/safecpp/safe_math/safe_math.h"
 #include "score/memory/shared/pointer_arithmetic_util.h"
 #include "score/mw/log/logging.h"
 
 #include <score/assert.hpp>
+#include <score/utility.hpp>
 
 namespace score::mw::com::impl::lola
 {
@@ -29,7 +31,8 @@ namespace score::mw::com::impl::lola
 GenericProxyEvent::GenericProxyEvent(Proxy& parent, const ElementFqId element_fq_id, const std::string_view event_name)
     : GenericProxyEventBinding{},
       proxy_event_common_{parent, element_fq_id, event_name},
-      meta_info_{parent.GetEventMetaInfo(element_fq_id)}
+      meta_info_{parent.GetEventMetaInfo(element_fq_id)},
+      prefetch_bytes_{parent.GetPrefetchBytes(event_name)}
 {
     parent.RegisterEvent(event_name, *this);
 }
@@ -108,6 +111,17 @@ Result<void> GenericProxyEvent::UnsetSubscriptionStateChangeHandler() noexcept
     return proxy_event_common_.UnsetSubscriptionStateChangeHandler();
 }
 
+Result<void> GenericProxyEvent::SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                                         DeadlineMissedHandler handler) noexcept
+{
+    return proxy_event_common_.SetDeadlineMissedHandler(expected_period, std::move(handler));
+}
+
+Result<void> GenericProxyEvent::UnsetDeadlineMissedHandler() noexcept
+{
+    return proxy_event_common_.UnsetDeadlineMissedHandler();
+}
+
 pid_t GenericProxyEvent::GetEventSourcePid() const noexcept
 {
     return proxy_event_common_.GetEventSourcePid();
@@ -156,6 +170,21 @@ Result<std::size_t> GenericProxyEvent::GetNewSamplesImpl(Callback&& receiver, Tr
 
     const void* const event_slots_raw_array = meta_info_.event_slots_raw_array_.get(event_slots_raw_array_size.value());
 
+    // The prefetch hints for all samples are issued up front, so that their cache lines get loaded, while the samples
+    // are referenced and handed out one by one below.
+    if (prefetch_bytes_ > 0U)
+    {
+        // coverity[autosar_cpp14_m5_2_8_violation] See the slot lookup below.
+        const auto* const event_slots_array = static_cast<const std::uint8_t*>(event_slots_raw_array);
+        for (auto slot_it = slot_indices.begin; slot_it != slot_indices.end; ++slot_it)
+        {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) See the slot lookup below.
+            const auto* const object_start_address = &event_slots_array[aligned_size * (*slot_it)];
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            score::cpp::ignore = PrefetchSample(object_start_address, sample_size, prefetch_bytes_);
+        }
+    }
+
     // AMP assert that the event_slots_raw_array address is according to sample_alignment
     for (auto slot_it = slot_indices.begin; slot_it != slot_indices.end; ++slot_it)
     {
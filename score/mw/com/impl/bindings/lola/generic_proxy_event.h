@@ -70,6 +70,9 @@ class GenericProxyEvent final : public GenericProxyEventBinding
     Result<void> UnsetReceiveHandler() noexcept override;
     Result<void> SetSubscriptionStateChangeHandler(SubscriptionStateChangeHandler handler) noexcept override;
     Result<void> UnsetSubscriptionStateChangeHandler() noexcept override;
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                          DeadlineMissedHandler handler) noexcept override;
+    Result<void> UnsetDeadlineMissedHandler() noexcept override;
 
     pid_t GetEventSourcePid() const noexcept;
     ElementFqId GetElementFQId() const noexcept;
@@ -86,6 +89,7 @@ class GenericProxyEvent final : public GenericProxyEventBinding
 
     ProxyEventCommon proxy_event_common_;
     const EventMetaInfo& meta_info_;
+    const std::size_t prefetch_bytes_;
 };
 
 }  // namespace score::mw::com::impl::lola
@@ -13,9 +13,11 @@
 #ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_I_RUNTIME_H
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_I_RUNTIME_H
 
+#include "score/mw/com/impl/bindings/lola/deadline_monitor.h"
 #include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "score/mw/com/impl/bindings/lola/rollback_synchronization.h"
 #include "score/mw/com/impl/configuration/global_configuration.h"
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
 #include "score/mw/com/impl/configuration/shm_size_calc_mode.h"
 #include "score/mw/com/impl/i_binding_runtime.h"
 
@@ -42,8 +44,14 @@ class IRuntime : public impl::IBindingRuntime
     /// \brief returns configured mode, how shm-sizes shall be calculated.
     virtual ShmSizeCalculationMode GetShmSizeCalculationMode() const noexcept = 0;
 
+    /// \brief returns configured mode, whether the pages of shm-objects shall be faulted in (and locked) upfront.
+    virtual ShmPrefaultMode GetShmPrefaultMode() const noexcept = 0;
+
     virtual RollbackSynchronization& GetRollbackSynchronization() & noexcept = 0;
 
+    /// \brief returns the runtime-wide monitor for the deadlines of periodic events on proxy side.
+    virtual DeadlineMonitor& GetDeadlineMonitor() & noexcept = 0;
+
     /// \brief We need our PID in several locations/frequently. So the runtime shall provide/cache it.
     virtual pid_t GetPid() const noexcept = 0;
 
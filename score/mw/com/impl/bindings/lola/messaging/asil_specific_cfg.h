@@ -3,6 +3,7 @@
 
 #include <unistd.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -18,6 +19,16 @@ struct AsilSpecificCfg
     std::int32_t message_queue_rx_size_;
     // coverity[autosar_cpp14_m11_0_1_violation]
     std::vector<uid_t> allowed_user_ids_;
+    /// \brief Number of events/fields, for which event update notification registrations are preallocated.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t max_notification_events_{16U};
+    /// \brief Number of remote nodes per event, for which update notification registrations are preallocated.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t max_remote_nodes_per_event_{8U};
+    /// \brief Number of worker threads dispatching method calls of proxies in other processes by priority. If 0, these
+    ///        method calls are executed on the message passing thread in order of arrival.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::size_t method_call_worker_threads_{0U};
 };
 }  // namespace score::mw::com::impl::lola
 
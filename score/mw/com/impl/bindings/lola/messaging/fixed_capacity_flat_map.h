@@ -0,0 +1,256 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_FIXED_CAPACITY_FLAT_MAP_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_FIXED_CAPACITY_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Sorted, contiguous set with storage preallocated at construction.
+/// \details Insertion and removal only move elements within the preallocated storage, so they do not allocate as long
+///          as size() stays below the capacity given at construction. If the capacity is exceeded, the storage grows
+///          like a std::vector. Callers, which need allocation free operation, shall check IsFull() before inserting.
+///          Iterators are invalidated by insert() and erase().
+template <typename T, typename Compare = std::less<T>>
+class FixedCapacityFlatSet
+{
+    using StorageType = std::vector<T>;
+
+  public:
+    using value_type = T;
+    using size_type = typename StorageType::size_type;
+    using iterator = typename StorageType::iterator;
+    using const_iterator = typename StorageType::const_iterator;
+
+    explicit FixedCapacityFlatSet(const size_type capacity) : storage_{}
+    {
+        storage_.reserve(capacity);
+    }
+
+    std::pair<iterator, bool> insert(const T& value)
+    {
+        const auto position = std::lower_bound(storage_.begin(), storage_.end(), value, Compare{});
+        if ((position != storage_.end()) && (!Compare{}(value, *position)))
+        {
+            return {position, false};
+        }
+        return {storage_.insert(position, value), true};
+    }
+
+    size_type erase(const T& value)
+    {
+        const auto position = std::lower_bound(storage_.begin(), storage_.end(), value, Compare{});
+        if ((position == storage_.end()) || Compare{}(value, *position))
+        {
+            return 0U;
+        }
+        static_cast<void>(storage_.erase(position));
+        return 1U;
+    }
+
+    const_iterator lower_bound(const T& value) const
+    {
+        return std::lower_bound(storage_.cbegin(), storage_.cend(), value, Compare{});
+    }
+
+    const_iterator find(const T& value) const
+    {
+        const auto position = lower_bound(value);
+        if ((position != storage_.cend()) && (!Compare{}(value, *position)))
+        {
+            return position;
+        }
+        return storage_.cend();
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return storage_.cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return storage_.cend();
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return storage_.cbegin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return storage_.cend();
+    }
+
+    bool empty() const noexcept
+    {
+        return storage_.empty();
+    }
+    size_type size() const noexcept
+    {
+        return storage_.size();
+    }
+    size_type capacity() const noexcept
+    {
+        return storage_.capacity();
+    }
+
+    /// \brief Whether the next insertion of a new element would exceed the preallocated storage.
+    bool IsFull() const noexcept
+    {
+        return storage_.size() == storage_.capacity();
+    }
+
+  private:
+    StorageType storage_;
+};
+
+/// \brief Sorted, contiguous map with storage preallocated at construction.
+/// \details Same allocation behaviour as FixedCapacityFlatSet: lookup is a binary search, try_emplace()/erase() move
+///          elements within the preallocated storage. The key type needs to be less-than comparable via Compare.
+///          Iterators and references to elements are invalidated by try_emplace() and erase().
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FixedCapacityFlatMap
+{
+    using StorageType = std::vector<std::pair<Key, T>>;
+
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = typename StorageType::size_type;
+    using iterator = typename StorageType::iterator;
+    using const_iterator = typename StorageType::const_iterator;
+
+    explicit FixedCapacityFlatMap(const size_type capacity) : storage_{}
+    {
+        storage_.reserve(capacity);
+    }
+
+    /// \brief Inserts a new element with key _key_ and a mapped value constructed from _args_, if the key does not
+    ///        exist yet. Otherwise nothing happens.
+    /// \return iterator to the element with the given key and whether it has been inserted.
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        const auto position = LowerBound(key);
+        if ((position != storage_.end()) && (!Compare{}(key, position->first)))
+        {
+            return {position, false};
+        }
+        const auto inserted = storage_.emplace(position,
+                                               std::piecewise_construct,
+                                               std::forward_as_tuple(key),
+                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        return {inserted, true};
+    }
+
+    iterator find(const Key& key)
+    {
+        const auto position = LowerBound(key);
+        if ((position != storage_.end()) && (!Compare{}(key, position->first)))
+        {
+            return position;
+        }
+        return storage_.end();
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        const auto position = LowerBound(key);
+        if ((position != storage_.cend()) && (!Compare{}(key, position->first)))
+        {
+            return position;
+        }
+        return storage_.cend();
+    }
+
+    iterator erase(const const_iterator position)
+    {
+        return storage_.erase(position);
+    }
+
+    size_type erase(const Key& key)
+    {
+        const auto position = find(key);
+        if (position == storage_.end())
+        {
+            return 0U;
+        }
+        static_cast<void>(storage_.erase(position));
+        return 1U;
+    }
+
+    iterator begin() noexcept
+    {
+        return storage_.begin();
+    }
+    iterator end() noexcept
+    {
+        return storage_.end();
+    }
+    const_iterator begin() const noexcept
+    {
+        return storage_.cbegin();
+    }
+    const_iterator end() const noexcept
+    {
+        return storage_.cend();
+    }
+
+    bool empty() const noexcept
+    {
+        return storage_.empty();
+    }
+    size_type size() const noexcept
+    {
+        return storage_.size();
+    }
+    size_type capacity() const noexcept
+    {
+        return storage_.capacity();
+    }
+
+    /// \brief Whether the next insertion of a new key would exceed the preallocated storage.
+    bool IsFull() const noexcept
+    {
+        return storage_.size() == storage_.capacity();
+    }
+
+  private:
+    static bool KeyLess(const value_type& element, const Key& key) noexcept
+    {
+        return Compare{}(element.first, key);
+    }
+
+    iterator LowerBound(const Key& key)
+    {
+        return std::lower_bound(storage_.begin(), storage_.end(), key, &FixedCapacityFlatMap::KeyLess);
+    }
+
+    const_iterator LowerBound(const Key& key) const
+    {
+        return std::lower_bound(storage_.cbegin(), storage_.cend(), key, &FixedCapacityFlatMap::KeyLess);
+    }
+
+    StorageType storage_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_FIXED_CAPACITY_FLAT_MAP_H
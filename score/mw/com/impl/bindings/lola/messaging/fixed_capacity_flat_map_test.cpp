@@ -0,0 +1,204 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/messaging/fixed_capacity_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+TEST(FixedCapacityFlatSetTest, ConstructionPreallocatesCapacity)
+{
+    // When constructing a set with a capacity of 10
+    FixedCapacityFlatSet<int> unit{10U};
+
+    // Then it is empty but has the capacity preallocated
+    EXPECT_TRUE(unit.empty());
+    EXPECT_GE(unit.capacity(), 10U);
+    EXPECT_FALSE(unit.IsFull());
+}
+
+TEST(FixedCapacityFlatSetTest, InsertKeepsElementsSortedAndUnique)
+{
+    // Given an empty set
+    FixedCapacityFlatSet<int> unit{5U};
+
+    // When inserting elements out of order and one duplicate
+    EXPECT_TRUE(unit.insert(3).second);
+    EXPECT_TRUE(unit.insert(1).second);
+    EXPECT_TRUE(unit.insert(2).second);
+    const auto duplicate = unit.insert(2);
+
+    // Then the duplicate is rejected and points to the existing element
+    EXPECT_FALSE(duplicate.second);
+    EXPECT_EQ(*duplicate.first, 2);
+
+    // and the elements are sorted
+    const std::vector<int> elements{unit.cbegin(), unit.cend()};
+    EXPECT_EQ(elements, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(FixedCapacityFlatSetTest, EraseReturnsNumberOfErasedElements)
+{
+    // Given a set with two elements
+    FixedCapacityFlatSet<int> unit{5U};
+    unit.insert(1);
+    unit.insert(2);
+
+    // When erasing an existing and a non existing element
+    // Then only the existing one is reported as erased
+    EXPECT_EQ(unit.erase(1), 1U);
+    EXPECT_EQ(unit.erase(7), 0U);
+    EXPECT_EQ(unit.size(), 1U);
+    EXPECT_EQ(unit.find(1), unit.cend());
+    EXPECT_NE(unit.find(2), unit.cend());
+}
+
+TEST(FixedCapacityFlatSetTest, LowerBoundReturnsFirstElementNotLessThanValue)
+{
+    // Given a set with gaps between its elements
+    FixedCapacityFlatSet<int> unit{5U};
+    unit.insert(10);
+    unit.insert(20);
+    unit.insert(30);
+
+    // Then lower_bound behaves like the one of std::set
+    EXPECT_EQ(*unit.lower_bound(5), 10);
+    EXPECT_EQ(*unit.lower_bound(20), 20);
+    EXPECT_EQ(*unit.lower_bound(21), 30);
+    EXPECT_EQ(unit.lower_bound(31), unit.cend());
+}
+
+TEST(FixedCapacityFlatSetTest, ChurnWithinCapacityDoesNotReallocate)
+{
+    // Given a set with a capacity of 4
+    FixedCapacityFlatSet<int> unit{4U};
+    unit.insert(0);
+    const auto* const storage_before = &*unit.cbegin();
+
+    // When repeatedly inserting and erasing elements without exceeding the capacity
+    for (int round = 0; round < 100; ++round)
+    {
+        unit.insert(3);
+        unit.insert(2);
+        unit.insert(1);
+        EXPECT_TRUE(unit.IsFull());
+        unit.erase(2);
+        unit.erase(3);
+        unit.erase(1);
+    }
+
+    // Then the storage has not been moved
+    EXPECT_EQ(&*unit.cbegin(), storage_before);
+}
+
+TEST(FixedCapacityFlatSetTest, InsertingBeyondCapacityStillSucceeds)
+{
+    // Given a full set
+    FixedCapacityFlatSet<int> unit{1U};
+    unit.insert(1);
+    ASSERT_TRUE(unit.IsFull());
+
+    // When inserting another element
+    const auto result = unit.insert(2);
+
+    // Then the insertion succeeds by growing the storage
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(unit.size(), 2U);
+}
+
+TEST(FixedCapacityFlatMapTest, TryEmplaceInsertsOnlyNewKeys)
+{
+    // Given an empty map
+    FixedCapacityFlatMap<int, std::string> unit{4U};
+
+    // When emplacing two values for the same key
+    const auto first = unit.try_emplace(1, "one");
+    const auto second = unit.try_emplace(1, "uno");
+
+    // Then only the first one is inserted
+    EXPECT_TRUE(first.second);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(unit.find(1)->second, "one");
+    EXPECT_EQ(unit.size(), 1U);
+}
+
+TEST(FixedCapacityFlatMapTest, FindReturnsEndForUnknownKey)
+{
+    // Given a map with some elements
+    FixedCapacityFlatMap<int, int> unit{4U};
+    unit.try_emplace(3, 30);
+    unit.try_emplace(1, 10);
+
+    // Then find() only finds existing keys
+    const auto& const_unit = unit;
+    EXPECT_EQ(unit.find(2), unit.end());
+    EXPECT_EQ(const_unit.find(2), const_unit.end());
+    EXPECT_EQ(const_unit.find(3)->second, 30);
+}
+
+TEST(FixedCapacityFlatMapTest, IterationIsOrderedByKey)
+{
+    // Given a map filled out of order
+    FixedCapacityFlatMap<int, int> unit{4U};
+    unit.try_emplace(3, 30);
+    unit.try_emplace(1, 10);
+    unit.try_emplace(2, 20);
+
+    // Then iteration visits the keys in ascending order
+    std::vector<int> keys{};
+    for (const auto& element : unit)
+    {
+        keys.push_back(element.first);
+    }
+    EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(FixedCapacityFlatMapTest, EraseByKeyAndIterator)
+{
+    // Given a map with three elements
+    FixedCapacityFlatMap<int, int> unit{4U};
+    unit.try_emplace(1, 10);
+    unit.try_emplace(2, 20);
+    unit.try_emplace(3, 30);
+
+    // When erasing one element by key and one by iterator
+    EXPECT_EQ(unit.erase(2), 1U);
+    EXPECT_EQ(unit.erase(2), 0U);
+    unit.erase(unit.find(1));
+
+    // Then only the remaining element is left
+    ASSERT_EQ(unit.size(), 1U);
+    EXPECT_EQ(unit.begin()->first, 3);
+}
+
+TEST(FixedCapacityFlatMapTest, MappedValueCanBeConstructedFromArguments)
+{
+    // Given a map, whose mapped values are themselves flat sets
+    FixedCapacityFlatMap<int, FixedCapacityFlatSet<int>> unit{2U};
+
+    // When emplacing a value constructed from its capacity
+    const auto result = unit.try_emplace(1, 8U);
+
+    // Then the nested set has the requested capacity
+    ASSERT_TRUE(result.second);
+    EXPECT_GE(result.first->second.capacity(), 8U);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -15,6 +15,7 @@
 
 #include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/messaging/method_call_registration_guard.h"
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduling_cfg.h"
 #include "score/mw/com/impl/bindings/lola/messaging/method_subscription_registration_guard.h"
 #include "score/mw/com/impl/bindings/lola/messaging/method_unsubscription_registration_guard.h"
 #include "score/mw/com/impl/bindings/lola/methods/proxy_method_instance_identifier.h"
@@ -251,11 +252,14 @@ class IMessagePassingService
     /// \param allowed_proxy_uid The uid of the proxy process which can call the registered handler. Since we register a
     ///        method call handler per ProxyMethod, we can restrict the caller of the handler to the ProxyMethod who
     ///        registered it.
+    /// \param scheduling_cfg Priority and concurrency limit, with which calls of proxies in other processes get
+    ///        dispatched to the handler.
     virtual Result<MethodCallRegistrationGuard> RegisterMethodCallHandler(
         const QualityType asil_level,
         const ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
         MethodCallHandler method_call_callback,
-        const uid_t allowed_proxy_uid) = 0;
+        const uid_t allowed_proxy_uid,
+        const MethodCallSchedulingCfg scheduling_cfg) = 0;
 
     /// \brief Notify given target_node_id about outdated_node_id being an old/not to be used node identifier.
     /// \details This is used by LoLa proxy instances during creation, when they detect, that they are re-starting
@@ -60,7 +60,8 @@ class IMessagePassingServiceInstance
 
     virtual Result<void> RegisterMethodCallHandler(const ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
                                                    IMessagePassingService::MethodCallHandler method_call_callback,
-                                                   const uid_t allowed_proxy_uid) = 0;
+                                                   const uid_t allowed_proxy_uid,
+                                                   const MethodCallSchedulingCfg scheduling_cfg) = 0;
 
     virtual void UnregisterOnServiceMethodSubscribedHandler(
         SkeletonInstanceIdentifier skeleton_instance_identifier) = 0;
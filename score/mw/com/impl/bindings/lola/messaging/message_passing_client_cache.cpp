@@ -20,6 +20,7 @@
 
 #include <score/assert.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -36,55 +37,135 @@ constexpr auto mq_name_prefix_mpcc("LoLa_2_");
 constexpr auto mq_name_qm_postfix_mpcc("_QM");
 constexpr auto mq_name_asil_b_postfix_mpcc("_ASIL_B");
 
-constexpr std::uint32_t kMaxSendSize{32U};
 constexpr std::uint32_t kMaxReplySize{32U};
 
 constexpr std::uint32_t kStateTryAttempts{10U};
 constexpr std::chrono::milliseconds kStateRetryDelay{50};
 
+using State = score::message_passing::IClientConnection::State;
+
 }  // namespace
 
 MessagePassingClientCache::MessagePassingClientCache(const ClientQualityType asil_level,
-                                                     score::message_passing::IClientFactory& client_factory) noexcept
-    : asil_level_{asil_level}, client_factory_{client_factory}, clients_{}, mutex_{}
+                                                     score::message_passing::IClientFactory& client_factory,
+                                                     const ConnectingPeerPolicy connecting_peer_policy) noexcept
+    : asil_level_{asil_level},
+      client_factory_{client_factory},
+      connecting_peer_policy_{connecting_peer_policy},
+      clients_{},
+      mutex_{}
 {
 }
 
-std::shared_ptr<score::message_passing::IClientConnection>
-MessagePassingClientCache::UnlockedGetCachedMessagePassingClient(const pid_t target_node_id) noexcept
+std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientCache::GetCachedMessagePassingClient(
+    const pid_t target_node_id) noexcept
 {
+    std::lock_guard<std::mutex> lck(mutex_);
     auto search = clients_.find(target_node_id);
     if (search != clients_.end())
     {
-        return search->second;
+        return search->second->connection;
     }
 
     return nullptr;
 }
 
-std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientCache::GetCachedMessagePassingClient(
+std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientCache::GetMessagePassingClient(
     const pid_t target_node_id) noexcept
 {
-    std::lock_guard<std::mutex> lck(mutex_);
-    return UnlockedGetCachedMessagePassingClient(target_node_id);
+    const auto peer = GetOrCreatePeerConnection(target_node_id);
+    // the cache mutex is not held here, so only the callers for this node wait for the connection
+    WaitUntilConnected(*peer, target_node_id);
+    return peer->connection;
 }
 
-std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientCache::GetMessagePassingClient(
+score::cpp::expected_blank<score::os::Error> MessagePassingClientCache::Send(
+    const pid_t target_node_id,
+    const score::cpp::span<const std::uint8_t> message,
+    const PriorityClass priority_class) noexcept
+{
+    const auto peer = GetOrCreatePeerConnection(target_node_id);
+    return SendToPeer(*peer, message, priority_class);
+}
+
+score::cpp::expected_blank<score::os::Error> MessagePassingClientCache::SendIfConnectionExists(
+    const pid_t target_node_id,
+    const score::cpp::span<const std::uint8_t> message,
+    const PriorityClass priority_class) noexcept
+{
+    std::shared_ptr<PeerConnection> peer{};
+    {
+        std::lock_guard<std::mutex> lck(mutex_);
+        const auto search = clients_.find(target_node_id);
+        if (search != clients_.end())
+        {
+            const auto state = search->second->connection->GetState();
+            if ((state == State::kReady) || (state == State::kStarting))
+            {
+                peer = search->second;
+            }
+        }
+    }
+    if (peer == nullptr)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOTCONN));
+    }
+    return SendToPeer(*peer, message, priority_class);
+}
+
+score::cpp::expected_blank<score::os::Error> MessagePassingClientCache::SendToPeer(
+    PeerConnection& peer,
+    const score::cpp::span<const std::uint8_t> message,
+    const PriorityClass priority_class) noexcept
+{
+    std::lock_guard<std::mutex> peer_lock{peer.mutex};
+    if (peer.connection->GetState() != State::kStarting)
+    {
+        // Ready, or failed in which case the connection reports the error. Earlier messages go first in either case.
+        FlushPendingSendsUnderLock(peer);
+        return peer.connection->SendWithPriority(message, priority_class);
+    }
+
+    if (connecting_peer_policy_ == ConnectingPeerPolicy::kReject)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EAGAIN));
+    }
+    if (message.size() > kMaxSendSize)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(EMSGSIZE));
+    }
+    // the last kReservedPendingControlSends entries are kept for control messages
+    const std::size_t max_pending_sends = (priority_class == PriorityClass::kControl)
+                                              ? kMaxPendingSends
+                                              : (kMaxPendingSends - kReservedPendingControlSends);
+    if (peer.pending_send_count >= max_pending_sends)
+    {
+        return score::cpp::make_unexpected(score::os::Error::createFromErrno(ENOBUFS));
+    }
+    auto& pending_send = peer.pending_sends[peer.pending_send_count];
+    score::cpp::ignore = std::copy(message.begin(), message.end(), pending_send.payload.begin());
+    pending_send.size = message.size();
+    pending_send.priority_class = priority_class;
+    ++peer.pending_send_count;
+    return {};
+}
+
+std::shared_ptr<MessagePassingClientCache::PeerConnection> MessagePassingClientCache::GetOrCreatePeerConnection(
     const pid_t target_node_id) noexcept
 {
     std::lock_guard<std::mutex> lck(mutex_);
 
-    const auto cached_client = UnlockedGetCachedMessagePassingClient(target_node_id);
-    if (cached_client != nullptr)
+    auto search = clients_.find(target_node_id);
+    if (search != clients_.end())
     {
+        const auto& cached_client = search->second->connection;
         const auto state = cached_client->GetState();
-        if (state == score::message_passing::IClientConnection::State::kReady)
+        // A starting connection keeps retrying to connect in the background, so it is kept.
+        if ((state == State::kReady) || (state == State::kStarting))
         {
-            return cached_client;
+            return search->second;
         }
-        // Evict a cached client that is not in kReady state. This covers:
-        // - kStopped/kStopping: connection was lost (e.g. peer was SIGKILL'd)
-        // - kStarting: connection was cached after CreateNewClient's 500ms timeout but never became ready
+        // Evict a cached client which is kStopped/kStopping: connection was lost (e.g. peer was SIGKILL'd)
         score::mw::log::LogWarn("lola") << "MessagePassingClientCache: Evicting non-ready client for node "
                                         << target_node_id
                                         << " (state=" << static_cast<std::uint32_t>(score::cpp::to_underlying(state))
@@ -92,22 +173,22 @@ std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientC
                                         << static_cast<std::uint32_t>(
                                                score::cpp::to_underlying(cached_client->GetStopReason()))
                                         << ")";
+        // Stop() is non-blocking. The peer mutex is not held, as Stop() calls the state callback synchronously.
         cached_client->Stop();
-        score::cpp::ignore = clients_.erase(target_node_id);
+        score::cpp::ignore = clients_.erase(search);
         // Fall through to create a new client below
     }
 
-    // create the OS specific sender
-    auto new_sender = CreateNewClient(target_node_id);
+    auto new_peer = CreatePeerConnection(target_node_id);
 
-    auto elem = clients_.emplace(target_node_id, new_sender);
+    auto elem = clients_.emplace(target_node_id, new_peer);
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
-        elem.second, "MessagePassingClientCache::GetMessagePassingClient(): Failed to emplace Client!");
+        elem.second, "MessagePassingClientCache::GetOrCreatePeerConnection(): Failed to emplace Client!");
 
     return elem.first->second;
 }
 
-std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientCache::CreateNewClient(
+std::shared_ptr<MessagePassingClientCache::PeerConnection> MessagePassingClientCache::CreatePeerConnection(
     const pid_t target_node_id) noexcept
 {
     const std::string service_identifier = CreateMessagePassingName(asil_level_, target_node_id);
@@ -115,7 +196,16 @@ std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientC
     const bool fully_async = asil_level_ == ClientQualityType::kASIL_QMfromB;
     const score::message_passing::ServiceProtocolConfig protocol_config{
         service_identifier, kMaxSendSize, kMaxReplySize, 0U};
-    const score::message_passing::IClientFactory::ClientConfig client_config{0U, 20U, false, fully_async, false};
+    // Control messages get their own queue budget and are dispatched first. Notifications (kBulk) and all the other
+    // messages share the common budget.
+    const score::message_passing::IClientFactory::ClientConfig client_config{
+        0U,
+        20U,
+        false,
+        fully_async,
+        false,
+        {{{kReservedQueuedControlSends, 1U}, {0U, 1U}, {0U, 1U}}},
+        score::message_passing::IClientFactory::ClientConfig::PriorityDispatch::kStrict};
 
     auto new_sender_unique_p = client_factory_.Create(protocol_config, client_config);
 
@@ -123,57 +213,135 @@ std::shared_ptr<score::message_passing::IClientConnection> MessagePassingClientC
     // TODO: PMR
     // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function shall
     // have automatic storage duration".
-    // The object will be emplaced into the senders map, so we need to allocate it in the heap.
+    // The objects will be emplaced into the senders map, so we need to allocate them in the heap.
     // coverity[autosar_cpp14_a18_5_8_violation]
-    std::shared_ptr<score::message_passing::IClientConnection> new_sender{new_sender_unique_p.release(), deleter};
+    auto new_peer = std::make_shared<PeerConnection>();
+    new_peer->connection =
+        std::shared_ptr<score::message_passing::IClientConnection>{new_sender_unique_p.release(), deleter};
 
-    new_sender->Start(score::message_passing::IClientConnection::StateCallback{},
-                      score::message_passing::IClientConnection::NotifyCallback{});
+    // Start() is non-blocking, the connection is established in the background. The state callback only holds a weak
+    // reference, as the connection may outlive the cache entry.
+    new_peer->connection->Start(
+        [weak_peer = std::weak_ptr<PeerConnection>{new_peer}](const State state) noexcept {
+            OnStateChanged(weak_peer, state);
+        },
+        score::message_passing::IClientConnection::NotifyCallback{});
+    return new_peer;
+}
+
+void MessagePassingClientCache::WaitUntilConnected(PeerConnection& peer, const pid_t target_node_id) noexcept
+{
+    std::unique_lock<std::mutex> peer_lock{peer.mutex};
     for (std::uint32_t try_attempt{0U}; try_attempt < kStateTryAttempts; ++try_attempt)
     {
-        const auto state = new_sender->GetState();
-        if (state == score::message_passing::IClientConnection::State::kReady)
+        const auto state = peer.connection->GetState();
+        if (state == State::kReady)
         {
-            return new_sender;
+            // queued messages shall not be overtaken by the message the caller is about to send
+            FlushPendingSendsUnderLock(peer);
+            return;
         }
-        if (state != score::message_passing::IClientConnection::State::kStarting)
+        if (state != State::kStarting)
         {
             score::mw::log::LogError("lola")
-                << "MessagePassingClientCache: Connection for " << service_identifier
+                << "MessagePassingClientCache: Connection for " << CreateMessagePassingName(asil_level_, target_node_id)
                 << " has failed to create, the reason is "
-                << static_cast<std::uint32_t>(score::cpp::to_underlying(new_sender->GetStopReason()));
-            return new_sender;
+                << static_cast<std::uint32_t>(score::cpp::to_underlying(peer.connection->GetStopReason()));
+            return;
         }
-        std::this_thread::sleep_for(kStateRetryDelay);
+        // woken up early by OnStateChanged(), the timeout only covers connections without state callback
+        score::cpp::ignore = peer.state_changed.wait_for(peer_lock, kStateRetryDelay);
     }
 
-    score::mw::log::LogError("lola") << "MessagePassingClientCache: Connection for " << service_identifier
+    score::mw::log::LogError("lola") << "MessagePassingClientCache: Connection for "
+                                     << CreateMessagePassingName(asil_level_, target_node_id)
                                      << " takes too long to create, might be not working";
-    return new_sender;
 }
 
-void MessagePassingClientCache::RemoveMessagePassingClient(const pid_t target_node_id) noexcept
+void MessagePassingClientCache::OnStateChanged(const std::weak_ptr<PeerConnection>& weak_peer,
+                                               const State state) noexcept
 {
-    std::lock_guard<std::mutex> lck(mutex_);
-
-    auto search = clients_.find(target_node_id);
-    if (search != clients_.end())
+    if ((state != State::kReady) && (state != State::kStopped))
     {
-        search->second->Stop();
-        std::uint32_t try_attempt{0U};
-        while (search->second->GetState() != score::message_passing::IClientConnection::State::kStopped)
+        // kStarting is reported synchronously from within Start() and kStopping from within Stop()
+        return;
+    }
+    const auto peer = weak_peer.lock();
+    if (peer == nullptr)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> peer_lock{peer->mutex};
+    if (state == State::kReady)
+    {
+        FlushPendingSendsUnderLock(*peer);
+    }
+    else if (peer->pending_send_count != 0U)
+    {
+        score::mw::log::LogWarn("lola") << "MessagePassingClientCache: Dropping " << peer->pending_send_count
+                                        << " queued messages, as the connection has stopped before becoming ready";
+        peer->pending_send_count = 0U;
+    }
+    else
+    {
+        // nothing queued
+    }
+    peer->state_changed.notify_all();
+}
+
+void MessagePassingClientCache::FlushPendingSendsUnderLock(PeerConnection& peer) noexcept
+{
+    // Queued control messages go first, the order within each priority class is kept.
+    const auto flush_pending_sends = [&peer](const bool control_messages) noexcept {
+        for (std::size_t index = 0U; index < peer.pending_send_count; ++index)
         {
-            ++try_attempt;
-            if (try_attempt >= kStateTryAttempts)
+            const auto& pending_send = peer.pending_sends[index];
+            if ((pending_send.priority_class == PriorityClass::kControl) != control_messages)
+            {
+                continue;
+            }
+            const auto result = peer.connection->SendWithPriority({pending_send.payload.data(), pending_send.size},
+                                                                  pending_send.priority_class);
+            if (!result.has_value())
             {
-                score::mw::log::LogFatal("lola") << "MessagePassingClientCache: Cannot close connection to target "
-                                                 << target_node_id << " in reasonable time";
-                std::terminate();
+                score::mw::log::LogError("lola")
+                    << "MessagePassingClientCache: Sending queued message failed with error: " << result.error();
             }
-            std::this_thread::sleep_for(kStateRetryDelay);
         }
+    };
+    flush_pending_sends(true);
+    flush_pending_sends(false);
+    peer.pending_send_count = 0U;
+}
+
+void MessagePassingClientCache::RemoveMessagePassingClient(const pid_t target_node_id) noexcept
+{
+    std::shared_ptr<PeerConnection> peer{};
+    {
+        std::lock_guard<std::mutex> lck(mutex_);
+        auto search = clients_.find(target_node_id);
+        if (search == clients_.end())
+        {
+            return;
+        }
+        peer = std::move(search->second);
         score::cpp::ignore = clients_.erase(search);
     }
+
+    // waiting for the connection to stop only blocks the caller, not the users of other connections
+    peer->connection->Stop();
+    std::uint32_t try_attempt{0U};
+    while (peer->connection->GetState() != State::kStopped)
+    {
+        ++try_attempt;
+        if (try_attempt >= kStateTryAttempts)
+        {
+            score::mw::log::LogFatal("lola") << "MessagePassingClientCache: Cannot close connection to target "
+                                             << target_node_id << " in reasonable time";
+            std::terminate();
+        }
+        std::this_thread::sleep_for(kStateRetryDelay);
+    }
 }
 
 std::string MessagePassingClientCache::CreateMessagePassingName(const ClientQualityType asil_level,
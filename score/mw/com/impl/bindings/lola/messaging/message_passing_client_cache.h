@@ -13,9 +13,19 @@
 #ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGEPASSINGCLIENTCACHE_H
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGEPASSINGCLIENTCACHE_H
 
+#include "score/message_passing/i_client_connection.h"
 #include "score/message_passing/i_client_factory.h"
 #include "score/mw/com/impl/bindings/lola/messaging/client_quality_type.h"
 
+#include "score/os/errno.h"
+
+#include <score/expected.hpp>
+#include <score/span.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -24,11 +34,37 @@
 namespace score::mw::com::impl::lola
 {
 
+/// \brief Cache of the message passing client connections to the other LoLa nodes.
+/// \details Connections to different nodes are set up independently of each other: the cache mutex only protects the
+///          lookup and the (non-blocking) creation of a connection. Waiting for a connection to become ready only
+///          happens on the per-node state, so that a slow or stalled node does not delay the traffic to other nodes.
 class MessagePassingClientCache
 {
   public:
+    /// \brief How fire-and-forget messages are handled, which are sent to a node whose connection is still starting.
+    enum class ConnectingPeerPolicy : std::uint8_t
+    {
+        kQueue,   ///< The message is queued and sent as soon as the connection is ready.
+        kReject,  ///< The message is rejected with EAGAIN.
+    };
+
+    using PriorityClass = score::message_passing::IClientConnection::PriorityClass;
+
+    /// \brief Maximum number of messages queued per node while its connection is starting.
+    static constexpr std::size_t kMaxPendingSends{20U};
+    /// \brief Number of the kMaxPendingSends, which can only be used by PriorityClass::kControl messages.
+    static constexpr std::size_t kReservedPendingControlSends{5U};
+
+    /// \brief Number of client side queue slots of each connection reserved for PriorityClass::kControl messages, on
+    ///        top of the slots shared by the other priority classes.
+    /// \details Control messages (e.g. event notification (un)registrations) are dispatched strictly before queued
+    ///          event notifications (PriorityClass::kBulk), so that they are neither delayed nor rejected by a burst
+    ///          of notifications to the same node.
+    static constexpr std::uint32_t kReservedQueuedControlSends{5U};
+
     MessagePassingClientCache(const ClientQualityType asil_level,
-                              score::message_passing::IClientFactory& client_factory) noexcept;
+                              score::message_passing::IClientFactory& client_factory,
+                              const ConnectingPeerPolicy connecting_peer_policy = ConnectingPeerPolicy::kQueue) noexcept;
 
     ~MessagePassingClientCache() noexcept = default;
 
@@ -39,21 +75,77 @@ class MessagePassingClientCache
 
     std::shared_ptr<score::message_passing::IClientConnection> GetCachedMessagePassingClient(
         const pid_t target_node_id) noexcept;
+
+    /// \brief Returns the connection to the given node, creating it if needed.
+    /// \details Blocks the calling thread until the connection is ready, has failed or a timeout has expired. Only
+    ///          callers targeting the same node are affected by this wait. Intended for sending messages with reply.
     std::shared_ptr<score::message_passing::IClientConnection> GetMessagePassingClient(
         const pid_t target_node_id) noexcept;
+
+    /// \brief Sends a fire-and-forget message to the given node, creating the connection if needed.
+    /// \details Never waits for the connection to become ready. While the connection is starting, the message is
+    ///          handled according to the ConnectingPeerPolicy. Messages queued for a node are sent before any later
+    ///          message to the same node. Messages of the same priority class are sent in order, while kControl
+    ///          messages overtake queued messages of the other classes (here and in the connection's send queue).
+    /// \return error if the message could not be sent or queued. ENOBUFS if the per-node queue is full for the
+    ///         priority class of the message.
+    score::cpp::expected_blank<score::os::Error> Send(
+        const pid_t target_node_id,
+        const score::cpp::span<const std::uint8_t> message,
+        const PriorityClass priority_class = PriorityClass::kDefault) noexcept;
+
+    /// \brief Like Send(), but only sends (or queues) the message, if a connection to the given node is ready or
+    ///        still starting. No new connection is created.
+    /// \details Intended for best-effort messages like unregistrations: they are kept in order with the earlier
+    ///          messages to the node (e.g. a registration queued while the connection is starting), but a lost
+    ///          connection is not set up again just to deliver them.
+    /// \return ENOTCONN if there is no such connection, otherwise like Send().
+    score::cpp::expected_blank<score::os::Error> SendIfConnectionExists(
+        const pid_t target_node_id,
+        const score::cpp::span<const std::uint8_t> message,
+        const PriorityClass priority_class = PriorityClass::kDefault) noexcept;
+
     void RemoveMessagePassingClient(const pid_t target_node_id) noexcept;
 
     static std::string CreateMessagePassingName(const ClientQualityType asil_level, const pid_t node_id) noexcept;
 
   private:
-    std::shared_ptr<score::message_passing::IClientConnection> CreateNewClient(const pid_t target_node_id) noexcept;
-    std::shared_ptr<score::message_passing::IClientConnection> UnlockedGetCachedMessagePassingClient(
-        const pid_t target_node_id) noexcept;
+    static constexpr std::uint32_t kMaxSendSize{32U};
+
+    struct PendingSend
+    {
+        std::array<std::uint8_t, kMaxSendSize> payload;
+        std::size_t size;
+        PriorityClass priority_class;
+    };
+
+    // The connection to one node together with the messages waiting for the connection to become ready.
+    // The mutex must not be held while calling IClientConnection::Stop(), which calls the state callback synchronously.
+    struct PeerConnection
+    {
+        std::shared_ptr<score::message_passing::IClientConnection> connection;
+        std::mutex mutex;
+        std::condition_variable state_changed;
+        std::array<PendingSend, kMaxPendingSends> pending_sends;
+        std::size_t pending_send_count{0U};
+    };
+
+    std::shared_ptr<PeerConnection> GetOrCreatePeerConnection(const pid_t target_node_id) noexcept;
+    score::cpp::expected_blank<score::os::Error> SendToPeer(PeerConnection& peer,
+                                                            const score::cpp::span<const std::uint8_t> message,
+                                                            const PriorityClass priority_class) noexcept;
+    std::shared_ptr<PeerConnection> CreatePeerConnection(const pid_t target_node_id) noexcept;
+    void WaitUntilConnected(PeerConnection& peer, const pid_t target_node_id) noexcept;
+
+    static void OnStateChanged(const std::weak_ptr<PeerConnection>& weak_peer,
+                               const score::message_passing::IClientConnection::State state) noexcept;
+    static void FlushPendingSendsUnderLock(PeerConnection& peer) noexcept;
 
     const ClientQualityType asil_level_;
     score::message_passing::IClientFactory& client_factory_;
+    const ConnectingPeerPolicy connecting_peer_policy_;
     // TODO: PMR
-    std::unordered_map<pid_t, std::shared_ptr<score::message_passing::IClientConnection>> clients_;
+    std::unordered_map<pid_t, std::shared_ptr<PeerConnection>> clients_;
     std::mutex mutex_;
 };
 
@@ -17,6 +17,14 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
 namespace score::mw::com::impl::lola
 {
 namespace
@@ -270,34 +278,343 @@ TEST_P(MessagePassingClientCacheTest, GetMessagePassingClientDoesNotEvictReadyCl
     EXPECT_EQ(client1, client2);
 }
 
-TEST_P(MessagePassingClientCacheTest, GetMessagePassingClientEvictsStartingClient)
+TEST_P(MessagePassingClientCacheTest, GetMessagePassingClientDoesNotEvictStartingClient)
 {
-    // Given a cached client connection that is stuck in kStarting state
-    // (CreateNewClient hit its 500ms timeout and returned a still-connecting client)
+    // Given a cached client connection that is still in kStarting state
+    // (the connection keeps retrying to connect in the background)
     EXPECT_CALL(*client_connection_mock_, GetState())
         .WillRepeatedly(::testing::Return(IClientConnection::State::kStarting));
-    EXPECT_CALL(*client_connection_mock_, GetStopReason())
-        .WillRepeatedly(::testing::Return(IClientConnection::StopReason::kNone));
-    EXPECT_CALL(*client_connection_mock_, Stop()).Times(1);
+    EXPECT_CALL(*client_connection_mock_, Stop()).Times(0);
 
+    // Expect factory is called only once
     EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
         .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
 
     auto client1 = client_cache_.GetMessagePassingClient(pid_);
 
     // When GetMessagePassingClient is called again for the same node_id
-    // Expect the factory to be called again (stuck client was evicted)
-    auto fresh_connection =
+    auto client2 = client_cache_.GetMessagePassingClient(pid_);
+
+    // Then the same, still starting client is returned
+    EXPECT_EQ(client1, client2);
+}
+
+TEST_P(MessagePassingClientCacheTest, SendToReadyPeerIsForwardedToConnection)
+{
+    // Given a client connection in kReady state
+    EXPECT_CALL(*client_connection_mock_, GetState())
+        .WillRepeatedly(::testing::Return(IClientConnection::State::kReady));
+    // Expect the message to be sent directly with the default priority class
+    EXPECT_CALL(*client_connection_mock_, SendWithPriority(::testing::_, IClientConnection::PriorityClass::kDefault))
+        .WillOnce(::testing::Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+
+    // When sending a message to the node
+    const std::array<std::uint8_t, 4U> message{1U, 2U, 3U, 4U};
+    const auto result = client_cache_.Send(pid_, message);
+
+    // Then the send succeeds
+    EXPECT_TRUE(result.has_value());
+}
+
+TEST_P(MessagePassingClientCacheTest, SendToConnectingPeerIsQueuedAndFlushedInOrderOnceReady)
+{
+    // Given a client connection which is starting and whose state callback is captured
+    std::atomic<IClientConnection::State> state{IClientConnection::State::kStarting};
+    IClientConnection::StateCallback state_callback{};
+    ON_CALL(*client_connection_mock_, GetState()).WillByDefault([&state]() noexcept {
+        return state.load();
+    });
+    EXPECT_CALL(*client_connection_mock_, Start(::testing::_, ::testing::_))
+        .WillOnce([&state_callback](auto callback, auto) noexcept {
+            state_callback = std::move(callback);
+        });
+    std::vector<std::uint8_t> sent_messages{};
+    EXPECT_CALL(*client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
+        .WillRepeatedly([&sent_messages](auto message, auto) noexcept -> score::cpp::expected_blank<score::os::Error> {
+            sent_messages.push_back(message.front());
+            return {};
+        });
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+
+    // When sending two messages while the connection is starting
+    const std::array<std::uint8_t, 1U> first_message{1U};
+    const std::array<std::uint8_t, 1U> second_message{2U};
+    EXPECT_TRUE(client_cache_.Send(pid_, first_message).has_value());
+    EXPECT_TRUE(client_cache_.Send(pid_, second_message).has_value());
+
+    // Then nothing is sent yet
+    EXPECT_TRUE(sent_messages.empty());
+
+    // and when the connection becomes ready
+    state = IClientConnection::State::kReady;
+    ASSERT_FALSE(state_callback.empty());
+    state_callback(IClientConnection::State::kReady);
+
+    // Then the queued messages are sent in order
+    EXPECT_EQ(sent_messages, (std::vector<std::uint8_t>{1U, 2U}));
+
+    // and a later message is sent directly
+    const std::array<std::uint8_t, 1U> third_message{3U};
+    EXPECT_TRUE(client_cache_.Send(pid_, third_message).has_value());
+    EXPECT_EQ(sent_messages, (std::vector<std::uint8_t>{1U, 2U, 3U}));
+}
+
+TEST_P(MessagePassingClientCacheTest, SendToConnectingPeerFailsWhenQueueIsFull)
+{
+    // Given a client connection which stays in kStarting state
+    EXPECT_CALL(*client_connection_mock_, GetState())
+        .WillRepeatedly(::testing::Return(IClientConnection::State::kStarting));
+    EXPECT_CALL(*client_connection_mock_, SendWithPriority(::testing::_, ::testing::_)).Times(0);
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+
+    // and a queue, which is full for non-control messages
+    const std::array<std::uint8_t, 1U> message{1U};
+    constexpr auto kMaxPendingNonControlSends =
+        MessagePassingClientCache::kMaxPendingSends - MessagePassingClientCache::kReservedPendingControlSends;
+    for (std::size_t index = 0U; index < kMaxPendingNonControlSends; ++index)
+    {
+        EXPECT_TRUE(client_cache_.Send(pid_, message).has_value());
+    }
+
+    // When sending another message
+    const auto result = client_cache_.Send(pid_, message);
+
+    // Then it is rejected with ENOBUFS
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), ENOBUFS);
+
+    // and control messages can still be queued until the reserved entries are used up as well
+    for (std::size_t index = 0U; index < MessagePassingClientCache::kReservedPendingControlSends; ++index)
+    {
+        EXPECT_TRUE(client_cache_.Send(pid_, message, IClientConnection::PriorityClass::kControl).has_value());
+    }
+    const auto control_result = client_cache_.Send(pid_, message, IClientConnection::PriorityClass::kControl);
+    ASSERT_FALSE(control_result.has_value());
+    EXPECT_EQ(control_result.error().GetOsDependentErrorCode(), ENOBUFS);
+}
+
+TEST_P(MessagePassingClientCacheTest, ControlMessageOvertakesQueuedNotificationBurst)
+{
+    // Given a client connection which is starting and whose state callback is captured
+    std::atomic<IClientConnection::State> state{IClientConnection::State::kStarting};
+    IClientConnection::StateCallback state_callback{};
+    ON_CALL(*client_connection_mock_, GetState()).WillByDefault([&state]() noexcept {
+        return state.load();
+    });
+    EXPECT_CALL(*client_connection_mock_, Start(::testing::_, ::testing::_))
+        .WillOnce([&state_callback](auto callback, auto) noexcept {
+            state_callback = std::move(callback);
+        });
+    std::vector<std::pair<std::uint8_t, IClientConnection::PriorityClass>> sent_messages{};
+    EXPECT_CALL(*client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
+        .WillRepeatedly([&sent_messages](auto message,
+                                         auto priority_class) noexcept -> score::cpp::expected_blank<score::os::Error> {
+            sent_messages.emplace_back(message.front(), priority_class);
+            return {};
+        });
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+
+    // and a burst of event notifications, which fills the queue for non-control messages
+    constexpr auto kBurstSize =
+        MessagePassingClientCache::kMaxPendingSends - MessagePassingClientCache::kReservedPendingControlSends;
+    const std::array<std::uint8_t, 1U> notification{1U};
+    for (std::size_t index = 0U; index < kBurstSize; ++index)
+    {
+        EXPECT_TRUE(client_cache_.Send(pid_, notification, IClientConnection::PriorityClass::kBulk).has_value());
+    }
+    EXPECT_FALSE(client_cache_.Send(pid_, notification, IClientConnection::PriorityClass::kBulk).has_value());
+
+    // When sending a control message (e.g. an event notification registration) after the burst
+    const std::array<std::uint8_t, 1U> control_message{2U};
+    const auto control_result =
+        client_cache_.Send(pid_, control_message, IClientConnection::PriorityClass::kControl);
+
+    // Then it is accepted
+    EXPECT_TRUE(control_result.has_value());
+
+    // and when the connection becomes ready
+    state = IClientConnection::State::kReady;
+    ASSERT_FALSE(state_callback.empty());
+    state_callback(IClientConnection::State::kReady);
+
+    // Then the control message is sent first and with the control priority class, followed by the burst
+    ASSERT_EQ(sent_messages.size(), kBurstSize + 1U);
+    EXPECT_EQ(sent_messages.front(), std::make_pair(std::uint8_t{2U}, IClientConnection::PriorityClass::kControl));
+    for (std::size_t index = 1U; index < sent_messages.size(); ++index)
+    {
+        EXPECT_EQ(sent_messages[index], std::make_pair(std::uint8_t{1U}, IClientConnection::PriorityClass::kBulk));
+    }
+}
+
+TEST_P(MessagePassingClientCacheTest, ConnectionsReserveQueueBudgetForControlMessages)
+{
+    // Expecting that the connection is created with a reserved queue budget for control messages, which are
+    // dispatched strictly before the other priority classes
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce([this](const auto&, const IClientFactory::ClientConfig& client_config) {
+            const auto& control_config =
+                client_config.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kControl)];
+            EXPECT_EQ(control_config.max_queued_sends, MessagePassingClientCache::kReservedQueuedControlSends);
+            EXPECT_EQ(
+                client_config.priority_classes[score::cpp::to_underlying(IClientConnection::PriorityClass::kBulk)]
+                    .max_queued_sends,
+                0U);
+            EXPECT_EQ(client_config.priority_dispatch, IClientFactory::ClientConfig::PriorityDispatch::kStrict);
+            return std::move(client_connection_mock_);
+        });
+
+    // When a connection gets created
+    const std::array<std::uint8_t, 1U> message{1U};
+    score::cpp::ignore = client_cache_.Send(pid_, message, IClientConnection::PriorityClass::kControl);
+}
+
+TEST(MessagePassingClientCacheRejectPolicyTest, SendToConnectingPeerIsRejected)
+{
+    // Given a cache which rejects messages to connecting nodes
+    auto client_connection_mock =
         score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(score::cpp::pmr::new_delete_resource());
-    auto* fresh_connection_ptr = fresh_connection.get();
+    EXPECT_CALL(*client_connection_mock, GetState())
+        .WillRepeatedly(::testing::Return(IClientConnection::State::kStarting));
+    EXPECT_CALL(*client_connection_mock, SendWithPriority(::testing::_, ::testing::_)).Times(0);
+    ClientFactoryMock client_factory_mock{};
+    EXPECT_CALL(client_factory_mock, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock))));
+    MessagePassingClientCache client_cache{ClientQualityType::kASIL_QM,
+                                           client_factory_mock,
+                                           MessagePassingClientCache::ConnectingPeerPolicy::kReject};
+
+    // When sending a message to a node whose connection is starting
+    const std::array<std::uint8_t, 1U> message{1U};
+    const auto result = client_cache.Send(12, message);
+
+    // Then it is rejected with EAGAIN
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), EAGAIN);
+}
+
+TEST_P(MessagePassingClientCacheTest, StalledPeerDoesNotDelayTrafficToHealthyPeer)
+{
+    // Given a stalled node, whose connection never becomes ready
+    EXPECT_CALL(*client_connection_mock_, GetState())
+        .WillRepeatedly(::testing::Return(IClientConnection::State::kStarting));
+    auto stalled_connection = std::move(client_connection_mock_);
+
+    // and a healthy node, whose connection is ready
+    auto healthy_connection =
+        score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(score::cpp::pmr::new_delete_resource());
+    EXPECT_CALL(*healthy_connection, GetState()).WillRepeatedly(::testing::Return(IClientConnection::State::kReady));
+    EXPECT_CALL(*healthy_connection, SendWithPriority(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(score::cpp::expected_blank<score::os::Error>{}));
+    EXPECT_CALL(*healthy_connection, Send(::testing::_))
+        .WillOnce(::testing::Return(score::cpp::expected_blank<score::os::Error>{}));
+
+    std::promise<void> stalled_connection_created{};
     EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
-        .WillOnce(::testing::Return(::testing::ByMove(std::move(fresh_connection))));
+        .WillOnce([&stalled_connection, &stalled_connection_created](auto&&...) {
+            stalled_connection_created.set_value();
+            return std::move(stalled_connection);
+        })
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(healthy_connection))));
+
+    // and a thread, which waits for the connection to the stalled node, e.g. for a method call
+    std::atomic<bool> stalled_wait_finished{false};
+    std::thread stalled_caller{[this, &stalled_wait_finished]() {
+        score::cpp::ignore = client_cache_.GetMessagePassingClient(pid_);
+        stalled_wait_finished = true;
+    }};
+    stalled_connection_created.get_future().wait();
+
+    // When sending to the stalled and to the healthy node in the meantime
+    const std::array<std::uint8_t, 1U> message{1U};
+    EXPECT_TRUE(client_cache_.Send(pid_, message).has_value());
+    EXPECT_TRUE(client_cache_.Send(pid2_, message).has_value());
+    const auto healthy_client = client_cache_.GetMessagePassingClient(pid2_);
+    EXPECT_TRUE(healthy_client->Send(message).has_value());
+
+    // Then the traffic to the healthy node has been handled while the stalled node is still being waited for
+    EXPECT_FALSE(stalled_wait_finished);
+    stalled_caller.join();
+    EXPECT_TRUE(stalled_wait_finished);
+}
 
-    auto client2 = client_cache_.GetMessagePassingClient(pid_);
+TEST_P(MessagePassingClientCacheTest, SendIfConnectionExistsDoesNotCreateConnection)
+{
+    // Given an empty MessagePassingClientCache
+    // Expect that no client connection is created
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_)).Times(0);
 
-    // Then the returned client is the new one, not the stuck one
-    EXPECT_NE(client1, client2);
-    EXPECT_EQ(client2.get(), fresh_connection_ptr);
+    // When sending a message only if a connection exists
+    const std::array<std::uint8_t, 1U> message{1U};
+    const auto result = client_cache_.SendIfConnectionExists(pid_, message);
+
+    // Then it is rejected with ENOTCONN
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), ENOTCONN);
+}
+
+TEST_P(MessagePassingClientCacheTest, SendIfConnectionExistsDoesNotSendOverStoppedConnection)
+{
+    // Given a cached client connection which has stopped
+    EXPECT_CALL(*client_connection_mock_, GetState())
+        .WillRepeatedly(::testing::Return(IClientConnection::State::kStopped));
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+    score::cpp::ignore = client_cache_.GetMessagePassingClient(pid_);
+
+    // When sending a message only if a connection exists
+    const std::array<std::uint8_t, 1U> message{1U};
+    const auto result = client_cache_.SendIfConnectionExists(pid_, message);
+
+    // Then it is rejected with ENOTCONN
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().GetOsDependentErrorCode(), ENOTCONN);
+}
+
+TEST_P(MessagePassingClientCacheTest, SendIfConnectionExistsIsQueuedBehindMessagesToConnectingPeer)
+{
+    // Given a client connection which is starting and whose state callback is captured
+    std::atomic<IClientConnection::State> state{IClientConnection::State::kStarting};
+    IClientConnection::StateCallback state_callback{};
+    ON_CALL(*client_connection_mock_, GetState()).WillByDefault([&state]() noexcept {
+        return state.load();
+    });
+    EXPECT_CALL(*client_connection_mock_, Start(::testing::_, ::testing::_))
+        .WillOnce([&state_callback](auto callback, auto) noexcept {
+            state_callback = std::move(callback);
+        });
+    std::vector<std::uint8_t> sent_messages{};
+    EXPECT_CALL(*client_connection_mock_, SendWithPriority(::testing::_, IClientConnection::PriorityClass::kControl))
+        .WillRepeatedly([&sent_messages](auto message, auto) noexcept -> score::cpp::expected_blank<score::os::Error> {
+            sent_messages.push_back(message.front());
+            return {};
+        });
+    EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
+        .WillOnce(::testing::Return(::testing::ByMove(std::move(client_connection_mock_))));
+
+    // and a control message, which is queued while the connection is starting
+    const std::array<std::uint8_t, 1U> first_message{1U};
+    EXPECT_TRUE(client_cache_.Send(pid_, first_message, IClientConnection::PriorityClass::kControl).has_value());
+
+    // When sending another control message only if a connection exists
+    const std::array<std::uint8_t, 1U> second_message{2U};
+    const auto result =
+        client_cache_.SendIfConnectionExists(pid_, second_message, IClientConnection::PriorityClass::kControl);
+
+    // Then it is accepted
+    EXPECT_TRUE(result.has_value());
+
+    // and when the connection becomes ready
+    state = IClientConnection::State::kReady;
+    ASSERT_FALSE(state_callback.empty());
+    state_callback(IClientConnection::State::kReady);
+
+    // Then both messages are sent in order
+    EXPECT_EQ(sent_messages, (std::vector<std::uint8_t>{1U, 2U}));
 }
 
 TEST_P(MessagePassingClientCacheTest, GetCachedMessagePassingClientReturnsNullWhenNoClientExists)
@@ -18,6 +18,7 @@
 #include "score/mw/com/impl/bindings/lola/messaging/method_unsubscription_registration_guard.h"
 #include "score/mw/com/impl/bindings/lola/messaging/mw_log_logger.h"
 #include "score/mw/com/impl/bindings/lola/messaging/thread_abstraction.h"
+#include "score/mw/com/impl/startup_timeline.h"
 
 #include "score/message_passing/i_server_connection.h"
 #include "score/mw/log/logging.h"
@@ -26,6 +27,15 @@
 
 #include "score/message_passing/engine.h"
 
+// Suppress "AUTOSAR C++14 A16-0-1" rule findings.
+// This is the standard way to determine if it runs on QNX or Unix
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+
+#include <cstddef>
 #include <memory>
 #include <optional>
 
@@ -41,6 +51,49 @@ constexpr auto kLocalThreadPoolName = "mw::com MessageReceiver";
 namespace score::mw::com::impl::lola
 {
 
+namespace
+{
+
+// Suppress "AUTOSAR C++14 A16-0-1" rule findings.
+// This is the standard way to determine if it runs on QNX or Unix
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifdef __QNX__
+// The QNX dispatch engine serves all connections of the process, so the number of reactors is ignored.
+score::message_passing::ClientFactory CreateClientFactory(const std::size_t) noexcept
+{
+    return score::message_passing::ClientFactory{score::cpp::pmr::make_shared<score::message_passing::Engine>(
+        score::cpp::pmr::get_default_resource(), score::cpp::pmr::get_default_resource(), GetMwLogLogger())};
+}
+
+score::message_passing::ServerFactory CreateServerFactory(
+    const score::message_passing::ClientFactory& client_factory) noexcept
+{
+    return score::message_passing::ServerFactory{client_factory.GetEngine()};
+}
+// coverity[autosar_cpp14_a16_0_1_violation]
+#else
+score::message_passing::ClientFactory CreateClientFactory(const std::size_t number_of_reactors) noexcept
+{
+    return score::message_passing::ClientFactory{
+        score::cpp::pmr::make_shared<score::message_passing::UnixDomainEnginePool>(
+            score::cpp::pmr::get_default_resource(),
+            score::cpp::pmr::get_default_resource(),
+            number_of_reactors,
+            &GetMwLogLogger)};
+}
+
+// The servers share the reactors of the client connections. The two servers of an ASIL-B process get different
+// reactors, but all connections accepted by a server stay on its reactor.
+score::message_passing::ServerFactory CreateServerFactory(
+    const score::message_passing::ClientFactory& client_factory) noexcept
+{
+    return score::message_passing::ServerFactory{client_factory.GetEnginePool()};
+}
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+
+}  // namespace
+
 // Suppress autosar_cpp14_a15_5_3_violation
 // Rationale: Calling std::terminate() if any exceptions are thrown is expected as per safety requirements
 // coverity[autosar_cpp14_a15_5_3_violation]
@@ -48,11 +101,10 @@ MessagePassingService::MessagePassingService(
     const AsilSpecificCfg& config_asil_qm,
     const std::optional<AsilSpecificCfg>& config_asil_b,
     // coverity[autosar_cpp14_a8_4_12_violation] Function only uses the object without affecting ownership
-    const std::unique_ptr<IMessagePassingServiceInstanceFactory>& factory) noexcept
+    const std::unique_ptr<IMessagePassingServiceInstanceFactory>& factory,
+    const std::size_t number_of_reactors) noexcept
     : IMessagePassingService{},
-      client_factory_{score::cpp::pmr::make_shared<Engine>(score::cpp::pmr::get_default_resource(),
-                                                           score::cpp::pmr::get_default_resource(),
-                                                           GetMwLogLogger())},
+      client_factory_{CreateClientFactory(number_of_reactors)},
       // Suppress "AUTOSAR C++14 A15-4-2" rule findings. This rule states: "Throwing an exception in a
       // "noexcept" function." In this case it is ok, because the system anyways forces the process to
       // terminate if an exception is thrown.
@@ -61,7 +113,8 @@ MessagePassingService::MessagePassingService(
       qm_{},
       asil_b_{}
 {
-    ServerFactory server_factory{client_factory_.GetEngine()};
+    const StartupTimeline::Phase phase{"StartMessagePassingService"};
+    ServerFactory server_factory{CreateServerFactory(client_factory_)};
 
     const auto qm_client_quality_type =
         config_asil_b.has_value() ? ClientQualityType::kASIL_QMfromB : ClientQualityType::kASIL_QM;
@@ -182,12 +235,13 @@ Result<MethodCallRegistrationGuard> MessagePassingService::RegisterMethodCallHan
     const QualityType asil_level,
     ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
     MethodCallHandler method_call_callback,
-    uid_t allowed_proxy_uid)
+    uid_t allowed_proxy_uid,
+    const MethodCallSchedulingCfg scheduling_cfg)
 {
     auto& instance = GetMessagePassingServiceInstance(asil_level);
 
     const auto result = instance.RegisterMethodCallHandler(
-        proxy_method_instance_identifier, std::move(method_call_callback), allowed_proxy_uid);
+        proxy_method_instance_identifier, std::move(method_call_callback), allowed_proxy_uid, scheduling_cfg);
     if (!(result.has_value()))
     {
         return MakeUnexpected<MethodCallRegistrationGuard>(result.error());
@@ -31,6 +31,7 @@
 
 #include "score/concurrency/thread_pool.h"
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 
@@ -64,9 +65,13 @@ class MessagePassingService final : public IMessagePassingService
     ///                application/process is implemented according to ASIL_B requirements and there is at least one
     ///                LoLa service deployment (proxy or skeleton) for the process, with asilLevel "ASIL_B".
     /// \param factory optional factory used to create MessagePassingServiceInstances
+    /// \param number_of_reactors number of engines, over which the client connections and the servers are distributed
+    ///        round-robin. The connections accepted by a server stay on the engine of the server. Ignored on QNX, whose
+    ///        dispatch engine serves all connections of the process.
     MessagePassingService(const AsilSpecificCfg& config_asil_qm,
                           const std::optional<AsilSpecificCfg>& config_asil_b,
-                          const std::unique_ptr<IMessagePassingServiceInstanceFactory>& factory) noexcept;
+                          const std::unique_ptr<IMessagePassingServiceInstanceFactory>& factory,
+                          const std::size_t number_of_reactors = 1U) noexcept;
 
     MessagePassingService(const MessagePassingService&) = delete;
     MessagePassingService(MessagePassingService&&) = delete;
@@ -123,7 +128,8 @@ class MessagePassingService final : public IMessagePassingService
         const QualityType asil_level,
         ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
         MethodCallHandler method_call_callback,
-        uid_t allowed_proxy_uid) override;
+        uid_t allowed_proxy_uid,
+        const MethodCallSchedulingCfg scheduling_cfg) override;
 
     /// \brief Notifies target node about outdated_node_id being an old/outdated node id, not being used anymore.
     /// \details see IMessagePassingService::NotifyOutdatedNodeId
@@ -171,7 +177,6 @@ class MessagePassingService final : public IMessagePassingService
                             const pid_t target_node_id) override;
 
   private:
-    using Engine = score::message_passing::Engine;
     using ClientFactory = score::message_passing::ClientFactory;
     using ServerFactory = score::message_passing::ServerFactory;
 
@@ -20,6 +20,7 @@
 #include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/deferred_logger.h"
 #include "score/mw/com/impl/error_serializer.h"
 
 #include "score/language/safecpp/safe_math/safe_math.h"
@@ -48,7 +49,6 @@
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <shared_mutex>
 #include <tuple>
 #include <type_traits>
@@ -94,7 +94,7 @@ bool DeserializeFromPayload(const score::cpp::span<const std::uint8_t> payload,
 
     if (sizeof(T) != payload.size())
     {
-        score::mw::log::LogError("lola") << "Wrong payload size, got " << payload.size() << ", expected " << sizeof(T);
+        DeferrableLogError("lola") << "Wrong payload size, got " << payload.size() << ", expected " << sizeof(T);
         return false;
     }
     // NOLINTBEGIN(score-banned-function) deserialization of trivially copyable
@@ -119,8 +119,8 @@ score::Result<MethodUnserializedReply> DeserializeFromMethodReplyPayload(
 
     if (sizeof(MethodReplyPayload) != payload.size())
     {
-        score::mw::log::LogError("lola") << "Wrong payload size, got " << payload.size() << ", expected "
-                                         << sizeof(MethodReplyPayload);
+        DeferrableLogError("lola") << "Wrong payload size, got " << payload.size() << ", expected "
+                                   << sizeof(MethodReplyPayload);
         return MakeUnexpected(MethodErrc::kUnexpectedMessageSize);
     }
 
@@ -197,11 +197,50 @@ bool IsMethodErrorRecoverable(const score::result::Error error)
     }
 }
 
+/// \brief Logs a warning, if inserting a new element into _container_ would exceed its preallocated storage.
+/// \details In this case the insertion still succeeds, but allocates. Hitting this is an indication, that the
+///          capacities in AsilSpecificCfg (derived from the configuration) are too small.
+template <typename ContainerType>
+void WarnIfCapacityExhausted(const ContainerType& container, const char* const container_name) noexcept
+{
+    if (container.IsFull())
+    {
+        score::mw::log::LogWarn("lola") << "MessagePassingService: Preallocated capacity" << container.capacity()
+                                        << "of" << container_name << "exhausted. Registration will allocate.";
+    }
+}
+
+void ReplyToScheduledMethodCall(score::message_passing::IServerConnection& connection,
+                                score::Result<void> result) noexcept
+{
+    const auto reply = SerializeToMethodReplyMessage(std::move(result));
+    const auto reply_result = connection.Reply(reply);
+    if (!(reply_result.has_value()))
+    {
+        // The connection gets disconnected by message passing, if the client is gone. We don't request the disconnect
+        // from the worker thread, as the disconnect callback would wait for the reply, which is being sent by us.
+        score::mw::log::LogError("lola") << "Failed to send reply after processing scheduled method call.";
+    }
+}
+
+std::shared_ptr<MethodCallScheduler> CreateMethodCallScheduler(const std::size_t number_of_workers) noexcept
+{
+    if (number_of_workers == 0U)
+    {
+        return nullptr;
+    }
+    return std::make_shared<MethodCallScheduler>(
+        number_of_workers,
+        [](score::message_passing::IServerConnection& connection, score::Result<void> result) noexcept {
+            ReplyToScheduledMethodCall(connection, std::move(result));
+        });
+}
+
 }  // namespace
 
 MessagePassingServiceInstance::MessagePassingServiceInstance(
     const ClientQualityType asil_level,
-    AsilSpecificCfg /*config*/,
+    AsilSpecificCfg config,
     score::message_passing::IServerFactory& server_factory,
     score::message_passing::IClientFactory& client_factory,
     score::concurrency::Executor& local_event_executor) noexcept
@@ -209,25 +248,25 @@ MessagePassingServiceInstance::MessagePassingServiceInstance(
       cur_registration_no_{0U},
       asil_level_{asil_level},
       client_cache_{asil_level, client_factory},
-      event_update_handlers_{},
+      max_remote_nodes_per_event_{config.max_remote_nodes_per_event_},
+      event_update_handlers_{config.max_notification_events_},
       event_update_handlers_mutex_{},
-      handler_status_change_callbacks_{},
+      handler_status_change_callbacks_{config.max_notification_events_},
       handler_status_change_callbacks_mutex_{},
-      event_update_interested_nodes_{},
+      event_update_interested_nodes_{config.max_notification_events_},
       event_update_interested_nodes_mutex_{},
-      event_update_remote_registrations_{},
+      event_update_remote_registrations_{config.max_notification_events_},
       event_update_remote_registrations_mutex_{},
       subscribe_service_method_handlers_{},
       subscribe_service_method_handlers_mutex_{},
       call_method_handlers_{},
       call_method_handlers_mutex_{},
+      method_call_scheduler_{CreateMethodCallScheduler(config.method_call_worker_threads_)},
       executor_{local_event_executor},
       message_callback_scope_{},
       self_pid_{os::Unistd::instance().getpid()},
       self_uid_{os::Unistd::instance().getuid()}
 {
-    // TODO: PMR
-
     auto service_identifier = MessagePassingClientCache::CreateMessagePassingName(asil_level, self_pid_);
     score::message_passing::ServiceProtocolConfig protocol_config{service_identifier, kMaxSendSize, kMaxReplySize, 0U};
     score::message_passing::IServerFactory::ServerConfig server_config{};
@@ -237,9 +276,17 @@ MessagePassingServiceInstance::MessagePassingServiceInstance(
         const pid_t client_pid = connection.GetClientIdentity().pid;
         return static_cast<std::uintptr_t>(client_pid);
     };
-    auto disconnect_callback = [](score::message_passing::IServerConnection& /*connection*/) noexcept {
+    auto disconnect_callback = [method_call_scheduler = method_call_scheduler_](
+                                   score::message_passing::IServerConnection& connection) noexcept {
         // TODO: outdated node id?
         // TODO: update related unit test as well
+
+        // The connection gets destroyed after this callback, so scheduled calls of it must not be replied to anymore.
+        // This doesn't wait for the executing calls of the connection, so the message passing thread isn't blocked.
+        if (method_call_scheduler != nullptr)
+        {
+            method_call_scheduler->DiscardCalls(connection);
+        }
     };
 
     auto message_callback_scoped_function =
@@ -306,18 +353,44 @@ message_passing::MessageCallback MessagePassingServiceInstance::CreateSendMessag
                 return this->MessageCallbackWithReply(sender_uid, sender_pid, message);
             });
 
+    std::shared_ptr<score::safecpp::MoveOnlyScopedFunction<bool(
+        score::message_passing::IServerConnection&, uid_t, score::cpp::span<const std::uint8_t>)>>
+        schedule_method_call_scoped_function{nullptr};
+    if (method_call_scheduler_ != nullptr)
+    {
+        schedule_method_call_scoped_function = std::make_shared<score::safecpp::MoveOnlyScopedFunction<bool(
+            score::message_passing::IServerConnection&, uid_t, score::cpp::span<const std::uint8_t>)>>(
+            message_callback_scope_,
+            [this](score::message_passing::IServerConnection& connection,
+                   uid_t sender_uid,
+                   score::cpp::span<const std::uint8_t> message) noexcept -> bool {
+                return this->ScheduleMethodCall(connection, sender_uid, message);
+            });
+    }
+
     // Note. When received_send_message_with_reply_callback returns an error, the message passing connection with the
     // client will be disconnected. Therefore, we only return an error from the callback when the error is unrecoverable
     // (e.g. an issue with message passing itself). Any recoverable errors are sent back to the client in the reply
     // message and handled there.
     auto received_send_message_with_reply_callback =
-        [message_callback_with_reply_scoped_function = std::move(message_callback_with_reply_scoped_function)](
+        [message_callback_with_reply_scoped_function = std::move(message_callback_with_reply_scoped_function),
+         schedule_method_call_scoped_function = std::move(schedule_method_call_scoped_function)](
             score::message_passing::IServerConnection& connection,
             score::cpp::span<const std::uint8_t> message) noexcept -> score::cpp::expected_blank<score::os::Error> {
         const auto client_identity = connection.GetClientIdentity();
         const pid_t client_pid = client_identity.pid;
         const auto client_uid = client_identity.uid;
 
+        // A scheduled method call is replied to by the worker thread of the MethodCallScheduler, which executes it.
+        if (schedule_method_call_scoped_function != nullptr)
+        {
+            const auto scheduled = std::invoke(*schedule_method_call_scoped_function, connection, client_uid, message);
+            if (scheduled.has_value() && scheduled.value())
+            {
+                return {};
+            }
+        }
+
         SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
             message_callback_with_reply_scoped_function != nullptr,
             "Message callback with reply callable was not properly constructed");
@@ -376,7 +449,7 @@ void MessagePassingServiceInstance::MessageCallback(const pid_t sender_pid,
 {
     if (message.size() < 1U)
     {
-        score::mw::log::LogError("lola") << "MessagePassingService: Empty message received from " << sender_pid;
+        DeferrableLogError("lola") << "MessagePassingService: Empty message received from " << sender_pid;
         return;
     }
     const auto payload = message.subspan(1U);
@@ -395,8 +468,7 @@ void MessagePassingServiceInstance::MessageCallback(const pid_t sender_pid,
             HandleOutdatedNodeIdMsg(payload, sender_pid);
             break;
         default:
-            score::mw::log::LogError("lola")
-                << "MessagePassingService: Unsupported MessageType received from " << sender_pid;
+            DeferrableLogError("lola") << "MessagePassingService: Unsupported MessageType received from " << sender_pid;
             break;
     }
 }
@@ -408,7 +480,7 @@ score::Result<void> MessagePassingServiceInstance::MessageCallbackWithReply(
 {
     if (message.size() < 1U)
     {
-        score::mw::log::LogError("lola") << "MessagePassingService: Empty message received from " << sender_pid;
+        DeferrableLogError("lola") << "MessagePassingService: Empty message received from " << sender_pid;
         return MakeUnexpected(MethodErrc::kUnexpectedMessageSize);
     }
     const auto payload = message.subspan(1U);
@@ -428,7 +500,7 @@ score::Result<void> MessagePassingServiceInstance::MessageCallbackWithReply(
         }
         default:
         {
-            score::mw::log::LogError("lola")
+            DeferrableLogError("lola")
                 << "MessagePassingService: Unsupported MessageWithReplyType received from " << sender_pid;
             break;
         }
@@ -448,7 +520,7 @@ void MessagePassingServiceInstance::HandleNotifyEventMsg(const score::cpp::span<
     }
     if (NotifyEventLocally(elementFqId) == 0U)
     {
-        score::mw::log::LogWarn("lola")
+        DeferrableLogWarn("lola")
             << "MessagePassingService: Received NotifyEventUpdateMessage for event: " << elementFqId.ToString()
             << " from node " << sender_node_id
             << " although we don't have currently any registered handlers. Might be an acceptable "
@@ -476,18 +548,22 @@ void MessagePassingServiceInstance::HandleRegisterNotificationMsg(const score::c
         (handlers_search != event_update_handlers_.end()) && (!handlers_search->second.empty());
     handlers_read_lock.unlock();
 
-    // TODO: PMR
     std::unique_lock<std::shared_mutex> write_lock(event_update_interested_nodes_mutex_);
     auto search = event_update_interested_nodes_.find(elementFqId);
     if (search != event_update_interested_nodes_.end())
     {
+        if (search->second.find(sender_node_id) == search->second.cend())
+        {
+            WarnIfCapacityExhausted(search->second, "interested nodes per event");
+        }
         auto inserted = search->second.insert(sender_node_id);
         already_registered = (inserted.second == false);
         notify_status_change = !already_registered && (search->second.size() == 1U);
     }
     else
     {
-        auto emplaced = event_update_interested_nodes_.emplace(elementFqId, std::set<pid_t>{});
+        WarnIfCapacityExhausted(event_update_interested_nodes_, "event_update_interested_nodes");
+        auto emplaced = event_update_interested_nodes_.try_emplace(elementFqId, max_remote_nodes_per_event_);
         score::cpp::ignore = emplaced.first->second.insert(sender_node_id);
         notify_status_change = true;  // First remote handler
     }
@@ -498,7 +574,7 @@ void MessagePassingServiceInstance::HandleRegisterNotificationMsg(const score::c
 
     if (already_registered)
     {
-        score::mw::log::LogWarn("lola")
+        DeferrableLogWarn("lola")
             << "MessagePassingService: Received redundant RegisterEventNotificationMessage for event: "
             << elementFqId.ToString() << " from node " << sender_node_id;
     }
@@ -553,7 +629,7 @@ void MessagePassingServiceInstance::HandleUnregisterNotificationMsg(const score:
 
     if (!registration_found)
     {
-        score::mw::log::LogWarn("lola")
+        DeferrableLogWarn("lola")
             << "MessagePassingService: Received UnregisterEventNotificationMessage for event: "
             << elementFqId.ToString() << " from node " << sender_node_id << ", but there was no registration!";
     }
@@ -645,6 +721,36 @@ score::Result<void> MessagePassingServiceInstance::HandleCallMethodMsg(
         unserialized_payload.proxy_method_instance_identifier, unserialized_payload.queue_position, sender_uid);
 }
 
+bool MessagePassingServiceInstance::ScheduleMethodCall(score::message_passing::IServerConnection& connection,
+                                                      const uid_t sender_uid,
+                                                      const score::cpp::span<const std::uint8_t> message) noexcept
+{
+    // Any message, which can't be scheduled, is handled by MessageCallbackWithReply(), which replies with the error.
+    if ((message.size() != (sizeof(MethodCallUnserializedPayload) + 1U)) ||
+        (message.front() != score::cpp::to_underlying(MessageWithReplyType::kCallMethod)))
+    {
+        return false;
+    }
+    MethodCallUnserializedPayload unserialized_payload{};
+    score::cpp::ignore = DeserializeFromPayload(message.subspan(1U), unserialized_payload);
+
+    std::shared_lock<std::shared_mutex> read_lock{call_method_handlers_mutex_};
+    const auto method_call_handler_it =
+        call_method_handlers_.find(unserialized_payload.proxy_method_instance_identifier);
+    if ((method_call_handler_it == call_method_handlers_.cend()) ||
+        (method_call_handler_it->second.allowed_proxy_uid != sender_uid))
+    {
+        return false;
+    }
+    auto method_call_handler_copy = method_call_handler_it->second.handler;
+    const auto scheduling_cfg = method_call_handler_it->second.scheduling_cfg;
+    read_lock.unlock();
+
+    method_call_scheduler_->Enqueue(
+        std::move(method_call_handler_copy), unserialized_payload.queue_position, scheduling_cfg, connection);
+    return true;
+}
+
 score::Result<void> MessagePassingServiceInstance::CallSubscribeServiceMethodLocally(
     const SkeletonInstanceIdentifier& skeleton_instance_identifier,
     const ProxyInstanceIdentifier& proxy_instance_identifier,
@@ -737,7 +843,8 @@ score::Result<void> MessagePassingServiceInstance::CallServiceMethodLocally(
         return MakeUnexpected(MethodErrc::kNotSubscribed);
     }
 
-    auto [method_call_handler_copy, allowed_proxy_uid] = method_call_handler_it->second;
+    auto method_call_handler_copy = method_call_handler_it->second.handler;
+    const auto allowed_proxy_uid = method_call_handler_it->second.allowed_proxy_uid;
     read_lock.unlock();
 
     if (allowed_proxy_uid != proxy_uid)
@@ -902,11 +1009,11 @@ void MessagePassingServiceInstance::NotifyEventRemote(const ElementFqId event_id
             // False positive, nodeIdentifiersTmp is an array of `pid_t`.
             // coverity[autosar_cpp14_m5_0_3_violation]
             const pid_t node_identifier = nodeIdentifiersTmp.at(i);
-            // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function
-            // shall have automatic storage duration". The object is a shared_ptr which is allocated in the heap.
-            // coverity[autosar_cpp14_a18_5_8_violation]
-            auto sender = client_cache_.GetMessagePassingClient(node_identifier);
-            const auto result = sender->Send(message);
+            // does not wait for a connection, which is still being established, so that one slow node does not delay
+            // the notifications of the other nodes. Notifications are bulk traffic, which must not delay the control
+            // messages to the same node.
+            const auto result =
+                client_cache_.Send(node_identifier, message, message_passing::IClientConnection::PriorityClass::kBulk);
             if (!result.has_value())
             {
                 score::mw::log::LogError("lola")
@@ -917,9 +1024,9 @@ void MessagePassingServiceInstance::NotifyEventRemote(const ElementFqId event_id
         if (num_ids_copied.second == true)
         {
             // Suppress "AUTOSAR C++14 A4-7-1" rule finding. This rule states: "An integer expression shall not lead to
-            // data loss". std::set is a sorted set of unique objects so the biggest element is the last one, and the
-            // previous condition will be true only if the distance between current node id and last node id in the map
-            // is more than one. So, no way for overflow.
+            // data loss". NodeIdSetType is a sorted set of unique objects so the biggest element is the last one, and
+            // the previous condition will be true only if the distance between current node id and last node id in the
+            // map is more than one. So, no way for overflow.
             // coverity[autosar_cpp14_a4_7_1_violation]
             start_node_id = nodeIdentifiersTmp.back() + 1;
         }
@@ -927,7 +1034,7 @@ void MessagePassingServiceInstance::NotifyEventRemote(const ElementFqId event_id
 
     if (loop_count > 1U)
     {
-        score::mw::log::LogWarn("lola")
+        DeferrableLogWarn("lola")
             << "MessagePassingService: NotifyEventRemote did need more than one copy loop for "
                "node_identifiers. Think about extending capacity of NodeIdTmpBufferType!";
     }
@@ -967,7 +1074,7 @@ std::uint32_t MessagePassingServiceInstance::NotifyEventLocally(const ElementFqI
 
     if (!all_handlers_copied)
     {
-        score::mw::log::LogError("lola")
+        DeferrableLogError("lola")
             << "MessagePassingServiceInstance: NotifyEventLocally failed to call ALL registered event receive handlers "
                "for event_id"
             << event_id.ToString() << ", because number is exceeding " << kMaxReceiveHandlersPerEvent;
@@ -1048,7 +1155,11 @@ IMessagePassingService::HandlerRegistrationNoType MessagePassingServiceInstance:
     }
     else
     {
-        auto result = event_update_handlers_.emplace(event_id, std::vector<RegisteredNotificationHandler>{});
+        WarnIfCapacityExhausted(event_update_handlers_, "event_update_handlers");
+        auto result = event_update_handlers_.try_emplace(event_id);
+        // Handlers get erased on unregistration, but the vector keeps its capacity. So reserving the number of handlers
+        // we are able to notify, keeps subsequent (re)registrations for this event allocation free.
+        result.first->second.reserve(kMaxReceiveHandlersPerEvent);
         result.first->second.push_back(std::move(newHandler));
     }
 
@@ -1251,12 +1362,14 @@ Result<void> MessagePassingServiceInstance::RegisterOnServiceMethodUnsubscribedH
 Result<void> MessagePassingServiceInstance::RegisterMethodCallHandler(
     const ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
     IMessagePassingService::MethodCallHandler method_call_callback,
-    const uid_t allowed_proxy_uid)
+    const uid_t allowed_proxy_uid,
+    const MethodCallSchedulingCfg scheduling_cfg)
 {
     std::unique_lock<std::shared_mutex> write_lock(call_method_handlers_mutex_);
 
     const auto insertion_result = call_method_handlers_.insert(
-        {proxy_method_instance_identifier, {std::move(method_call_callback), allowed_proxy_uid}});
+        {proxy_method_instance_identifier,
+         RegisteredMethodCallHandler{std::move(method_call_callback), allowed_proxy_uid, scheduling_cfg}});
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
         insertion_result.second,
         "A previous handler registered for this ProxyMethodInstanceIdentifier must be unregistered by the caller (by "
@@ -1300,12 +1413,8 @@ void MessagePassingServiceInstance::NotifyOutdatedNodeId(const pid_t outdated_no
 {
     const auto message = SerializeToMessage(score::cpp::to_underlying(MessageType::kOutdatedNodeId), outdated_node_id);
 
-    // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function shall
-    // have automatic storage duration".
-    // The object is a shared_ptr which is allocated in the heap.
-    // coverity[autosar_cpp14_a18_5_8_violation]
-    auto sender = client_cache_.GetMessagePassingClient(target_node_id);
-    const auto result = sender->Send(message);
+    const auto result =
+        client_cache_.Send(target_node_id, message, message_passing::IClientConnection::PriorityClass::kControl);
     if (!result.has_value())
     {
         score::mw::log::LogError("lola") << "MessagePassingService: Sending OutdatedNodeIdMessage to node_id "
@@ -1317,10 +1426,12 @@ void MessagePassingServiceInstance::RegisterEventNotificationRemote(const Elemen
                                                                     const pid_t target_node_id) noexcept
 {
     std::unique_lock<std::shared_mutex> remote_reg_write_lock(event_update_remote_registrations_mutex_);
+    if (event_update_remote_registrations_.find(event_id) == event_update_remote_registrations_.end())
+    {
+        WarnIfCapacityExhausted(event_update_remote_registrations_, "event_update_remote_registrations");
+    }
     const auto registration_count_inserted =
-        event_update_remote_registrations_.emplace(std::piecewise_construct,
-                                                   std::forward_as_tuple(event_id),
-                                                   std::forward_as_tuple(NodeCounter{target_node_id, 1U}));
+        event_update_remote_registrations_.try_emplace(event_id, NodeCounter{target_node_id, 1U});
     if (registration_count_inserted.second == false)
     {
         if (registration_count_inserted.first->second.node_id != target_node_id)
@@ -1402,29 +1513,25 @@ void MessagePassingServiceInstance::UnregisterEventNotificationRemote(
     {
         const auto message =
             SerializeToMessage(score::cpp::to_underlying(MessageType::kUnregisterEventNotifier), event_id);
-        // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function
-        // shall have automatic storage duration". The object is a shared_ptr which is allocated in the heap.
-        // coverity[autosar_cpp14_a18_5_8_violation]
-        auto sender = client_cache_.GetCachedMessagePassingClient(target_node_id);
-
-        // Unregistering is best-effort. There are two possible scenarios when the channel might not be ready when we
-        // try to unregister for event notifications:
+        // Unregistering is best-effort. There are two possible scenarios when there is no usable channel anymore when
+        // we try to unregister for event notifications:
         // 1. Partial restart: The skeleton will anyway come back without knowing about the registration
         // 2. Shutdown of skeleton: Nobody will ever care about this message ever again
         //
-        // To avoid the potential block of the caller thread until message_passing fails setting up the channel, we
-        // skip sending the message in this scenario.
-        if ((sender == nullptr) || (sender->GetState() != message_passing::IClientConnection::State::kReady))
-        {
-            score::mw::log::LogInfo("lola")
-                << "MessagePassingService: Skipping UnregisterEventNotificationMessage to node_id " << target_node_id
-                << " because message passing client is not ready.";
-            return;
-        }
-
-        const auto result = sender->Send(message);
+        // So no new channel is set up for this message. But if the channel is still starting, the registration
+        // message might still be queued. Then the unregistration message has to be queued behind it, otherwise the
+        // remote node would end up with a stale registration.
+        const auto result = client_cache_.SendIfConnectionExists(
+            target_node_id, message, message_passing::IClientConnection::PriorityClass::kControl);
         if (!result.has_value())
         {
+            if (result.error().GetOsDependentErrorCode() == ENOTCONN)
+            {
+                score::mw::log::LogInfo("lola")
+                    << "MessagePassingService: Skipping UnregisterEventNotificationMessage to node_id "
+                    << target_node_id << " because there is no usable message passing client for it.";
+                return;
+            }
             score::mw::log::LogError("lola")
                 << "MessagePassingService: Sending UnregisterEventNotificationMessage to node_id " << target_node_id
                 << " failed with error: " << result.error();
@@ -1436,12 +1543,8 @@ void MessagePassingServiceInstance::SendRegisterEventNotificationMessage(const E
                                                                          const pid_t target_node_id) noexcept
 {
     const auto message = SerializeToMessage(score::cpp::to_underlying(MessageType::kRegisterEventNotifier), event_id);
-    // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function shall
-    // have automatic storage duration".
-    // The object is a shared_ptr which is allocated in the heap.
-    // coverity[autosar_cpp14_a18_5_8_violation]
-    auto sender = client_cache_.GetMessagePassingClient(target_node_id);
-    const auto result = sender->Send(message);
+    const auto result =
+        client_cache_.Send(target_node_id, message, message_passing::IClientConnection::PriorityClass::kControl);
     if (!result.has_value())
     {
         score::mw::log::LogError("lola")
@@ -1455,7 +1558,16 @@ void MessagePassingServiceInstance::RegisterEventNotificationExistenceChangedCal
     IMessagePassingService::HandlerStatusChangeCallback callback) noexcept
 {
     std::unique_lock<std::shared_mutex> write_lock(handler_status_change_callbacks_mutex_);
-    handler_status_change_callbacks_[event_id] = std::move(callback);
+    auto existing_callback = handler_status_change_callbacks_.find(event_id);
+    if (existing_callback != handler_status_change_callbacks_.end())
+    {
+        existing_callback->second = std::move(callback);
+    }
+    else
+    {
+        WarnIfCapacityExhausted(handler_status_change_callbacks_, "handler_status_change_callbacks");
+        score::cpp::ignore = handler_status_change_callbacks_.try_emplace(event_id, std::move(callback));
+    }
     write_lock.unlock();
 
     // Check current handler status and invoke callback if handlers already exist
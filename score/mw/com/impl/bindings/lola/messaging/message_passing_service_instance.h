@@ -14,9 +14,12 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGE_PASSING_SERVICE_INSTANCE_H
 
 #include "score/mw/com/impl/bindings/lola/messaging/asil_specific_cfg.h"
+#include "score/mw/com/impl/bindings/lola/messaging/fixed_capacity_flat_map.h"
 #include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
 #include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service_instance.h"
 #include "score/mw/com/impl/bindings/lola/messaging/message_passing_client_cache.h"
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduler.h"
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduling_cfg.h"
 #include "score/mw/com/impl/bindings/lola/proxy_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
 
@@ -30,13 +33,12 @@
 
 #include <score/span.hpp>
 
-// TODO: PMR
 #include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <memory>
-#include <set>
 #include <shared_mutex>
 #include <unordered_map>
 #include <utility>
@@ -91,7 +93,8 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
 
     Result<void> RegisterMethodCallHandler(const ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
                                            IMessagePassingService::MethodCallHandler method_call_callback,
-                                           const uid_t allowed_proxy_uid) override;
+                                           const uid_t allowed_proxy_uid,
+                                           const MethodCallSchedulingCfg scheduling_cfg) override;
 
     void UnregisterOnServiceMethodSubscribedHandler(
         const SkeletonInstanceIdentifier skeleton_instance_identifier) override;
@@ -161,6 +164,18 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
         IMessagePassingService::HandlerRegistrationNoType register_no{};
     };
 
+    struct RegisteredMethodCallHandler
+    {
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types
+        // shall be private.". We need these data elements to be organized into a coherent organized data structure.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        IMessagePassingService::MethodCallHandler handler;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        uid_t allowed_proxy_uid;
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        MethodCallSchedulingCfg scheduling_cfg;
+    };
+
     /// \brief Counter for registered event receive notifications for the given (target) node.
     struct NodeCounter
     {
@@ -178,16 +193,21 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
     // coverity[autosar_cpp14_a0_1_1_violation]
     static constexpr std::uint8_t NodeIdTmpBufferSize{20U};
 
-    // TODO: PMR
-    using EventUpdateNotifierMapType = std::unordered_map<ElementFqId, std::vector<RegisteredNotificationHandler>>;
-    using EventUpdateNodeIdMapType = std::unordered_map<ElementFqId, std::set<pid_t>>;
-    using EventUpdateRegistrationCountMapType = std::unordered_map<ElementFqId, NodeCounter>;
+    // Event notification (un)registrations happen at runtime, e.g. with every (un)subscription with receive handler.
+    // Therefore the related maps are flat maps, whose storage gets preallocated from the AsilSpecificCfg capacities.
+    // With keys never being removed from event_update_handlers_/event_update_interested_nodes_ and the value
+    // containers keeping their capacity, re-registering for an already known event does not allocate.
+    using NodeIdSetType = FixedCapacityFlatSet<pid_t>;
+    using EventUpdateNotifierMapType = FixedCapacityFlatMap<ElementFqId, std::vector<RegisteredNotificationHandler>>;
+    using EventUpdateNodeIdMapType = FixedCapacityFlatMap<ElementFqId, NodeIdSetType>;
+    using EventUpdateRegistrationCountMapType = FixedCapacityFlatMap<ElementFqId, NodeCounter>;
+    using HandlerStatusChangeCallbackMapType =
+        FixedCapacityFlatMap<ElementFqId, IMessagePassingService::HandlerStatusChangeCallback>;
 
     using SubscribeServiceMethodMapType = std::unordered_map<
         SkeletonInstanceIdentifier,
         std::pair<IMessagePassingService::ServiceMethodSubscribedHandler, IMessagePassingService::AllowedConsumerUids>>;
-    using CallMethodMapType =
-        std::unordered_map<ProxyMethodInstanceIdentifier, std::pair<IMessagePassingService::MethodCallHandler, uid_t>>;
+    using CallMethodMapType = std::unordered_map<ProxyMethodInstanceIdentifier, RegisteredMethodCallHandler>;
 
     /// \brief tmp buffer for copying ids under lock.
     /// \todo Make its size configurable?
@@ -213,6 +233,13 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
                                                           const pid_t sender_node_id);
     score::Result<void> HandleCallMethodMsg(const score::cpp::span<const std::uint8_t> payload, const uid_t sender_uid);
 
+    /// \brief Hands a valid CallMethod message over to method_call_scheduler_, which replies to it later.
+    /// \return true, if the call has been enqueued. false, if there is no method_call_scheduler_ or the message has to
+    ///         be handled (and replied to with an error) synchronously by MessageCallbackWithReply().
+    bool ScheduleMethodCall(score::message_passing::IServerConnection& connection,
+                            const uid_t sender_uid,
+                            const score::cpp::span<const std::uint8_t> message) noexcept;
+
     std::uint32_t NotifyEventLocally(const ElementFqId event_id) noexcept;
     void NotifyEventRemote(const ElementFqId event_id) noexcept;
     void RegisterEventNotificationRemote(const ElementFqId event_id, const pid_t target_node_id) noexcept;
@@ -260,7 +287,7 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
     /// \details
     /// \tparam MapType Type of the Map. It is implicitly expected, that the key of MapType is of type ElementFqId
     /// and
-    ///         the mapped_type is a std::set (or at least some forward iterable container type, which supports
+    ///         the mapped_type is a sorted set (or at least some forward iterable container type, which supports
     ///         lower_bound()), which contains values, which directly or indirectly contain a node identifier
     ///         (pid_t)
     ///
@@ -326,7 +353,8 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
     ClientQualityType asil_level_;
     MessagePassingClientCache client_cache_;
 
-    // TODO: refactor for PMR/static
+    /// \brief Number of remote nodes per event, for which storage gets preallocated on first registration of an event.
+    std::size_t max_remote_nodes_per_event_;
 
     /// \brief map holding per event_id a list of notification/receive handlers registered by local proxy-event
     ///        instances, which need to be called, when the event with given _event_id_ is updated.
@@ -338,8 +366,7 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
     /// \details This allows SkeletonEvent instances to be notified when they transition from having
     ///          no handlers to having at least one handler (or vice versa), avoiding unnecessary lock
     ///          overhead in the main path when no handlers are registered.
-    std::unordered_map<ElementFqId, IMessagePassingService::HandlerStatusChangeCallback>
-        handler_status_change_callbacks_;
+    HandlerStatusChangeCallbackMapType handler_status_change_callbacks_;
 
     std::shared_mutex handler_status_change_callbacks_mutex_;
 
@@ -379,6 +406,11 @@ class MessagePassingServiceInstance : public IMessagePassingServiceInstance
 
     std::shared_mutex call_method_handlers_mutex_;
 
+    /// \brief Dispatches method calls of proxies in other processes by priority. nullptr, if no method call worker
+    ///        threads are configured. Then these calls are executed on the message passing thread.
+    /// \details Shared with the disconnect callback of server_, which outlives this member.
+    std::shared_ptr<MethodCallScheduler> method_call_scheduler_;
+
     /// \brief executor for processing local event update notification.
     /// \detail local update notification leads to a user provided receive handler callout, whose
     ///         runtime is unknown, so we decouple with worker threads.
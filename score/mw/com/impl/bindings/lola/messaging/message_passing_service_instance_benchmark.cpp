@@ -0,0 +1,235 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/messaging/message_passing_service_instance.h"
+#include "score/message_passing/mock/client_factory_mock.h"
+#include "score/message_passing/mock/server_connection_mock.h"
+#include "score/message_passing/mock/server_factory_mock.h"
+#include "score/message_passing/mock/server_mock.h"
+#include "score/message_passing/server_types.h"
+
+#include "score/concurrency/executor_mock.h"
+#include "score/os/unistd.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+// Counting global allocations, so that the benchmark can report, how many heap allocations a registration churn
+// cycle causes. After warm-up this is expected to be zero.
+namespace
+{
+std::atomic<std::uint64_t> gAllocationCount{0U};
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    gAllocationCount.fetch_add(1U, std::memory_order_relaxed);
+    if (void* const memory = std::malloc(size == 0U ? 1U : size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace score::message_passing;
+
+// Values of MessagePassingServiceInstance::MessageType
+constexpr std::uint8_t kRegisterEventNotifierMessage{1U};
+constexpr std::uint8_t kUnregisterEventNotifierMessage{2U};
+
+ElementFqId MakeEventId(const std::int64_t index)
+{
+    return ElementFqId{static_cast<ElementFqId::ServiceId>(index / 8),
+                       static_cast<ElementFqId::ElementId>(index % 8),
+                       ElementFqId::InstanceId{1U},
+                       ServiceElementType::EVENT};
+}
+
+std::vector<std::uint8_t> MakeMessage(const std::uint8_t message_type, const ElementFqId& event_id)
+{
+    std::vector<std::uint8_t> message(sizeof(ElementFqId) + 1U, 0U);
+    message[0] = message_type;
+    std::memcpy(&message[1], &event_id, sizeof(ElementFqId));
+    return message;
+}
+
+class MessagePassingServiceInstanceFixture : public benchmark::Fixture
+{
+  public:
+    using benchmark::Fixture::SetUp;
+    using benchmark::Fixture::TearDown;
+
+    void SetUp(const benchmark::State& state) override
+    {
+        const auto number_of_events = static_cast<std::size_t>(state.range(0));
+
+        auto server_mock = score::cpp::pmr::make_unique<::testing::NiceMock<ServerMock>>(
+            score::cpp::pmr::get_default_resource());
+        ON_CALL(*server_mock, StartListening(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+            .WillByDefault(
+                [this](ConnectCallback /*connect_callback*/,
+                       DisconnectCallback /*disconnect_callback*/,
+                       MessageCallback message_received_cb,
+                       MessageCallback /*message_received_w_reply_cb*/)
+                    -> score::cpp::expected_blank<score::os::Error> {
+                    received_send_message_callback_ = std::move(message_received_cb);
+                    return {};
+                });
+        ON_CALL(server_factory_mock_, Create(::testing::_, ::testing::_))
+            .WillByDefault(::testing::Return(::testing::ByMove(std::move(server_mock))));
+        ON_CALL(server_connection_mock_, GetUserData()).WillByDefault(::testing::ReturnRef(user_data_));
+
+        AsilSpecificCfg config{};
+        config.max_notification_events_ = number_of_events;
+        config.max_remote_nodes_per_event_ = kRemoteNodes;
+        unit_.emplace(
+            ClientQualityType::kASIL_QM, config, server_factory_mock_, client_factory_mock_, executor_mock_);
+
+        self_pid_ = os::Unistd::instance().getpid();
+        for (std::size_t index = 0U; index < number_of_events; ++index)
+        {
+            const auto event_id = MakeEventId(static_cast<std::int64_t>(index));
+            event_ids_.push_back(event_id);
+            register_messages_.push_back(MakeMessage(kRegisterEventNotifierMessage, event_id));
+            unregister_messages_.push_back(MakeMessage(kUnregisterEventNotifierMessage, event_id));
+        }
+        registration_numbers_.resize(number_of_events);
+    }
+
+    void TearDown(const benchmark::State& /*state*/) override
+    {
+        unit_.reset();
+        event_ids_.clear();
+        register_messages_.clear();
+        unregister_messages_.clear();
+        registration_numbers_.clear();
+    }
+
+  protected:
+    static constexpr std::size_t kRemoteNodes{8U};
+
+    void ReceiveFromNode(const std::vector<std::uint8_t>& message, const pid_t node)
+    {
+        user_data_ = UserData{std::in_place_type<std::uintptr_t>, static_cast<std::uintptr_t>(node)};
+        received_send_message_callback_(server_connection_mock_, {message.data(), message.size()});
+    }
+
+    ::testing::NiceMock<ClientFactoryMock> client_factory_mock_{};
+    ::testing::NiceMock<ServerFactoryMock> server_factory_mock_{};
+    ::testing::NiceMock<ServerConnectionMock> server_connection_mock_{};
+    ::testing::NiceMock<concurrency::testing::ExecutorMock> executor_mock_{};
+    MessageCallback received_send_message_callback_{};
+    UserData user_data_{std::in_place_type<std::uintptr_t>, 0U};
+
+    std::optional<MessagePassingServiceInstance> unit_{};
+    pid_t self_pid_{};
+    std::vector<ElementFqId> event_ids_{};
+    std::vector<std::vector<std::uint8_t>> register_messages_{};
+    std::vector<std::vector<std::uint8_t>> unregister_messages_{};
+    std::vector<IMessagePassingService::HandlerRegistrationNoType> registration_numbers_{};
+};
+
+// Mimics a mode switch, in which all local proxy events re-register their receive handlers.
+BENCHMARK_DEFINE_F(MessagePassingServiceInstanceFixture, LocalRegistrationChurn)(benchmark::State& state)
+{
+    score::safecpp::Scope<> scope{};
+    auto handler = std::make_shared<ScopedEventReceiveHandler>(scope, []() noexcept {});
+
+    std::uint64_t allocations{0U};
+    for (auto _ : state)
+    {
+        std::ignore = _;
+        const auto allocations_before = gAllocationCount.load(std::memory_order_relaxed);
+        for (std::size_t index = 0U; index < event_ids_.size(); ++index)
+        {
+            registration_numbers_[index] = unit_->RegisterEventNotification(event_ids_[index], handler, self_pid_);
+        }
+        for (std::size_t index = 0U; index < event_ids_.size(); ++index)
+        {
+            unit_->UnregisterEventNotification(event_ids_[index], registration_numbers_[index], self_pid_);
+        }
+        allocations += gAllocationCount.load(std::memory_order_relaxed) - allocations_before;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+// Mimics a mode switch on the provider side, in which several remote consumer nodes re-register for all events.
+BENCHMARK_DEFINE_F(MessagePassingServiceInstanceFixture, RemoteRegistrationChurn)(benchmark::State& state)
+{
+    constexpr pid_t kFirstRemoteNode{1000};
+
+    std::uint64_t allocations{0U};
+    for (auto _ : state)
+    {
+        std::ignore = _;
+        const auto allocations_before = gAllocationCount.load(std::memory_order_relaxed);
+        for (pid_t node = kFirstRemoteNode; node < kFirstRemoteNode + static_cast<pid_t>(kRemoteNodes); ++node)
+        {
+            for (const auto& message : register_messages_)
+            {
+                ReceiveFromNode(message, node);
+            }
+        }
+        for (pid_t node = kFirstRemoteNode; node < kFirstRemoteNode + static_cast<pid_t>(kRemoteNodes); ++node)
+        {
+            for (const auto& message : unregister_messages_)
+            {
+                ReceiveFromNode(message, node);
+            }
+        }
+        allocations += gAllocationCount.load(std::memory_order_relaxed) - allocations_before;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(kRemoteNodes));
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_REGISTER_F(MessagePassingServiceInstanceFixture, LocalRegistrationChurn)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(MessagePassingServiceInstanceFixture, RemoteRegistrationChurn)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
+
+BENCHMARK_MAIN();
@@ -25,6 +25,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+
 namespace score::mw::com::impl::lola
 {
 namespace
@@ -175,14 +178,15 @@ class MessagePassingServiceInstanceMethodsFixture : public ::testing::Test
 
     MessagePassingServiceInstanceMethodsFixture& WithARegisteredMethodCallHandler(
         ProxyMethodInstanceIdentifier proxy_method_instance_identifier,
-        uid_t allowed_consumer_uid)
+        uid_t allowed_consumer_uid,
+        const MethodCallSchedulingCfg scheduling_cfg = {})
     {
         SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(unit_ != nullptr);
         SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(client_identity_ != nullptr);
         IMessagePassingService::MethodCallHandler scoped_method_call_handler{method_call_handler_scope_,
                                                                              mock_method_call_handler_.AsStdFunction()};
         auto result = unit_->RegisterMethodCallHandler(
-            proxy_method_instance_identifier, scoped_method_call_handler, allowed_consumer_uid);
+            proxy_method_instance_identifier, scoped_method_call_handler, allowed_consumer_uid, scheduling_cfg);
         EXPECT_TRUE(result.has_value());
         return *this;
     }
@@ -717,7 +721,7 @@ TEST_F(MessagePassingServiceInstanceRegisterMethodCallHandlerTest,
     // handler should have been cleand up before registering the new one
     SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
         score::cpp::ignore = unit_->RegisterMethodCallHandler(
-            kProxyMethodInstanceIdentifier, scoped_method_call_handler_2, client_identity_->uid));
+            kProxyMethodInstanceIdentifier, scoped_method_call_handler_2, client_identity_->uid, {}));
 }
 
 using MessagePassingServiceInstanceRegisterSubscribeHandlerTest = MessagePassingServiceInstanceMethodsFixture;
@@ -1045,6 +1049,61 @@ TEST_F(MessagePassingServiceInstanceHandleCallMethodMessageTest, RepliesErrorWhe
         received_send_message_with_reply_callback_(server_connection_mock_, CreateValidCallMethodMessage());
 }
 
+using MessagePassingServiceInstanceScheduledCallMethodMessageTest = MessagePassingServiceInstanceMethodsFixture;
+TEST_F(MessagePassingServiceInstanceScheduledCallMethodMessageTest, CallIsExecutedAndRepliedByMethodCallWorker)
+{
+    // Given a MessagePassingServiceInstance with a method call worker thread
+    asil_cfg_.method_call_worker_threads_ = 1U;
+    GivenAMessagePassingServiceInstance().WithAClientInDifferentProcess().WithARegisteredMethodCallHandler(
+        kProxyMethodInstanceIdentifier, client_identity_->uid, MethodCallSchedulingCfg{200U, 1U, 1U});
+
+    // Expecting that the registered method call handler will be called with the provided queue position
+    EXPECT_CALL(mock_method_call_handler_, Call(kQueuePosition));
+
+    // and that a reply containing success will be sent afterwards
+    std::promise<void> reply_sent{};
+    EXPECT_CALL(server_connection_mock_, Reply(_))
+        .WillOnce(Invoke([this, &reply_sent](auto reply_buffer) -> score::cpp::expected_blank<score::os::Error> {
+            const auto reply_result = DeserializeMethodReplyMessage(reply_buffer);
+            EXPECT_TRUE(reply_result.has_value());
+            reply_sent.set_value();
+            return {};
+        }));
+
+    // When a valid MessageWithReply message is received of type kCallMethod
+    const auto result =
+        received_send_message_with_reply_callback_(server_connection_mock_, CreateValidCallMethodMessage());
+
+    // Then a valid result is returned
+    ASSERT_TRUE(result.has_value());
+
+    // and the reply is sent by the method call worker
+    EXPECT_EQ(reply_sent.get_future().wait_for(std::chrono::seconds{5}), std::future_status::ready);
+}
+
+TEST_F(MessagePassingServiceInstanceScheduledCallMethodMessageTest, CallWhichCannotBeScheduledIsRepliedWithError)
+{
+    // Given a MessagePassingServiceInstance with a method call worker thread
+    asil_cfg_.method_call_worker_threads_ = 1U;
+    GivenAMessagePassingServiceInstance().WithAClientInDifferentProcess();
+
+    // Expecting that a reply containing a not subscribed error will be sent directly, since no method call handler
+    // has been registered
+    EXPECT_CALL(server_connection_mock_, Reply(_))
+        .WillOnce(Invoke([this](auto reply_buffer) -> score::cpp::expected_blank<score::os::Error> {
+            const auto reply_result = DeserializeMethodReplyMessage(reply_buffer);
+            EXPECT_THAT(reply_result, ContainsError(MethodErrc::kNotSubscribed));
+            return {};
+        }));
+
+    // When a valid MessageWithReply message is received of type kCallMethod
+    const auto result =
+        received_send_message_with_reply_callback_(server_connection_mock_, CreateValidCallMethodMessage());
+
+    // Then a valid result is returned since the error is a recoverable error
+    ASSERT_TRUE(result.has_value());
+}
+
 using MessagePassingServiceInstanceHandleSubscribeMethodMessageTest = MessagePassingServiceInstanceMethodsFixture;
 TEST_F(MessagePassingServiceInstanceHandleSubscribeMethodMessageTest, ReturnsErrorWhenPayloadHasUnexpectedSize)
 {
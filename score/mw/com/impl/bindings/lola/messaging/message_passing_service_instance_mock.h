@@ -51,7 +51,10 @@ class MessagePassingServiceInstanceMock : public IMessagePassingServiceInstance
 
     MOCK_METHOD(Result<void>,
                 RegisterMethodCallHandler,
-                (ProxyMethodInstanceIdentifier, IMessagePassingService::MethodCallHandler, uid_t),
+                (ProxyMethodInstanceIdentifier,
+                 IMessagePassingService::MethodCallHandler,
+                 uid_t,
+                 MethodCallSchedulingCfg),
                 (override));
 
     MOCK_METHOD(void, NotifyOutdatedNodeId, (const pid_t, const pid_t), (noexcept, override));
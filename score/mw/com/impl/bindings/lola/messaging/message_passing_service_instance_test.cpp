@@ -11,6 +11,9 @@
 
 #include "score/os/mocklib/unistdmock.h"
 
+#include <atomic>
+#include <vector>
+
 namespace score::mw::com::impl::lola
 {
 
@@ -370,8 +373,8 @@ TEST_F(MessagePassingServiceInstanceTest, RegisterEventNotificationRemoteSendsRe
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called with the control priority class
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, IClientConnection::PriorityClass::kControl))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When handler being registered with pid != local_pid
@@ -391,8 +394,8 @@ TEST_F(MessagePassingServiceInstanceTest,
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called and return an error
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called and return an error
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::make_unexpected<score::os::Error>(os::Error::createFromErrno(ENOMEM))));
 
     // When handler being registered with pid != local_pid
@@ -412,8 +415,8 @@ TEST_F(MessagePassingServiceInstanceTest,
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When handler being registered with pid != local_pid
@@ -434,7 +437,9 @@ TEST_F(MessagePassingServiceInstanceTest,
         .WillRepeatedly(::testing::Invoke([](auto&&...) {
             auto client_connection_mock = score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(
                 score::cpp::pmr::new_delete_resource());
-            EXPECT_CALL(*client_connection_mock, Send(::testing::_)).Times(1);
+            ON_CALL(*client_connection_mock, GetState())
+                .WillByDefault(::testing::Return(IClientConnection::State::kReady));
+            EXPECT_CALL(*client_connection_mock, SendWithPriority(::testing::_, ::testing::_)).Times(1);
 
             return client_connection_mock;
         }));
@@ -451,8 +456,9 @@ TEST_F(MessagePassingServiceInstanceTest,
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called once upon first registration and once upon unregistration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration and once upon
+    // unregistration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .Times(2)
         .WillRepeatedly(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
@@ -470,8 +476,8 @@ TEST_F(MessagePassingServiceInstanceTest,
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called twice: on registration and unregistration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called twice: on registration and unregistration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}))
         .WillOnce(testing::Return(score::cpp::make_unexpected<score::os::Error>(os::Error::createFromErrno(ENOMEM))));
 
@@ -490,7 +496,7 @@ TEST_F(MessagePassingServiceInstanceTest,
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
     // Expect only the registration message to be sent.
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .Times(1)
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
@@ -506,14 +512,56 @@ TEST_F(MessagePassingServiceInstanceTest,
     instance.UnregisterEventNotification(event_id_, registration_no, remote_pid_);
 }
 
+TEST_F(MessagePassingServiceInstanceTest,
+       UnregisterEventNotificationRemoteIsSentAfterRegistrationWhenConnectionBecomesReady)
+{
+    // Given a client connection which is still starting and whose state callback is captured
+    std::atomic<IClientConnection::State> state{IClientConnection::State::kStarting};
+    IClientConnection::StateCallback state_callback{};
+    ON_CALL(client_connection_mock_, GetState()).WillByDefault([&state]() noexcept {
+        return state.load();
+    });
+    EXPECT_CALL(client_connection_mock_, Start(::testing::_, ::testing::_))
+        .WillOnce([&state_callback](auto callback, auto) noexcept {
+            state_callback = std::move(callback);
+        });
+
+    // and a service instance
+    MessagePassingServiceInstance instance{
+        quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
+
+    // and a handler being registered with pid != local_pid
+    auto registration_no = instance.RegisterEventNotification(event_id_, {}, remote_pid_);
+
+    // When UnregisterEventNotification is called before the connection has become ready
+    instance.UnregisterEventNotification(event_id_, registration_no, remote_pid_);
+
+    // Then the registration is sent first and the unregistration afterwards, once the connection becomes ready
+    std::vector<std::uint8_t> sent_message_types{};
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, IClientConnection::PriorityClass::kControl))
+        .Times(2)
+        .WillRepeatedly(
+            [&sent_message_types](auto message, auto) noexcept -> score::cpp::expected_blank<score::os::Error> {
+                sent_message_types.push_back(message.front());
+                return {};
+            });
+    state = IClientConnection::State::kReady;
+    ASSERT_FALSE(state_callback.empty());
+    state_callback(IClientConnection::State::kReady);
+
+    EXPECT_EQ(sent_message_types,
+              (std::vector<std::uint8_t>{score::cpp::to_underlying(MessageType::kRegisterEventNotifier),
+                                         score::cpp::to_underlying(MessageType::kUnregisterEventNotifier)}));
+}
+
 TEST_F(MessagePassingServiceInstanceTest, UnregisterEventNotificationRemoteDoesNotUnregisterOnPidMismatch)
 {
     // Given service instance
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // Given handler being registered with pid != local_pid
@@ -530,8 +578,8 @@ TEST_F(MessagePassingServiceInstanceTest,
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // Given handler being registered with pid != local_pid twice
@@ -575,8 +623,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventRemoteNotifiesClients)
     received_send_message_callback_(*server_connection_mock_,
                                     Serialize(event_id_, MessageType::kRegisterEventNotifier));
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called with the bulk priority class
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, IClientConnection::PriorityClass::kBulk))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When NotifyEvent() for the same event is called
@@ -613,8 +661,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventRemoteNotifiesClientsRegist
     received_send_message_callback_(*server_connection_mock_,
                                     Serialize(event_id_, MessageType::kRegisterEventNotifier));
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When NotifyEvent() for the same event is called
@@ -632,7 +680,7 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventRemoteDoesNotTerminateOnSen
                                     Serialize(event_id_, MessageType::kRegisterEventNotifier));
 
     // and client connection that returns an error on Send()
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::make_unexpected<score::os::Error>(os::Error::createFromErrno(ENOMEM))));
 
     // When NotifyEvent() for the same event is called
@@ -664,7 +712,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventRemoteNotifiesClientsExceed
             auto mock = score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(
                 score::cpp::pmr::new_delete_resource());
 
-            EXPECT_CALL(*mock, Send(::testing::_)).WillOnce(testing::Invoke([&nums_called]() {
+            ON_CALL(*mock, GetState()).WillByDefault(::testing::Return(IClientConnection::State::kReady));
+            EXPECT_CALL(*mock, SendWithPriority(::testing::_, ::testing::_)).WillOnce(testing::Invoke([&nums_called]() {
                 ++nums_called;
                 return score::cpp::expected_blank<score::os::Error>{};
             }));
@@ -712,8 +761,8 @@ TEST_F(MessagePassingServiceInstanceTest,
     received_send_message_callback_(*server_connection_mock_,
                                     Serialize(event_id_, MessageType::kRegisterEventNotifier));
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_)).Times(1);
+    // Expect client connection SendWithPriority() to be called
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_)).Times(1);
 
     // When unregister event notifier message is received for different event
     ++event_id_.element_id_;
@@ -778,8 +827,8 @@ TEST_F(MessagePassingServiceInstanceTest, HandleOutdatedNodeIdCalledWithUnregist
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_)).Times(1);
+    // Expect client connection SendWithPriority() to be called
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_)).Times(1);
 
     // Given notification is registered
     received_send_message_callback_(*server_connection_mock_,
@@ -814,8 +863,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventMessageCallsRegisteredHandl
             handler_called = true;
         });
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // when handler being registered for event
@@ -841,8 +890,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyEventMessageDoesNotCallHandlerFo
             handler_called = true;
         });
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // when handler being registered for event
@@ -933,8 +982,8 @@ TEST_F(MessagePassingServiceInstanceTest, ReregisterEventNotificationForTheSameE
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called once upon first registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called once upon first registration
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // Given event notification being registered for remote pid
@@ -956,7 +1005,8 @@ TEST_F(MessagePassingServiceInstanceTest, ReregisterEventNotificationWithDiffere
         .WillRepeatedly(::testing::Invoke([](auto&&...) {
             auto mock = score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(
                 score::cpp::pmr::new_delete_resource());
-            EXPECT_CALL(*mock, Send(::testing::_))
+            ON_CALL(*mock, GetState()).WillByDefault(::testing::Return(IClientConnection::State::kReady));
+            EXPECT_CALL(*mock, SendWithPriority(::testing::_, ::testing::_))
                 .WillOnce(::testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
             return mock;
@@ -982,8 +1032,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyOutdatedNodeCreatesClientAndSend
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When NotifyOutdatedNodeId() is called for a previously unused target_node_id
@@ -996,8 +1046,8 @@ TEST_F(MessagePassingServiceInstanceTest, NotifyOutdatedNodeDoesNotTerminateOnFa
     MessagePassingServiceInstance instance{
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
-    // Expect client connection Send() to be called
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    // Expect client connection SendWithPriority() to be called
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::make_unexpected<score::os::Error>(os::Error::createFromErrno(ENOMEM))));
 
     // When NotifyOutdatedNodeId() is called for a previously unused target_node_id
@@ -1052,7 +1102,7 @@ TEST_F(MessagePassingServiceInstanceTest, RegisterCallbackWithExistingRemoteHand
         quality_type_, asil_cfg_, server_factory_mock_, client_factory_mock_, executor_mock_};
 
     // Setup client connection mock for remote registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     instance.RegisterEventNotification(event_id_, {}, remote_pid_);
@@ -1198,7 +1248,7 @@ TEST_F(MessagePassingServiceInstanceTest, LocalAndRemoteHandlersMixedCallbackRes
     // Setup client connection mock for remote registration
     auto client_conn_mock =
         score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(score::cpp::pmr::new_delete_resource());
-    EXPECT_CALL(*client_conn_mock, Send(::testing::_))
+    EXPECT_CALL(*client_conn_mock, SendWithPriority(::testing::_, ::testing::_))
         .WillRepeatedly(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
     EXPECT_CALL(*client_conn_mock, GetState()).WillRepeatedly(testing::Return(IClientConnection::State::kReady));
     EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
@@ -1243,7 +1293,7 @@ TEST_F(MessagePassingServiceInstanceTest, RemoteHandlerRegistrationInvokesCallba
     });
 
     // Setup client connection mock for remote registration
-    EXPECT_CALL(client_connection_mock_, Send(::testing::_))
+    EXPECT_CALL(client_connection_mock_, SendWithPriority(::testing::_, ::testing::_))
         .WillOnce(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
 
     // When registering first remote handler
@@ -1263,7 +1313,7 @@ TEST_F(MessagePassingServiceInstanceTest, RemoteHandlerUnregistrationInvokesCall
     // Setup client connection mock for remote registration
     auto client_conn_mock =
         score::cpp::pmr::make_unique<::testing::NiceMock<ClientConnectionMock>>(score::cpp::pmr::new_delete_resource());
-    EXPECT_CALL(*client_conn_mock, Send(::testing::_))
+    EXPECT_CALL(*client_conn_mock, SendWithPriority(::testing::_, ::testing::_))
         .WillRepeatedly(testing::Return(score::cpp::expected_blank<score::os::Error>{}));
     EXPECT_CALL(*client_conn_mock, GetState()).WillRepeatedly(testing::Return(IClientConnection::State::kReady));
     EXPECT_CALL(client_factory_mock_, Create(::testing::_, ::testing::_))
@@ -59,7 +59,7 @@ class MessagePassingServiceMock : public IMessagePassingService
                 (override));
     MOCK_METHOD(Result<MethodSubscriptionRegistrationGuard>,
                 RegisterMethodCallHandler,
-                (QualityType, ProxyMethodInstanceIdentifier, MethodCallHandler, uid_t),
+                (QualityType, ProxyMethodInstanceIdentifier, MethodCallHandler, uid_t, MethodCallSchedulingCfg),
                 (override));
     MOCK_METHOD(Result<void>,
                 SubscribeServiceMethod,
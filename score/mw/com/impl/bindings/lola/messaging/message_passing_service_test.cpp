@@ -16,6 +16,16 @@
 #include "score/mw/com/impl/bindings/lola/messaging/message_passing_service_instance_mock.h"
 #include "score/mw/com/impl/com_error.h"
 
+// Suppress "AUTOSAR C++14 A16-0-1" rule findings.
+// This is the standard way to determine if it runs on QNX or Unix
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+#include "score/message_passing/unix_domain/unix_domain_client_factory.h"
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
+#include "score/message_passing/unix_domain/unix_domain_server_factory.h"
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+
 #include <gmock/gmock.h>
 #include <gtest/gtest-death-test.h>
 #include <gtest/gtest.h>
@@ -406,6 +416,40 @@ TEST_F(MessagePassingServiceTest, UnregisterEventNotificationExistenceChangedCal
     MessagePassingService unit{asil_qm_cfg_, asil_qm_cfg_, std::move(factory_)};
     unit.UnregisterEventNotificationExistenceChangedCallback(QualityType::kASIL_QM, event_id);
 }
+
+// coverity[autosar_cpp14_a16_0_1_violation]
+#ifndef __QNX__
+TEST_F(MessagePassingServiceTest, DistributesTheServersOverTheConfiguredReactors)
+{
+    // Expecting that both instances get factories, which share an engine pool with the configured number of reactors
+    std::shared_ptr<score::message_passing::UnixDomainEnginePool> asil_b_engine_pool{};
+    std::shared_ptr<score::message_passing::UnixDomainEnginePool> asil_qm_engine_pool{};
+    EXPECT_CALL(*factory_, Create(ClientQualityType::kASIL_B, _, _, _, _))
+        .WillOnce([this, &asil_b_engine_pool](auto, auto, auto& server_factory, auto& client_factory, auto&) {
+            asil_b_engine_pool =
+                dynamic_cast<score::message_passing::UnixDomainServerFactory&>(server_factory).GetEnginePool();
+            EXPECT_EQ(dynamic_cast<score::message_passing::UnixDomainClientFactory&>(client_factory).GetEnginePool(),
+                      asil_b_engine_pool);
+            return std::move(asil_b_message_passing_service_instance_mock_);
+        });
+    EXPECT_CALL(*factory_, Create(ClientQualityType::kASIL_QMfromB, _, _, _, _))
+        .WillOnce([this, &asil_qm_engine_pool](auto, auto, auto& server_factory, auto&, auto&) {
+            asil_qm_engine_pool =
+                dynamic_cast<score::message_passing::UnixDomainServerFactory&>(server_factory).GetEnginePool();
+            return std::move(asil_qm_message_passing_service_instance_mock_);
+        });
+
+    // When creating a MessagePassingService with ASIL-B support and two reactors
+    MessagePassingService unit{asil_qm_cfg_, asil_qm_cfg_, std::move(factory_), 2U};
+
+    // Then both servers are created from the same pool of two reactors
+    ASSERT_NE(asil_b_engine_pool, nullptr);
+    EXPECT_EQ(asil_b_engine_pool, asil_qm_engine_pool);
+    EXPECT_EQ(asil_b_engine_pool->GetSize(), 2U);
+}
+// coverity[autosar_cpp14_a16_0_1_violation]
+#endif
+
 class MessagePassingServiceQMDelegationTest : public MessagePassingServiceTest
 {
   protected:
@@ -457,13 +501,13 @@ TEST_F(MessagePassingServiceQMDelegationTest, RegisterMethodCallHandlerCallRetur
 
     // Expecting a call to RegisterMethodCallHandler of ASIL-QM mock instance
     EXPECT_CALL(*asil_qm_message_passing_service_instance_mock_,
-                RegisterMethodCallHandler(kProxyMethodInstanceId, _, kAllowedUid))
+                RegisterMethodCallHandler(kProxyMethodInstanceId, _, kAllowedUid, _))
         .WillOnce(Return(score::Result<void>{}));
-    EXPECT_CALL(*asil_b_message_passing_service_instance_mock_, RegisterMethodCallHandler(_, _, _)).Times(0);
+    EXPECT_CALL(*asil_b_message_passing_service_instance_mock_, RegisterMethodCallHandler(_, _, _, _)).Times(0);
 
     // When calling RegisterMethodCallHandler
     const auto result = GivenAMessagePassingServiceWithAsilBAndQm().RegisterMethodCallHandler(
-        QualityType::kASIL_QM, kProxyMethodInstanceId, std::move(callback), kAllowedUid);
+        QualityType::kASIL_QM, kProxyMethodInstanceId, std::move(callback), kAllowedUid, MethodCallSchedulingCfg{});
 
     // Then the result should have a value
     EXPECT_TRUE(result.has_value());
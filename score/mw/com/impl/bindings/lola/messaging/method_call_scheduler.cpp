@@ -0,0 +1,217 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduler.h"
+
+#include "score/mw/com/impl/bindings/lola/methods/method_error.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+#include <score/utility.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+constexpr auto kWorkerPoolName = "mw::com MethodCall";
+
+}  // namespace
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule finding: "The std::terminate() function shall not be called implicitly".
+// Rationale: Calling std::terminate() if the worker threads can't be created is expected as per safety requirements.
+// coverity[autosar_cpp14_a15_5_3_violation]
+MethodCallScheduler::MethodCallScheduler(const std::size_t number_of_workers, ReplySender reply_sender) noexcept
+    : reply_sender_{std::move(reply_sender)},
+      mutex_{},
+      pending_calls_{},
+      executing_calls_per_group_{},
+      connections_{},
+      statistics_{},
+      // Suppress "AUTOSAR C++14 A15-4-2" rule findings. This rule states: "Throwing an exception in a
+      // "noexcept" function." In this case it is ok, because the system anyways forces the process to
+      // terminate if an exception is thrown.
+      // coverity[autosar_cpp14_a15_4_2_violation]
+      worker_pool_{number_of_workers, kWorkerPoolName}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(number_of_workers > 0U,
+                                                      "MethodCallScheduler requires at least one worker thread.");
+}
+
+MethodCallScheduler::~MethodCallScheduler() noexcept
+{
+    // Workers, which are still running, finish their current call and find no further calls to dispatch. worker_pool_
+    // joins them, before any other member gets destroyed.
+    std::lock_guard<std::mutex> lock{mutex_};
+    pending_calls_.clear();
+}
+
+void MethodCallScheduler::Enqueue(IMessagePassingService::MethodCallHandler method_call_handler,
+                                  const std::size_t queue_position,
+                                  const MethodCallSchedulingCfg& scheduling_cfg,
+                                  score::message_passing::IServerConnection& connection) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        auto& scheduled_connection = connections_[&connection];
+        if (scheduled_connection == nullptr)
+        {
+            // Suppress "AUTOSAR C++14 A18-5-8" rule finding. This rule states: "Objects that do not outlive a function
+            // shall have automatic storage duration". It is shared with the calls of the connection.
+            // coverity[autosar_cpp14_a18_5_8_violation]
+            scheduled_connection = std::make_shared<ScheduledConnection>();
+            scheduled_connection->connection = &connection;
+        }
+        auto& queue = pending_calls_[scheduling_cfg.priority];
+        queue.push_back(PendingCall{
+            std::move(method_call_handler), queue_position, scheduling_cfg, scheduled_connection, Clock::now()});
+
+        auto& statistics = statistics_[scheduling_cfg.priority];
+        statistics.queue_depth++;
+        statistics.max_queue_depth = std::max(statistics.max_queue_depth, statistics.queue_depth);
+    }
+
+    // Every enqueued call posts one dispatch task. The task doesn't necessarily execute the call it has been posted
+    // for, but the highest priority call, which is pending, once a worker thread picks up the task.
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+    // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". The function Post
+    // throws on allocation failure but this throw directly leads to a termination based on a compiler hook.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    worker_pool_.Post([this](const score::cpp::stop_token& stop_token) noexcept {
+        DispatchPendingCalls(stop_token);
+    });
+}
+
+void MethodCallScheduler::DiscardCalls(const score::message_passing::IServerConnection& connection) noexcept
+{
+    std::shared_ptr<ScheduledConnection> scheduled_connection{};
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        const auto connection_it = connections_.find(&connection);
+        if (connection_it == connections_.end())
+        {
+            return;
+        }
+        scheduled_connection = std::move(connection_it->second);
+        score::cpp::ignore = connections_.erase(connection_it);
+
+        for (auto& [priority, queue] : pending_calls_)
+        {
+            const auto size_before = queue.size();
+            const auto new_end =
+                std::remove_if(queue.begin(), queue.end(), [&scheduled_connection](const PendingCall& call) {
+                    return call.connection == scheduled_connection;
+                });
+            score::cpp::ignore = queue.erase(new_end, queue.end());
+            statistics_[priority].queue_depth -= (size_before - queue.size());
+        }
+    }
+
+    // Executing calls of the connection keep scheduled_connection alive and skip their reply from now on.
+    std::lock_guard<std::mutex> connection_lock{scheduled_connection->mutex};
+    scheduled_connection->connection = nullptr;
+}
+
+MethodCallScheduler::PriorityStatistics MethodCallScheduler::GetStatistics(const std::uint8_t priority) const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    const auto statistics_it = statistics_.find(priority);
+    if (statistics_it == statistics_.cend())
+    {
+        return PriorityStatistics{};
+    }
+    return statistics_it->second;
+}
+
+void MethodCallScheduler::DispatchPendingCalls(const score::cpp::stop_token& stop_token) noexcept
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (!stop_token.stop_requested())
+    {
+        auto call = TakeNextCall();
+        if (!call.has_value())
+        {
+            // Either nothing is pending or all pending calls wait for their concurrency group. In the latter case, the
+            // worker finishing a call of the group dispatches them.
+            return;
+        }
+
+        lock.unlock();
+        Execute(call.value());
+        lock.lock();
+
+        executing_calls_per_group_.at(call.value().scheduling_cfg.concurrency_group)--;
+    }
+}
+
+auto MethodCallScheduler::TakeNextCall() noexcept -> std::optional<PendingCall>
+{
+    for (auto& [priority, queue] : pending_calls_)
+    {
+        const auto call_it = std::find_if(queue.begin(), queue.end(), [this](const PendingCall& call) {
+            const auto& max_concurrent_calls = call.scheduling_cfg.max_concurrent_calls;
+            if (!(max_concurrent_calls.has_value()))
+            {
+                return true;
+            }
+            const auto group_it = executing_calls_per_group_.find(call.scheduling_cfg.concurrency_group);
+            return (group_it == executing_calls_per_group_.cend()) ||
+                   (group_it->second < static_cast<std::size_t>(max_concurrent_calls.value()));
+        });
+        if (call_it == queue.end())
+        {
+            continue;
+        }
+
+        PendingCall call{std::move(*call_it)};
+        score::cpp::ignore = queue.erase(call_it);
+
+        const auto wait_time = Clock::now() - call.enqueue_time;
+        auto& statistics = statistics_[priority];
+        statistics.queue_depth--;
+        statistics.dispatched_calls++;
+        statistics.accumulated_wait_time += wait_time;
+        statistics.max_wait_time = std::max(statistics.max_wait_time, wait_time);
+
+        executing_calls_per_group_[call.scheduling_cfg.concurrency_group]++;
+        return call;
+    }
+    return std::nullopt;
+}
+
+void MethodCallScheduler::Execute(PendingCall& call) noexcept
+{
+    score::Result<void> result{};
+    const auto invocation_result = std::invoke(call.method_call_handler, call.queue_position);
+    if (!(invocation_result.has_value()))
+    {
+        mw::log::LogError("lola") << "Invocation of method call handler failed as scope has been destroyed: "
+                                     "SkeletonMethod has already been destroyed.";
+        result = MakeUnexpected(MethodErrc::kSkeletonAlreadyDestroyed);
+    }
+
+    std::lock_guard<std::mutex> connection_lock{call.connection->mutex};
+    if (call.connection->connection == nullptr)
+    {
+        // The proxy has disconnected meanwhile.
+        return;
+    }
+    reply_sender_(*call.connection->connection, std::move(result));
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,150 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULER_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULER_H
+
+#include "score/mw/com/impl/bindings/lola/messaging/i_message_passing_service.h"
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduling_cfg.h"
+
+#include "score/concurrency/thread_pool.h"
+#include "score/message_passing/i_server_connection.h"
+#include "score/result/result.h"
+
+#include <score/callback.hpp>
+#include <score/stop_token.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Dispatches method calls of proxies in other processes to their method call handlers by priority.
+/// \details Instead of executing a method call handler on the message passing thread, the
+///          MessagePassingServiceInstance hands the call over to the scheduler and replies later. Pending calls are
+///          dispatched by worker threads highest priority first and in order of arrival within the same priority. A
+///          call, whose concurrency group already executes its max_concurrent_calls, stays pending without blocking
+///          calls of other concurrency groups. Executing handlers are not preempted: a call of the highest priority
+///          waits at most until one of the worker threads has finished its current call.
+class MethodCallScheduler final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Sends the result of an executed call as reply to the calling proxy. Called on a worker thread.
+    using ReplySender =
+        score::cpp::callback<void(score::message_passing::IServerConnection& connection, score::Result<void> result)>;
+
+    /// \brief Counters of the calls of one priority.
+    struct PriorityStatistics
+    {
+        // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types
+        // shall be private.". We need these data elements to be organized into a coherent organized data structure.
+        /// \brief Number of currently pending calls.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::size_t queue_depth{0U};
+        /// \brief Largest number of calls, which have been pending at the same time.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::size_t max_queue_depth{0U};
+        /// \brief Number of calls, which have been dispatched to their method call handler.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::uint64_t dispatched_calls{0U};
+        /// \brief Summed up time, which the dispatched calls have been pending.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        Clock::duration accumulated_wait_time{Clock::duration::zero()};
+        /// \brief Longest time, which a dispatched call has been pending.
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        Clock::duration max_wait_time{Clock::duration::zero()};
+    };
+
+    /// \param number_of_workers Number of worker threads executing method call handlers. Must be at least 1.
+    /// \param reply_sender Sends the result of every executed call to the calling proxy.
+    MethodCallScheduler(const std::size_t number_of_workers, ReplySender reply_sender) noexcept;
+
+    /// \brief Stops the worker threads after they have finished their current call. Pending calls are dropped.
+    ~MethodCallScheduler() noexcept;
+
+    MethodCallScheduler(const MethodCallScheduler&) = delete;
+    MethodCallScheduler(MethodCallScheduler&&) = delete;
+    MethodCallScheduler& operator=(const MethodCallScheduler&) = delete;
+    MethodCallScheduler& operator=(MethodCallScheduler&&) = delete;
+
+    /// \brief Enqueues a call, which gets executed and replied to by a worker thread.
+    /// \param connection Connection of the calling proxy. It has to stay valid until DiscardCalls() has been called
+    ///        for it.
+    void Enqueue(IMessagePassingService::MethodCallHandler method_call_handler,
+                 const std::size_t queue_position,
+                 const MethodCallSchedulingCfg& scheduling_cfg,
+                 score::message_passing::IServerConnection& connection) noexcept;
+
+    /// \brief Drops the pending calls of the given connection. Its executing calls aren't replied to anymore.
+    /// \details To be called on disconnect of a proxy process, before its connection gets destroyed. Doesn't wait for
+    ///          the executing calls of the connection, as it is called on the message passing thread. It only waits for
+    ///          a reply, which is being sent to the connection at the same time.
+    void DiscardCalls(const score::message_passing::IServerConnection& connection) noexcept;
+
+    PriorityStatistics GetStatistics(const std::uint8_t priority) const noexcept;
+
+  private:
+    /// \brief Connection of a calling proxy, which is shared by its pending and executing calls.
+    /// \details Outlives the connection itself, which gets destroyed after DiscardCalls(). The workers reply to the
+    ///          connection under the lock of this object and skip the reply, once the connection has been discarded.
+    struct ScheduledConnection
+    {
+        std::mutex mutex;
+        /// \brief nullptr, once the connection has been discarded.
+        score::message_passing::IServerConnection* connection;
+    };
+
+    struct PendingCall
+    {
+        IMessagePassingService::MethodCallHandler method_call_handler;
+        std::size_t queue_position;
+        MethodCallSchedulingCfg scheduling_cfg;
+        std::shared_ptr<ScheduledConnection> connection;
+        Clock::time_point enqueue_time;
+    };
+
+    void DispatchPendingCalls(const score::cpp::stop_token& stop_token) noexcept;
+
+    /// \brief Removes the highest priority call, whose concurrency group is below its limit, from the pending calls
+    ///        and accounts it as executing. Has to be called with mutex_ locked.
+    std::optional<PendingCall> TakeNextCall() noexcept;
+
+    void Execute(PendingCall& call) noexcept;
+
+    ReplySender reply_sender_;
+
+    mutable std::mutex mutex_;
+
+    std::map<std::uint8_t, std::deque<PendingCall>, std::greater<std::uint8_t>> pending_calls_;
+    std::unordered_map<MethodCallConcurrencyGroup, std::size_t> executing_calls_per_group_;
+    std::unordered_map<const score::message_passing::IServerConnection*, std::shared_ptr<ScheduledConnection>>
+        connections_;
+    std::map<std::uint8_t, PriorityStatistics> statistics_;
+
+    /// \brief Worker threads. Declared last, so that they are joined before any other member gets destroyed.
+    score::concurrency::ThreadPool worker_pool_;
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULER_H
@@ -0,0 +1,349 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduler.h"
+
+#include "score/mw/com/impl/bindings/lola/methods/method_error.h"
+
+#include "score/message_passing/mock/server_connection_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using namespace ::testing;
+
+constexpr std::uint8_t kLowPriority{0U};
+constexpr std::uint8_t kHighPriority{200U};
+constexpr std::size_t kBlockingQueuePosition{0U};
+constexpr std::size_t kLowPriorityQueuePosition{1U};
+constexpr std::size_t kHighPriorityQueuePosition{2U};
+constexpr std::chrono::seconds kMaxWaitTime{5};
+
+class MethodCallSchedulerFixture : public ::testing::Test
+{
+  public:
+    MethodCallSchedulerFixture& GivenAMethodCallScheduler(const std::size_t number_of_workers = 1U)
+    {
+        unit_ = std::make_unique<MethodCallScheduler>(
+            number_of_workers,
+            [this](score::message_passing::IServerConnection& connection, score::Result<void> result) noexcept {
+                std::lock_guard<std::mutex> lock{mutex_};
+                replies_.push_back({&connection, std::move(result)});
+                state_changed_.notify_all();
+            });
+        return *this;
+    }
+
+    /// \brief Enqueues a call, which blocks its worker until ReleaseBlockingCall() is called.
+    MethodCallSchedulerFixture& WithAWorkerBlockedByACall(const MethodCallSchedulingCfg& scheduling_cfg = {})
+    {
+        unit_->Enqueue(CreateHandler(), kBlockingQueuePosition, scheduling_cfg, server_connection_mock_);
+        WaitUntilExecutingCalls(1U);
+        return *this;
+    }
+
+    void ReleaseBlockingCall()
+    {
+        if (!blocking_call_released_flag_)
+        {
+            blocking_call_released_flag_ = true;
+            release_blocking_call_.set_value();
+        }
+    }
+
+    void TearDown() override
+    {
+        // Unblock the worker in case a test failed before releasing it, so that the scheduler can join its workers.
+        ReleaseBlockingCall();
+        unit_.reset();
+    }
+
+    IMessagePassingService::MethodCallHandler CreateHandler()
+    {
+        return IMessagePassingService::MethodCallHandler{
+            handler_scope_, [this](std::size_t queue_position) noexcept {
+                OnMethodCall(queue_position);
+            }};
+    }
+
+    void OnMethodCall(const std::size_t queue_position)
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            executed_queue_positions_.push_back(queue_position);
+            executing_calls_++;
+            state_changed_.notify_all();
+        }
+        if (queue_position == kBlockingQueuePosition)
+        {
+            blocking_call_released_.wait();
+        }
+        std::lock_guard<std::mutex> lock{mutex_};
+        executing_calls_--;
+        state_changed_.notify_all();
+    }
+
+    void WaitUntilExecutingCalls(const std::size_t number_of_calls)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        ASSERT_TRUE(state_changed_.wait_for(lock, kMaxWaitTime, [this, number_of_calls]() {
+            return executing_calls_ == number_of_calls;
+        }));
+    }
+
+    void WaitUntilReplies(const std::size_t number_of_replies)
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        ASSERT_TRUE(state_changed_.wait_for(lock, kMaxWaitTime, [this, number_of_replies]() {
+            return replies_.size() == number_of_replies;
+        }));
+    }
+
+    struct Reply
+    {
+        score::message_passing::IServerConnection* connection;
+        score::Result<void> result;
+    };
+
+    NiceMock<score::message_passing::ServerConnectionMock> server_connection_mock_{};
+    NiceMock<score::message_passing::ServerConnectionMock> server_connection_mock_2_{};
+
+    safecpp::Scope<> handler_scope_{};
+
+    std::promise<void> release_blocking_call_{};
+    std::shared_future<void> blocking_call_released_{release_blocking_call_.get_future().share()};
+    bool blocking_call_released_flag_{false};
+
+    std::mutex mutex_{};
+    std::condition_variable state_changed_{};
+    std::vector<std::size_t> executed_queue_positions_{};
+    std::size_t executing_calls_{0U};
+    std::vector<Reply> replies_{};
+
+    std::unique_ptr<MethodCallScheduler> unit_{nullptr};
+};
+
+using MethodCallSchedulerTest = MethodCallSchedulerFixture;
+
+TEST_F(MethodCallSchedulerTest, ExecutesEnqueuedCallAndRepliesToConnection)
+{
+    GivenAMethodCallScheduler();
+
+    // When enqueuing a call
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+
+    // Then the handler is called with the queue position and the successful result is replied to the connection
+    WaitUntilReplies(1U);
+    EXPECT_THAT(executed_queue_positions_, ElementsAre(kLowPriorityQueuePosition));
+    EXPECT_EQ(replies_.at(0).connection, &server_connection_mock_);
+    EXPECT_TRUE(replies_.at(0).result.has_value());
+}
+
+TEST_F(MethodCallSchedulerTest, DispatchesHigherPriorityCallsFirst)
+{
+    // Given a scheduler, whose only worker is blocked
+    GivenAMethodCallScheduler().WithAWorkerBlockedByACall();
+
+    // When enqueuing a low priority call before a high priority call
+    unit_->Enqueue(CreateHandler(),
+                   kLowPriorityQueuePosition,
+                   MethodCallSchedulingCfg{kLowPriority, {}, 1U},
+                   server_connection_mock_);
+    unit_->Enqueue(CreateHandler(),
+                   kHighPriorityQueuePosition,
+                   MethodCallSchedulingCfg{kHighPriority, {}, 2U},
+                   server_connection_mock_);
+
+    // and the worker gets unblocked
+    ReleaseBlockingCall();
+
+    // Then the high priority call is executed before the low priority call
+    WaitUntilReplies(3U);
+    EXPECT_THAT(executed_queue_positions_,
+                ElementsAre(kBlockingQueuePosition, kHighPriorityQueuePosition, kLowPriorityQueuePosition));
+}
+
+TEST_F(MethodCallSchedulerTest, DispatchesCallsOfSamePriorityInOrderOfArrival)
+{
+    // Given a scheduler, whose only worker is blocked
+    GivenAMethodCallScheduler().WithAWorkerBlockedByACall();
+
+    // When enqueuing two calls of the same priority
+    unit_->Enqueue(CreateHandler(), kHighPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+    ReleaseBlockingCall();
+
+    // Then they are executed in order of arrival
+    WaitUntilReplies(3U);
+    EXPECT_THAT(executed_queue_positions_,
+                ElementsAre(kBlockingQueuePosition, kHighPriorityQueuePosition, kLowPriorityQueuePosition));
+}
+
+TEST_F(MethodCallSchedulerTest, CallExceedingConcurrencyLimitDoesNotBlockOtherConcurrencyGroups)
+{
+    // Given a scheduler with two workers, of which one is blocked by a call of a concurrency group limited to 1 call
+    const MethodCallSchedulingCfg limited_cfg{kHighPriority, 1U, 1U};
+    GivenAMethodCallScheduler(2U).WithAWorkerBlockedByACall(limited_cfg);
+
+    // When enqueuing a further call of the limited concurrency group and a lower priority call of another group
+    unit_->Enqueue(CreateHandler(), kHighPriorityQueuePosition, limited_cfg, server_connection_mock_);
+    unit_->Enqueue(CreateHandler(),
+                   kLowPriorityQueuePosition,
+                   MethodCallSchedulingCfg{kLowPriority, {}, 2U},
+                   server_connection_mock_);
+
+    // Then only the call of the other group is executed while the limited group is at its limit
+    WaitUntilReplies(1U);
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        EXPECT_THAT(executed_queue_positions_, ElementsAre(kBlockingQueuePosition, kLowPriorityQueuePosition));
+    }
+
+    // and the pending call of the limited group is executed once the blocking call has finished
+    ReleaseBlockingCall();
+    WaitUntilReplies(3U);
+    EXPECT_THAT(executed_queue_positions_,
+                ElementsAre(kBlockingQueuePosition, kLowPriorityQueuePosition, kHighPriorityQueuePosition));
+}
+
+TEST_F(MethodCallSchedulerTest, StatisticsContainQueueDepthAndWaitTimePerPriority)
+{
+    // Given a scheduler, whose only worker is blocked
+    GivenAMethodCallScheduler().WithAWorkerBlockedByACall(MethodCallSchedulingCfg{kHighPriority, {}, 1U});
+
+    // When enqueuing two low priority calls
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+
+    // Then both are accounted as pending
+    const auto pending_statistics = unit_->GetStatistics(kLowPriority);
+    EXPECT_EQ(pending_statistics.queue_depth, 2U);
+    EXPECT_EQ(pending_statistics.max_queue_depth, 2U);
+    EXPECT_EQ(pending_statistics.dispatched_calls, 0U);
+
+    // and when they have been executed
+    ReleaseBlockingCall();
+    WaitUntilReplies(3U);
+
+    // Then they are accounted as dispatched and the max queue depth is kept
+    const auto statistics = unit_->GetStatistics(kLowPriority);
+    EXPECT_EQ(statistics.queue_depth, 0U);
+    EXPECT_EQ(statistics.max_queue_depth, 2U);
+    EXPECT_EQ(statistics.dispatched_calls, 2U);
+    EXPECT_GE(statistics.accumulated_wait_time, statistics.max_wait_time);
+
+    // and the blocking call is accounted for its own priority
+    EXPECT_EQ(unit_->GetStatistics(kHighPriority).dispatched_calls, 1U);
+}
+
+TEST_F(MethodCallSchedulerTest, StatisticsOfUnusedPriorityAreEmpty)
+{
+    GivenAMethodCallScheduler();
+
+    // When getting the statistics of a priority, for which no call has been enqueued
+    const auto statistics = unit_->GetStatistics(kHighPriority);
+
+    // Then all counters are zero
+    EXPECT_EQ(statistics.queue_depth, 0U);
+    EXPECT_EQ(statistics.max_queue_depth, 0U);
+    EXPECT_EQ(statistics.dispatched_calls, 0U);
+    EXPECT_EQ(statistics.max_wait_time, MethodCallScheduler::Clock::duration::zero());
+}
+
+TEST_F(MethodCallSchedulerTest, DiscardCallsDropsPendingCallsOfConnection)
+{
+    // Given a scheduler, whose only worker is blocked by a call of the first connection
+    GivenAMethodCallScheduler().WithAWorkerBlockedByACall();
+
+    // and a pending call of each connection
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_2_);
+    unit_->Enqueue(CreateHandler(), kHighPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+
+    // When discarding the calls of the second connection
+    unit_->DiscardCalls(server_connection_mock_2_);
+    EXPECT_EQ(unit_->GetStatistics(kLowPriority).queue_depth, 1U);
+
+    // Then only the calls of the first connection are executed and replied to
+    ReleaseBlockingCall();
+    WaitUntilReplies(2U);
+    EXPECT_THAT(executed_queue_positions_, ElementsAre(kBlockingQueuePosition, kHighPriorityQueuePosition));
+    EXPECT_EQ(replies_.at(0).connection, &server_connection_mock_);
+    EXPECT_EQ(replies_.at(1).connection, &server_connection_mock_);
+}
+
+TEST_F(MethodCallSchedulerTest, DiscardCallsDoesNotWaitForExecutingCallOfConnection)
+{
+    // Given a scheduler, whose only worker is blocked by a call of the connection
+    GivenAMethodCallScheduler().WithAWorkerBlockedByACall();
+
+    // When discarding the calls of the connection while the call is still executing
+    // Then DiscardCalls returns without waiting for the executing call
+    unit_->DiscardCalls(server_connection_mock_);
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        EXPECT_EQ(executing_calls_, 1U);
+    }
+
+    // and once the call has finished, it isn't replied to, while a later call of another connection is
+    ReleaseBlockingCall();
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_2_);
+    WaitUntilReplies(1U);
+    std::lock_guard<std::mutex> lock{mutex_};
+    EXPECT_THAT(executed_queue_positions_, ElementsAre(kBlockingQueuePosition, kLowPriorityQueuePosition));
+    ASSERT_EQ(replies_.size(), 1U);
+    EXPECT_EQ(replies_.at(0).connection, &server_connection_mock_2_);
+}
+
+TEST_F(MethodCallSchedulerTest, DiscardCallsOfConnectionWithoutCallsIsIgnored)
+{
+    GivenAMethodCallScheduler();
+
+    // When discarding the calls of a connection, which never had a call
+    unit_->DiscardCalls(server_connection_mock_);
+
+    // Then a later call of another connection is still replied to
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_2_);
+    WaitUntilReplies(1U);
+}
+
+TEST_F(MethodCallSchedulerTest, RepliesWithErrorWhenHandlerScopeHasExpired)
+{
+    GivenAMethodCallScheduler();
+
+    // Given that the scope of the method call handler has expired
+    handler_scope_.Expire();
+
+    // When enqueuing a call
+    unit_->Enqueue(CreateHandler(), kLowPriorityQueuePosition, MethodCallSchedulingCfg{}, server_connection_mock_);
+
+    // Then the handler isn't called and kSkeletonAlreadyDestroyed is replied
+    WaitUntilReplies(1U);
+    EXPECT_TRUE(executed_queue_positions_.empty());
+    ASSERT_FALSE(replies_.at(0).result.has_value());
+    EXPECT_EQ(replies_.at(0).result.error(), MethodErrc::kSkeletonAlreadyDestroyed);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
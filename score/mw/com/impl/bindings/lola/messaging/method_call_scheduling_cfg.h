@@ -0,0 +1,43 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULING_CFG_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULING_CFG_H
+
+#include <cstdint>
+#include <optional>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Identifies the SkeletonMethod, whose calls by all connected proxies share one concurrency limit.
+using MethodCallConcurrencyGroup = std::uint32_t;
+
+/// \brief Skeleton side properties, with which calls of a method by proxies of other processes get dispatched.
+/// \details Derived from the priority/maxConcurrentCalls of the LolaMethodInstanceDeployment of the SkeletonMethod.
+struct MethodCallSchedulingCfg
+{
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+    // be private.". We need these data elements to be organized into a coherent organized data structure.
+    /// \brief Pending calls with a higher priority are dispatched first.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint8_t priority{0U};
+    /// \brief Maximum number of calls of the concurrency_group, which are executed concurrently. Unlimited if empty.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::optional<std::uint8_t> max_concurrent_calls{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    MethodCallConcurrencyGroup concurrency_group{0U};
+};
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_MESSAGING_METHOD_CALL_SCHEDULING_CFG_H
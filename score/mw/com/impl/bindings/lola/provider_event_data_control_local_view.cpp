@@ -33,7 +33,8 @@ constexpr auto MAX_ALLOCATE_RETRIES = 100U;
 template <template <class> class AtomicIndirectorType>
 ProviderEventDataControlLocalView<AtomicIndirectorType>::ProviderEventDataControlLocalView(
     EventDataControl& event_data_control) noexcept
-    : state_slots_{event_data_control.state_slots_.begin(), event_data_control.state_slots_.size()}
+    : state_slots_{event_data_control.state_slots_.begin(), event_data_control.state_slots_.size()},
+      last_send_time_ns_{event_data_control.last_send_time_ns_}
 {
 }
 
@@ -125,6 +126,13 @@ auto ProviderEventDataControlLocalView<AtomicIndirectorType>::EventReady(
                                                              // to be single-threaded/non-concurrent per AoU
 }
 
+template <template <class> class AtomicIndirectorType>
+auto ProviderEventDataControlLocalView<AtomicIndirectorType>::SetLastSendTime(const std::uint64_t send_time_ns) noexcept
+    -> void
+{
+    last_send_time_ns_.store(send_time_ns, std::memory_order_release);
+}
+
 template <template <class> class AtomicIndirectorType>
 auto ProviderEventDataControlLocalView<AtomicIndirectorType>::Discard(const SlotIndexType slot_index) -> void
 {
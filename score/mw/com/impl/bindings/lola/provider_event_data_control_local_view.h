@@ -84,6 +84,10 @@ class ProviderEventDataControlLocalView final
     /// \pre AllocateNextSlot() was invoked to obtain write-ownership
     void EventReady(const SlotIndexType slot_index, const EventSlotStatus::EventTimeStamp time_stamp) noexcept;
 
+    /// \brief Publishes the send time of the latest sample (see EventDataControl::last_send_time_ns_).
+    /// \param send_time_ns send time as returned by GetCurrentSendTime()
+    void SetLastSendTime(const std::uint64_t send_time_ns) noexcept;
+
     /// \brief Marks selected slot as invalid, if it was not yet marked as ready
     ///
     /// \details We don't discard elements that are already ready, since it is possible that a user might already
@@ -120,6 +124,7 @@ class ProviderEventDataControlLocalView final
     void SetSlotValue(const SlotInfo slot_info) noexcept;
 
     LocalEventControlSlots state_slots_;
+    std::atomic<std::uint64_t>& last_send_time_ns_;
 
     // helper variables to calculated performance indicators
     static inline std::atomic_uint_fast64_t num_alloc_misses{0U};
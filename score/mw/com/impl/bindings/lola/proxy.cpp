@@ -23,6 +23,7 @@
 #include "score/mw/com/impl/bindings/lola/service_data_control.h"
 #include "score/mw/com/impl/bindings/lola/service_data_storage.h"
 #include "score/mw/com/impl/bindings/lola/shm_path_builder.h"
+#include "score/mw/com/impl/bindings/lola/shm_prefault.h"
 #include "score/mw/com/impl/bindings/lola/skeleton_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_rollback_executor.h"
 #include "score/mw/com/impl/com_error.h"
@@ -184,17 +185,21 @@ OpenSharedMemory(const LolaServiceInstanceDeployment& instance_deployment,
     const auto control_shm = shm_path_builder.GetControlChannelShmName(lola_service_instance_id.GetId(), quality_type);
     const auto data_shm = shm_path_builder.GetDataChannelShmName(lola_service_instance_id.GetId());
 
-    const std::shared_ptr<memory::shared::ManagedMemoryResource> control =
-        score::memory::shared::SharedMemoryFactory::Open(control_shm, true, providers);
-    const std::shared_ptr<memory::shared::ManagedMemoryResource> data =
-        score::memory::shared::SharedMemoryFactory::Open(data_shm, false, providers);
+    const auto control = score::memory::shared::SharedMemoryFactory::Open(control_shm, true, providers);
+    const auto data = score::memory::shared::SharedMemoryFactory::Open(data_shm, false, providers);
     if ((control == nullptr) || (data == nullptr))
     {
         score::mw::log::LogError("lola") << "Could not create Proxy: Opening shared memory failed.";
         return std::make_pair(nullptr, nullptr);
     }
 
-    return std::make_pair(control, data);
+    // Fault in the pages upfront, so that the first GetNewSamples() calls don't take page faults on the realtime path.
+    const auto shm_prefault_mode = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetShmPrefaultMode();
+    score::cpp::ignore = PrefaultSharedMemory(shm_prefault_mode, *control, control_shm);
+    score::cpp::ignore = PrefaultSharedMemory(shm_prefault_mode, *data, data_shm);
+
+    return std::make_pair(std::shared_ptr<memory::shared::ManagedMemoryResource>{control},
+                          std::shared_ptr<memory::shared::ManagedMemoryResource>{data});
 }
 
 ServiceDataControl& GetServiceDataControl(const memory::shared::ManagedMemoryResource& control_memory_resource) noexcept
@@ -644,6 +649,24 @@ const EventMetaInfo& Proxy::GetEventMetaInfo(const ElementFqId element_fq_id) co
     return event_meta_info_entry->second;
 }
 
+std::size_t Proxy::GetPrefetchBytes(const std::string_view service_element_name) const noexcept
+{
+    const auto& lola_service_instance_deployment = GetLoLaInstanceDeployment(handle_);
+    const std::string element_name{service_element_name};
+
+    const auto event_it = lola_service_instance_deployment.events_.find(element_name);
+    if (event_it != lola_service_instance_deployment.events_.cend())
+    {
+        return event_it->second.GetPrefetchBytes();
+    }
+    const auto field_it = lola_service_instance_deployment.fields_.find(element_name);
+    if (field_it != lola_service_instance_deployment.fields_.cend())
+    {
+        return field_it->second.lola_event_instance_deployment_.GetPrefetchBytes();
+    }
+    return 0U;
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". This is a false positive, std::less which is used by std::map::find could throw an exception if the key
 // value is not comparable and in our case the key is comparable. so no way for 'event_controls_.find()' to throw an
@@ -160,6 +160,13 @@ class Proxy : public ProxyBinding
     /// \return An event data meta info.
     const EventMetaInfo& GetEventMetaInfo(const ElementFqId element_fq_id) const noexcept;
 
+    /// Retrieves the number of bytes, which shall be prefetched of each new sample of an event or field.
+    ///
+    /// \param service_element_name The name of the event or field.
+    /// \return The configured prefetchBytes of the event or field, or 0 if the service instance deployment doesn't
+    ///         contain the event or field.
+    std::size_t GetPrefetchBytes(const std::string_view service_element_name) const noexcept;
+
     /// Checks whether the event corresponding to event_name is provided
     ///
     /// It does this by checking whether the event corresponding to event_name exists in shared memory.
@@ -16,6 +16,7 @@
 #include "score/mw/com/impl/bindings/lola/event_data_storage.h"
 #include "score/mw/com/impl/bindings/lola/event_meta_info.h"
 #include "score/mw/com/impl/bindings/lola/proxy_event_common.h"
+#include "score/mw/com/impl/bindings/lola/sample_prefetch.h"
 
 #include "score/language/safecpp/safe_math/safe_math.h"
 #include "score/memory/shared/pointer_arithmetic_util.h"
@@ -28,6 +29,7 @@
 #include "score/result/result.h"
 
 #include <score/assert.hpp>
+#include <score/utility.hpp>
 
 #include <cstdint>
 #include <exception>
@@ -71,7 +73,8 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
           proxy_event_common_{parent, element_fq_id, event_name},
           meta_info_{parent.GetEventMetaInfo(element_fq_id)},
           aligned_sample_size_{memory::shared::CalculateAlignedSize(sizeof(SampleType), alignof(SampleType))},
-          event_slots_raw_array_{InitialiseEventSlotsRawArray()}
+          event_slots_raw_array_{InitialiseEventSlotsRawArray()},
+          prefetch_bytes_{parent.GetPrefetchBytes(event_name)}
     {
         parent.RegisterEvent(event_name, *this);
     }
@@ -115,6 +118,15 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
     {
         return proxy_event_common_.UnsetSubscriptionStateChangeHandler();
     }
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                          DeadlineMissedHandler handler) noexcept override
+    {
+        return proxy_event_common_.SetDeadlineMissedHandler(expected_period, std::move(handler));
+    }
+    Result<void> UnsetDeadlineMissedHandler() noexcept override
+    {
+        return proxy_event_common_.UnsetDeadlineMissedHandler();
+    }
     std::optional<std::uint16_t> GetMaxSampleCount() const noexcept override
     {
         return proxy_event_common_.GetMaxSampleCount();
@@ -142,11 +154,13 @@ class ProxyEvent final : public ProxyEventBinding<SampleType>
 
     Result<std::size_t> GetNewSamplesImpl(Callback&& receiver, TrackerGuardFactory& tracker) noexcept;
     Result<std::size_t> GetNumNewSamplesAvailableImpl() const noexcept;
+    void PrefetchSamples(const SlotCollector::SlotIndices& slot_indices) const noexcept;
 
     ProxyEventCommon proxy_event_common_;
     const EventMetaInfo& meta_info_;
     const std::size_t aligned_sample_size_;
     const std::uint8_t* event_slots_raw_array_;
+    const std::size_t prefetch_bytes_;
 };
 
 template <typename SampleType>
@@ -189,6 +203,25 @@ inline Result<std::size_t> ProxyEvent<SampleType>::GetNumNewSamplesAvailableImpl
     return proxy_event_common_.GetNumNewSamplesAvailable();
 }
 
+template <typename SampleType>
+inline void ProxyEvent<SampleType>::PrefetchSamples(const SlotCollector::SlotIndices& slot_indices) const noexcept
+{
+    if (prefetch_bytes_ == 0U)
+    {
+        return;
+    }
+
+    // The prefetch hints for all samples are issued up front, so that their cache lines get loaded, while the samples
+    // are referenced and handed out one by one in GetNewSamplesImpl().
+    for (auto slot_index_it = slot_indices.begin; slot_index_it != slot_indices.end; ++slot_index_it)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic) See GetNewSamplesImpl() for the slot lookup.
+        const auto* const object_start_address = &event_slots_raw_array_[aligned_sample_size_ * (*slot_index_it)];
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        score::cpp::ignore = PrefetchSample(object_start_address, sizeof(SampleType), prefetch_bytes_);
+    }
+}
+
 template <typename SampleType>
 inline Result<std::size_t> ProxyEvent<SampleType>::GetNewSamples(Callback&& receiver,
                                                                  TrackerGuardFactory& tracker) noexcept
@@ -224,6 +257,8 @@ inline Result<std::size_t> ProxyEvent<SampleType>::GetNewSamplesImpl(Callback&&
     auto& event_data_control_local = proxy_event_common_.GetConsumerEventDataControlLocal();
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(nullptr != event_slots_raw_array_, "Null event slot array");
 
+    PrefetchSamples(slot_indices);
+
     for (auto slot_index_it = slot_indices.begin; slot_index_it != slot_indices.end; ++slot_index_it)
     {
         // TODO: Replace this temporary raw-slot access when the LoLa binding layer is type-erased.
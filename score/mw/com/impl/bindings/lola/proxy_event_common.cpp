@@ -38,10 +38,17 @@ ProxyEventCommon::ProxyEventCommon(Proxy& parent, const ElementFqId element_fq_i
                                         event_data_control_local_,
                                         subscription_control_.get(),
                                         transaction_log_set_.get(),
-                                        transaction_log_id_}
+                                        transaction_log_id_},
+      deadline_registration_{}
 {
 }
 
+ProxyEventCommon::~ProxyEventCommon()
+{
+    // The DeadlineMonitor reads the send time from our control structure, so the registration must not outlive us.
+    score::cpp::ignore = UnsetDeadlineMissedHandler();
+}
+
 Result<void> ProxyEventCommon::Subscribe(const std::size_t max_sample_count)
 {
     std::stringstream sstream{};
@@ -108,6 +115,27 @@ Result<void> ProxyEventCommon::UnsetSubscriptionStateChangeHandler() noexcept
     return {};
 }
 
+Result<void> ProxyEventCommon::SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                                        DeadlineMissedHandler handler) noexcept
+{
+    score::cpp::ignore = UnsetDeadlineMissedHandler();
+    auto& deadline_monitor = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetDeadlineMonitor();
+    deadline_registration_ =
+        deadline_monitor.Register(event_data_control_local_.GetLastSendTime(), expected_period, std::move(handler));
+    return {};
+}
+
+Result<void> ProxyEventCommon::UnsetDeadlineMissedHandler() noexcept
+{
+    if (deadline_registration_.has_value())
+    {
+        GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetDeadlineMonitor().Unregister(
+            deadline_registration_.value());
+        deadline_registration_.reset();
+    }
+    return {};
+}
+
 pid_t ProxyEventCommon::GetEventSourcePid() const noexcept
 {
     return parent_.GetSourcePid();
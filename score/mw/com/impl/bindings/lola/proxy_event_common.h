@@ -14,6 +14,7 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_PROXY_EVENT_COMMON_H
 
 #include "score/mw/com/impl/bindings/lola/consumer_event_data_control_local_view.h"
+#include "score/mw/com/impl/bindings/lola/deadline_monitor.h"
 #include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/event_control.h"
 #include "score/mw/com/impl/bindings/lola/event_meta_info.h"
@@ -23,6 +24,7 @@
 #include "score/mw/com/impl/bindings/lola/subscription_state_machine.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_id.h"
 #include "score/mw/com/impl/bindings/lola/transaction_log_set.h"
+#include "score/mw/com/impl/deadline_missed_handler.h"
 #include "score/mw/com/impl/scoped_event_receive_handler.h"
 #include "score/mw/com/impl/subscription_state.h"
 
@@ -31,6 +33,7 @@
 #include <score/assert.hpp>
 #include <score/utility.hpp>
 
+#include <chrono>
 #include <mutex>
 #include <optional>
 #include <string_view>
@@ -53,7 +56,7 @@ class ProxyEventCommon final
 
   public:
     ProxyEventCommon(Proxy& parent, const ElementFqId element_fq_id, const std::string_view event_name);
-    ~ProxyEventCommon() = default;
+    ~ProxyEventCommon();
 
     ProxyEventCommon(const ProxyEventCommon&) = delete;
     ProxyEventCommon(ProxyEventCommon&&) noexcept = delete;
@@ -87,6 +90,12 @@ class ProxyEventCommon final
     Result<void> SetSubscriptionStateChangeHandler(SubscriptionStateChangeHandler handler) noexcept;
     Result<void> UnsetSubscriptionStateChangeHandler() noexcept;
 
+    /// \brief Registers the handler with the DeadlineMonitor of the LoLa runtime, which checks the send time of the
+    ///        latest sample published by the provider against expected_period.
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                          DeadlineMissedHandler handler) noexcept;
+    Result<void> UnsetDeadlineMissedHandler() noexcept;
+
     pid_t GetEventSourcePid() const noexcept;
     ElementFqId GetElementFQId() const noexcept
     {
@@ -119,6 +128,7 @@ class ProxyEventCommon final
     std::reference_wrapper<EventSubscriptionControl<>> subscription_control_;
     std::reference_wrapper<TransactionLogSet> transaction_log_set_;
     SubscriptionStateMachine subscription_event_state_machine_;
+    std::optional<DeadlineMonitor::RegistrationId> deadline_registration_;
 };
 
 }  // namespace score::mw::com::impl::lola
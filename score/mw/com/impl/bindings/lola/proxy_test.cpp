@@ -17,6 +17,8 @@
 #include "score/mw/com/impl/bindings/lola/test/proxy_event_test_resources.h"
 #include "score/mw/com/impl/bindings/lola/test/transaction_log_test_resources.h"
 #include "score/mw/com/impl/bindings/mock_binding/proxy_event.h"
+#include "score/mw/com/impl/configuration/lola_event_instance_deployment.h"
+#include "score/mw/com/impl/configuration/lola_field_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_id.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/configuration/service_identifier_type.h"
@@ -691,6 +693,37 @@ TEST_F(ProxyGetEventMetaInfoDeathTest, CallingGetEventMetaInfoWhenGettingDataSec
     EXPECT_DEATH(score::cpp::ignore = proxy_->GetEventMetaInfo(kDummyElementFqId), ".*");
 }
 
+using ProxyGetPrefetchBytesFixture = ProxyMockedMemoryFixture;
+TEST_F(ProxyGetPrefetchBytesFixture, GetPrefetchBytesReturnsConfiguredValueOfEventsAndFields)
+{
+    // Given a service instance deployment, which configures prefetch bytes for an event and a field
+    LolaServiceInstanceDeployment lola_service_instance_deployment{lola_service_instance_id_};
+    lola_service_instance_deployment.events_.emplace(
+        "prefetched_event",
+        LolaEventInstanceDeployment{
+            {}, {}, {}, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit, 256U});
+    lola_service_instance_deployment.fields_.emplace(
+        "prefetched_field",
+        LolaFieldInstanceDeployment{
+            LolaEventInstanceDeployment{
+                {}, {}, {}, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit, 512U},
+            false,
+            false});
+    const ServiceInstanceDeployment service_instance_deployment{
+        service_identifier_, lola_service_instance_deployment, QualityType::kASIL_QM, instance_specifier_};
+    const auto identifier = make_InstanceIdentifier(service_instance_deployment, service_type_deployment_);
+
+    // and a proxy created with it
+    InitialiseProxyWithCreate(identifier);
+    ASSERT_NE(proxy_, nullptr);
+
+    // When getting the prefetch bytes of the event, the field and an event without deployment
+    // Then the configured values are returned and 0 for the event without deployment
+    EXPECT_EQ(proxy_->GetPrefetchBytes("prefetched_event"), 256U);
+    EXPECT_EQ(proxy_->GetPrefetchBytes("prefetched_field"), 512U);
+    EXPECT_EQ(proxy_->GetPrefetchBytes(kDummyEventName), 0U);
+}
+
 class ProxyUidPidRegistrationFixture : public ProxyMockedMemoryFixture
 {
   protected:
@@ -19,9 +19,12 @@
 #include <score/assert.hpp>
 #include <score/utility.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <exception>
 #include <set>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 #include "score/mw/com/impl/bindings/lola/messaging/message_passing_service_instance_factory.h"
@@ -29,6 +32,98 @@
 namespace score::mw::com::impl::lola
 {
 
+namespace
+{
+
+/// \brief Registration capacities of the message passing service instances derived from the configured LoLa service
+///        instances: one notification registration slot per configured event/field and as many remote nodes per
+///        event as the largest configured max_subscribers.
+void DeriveNotificationCapacities(const Configuration& configuration, AsilSpecificCfg& config) noexcept
+{
+    std::size_t max_notification_events{0U};
+    std::size_t max_remote_nodes_per_event{0U};
+    for (const auto& instance_deployment_element : configuration.GetServiceInstances())
+    {
+        const auto* const instance_deployment =
+            std::get_if<LolaServiceInstanceDeployment>(&instance_deployment_element.second.bindingInfo_);
+        if (instance_deployment == nullptr)
+        {
+            continue;
+        }
+        max_notification_events += instance_deployment->events_.size() + instance_deployment->fields_.size();
+        const auto update_max_nodes = [&max_remote_nodes_per_event](const LolaEventInstanceDeployment& event) {
+            const std::size_t max_subscribers{event.max_subscribers_.value_or(0U)};
+            max_remote_nodes_per_event = std::max(max_remote_nodes_per_event, max_subscribers);
+        };
+        for (const auto& event : instance_deployment->events_)
+        {
+            update_max_nodes(event.second);
+        }
+        for (const auto& field : instance_deployment->fields_)
+        {
+            update_max_nodes(field.second.lola_event_instance_deployment_);
+        }
+    }
+    // Only override the defaults, if the configuration provides something to derive from.
+    if (max_notification_events > 0U)
+    {
+        config.max_notification_events_ = max_notification_events;
+    }
+    if (max_remote_nodes_per_event > 0U)
+    {
+        config.max_remote_nodes_per_event_ = max_remote_nodes_per_event;
+    }
+}
+
+/// \brief Number of method call worker threads: an explicitly configured number always enables scheduling by
+///        priority. Otherwise it is only enabled, if any method configures a priority or a concurrency limit. Then one
+///        worker more than the largest concurrency limit is used, so that a call of another method doesn't wait for a
+///        busy worker, while the method with the largest limit executes as many calls as allowed.
+void DeriveMethodCallWorkerThreads(const Configuration& configuration, AsilSpecificCfg& config) noexcept
+{
+    bool scheduling_configured{false};
+    std::size_t max_concurrent_calls{0U};
+    for (const auto& instance_deployment_element : configuration.GetServiceInstances())
+    {
+        const auto* const instance_deployment =
+            std::get_if<LolaServiceInstanceDeployment>(&instance_deployment_element.second.bindingInfo_);
+        if (instance_deployment == nullptr)
+        {
+            continue;
+        }
+        for (const auto& method : instance_deployment->methods_)
+        {
+            const auto& method_deployment = method.second;
+            if ((method_deployment.priority_ != LolaMethodInstanceDeployment::kDefaultPriority) ||
+                (method_deployment.max_concurrent_calls_.has_value()))
+            {
+                scheduling_configured = true;
+            }
+            const std::size_t method_max_concurrent_calls{method_deployment.max_concurrent_calls_.value_or(0U)};
+            max_concurrent_calls = std::max(max_concurrent_calls, method_max_concurrent_calls);
+        }
+    }
+
+    const auto configured_worker_threads = configuration.GetGlobalConfiguration().GetMethodCallWorkerThreads();
+    if (configured_worker_threads.has_value())
+    {
+        config.method_call_worker_threads_ = configured_worker_threads.value();
+        if (config.method_call_worker_threads_ <= max_concurrent_calls)
+        {
+            score::mw::log::LogWarn("lola")
+                << "Configured method-call-worker-threads (" << config.method_call_worker_threads_
+                << ") doesn't exceed the largest maxConcurrentCalls (" << max_concurrent_calls
+                << "). Calls of a single method can occupy all method call worker threads.";
+        }
+    }
+    else if (scheduling_configured)
+    {
+        config.method_call_worker_threads_ = 1U + std::max(max_concurrent_calls, std::size_t{1U});
+    }
+}
+
+}  // namespace
+
 /// \brief Determines the unique identifier for this application instance.
 /// \details This function implements the logic to select the application identifier. It prioritizes the
 ///          explicitly configured 'applicationID' from the global configuration. If that is not present,
@@ -67,10 +162,12 @@ Runtime::Runtime(const Configuration& config,
                               Runtime::HasAsilBSupport()
                                   ? std::optional<AsilSpecificCfg>{Runtime::GetMessagePassingCfg(QualityType::kASIL_B)}
                                   : std::nullopt,
-                              std::make_unique<MessagePassingServiceInstanceFactory>()},
+                              std::make_unique<MessagePassingServiceInstanceFactory>(),
+                              config.GetGlobalConfiguration().GetMessagePassingReactors()},
       service_discovery_client_{long_running_threads_},
       tracing_runtime_{std::move(lola_tracing_runtime)},
       rollback_data_{},
+      deadline_monitor_{long_running_threads_},
       pid_{os::Unistd::instance().getpid()},
       application_id_{DetermineApplicationIdentifier(config)}
 {
@@ -137,8 +234,11 @@ AsilSpecificCfg Runtime::GetMessagePassingCfg(const QualityType asil_level) cons
         }
     }
 
-    return {configuration_.GetGlobalConfiguration().GetReceiverMessageQueueSize(asil_level),
-            std::vector<uid_t>(aggregated_allowed_users.begin(), aggregated_allowed_users.end())};
+    AsilSpecificCfg config{configuration_.GetGlobalConfiguration().GetReceiverMessageQueueSize(asil_level),
+                           std::vector<uid_t>(aggregated_allowed_users.begin(), aggregated_allowed_users.end())};
+    DeriveNotificationCapacities(configuration_, config);
+    DeriveMethodCallWorkerThreads(configuration_, config);
+    return config;
 }
 
 bool Runtime::AggregateAllowedUsers(std::set<uid_t>& aggregated_allowed_users,
@@ -171,6 +271,11 @@ ShmSizeCalculationMode Runtime::GetShmSizeCalculationMode() const noexcept
     return configuration_.GetGlobalConfiguration().GetShmSizeCalcMode();
 }
 
+ShmPrefaultMode Runtime::GetShmPrefaultMode() const noexcept
+{
+    return configuration_.GetGlobalConfiguration().GetShmPrefaultMode();
+}
+
 IServiceDiscoveryClient& Runtime::GetServiceDiscoveryClient() & noexcept
 {
     // Suppress "AUTOSAR C++14 A9-3-1" rule finding: "Member functions shall not return non-const “raw” pointers or
@@ -194,6 +299,15 @@ RollbackSynchronization& Runtime::GetRollbackSynchronization() & noexcept
     return rollback_data_;
 }
 
+DeadlineMonitor& Runtime::GetDeadlineMonitor() & noexcept
+{
+    // Suppress "AUTOSAR C++14 A9-3-1" rule finding: "Member functions shall not return non-const “raw” pointers or
+    // references to private or protected data owned by the class.".
+    // The monitor is shared by all proxy events of the process and lives as long as the runtime.
+    // coverity[autosar_cpp14_a9_3_1_violation]
+    return deadline_monitor_;
+}
+
 pid_t Runtime::GetPid() const noexcept
 {
     return pid_;
@@ -75,11 +75,14 @@ class Runtime final : public IRuntime
     AsilSpecificCfg GetMessagePassingCfg(const QualityType asil_level) const;
 
     ShmSizeCalculationMode GetShmSizeCalculationMode() const noexcept override;
+    ShmPrefaultMode GetShmPrefaultMode() const noexcept override;
 
     IServiceDiscoveryClient& GetServiceDiscoveryClient() & noexcept override;
 
     RollbackSynchronization& GetRollbackSynchronization() & noexcept override;
 
+    DeadlineMonitor& GetDeadlineMonitor() & noexcept override;
+
     pid_t GetPid() const noexcept override;
 
     GlobalConfiguration::ApplicationId GetApplicationId() const noexcept override;
@@ -92,6 +95,7 @@ class Runtime final : public IRuntime
     ServiceDiscoveryClient service_discovery_client_;
     std::unique_ptr<lola::tracing::TracingRuntime> tracing_runtime_;
     RollbackSynchronization rollback_data_;
+    DeadlineMonitor deadline_monitor_;
 
     /// \brief Helper func aggregates allowed_user_ids of the given quality type into aggregated_allowed_users. If
     ///        allowed_user_ids is empty (no access restriction!), then aggregated_allowed_users is cleared!
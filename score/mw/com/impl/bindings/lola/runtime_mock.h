@@ -36,6 +36,7 @@ class RuntimeMock : public IRuntime
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, noexcept, override));
+    MOCK_METHOD(ShmPrefaultMode, GetShmPrefaultMode, (), (const, noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (ref(&), noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
@@ -43,6 +44,8 @@ class RuntimeMock : public IRuntime
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(RollbackSynchronization&, GetRollbackSynchronization, (), (ref(&), noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
+    MOCK_METHOD(DeadlineMonitor&, GetDeadlineMonitor, (), (ref(&), noexcept, override));
+    // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(pid_t, GetPid, (), (const, noexcept, override));
     // coverity[autosar_cpp14_m3_9_1_violation]
     MOCK_METHOD(GlobalConfiguration::ApplicationId, GetApplicationId, (), (const, noexcept, override));
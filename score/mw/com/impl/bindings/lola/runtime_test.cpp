@@ -199,6 +199,47 @@ TEST_F(RuntimeFixture, GetMessagePassingCfgWithPredefinedTwoLolaServiceConfig)
     }
 }
 
+TEST_F(RuntimeFixture, GetMessagePassingCfgDerivesNotificationCapacitiesFromConfiguration)
+{
+    // Given a configuration with 2 LoLa service instance deployments containing 3 events and 1 field in total, where
+    // the largest max_subscribers is 12
+    LolaServiceInstanceDeployment lolaServiceInstanceDeployment1;
+    lolaServiceInstanceDeployment1.events_.insert({"event_1", LolaEventInstanceDeployment{10U, 5U, 1U, true, 0U}});
+    lolaServiceInstanceDeployment1.events_.insert({"event_2", LolaEventInstanceDeployment{10U, 12U, 1U, true, 0U}});
+    LolaServiceInstanceDeployment lolaServiceInstanceDeployment2;
+    lolaServiceInstanceDeployment2.events_.insert(
+        {"event_3", LolaEventInstanceDeployment{std::nullopt, std::nullopt, std::nullopt, false, 0U}});
+    lolaServiceInstanceDeployment2.fields_.insert(
+        {"field_1", LolaFieldInstanceDeployment{LolaEventInstanceDeployment{10U, 3U, 1U, true, 0U}, true, true}});
+    ServiceInstanceDeployment::BindingInformation binding1(lolaServiceInstanceDeployment1);
+    ServiceInstanceDeployment::BindingInformation binding2(lolaServiceInstanceDeployment2);
+
+    ServiceIdentifierType si1 = make_ServiceIdentifierType("foo", 1U, 1U);
+    ServiceIdentifierType si2 = make_ServiceIdentifierType("bar", 1U, 1U);
+    ServiceInstanceDeployment deployment1(si1, binding1, QualityType::kASIL_QM, kInstanceSpecifier);
+    ServiceInstanceDeployment deployment2(si2, binding2, QualityType::kASIL_QM, kInstanceSpecifier2);
+
+    Configuration::ServiceInstanceDeployments instanceDeployments;
+    instanceDeployments.insert({InstanceSpecifier::Create(std::string{"foo_1"}).value(), deployment1});
+    instanceDeployments.insert({InstanceSpecifier::Create(std::string{"bar_1"}).value(), deployment2});
+    GlobalConfiguration global_configuration{};
+    global_configuration.SetProcessAsilLevel(QualityType::kASIL_QM);
+
+    Configuration configuration{Configuration::ServiceTypeDeployments{},
+                                instanceDeployments,
+                                std::move(global_configuration),
+                                TracingConfiguration{}};
+
+    // when creating a LoLa runtime with this configuration and reading out the ASIL_QM message passing cfg
+    Runtime unit{configuration, long_running_threads_, nullptr};
+    AsilSpecificCfg cfg_qm = unit.GetMessagePassingCfg(QualityType::kASIL_QM);
+
+    // expect that notification registrations are preallocated for all events and fields
+    EXPECT_EQ(cfg_qm.max_notification_events_, 4U);
+    // and for as many remote nodes per event as the largest max_subscribers
+    EXPECT_EQ(cfg_qm.max_remote_nodes_per_event_, 12U);
+}
+
 TEST_F(RuntimeFixture, GetMessagePassingCfgOneEmptyQMProvider)
 {
     // Given a configuration with 2 LoLa service instance deployments each with a certain set of
@@ -430,6 +471,18 @@ TEST_F(RuntimeFixture, CanRetrieveShmSizeCalculationMode)
     EXPECT_EQ(actual_shm_size_calc_mode, expected_shm_size_calc_mode);
 }
 
+TEST_F(RuntimeFixture, CanRetrieveShmPrefaultMode)
+{
+    // Given a runtime with a configuration
+    const auto expected_shm_prefault_mode = config_->GetGlobalConfiguration().GetShmPrefaultMode();
+
+    // When getting the shm prefault mode from the runtime
+    const auto actual_shm_prefault_mode = unit_->GetShmPrefaultMode();
+
+    // Then it equals the one in the configuration
+    EXPECT_EQ(actual_shm_prefault_mode, expected_shm_prefault_mode);
+}
+
 TEST_F(RuntimeDeathTest, CanRetrieveServiceDiscoveryClient)
 {
     EXPECT_NO_FATAL_FAILURE(unit_->GetServiceDiscoveryClient());
@@ -0,0 +1,53 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_PREFETCH_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_PREFETCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Stride between two prefetch hints for a sample. Matches the cache line size of the supported x86-64 and
+///        aarch64 targets.
+constexpr std::size_t kPrefetchCacheLineSize{64U};
+
+/// \brief Issues read prefetch hints for the start of a sample in shared memory.
+///
+/// The hints are only issued and not awaited, so the cache lines get loaded while the caller continues with the
+/// bookkeeping of the sample. One hint is issued per kPrefetchCacheLineSize bytes.
+///
+/// \param sample_start Start address of the sample data.
+/// \param sample_size Size of the sample data in bytes. The prefetching never goes beyond it.
+/// \param prefetch_bytes Number of bytes from the start of the sample, which shall be prefetched. 0 disables it.
+/// \return Number of prefetch hints, which have been issued.
+inline std::size_t PrefetchSample(const std::uint8_t* const sample_start,
+                                  const std::size_t sample_size,
+                                  const std::size_t prefetch_bytes) noexcept
+{
+    const std::size_t prefetch_size{std::min(sample_size, prefetch_bytes)};
+    std::size_t number_of_hints{0U};
+    for (std::size_t offset{0U}; offset < prefetch_size; offset += kPrefetchCacheLineSize)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is within the sample, see loop guard.
+        __builtin_prefetch(&sample_start[offset], 0, 3);
+        ++number_of_hints;
+    }
+    return number_of_hints;
+}
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SAMPLE_PREFETCH_H
@@ -0,0 +1,62 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/sample_prefetch.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr std::size_t kSampleSize{1000U};
+
+class SamplePrefetchFixture : public ::testing::Test
+{
+  protected:
+    std::array<std::uint8_t, kSampleSize> sample_{};
+};
+
+TEST_F(SamplePrefetchFixture, IssuesNoHintsWithoutPrefetchBytes)
+{
+    // When prefetching 0 bytes of a sample
+    const auto number_of_hints = PrefetchSample(sample_.data(), sample_.size(), 0U);
+
+    // Then no prefetch hint is issued
+    EXPECT_EQ(number_of_hints, 0U);
+}
+
+TEST_F(SamplePrefetchFixture, IssuesOneHintPerStartedCacheLine)
+{
+    // When prefetching a number of bytes, which is no multiple of the cache line size
+    const auto number_of_hints = PrefetchSample(sample_.data(), sample_.size(), 3U * kPrefetchCacheLineSize + 1U);
+
+    // Then a hint is issued for each cache line, which contains some of the bytes
+    EXPECT_EQ(number_of_hints, 4U);
+}
+
+TEST_F(SamplePrefetchFixture, LimitsPrefetchingToTheSampleSize)
+{
+    // When prefetching more bytes than the sample has
+    const auto number_of_hints = PrefetchSample(sample_.data(), sample_.size(), 1024U * 1024U);
+
+    // Then only the cache lines of the sample are prefetched
+    EXPECT_EQ(number_of_hints, (kSampleSize + kPrefetchCacheLineSize - 1U) / kPrefetchCacheLineSize);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
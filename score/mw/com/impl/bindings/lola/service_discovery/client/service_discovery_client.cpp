@@ -21,6 +21,7 @@
 
 #include <score/assert.hpp>
 #include <score/expected.hpp>
+#include <score/span.hpp>
 #include <score/utility.hpp>
 
 #include <cstdint>
@@ -28,6 +29,7 @@
 #include <mutex>
 #include <optional>
 #include <utility>
+#include <variant>
 
 namespace score::mw::com::impl::lola
 {
@@ -76,6 +78,38 @@ std::vector<HandleType> GetKnownHandles(EnrichedInstanceIdentifier enriched_inst
     return known_handles;
 }
 
+const KnownInstancesContainer& SelectKnownInstances(
+    const EnrichedInstanceIdentifier& enriched_instance_identifier,
+    const QualityAwareContainer<KnownInstancesContainer>& known_instances) noexcept
+{
+    // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
+    // a well-formed switch statement".
+    // We don't need a break statement at the kInvalid case as we use fallthrough.
+    // coverity[autosar_cpp14_m6_4_3_violation]
+    switch (enriched_instance_identifier.GetQualityType())
+    {
+        case QualityType::kASIL_B:
+        {
+            return known_instances.asil_b;
+        }
+        case QualityType::kASIL_QM:
+        {
+            return known_instances.asil_qm;
+        }
+            // LCOV_EXCL_START (Defensive programming: Searches are only stored by StartFindService, which already
+            // checks the quality type.)
+        case QualityType::kInvalid:
+            [[fallthrough]];
+        // coverity[autosar_cpp14_m6_4_5_violation] std::terminate will terminate this switch clause.
+        default:
+        {
+            score::mw::log::LogFatal("lola") << "Quality level not set for instance identifier. Terminating.";
+            std::terminate();
+        }
+            // LCOV_EXCL_STOP
+    }
+}
+
 }  // namespace
 
 ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_running_threads) noexcept
@@ -104,7 +138,10 @@ ServiceDiscoveryClient::ServiceDiscoveryClient(concurrency::Executor& long_runni
       worker_thread_result_{},
       flag_files_{},
       obsolete_search_requests_{},
-      flag_files_mutex_{}
+      flag_files_mutex_{},
+      changed_instances_{},
+      added_handles_{},
+      removed_handles_{}
 {
     // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
     // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
@@ -539,6 +576,12 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
             continue;
         }
 
+        if (std::holds_alternative<FindServiceIncrementalHandler<HandleType>>(search_iterator->second.search_handler))
+        {
+            CallIncrementalHandler(search_key, search_iterator->second);
+            continue;
+        }
+
         const auto& enriched_instance_identifier = search_iterator->second.enriched_instance_identifier;
         std::vector<HandleType> known_handles{};
         // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
@@ -585,7 +628,7 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
 
         previous_handles = new_handles;
 
-        const auto& handler = search_iterator->second.find_service_handler;
+        const auto& handler = std::get<FindServiceHandler<HandleType>>(search_iterator->second.search_handler);
         // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
         // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
         // we can't add noexcept to score::cpp::callback signature.
@@ -595,6 +638,79 @@ auto ServiceDiscoveryClient::CallHandlers(const std::unordered_set<FindServiceHa
         mw::log::LogDebug("lola") << "LoLa SD: Asynchronous call to handler for FindServiceHandle"
                                   << FindServiceHandleView{search_key}.getUid() << "finished";
     }
+
+    changed_instances_.clear();
+}
+
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
+// before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+auto ServiceDiscoveryClient::CallIncrementalHandler(const FindServiceHandle& search_key,
+                                                    SearchRequest& search_request) noexcept -> void
+{
+    const auto& search_identifier = search_request.enriched_instance_identifier;
+    const auto& known_instances = SelectKnownInstances(search_identifier, known_instances_);
+    const auto search_service_id = search_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>();
+    const auto search_instance_id = search_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>();
+
+    // Only the instances changed by the current batch of events are checked, so the effort doesn't depend on the
+    // number of instances known for the search.
+    added_handles_.clear();
+    removed_handles_.clear();
+    for (const auto& changed_instance : changed_instances_)
+    {
+        const auto instance_id = changed_instance.GetBindingSpecificInstanceId<LolaServiceInstanceId>();
+        const bool is_instance_of_search =
+            instance_id.has_value() &&
+            (changed_instance.GetBindingSpecificServiceId<LolaServiceTypeDeployment>() == search_service_id) &&
+            ((!search_instance_id.has_value()) || (search_instance_id == instance_id));
+        if (!is_instance_of_search)
+        {
+            continue;
+        }
+
+        auto handle = make_HandleType(search_identifier.GetInstanceIdentifier(),
+                                      ServiceInstanceId{LolaServiceInstanceId{instance_id.value()}});
+        const bool is_known = known_instances.Contains(changed_instance);
+        const bool was_known = search_request.handles.count(handle) != 0U;
+        if (is_known && (!was_known))
+        {
+            score::cpp::ignore = search_request.handles.insert(handle);
+            added_handles_.push_back(std::move(handle));
+        }
+        else if ((!is_known) && was_known)
+        {
+            score::cpp::ignore = search_request.handles.erase(handle);
+            removed_handles_.push_back(std::move(handle));
+        }
+        else
+        {
+            // The instance was already reported in this state, e.g. the flag file of the other quality type changed.
+        }
+    }
+
+    if (added_handles_.empty() && removed_handles_.empty())
+    {
+        return;
+    }
+
+    mw::log::LogDebug("lola") << "LoLa SD: Starting asynchronous call to incremental handler for FindServiceHandle"
+                              << FindServiceHandleView{search_key}.getUid() << "with" << added_handles_.size()
+                              << "added and" << removed_handles_.size() << "removed handles";
+
+    const auto& handler = std::get<FindServiceIncrementalHandler<HandleType>>(search_request.search_handler);
+    const ServiceHandleChanges<HandleType> changes{
+        score::cpp::span<const HandleType>{added_handles_.data(), added_handles_.size()},
+        score::cpp::span<const HandleType>{removed_handles_.data(), removed_handles_.size()}};
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
+    // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
+    // we can't add noexcept to score::cpp::callback signature.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    handler(changes, search_key);
+
+    mw::log::LogDebug("lola") << "LoLa SD: Asynchronous call to incremental handler for FindServiceHandle"
+                              << FindServiceHandleView{search_key}.getUid() << "finished";
 }
 
 auto ServiceDiscoveryClient::StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
@@ -701,14 +817,30 @@ auto ServiceDiscoveryClient::UnlinkWatchWithSearchRequest(
                                                 "UnlinkWatchWithSearchRequest did not erase watch key correctly");
 }
 
+Result<void> ServiceDiscoveryClient::StartFindService(
+    const FindServiceHandle find_service_handle,
+    FindServiceHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartSearch(find_service_handle, SearchHandler{std::move(handler)}, enriched_instance_identifier);
+}
+
+Result<void> ServiceDiscoveryClient::StartFindServiceIncremental(
+    const FindServiceHandle find_service_handle,
+    FindServiceIncrementalHandler<HandleType> handler,
+    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+{
+    return StartSearch(find_service_handle, SearchHandler{std::move(handler)}, enriched_instance_identifier);
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". std::terminate() is implicitly called from '.value()' in case it doesn't have value but as we check
 // before with 'has_value()' so no way for throwing std::bad_optional_access which leds to std::terminate().
 // coverity[autosar_cpp14_a15_5_3_violation : FALSE]
-Result<void> ServiceDiscoveryClient::StartFindService(
+Result<void> ServiceDiscoveryClient::StartSearch(
     const FindServiceHandle find_service_handle,
-    FindServiceHandler<HandleType> handler,
-    const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+    SearchHandler handler,
+    const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
 {
     // Suppress Autosar C++14 A8-5-3 states that auto variables shall not be initialized using braced initialization.
     // This is a false positive, we don't use auto here
@@ -770,8 +902,20 @@ Result<void> ServiceDiscoveryClient::StartFindService(
     {
         mw::log::LogDebug("lola") << "LoLa SD: Synchronously calling handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid();
-        const auto& stored_handler = stored_search_request.second.find_service_handler;
-        stored_handler(known_handles, find_service_handle);
+        const auto& stored_handler = stored_search_request.second.search_handler;
+        if (std::holds_alternative<FindServiceIncrementalHandler<HandleType>>(stored_handler))
+        {
+            // All handles known at the start of the search are reported as added.
+            const auto& incremental_handler = std::get<FindServiceIncrementalHandler<HandleType>>(stored_handler);
+            const ServiceHandleChanges<HandleType> changes{
+                score::cpp::span<const HandleType>{known_handles.data(), known_handles.size()},
+                score::cpp::span<const HandleType>{}};
+            incremental_handler(changes, find_service_handle);
+        }
+        else
+        {
+            std::get<FindServiceHandler<HandleType>>(stored_handler)(known_handles, find_service_handle);
+        }
         mw::log::LogDebug("lola") << "LoLa SD: Synchronous call to handler for FindServiceHandle"
                                   << FindServiceHandleView{find_service_handle}.getUid() << "finished";
     }
@@ -807,6 +951,8 @@ auto ServiceDiscoveryClient::OnInstanceDirectoryCreated(const WatchesContainer::
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(watch_descriptors.size() == 1U,
                                                 "Outside tampering. Must contain one watch descriptor.");
 
+    changed_instances_.push_back(enriched_instance_identifier_with_instance_id_from_string);
+
     auto watch = StoreWatch(watch_descriptors.begin()->first, watch_descriptors.begin()->second);
     for (const auto& search_key : search_keys)
     {
@@ -822,6 +968,7 @@ void ServiceDiscoveryClient::OnInstanceFlagFileCreated(const WatchesContainer::i
                                                        const std::string_view name) noexcept
 {
     const auto& enriched_instance_identifier = watch_iterator->second.enriched_instance_identifier;
+    changed_instances_.push_back(enriched_instance_identifier);
 
     const auto event_quality_type = FlagFileCrawler::ParseQualityTypeFromString(name);
 
@@ -867,6 +1014,7 @@ void ServiceDiscoveryClient::OnInstanceFlagFileRemoved(const WatchesContainer::i
                                                        std::string_view name) noexcept
 {
     const auto& enriched_instance_identifier = watch_iterator->second.enriched_instance_identifier;
+    changed_instances_.push_back(enriched_instance_identifier);
 
     const auto event_quality_type = FlagFileCrawler::ParseQualityTypeFromString(name);
     // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be
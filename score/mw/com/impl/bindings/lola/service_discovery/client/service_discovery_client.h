@@ -34,6 +34,8 @@
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <variant>
+#include <vector>
 
 namespace score::mw::com::impl::lola
 {
@@ -65,11 +67,19 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         FindServiceHandler<HandleType> handler,
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
 
+    [[nodiscard]] Result<void> StartFindServiceIncremental(
+        const FindServiceHandle find_service_handle,
+        FindServiceIncrementalHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
+
     [[nodiscard]] Result<void> StopFindService(const FindServiceHandle find_service_handle) noexcept override;
     [[nodiscard]] Result<ServiceHandleContainer<HandleType>> FindService(
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept override;
 
   private:
+    /// \brief Handler of a search, which either gets all known handles or only the changed ones on each call.
+    using SearchHandler = std::variant<FindServiceHandler<HandleType>, FindServiceIncrementalHandler<HandleType>>;
+
     class SearchRequest
     {
       public:
@@ -79,7 +89,7 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::unordered_set<os::InotifyWatchDescriptor> watch_descriptors;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        FindServiceHandler<HandleType> find_service_handler;
+        SearchHandler search_handler;
         // coverity[autosar_cpp14_m11_0_1_violation]
         EnrichedInstanceIdentifier enriched_instance_identifier;
         // coverity[autosar_cpp14_m11_0_1_violation]
@@ -123,7 +133,7 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
         // coverity[autosar_cpp14_m11_0_1_violation]
         std::unordered_map<os::InotifyWatchDescriptor, EnrichedInstanceIdentifier> watch_descriptors;
         // coverity[autosar_cpp14_m11_0_1_violation]
-        FindServiceHandler<HandleType> on_service_found_callback;
+        SearchHandler on_service_found_callback;
         // coverity[autosar_cpp14_m11_0_1_violation]
         QualityAwareContainer<KnownInstancesContainer> known_instances;
         // coverity[autosar_cpp14_m11_0_1_violation]
@@ -134,8 +144,16 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     using WatchesContainer = std::unordered_map<os::InotifyWatchDescriptor, Watch>;
     using Disambiguator = std::uint64_t;
 
+    [[nodiscard]] Result<void> StartSearch(const FindServiceHandle find_service_handle,
+                                           SearchHandler handler,
+                                           const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept;
+
     void CallHandlers(const std::unordered_set<FindServiceHandle>& search_keys) noexcept;
 
+    /// \brief Calls the incremental handler of the search with the changes of its handles caused by the instances in
+    /// changed_instances_, if there are any.
+    void CallIncrementalHandler(const FindServiceHandle& search_key, SearchRequest& search_request) noexcept;
+
     WatchesContainer::iterator StoreWatch(const os::InotifyWatchDescriptor& watch_descriptor,
                                           const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept;
 
@@ -220,6 +238,17 @@ class ServiceDiscoveryClient final : public IServiceDiscoveryClient
     std::unordered_map<InstanceIdentifier, QualityAwareContainer<std::optional<FlagFile>>> flag_files_;
     std::unordered_set<FindServiceHandle> obsolete_search_requests_;
     std::mutex flag_files_mutex_;
+
+    /// \brief Instances, whose flag files were created or removed while handling the current batch of inotify events.
+    ///
+    /// Only these instances have to be checked to find the changes for searches with an incremental handler. The
+    /// containers below keep their capacity between the batches, so that handling an event doesn't need to allocate
+    /// once they have grown to the number of instances changing at once.
+    std::vector<EnrichedInstanceIdentifier> changed_instances_;
+
+    /// \brief Storage of the added / removed handles passed to an incremental handler, reused for every call.
+    std::vector<HandleType> added_handles_;
+    std::vector<HandleType> removed_handles_;
 };
 
 }  // namespace score::mw::com::impl::lola
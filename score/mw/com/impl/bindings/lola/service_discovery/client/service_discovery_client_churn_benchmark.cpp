@@ -0,0 +1,192 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/service_discovery_client.h"
+
+#include "score/mw/com/impl/bindings/lola/service_discovery/flag_file.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/test/file_system_guard.h"
+#include "score/mw/com/impl/configuration/lola_service_id.h"
+#include "score/mw/com/impl/configuration/lola_service_instance_id.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/test/configuration_store.h"
+#include "score/mw/com/impl/enriched_instance_identifier.h"
+#include "score/mw/com/impl/find_service_handle.h"
+#include "score/mw/com/impl/find_service_handler.h"
+#include "score/mw/com/impl/handle_type.h"
+#include "score/mw/com/impl/i_service_discovery.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+#include "score/filesystem/factory/filesystem_factory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::lola::test
+{
+
+namespace
+{
+
+constexpr LolaServiceId kServiceId{4711U};
+
+const auto kInstanceSpecifier = InstanceSpecifier::Create(std::string{"/bla/blub/churn"}).value();
+
+/// \brief Counts the calls of a FindService handler and the handles passed to it, so that the benchmark thread can wait
+///        for the worker thread of the service discovery to have handled an offer change.
+class HandlerCalls
+{
+  public:
+    void Record(const std::size_t number_of_handles) noexcept
+    {
+        handles_.fetch_add(number_of_handles);
+        calls_.fetch_add(1U);
+    }
+
+    void WaitForCalls(const std::uint64_t number_of_calls) const noexcept
+    {
+        while (calls_.load() < number_of_calls)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    std::uint64_t GetCalls() const noexcept
+    {
+        return calls_.load();
+    }
+
+    std::uint64_t GetHandles() const noexcept
+    {
+        return handles_.load();
+    }
+
+  private:
+    std::atomic<std::uint64_t> calls_{0U};
+    std::atomic<std::uint64_t> handles_{0U};
+};
+
+ConfigurationStore CreateConfigurationStore(const std::optional<LolaServiceInstanceId> instance_id)
+{
+    return ConfigurationStore{
+        kInstanceSpecifier, make_ServiceIdentifierType("churn"), QualityType::kASIL_QM, kServiceId, instance_id};
+}
+
+/// \brief Offers the given number of instances of a service, starts a search for any instance of it with the given
+///        handler type and then measures stopping and re-offering one instance after the other. Each iteration
+///        includes two runs of the worker thread, each of which calls the handler once.
+template <typename StartSearch>
+void RunDiscoveryChurn(benchmark::State& state, StartSearch start_search)
+{
+    const auto number_of_instances = static_cast<std::size_t>(state.range(0));
+
+    std::vector<ConfigurationStore> instances{};
+    instances.reserve(number_of_instances);
+    for (std::size_t instance = 0U; instance < number_of_instances; ++instance)
+    {
+        instances.push_back(CreateConfigurationStore(
+            LolaServiceInstanceId{static_cast<LolaServiceInstanceId::InstanceId>(instance + 1U)}));
+    }
+    const auto find_any = CreateConfigurationStore(std::nullopt);
+
+    filesystem::Filesystem filesystem{filesystem::FilesystemFactory{}.CreateInstance()};
+    FileSystemGuard filesystem_guard{filesystem, GetSearchPathForIdentifier(find_any.GetEnrichedInstanceIdentifier())};
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+    HandlerCalls handler_calls{};
+    ServiceDiscoveryClient service_discovery_client{long_running_threads};
+
+    for (const auto& instance : instances)
+    {
+        benchmark::DoNotOptimize(service_discovery_client.OfferService(instance.GetInstanceIdentifier()));
+    }
+
+    const FindServiceHandle find_service_handle{make_FindServiceHandle(1U)};
+    benchmark::DoNotOptimize(start_search(service_discovery_client,
+                                          find_service_handle,
+                                          handler_calls,
+                                          find_any.GetEnrichedInstanceIdentifier()));
+    auto expected_calls = handler_calls.GetCalls();
+    const auto handles_of_initial_call = handler_calls.GetHandles();
+
+    std::size_t next_instance{0U};
+    for (auto _ : state)
+    {
+        const auto& instance = instances.at(next_instance);
+        next_instance = (next_instance + 1U) % number_of_instances;
+
+        benchmark::DoNotOptimize(service_discovery_client.StopOfferService(
+            instance.GetInstanceIdentifier(), IServiceDiscovery::QualityTypeSelector::kBoth));
+        handler_calls.WaitForCalls(++expected_calls);
+        benchmark::DoNotOptimize(service_discovery_client.OfferService(instance.GetInstanceIdentifier()));
+        handler_calls.WaitForCalls(++expected_calls);
+    }
+
+    benchmark::DoNotOptimize(service_discovery_client.StopFindService(find_service_handle));
+
+    const auto churn_calls = static_cast<double>(2U * state.iterations());
+    state.counters["handles_per_call"] =
+        (churn_calls > 0.0) ? static_cast<double>(handler_calls.GetHandles() - handles_of_initial_call) / churn_calls
+                            : 0.0;
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+}  // namespace
+
+/// \brief Discovery churn with a FindServiceHandler, which gets all known handles on every change.
+void BM_DiscoveryChurnFullHandler(benchmark::State& state)
+{
+    RunDiscoveryChurn(state,
+                      [](ServiceDiscoveryClient& client,
+                         const FindServiceHandle find_service_handle,
+                         HandlerCalls& handler_calls,
+                         const EnrichedInstanceIdentifier& identifier) {
+                          return client.StartFindService(
+                              find_service_handle,
+                              [&handler_calls](ServiceHandleContainer<HandleType> handles, FindServiceHandle) noexcept {
+                                  handler_calls.Record(handles.size());
+                              },
+                              identifier);
+                      });
+}
+
+/// \brief Discovery churn with a FindServiceIncrementalHandler, which only gets the added and removed handles.
+void BM_DiscoveryChurnIncrementalHandler(benchmark::State& state)
+{
+    RunDiscoveryChurn(state,
+                      [](ServiceDiscoveryClient& client,
+                         const FindServiceHandle find_service_handle,
+                         HandlerCalls& handler_calls,
+                         const EnrichedInstanceIdentifier& identifier) {
+                          return client.StartFindServiceIncremental(
+                              find_service_handle,
+                              [&handler_calls](ServiceHandleChanges<HandleType> changes, FindServiceHandle) noexcept {
+                                  handler_calls.Record(changes.added.size() + changes.removed.size());
+                              },
+                              identifier);
+                      });
+}
+
+BENCHMARK(BM_DiscoveryChurnFullHandler)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DiscoveryChurnIncrementalHandler)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(1024)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace score::mw::com::impl::lola::test
@@ -0,0 +1,181 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/service_discovery/client/service_discovery_client.h"
+
+#include "score/mw/com/impl/bindings/lola/service_discovery/test/service_discovery_client_test_fixtures.h"
+#include "score/mw/com/impl/bindings/lola/service_discovery/test/service_discovery_client_test_resources.h"
+#include "score/mw/com/impl/configuration/lola_service_id.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/test/configuration_store.h"
+#include "score/mw/com/impl/enriched_instance_identifier.h"
+#include "score/mw/com/impl/find_service_handle.h"
+#include "score/mw/com/impl/handle_type.h"
+#include "score/mw/com/impl/i_service_discovery.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <future>
+#include <optional>
+#include <string>
+
+namespace score::mw::com::impl::lola::test
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::InSequence;
+using ::testing::InvokeWithoutArgs;
+using ::testing::IsEmpty;
+using ::testing::StrictMock;
+using ::testing::UnorderedElementsAre;
+
+const LolaServiceId kServiceId{1U};
+const auto kInstanceSpecifierString = InstanceSpecifier::Create(std::string{"/bla/blub/specifier"}).value();
+ConfigurationStore kConfigStoreQm1{
+    kInstanceSpecifierString,
+    make_ServiceIdentifierType("foo"),
+    QualityType::kASIL_QM,
+    kServiceId,
+    LolaServiceInstanceId{1U},
+};
+ConfigurationStore kConfigStoreQm2{
+    kInstanceSpecifierString,
+    make_ServiceIdentifierType("foo"),
+    QualityType::kASIL_QM,
+    kServiceId,
+    LolaServiceInstanceId{2U},
+};
+ConfigurationStore kConfigStoreFindAny{kInstanceSpecifierString,
+                                       make_ServiceIdentifierType("foo"),
+                                       QualityType::kASIL_QM,
+                                       kServiceId,
+                                       std::optional<LolaServiceInstanceId>{}};
+
+HandleType kHandleQm1{kConfigStoreQm1.GetHandle()};
+HandleType kHandleFindAnyQm1{
+    kConfigStoreFindAny.GetHandle(ServiceInstanceId{kConfigStoreQm1.lola_instance_id_.value()})};
+HandleType kHandleFindAnyQm2{
+    kConfigStoreFindAny.GetHandle(ServiceInstanceId{kConfigStoreQm2.lola_instance_id_.value()})};
+
+using ServiceDiscoveryClientIncrementalFindServiceFixture = ServiceDiscoveryClientFixture;
+
+TEST_F(ServiceDiscoveryClientIncrementalFindServiceFixture, ReportsAlreadyOfferedInstancesAsAddedSynchronously)
+{
+    const FindServiceHandle find_service_handle{make_FindServiceHandle(1U)};
+    StrictMock<MockFindServiceIncrementalHandler> find_service_handler{};
+
+    // Given a ServiceDiscoveryClient with two offered service instances
+    WhichContainsAServiceDiscoveryClient()
+        .WithAnOfferedService(kConfigStoreQm1.GetInstanceIdentifier())
+        .WithAnOfferedService(kConfigStoreQm2.GetInstanceIdentifier());
+
+    // Expecting that the incremental handler is called once with both instances as added and nothing removed
+    EXPECT_CALL(find_service_handler,
+                Call(UnorderedElementsAre(kHandleFindAnyQm1, kHandleFindAnyQm2), IsEmpty(), find_service_handle));
+
+    // When starting an incremental search for any instance
+    const auto result = service_discovery_client_->StartFindServiceIncremental(
+        find_service_handle,
+        CreateWrappedMockFindServiceIncrementalHandler(find_service_handler),
+        EnrichedInstanceIdentifier{kConfigStoreFindAny.GetInstanceIdentifier()});
+
+    // Then the search is started successfully
+    EXPECT_TRUE(result.has_value());
+}
+
+TEST_F(ServiceDiscoveryClientIncrementalFindServiceFixture, ReportsOnlyTheChangedInstancesForAnyInstanceSearch)
+{
+    InSequence in_sequence{};
+
+    const FindServiceHandle find_service_handle{make_FindServiceHandle(1U)};
+    StrictMock<MockFindServiceIncrementalHandler> find_service_handler{};
+
+    std::promise<void> first_offer_barrier{};
+    std::promise<void> second_offer_barrier{};
+    std::promise<void> stop_offer_barrier{};
+
+    // Expecting that each offer reports only the newly offered instance as added
+    EXPECT_CALL(find_service_handler, Call(ElementsAre(kHandleFindAnyQm1), IsEmpty(), find_service_handle))
+        .WillOnce(InvokeWithoutArgs([&first_offer_barrier]() {
+            first_offer_barrier.set_value();
+        }));
+    EXPECT_CALL(find_service_handler, Call(ElementsAre(kHandleFindAnyQm2), IsEmpty(), find_service_handle))
+        .WillOnce(InvokeWithoutArgs([&second_offer_barrier]() {
+            second_offer_barrier.set_value();
+        }));
+
+    // and that the stop offer reports only the withdrawn instance as removed
+    EXPECT_CALL(find_service_handler, Call(IsEmpty(), ElementsAre(kHandleFindAnyQm1), find_service_handle))
+        .WillOnce(InvokeWithoutArgs([&stop_offer_barrier]() {
+            stop_offer_barrier.set_value();
+        }));
+
+    // Given a ServiceDiscoveryClient with an incremental search for any instance
+    WhichContainsAServiceDiscoveryClient();
+    const auto start_find_service_result = service_discovery_client_->StartFindServiceIncremental(
+        find_service_handle,
+        CreateWrappedMockFindServiceIncrementalHandler(find_service_handler),
+        EnrichedInstanceIdentifier{kConfigStoreFindAny.GetInstanceIdentifier()});
+    ASSERT_TRUE(start_find_service_result.has_value());
+
+    // When offering two service instances one after the other
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm1.GetInstanceIdentifier()).has_value());
+    first_offer_barrier.get_future().wait();
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm2.GetInstanceIdentifier()).has_value());
+    second_offer_barrier.get_future().wait();
+
+    // and stopping the offer of the first one
+    EXPECT_TRUE(
+        service_discovery_client_
+            ->StopOfferService(kConfigStoreQm1.GetInstanceIdentifier(), IServiceDiscovery::QualityTypeSelector::kBoth)
+            .has_value());
+    stop_offer_barrier.get_future().wait();
+}
+
+TEST_F(ServiceDiscoveryClientIncrementalFindServiceFixture, IgnoresOtherInstancesForSpecificInstanceSearch)
+{
+    InSequence in_sequence{};
+
+    const FindServiceHandle find_service_handle{make_FindServiceHandle(1U)};
+    StrictMock<MockFindServiceIncrementalHandler> find_service_handler{};
+
+    std::promise<void> offer_barrier{};
+
+    // Expecting that the handler is only called for the searched instance
+    EXPECT_CALL(find_service_handler, Call(ElementsAre(kHandleQm1), IsEmpty(), find_service_handle))
+        .WillOnce(InvokeWithoutArgs([&offer_barrier]() {
+            offer_barrier.set_value();
+        }));
+
+    // Given a ServiceDiscoveryClient with an incremental search for a specific instance and a legacy search for any
+    // instance, which shares the watch of the service directory
+    WhichContainsAServiceDiscoveryClient().WithAnActiveStartFindService(kConfigStoreFindAny.GetInstanceIdentifier(),
+                                                                        make_FindServiceHandle(2U));
+    const auto start_find_service_result = service_discovery_client_->StartFindServiceIncremental(
+        find_service_handle,
+        CreateWrappedMockFindServiceIncrementalHandler(find_service_handler),
+        EnrichedInstanceIdentifier{kConfigStoreQm1.GetInstanceIdentifier()});
+    ASSERT_TRUE(start_find_service_result.has_value());
+
+    // When offering another instance of the service first and the searched instance afterwards
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm2.GetInstanceIdentifier()).has_value());
+    EXPECT_TRUE(service_discovery_client_->OfferService(kConfigStoreQm1.GetInstanceIdentifier()).has_value());
+
+    // Then the handler is called only once with the searched instance
+    offer_barrier.get_future().wait();
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola::test
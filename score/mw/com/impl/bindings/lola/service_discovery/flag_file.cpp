@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/com/impl/bindings/lola/service_discovery/flag_file.h"
+#include "score/mw/com/impl/startup_timeline.h"
 
 #include "score/os/unistd.h"
 
@@ -184,6 +185,7 @@ auto FlagFile::Make(EnrichedInstanceIdentifier enriched_instance_identifier,
                     Disambiguator offer_disambiguator,
                     filesystem::Filesystem filesystem) noexcept -> score::Result<FlagFile>
 {
+    const StartupTimeline::Phase phase{"CreateFlagFile"};
     const auto clearing_result = RemoveMatchingFlagFiles(enriched_instance_identifier, offer_disambiguator, filesystem);
     if (!clearing_result.has_value())
     {
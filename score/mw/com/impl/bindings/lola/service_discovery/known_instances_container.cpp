@@ -89,6 +89,24 @@ auto KnownInstancesContainer::GetKnownHandles(
     return handles;
 }
 
+auto KnownInstancesContainer::Contains(const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept
+    -> bool
+{
+    const auto instance_id = enriched_instance_identifier.GetBindingSpecificInstanceId<LolaServiceInstanceId>();
+    if (!(instance_id.has_value()))
+    {
+        return false;
+    }
+
+    const auto it = known_instances_.find(
+        enriched_instance_identifier.GetBindingSpecificServiceId<LolaServiceTypeDeployment>().value());
+    if (it == known_instances_.end())
+    {
+        return false;
+    }
+    return it->second.find(instance_id.value()) != it->second.cend();
+}
+
 auto KnownInstancesContainer::Merge(KnownInstancesContainer&& container_to_be_merged) noexcept -> void
 {
     // Suppress "AUTOSAR C++14 A18-9-2" rule findings. This rule stated: "Forwarding values to other functions shall be
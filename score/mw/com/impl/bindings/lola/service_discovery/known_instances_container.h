@@ -34,6 +34,10 @@ class KnownInstancesContainer final
     auto GetKnownHandles(const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept
         -> std::vector<HandleType>;
 
+    /// \brief Returns true, if the instance of the given identifier is known. Identifiers without an instance id are
+    ///        never contained.
+    auto Contains(const EnrichedInstanceIdentifier& enriched_instance_identifier) const noexcept -> bool;
+
     auto Merge(KnownInstancesContainer&& container_to_be_merged) noexcept -> void;
 
     auto Empty() const noexcept -> bool;
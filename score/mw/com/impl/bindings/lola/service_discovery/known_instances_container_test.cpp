@@ -147,6 +147,30 @@ TEST_F(KnownInstancesContainerTest, GetKnownHandlesDoesNotReturnNonMatchingInsta
     EXPECT_THAT(unit_.GetKnownHandles(kEnrichedInstanceIdentifierAny), Not(Contains(kHandleTypeAny3)));
 }
 
+TEST_F(KnownInstancesContainerTest, ContainsReturnsTrueOnlyForKnownInstances)
+{
+    // Given a container with one instance added
+    unit_.Insert(kEnrichedInstanceIdentifier1);
+
+    // Then only the added instance is contained
+    EXPECT_TRUE(unit_.Contains(kEnrichedInstanceIdentifier1));
+    EXPECT_FALSE(unit_.Contains(kEnrichedInstanceIdentifier2));
+    EXPECT_FALSE(unit_.Contains(kEnrichedInstanceIdentifier3));
+
+    // and an identifier without instance id is never contained
+    EXPECT_FALSE(unit_.Contains(kEnrichedInstanceIdentifierAny));
+}
+
+TEST_F(KnownInstancesContainerTest, ContainsReturnsFalseAfterRemoval)
+{
+    // Given a container with one instance added and removed again
+    unit_.Insert(kEnrichedInstanceIdentifier1);
+    unit_.Remove(kEnrichedInstanceIdentifier1);
+
+    // Then the instance is no longer contained
+    EXPECT_FALSE(unit_.Contains(kEnrichedInstanceIdentifier1));
+}
+
 TEST_F(KnownInstancesContainerTest, CanMergeTwoContainers)
 {
     unit_.Insert(kEnrichedInstanceIdentifier1);
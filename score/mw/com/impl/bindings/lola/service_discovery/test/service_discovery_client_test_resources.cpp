@@ -48,4 +48,16 @@ score::cpp::callback<void(ServiceHandleContainer<HandleType>, FindServiceHandle)
         };
 }
 
+FindServiceIncrementalHandler<HandleType> CreateWrappedMockFindServiceIncrementalHandler(
+    MockFindServiceIncrementalHandler& mock_find_service_incremental_handler)
+{
+    return [&mock_find_service_incremental_handler](ServiceHandleChanges<HandleType> changes,
+                                                    FindServiceHandle handle) noexcept {
+        mock_find_service_incremental_handler.AsStdFunction()(
+            ServiceHandleContainer<HandleType>{changes.added.begin(), changes.added.end()},
+            ServiceHandleContainer<HandleType>{changes.removed.begin(), changes.removed.end()},
+            handle);
+    };
+}
+
 }  // namespace score::mw::com::impl::lola::test
@@ -41,6 +41,16 @@ filesystem::Path GenerateExpectedInstanceDirectoryPath(const LolaServiceId servi
 score::cpp::callback<void(ServiceHandleContainer<HandleType>, FindServiceHandle)> CreateWrappedMockFindServiceHandler(
     ::testing::MockFunction<void(ServiceHandleContainer<HandleType>, FindServiceHandle)>& mock_find_service_handler);
 
+// Mock of an incremental handler, which gets the added and the removed handles as containers.
+using MockFindServiceIncrementalHandler = ::testing::MockFunction<void(ServiceHandleContainer<HandleType>,
+                                                                       ServiceHandleContainer<HandleType>,
+                                                                       FindServiceHandle)>;
+
+// Creates an incremental handler which copies the added and removed handles and dispatches them to a pointer to a
+// MockFunction, since the spans passed to the handler are only valid during the call.
+FindServiceIncrementalHandler<HandleType> CreateWrappedMockFindServiceIncrementalHandler(
+    MockFindServiceIncrementalHandler& mock_find_service_incremental_handler);
+
 }  // namespace score::mw::com::impl::lola::test
 
 #endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SERVICE_DISCOVERY_SERVICE_DISCOVERY_CLIENT_TEST_RESOURCES_H
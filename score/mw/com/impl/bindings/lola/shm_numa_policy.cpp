@@ -0,0 +1,137 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_numa_policy.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/utility.hpp>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+constexpr std::uint32_t kMaxNumaNodes{std::numeric_limits<NumaNodeMask>::digits};
+
+#if defined(__linux__)
+
+// getcpu(), get_mempolicy() and mbind() are called as syscalls, since glibc doesn't provide wrappers for all of them and
+// we don't want to depend on libnuma.
+
+// The kernel evaluates maxnode - 1 bits of a node mask (see get_nodes() in mm/mempolicy.c), so we have to hand over one
+// more than the bits of our mask.
+constexpr unsigned long kMaxNodeArgument{kMaxNumaNodes + 1U};
+
+std::optional<std::uint32_t> GetCurrentNumaNode() noexcept
+{
+    unsigned int cpu{0U};
+    unsigned int node{0U};
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+    {
+        return std::nullopt;
+    }
+    return node;
+}
+
+std::optional<NumaNodeMask> GetAllowedNumaNodes() noexcept
+{
+    int mode{0};
+    NumaNodeMask allowed_nodes{0U};
+    if (::syscall(SYS_get_mempolicy, &mode, &allowed_nodes, kMaxNodeArgument, nullptr, MPOL_F_MEMS_ALLOWED) != 0)
+    {
+        return std::nullopt;
+    }
+    return allowed_nodes;
+}
+
+#endif
+
+}  // namespace
+
+std::optional<NumaNodeMask> CalculateNumaNodeMask(const LolaShmNumaPolicy& policy,
+                                                  const std::uint32_t producer_node,
+                                                  const NumaNodeMask allowed_nodes) noexcept
+{
+    if (policy.mode_ == LolaShmNumaPolicy::Mode::kInterleave)
+    {
+        return (allowed_nodes != 0U) ? std::optional<NumaNodeMask>{allowed_nodes} : std::nullopt;
+    }
+
+    const std::uint32_t node = (policy.mode_ == LolaShmNumaPolicy::Mode::kBindToNode)
+                                   ? static_cast<std::uint32_t>(policy.node_.value_or(kMaxNumaNodes))
+                                   : producer_node;
+    if (node >= kMaxNumaNodes)
+    {
+        return std::nullopt;
+    }
+    const NumaNodeMask node_mask = NumaNodeMask{1U} << node;
+    if ((node_mask & allowed_nodes) == 0U)
+    {
+        return std::nullopt;
+    }
+    return node_mask;
+}
+
+bool ApplyShmNumaPolicy(const LolaShmNumaPolicy& policy, void* const address, const std::size_t length) noexcept
+{
+#if defined(__linux__)
+    const auto allowed_nodes = GetAllowedNumaNodes();
+    const auto producer_node = GetCurrentNumaNode();
+    if ((!allowed_nodes.has_value()) || (!producer_node.has_value()))
+    {
+        mw::log::LogWarn("lola") << "Could not apply NUMA policy " << ToString(policy.mode_)
+                                 << " to shared-memory: NUMA nodes can't be queried: " << std::strerror(errno);
+        return false;
+    }
+
+    const auto node_mask = CalculateNumaNodeMask(policy, producer_node.value(), allowed_nodes.value());
+    if (!node_mask.has_value())
+    {
+        mw::log::LogWarn("lola") << "Could not apply NUMA policy " << ToString(policy.mode_)
+                                 << " to shared-memory: Node is not available. Allowed nodes: " << allowed_nodes.value();
+        return false;
+    }
+
+    const int mode = (policy.mode_ == LolaShmNumaPolicy::Mode::kInterleave) ? MPOL_INTERLEAVE : MPOL_BIND;
+    const NumaNodeMask mask = node_mask.value();
+    if (::syscall(SYS_mbind, address, length, mode, &mask, kMaxNodeArgument, MPOL_MF_MOVE) != 0)
+    {
+        mw::log::LogWarn("lola") << "Could not apply NUMA policy " << ToString(policy.mode_)
+                                 << " to shared-memory: mbind failed: " << std::strerror(errno);
+        return false;
+    }
+
+    mw::log::LogDebug("lola") << "Applied NUMA policy " << ToString(policy.mode_) << " with node mask " << mask
+                              << " to shared-memory of size " << length;
+    return true;
+#else
+    score::cpp::ignore = address;
+    score::cpp::ignore = length;
+    mw::log::LogWarn("lola") << "Could not apply NUMA policy " << ToString(policy.mode_)
+                             << " to shared-memory: NUMA policies are only supported on Linux";
+    return false;
+#endif
+}
+
+}  // namespace score::mw::com::impl::lola
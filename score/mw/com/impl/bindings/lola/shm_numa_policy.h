@@ -0,0 +1,47 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_NUMA_POLICY_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_NUMA_POLICY_H
+
+#include "score/mw/com/impl/configuration/lola_shm_numa_policy.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Bit mask of NUMA nodes as expected by mbind(). Bit n stands for node n.
+using NumaNodeMask = std::uint64_t;
+
+/// \brief Calculates the nodes, to which the pages are bound (or over which they are interleaved) for the given policy.
+/// \param policy configured policy
+/// \param producer_node node, on which the calling thread currently runs
+/// \param allowed_nodes nodes, from which the process is allowed to allocate memory
+/// \return node mask or an empty optional, if the policy refers to a node, which is not in allowed_nodes
+std::optional<NumaNodeMask> CalculateNumaNodeMask(const LolaShmNumaPolicy& policy,
+                                                  const std::uint32_t producer_node,
+                                                  const NumaNodeMask allowed_nodes) noexcept;
+
+/// \brief Applies the policy to the pages of the given (page aligned) memory region via mbind().
+///
+/// Pages of the region, which have already been touched, are migrated. As the policy is a pure performance hint, a
+/// failure is only logged as warning. The memory region then stays with the default memory policy of the process.
+///
+/// \return true, if the policy has been applied, false otherwise (e.g. on QNX or without NUMA support in the kernel)
+bool ApplyShmNumaPolicy(const LolaShmNumaPolicy& policy, void* const address, const std::size_t length) noexcept;
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_NUMA_POLICY_H
@@ -0,0 +1,101 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_numa_policy.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+constexpr NumaNodeMask kTwoNodes{0b11U};
+
+TEST(ShmNumaPolicyTest, BindToProducerNodeSelectsNodeOfCallingThread)
+{
+    // Given a policy, which binds to the producer node
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kBindToProducerNode};
+
+    // When calculating the node mask on a two node system, while running on node 1
+    const auto node_mask = CalculateNumaNodeMask(policy, 1U, kTwoNodes);
+
+    // Then only node 1 is selected
+    EXPECT_EQ(node_mask, NumaNodeMask{0b10U});
+}
+
+TEST(ShmNumaPolicyTest, BindToNodeSelectsConfiguredNode)
+{
+    // Given a policy, which binds to node 0
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kBindToNode, 0U};
+
+    // When calculating the node mask on a two node system, while running on node 1
+    const auto node_mask = CalculateNumaNodeMask(policy, 1U, kTwoNodes);
+
+    // Then only node 0 is selected
+    EXPECT_EQ(node_mask, NumaNodeMask{0b01U});
+}
+
+TEST(ShmNumaPolicyTest, InterleaveSelectsAllAllowedNodes)
+{
+    // Given an interleave policy
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kInterleave};
+
+    // When calculating the node mask for a process, which may allocate from nodes 0 and 2
+    const auto node_mask = CalculateNumaNodeMask(policy, 0U, NumaNodeMask{0b101U});
+
+    // Then both nodes are selected
+    EXPECT_EQ(node_mask, NumaNodeMask{0b101U});
+}
+
+TEST(ShmNumaPolicyTest, BindToNodeWhichIsNotAllowedFails)
+{
+    // Given a policy, which binds to node 2
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kBindToNode, 2U};
+
+    // When calculating the node mask on a two node system
+    const auto node_mask = CalculateNumaNodeMask(policy, 0U, kTwoNodes);
+
+    // Then no node mask is returned
+    EXPECT_FALSE(node_mask.has_value());
+}
+
+TEST(ShmNumaPolicyTest, BindToNodeOutsideOfNodeMaskFails)
+{
+    // Given a policy, which binds to a node, which can't be represented in the node mask
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kBindToNode, 64U};
+
+    // When calculating the node mask for a process, which may allocate from all nodes
+    const auto node_mask = CalculateNumaNodeMask(policy, 0U, ~NumaNodeMask{0U});
+
+    // Then no node mask is returned
+    EXPECT_FALSE(node_mask.has_value());
+}
+
+TEST(ShmNumaPolicyTest, ApplyingPolicyWithNodeWhichIsNotAllowedFails)
+{
+    // Given a policy, which binds to a node, which can't be represented in the node mask
+    const LolaShmNumaPolicy policy{LolaShmNumaPolicy::Mode::kBindToNode, 64U};
+    alignas(4096) static std::array<std::uint8_t, 4096U> memory{};
+
+    // When applying it to some memory
+    const auto applied = ApplyShmNumaPolicy(policy, memory.data(), memory.size());
+
+    // Then the policy is not applied
+    EXPECT_FALSE(applied);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
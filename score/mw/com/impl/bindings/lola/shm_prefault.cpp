@@ -0,0 +1,109 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_prefault.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/utility.hpp>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+namespace score::mw::com::impl::lola
+{
+
+namespace
+{
+
+std::size_t GetPageSize() noexcept
+{
+    const auto page_size = ::sysconf(_SC_PAGESIZE);
+    // 4 KiB is the smallest page size of all platforms we run on. Touching more often than needed is harmless.
+    return (page_size > 0) ? static_cast<std::size_t>(page_size) : std::size_t{4096U};
+}
+
+}  // namespace
+
+ShmPrefaultResult PrefaultMemory(const ShmPrefaultMode mode,
+                                 const void* const address,
+                                 const std::size_t length,
+                                 const std::string_view shm_name) noexcept
+{
+    ShmPrefaultResult result{0U, 0U};
+    if ((mode == ShmPrefaultMode::kNone) || (address == nullptr) || (length == 0U))
+    {
+        return result;
+    }
+
+    // Reading a page of a shared mapping is sufficient: The OS then maps the page with the protection of the mapping,
+    // so a later write to it doesn't fault again. The volatile accesses make sure, that the reads aren't optimized
+    // away.
+    const auto* const bytes = static_cast<const volatile std::uint8_t*>(address);
+    const auto page_size = GetPageSize();
+    std::uint8_t checksum{0U};
+    for (std::size_t offset = 0U; offset < length; offset += page_size)
+    {
+        checksum = static_cast<std::uint8_t>(checksum ^ bytes[offset]);
+    }
+    score::cpp::ignore = checksum;
+    result.prefaulted_bytes = length;
+
+    if (mode == ShmPrefaultMode::kPrefaultAndLock)
+    {
+        if (::mlock(address, length) == 0)
+        {
+            result.locked_bytes = length;
+        }
+        else
+        {
+            const auto error = errno;
+            mw::log::LogWarn("lola") << "Could not lock " << length << " bytes of shared-memory " << shm_name << ": "
+                                     << std::strerror(error)
+                                     << ". Memory stays pre-faulted, but unlocked. Check RLIMIT_MEMLOCK.";
+        }
+    }
+    return result;
+}
+
+ShmPrefaultResult PrefaultSharedMemory(const ShmPrefaultMode mode,
+                                       const memory::shared::ISharedMemoryResource& memory,
+                                       const std::string_view shm_name) noexcept
+{
+    if (mode == ShmPrefaultMode::kNone)
+    {
+        return ShmPrefaultResult{0U, 0U};
+    }
+
+    // The shm-object is mapped completely at its base address. So its size is the length of the mapping.
+    struct stat shm_stat{};
+    if (::fstat(memory.GetFileDescriptor(), &shm_stat) != 0)
+    {
+        const auto error = errno;
+        mw::log::LogWarn("lola") << "Could not pre-fault shared-memory " << shm_name
+                                 << ": Size can't be queried: " << std::strerror(error);
+        return ShmPrefaultResult{0U, 0U};
+    }
+
+    const auto result =
+        PrefaultMemory(mode, memory.getBaseAddress(), static_cast<std::size_t>(shm_stat.st_size), shm_name);
+    mw::log::LogInfo("lola") << "Pre-faulted " << result.prefaulted_bytes << " bytes and locked " << result.locked_bytes
+                             << " bytes of shared-memory " << shm_name;
+    return result;
+}
+
+}  // namespace score::mw::com::impl::lola
@@ -0,0 +1,54 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_PREFAULT_H
+#define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_PREFAULT_H
+
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
+
+#include "score/memory/shared/i_shared_memory_resource.h"
+
+#include <cstddef>
+#include <string_view>
+
+namespace score::mw::com::impl::lola
+{
+
+/// \brief Number of bytes of a memory region, which have been faulted in and locked.
+struct ShmPrefaultResult
+{
+    std::size_t prefaulted_bytes;
+    std::size_t locked_bytes;
+};
+
+/// \brief Touches every page of the given (page aligned) memory region once by reading it, so that later accesses on
+///        the realtime path don't take page faults. With ShmPrefaultMode::kPrefaultAndLock the region is additionally
+///        locked via mlock().
+///
+/// Pre-faulting is a pure performance measure. A failure to lock is therefore only logged as warning (e.g. if the
+/// RLIMIT_MEMLOCK of the process is too small) and the region stays pre-faulted, but unlocked.
+///
+/// \param shm_name name of the shm-object, the memory region belongs to. Only used for logging.
+ShmPrefaultResult PrefaultMemory(const ShmPrefaultMode mode,
+                                 const void* const address,
+                                 const std::size_t length,
+                                 const std::string_view shm_name) noexcept;
+
+/// \brief Applies PrefaultMemory() to the complete mapping of the given shm-object, i.e. to the management data of the
+///        memory resource and its usable memory, and logs the number of pre-faulted and locked bytes.
+ShmPrefaultResult PrefaultSharedMemory(const ShmPrefaultMode mode,
+                                       const memory::shared::ISharedMemoryResource& memory,
+                                       const std::string_view shm_name) noexcept;
+
+}  // namespace score::mw::com::impl::lola
+
+#endif  // SCORE_MW_COM_IMPL_BINDINGS_LOLA_SHM_PREFAULT_H
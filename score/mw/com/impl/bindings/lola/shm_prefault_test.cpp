@@ -0,0 +1,166 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_prefault.h"
+
+#include "score/memory/shared/shared_memory_resource_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace score::mw::com::impl::lola
+{
+namespace
+{
+
+using ::testing::Return;
+
+constexpr std::size_t kNumberOfPages{4U};
+
+/// \brief Shared mapping of a temporary file, like the one of a shm-object.
+class ShmPrefaultFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        page_size_ = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        length_ = kNumberOfPages * page_size_;
+        file_ = std::tmpfile();
+        ASSERT_NE(file_, nullptr);
+        ASSERT_EQ(::ftruncate(::fileno(file_), static_cast<off_t>(length_)), 0);
+        address_ = ::mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, ::fileno(file_), 0);
+        ASSERT_NE(address_, MAP_FAILED);
+    }
+
+    void TearDown() override
+    {
+        if (address_ != MAP_FAILED)
+        {
+            ::munmap(address_, length_);
+        }
+        if (file_ != nullptr)
+        {
+            std::fclose(file_);
+        }
+    }
+
+    std::size_t CountResidentPages() const
+    {
+        std::vector<unsigned char> residency(kNumberOfPages, 0U);
+        if (::mincore(address_, length_, residency.data()) != 0)
+        {
+            return 0U;
+        }
+        std::size_t resident_pages{0U};
+        for (const auto page : residency)
+        {
+            resident_pages += static_cast<std::size_t>(page & 1U);
+        }
+        return resident_pages;
+    }
+
+    std::size_t page_size_{0U};
+    std::size_t length_{0U};
+    std::FILE* file_{nullptr};
+    void* address_{MAP_FAILED};
+};
+
+TEST_F(ShmPrefaultFixture, NoneModeDoesNothing)
+{
+    // Given a shared mapping, which hasn't been touched yet
+
+    // When pre-faulting it in mode kNone
+    const auto result = PrefaultMemory(ShmPrefaultMode::kNone, address_, length_, "test");
+
+    // Then no bytes are reported as pre-faulted or locked
+    EXPECT_EQ(result.prefaulted_bytes, 0U);
+    EXPECT_EQ(result.locked_bytes, 0U);
+
+    // and no page has been faulted in
+    EXPECT_EQ(CountResidentPages(), 0U);
+}
+
+TEST_F(ShmPrefaultFixture, PrefaultMakesAllPagesResident)
+{
+    // Given a shared mapping, which hasn't been touched yet
+
+    // When pre-faulting it
+    const auto result = PrefaultMemory(ShmPrefaultMode::kPrefault, address_, length_, "test");
+
+    // Then the whole mapping is reported as pre-faulted, but not as locked
+    EXPECT_EQ(result.prefaulted_bytes, length_);
+    EXPECT_EQ(result.locked_bytes, 0U);
+
+    // and all of its pages are resident
+    EXPECT_EQ(CountResidentPages(), kNumberOfPages);
+}
+
+TEST_F(ShmPrefaultFixture, PrefaultAndLockLocksTheMapping)
+{
+    // Given a process, which may lock the shared mapping
+    rlimit memlock_limit{};
+    ASSERT_EQ(::getrlimit(RLIMIT_MEMLOCK, &memlock_limit), 0);
+    if ((memlock_limit.rlim_cur != RLIM_INFINITY) && (memlock_limit.rlim_cur < length_))
+    {
+        GTEST_SKIP() << "RLIMIT_MEMLOCK is too small to lock the mapping";
+    }
+
+    // When pre-faulting and locking it
+    const auto result = PrefaultMemory(ShmPrefaultMode::kPrefaultAndLock, address_, length_, "test");
+
+    // Then the whole mapping is reported as pre-faulted and locked
+    EXPECT_EQ(result.prefaulted_bytes, length_);
+    EXPECT_EQ(result.locked_bytes, length_);
+    EXPECT_EQ(CountResidentPages(), kNumberOfPages);
+    EXPECT_EQ(::munlock(address_, length_), 0);
+}
+
+TEST_F(ShmPrefaultFixture, PrefaultSharedMemoryPrefaultsTheCompleteShmObject)
+{
+    // Given a shm-object, which is mapped completely at its base address
+    ::testing::NiceMock<memory::shared::SharedMemoryResourceMock> memory{};
+    ON_CALL(memory, GetFileDescriptor()).WillByDefault(Return(::fileno(file_)));
+    ON_CALL(memory, getBaseAddress()).WillByDefault(Return(address_));
+
+    // When pre-faulting the shm-object
+    const auto result = PrefaultSharedMemory(ShmPrefaultMode::kPrefault, memory, "test");
+
+    // Then the size of the shm-object is reported as pre-faulted
+    EXPECT_EQ(result.prefaulted_bytes, length_);
+    EXPECT_EQ(CountResidentPages(), kNumberOfPages);
+}
+
+TEST_F(ShmPrefaultFixture, PrefaultSharedMemoryDoesNothingIfSizeCannotBeQueried)
+{
+    // Given a shm-object with an invalid file descriptor
+    ::testing::NiceMock<memory::shared::SharedMemoryResourceMock> memory{};
+    ON_CALL(memory, GetFileDescriptor()).WillByDefault(Return(-1));
+    ON_CALL(memory, getBaseAddress()).WillByDefault(Return(address_));
+
+    // When pre-faulting the shm-object
+    const auto result = PrefaultSharedMemory(ShmPrefaultMode::kPrefault, memory, "test");
+
+    // Then nothing is reported as pre-faulted
+    EXPECT_EQ(result.prefaulted_bytes, 0U);
+    EXPECT_EQ(result.locked_bytes, 0U);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::lola
@@ -26,6 +26,7 @@
 #include "score/mw/com/impl/bindings/lola/skeleton_event_properties.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/deferred_logger.h"
 #include "score/mw/com/impl/plumbing/sample_allocatee_ptr.h"
 #include "score/mw/com/impl/plumbing/sample_ptr.h"
 #include "score/mw/com/impl/runtime.h"
@@ -211,8 +212,7 @@ Result<impl::SamplePtr<SampleType>> SkeletonEvent<SampleType>::GetLatestSample(Q
     auto guard = skeleton_event_common_.AllocateGetterGuard();
     if (!guard.has_value())
     {
-        ::score::mw::log::LogError("lola")
-            << "GetLatestSample called while a SamplePtr from a previous call is still alive";
+        DeferrableLogError("lola") << "GetLatestSample called while a SamplePtr from a previous call is still alive";
         return MakeUnexpected(ComErrc::kMaxSamplesReached);
     }
 
@@ -225,7 +225,7 @@ Result<impl::SamplePtr<SampleType>> SkeletonEvent<SampleType>::GetLatestSample(Q
                                                                                   EventSlotStatus::TIMESTAMP_MAX);
     if (!slot_result.has_value())
     {
-        ::score::mw::log::LogError("lola") << "ReferenceNextEvent did not return a slot index";
+        DeferrableLogError("lola") << "ReferenceNextEvent did not return a slot index";
         return MakeUnexpected(ComErrc::kBindingFailure);
     }
 
@@ -25,6 +25,7 @@
 #include "score/mw/com/impl/bindings/lola/transaction_log_registration_guard.h"
 #include "score/mw/com/impl/bindings/lola/type_erased_sample_ptrs_guard.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/deferred_logger.h"
 #include "score/mw/com/impl/generic_skeleton_event_binding.h"
 #include "score/mw/com/impl/plumbing/sample_allocatee_ptr.h"
 #include "score/mw/com/impl/runtime.h"
@@ -36,7 +37,10 @@
 #include <score/utility.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <optional>
+#include <string_view>
 #include <tuple>
 
 namespace score::mw::com::impl::lola
@@ -169,6 +173,11 @@ class SkeletonEventCommon
     std::optional<ConsumerEventDataControlLocalView<>> consumer_control_local_view_asil_b_;
     std::optional<EventDataControlComposite<>> event_data_control_composite_;
 
+    /// \brief EventControls in shared memory, which are set in PrepareOfferCommon() and reset in
+    ///        PrepareStopOfferCommon(). Used to check the sample leases of the proxies, see CheckSampleLeases().
+    EventControl* event_control_qm_{nullptr};
+    EventControl* event_control_asil_b_{nullptr};
+
     EventSlotStatus::EventTimeStamp current_timestamp_;
     impl::tracing::SkeletonEventTracingData tracing_data_;
 
@@ -201,6 +210,12 @@ class SkeletonEventCommon
 
     void EmplaceTypeErasedSamplePtrsGuard();
     void UpdateCurrentTimestamp();
+
+    /// \brief Checks the sample leases of all proxies, in case a maximum sample hold time is configured. Proxies holding
+    ///        samples longer are marked as degraded and, depending on the configured StaleSampleAction, their stale
+    ///        references get released.
+    /// \return true, if at least one reference has been released, so that a new slot allocation may succeed.
+    bool CheckSampleLeases() noexcept;
     void SetQmNotificationsRegistered(bool value);
     void SetAsilBNotificationsRegistered(bool value);
     void ResetGuards() noexcept;
@@ -232,6 +247,8 @@ void SkeletonEventCommon<SampleType>::PrepareOfferCommon(EventControl& event_con
 {
     auto& provider_control_local_view_qm = provider_control_local_view_qm_.emplace(event_control_qm.data_control);
     score::cpp::ignore = consumer_control_local_view_qm_.emplace(event_control_qm.data_control);
+    event_control_qm_ = &event_control_qm;
+    event_control_asil_b_ = event_control_asil_b;
 
     const bool is_skeleton_event_asil_b = event_control_asil_b != nullptr;
     ProviderEventDataControlLocalView<>* provider_control_local_view_asil_b_ptr{nullptr};
@@ -342,6 +359,8 @@ void SkeletonEventCommon<SampleType>::PrepareStopOfferCommon() noexcept
     provider_control_local_view_asil_b_.reset();
     consumer_control_local_view_qm_.reset();
     consumer_control_local_view_asil_b_.reset();
+    event_control_qm_ = nullptr;
+    event_control_asil_b_ = nullptr;
 }
 
 template <typename SampleType>
@@ -353,11 +372,18 @@ Result<SlotIndexType> SkeletonEventCommon<SampleType>::AllocateSlot() noexcept
 {
     if (event_data_control_composite_.has_value() == false)
     {
-        ::score::mw::log::LogError("lola") << "Tried to allocate event, but the EventDataControl does not exist!";
+        DeferrableLogError("lola") << "Tried to allocate event, but the EventDataControl does not exist!";
         return MakeUnexpected(ComErrc::kBindingFailure);
     }
     auto& event_data_control_composite = event_data_control_composite_.value();
-    const auto allocated_slot_result = event_data_control_composite.AllocateNextSlot();
+    auto allocated_slot_result = event_data_control_composite.AllocateNextSlot();
+
+    // Slots might be blocked by stalled proxies. Sample leases are only checked in this (rare) case, so that the
+    // regular allocation path doesn't get slower.
+    if (!allocated_slot_result.allocated_slot_index.has_value() && CheckSampleLeases())
+    {
+        allocated_slot_result = event_data_control_composite.AllocateNextSlot();
+    }
 
     // Suppress "AUTOSAR C++14 A5-2-6" rule finding. This rule states:"The operands of a logical && or \\ shall be
     // parenthesized if the operands contain binary operators".
@@ -368,10 +394,10 @@ Result<SlotIndexType> SkeletonEventCommon<SampleType>::AllocateSlot() noexcept
         allocated_slot_result.qm_misbehaved)
     {
         qm_disconnect_ = true;
-        score::mw::log::LogWarn("lola")
+        DeferrableLogWarn("lola")
             << __func__ << __LINE__
             << "Disconnecting unsafe QM consumers as slot allocation failed on an ASIL-B enabled event: "
-            << element_fq_id_;
+            << element_fq_id_.ToString();
         parent_.DisconnectQmConsumers();
     }
 
@@ -380,15 +406,70 @@ Result<SlotIndexType> SkeletonEventCommon<SampleType>::AllocateSlot() noexcept
         // we didn't get a slot, which is a sign, that too few slots have been configured.
         if (!event_properties_.enforce_max_samples)
         {
-            ::score::mw::log::LogError("lola")
-                << "SkeletonEvent: Allocation of event slot failed. Hint: enforceMaxSamples was "
-                   "disabled by config. Might be the root cause!";
+            DeferrableLogError("lola") << "SkeletonEvent: Allocation of event slot failed. Hint: enforceMaxSamples was "
+                                          "disabled by config. Might be the root cause!";
         }
         return MakeUnexpected(ComErrc::kBindingFailure);
     }
     return allocated_slot_result.allocated_slot_index.value();
 }
 
+template <typename SampleType>
+bool SkeletonEventCommon<SampleType>::CheckSampleLeases() noexcept
+{
+    if ((event_properties_.max_sample_hold_time.count() <= 0) || (event_control_qm_ == nullptr))
+    {
+        return false;
+    }
+    const auto max_sample_hold_time_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(event_properties_.max_sample_hold_time).count());
+    const auto now_ns = GetCurrentSendTime();
+    if (now_ns <= max_sample_hold_time_ns)
+    {
+        return false;
+    }
+    const auto expiry_ns = now_ns - max_sample_hold_time_ns;
+    const bool force_release =
+        (event_properties_.stale_sample_action == LolaEventInstanceDeployment::StaleSampleAction::kForceRelease);
+
+    const auto check_transaction_log_set = [this, expiry_ns, force_release](
+                                               EventControl& event_control,
+                                               ConsumerEventDataControlLocalView<>& consumer_control_local_view,
+                                               const std::string_view quality) noexcept -> bool {
+        const auto result = event_control.transaction_log_set_.CheckSampleLeases(
+            expiry_ns, force_release, [&consumer_control_local_view](const SlotIndexType slot_index) noexcept {
+                consumer_control_local_view.DereferenceEventWithoutTransactionLogging(slot_index);
+            });
+        if (result.newly_degraded_logs > 0U)
+        {
+            DeferrableLogWarn("lola") << "SkeletonEvent " << element_fq_id_.ToString() << ": "
+                                      << result.newly_degraded_logs << " " << quality
+                                      << " proxies hold samples longer than the maximum sample hold time of "
+                                      << event_properties_.max_sample_hold_time.count()
+                                      << "ms and are marked as degraded.";
+        }
+        if (result.released_references > 0U)
+        {
+            DeferrableLogWarn("lola") << "SkeletonEvent " << element_fq_id_.ToString() << ": Released "
+                                      << result.released_references << " stale " << quality
+                                      << " sample references.";
+        }
+        return result.released_references > 0U;
+    };
+
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(consumer_control_local_view_qm_.has_value());
+    bool released_references =
+        check_transaction_log_set(*event_control_qm_, consumer_control_local_view_qm_.value(), "QM");
+    if (event_control_asil_b_ != nullptr)
+    {
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(consumer_control_local_view_asil_b_.has_value());
+        released_references =
+            check_transaction_log_set(*event_control_asil_b_, consumer_control_local_view_asil_b_.value(), "ASIL-B") ||
+            released_references;
+    }
+    return released_references;
+}
+
 template <typename SampleType>
 Result<void> SkeletonEventCommon<SampleType>::Send(impl::SampleAllocateePtr<SampleType>& sample) noexcept
 {
@@ -13,6 +13,9 @@
 #ifndef SCORE_MW_COM_IMPL_BINDINGS_LOLA_SKELETON_EVENT_PROPERTIES_H
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_SKELETON_EVENT_PROPERTIES_H
 
+#include "score/mw/com/impl/configuration/lola_event_instance_deployment.h"
+
+#include <chrono>
 #include <cstddef>
 
 namespace score::mw::com::impl::lola
@@ -31,6 +34,15 @@ struct SkeletonEventProperties
     // individually.
     // coverity[autosar_cpp14_a9_6_1_violation : FALSE]
     bool enforce_max_samples;
+
+    LolaEventInstanceDeployment::SubscriptionControlWidth subscription_control_width{
+        LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit};
+
+    /// \brief Maximum time a consumer may hold a sample. Zero disables the sample leases.
+    std::chrono::milliseconds max_sample_hold_time{0};
+
+    LolaEventInstanceDeployment::StaleSampleAction stale_sample_action{
+        LolaEventInstanceDeployment::StaleSampleAction::kMarkDegraded};
 };
 
 }  // namespace score::mw::com::impl::lola
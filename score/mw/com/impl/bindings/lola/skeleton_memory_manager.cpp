@@ -14,6 +14,8 @@
 #include "score/mw/com/impl/bindings/lola/i_shm_path_builder.h"
 #include "score/mw/com/impl/bindings/lola/service_data_control.h"
 #include "score/mw/com/impl/bindings/lola/service_data_storage.h"
+#include "score/mw/com/impl/bindings/lola/shm_numa_policy.h"
+#include "score/mw/com/impl/bindings/lola/shm_prefault.h"
 #include "score/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
@@ -21,6 +23,7 @@
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/runtime.h"
 #include "score/mw/com/impl/skeleton_event_binding.h"
+#include "score/mw/com/impl/startup_timeline.h"
 
 #include "score/language/safecpp/safe_math/safe_math.h"
 #include "score/memory/shared/managed_memory_resource.h"
@@ -35,6 +38,7 @@
 #include <sys/types.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -129,6 +133,7 @@ auto SkeletonMemoryManager::CreateSharedMemory(
     SkeletonBinding::SkeletonFieldBindings& fields,
     std::optional<SkeletonBinding::RegisterShmObjectTraceCallback> register_shm_object_trace_callback) -> Result<void>
 {
+    const StartupTimeline::Phase phase{"CreateSharedMemory"};
     const auto storage_size_calc_result = CalculateShmResourceStorageSizes(events, fields);
 
     if (!CreateSharedMemoryForControl(
@@ -158,6 +163,7 @@ auto SkeletonMemoryManager::CreateSharedMemory(
 auto SkeletonMemoryManager::OpenExistingSharedMemory(
     std::optional<SkeletonBinding::RegisterShmObjectTraceCallback> register_shm_object_trace_callback) -> Result<void>
 {
+    const StartupTimeline::Phase phase{"OpenExistingSharedMemory"};
     if (!OpenSharedMemoryForControl(QualityType::kASIL_QM))
     {
         return MakeUnexpected(ComErrc::kErroneousFileHandle, "Could not open shared memory object for control QM");
@@ -367,6 +373,7 @@ SkeletonMemoryManager::ShmResourceStorageSizes SkeletonMemoryManager::CalculateS
     SkeletonBinding::SkeletonEventBindings& events,
     SkeletonBinding::SkeletonFieldBindings& fields)
 {
+    const StartupTimeline::Phase phase{"CalculateShmResourceStorageSizes"};
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
         GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetShmSizeCalculationMode() ==
             ShmSizeCalculationMode::kSimulation,
@@ -515,6 +522,7 @@ bool SkeletonMemoryManager::CreateSharedMemoryForData(
     const std::size_t shm_size,
     std::optional<SkeletonBinding::RegisterShmObjectTraceCallback> register_shm_object_trace_callback)
 {
+    const StartupTimeline::Phase phase{"CreateSharedMemoryForData"};
     memory::shared::SharedMemoryFactory::UserPermissionsMap permissions{};
     for (const auto& allowed_consumer : lola_service_instance_deployment.allowed_consumer_)
     {
@@ -532,7 +540,8 @@ bool SkeletonMemoryManager::CreateSharedMemoryForData(
             : memory::shared::SharedMemoryFactory::UserPermissions{permissions};
     const auto memory_resource = score::memory::shared::SharedMemoryFactory::Create(
         path,
-        [this](std::shared_ptr<score::memory::shared::ISharedMemoryResource> memory) {
+        [this, shm_size](std::shared_ptr<score::memory::shared::ISharedMemoryResource> memory) {
+            this->PlaceSharedMemoryOnNumaNodes(*memory, shm_size);
             this->InitializeSharedMemoryForData(memory);
         },
         shm_size,
@@ -543,6 +552,7 @@ bool SkeletonMemoryManager::CreateSharedMemoryForData(
         return false;
     }
     data_storage_path_ = path;
+    PrefaultSharedMemoryObject(*memory_resource, path);
     if (register_shm_object_trace_callback.has_value() && memory_resource->IsShmInTypedMemory())
     {
         // only if the memory_resource could be successfully allocated in typed-memory, we call back the
@@ -577,6 +587,7 @@ bool SkeletonMemoryManager::CreateSharedMemoryForControl(
     const QualityType asil_level,
     const std::size_t shm_size)
 {
+    const StartupTimeline::Phase phase{"CreateSharedMemoryForControl"};
     const auto path = shm_path_builder_.GetControlChannelShmName(lola_instance_id_, asil_level);
 
     const auto consumer = lola_service_instance_deployment.allowed_consumer_.find(asil_level);
@@ -597,18 +608,21 @@ bool SkeletonMemoryManager::CreateSharedMemoryForControl(
         ((permissions.empty()) && (lola_service_instance_deployment.strict_permissions_ == false))
             ? memory::shared::SharedMemoryFactory::WorldWritable{}
             : memory::shared::SharedMemoryFactory::UserPermissions{permissions};
-    control_resource = score::memory::shared::SharedMemoryFactory::Create(
+    const auto memory_resource = score::memory::shared::SharedMemoryFactory::Create(
         path,
-        [this, asil_level](std::shared_ptr<score::memory::shared::ManagedMemoryResource> memory) {
+        [this, asil_level, shm_size](std::shared_ptr<score::memory::shared::ManagedMemoryResource> memory) {
+            this->PlaceSharedMemoryOnNumaNodes(*memory, shm_size);
             this->InitializeSharedMemoryForControl(asil_level, memory);
         },
         shm_size,
         user_permissions);
+    control_resource = memory_resource;
     if (control_resource == nullptr)
     {
         return false;
     }
     data_control_path = path;
+    PrefaultSharedMemoryObject(*memory_resource, path);
     return true;
 }
 
@@ -630,6 +644,7 @@ bool SkeletonMemoryManager::OpenSharedMemoryForData(
     }
     data_storage_path_ = path;
     storage_resource_ = memory_resource;
+    PrefaultSharedMemoryObject(*memory_resource, path);
 
     const auto& memory_resource_ref = *memory_resource.get();
     storage_ = GetServiceDataStorageSkeletonSide(memory_resource_ref);
@@ -671,12 +686,14 @@ bool SkeletonMemoryManager::OpenSharedMemoryForControl(const QualityType asil_le
     auto& control_resource = (asil_level == QualityType::kASIL_QM) ? control_qm_resource_ : control_asil_resource_;
     auto& data_control_path = (asil_level == QualityType::kASIL_QM) ? data_control_qm_path_ : data_control_asil_path_;
 
-    control_resource = score::memory::shared::SharedMemoryFactory::Open(path, true);
+    const auto memory_resource = score::memory::shared::SharedMemoryFactory::Open(path, true);
+    control_resource = memory_resource;
     if (control_resource == nullptr)
     {
         return false;
     }
     data_control_path = path;
+    PrefaultSharedMemoryObject(*memory_resource, path);
 
     auto& control = (asil_level == QualityType::kASIL_QM) ? control_qm_ : control_asil_b_;
 
@@ -688,6 +705,31 @@ bool SkeletonMemoryManager::OpenSharedMemoryForControl(const QualityType asil_le
     return true;
 }
 
+void SkeletonMemoryManager::PlaceSharedMemoryOnNumaNodes(const score::memory::shared::ManagedMemoryResource& memory,
+                                                         const std::size_t shm_size) const
+{
+    const auto& shm_numa_policy = lola_service_instance_deployment_.shm_numa_policy_;
+    if (!shm_numa_policy.has_value())
+    {
+        return;
+    }
+
+    // The shm-object is mapped page aligned at its base address. It contains the management data of the memory
+    // resource in front of the usable memory of the requested size. All of it gets placed, as the management data is
+    // accessed by providers and consumers as well.
+    auto* const base_address = static_cast<std::uint8_t*>(memory.getBaseAddress());
+    const auto* const usable_base_address = static_cast<const std::uint8_t*>(memory.getUsableBaseAddress());
+    const auto management_data_size = static_cast<std::size_t>(usable_base_address - base_address);
+    score::cpp::ignore = ApplyShmNumaPolicy(shm_numa_policy.value(), base_address, management_data_size + shm_size);
+}
+
+void SkeletonMemoryManager::PrefaultSharedMemoryObject(const score::memory::shared::ISharedMemoryResource& memory,
+                                                       const std::string& path) const
+{
+    const auto shm_prefault_mode = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa).GetShmPrefaultMode();
+    score::cpp::ignore = PrefaultSharedMemory(shm_prefault_mode, memory, path);
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". This is a false positive, there is no way for calling std::terminate().
 // coverity[autosar_cpp14_a15_5_3_violation : FALSE]
@@ -729,13 +771,15 @@ EventControl& SkeletonMemoryManager::EmplaceEventControl(const QualityType asil_
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(service_data_control != nullptr);
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD(memory_resource != nullptr);
 
-    auto control_qm =
-        service_data_control->event_controls_.emplace(std::piecewise_construct,
-                                                      std::forward_as_tuple(element_fq_id),
-                                                      std::forward_as_tuple(element_properties.number_of_slots,
-                                                                            element_properties.max_subscribers,
-                                                                            element_properties.enforce_max_samples,
-                                                                            *memory_resource));
+    auto control_qm = service_data_control->event_controls_.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(element_fq_id),
+        std::forward_as_tuple(element_properties.number_of_slots,
+                              element_properties.max_subscribers,
+                              element_properties.enforce_max_samples,
+                              element_properties.subscription_control_width,
+                              *memory_resource,
+                              element_properties.max_sample_hold_time.count() > 0));
     SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(control_qm.second,
                                                 "Couldn't register/emplace EventControl in control-section.");
 
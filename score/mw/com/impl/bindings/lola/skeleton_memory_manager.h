@@ -23,6 +23,7 @@
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/skeleton_binding.h"
 
+#include "score/memory/shared/i_shared_memory_resource.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
 #include <score/assert.hpp>
@@ -194,6 +195,14 @@ class SkeletonMemoryManager final
     bool OpenSharedMemoryForData(
         const std::optional<SkeletonBinding::RegisterShmObjectTraceCallback> register_shm_object_trace_callback);
     bool OpenSharedMemoryForControl(const QualityType asil_level);
+    /// \brief Applies the NUMA policy of the service instance deployment (if any) to a newly created shm-object, before
+    /// it gets initialized.
+    void PlaceSharedMemoryOnNumaNodes(const score::memory::shared::ManagedMemoryResource& memory,
+                                      const std::size_t shm_size) const;
+    /// \brief Faults in (and locks) the pages of a created/opened shm-object according to the configured
+    /// ShmPrefaultMode, so that the first accesses in Allocate()/Send() don't take page faults.
+    void PrefaultSharedMemoryObject(const score::memory::shared::ISharedMemoryResource& memory,
+                                    const std::string& path) const;
     void InitializeSharedMemoryForData(const std::shared_ptr<score::memory::shared::ManagedMemoryResource>& memory);
     void InitializeSharedMemoryForControl(const QualityType asil_level,
                                           const std::shared_ptr<score::memory::shared::ManagedMemoryResource>& memory);
@@ -29,6 +29,7 @@
 #include <score/span.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <optional>
@@ -39,13 +40,29 @@
 namespace score::mw::com::impl::lola
 {
 
-SkeletonMethod::SkeletonMethod(Skeleton& skeleton, UniqueMethodIdentifier unique_method_identifier)
+namespace
+{
+
+MethodCallConcurrencyGroup NextConcurrencyGroup() noexcept
+{
+    // Group 0 is left to handlers registered without a SkeletonMethod.
+    static std::atomic<MethodCallConcurrencyGroup> next_concurrency_group{1U};
+    return next_concurrency_group.fetch_add(1U, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+SkeletonMethod::SkeletonMethod(Skeleton& skeleton,
+                               UniqueMethodIdentifier unique_method_identifier,
+                               MethodCallSchedulingCfg scheduling_cfg)
     : in_args_type_erased_info_{},
       return_type_type_erased_info_{},
       type_erased_callback_{},
+      scheduling_cfg_{scheduling_cfg},
       registration_guards_{},
       registration_guards_mutex_{}
 {
+    scheduling_cfg_.concurrency_group = NextConcurrencyGroup();
     skeleton.RegisterMethod(unique_method_identifier, *this);
 }
 
@@ -98,8 +115,11 @@ Result<void> SkeletonMethod::OnProxyMethodSubscribeFinished(
 
     auto& lola_runtime = GetBindingRuntime<lola::IRuntime>(BindingType::kLoLa);
     auto& lola_message_passing = lola_runtime.GetLolaMessaging();
-    auto registration_result = lola_message_passing.RegisterMethodCallHandler(
-        asil_level, proxy_method_instance_identifier, std::move(method_call_callback), allowed_proxy_uid);
+    auto registration_result = lola_message_passing.RegisterMethodCallHandler(asil_level,
+                                                                              proxy_method_instance_identifier,
+                                                                              std::move(method_call_callback),
+                                                                              allowed_proxy_uid,
+                                                                              scheduling_cfg_);
     if (!(registration_result.has_value()))
     {
         return MakeUnexpected<void>(registration_result.error());
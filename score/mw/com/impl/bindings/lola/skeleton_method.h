@@ -15,6 +15,7 @@
 
 #include "score/mw/com/impl/bindings/lola/element_fq_id.h"
 #include "score/mw/com/impl/bindings/lola/messaging/method_call_registration_guard.h"
+#include "score/mw/com/impl/bindings/lola/messaging/method_call_scheduling_cfg.h"
 #include "score/mw/com/impl/bindings/lola/methods/proxy_method_instance_identifier.h"
 #include "score/mw/com/impl/bindings/lola/methods/type_erased_call_queue.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
@@ -43,7 +44,12 @@ class Skeleton;
 class SkeletonMethod : public SkeletonMethodBinding
 {
   public:
-    SkeletonMethod(Skeleton& skeleton, const UniqueMethodIdentifier unique_method_identifier);
+    /// \param scheduling_cfg Priority and concurrency limit of calls of proxies in other processes. Its
+    ///        concurrency_group is assigned by the SkeletonMethod, so that the limit applies to the calls of all
+    ///        proxies of this SkeletonMethod together.
+    SkeletonMethod(Skeleton& skeleton,
+                   const UniqueMethodIdentifier unique_method_identifier,
+                   MethodCallSchedulingCfg scheduling_cfg = {});
 
     Result<void> RegisterHandler(SkeletonMethodBinding::TypeErasedHandler&& type_erased_callback) override;
 
@@ -73,6 +79,7 @@ class SkeletonMethod : public SkeletonMethodBinding
     std::optional<memory::DataTypeSizeInfo> in_args_type_erased_info_;
     std::optional<memory::DataTypeSizeInfo> return_type_type_erased_info_;
     std::optional<SkeletonMethodBinding::TypeErasedHandler> type_erased_callback_;
+    MethodCallSchedulingCfg scheduling_cfg_;
 
     std::unordered_map<ProxyMethodInstanceIdentifier, std::pair<pid_t, MethodCallRegistrationGuard>>
         registration_guards_;
@@ -143,7 +143,7 @@ class SkeletonMethodHandlingFixture : public SkeletonMockedMemoryFixture
         ON_CALL(*mock_method_memory_resource_asil_b_, getUsableBaseAddress())
             .WillByDefault(Return(static_cast<void*>(&fake_method_data_b_.method_data_)));
 
-        ON_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _))
+        ON_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _, _))
             .WillByDefault(WithArgs<0, 1>(Invoke(
                 [this](auto asil_level, auto proxy_method_instance_identifier) -> Result<MethodCallRegistrationGuard> {
                     return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -503,7 +503,7 @@ TEST_F(SkeletonPrepareStopOfferFixture, PrepareStopOfferExpiresScopeOfMethodCall
     std::optional<IMessagePassingService::MethodCallHandler> method_call_handler_1{};
     std::optional<IMessagePassingService::MethodCallHandler> method_call_handler_2{};
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(WithArgs<2>(Invoke([this, &method_call_handler_1](auto method_call_handler) {
             method_call_handler_1.emplace(method_call_handler);
             return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -512,7 +512,7 @@ TEST_F(SkeletonPrepareStopOfferFixture, PrepareStopOfferExpiresScopeOfMethodCall
                                                               method_call_registration_guard_scope_);
         })));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kDummyQualityType, dumb_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(kDummyQualityType, dumb_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(WithArgs<2>(Invoke([this, &method_call_handler_2](auto method_call_handler) {
             method_call_handler_2.emplace(method_call_handler);
             return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -634,10 +634,10 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture,
     // results
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer));
+                    QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer, _));
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer));
+                    QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer, _));
 
     // When calling the registered Qm method subscribed handler
     ASSERT_TRUE(captured_method_subscribed_handler_qm_.has_value());
@@ -660,17 +660,17 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture,
     // return valid results
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer));
+                    QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer, _));
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer));
+                    QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, test::kAllowedQmMethodConsumer, _));
 
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, test::kAllowedAsilBMethodConsumer));
+                    QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, test::kAllowedAsilBMethodConsumer, _));
     EXPECT_CALL(message_passing_mock_,
                 RegisterMethodCallHandler(
-                    QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, test::kAllowedAsilBMethodConsumer));
+                    QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, test::kAllowedAsilBMethodConsumer, _));
 
     // When calling the registered Qm and ASIL-B method subscribed handlers
     ASSERT_TRUE(captured_method_subscribed_handler_qm_.has_value());
@@ -699,7 +699,7 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture, CallingReturnsErrorIfRegisteri
     // Expecting that RegisterMethodCallHandler is called on the first method which returns an error
     const auto error_code = ComErrc::kCommunicationLinkError;
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(Return(ByMove(MakeUnexpected(error_code))));
 
     // When calling the registered method subscribed handler
@@ -884,7 +884,7 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture, CallingRegistersAMethodCallHan
     // Expecting that a method call handler is registered for both methods which calls the handler directly with the
     // largest possible queue index for that method
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(kDummyQualityType, foo_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(WithArgs<2>(Invoke([this](auto method_call_handler) {
             std::invoke(method_call_handler, test::kFooMethodQueueSize - 1U);
             return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -893,7 +893,7 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture, CallingRegistersAMethodCallHan
                                                               method_call_registration_guard_scope_);
         })));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kDummyQualityType, dumb_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(kDummyQualityType, dumb_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(WithArgs<2>(Invoke([this](auto method_call_handler) {
             std::invoke(method_call_handler, test::kDumbMethodQueueSize - 1U);
             return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -1059,13 +1059,13 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture, CallingForBothAsilAndQmDoesNot
 
     // Expecting that RegisterMethodCallHandler will be called for each method for QM and ASIL-B
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, _, _));
 
     // and given that UnregisterMethodCallHandler flips a flag so we can verify that it is not called
     auto unregister_called = std::make_shared<bool>(false);
@@ -1099,9 +1099,9 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture, CallingWillUnregisterRegistere
 
     // Expecting that RegisterMethodCallHandler will be called for each method which fails on the second call
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, foo_proxy_method_identifier_qm_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, _))
+                RegisterMethodCallHandler(QualityType::kASIL_QM, dumb_proxy_method_identifier_qm_, _, _, _))
         .WillOnce(Return(ByMove(MakeUnexpected(ComErrc::kBindingFailure))));
 
     // Expecting that UnregisterMethodCallHandler will be called only for the method which was successfully registered
@@ -1127,9 +1127,9 @@ TEST_F(SkeletonOnServiceMethodsSubscribedFixture,
 
     // Expecting that RegisterMethodCallHandler will be called for each method which fails on the second call
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, foo_proxy_method_identifier_b_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, _))
+                RegisterMethodCallHandler(QualityType::kASIL_B, dumb_proxy_method_identifier_b_, _, _, _))
         .WillOnce(Return(ByMove(MakeUnexpected(ComErrc::kBindingFailure))));
 
     // Expecting that UnregisterMethodCallHandler will be called only for the method which was successfully registered
@@ -88,7 +88,7 @@ class SkeletonMethodFixture : public SkeletonMockedMemoryFixture
     {
         InitialiseSkeleton(config_store_.GetInstanceIdentifier());
 
-        ON_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _))
+        ON_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _, _))
             .WillByDefault(WithArgs<0, 1>(Invoke(
                 [this](auto asil_level, auto proxy_method_instance_identifier) -> Result<MethodCallRegistrationGuard> {
                     return MethodCallRegistrationGuardFactory::Create(message_passing_mock_,
@@ -113,7 +113,7 @@ class SkeletonMethodFixture : public SkeletonMockedMemoryFixture
 
     SkeletonMethodFixture& WhichCapturesRegisteredMethodCallHandler()
     {
-        EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _))
+        EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _, _))
             .WillOnce(WithArgs<0, 1, 2>(Invoke([this](auto asil_level,
                                                       auto proxy_method_instance_identifier,
                                                       auto method_call_handler) -> Result<MethodCallRegistrationGuard> {
@@ -180,7 +180,7 @@ TEST_F(SkeletonMethodOnProxyMethodSubscribedFixture, CallingRegistersCallbackWit
     // OnProxyMethoSubscribeFinished.
     const auto asil_level = QualityType::kASIL_B;
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(asil_level, proxy_method_instance_identifier_, _, kAllowedProxyUid));
+                RegisterMethodCallHandler(asil_level, proxy_method_instance_identifier_, _, kAllowedProxyUid, _));
 
     // When calling OnProxyMethodSubscribeFinished with a registered callback
     const auto result = unit_->OnProxyMethodSubscribeFinished(kTypeErasedInfoWithInArgsAndReturn,
@@ -204,7 +204,7 @@ TEST_F(SkeletonMethodOnProxyMethodSubscribedFixture, CallingRegistersRegisteredC
     // registered callback. We check this by calling the subscribed callback and checking that the registered
     // callback was called.
     EXPECT_CALL(registered_type_erased_callback_, Call(_, _));
-    EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _))
+    EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, _, _, _, _))
         .WillOnce(WithArgs<0, 1, 2>(Invoke([this](auto asil_level,
                                                   auto proxy_method_instance_identifier,
                                                   auto method_call_handler) -> Result<MethodCallRegistrationGuard> {
@@ -235,7 +235,7 @@ TEST_F(SkeletonMethodOnProxyMethodSubscribedFixture, PropagatesErrorFromMessageP
 
     // Expecting that RegisterMethodCallHandler will be called on message passing which returns an error.
     const auto error_code = ComErrc::kCallQueueFull;
-    EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, proxy_method_instance_identifier_, _, _))
+    EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(_, proxy_method_instance_identifier_, _, _, _))
         .WillOnce(Return(ByMove(MakeUnexpected(error_code))));
 
     // When calling OnProxyMethodSubscribeFinished with a registered callback
@@ -280,7 +280,7 @@ TEST_F(SkeletonMethodOnProxyMethodSubscribedFixture, CallingWillNotCallUnregiste
     // Expecting that RegisterMethodCallHandler will be called on message passing for each call to
     // OnProxyMethodSubscribeFinished
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _, _));
 
     // And expecting that UnregisterMethodCallHandler will NOT be called
     EXPECT_CALL(message_passing_mock_, UnregisterMethodCallHandler(_, _)).Times(0);
@@ -305,9 +305,9 @@ TEST_F(SkeletonMethodOnProxyMethodSubscribedFixture, UnregisterWillBeCalledOnAll
     // Expecting that RegisterMethodCallHandler will be called on message passing for each call to
     // OnProxyMethodSubscribeFinished
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2_, _, _, _));
 
     // And expecting that UnregisterMethodCallHandler will be called for each registered handler
     EXPECT_CALL(message_passing_mock_,
@@ -351,9 +351,9 @@ TEST_F(SkeletonMethodUnregisterHandlersFixture, CallingWillUnregisterAllHandlers
     // Expecting that RegisterMethodCallHandler will be called on message passing for each call to
     // OnProxyMethodSubscribeFinished
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2, _, _, _));
 
     // And expecting that UnregisterMethodCallHandler will be called for each registered handler
     EXPECT_CALL(message_passing_mock_,
@@ -398,9 +398,9 @@ TEST_F(SkeletonMethodOnProxyMethodUnsubscribedFixture, CallingWillUnregisterHand
     // Expecting that RegisterMethodCallHandler will be called on message passing for each call to
     // OnProxyMethodSubscribeFinished
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_B, proxy_method_instance_identifier_2, _, _, _));
 
     // And expecting that UnregisterMethodCallHandler will only be called for the handler corresponding to
     // proxy_method_instance_identifier_
@@ -647,7 +647,7 @@ TEST_F(SkeletonMethodOnProxyMethodUnsubscribeFinishedFixture, CallingTwiceWithSa
     GivenASkeletonMethod().WithARegisteredCallback();
 
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _));
+                RegisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_, _, _, _));
     EXPECT_CALL(message_passing_mock_,
                 UnregisterMethodCallHandler(QualityType::kASIL_QM, proxy_method_instance_identifier_))
         .Times(1);  // Must fire exactly once — not on the second UnsubscribeFinished call
@@ -682,9 +682,10 @@ TEST_F(SkeletonMethodOnProxyMethodUnsubscribeFinishedFixture,
 
     GivenASkeletonMethod().WithARegisteredCallback();
 
-    EXPECT_CALL(message_passing_mock_, RegisterMethodCallHandler(kAsilLevel, proxy_method_instance_identifier_, _, _));
     EXPECT_CALL(message_passing_mock_,
-                RegisterMethodCallHandler(kAsilLevel, proxy_method_instance_identifier_same_app, _, _));
+                RegisterMethodCallHandler(kAsilLevel, proxy_method_instance_identifier_, _, _, _));
+    EXPECT_CALL(message_passing_mock_,
+                RegisterMethodCallHandler(kAsilLevel, proxy_method_instance_identifier_same_app, _, _, _));
 
     // The first proxy's handler is removed by OnProxyMethodUnsubscribeFinished — must not fire on destruction
     EXPECT_CALL(message_passing_mock_, UnregisterMethodCallHandler(kAsilLevel, proxy_method_instance_identifier_))
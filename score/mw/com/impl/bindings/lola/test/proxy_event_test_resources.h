@@ -137,8 +137,10 @@ class LolaRuntimeMock : public IRuntime
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(IServiceDiscoveryClient&, GetServiceDiscoveryClient, (), (ref(&), noexcept, override));
     MOCK_METHOD(ShmSizeCalculationMode, GetShmSizeCalculationMode, (), (const, noexcept, override));
+    MOCK_METHOD(ShmPrefaultMode, GetShmPrefaultMode, (), (const, noexcept, override));
     MOCK_METHOD(impl::tracing::IBindingTracingRuntime*, GetTracingRuntime, (), (noexcept, override));
     MOCK_METHOD(RollbackSynchronization&, GetRollbackSynchronization, (), (ref(&), noexcept, override));
+    MOCK_METHOD(DeadlineMonitor&, GetDeadlineMonitor, (), (ref(&), noexcept, override));
     MOCK_METHOD(pid_t, GetPid, (), (const, noexcept, override));
     MOCK_METHOD(std::uint32_t, GetApplicationId, (), (const, noexcept, override));
 
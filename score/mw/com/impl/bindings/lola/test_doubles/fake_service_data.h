@@ -96,6 +96,7 @@ inline std::tuple<EventControl*, EventDataStorage<SampleType>*> FakeServiceData:
                                               std::forward_as_tuple(event_properties.number_of_slots,
                                                                     event_properties.max_subscribers,
                                                                     event_properties.enforce_max_samples,
+                                                                    event_properties.subscription_control_width,
                                                                     *control_memory));
     auto& event_control = std::get<EventControl>(*inserted_control);
 
@@ -71,6 +71,8 @@ TracingRuntime::TracingRuntime(const SamplePointerIndex number_of_needed_tracing
       next_available_position_for_new_service_element_range_start_{0U},
       shm_object_handle_map_{},
       failed_shm_object_registration_cache_{},
+      shm_trace_handles_{number_of_needed_tracing_slots},
+      shm_object_registration_generation_{0U},
       receive_handler_scope_{}
 {
 }
@@ -198,12 +200,14 @@ void TracingRuntime::RegisterShmObject(
                                          << "into map. Terminating.";
         std::terminate();
     }
+    shm_object_registration_generation_.fetch_add(1U);
 }
 
 void TracingRuntime::UnregisterShmObject(
     const impl::tracing::ServiceElementInstanceIdentifierView& service_element_instance_identifier_view) noexcept
 {
     const auto erase_result = shm_object_handle_map_.erase(service_element_instance_identifier_view);
+    shm_object_registration_generation_.fetch_add(1U);
     if (erase_result == 0U)
     {
         score::mw::log::LogWarn("lola") << "UnregisterShmObject called on non-existing shared memory object. Ignoring.";
@@ -355,6 +359,38 @@ std::optional<void*> TracingRuntime::GetShmRegionStartAddress(
     return find_result->second.second;
 }
 
+auto TracingRuntime::GetShmObjectRegistrationGeneration() const noexcept -> ShmObjectRegistrationGeneration
+{
+    return shm_object_registration_generation_.load();
+}
+
+void TracingRuntime::CacheShmTraceHandle(
+    const impl::tracing::ServiceElementTracingData& service_element_tracing_data,
+    const ShmTraceHandle& shm_trace_handle,
+    const ShmObjectRegistrationGeneration shm_object_registration_generation) noexcept
+{
+    auto& cache_entry =
+        shm_trace_handles_.at(static_cast<std::size_t>(service_element_tracing_data.service_element_range_start));
+    std::lock_guard<std::mutex> lock(cache_entry.mutex);
+    cache_entry.shm_trace_handle = shm_trace_handle;
+    // The generation, in which the handle has been resolved, is stored instead of the current one. So a handle, which
+    // got outdated by a concurrent (re-)registration while it was resolved, is never returned.
+    cache_entry.shm_object_registration_generation = shm_object_registration_generation;
+}
+
+std::optional<TracingRuntime::ShmTraceHandle> TracingRuntime::GetShmTraceHandle(
+    const impl::tracing::ServiceElementTracingData& service_element_tracing_data) const noexcept
+{
+    const auto& cache_entry =
+        shm_trace_handles_.at(static_cast<std::size_t>(service_element_tracing_data.service_element_range_start));
+    std::lock_guard<std::mutex> lock(cache_entry.mutex);
+    if (cache_entry.shm_object_registration_generation != shm_object_registration_generation_.load())
+    {
+        return {};
+    }
+    return cache_entry.shm_trace_handle;
+}
+
 bool TracingRuntime::IsTracingSlotUsed(const TraceContextId trace_context_id) noexcept
 {
     auto& element = type_erased_sample_ptrs_.at(static_cast<std::size_t>(trace_context_id));
@@ -23,7 +23,9 @@
 #include "score/language/safecpp/scoped_function/scope.h"
 #include "score/memory/shared/i_shared_memory_resource.h"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <optional>
 #include <string_view>
@@ -125,6 +127,16 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
         const impl::tracing::ServiceElementInstanceIdentifierView service_element_instance_identifier_view)
         const noexcept override;
 
+    ShmObjectRegistrationGeneration GetShmObjectRegistrationGeneration() const noexcept override;
+
+    void CacheShmTraceHandle(
+        const impl::tracing::ServiceElementTracingData& service_element_tracing_data,
+        const ShmTraceHandle& shm_trace_handle,
+        const ShmObjectRegistrationGeneration shm_object_registration_generation) noexcept override;
+
+    std::optional<ShmTraceHandle> GetShmTraceHandle(
+        const impl::tracing::ServiceElementTracingData& service_element_tracing_data) const noexcept override;
+
     /// \brief EmplaceTypeErasedSamplePtr takes a ServiceElementTracingData and returns a TraceContextId, which allows
     /// to correctly retrieve the sample ptr again. Discarding this value will make it impossible to free the sample
     /// pointer correctly. If no slots are left for the service element then no TraceContextId can be returned, thus the
@@ -153,6 +165,18 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
         std::mutex mutex;
     };
 
+    /// \brief Helper struct which contains the ShmTraceHandle cached for a service element, the generation of the
+    ///        shm-object registrations it has been resolved in and a mutex which is used to protect access to both.
+    struct ShmTraceHandleCacheEntry
+    {
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        std::optional<ShmTraceHandle> shm_trace_handle{};
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        ShmObjectRegistrationGeneration shm_object_registration_generation{0U};
+        // coverity[autosar_cpp14_m11_0_1_violation]
+        mutable std::mutex mutex;
+    };
+
     /// \brief Helper struct which stores the start and end TraceContextIds of a contiguous range of TraceContextIds
     struct TraceContextIdContiguousRange
     {
@@ -188,6 +212,14 @@ class TracingRuntime : public impl::tracing::IBindingTracingRuntime
                        std::pair<memory::shared::ISharedMemoryResource::FileDescriptor, void*>>
         failed_shm_object_registration_cache_;
 
+    /// \brief Cached ShmTraceHandles indexed by the range start of the service element, which is unique as every
+    ///        registered service element has at least one tracing slot.
+    score::containers::DynamicArray<ShmTraceHandleCacheEntry> shm_trace_handles_;
+
+    /// \brief Incremented on every (re-)registration or unregistration of a shm-object. A cached ShmTraceHandle is
+    ///        only valid, as long as this generation didn't change since it has been cached.
+    std::atomic<ShmObjectRegistrationGeneration> shm_object_registration_generation_;
+
     /// \brief Ensure that the associated scoped function called only as long as the scope is not expired.
     /// \details The scope is used for the callback registered with RegisterTraceDoneCB.
     safecpp::Scope<> receive_handler_scope_;
@@ -646,6 +646,102 @@ TEST_F(TracingRuntimeShmObjectHandleDeathTest, CallingRegisterShmObjectTwiceForT
         ".*");
 }
 
+class TracingRuntimeShmTraceHandleFixture : public TracingRuntimeFixture
+{
+  public:
+    const ServiceInstanceElement service_instance_element_{
+        25U, 1U, 0U, 1U, ServiceInstanceElement::StdVariantType{ServiceInstanceElement::EventId{3U}}};
+    const TracingRuntime::ShmTraceHandle shm_trace_handle_{kShmObjectHandle0,
+                                                           kStartAddress0,
+                                                           service_instance_element_};
+};
+
+TEST_F(TracingRuntimeShmTraceHandleFixture, GettingShmTraceHandleAfterCachingReturnsHandle)
+{
+    // Given a TracingRuntimeObject with a registered service element and shm object
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    tracing_runtime_.RegisterShmObject(kServiceElementInstanceIdentifier0, kShmObjectHandle0, kStartAddress0);
+
+    // When caching a ShmTraceHandle for the service element
+    tracing_runtime_.CacheShmTraceHandle(
+        service_element_tracing_data, shm_trace_handle_, tracing_runtime_.GetShmObjectRegistrationGeneration());
+
+    // Then getting the ShmTraceHandle returns the cached handle
+    const auto returned_handle = tracing_runtime_.GetShmTraceHandle(service_element_tracing_data);
+    ASSERT_TRUE(returned_handle.has_value());
+    EXPECT_EQ(returned_handle.value().shm_object_handle, kShmObjectHandle0);
+    EXPECT_EQ(returned_handle.value().shm_region_start, kStartAddress0);
+    EXPECT_EQ(returned_handle.value().service_instance_element, service_instance_element_);
+}
+
+TEST_F(TracingRuntimeShmTraceHandleFixture, GettingShmTraceHandleWithoutCachingReturnsEmpty)
+{
+    // Given a TracingRuntimeObject with two registered service elements
+    const auto service_element_tracing_data_0 =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    const auto service_element_tracing_data_1 =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+
+    // When caching a ShmTraceHandle only for the first service element
+    tracing_runtime_.CacheShmTraceHandle(
+        service_element_tracing_data_0, shm_trace_handle_, tracing_runtime_.GetShmObjectRegistrationGeneration());
+
+    // Then getting the ShmTraceHandle for the second service element returns an empty optional
+    EXPECT_FALSE(tracing_runtime_.GetShmTraceHandle(service_element_tracing_data_1).has_value());
+}
+
+TEST_F(TracingRuntimeShmTraceHandleFixture, GettingShmTraceHandleAfterUnregisteringShmObjectReturnsEmpty)
+{
+    // Given a TracingRuntimeObject with a cached ShmTraceHandle for a registered service element
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    tracing_runtime_.RegisterShmObject(kServiceElementInstanceIdentifier0, kShmObjectHandle0, kStartAddress0);
+    tracing_runtime_.CacheShmTraceHandle(
+        service_element_tracing_data, shm_trace_handle_, tracing_runtime_.GetShmObjectRegistrationGeneration());
+
+    // When unregistering the shm object
+    tracing_runtime_.UnregisterShmObject(kServiceElementInstanceIdentifier0);
+
+    // Then getting the ShmTraceHandle returns an empty optional
+    EXPECT_FALSE(tracing_runtime_.GetShmTraceHandle(service_element_tracing_data).has_value());
+}
+
+TEST_F(TracingRuntimeShmTraceHandleFixture, GettingShmTraceHandleAfterRegisteringAnotherShmObjectReturnsEmpty)
+{
+    // Given a TracingRuntimeObject with a cached ShmTraceHandle for a registered service element
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    tracing_runtime_.RegisterShmObject(kServiceElementInstanceIdentifier0, kShmObjectHandle0, kStartAddress0);
+    tracing_runtime_.CacheShmTraceHandle(
+        service_element_tracing_data, shm_trace_handle_, tracing_runtime_.GetShmObjectRegistrationGeneration());
+
+    // When registering another shm object
+    tracing_runtime_.RegisterShmObject(kServiceElementInstanceIdentifier1, kShmObjectHandle1, kStartAddress1);
+
+    // Then getting the ShmTraceHandle returns an empty optional, so that it gets resolved again
+    EXPECT_FALSE(tracing_runtime_.GetShmTraceHandle(service_element_tracing_data).has_value());
+}
+
+TEST_F(TracingRuntimeShmTraceHandleFixture, CachingShmTraceHandleResolvedBeforeUnregisteringShmObjectIsIgnored)
+{
+    // Given a TracingRuntimeObject with a registered service element and shm object
+    const auto service_element_tracing_data =
+        tracing_runtime_.RegisterServiceElement(kFakeNumberOfIpcTracingSlotsPerServiceElement);
+    tracing_runtime_.RegisterShmObject(kServiceElementInstanceIdentifier0, kShmObjectHandle0, kStartAddress0);
+
+    // and a ShmTraceHandle, which is resolved before the shm object gets unregistered
+    const auto shm_object_registration_generation = tracing_runtime_.GetShmObjectRegistrationGeneration();
+    tracing_runtime_.UnregisterShmObject(kServiceElementInstanceIdentifier0);
+
+    // When caching the ShmTraceHandle afterwards
+    tracing_runtime_.CacheShmTraceHandle(
+        service_element_tracing_data, shm_trace_handle_, shm_object_registration_generation);
+
+    // Then getting the ShmTraceHandle returns an empty optional, as the handle is outdated
+    EXPECT_FALSE(tracing_runtime_.GetShmTraceHandle(service_element_tracing_data).has_value());
+}
+
 using TracingRuntimeCachedFileDescriptorFixture = TracingRuntimeFixture;
 TEST_F(TracingRuntimeCachedFileDescriptorFixture, GettingFileDescriptorAfterCachingReturnsFileDescriptor)
 {
@@ -16,8 +16,13 @@ namespace score::mw::com::impl::lola
 {
 
 TransactionLog::TransactionLog(const std::size_t number_of_slots,
-                               memory::shared::ManagedMemoryResource& resource) noexcept
-    : reference_count_slots_(number_of_slots, resource), subscribe_transactions_{}, subscription_max_sample_count_{}
+                               memory::shared::ManagedMemoryResource& resource,
+                               const bool with_sample_leases) noexcept
+    : reference_count_slots_(number_of_slots, resource), subscribe_transactions_{},
+      subscription_max_sample_count_{},
+      dirty_reference_slot_count_{0U},
+      sample_leases_(with_sample_leases ? number_of_slots : 0U, SampleLease{kSampleLeaseFree}, resource),
+      degraded_{false}
 {
 }
 
@@ -14,11 +14,13 @@
 #define SCORE_MW_COM_IMPL_BINDINGS_LOLA_TRANSACTION_LOG_H
 
 #include "score/mw/com/impl/bindings/lola/transaction_log_slot.h"
+#include "score/mw/com/impl/util/copyable_atomic.h"
 
 #include "score/containers/dynamic_array.h"
 #include "score/memory/shared/polymorphic_offset_ptr_allocator.h"
 
 #include <cstdint>
+#include <limits>
 #include <optional>
 
 namespace score::mw::com::impl::lola
@@ -42,8 +44,20 @@ class TransactionLog
     using TransactionLogSlots =
         score::containers::DynamicArray<TransactionLogSlot,
                                         memory::shared::PolymorphicOffsetPtrAllocator<TransactionLogSlot>>;
+    using SampleLease = CopyableAtomic<std::uint64_t>;
+    using SampleLeases =
+        score::containers::DynamicArray<SampleLease, memory::shared::PolymorphicOffsetPtrAllocator<SampleLease>>;
 
-    TransactionLog(const std::size_t number_of_slots, memory::shared::ManagedMemoryResource& resource) noexcept;
+    /// \brief Value of a sample lease, which is not held, i.e. the slot is not referenced by this log.
+    static constexpr std::uint64_t kSampleLeaseFree{0U};
+    /// \brief Value of a sample lease, whose reference has already been released by the provider.
+    static constexpr std::uint64_t kSampleLeaseRevoked{std::numeric_limits<std::uint64_t>::max()};
+
+    /// \param with_sample_leases true, if the provider limits the time a consumer may hold a sample and therefore a
+    ///        sample lease has to be recorded for each reference.
+    TransactionLog(const std::size_t number_of_slots,
+                   memory::shared::ManagedMemoryResource& resource,
+                   const bool with_sample_leases = false) noexcept;
 
     /// \brief Vector containing one TransactionLogSlot for each slot in the corresponding control vector.
     TransactionLogSlots reference_count_slots_;
@@ -55,6 +69,32 @@ class TransactionLog
     ///
     /// This is set in SubscribeTransactionBegin() and used in the UnsubscribeCallback which is called during Rollback()
     std::optional<MaxSampleCountType> subscription_max_sample_count_;
+
+    /// \brief Dirty counter: Upper bound of the number of reference_count_slots_, which contain an unfinished
+    ///        reference transaction.
+    ///
+    /// It is incremented before the begin flag of a slot gets set and decremented after the end flag of a slot got
+    /// cleared. Therefore, even if the process crashes at any point, it is never smaller than the number of slots, which
+    /// need a rollback. A value of 0 allows Rollback() and ContainsTransactions() to skip the scan over all slots and a
+    /// value > 0 allows the rollback scan to stop as soon as all dirty slots have been rolled back. So the rollback
+    /// effort of a log is proportional to its outstanding references instead of the number of slots.
+    CopyableAtomic<std::uint32_t> dirty_reference_slot_count_;
+
+    /// \brief Sample leases: One per slot in reference_count_slots_, if the log was created with sample leases, empty
+    ///        otherwise.
+    ///
+    /// A lease holds the time (see GetCurrentSendTime()), when the consumer referenced the slot, or kSampleLeaseFree.
+    /// If the provider finds a lease older than the configured maximum sample hold time, it may revoke it by setting
+    /// it to kSampleLeaseRevoked and release the reference of the slot on behalf of the consumer. Consumer and provider
+    /// both atomically exchange the lease before they decrement the reference count of the slot, so that the reference
+    /// is released exactly once, even though the consumer is still alive and may drop its sample at any time.
+    SampleLeases sample_leases_;
+
+    /// \brief Set by the provider, when it found a sample lease of this log, which exceeded the maximum sample hold
+    ///        time. Cleared, when the log gets unregistered.
+    /// \details The flag is only used for logging: the provider logs a consumer, when it gets degraded, and not again
+    ///          on every further check. It isn't exposed to the consumer, i.e. a degraded proxy behaves as before.
+    CopyableAtomic<bool> degraded_;
 };
 
 }  // namespace score::mw::com::impl::lola
@@ -66,7 +66,10 @@ TransactionLogLocalView::TransactionLogLocalView(TransactionLog& transaction_log
     : reference_count_slots_local_{transaction_log.reference_count_slots_.data(),
                                    transaction_log.reference_count_slots_.size()},
       subscribe_transactions_{transaction_log.subscribe_transactions_},
-      subscription_max_sample_count_{transaction_log.subscription_max_sample_count_}
+      subscription_max_sample_count_{transaction_log.subscription_max_sample_count_},
+      dirty_reference_slot_count_{transaction_log.dirty_reference_slot_count_.GetUnderlying()},
+      sample_leases_local_{transaction_log.sample_leases_.data(), transaction_log.sample_leases_.size()},
+      degraded_{transaction_log.degraded_.GetUnderlying()}
 {
 }
 
@@ -118,6 +121,8 @@ void TransactionLogLocalView::ReferenceTransactionBegin(SlotIndexType slot_index
     TransactionLogSlot& slot = reference_count_slots_local_[static_cast<std::size_t>(slot_index)];
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!slot.GetTransactionBegin());
     WaitForTransactionEndToBecomeFalse(slot);
+    // The dirty counter has to be incremented before the slot becomes dirty, see TransactionLog.
+    dirty_reference_slot_count_.get().fetch_add(1U);
     slot.SetTransactionBegin(true);
 }
 
@@ -147,6 +152,7 @@ void TransactionLogLocalView::ReferenceTransactionAbort(SlotIndexType slot_index
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot.GetTransactionBegin());
     WaitForTransactionEndToBecomeFalse(slot);
     slot.SetTransactionBegin(false);
+    dirty_reference_slot_count_.get().fetch_sub(1U);
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
@@ -170,6 +176,105 @@ void TransactionLogLocalView::DereferenceTransactionCommit(SlotIndexType slot_in
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(!slot.GetTransactionBegin());
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot.GetTransactionEnd());
     slot.SetTransactionEnd(false);
+    // The dirty counter has to be decremented after the slot became clean, see TransactionLog.
+    dirty_reference_slot_count_.get().fetch_sub(1U);
+}
+
+void TransactionLogLocalView::StartSampleLease(SlotIndexType slot_index, const std::uint64_t now_ns) noexcept
+{
+    if (sample_leases_local_.empty())
+    {
+        return;
+    }
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot_index < sample_leases_local_.size());
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(
+        reference_count_slots_local_[static_cast<std::size_t>(slot_index)].GetTransactionEnd());
+    // A held lease must neither look free nor revoked.
+    const bool is_reserved_value{(now_ns == TransactionLog::kSampleLeaseFree) ||
+                                 (now_ns == TransactionLog::kSampleLeaseRevoked)};
+    const auto lease_start = is_reserved_value ? std::uint64_t{1U} : now_ns;
+    sample_leases_local_[static_cast<std::size_t>(slot_index)].GetUnderlying().store(lease_start);
+}
+
+bool TransactionLogLocalView::EndSampleLease(SlotIndexType slot_index) noexcept
+{
+    if (sample_leases_local_.empty())
+    {
+        return true;
+    }
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot_index < sample_leases_local_.size());
+    const auto previous_lease = sample_leases_local_[static_cast<std::size_t>(slot_index)].GetUnderlying().exchange(
+        TransactionLog::kSampleLeaseFree);
+    if (previous_lease == TransactionLog::kSampleLeaseRevoked)
+    {
+        score::mw::log::LogWarn("lola") << "Sample in slot " << slot_index
+                                        << " was held longer than the maximum sample hold time. Its reference has "
+                                           "already been released by the provider and its data may have been "
+                                           "overwritten while it was in use.";
+        return false;
+    }
+    return true;
+}
+
+bool TransactionLogLocalView::IsSampleLeaseRevoked(SlotIndexType slot_index) const noexcept
+{
+    if (sample_leases_local_.empty())
+    {
+        return false;
+    }
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION(slot_index < sample_leases_local_.size());
+    return sample_leases_local_[static_cast<std::size_t>(slot_index)].GetUnderlying().load() ==
+           TransactionLog::kSampleLeaseRevoked;
+}
+
+std::size_t TransactionLogLocalView::CountExpiredSampleLeases(const std::uint64_t expiry_ns) const noexcept
+{
+    std::size_t expired_lease_count{0U};
+    for (const auto& sample_lease : sample_leases_local_)
+    {
+        const auto lease_start = sample_lease.GetUnderlying().load();
+        if ((lease_start != TransactionLog::kSampleLeaseFree) && (lease_start != TransactionLog::kSampleLeaseRevoked) &&
+            (lease_start < expiry_ns))
+        {
+            ++expired_lease_count;
+        }
+    }
+    return expired_lease_count;
+}
+
+std::size_t TransactionLogLocalView::RevokeExpiredSampleLeases(
+    const std::uint64_t expiry_ns,
+    const DereferenceSlotCallback& dereference_slot_callback) noexcept
+{
+    std::size_t revoked_lease_count{0U};
+    for (std::size_t slot_idx = 0U; slot_idx < sample_leases_local_.size(); ++slot_idx)
+    {
+        auto& sample_lease = sample_leases_local_[slot_idx].GetUnderlying();
+        auto lease_start = sample_lease.load();
+        if ((lease_start == TransactionLog::kSampleLeaseFree) || (lease_start == TransactionLog::kSampleLeaseRevoked) ||
+            (lease_start >= expiry_ns))
+        {
+            continue;
+        }
+        // If the exchange fails, the consumer ended (and maybe restarted) the lease concurrently and is therefore still
+        // responsible for the reference.
+        if (sample_lease.compare_exchange_strong(lease_start, TransactionLog::kSampleLeaseRevoked))
+        {
+            dereference_slot_callback(static_cast<SlotIndexType>(slot_idx));
+            ++revoked_lease_count;
+        }
+    }
+    return revoked_lease_count;
+}
+
+bool TransactionLogLocalView::MarkDegraded() noexcept
+{
+    return !degraded_.get().exchange(true);
+}
+
+bool TransactionLogLocalView::IsDegraded() const noexcept
+{
+    return degraded_.get().load();
 }
 
 Result<void> TransactionLogLocalView::RollbackProxyElementLog(const DereferenceSlotCallback& dereference_slot_callback,
@@ -180,7 +285,7 @@ Result<void> TransactionLogLocalView::RollbackProxyElementLog(const DereferenceS
     if (was_no_subscribe_recorded)
     {
         SCORE_LANGUAGE_FUTURECPP_PRECONDITION_MESSAGE(
-            !DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_),
+            !ContainsReferenceTransactions(),
             "All slot increment transactions should be reversed before calling unsubscribe");
     }
 
@@ -209,7 +314,12 @@ Result<void> TransactionLogLocalView::RollbackSkeletonTracingElementLog(
 Result<void> TransactionLogLocalView::RollbackIncrementTransactions(
     const DereferenceSlotCallback& dereference_slot_callback) noexcept
 {
-    for (SlotIndexType slot_idx = 0U; slot_idx < reference_count_slots_local_.size(); ++slot_idx)
+    // Fast path: A clean log doesn't need to be scanned at all. Every successful rollback of a slot below decrements
+    // the dirty counter (via DereferenceTransactionCommit), so the scan also stops as soon as all outstanding
+    // references have been rolled back.
+    auto& dirty_reference_slot_count = dirty_reference_slot_count_.get();
+    SlotIndexType slot_idx{0U};
+    for (; (slot_idx < reference_count_slots_local_.size()) && (dirty_reference_slot_count.load() != 0U); ++slot_idx)
     {
         TransactionLogSlot& slot = reference_count_slots_local_[static_cast<std::size_t>(slot_idx)];
 
@@ -219,7 +329,11 @@ Result<void> TransactionLogLocalView::RollbackIncrementTransactions(
         if (was_slot_succesfully_incremented)
         {
             DereferenceTransactionBegin(slot_idx);
-            dereference_slot_callback(slot_idx);
+            // A reference, whose sample lease has been revoked, has already been released by the provider.
+            if (EndSampleLease(slot_idx))
+            {
+                dereference_slot_callback(slot_idx);
+            }
             DereferenceTransactionCommit(slot_idx);
         }
         else if (did_program_crash_while_incrementing_slot)
@@ -237,6 +351,13 @@ Result<void> TransactionLogLocalView::RollbackIncrementTransactions(
             return MakeUnexpected(ComErrc::kCouldNotRestartProxy);
         }
     }
+
+    // If the previous process crashed between incrementing the dirty counter and setting the begin flag of a slot, the
+    // counter is larger than the number of dirty slots. After a full scan without findings, it can safely be cleared.
+    if (slot_idx == reference_count_slots_local_.size())
+    {
+        dirty_reference_slot_count.store(0U);
+    }
     return {};
 }
 
@@ -274,8 +395,16 @@ bool TransactionLogLocalView::ContainsTransactions() const noexcept
 {
     const bool contains_subscribe_transaction =
         subscribe_transactions_.get().GetTransactionBegin() || subscribe_transactions_.get().GetTransactionEnd();
-    return contains_subscribe_transaction ||
-           DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_);
+    return contains_subscribe_transaction || ContainsReferenceTransactions();
+}
+
+bool TransactionLogLocalView::ContainsReferenceTransactions() const noexcept
+{
+    if (dirty_reference_slot_count_.get().load() == 0U)
+    {
+        return false;
+    }
+    return DoesLogContainIncrementOrDecrementTransactions(reference_count_slots_local_);
 }
 
 }  // namespace score::mw::com::impl::lola
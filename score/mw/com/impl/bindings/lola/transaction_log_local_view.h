@@ -24,6 +24,7 @@
 #include <score/callback.hpp>
 #include <score/span.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <optional>
 
@@ -35,6 +36,7 @@ class TransactionLogLocalView
 {
   public:
     using TransactionLogSlotsLocalView = score::cpp::span<TransactionLog::TransactionLogSlots::value_type>;
+    using SampleLeasesLocalView = score::cpp::span<TransactionLog::SampleLeases::value_type>;
 
     /// \brief Callbacks called during Roll back
     ///
@@ -72,6 +74,46 @@ class TransactionLogLocalView
     void DereferenceTransactionBegin(SlotIndexType slot_index) noexcept;
     void DereferenceTransactionCommit(SlotIndexType slot_index) noexcept;
 
+    /// \brief Whether the TransactionLog records sample leases, i.e. the provider limits the sample hold time.
+    bool HasSampleLeases() const noexcept
+    {
+        return !sample_leases_local_.empty();
+    }
+
+    /// \brief Records the time at which the slot has been referenced. Has to be called after a successful
+    ///        ReferenceTransactionCommit(). Does nothing, if the TransactionLog has no sample leases.
+    void StartSampleLease(SlotIndexType slot_index, std::uint64_t now_ns) noexcept;
+
+    /// \brief Ends the sample lease of a referenced slot. Has to be called before the reference count of the slot gets
+    ///        decremented.
+    /// \return false, if the provider already revoked the lease and released the reference of the slot on behalf of
+    ///         the consumer. In this case, the reference count must not be decremented again. true otherwise (also if
+    ///         the TransactionLog has no sample leases).
+    bool EndSampleLease(SlotIndexType slot_index) noexcept;
+
+    /// \brief Checks, whether the provider revoked the sample lease for a slot, which is still referenced by the
+    ///        consumer. Such a slot can't be referenced again by the consumer, until it dropped its old reference.
+    bool IsSampleLeaseRevoked(SlotIndexType slot_index) const noexcept;
+
+    /// \brief Returns the number of sample leases, which have been started before expiry_ns and are still held.
+    std::size_t CountExpiredSampleLeases(std::uint64_t expiry_ns) const noexcept;
+
+    /// \brief Revokes all sample leases, which have been started before expiry_ns and are still held, and calls
+    ///        dereference_slot_callback for each of them, to release the reference on behalf of the consumer.
+    /// \details Called by the provider. The consumer may end a lease concurrently. Whoever exchanges the lease value
+    ///          first, is responsible for decrementing the reference count, so that it is decremented exactly once.
+    /// \return number of revoked sample leases
+    std::size_t RevokeExpiredSampleLeases(std::uint64_t expiry_ns,
+                                          const DereferenceSlotCallback& dereference_slot_callback) noexcept;
+
+    /// \brief Marks the consumer owning the TransactionLog as degraded, i.e. it held a sample too long.
+    /// \return true, if the consumer was not yet marked as degraded.
+    bool MarkDegraded() noexcept;
+
+    /// \brief Returns, whether the consumer was marked as degraded. Only used by tests, as the degraded state is
+    ///        log-only (see TransactionLog::degraded_).
+    bool IsDegraded() const noexcept;
+
     /// \brief Rollback all previous increments and subscriptions that were recorded in the transaction log.
     /// \param dereference_slot_callback Callback which will decrement the slot in EventDataControl with the provided
     ///        index.
@@ -102,6 +144,10 @@ class TransactionLogLocalView
     Result<void> RollbackIncrementTransactions(const DereferenceSlotCallback& dereference_slot_callback) noexcept;
     Result<void> RollbackSubscribeTransactions(const UnsubscribeCallback& unsubscribe_callback) noexcept;
 
+    /// \brief Checks whether any slot contains an unfinished reference / dereference transaction.
+    /// \details Only scans the slots, if the dirty counter of the TransactionLog is not 0.
+    bool ContainsReferenceTransactions() const noexcept;
+
     /// \brief View pointing to DynamicArray containing one TransactionLogSlot for each slot in the corresponding
     /// control vector.
     TransactionLogSlotsLocalView reference_count_slots_local_;
@@ -113,6 +159,15 @@ class TransactionLogLocalView
     ///
     /// This is set in SubscribeTransactionBegin() and used in the UnsubscribeCallback which is called during Rollback()
     std::reference_wrapper<std::optional<TransactionLog::MaxSampleCountType>> subscription_max_sample_count_;
+
+    /// \brief Dirty counter of the TransactionLog. See TransactionLog::dirty_reference_slot_count_.
+    std::reference_wrapper<std::atomic<std::uint32_t>> dirty_reference_slot_count_;
+
+    /// \brief View pointing to the sample leases of the TransactionLog. Empty, if the log has no sample leases.
+    SampleLeasesLocalView sample_leases_local_;
+
+    /// \brief Degraded flag of the TransactionLog. See TransactionLog::degraded_.
+    std::reference_wrapper<std::atomic<bool>> degraded_;
 };
 
 }  // namespace score::mw::com::impl::lola
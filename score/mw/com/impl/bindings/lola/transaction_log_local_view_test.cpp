@@ -18,6 +18,9 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
+
 namespace score::mw::com::impl::lola
 {
 namespace
@@ -722,6 +725,196 @@ TEST_F(TransactionLogContainsTransactionsReferenceFixture, ReturnsFalseWhenDeref
     EXPECT_FALSE(unit_.ContainsTransactions());
 }
 
+using TransactionLogDirtyCounterFixture = TransactionLogLocalViewFixture;
+TEST_F(TransactionLogDirtyCounterFixture, DirtyCounterTracksUnfinishedReferenceTransactions)
+{
+    // Given a valid TransactionLog with no recorded transactions
+    const auto& dirty_reference_slot_count = transaction_log_.dirty_reference_slot_count_.GetUnderlying();
+    ASSERT_EQ(dirty_reference_slot_count.load(), 0U);
+
+    // When referencing two slots
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+    unit_.ReferenceTransactionBegin(kSlotIndex1);
+
+    // Then the dirty counter is incremented for each of them
+    EXPECT_EQ(dirty_reference_slot_count.load(), 2U);
+
+    // and when aborting the second reference and dereferencing the first one
+    unit_.ReferenceTransactionAbort(kSlotIndex1);
+    unit_.DereferenceTransactionBegin(kSlotIndex0);
+    EXPECT_EQ(dirty_reference_slot_count.load(), 1U);
+    unit_.DereferenceTransactionCommit(kSlotIndex0);
+
+    // Then the dirty counter is only decremented once the slots are clean again
+    EXPECT_EQ(dirty_reference_slot_count.load(), 0U);
+}
+
+TEST_F(TransactionLogDirtyCounterFixture, RollbackStopsScanningOnceAllDirtySlotsWereRolledBack)
+{
+    // Given a valid TransactionLog in which the first slot was referenced
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+
+    // and in which the last slot looks referenced without being accounted in the dirty counter (which can't happen
+    // with a consistent TransactionLog, but allows to observe, up to which slot the rollback scans)
+    auto& last_slot = transaction_log_.reference_count_slots_.at(kNumberOfSlots - 1U);
+    last_slot.SetTransactionBegin(true);
+    last_slot.SetTransactionEnd(true);
+
+    // Expecting that only the first slot will be dereferenced
+    EXPECT_CALL(dereference_slot_callback_, Call(kSlotIndex0));
+
+    // When calling rollback
+    const auto rollback_result = unit_.RollbackSkeletonTracingElementLog(GetDereferenceSlotCallbackWrapper());
+
+    // Then the result will not contain an error
+    EXPECT_TRUE(rollback_result.has_value());
+
+    // and the last slot was not visited
+    EXPECT_TRUE(last_slot.GetTransactionBegin());
+    EXPECT_EQ(transaction_log_.dirty_reference_slot_count_.GetUnderlying().load(), 0U);
+}
+
+TEST_F(TransactionLogDirtyCounterFixture, RollbackClearsDirtyCounterWhichIsLargerThanNumberOfDirtySlots)
+{
+    // Given a valid TransactionLog, whose previous owner crashed between incrementing the dirty counter and setting
+    // the begin flag of a slot
+    transaction_log_.dirty_reference_slot_count_.GetUnderlying().store(1U);
+    EXPECT_FALSE(unit_.ContainsTransactions());
+
+    // Expecting that no callback will be called
+    EXPECT_CALL(dereference_slot_callback_, Call(_)).Times(0);
+
+    // When calling rollback
+    const auto rollback_result = unit_.RollbackSkeletonTracingElementLog(GetDereferenceSlotCallbackWrapper());
+
+    // Then the result will not contain an error
+    EXPECT_TRUE(rollback_result.has_value());
+
+    // and the dirty counter is cleared after the full scan didn't find any dirty slot
+    EXPECT_EQ(transaction_log_.dirty_reference_slot_count_.GetUnderlying().load(), 0U);
+}
+
+class TransactionLogSampleLeaseFixture : public TransactionLogLocalViewFixture
+{
+  protected:
+    void ReferenceSlot(const TransactionLog::SlotIndexType slot_index, const std::uint64_t now_ns) noexcept
+    {
+        leased_unit_.ReferenceTransactionBegin(slot_index);
+        leased_unit_.ReferenceTransactionCommit(slot_index);
+        leased_unit_.StartSampleLease(slot_index, now_ns);
+    }
+
+    TransactionLog leased_transaction_log_{kNumberOfSlots, memory_resource_, true};
+    TransactionLogLocalView leased_unit_{leased_transaction_log_};
+};
+
+TEST_F(TransactionLogSampleLeaseFixture, TransactionLogHasNoSampleLeasesByDefault)
+{
+    // Given a TransactionLog created without sample leases
+    // Then its view has no sample leases
+    EXPECT_FALSE(unit_.HasSampleLeases());
+    EXPECT_TRUE(transaction_log_.sample_leases_.empty());
+
+    // and referencing and dereferencing a slot works as before
+    unit_.ReferenceTransactionBegin(kSlotIndex0);
+    unit_.ReferenceTransactionCommit(kSlotIndex0);
+    unit_.StartSampleLease(kSlotIndex0, 100U);
+    EXPECT_FALSE(unit_.IsSampleLeaseRevoked(kSlotIndex0));
+    EXPECT_EQ(unit_.CountExpiredSampleLeases(std::numeric_limits<std::uint64_t>::max()), 0U);
+    unit_.DereferenceTransactionBegin(kSlotIndex0);
+    EXPECT_TRUE(unit_.EndSampleLease(kSlotIndex0));
+    unit_.DereferenceTransactionCommit(kSlotIndex0);
+}
+
+TEST_F(TransactionLogSampleLeaseFixture, OnlyLeasesStartedBeforeExpiryAreExpired)
+{
+    // Given a TransactionLog with sample leases, in which two slots have been referenced at different times
+    ASSERT_TRUE(leased_unit_.HasSampleLeases());
+    ReferenceSlot(kSlotIndex0, 100U);
+    ReferenceSlot(kSlotIndex1, 200U);
+
+    // When counting the expired leases
+    // Then only the leases started before the expiry time are counted
+    EXPECT_EQ(leased_unit_.CountExpiredSampleLeases(100U), 0U);
+    EXPECT_EQ(leased_unit_.CountExpiredSampleLeases(150U), 1U);
+    EXPECT_EQ(leased_unit_.CountExpiredSampleLeases(250U), 2U);
+
+    // and a lease, which has been ended, is not counted anymore
+    leased_unit_.DereferenceTransactionBegin(kSlotIndex0);
+    EXPECT_TRUE(leased_unit_.EndSampleLease(kSlotIndex0));
+    leased_unit_.DereferenceTransactionCommit(kSlotIndex0);
+    EXPECT_EQ(leased_unit_.CountExpiredSampleLeases(250U), 1U);
+}
+
+TEST_F(TransactionLogSampleLeaseFixture, RevokingExpiredLeasesReleasesEachReferenceOnce)
+{
+    // Given a TransactionLog with sample leases, in which two slots have been referenced at different times
+    ReferenceSlot(kSlotIndex0, 100U);
+    ReferenceSlot(kSlotIndex1, 200U);
+
+    // Expecting that only the reference of the expired slot is released
+    EXPECT_CALL(dereference_slot_callback_, Call(kSlotIndex0));
+
+    // When revoking the expired leases twice
+    EXPECT_EQ(leased_unit_.RevokeExpiredSampleLeases(150U, GetDereferenceSlotCallbackWrapper()), 1U);
+    EXPECT_EQ(leased_unit_.RevokeExpiredSampleLeases(150U, GetDereferenceSlotCallbackWrapper()), 0U);
+
+    // Then the lease of the expired slot is revoked
+    EXPECT_TRUE(leased_unit_.IsSampleLeaseRevoked(kSlotIndex0));
+    EXPECT_FALSE(leased_unit_.IsSampleLeaseRevoked(kSlotIndex1));
+
+    // and the consumer must not decrement the revoked slot anymore, when it drops the sample
+    leased_unit_.DereferenceTransactionBegin(kSlotIndex0);
+    EXPECT_FALSE(leased_unit_.EndSampleLease(kSlotIndex0));
+    leased_unit_.DereferenceTransactionCommit(kSlotIndex0);
+    EXPECT_FALSE(leased_unit_.IsSampleLeaseRevoked(kSlotIndex0));
+
+    // while it still has to decrement the slot with the valid lease
+    leased_unit_.DereferenceTransactionBegin(kSlotIndex1);
+    EXPECT_TRUE(leased_unit_.EndSampleLease(kSlotIndex1));
+    leased_unit_.DereferenceTransactionCommit(kSlotIndex1);
+}
+
+TEST_F(TransactionLogSampleLeaseFixture, RollbackDoesNotDereferenceSlotsWithRevokedLeases)
+{
+    // Given a TransactionLog with sample leases, in which two slots have been referenced and the lease of the first
+    // one has been revoked
+    ReferenceSlot(kSlotIndex0, 100U);
+    ReferenceSlot(kSlotIndex1, 200U);
+    StrictMock<MockFunction<void(TransactionLog::SlotIndexType)>> revoke_callback{};
+    EXPECT_CALL(revoke_callback, Call(kSlotIndex0));
+    ASSERT_EQ(leased_unit_.RevokeExpiredSampleLeases(
+                  150U,
+                  [&revoke_callback](const TransactionLog::SlotIndexType slot_index) noexcept {
+                      revoke_callback.AsStdFunction()(slot_index);
+                  }),
+              1U);
+
+    // Expecting that the rollback only dereferences the slot with the valid lease
+    EXPECT_CALL(dereference_slot_callback_, Call(kSlotIndex1));
+
+    // When rolling back the TransactionLog
+    const auto rollback_result = leased_unit_.RollbackSkeletonTracingElementLog(GetDereferenceSlotCallbackWrapper());
+
+    // Then the rollback succeeds and the TransactionLog is clean
+    EXPECT_TRUE(rollback_result.has_value());
+    EXPECT_FALSE(leased_unit_.ContainsTransactions());
+}
+
+TEST_F(TransactionLogSampleLeaseFixture, MarkDegradedReportsOnlyTheFirstTransition)
+{
+    // Given a TransactionLog, which is not degraded
+    ASSERT_FALSE(leased_unit_.IsDegraded());
+
+    // When marking it as degraded twice
+    // Then only the first call reports a newly degraded log
+    EXPECT_TRUE(leased_unit_.MarkDegraded());
+    EXPECT_FALSE(leased_unit_.MarkDegraded());
+    EXPECT_TRUE(leased_unit_.IsDegraded());
+}
+
 // Test for boundary condition: ReferenceTransactionBegin should retry and terminate
 // when transaction-END bit remains TRUE after max retries (indicating stuck dereference thread).
 class ReferenceTransactionBoundaryConditionFixture : public TransactionLogLocalViewFixture
@@ -47,13 +47,17 @@ void TransactionLogSet::TransactionLogNode::Reset()
         !GetTransactionLogLocalView().ContainsTransactions(),
         "Cannot Reset TransactionLog as it still contains some old transactions.");
     needs_rollback_.GetUnderlying() = false;
+    transaction_log_.degraded_.GetUnderlying().store(false);
     Release();
 }
 
 TransactionLogSet::TransactionLogSet(const TransactionLogIndex max_number_of_logs,
                                      const std::size_t number_of_slots,
-                                     memory::shared::ManagedMemoryResource& resource)
-    : proxy_transaction_logs_(max_number_of_logs, TransactionLogNode{number_of_slots, resource}, resource),
+                                     memory::shared::ManagedMemoryResource& resource,
+                                     const bool with_sample_leases)
+    : proxy_transaction_logs_(max_number_of_logs,
+                              TransactionLogNode{number_of_slots, resource, with_sample_leases},
+                              resource),
       skeleton_tracing_transaction_log_{number_of_slots, resource}
 {
     SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
@@ -122,6 +126,45 @@ Result<void> TransactionLogSet::RollbackSkeletonTracingTransactions(
     return {};
 }
 
+TransactionLogSet::SampleLeaseCheckResult TransactionLogSet::CheckSampleLeases(
+    const std::uint64_t expiry_ns,
+    const bool force_release,
+    const TransactionLogLocalView::DereferenceSlotCallback& dereference_slot_callback) noexcept
+{
+    SampleLeaseCheckResult result{0U, 0U, 0U};
+    for (auto& transaction_log_node : proxy_transaction_logs_)
+    {
+        // A proxy may concurrently register or unregister its TransactionLog. This is fine, as an unregistered log
+        // holds no leases and leases are only ever revoked via compare-exchange.
+        // coverity[autosar_cpp14_a5_3_2_violation : FALSE] see MarkTransactionLogsNeedRollback()
+        if (!transaction_log_node.IsActive())
+        {
+            continue;
+        }
+        auto transaction_log_local_view = transaction_log_node.GetTransactionLogLocalView();
+        if (!transaction_log_local_view.HasSampleLeases())
+        {
+            continue;
+        }
+        const auto expired_references = transaction_log_local_view.CountExpiredSampleLeases(expiry_ns);
+        if (expired_references == 0U)
+        {
+            continue;
+        }
+        result.expired_references += expired_references;
+        if (transaction_log_local_view.MarkDegraded())
+        {
+            ++result.newly_degraded_logs;
+        }
+        if (force_release)
+        {
+            result.released_references +=
+                transaction_log_local_view.RevokeExpiredSampleLeases(expiry_ns, dereference_slot_callback);
+        }
+    }
+    return result;
+}
+
 score::Result<TransactionLogRegistrationGuard> TransactionLogSet::RegisterProxyElement(
     const TransactionLogId& transaction_log_id,
     ConsumerEventDataControlLocalView<>& consumer_event_data_control_local_view)
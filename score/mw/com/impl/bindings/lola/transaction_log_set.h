@@ -78,10 +78,12 @@ class TransactionLogSet
     class TransactionLogNode
     {
       public:
-        TransactionLogNode(const std::size_t number_of_slots, memory::shared::ManagedMemoryResource& resource)
+        TransactionLogNode(const std::size_t number_of_slots,
+                           memory::shared::ManagedMemoryResource& resource,
+                           const bool with_sample_leases = false)
             : needs_rollback_{false},
               transaction_log_id_{kInvalidTransactionLogId},
-              transaction_log_(number_of_slots, resource)
+              transaction_log_(number_of_slots, resource, with_sample_leases)
         {
         }
 
@@ -172,14 +174,28 @@ class TransactionLogSet
     // coverity[autosar_cpp14_a0_1_1_violation : FALSE]
     static constexpr const TransactionLogIndex kSkeletonIndexSentinel{std::numeric_limits<TransactionLogIndex>::max()};
 
+    /// \brief Outcome of CheckSampleLeases()
+    struct SampleLeaseCheckResult
+    {
+        /// \brief Number of references held by proxies longer than the maximum sample hold time.
+        std::size_t expired_references;
+        /// \brief Number of expired references, which have been released on behalf of the proxies.
+        std::size_t released_references;
+        /// \brief Number of proxy TransactionLogs, which have been marked as degraded by this check.
+        std::size_t newly_degraded_logs;
+    };
+
     /// \brief Constructor
     /// \param max_number_of_logs The maximum number of logs that can be registered via Register().
     /// \param number_of_slots number of slots each of the transaction logs within the TransactionLogSet will contain.
     ///        It is deduced by the number_of_slots, the skeleton created for the related event/field service element.
     /// \param proxy The MemoryResourceProxy that will be used by the DynamicArray of transaction logs
+    /// \param with_sample_leases true, if the proxy TransactionLogs shall record sample leases, because the skeleton
+    ///        limits the time a proxy may hold a sample. The skeleton tracing TransactionLog never has sample leases.
     TransactionLogSet(const TransactionLogIndex max_number_of_logs,
                       const std::size_t number_of_slots,
-                      memory::shared::ManagedMemoryResource& resource);
+                      memory::shared::ManagedMemoryResource& resource,
+                      const bool with_sample_leases = false);
     ~TransactionLogSet() noexcept = default;
 
     TransactionLogSet(const TransactionLogSet&) = delete;
@@ -243,6 +259,18 @@ class TransactionLogSet
     TransactionLogRegistrationGuard RegisterSkeletonTransactionLog(
         ConsumerEventDataControlLocalView<>& consumer_event_data_control_local_view);
 
+    /// \brief Checks the sample leases of all proxy TransactionLogs for references, which have been taken before
+    ///        expiry_ns and are still held.
+    ///
+    /// Every proxy TransactionLog holding such a reference gets marked as degraded. If force_release is true, the
+    /// expired references are additionally released via dereference_slot_callback, so that the skeleton can reuse the
+    /// slots. The proxy will notice this, when it drops its reference, and won't decrement the slot again.
+    /// Might be called concurrently to the proxies using their TransactionLogs.
+    SampleLeaseCheckResult CheckSampleLeases(const std::uint64_t expiry_ns,
+                                             const bool force_release,
+                                             const TransactionLogLocalView::DereferenceSlotCallback&
+                                                 dereference_slot_callback) noexcept;
+
     /// \brief Returns a reference to a TransactionLog corresponding to the provided index.
     ///
     /// Must not be called concurrently with Unregister() with the same transaction_log_index.
@@ -24,6 +24,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -428,6 +430,81 @@ TEST_F(TransactionLogSetRollbackFixture,
     EXPECT_TRUE(TransactionLogSetAttorney{*unit_}.GetSkeletonTransactionLog().has_value());
 }
 
+using TransactionLogSetSampleLeaseFixture = TransactionLogSetFixture;
+TEST_F(TransactionLogSetSampleLeaseFixture, CheckingSampleLeasesWithoutLeasesDoesNothing)
+{
+    // Since the registered TransactionLog still contains transactions at the end of the test, we need to disable the
+    // guard's destructor from doing any operations to avoid a crash.
+    TransactionLogRegistrationGuardDeactiveDestructionOperationGuard guard{};
+
+    const TransactionLog::SlotIndexType slot_index{1U};
+
+    // Given a TransactionLogSet without sample leases, with a proxy referencing a slot
+    WithATransactionLogSet(kNumberOfLogs);
+    const auto transaction_log_registration_guard =
+        RegisterProxyElementWithSubscribeAndReferenceTransactions(kDummyTransactionLogId, slot_index);
+
+    // Expecting that no reference is released
+    EXPECT_CALL(dereference_slot_callback_, Call(_)).Times(0);
+
+    // When checking the sample leases with force release
+    const auto result = unit_->CheckSampleLeases(
+        std::numeric_limits<std::uint64_t>::max() - 1U, true, GetDereferenceSlotCallbackWrapper());
+
+    // Then nothing is expired
+    EXPECT_EQ(result.expired_references, 0U);
+    EXPECT_EQ(result.released_references, 0U);
+    EXPECT_EQ(result.newly_degraded_logs, 0U);
+}
+
+TEST_F(TransactionLogSetSampleLeaseFixture, CheckingSampleLeasesMarksStalledProxyAsDegradedAndForceReleasesOnce)
+{
+    // Since the registered TransactionLog still contains transactions at the end of the test, we need to disable the
+    // guard's destructor from doing any operations to avoid a crash.
+    TransactionLogRegistrationGuardDeactiveDestructionOperationGuard guard{};
+
+    const TransactionLog::SlotIndexType slot_index{1U};
+
+    // Given a TransactionLogSet with sample leases, with a proxy, which referenced a slot at time 100
+    unit_ = std::make_unique<TransactionLogSet>(kNumberOfLogs, kDummyNumberOfSlots, memory_resource_, true);
+    const auto transaction_log_registration_guard =
+        RegisterProxyElementWithSubscribeAndReferenceTransactions(kDummyTransactionLogId, slot_index);
+    TransactionLogLocalView transaction_log_local_view =
+        unit_->GetTransactionLog(transaction_log_registration_guard.GetTransactionLogIndex());
+    transaction_log_local_view.StartSampleLease(slot_index, 100U);
+
+    // When checking the sample leases with an expiry time before the reference
+    const auto unexpired_result = unit_->CheckSampleLeases(100U, true, GetDereferenceSlotCallbackWrapper());
+
+    // Then nothing is expired
+    EXPECT_EQ(unexpired_result.expired_references, 0U);
+    EXPECT_FALSE(transaction_log_local_view.IsDegraded());
+
+    // and when checking them with an expiry time after the reference, without force release
+    const auto degraded_result = unit_->CheckSampleLeases(150U, false, GetDereferenceSlotCallbackWrapper());
+
+    // Then the proxy is marked as degraded, but its reference is kept
+    EXPECT_EQ(degraded_result.expired_references, 1U);
+    EXPECT_EQ(degraded_result.released_references, 0U);
+    EXPECT_EQ(degraded_result.newly_degraded_logs, 1U);
+    EXPECT_TRUE(transaction_log_local_view.IsDegraded());
+    EXPECT_FALSE(transaction_log_local_view.IsSampleLeaseRevoked(slot_index));
+
+    // and expecting that the reference is released exactly once
+    EXPECT_CALL(dereference_slot_callback_, Call(slot_index));
+
+    // when checking them twice with force release
+    const auto released_result = unit_->CheckSampleLeases(150U, true, GetDereferenceSlotCallbackWrapper());
+    const auto repeated_result = unit_->CheckSampleLeases(150U, true, GetDereferenceSlotCallbackWrapper());
+
+    // Then the degraded proxy is not reported again and its reference is only released by the first check
+    EXPECT_EQ(released_result.released_references, 1U);
+    EXPECT_EQ(released_result.newly_degraded_logs, 0U);
+    EXPECT_EQ(repeated_result.expired_references, 0U);
+    EXPECT_EQ(repeated_result.released_references, 0U);
+    EXPECT_TRUE(transaction_log_local_view.IsSampleLeaseRevoked(slot_index));
+}
+
 using TransactionLogSetRegisterFixture = TransactionLogSetFixture;
 
 TEST_F(TransactionLogSetRegisterFixture, RegisteringWhenMaxLogsIsZeroReturnsError)
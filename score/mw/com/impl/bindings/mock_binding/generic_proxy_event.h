@@ -61,6 +61,11 @@ class GenericProxyEvent : public GenericProxyEventBinding
                 (SubscriptionStateChangeHandler),
                 (noexcept, override));
     MOCK_METHOD(Result<void>, UnsetSubscriptionStateChangeHandler, (), (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                SetDeadlineMissedHandler,
+                (std::chrono::nanoseconds, DeadlineMissedHandler),
+                (noexcept, override));
+    MOCK_METHOD(Result<void>, UnsetDeadlineMissedHandler, (), (noexcept, override));
     MOCK_METHOD(std::optional<std::uint16_t>, GetMaxSampleCount, (), (const, noexcept, override));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(void, NotifyServiceInstanceChangedAvailability, (bool, pid_t), (noexcept, override));
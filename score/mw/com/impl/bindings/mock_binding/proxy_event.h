@@ -45,6 +45,11 @@ class ProxyEventBase : public ProxyEventBindingBase
                 (SubscriptionStateChangeHandler),
                 (noexcept, override));
     MOCK_METHOD(Result<void>, UnsetSubscriptionStateChangeHandler, (), (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                SetDeadlineMissedHandler,
+                (std::chrono::nanoseconds, DeadlineMissedHandler),
+                (noexcept, override));
+    MOCK_METHOD(Result<void>, UnsetDeadlineMissedHandler, (), (noexcept, override));
     MOCK_METHOD(std::optional<std::uint16_t>, GetMaxSampleCount, (), (const, noexcept, override));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(void, NotifyServiceInstanceChangedAvailability, (bool, pid_t), (noexcept, override));
@@ -84,6 +89,11 @@ class ProxyEvent : public ProxyEventBinding<SampleType>
                 (SubscriptionStateChangeHandler),
                 (noexcept, override));
     MOCK_METHOD(Result<void>, UnsetSubscriptionStateChangeHandler, (), (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                SetDeadlineMissedHandler,
+                (std::chrono::nanoseconds, DeadlineMissedHandler),
+                (noexcept, override));
+    MOCK_METHOD(Result<void>, UnsetDeadlineMissedHandler, (), (noexcept, override));
     MOCK_METHOD(std::optional<std::uint16_t>, GetMaxSampleCount, (), (const, noexcept, override));
     MOCK_METHOD(BindingType, GetBindingType, (), (const, noexcept, override));
     MOCK_METHOD(void, NotifyServiceInstanceChangedAvailability, (bool, pid_t), (noexcept, override));
@@ -178,6 +188,15 @@ class ProxyEventFacade : public ProxyEventBinding<SampleType>
     {
         return proxy_event_.UnsetSubscriptionStateChangeHandler();
     }
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                          DeadlineMissedHandler handler) noexcept override
+    {
+        return proxy_event_.SetDeadlineMissedHandler(expected_period, std::move(handler));
+    }
+    Result<void> UnsetDeadlineMissedHandler() noexcept override
+    {
+        return proxy_event_.UnsetDeadlineMissedHandler();
+    }
     std::optional<std::uint16_t> GetMaxSampleCount() const noexcept override
     {
         return proxy_event_.GetMaxSampleCount();
@@ -62,6 +62,17 @@ class TracingRuntime : public IBindingTracingRuntime
                 ConvertToTracingServiceInstanceElement,
                 (impl::tracing::ServiceElementInstanceIdentifierView),
                 (const, override));
+    MOCK_METHOD(ShmObjectRegistrationGeneration, GetShmObjectRegistrationGeneration, (), (const, noexcept, override));
+    MOCK_METHOD(void,
+                CacheShmTraceHandle,
+                (const impl::tracing::ServiceElementTracingData&,
+                 const ShmTraceHandle&,
+                 const ShmObjectRegistrationGeneration),
+                (noexcept, override));
+    MOCK_METHOD(std::optional<ShmTraceHandle>,
+                GetShmTraceHandle,
+                (const impl::tracing::ServiceElementTracingData&),
+                (const, noexcept, override));
     MOCK_METHOD(std::optional<TraceContextId>,
                 EmplaceTypeErasedSamplePtr,
                 (TypeErasedSamplePtr, const impl::tracing::ServiceElementTracingData),
@@ -631,6 +631,189 @@ TEST_F(ConfigParserFixture, MethodQueueSizeCanBeSpecified)
     EXPECT_EQ(lola_deployment.methods_.at("SetPressure").queue_size_, 5);
 }
 
+TEST_F(ConfigParserFixture, MethodSchedulingAttributesDefaultWhenNotProvided)
+{
+    // Given a JSON with a method without priority and maxConcurrentCalls
+    auto j2 = R"(
+{
+  "serviceTypes": [
+    {
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "bindings": [
+        {
+          "binding": "SHM",
+          "serviceId": 1234,
+          "methods": [
+            {
+              "methodName": "SetPressure",
+              "methodId": 40
+            }
+          ]
+        }
+      ]
+    }
+  ],
+  "serviceInstances": [
+    {
+      "instanceSpecifier": "abc/abc/TirePressurePort",
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "instances": [
+        {
+          "instanceId": 1234,
+          "asil-level": "QM",
+          "binding": "SHM",
+          "methods": [
+            {
+              "methodName": "SetPressure"
+            }
+          ]
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::Parse(std::move(j2));
+
+    // Then the method has the default priority and no concurrency limit
+    const auto deployments =
+        config.GetServiceInstances().at(InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value());
+    const auto& lola_deployment = std::get<LolaServiceInstanceDeployment>(deployments.bindingInfo_);
+    EXPECT_EQ(lola_deployment.methods_.at("SetPressure").priority_, LolaMethodInstanceDeployment::kDefaultPriority);
+    EXPECT_FALSE(lola_deployment.methods_.at("SetPressure").max_concurrent_calls_.has_value());
+}
+
+TEST_F(ConfigParserFixture, MethodSchedulingAttributesCanBeSpecified)
+{
+    // Given a JSON with a method with explicit priority and maxConcurrentCalls
+    auto j2 = R"(
+{
+  "serviceTypes": [
+    {
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "bindings": [
+        {
+          "binding": "SHM",
+          "serviceId": 1234,
+          "methods": [
+            {
+              "methodName": "SetPressure",
+              "methodId": 40
+            }
+          ]
+        }
+      ]
+    }
+  ],
+  "serviceInstances": [
+    {
+      "instanceSpecifier": "abc/abc/TirePressurePort",
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "instances": [
+        {
+          "instanceId": 1234,
+          "asil-level": "QM",
+          "binding": "SHM",
+          "methods": [
+            {
+              "methodName": "SetPressure",
+              "priority": 200,
+              "maxConcurrentCalls": 2
+            }
+          ]
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::Parse(std::move(j2));
+
+    // Then priority and concurrency limit are set to the specified values
+    const auto deployments =
+        config.GetServiceInstances().at(InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value());
+    const auto& lola_deployment = std::get<LolaServiceInstanceDeployment>(deployments.bindingInfo_);
+    EXPECT_EQ(lola_deployment.methods_.at("SetPressure").priority_, 200U);
+    EXPECT_EQ(lola_deployment.methods_.at("SetPressure").max_concurrent_calls_, 2U);
+}
+
+TEST_F(ConfigParserFixture, MethodWithZeroMaxConcurrentCallsWillCauseTermination)
+{
+    // Given a JSON with a method with maxConcurrentCalls of 0
+    auto j2 = R"(
+{
+  "serviceTypes": [
+    {
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "bindings": [
+        {
+          "binding": "SHM",
+          "serviceId": 1234,
+          "methods": [
+            {
+              "methodName": "SetPressure",
+              "methodId": 40
+            }
+          ]
+        }
+      ]
+    }
+  ],
+  "serviceInstances": [
+    {
+      "instanceSpecifier": "abc/abc/TirePressurePort",
+      "serviceTypeName": "/score/ncar/services/TirePressureService",
+      "version": {
+        "major": 12,
+        "minor": 34
+      },
+      "instances": [
+        {
+          "instanceId": 1234,
+          "asil-level": "QM",
+          "binding": "SHM",
+          "methods": [
+            {
+              "methodName": "SetPressure",
+              "maxConcurrentCalls": 0
+            }
+          ]
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // When parsing the JSON
+    // Then the program terminates
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(score::mw::com::impl::configuration::Parse(std::move(j2)));
+}
+
 TEST_F(ConfigParserFixture, MethodCanBeExplicitlyDisabled)
 {
     // Given a JSON with a method with enabled set to false
@@ -16,6 +16,7 @@
 #include "score/mw/com/impl/configuration/configuration_common_resources.h"
 #include "score/mw/com/impl/configuration/lola_method_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "score/mw/com/impl/configuration/lola_shm_numa_policy.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 #include "score/mw/com/impl/configuration/service_type_deployment.h"
 #include "score/mw/com/impl/configuration/tracing_configuration.h"
@@ -71,6 +72,8 @@ constexpr auto kMethodIdKey = "methodId"sv;
 constexpr auto kMethodQueueSizeKey = "queueSize"sv;
 constexpr auto kMethodEnabledKey = "use"sv;
 constexpr auto kMethodEnabledDefaultValue = true;
+constexpr auto kMethodPriorityKey = "priority"sv;
+constexpr auto kMethodMaxConcurrentCallsKey = "maxConcurrentCalls"sv;
 constexpr auto kUseGetIfAvailableDefaultValue = true;
 constexpr auto kUseSetIfAvailableDefaultValue = true;
 constexpr auto kEventNumberOfSampleSlotsKey = "numberOfSampleSlots"sv;
@@ -88,11 +91,19 @@ constexpr auto kFieldUseSetIfAvailableKey = "useSetIfAvailable"sv;
 constexpr auto kLolaShmSizeKey = "shm-size"sv;
 constexpr auto kLolaControlAsilBShmSizeKey = "control-asil-b-shm-size"sv;
 constexpr auto kLolaControlQmShmSizeKey = "control-qm-shm-size"sv;
+constexpr auto kLolaShmNumaPolicyKey = "shm-numa-policy"sv;
+constexpr auto kLolaShmNumaPolicyModeKey = "mode"sv;
+constexpr auto kLolaShmNumaPolicyNodeKey = "node"sv;
 constexpr auto kGlobalPropertiesKey = "global"sv;
 constexpr auto kAllowedConsumerKey = "allowedConsumer"sv;
 constexpr auto kAllowedProviderKey = "allowedProvider"sv;
 constexpr auto kQueueSizeKey = "queue-size"sv;
 constexpr auto kShmSizeCalcModeKey = "shm-size-calc-mode"sv;
+constexpr auto kShmPrefaultModeKey = "shm-prefault-mode"sv;
+constexpr auto kDiagnosticsReportIntervalKey = "diagnostics-report-interval-ms"sv;
+constexpr auto kDeferredLogRecordsPerThreadKey = "deferred-log-records-per-thread"sv;
+constexpr auto kMethodCallWorkerThreadsKey = "method-call-worker-threads"sv;
+constexpr auto kMessagePassingReactorsKey = "message-passing-reactors"sv;
 constexpr auto kTracingPropertiesKey = "tracing"sv;
 constexpr auto kTracingEnabledKey = "enable"sv;
 constexpr auto kTracingGloballyEnabledDefaultValue = false;
@@ -104,11 +115,24 @@ constexpr auto kInterVmForwarded = "interVmForwarded"sv;
 constexpr auto kNumberOfIpcTracingSlotsKey = "numberOfIpcTracingSlots"sv;
 using NumberOfIpcTracingSlots_t = std::uint8_t;
 constexpr auto kNumberOfIpcTracingSlotsDefault = static_cast<NumberOfIpcTracingSlots_t>(0U);
+constexpr auto kSubscriptionControlWidthKey = "subscriptionControlWidth"sv;
+constexpr std::uint8_t kSubscriptionControlWidth32Bit{32U};
+constexpr std::uint8_t kSubscriptionControlWidth64Bit{64U};
+constexpr auto kPrefetchBytesKey = "prefetchBytes"sv;
+constexpr LolaEventInstanceDeployment::PrefetchBytesType kPrefetchBytesDefault{0U};
+constexpr auto kMaxSampleHoldTimeMsKey = "maxSampleHoldTimeMs"sv;
+constexpr LolaEventInstanceDeployment::SampleHoldTimeType kMaxSampleHoldTimeMsDefault{0U};
+constexpr auto kStaleSampleActionKey = "staleSampleAction"sv;
+constexpr auto kStaleSampleActionMarkDegraded = "MARK-DEGRADED"sv;
+constexpr auto kStaleSampleActionForceRelease = "FORCE-RELEASE"sv;
 
 constexpr auto kPermissionChecksKey = "permission-checks"sv;
 
 constexpr auto kShmBinding = "SHM"sv;
 constexpr auto kShmSizeCalcModeSimulation = "SIMULATION"sv;
+constexpr auto kShmPrefaultModeNone = "NONE"sv;
+constexpr auto kShmPrefaultModePrefault = "PREFAULT"sv;
+constexpr auto kShmPrefaultModePrefaultAndLock = "PREFAULT-AND-LOCK"sv;
 
 constexpr auto kTracingTraceFilterConfigPathDefaultValue = "./etc/mw_com_trace_filter.json"sv;
 constexpr auto kStrictPermission = "strict"sv;
@@ -239,6 +263,36 @@ auto ParseShmSizeCalcMode(const score::json::Object& json_map) -> std::optional<
     return std::nullopt;
 }
 
+auto ParseShmPrefaultMode(const score::json::Object& json_map) -> std::optional<ShmPrefaultMode>
+{
+    const auto& shm_prefault_mode = json_map.find(kShmPrefaultModeKey.data());
+    if (shm_prefault_mode != json_map.cend())
+    {
+        auto mode_result = shm_prefault_mode->second.As<std::string>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(mode_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        const auto& shm_prefault_mode_value = mode_result.value().get();
+
+        if (shm_prefault_mode_value == kShmPrefaultModeNone)
+        {
+            return ShmPrefaultMode::kNone;
+        }
+        if (shm_prefault_mode_value == kShmPrefaultModePrefault)
+        {
+            return ShmPrefaultMode::kPrefault;
+        }
+        if (shm_prefault_mode_value == kShmPrefaultModePrefaultAndLock)
+        {
+            return ShmPrefaultMode::kPrefaultAndLock;
+        }
+        score::mw::log::LogError("lola") << "Unknown value " << shm_prefault_mode_value << " in key "
+                                         << kShmPrefaultModeKey;
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+    }
+
+    return std::nullopt;
+}
+
 // Note 1:
 // Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall not be called
 //                                                                   implicitly"
@@ -364,6 +418,66 @@ class ServiceElementInstanceDeploymentParser
         return RetrieveJsonElement<SampleSlotCountType>(max_samples_it);
     }
 
+    LolaEventInstanceDeployment::SubscriptionControlWidth GetSubscriptionControlWidth(
+        const std::optional<LolaEventInstanceDeployment::SubscriberCountType> max_subscribers)
+    {
+        using SubscriptionControlWidth = LolaEventInstanceDeployment::SubscriptionControlWidth;
+
+        auto subscription_control_width{SubscriptionControlWidth::k32Bit};
+        const auto width_in_bits = RetrieveJsonElement<std::uint8_t>(kSubscriptionControlWidthKey);
+        if (width_in_bits.has_value())
+        {
+            if (width_in_bits.value() == kSubscriptionControlWidth64Bit)
+            {
+                subscription_control_width = SubscriptionControlWidth::k64Bit;
+            }
+            else if (width_in_bits.value() != kSubscriptionControlWidth32Bit)
+            {
+                score::mw::log::LogError("lola") << "Unknown value " << width_in_bits.value() << " in key "
+                                                 << kSubscriptionControlWidthKey;
+                SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+            }
+        }
+
+        if ((subscription_control_width == SubscriptionControlWidth::k32Bit) &&
+            (max_subscribers.value_or(0U) > LolaEventInstanceDeployment::kMaxSubscribersOf32BitSubscriptionControl))
+        {
+            score::mw::log::LogError("lola")
+                << "<maxSubscribers> exceeds "
+                << LolaEventInstanceDeployment::kMaxSubscribersOf32BitSubscriptionControl
+                << ", which requires <subscriptionControlWidth> to be set to 64";
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+        }
+        return subscription_control_width;
+    }
+
+    LolaEventInstanceDeployment::StaleSampleAction GetStaleSampleAction() const
+    {
+        using StaleSampleAction = LolaEventInstanceDeployment::StaleSampleAction;
+
+        const auto& stale_sample_action_it = json_object_.find(kStaleSampleActionKey.data());
+        if (stale_sample_action_it == json_object_.cend())
+        {
+            return StaleSampleAction::kMarkDegraded;
+        }
+        const auto stale_sample_action = stale_sample_action_it->second.As<std::string>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(stale_sample_action.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        const auto& stale_sample_action_value = stale_sample_action.value().get();
+        if (stale_sample_action_value == kStaleSampleActionMarkDegraded)
+        {
+            return StaleSampleAction::kMarkDegraded;
+        }
+        if (stale_sample_action_value == kStaleSampleActionForceRelease)
+        {
+            return StaleSampleAction::kForceRelease;
+        }
+        score::mw::log::LogError("lola") << "Unknown value " << stale_sample_action_value << " in key "
+                                         << kStaleSampleActionKey;
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+        return StaleSampleAction::kMarkDegraded;
+    }
+
   private:
     const score::json::Object& json_object_;
     using SampleSlotCountType = LolaEventInstanceDeployment::SampleSlotCountType;
@@ -403,8 +517,17 @@ auto ParseLolaEventInstanceDeployment(const score::json::Object& json_map, LolaS
         const auto max_subscribers =
             deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::SubscriberCountType>(
                 kEventMaxSubscribersKey);
+        const auto subscription_control_width = deployment_parser.GetSubscriptionControlWidth(max_subscribers);
         const auto enforce_max_samples =
             deployment_parser.RetrieveJsonElement<bool>(kEventEnforceMaxSamplesKey).value_or(true);
+        const auto prefetch_bytes =
+            deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::PrefetchBytesType>(kPrefetchBytesKey)
+                .value_or(kPrefetchBytesDefault);
+        const auto max_sample_hold_time_ms =
+            deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::SampleHoldTimeType>(
+                kMaxSampleHoldTimeMsKey)
+                .value_or(kMaxSampleHoldTimeMsDefault);
+        const auto stale_sample_action = deployment_parser.GetStaleSampleAction();
 
         const auto number_of_tracing_slots =
             deployment_parser.RetrieveJsonElement<NumberOfIpcTracingSlots_t>(kNumberOfIpcTracingSlotsKey)
@@ -414,7 +537,11 @@ auto ParseLolaEventInstanceDeployment(const score::json::Object& json_map, LolaS
                                                             max_subscribers,
                                                             kMaxConcurrentAllocationsDefault,
                                                             enforce_max_samples,
-                                                            number_of_tracing_slots);
+                                                            number_of_tracing_slots,
+                                                            subscription_control_width,
+                                                            prefetch_bytes,
+                                                            max_sample_hold_time_ms,
+                                                            stale_sample_action);
 
         EmplaceOrFatal(service.events_, std::move(event_name_value), event_deployment, "An event instance");
     }
@@ -455,8 +582,17 @@ auto ParseLolaFieldInstanceDeployment(const score::json::Object& json_map, LolaS
         const auto max_subscribers =
             deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::SubscriberCountType>(
                 kFieldMaxSubscribersKey);
+        const auto subscription_control_width = deployment_parser.GetSubscriptionControlWidth(max_subscribers);
         const auto enforce_max_samples =
             deployment_parser.RetrieveJsonElement<bool>(kFieldEnforceMaxSamplesKey).value_or(true);
+        const auto prefetch_bytes =
+            deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::PrefetchBytesType>(kPrefetchBytesKey)
+                .value_or(kPrefetchBytesDefault);
+        const auto max_sample_hold_time_ms =
+            deployment_parser.RetrieveJsonElement<LolaEventInstanceDeployment::SampleHoldTimeType>(
+                kMaxSampleHoldTimeMsKey)
+                .value_or(kMaxSampleHoldTimeMsDefault);
+        const auto stale_sample_action = deployment_parser.GetStaleSampleAction();
         const auto number_of_tracing_slots =
             deployment_parser.RetrieveJsonElement<NumberOfIpcTracingSlots_t>(kNumberOfIpcTracingSlotsKey)
                 .value_or(kNumberOfIpcTracingSlotsDefault);
@@ -470,7 +606,11 @@ auto ParseLolaFieldInstanceDeployment(const score::json::Object& json_map, LolaS
                                                                     max_subscribers,
                                                                     kMaxConcurrentAllocationsDefault,
                                                                     enforce_max_samples,
-                                                                    number_of_tracing_slots),
+                                                                    number_of_tracing_slots,
+                                                                    subscription_control_width,
+                                                                    prefetch_bytes,
+                                                                    max_sample_hold_time_ms,
+                                                                    stale_sample_action),
                                         use_get_if_available,
                                         use_set_if_available);
         EmplaceOrFatal(service.fields_, std::move(field_name_value), field_deployment, "A field instance");
@@ -503,7 +643,16 @@ auto ParseLolaMethodInstanceDeployment(const score::json::Object& json_map, Lola
             GetOptionalValueFromJson<LolaMethodInstanceDeployment::QueueSize>(method_object, kMethodQueueSizeKey);
         const bool method_enabled =
             GetOptionalValueFromJson<bool>(method_object, kMethodEnabledKey).value_or(kMethodEnabledDefaultValue);
-        const LolaMethodInstanceDeployment method_deployment{queue_size, method_enabled};
+        const auto priority =
+            GetOptionalValueFromJson<LolaMethodInstanceDeployment::Priority>(method_object, kMethodPriorityKey)
+                .value_or(LolaMethodInstanceDeployment::kDefaultPriority);
+        const auto max_concurrent_calls = GetOptionalValueFromJson<LolaMethodInstanceDeployment::ConcurrentCalls>(
+            method_object, kMethodMaxConcurrentCallsKey);
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+            !(max_concurrent_calls.has_value()) || (max_concurrent_calls.value() > 0U),
+            "Configuration corrupted: maxConcurrentCalls must be at least 1, check with json schema");
+        const LolaMethodInstanceDeployment method_deployment{
+            queue_size, method_enabled, priority, max_concurrent_calls};
 
         EmplaceOrFatal(service.methods_, method_name, method_deployment, "A method instance");
     }
@@ -588,6 +737,49 @@ auto ParsePermissionChecks(const score::json::Object& deployment_map) -> std::st
     return kFilePermissionsOnEmpty;
 }
 
+auto ParseShmNumaPolicy(const score::json::Object& json_map) -> std::optional<LolaShmNumaPolicy>
+{
+    const auto& found_numa_policy = json_map.find(kLolaShmNumaPolicyKey.data());
+    if (found_numa_policy == json_map.cend())
+    {
+        return std::nullopt;
+    }
+
+    const auto numa_policy_obj_result = found_numa_policy->second.As<score::json::Object>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(numa_policy_obj_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& numa_policy_obj = numa_policy_obj_result.value().get();
+
+    const auto& found_mode = numa_policy_obj.find(kLolaShmNumaPolicyModeKey.data());
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(found_mode != numa_policy_obj.cend(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto mode_result = found_mode->second.As<std::string>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(mode_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& mode_value = mode_result.value().get();
+    const auto mode = LolaShmNumaPolicyModeFromString(mode_value);
+    if (!mode.has_value())
+    {
+        score::mw::log::LogError("lola") << "Unknown value " << mode_value << " in key " << kLolaShmNumaPolicyKey;
+        SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD(false);
+    }
+
+    std::optional<LolaShmNumaPolicy::NodeId> node{};
+    const auto& found_node = numa_policy_obj.find(kLolaShmNumaPolicyNodeKey.data());
+    if (found_node != numa_policy_obj.cend())
+    {
+        const auto node_result = found_node->second.As<LolaShmNumaPolicy::NodeId>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(node_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        node = node_result.value();
+    }
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(
+        (mode.value() == LolaShmNumaPolicy::Mode::kBindToNode) == node.has_value(),
+        "Configuration corrupted: shm-numa-policy requires a node exactly for mode bind-node");
+
+    return LolaShmNumaPolicy{mode.value(), node};
+}
+
 auto ParseLolaServiceInstanceDeployment(const score::json::Object& json_map) -> LolaServiceInstanceDeployment
 {
     LolaServiceInstanceDeployment service{};
@@ -621,6 +813,8 @@ auto ParseLolaServiceInstanceDeployment(const score::json::Object& json_map) ->
         service.control_qm_memory_size_ = found_control_qm_shm_size_value;
     }
 
+    service.shm_numa_policy_ = ParseShmNumaPolicy(json_map);
+
     const auto& instance_id = json_map.find(kInstanceIdKey.data());
     if (instance_id != json_map.cend())
     {
@@ -1104,6 +1298,49 @@ auto ParseGlobalProperties(const score::json::Object& top_level_object) -> Globa
             global_configuration.SetShmSizeCalcMode(shm_size_calc_mode.value());
         }
 
+        const std::optional<ShmPrefaultMode> shm_prefault_mode{ParseShmPrefaultMode(process_properties_map)};
+        if (shm_prefault_mode.has_value())
+        {
+            global_configuration.SetShmPrefaultMode(shm_prefault_mode.value());
+        }
+
+        const auto& diagnostics_report_interval_it = process_properties_map.find(kDiagnosticsReportIntervalKey.data());
+        if (diagnostics_report_interval_it != process_properties_map.cend())
+        {
+            const auto diagnostics_report_interval = diagnostics_report_interval_it->second.As<std::uint32_t>();
+            SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(diagnostics_report_interval.has_value(),
+                                                              "Configuration corrupted, check with json schema");
+            global_configuration.SetDiagnosticsReportInterval(
+                std::chrono::milliseconds{diagnostics_report_interval.value()});
+        }
+
+        const auto& deferred_log_records_it = process_properties_map.find(kDeferredLogRecordsPerThreadKey.data());
+        if (deferred_log_records_it != process_properties_map.cend())
+        {
+            const auto deferred_log_records = deferred_log_records_it->second.As<std::uint32_t>();
+            SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(deferred_log_records.has_value(),
+                                                              "Configuration corrupted, check with json schema");
+            global_configuration.SetDeferredLogRecordsPerThread(deferred_log_records.value());
+        }
+
+        const auto& method_call_worker_threads_it = process_properties_map.find(kMethodCallWorkerThreadsKey.data());
+        if (method_call_worker_threads_it != process_properties_map.cend())
+        {
+            const auto method_call_worker_threads = method_call_worker_threads_it->second.As<std::uint32_t>();
+            SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(method_call_worker_threads.has_value(),
+                                                              "Configuration corrupted, check with json schema");
+            global_configuration.SetMethodCallWorkerThreads(method_call_worker_threads.value());
+        }
+
+        const auto& message_passing_reactors_it = process_properties_map.find(kMessagePassingReactorsKey.data());
+        if (message_passing_reactors_it != process_properties_map.cend())
+        {
+            const auto message_passing_reactors = message_passing_reactors_it->second.As<std::uint32_t>();
+            SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(message_passing_reactors.has_value(),
+                                                              "Configuration corrupted, check with json schema");
+            global_configuration.SetMessagePassingReactors(message_passing_reactors.value());
+        }
+
         const auto& application_id_it = process_properties_map.find(kApplicationIdKey.data());
         if (application_id_it != process_properties_map.cend())
         {
@@ -1761,6 +1761,461 @@ TEST(ConfigurationJsonParsingStrategy, NoFieldMaxSubscribersLeavesValueOptional)
                      .lola_event_instance_deployment_.max_subscribers_.has_value());
 }
 
+TEST(ConfigurationJsonParsingStrategy, SubscriptionControlWidthIsParsed)
+{
+    // Given a JSON where a LoLa event has 1000 subscribers and a 64 bit subscription control, while the field does not
+    // configure the subscription control width
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+                  "fields": [
+                      {
+                          "fieldName": "CurrentTemperatureFrontLeft",
+                          "fieldId": 21
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 1000,
+                      "subscriptionControlWidth": 64
+                    }
+                  ],
+                  "fields": [
+                    {
+                      "fieldName": "CurrentTemperatureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 3
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value());
+    const auto deploymentInfo = std::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+
+    // Then the event uses the 64 bit subscription control with all its subscribers
+    const auto& event_deployment = deploymentInfo.events_.at("CurrentPressureFrontLeft");
+    EXPECT_EQ(event_deployment.max_subscribers_.value(), 1000U);
+    EXPECT_EQ(event_deployment.GetSubscriptionControlWidth(),
+              LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit);
+
+    // and the field uses the default 32 bit subscription control
+    EXPECT_EQ(deploymentInfo.fields_.at("CurrentTemperatureFrontLeft")
+                  .lola_event_instance_deployment_.GetSubscriptionControlWidth(),
+              LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit);
+}
+
+TEST(ConfigurationJsonParsingStrategy, PrefetchBytesIsParsed)
+{
+    // Given a JSON where a LoLa event configures 256 prefetch bytes, while the field does not configure prefetching
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+                  "fields": [
+                      {
+                          "fieldName": "CurrentTemperatureFrontLeft",
+                          "fieldId": 21
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "prefetchBytes": 256
+                    }
+                  ],
+                  "fields": [
+                    {
+                      "fieldName": "CurrentTemperatureFrontLeft"
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value());
+    const auto deploymentInfo = std::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+
+    // Then the event prefetches the configured number of bytes
+    EXPECT_EQ(deploymentInfo.events_.at("CurrentPressureFrontLeft").GetPrefetchBytes(), 256U);
+
+    // and the field doesn't prefetch at all
+    EXPECT_EQ(
+        deploymentInfo.fields_.at("CurrentTemperatureFrontLeft").lola_event_instance_deployment_.GetPrefetchBytes(),
+        0U);
+}
+
+TEST(ConfigurationJsonParsingStrategy, SampleLeaseSettingsAreParsed)
+{
+    // Given a JSON where a LoLa event force-releases samples held longer than 50ms, while the field only configures a
+    // maximum sample hold time
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+                  "fields": [
+                      {
+                          "fieldName": "CurrentTemperatureFrontLeft",
+                          "fieldId": 21
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "maxSampleHoldTimeMs": 50,
+                      "staleSampleAction": "FORCE-RELEASE"
+                    }
+                  ],
+                  "fields": [
+                    {
+                      "fieldName": "CurrentTemperatureFrontLeft",
+                      "maxSampleHoldTimeMs": 200
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create(std::string{"abc/abc/TirePressurePort"}).value());
+    const auto deploymentInfo = std::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+
+    // Then the event force-releases samples held longer than the configured time
+    const auto& event_deployment = deploymentInfo.events_.at("CurrentPressureFrontLeft");
+    EXPECT_EQ(event_deployment.GetMaxSampleHoldTimeMs(), 50U);
+    EXPECT_EQ(event_deployment.GetStaleSampleAction(), LolaEventInstanceDeployment::StaleSampleAction::kForceRelease);
+
+    // and the field marks stale consumers as degraded by default
+    const auto& field_deployment =
+        deploymentInfo.fields_.at("CurrentTemperatureFrontLeft").lola_event_instance_deployment_;
+    EXPECT_EQ(field_deployment.GetMaxSampleHoldTimeMs(), 200U);
+    EXPECT_EQ(field_deployment.GetStaleSampleAction(), LolaEventInstanceDeployment::StaleSampleAction::kMarkDegraded);
+}
+
+TEST(ConfigurationJsonParsingStrategyDeathTest, UnknownStaleSampleActionWillCauseTermination)
+{
+    // Given a JSON where a LoLa event has an unknown stale sample action
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "maxSampleHoldTimeMs": 50,
+                      "staleSampleAction": "RELEASE-LATER"
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    // Then the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
+TEST(ConfigurationJsonParsingStrategyDeathTest, MoreThan255SubscribersWith32BitSubscriptionControlWillCauseTermination)
+{
+    // Given a JSON where a LoLa event has 1000 subscribers without a 64 bit subscription control
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+                  "fields": [
+                      {
+                          "fieldName": "CurrentTemperatureFrontLeft",
+                          "fieldId": 21
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 1000
+                    }
+                  ],
+                  "fields": [
+                    {
+                      "fieldName": "CurrentTemperatureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 3
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    // Then the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
+TEST(ConfigurationJsonParsingStrategyDeathTest, UnknownSubscriptionControlWidthWillCauseTermination)
+{
+    // Given a JSON where a LoLa event has an unsupported subscription control width
+    auto j2 = R"(
+  {
+    "serviceTypes": [
+        {
+          "serviceTypeName": "/score/ncar/services/TirePressureService",
+          "version": {
+              "major": 12,
+              "minor": 34
+          },
+          "bindings": [
+              {
+                  "binding": "SHM",
+                  "serviceId": 1234,
+                  "events": [
+                      {
+                          "eventName": "CurrentPressureFrontLeft",
+                          "eventId": 20
+                      }
+                  ],
+                  "fields": [
+                      {
+                          "fieldName": "CurrentTemperatureFrontLeft",
+                          "fieldId": 21
+                      }
+                  ]
+              }
+          ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/score/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                  "instanceId": 1234,
+                  "asil-level": "QM",
+                  "binding": "SHM",
+                  "events": [
+                    {
+                      "eventName": "CurrentPressureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 1000,
+                      "subscriptionControlWidth": 16
+                    }
+                  ],
+                  "fields": [
+                    {
+                      "fieldName": "CurrentTemperatureFrontLeft",
+                      "numberOfSampleSlots": 50,
+                      "maxSubscribers": 3
+                    }
+                  ]
+                }
+            ]
+        }
+    ]
+  }
+)"_json;
+
+    // When parsing the JSON
+    // Then the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
 TEST(ConfigurationJsonParsingStrategy, NoSHMInstanceIdLeavesValueOptional)
 {
     // Given a JSON without necessary attribute `instance_id_` for SHM-Binding Info
@@ -2758,6 +3213,131 @@ TEST(ConfigurationJsonParsingStrategy, OnlyQmReceiverQueueSizes)
               GlobalConfiguration::DEFAULT_MIN_NUM_MESSAGES_TX_QUEUE);
 }
 
+TEST(ConfigurationJsonParsingStrategy, DiagnosticsReportIntervalIsParsed)
+{
+    // Given a JSON with an explicitly configured diagnostics report interval
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "diagnostics-report-interval-ms": 250
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+    // expect that the diagnostics report interval has the configured value
+    EXPECT_EQ(config.GetGlobalConfiguration().GetDiagnosticsReportInterval(), std::chrono::milliseconds{250});
+}
+
+TEST(ConfigurationJsonParsingStrategy, InvalidDiagnosticsReportIntervalWillDie)
+{
+    // Given a JSON with a diagnostics report interval, which is not an unsigned integer
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "diagnostics-report-interval-ms": "bla"
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    // That the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
+TEST(ConfigurationJsonParsingStrategy, DeferredLogRecordsPerThreadIsParsed)
+{
+    // Given a JSON with an explicitly configured number of deferred log records per thread
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "deferred-log-records-per-thread": 128
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+    // expect that the number of deferred log records per thread has the configured value
+    EXPECT_EQ(config.GetGlobalConfiguration().GetDeferredLogRecordsPerThread(), 128U);
+}
+
+TEST(ConfigurationJsonParsingStrategy, InvalidDeferredLogRecordsPerThreadWillDie)
+{
+    // Given a JSON with a number of deferred log records per thread, which is not an unsigned integer
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "deferred-log-records-per-thread": -1
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    // That the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
+TEST(ConfigurationJsonParsingStrategy, MethodCallWorkerThreadsIsParsed)
+{
+    // Given a JSON with an explicitly configured number of method call worker threads
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "method-call-worker-threads": 3
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+    // expect that the number of method call worker threads has the configured value
+    EXPECT_EQ(config.GetGlobalConfiguration().GetMethodCallWorkerThreads(), 3U);
+}
+
+TEST(ConfigurationJsonParsingStrategy, MethodCallWorkerThreadsIsNotSetWithoutConfiguration)
+{
+    // Given a JSON without a number of method call worker threads
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+    // expect that no number of method call worker threads is set
+    EXPECT_FALSE(config.GetGlobalConfiguration().GetMethodCallWorkerThreads().has_value());
+}
+
+TEST(ConfigurationJsonParsingStrategy, MessagePassingReactorsIsParsed)
+{
+    // Given a JSON with a number of message passing reactors
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "message-passing-reactors": 2
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2));
+    // expect that the number of message passing reactors has the configured value
+    EXPECT_EQ(config.GetGlobalConfiguration().GetMessagePassingReactors(), 2U);
+}
+
 TEST(ConfigurationJsonParsingStrategy, WrongQualityTypeForAllowedUsersWillDie)
 {
     // Given a JSON without necessary attribute `instance_id_` for SHM-Binding Info
@@ -2870,6 +3450,50 @@ const std::vector<std::tuple<std::string, ShmSizeCalculationMode>> valid_global_
 
 INSTANTIATE_TEST_SUITE_P(ValidShmSizeCalcMode, ShmSizeCalcMode, ::testing::ValuesIn(valid_global_shm_size_calc_modes));
 
+class ShmPrefaultModeParam : public ::testing::TestWithParam<std::tuple<std::string, ShmPrefaultMode>>
+{
+};
+
+TEST_P(ShmPrefaultModeParam, ValidShmPrefaultMode)
+{
+    json::JsonParser json_parser_obj;
+    json::Any json{json_parser_obj.FromBuffer(std::get<std::string>(GetParam())).value()};
+    Configuration config{configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(json))};
+    EXPECT_EQ(config.GetGlobalConfiguration().GetShmPrefaultMode(), std::get<ShmPrefaultMode>(GetParam()));
+}
+
+const std::vector<std::tuple<std::string, ShmPrefaultMode>> valid_global_shm_prefault_modes{
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "shm-prefault-mode": "NONE" }})json",
+     ShmPrefaultMode::kNone},
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "shm-prefault-mode": "PREFAULT" }})json",
+     ShmPrefaultMode::kPrefault},
+    {R"json({"serviceTypes": [], "serviceInstances": [], "global": { "shm-prefault-mode": "PREFAULT-AND-LOCK" }})json",
+     ShmPrefaultMode::kPrefaultAndLock},
+    {R"json({"serviceTypes": [], "serviceInstances": [] })json", ShmPrefaultMode::kNone},
+};
+
+INSTANTIATE_TEST_SUITE_P(ValidShmPrefaultMode,
+                         ShmPrefaultModeParam,
+                         ::testing::ValuesIn(valid_global_shm_prefault_modes));
+
+TEST(ConfigurationJsonParsingStrategy, UnknownShmPrefaultModeWillDie)
+{
+    // Given a JSON with an unknown shm prefault mode
+    auto j2 = R"(
+  {
+    "serviceTypes": [],
+    "serviceInstances": [],
+    "global": {
+       "shm-prefault-mode": "LOCK-ONLY"
+    }
+  }
+)"_json;
+    // When parsing the JSON
+    // Then the application will terminate
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(j2)));
+}
+
 TEST(ConfigurationJsonParsingStrategyTracing, EnablingGlobalTracingFlagSetsTracingEnabled)
 {
     RecordProperty("Verifies", "SCR-18159733");
@@ -5481,5 +6105,118 @@ TEST(ConfigurationJsonParsingStrategy, ServiceInstanceWithMultipleEventsAndField
     EXPECT_EQ(deploymentInfo.events_.size(), 2U);
     EXPECT_EQ(deploymentInfo.fields_.size(), 2U);
 }
+
+score::json::Any GenerateConfigJsonWithShmNumaPolicy(const std::string& shm_numa_policy)
+{
+    std::stringstream config_json_strstr{};
+    config_json_strstr << R"(
+{
+    "serviceTypes": [
+        {
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "bindings": [
+                {
+                    "binding": "SHM",
+                    "serviceId": 1234,
+                    "events": [
+                        {
+                            "eventName": "CurrentPressureFrontLeft",
+                            "eventId": 30
+                        }
+                    ]
+                }
+            ]
+        }
+    ],
+    "serviceInstances": [
+        {
+            "instanceSpecifier": "abc/abc/TirePressurePort",
+            "serviceTypeName": "/bmw/ncar/services/TirePressureService",
+            "version": {
+                "major": 12,
+                "minor": 34
+            },
+            "instances": [
+                {
+                    "instanceId": 1234,
+                    "asil-level": "QM",
+                    "binding": "SHM",
+                    "shm-numa-policy": )"
+                       << shm_numa_policy << R"(,
+                    "events": [
+                        {
+                            "eventName": "CurrentPressureFrontLeft"
+                        }
+                    ]
+                }
+            ]
+        }
+    ]
+}
+)";
+    return operator""_json(config_json_strstr.str().data(), config_json_strstr.str().size());
+}
+
+LolaServiceInstanceDeployment ParseLolaServiceInstanceDeploymentWithShmNumaPolicy(const std::string& shm_numa_policy)
+{
+    const auto config = score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(
+        GenerateConfigJsonWithShmNumaPolicy(shm_numa_policy));
+    const auto deployment =
+        config.GetServiceInstances().at(InstanceSpecifier::Create("abc/abc/TirePressurePort").value());
+    return std::get<LolaServiceInstanceDeployment>(deployment.bindingInfo_);
+}
+
+TEST(ConfigurationJsonParsingStrategyShmNumaPolicyTest, ParsesBindToNamedNode)
+{
+    // Given a JSON, which binds the shared-memory of the instance to node 1
+
+    // When parsing the JSON
+    const auto deployment_info =
+        ParseLolaServiceInstanceDeploymentWithShmNumaPolicy(R"({"mode": "bind-node", "node": 1})");
+
+    // Then the policy is contained in the deployment
+    EXPECT_EQ(deployment_info.shm_numa_policy_, (LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToNode, 1U}));
+}
+
+TEST(ConfigurationJsonParsingStrategyShmNumaPolicyTest, ParsesPoliciesWithoutNode)
+{
+    // Given JSONs, which bind the shared-memory to the producer node or interleave it
+
+    // When parsing the JSONs
+    const auto bind_deployment_info =
+        ParseLolaServiceInstanceDeploymentWithShmNumaPolicy(R"({"mode": "bind-producer-node"})");
+    const auto interleave_deployment_info =
+        ParseLolaServiceInstanceDeploymentWithShmNumaPolicy(R"({"mode": "interleave"})");
+
+    // Then the policies are contained in the deployments
+    EXPECT_EQ(bind_deployment_info.shm_numa_policy_,
+              LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToProducerNode});
+    EXPECT_EQ(interleave_deployment_info.shm_numa_policy_, LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kInterleave});
+}
+
+TEST(ConfigurationJsonParsingStrategyShmNumaPolicyTest, BindToNodeWithoutNodeViolatesContract)
+{
+    // Given a JSON, which binds the shared-memory to a named node, but doesn't name it
+    auto config_json = GenerateConfigJsonWithShmNumaPolicy(R"({"mode": "bind-node"})");
+
+    // Then Expect parsing to fail
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(config_json)));
+}
+
+TEST(ConfigurationJsonParsingStrategyShmNumaPolicyTest, UnknownModeViolatesContract)
+{
+    // Given a JSON with an unknown NUMA policy mode
+    auto config_json = GenerateConfigJsonWithShmNumaPolicy(R"({"mode": "bind-consumer-node"})");
+
+    // Then Expect parsing to fail
+    SCORE_LANGUAGE_FUTURECPP_EXPECT_CONTRACT_VIOLATED(
+        score::mw::com::impl::configuration::ConfigurationJsonParsingStrategy{}.Parse(std::move(config_json)));
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl
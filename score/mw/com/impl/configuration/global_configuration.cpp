@@ -25,7 +25,12 @@ GlobalConfiguration::GlobalConfiguration() noexcept
       message_rx_queue_size_qm{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_rx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_RX_QUEUE},
       message_tx_queue_size_b{DEFAULT_MIN_NUM_MESSAGES_TX_QUEUE},
-      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation}
+      shm_size_calc_mode_{ShmSizeCalculationMode::kSimulation},
+      diagnostics_report_interval_{DEFAULT_DIAGNOSTICS_REPORT_INTERVAL},
+      deferred_log_records_per_thread_{DEFAULT_DEFERRED_LOG_RECORDS_PER_THREAD},
+      method_call_worker_threads_{},
+      message_passing_reactors_{DEFAULT_MESSAGE_PASSING_REACTORS},
+      shm_prefault_mode_{ShmPrefaultMode::kNone}
 {
 }
 
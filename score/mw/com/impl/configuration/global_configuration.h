@@ -14,10 +14,12 @@
 #define SCORE_MW_COM_IMPL_CONFIGURATION_GLOBAL_CONFIGURATION_H
 
 #include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
 #include "score/mw/com/impl/configuration/shm_size_calc_mode.h"
 
 #include <sys/types.h>
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -39,6 +41,22 @@ class GlobalConfiguration final
     // False positive: This value is used in teh GlobalConfiguration constructor.
     // coverity[autosar_cpp14_a0_1_1_violation: FALSE]
     static constexpr std::int32_t DEFAULT_MIN_NUM_MESSAGES_TX_QUEUE{20};
+    // default value for the minimal time between two rate-limited log messages of the same hot path diagnostic site.
+    //
+    // False positive: This value is used in teh GlobalConfiguration constructor.
+    // coverity[autosar_cpp14_a0_1_1_violation: FALSE]
+    static constexpr std::chrono::milliseconds DEFAULT_DIAGNOSTICS_REPORT_INTERVAL{1000};
+    // default value for the number of deferred log records per thread. 0 means, that internal log messages are logged
+    // directly.
+    //
+    // False positive: This value is used in teh GlobalConfiguration constructor.
+    // coverity[autosar_cpp14_a0_1_1_violation: FALSE]
+    static constexpr std::uint32_t DEFAULT_DEFERRED_LOG_RECORDS_PER_THREAD{0U};
+    // default value for the number of reactors (engines with their own thread) of the message passing.
+    //
+    // False positive: This value is used in teh GlobalConfiguration constructor.
+    // coverity[autosar_cpp14_a0_1_1_violation: FALSE]
+    static constexpr std::uint32_t DEFAULT_MESSAGE_PASSING_REACTORS{1U};
 
     GlobalConfiguration() noexcept;
 
@@ -93,6 +111,61 @@ class GlobalConfiguration final
         return shm_size_calc_mode_;
     }
 
+    void SetDiagnosticsReportInterval(const std::chrono::milliseconds report_interval) noexcept
+    {
+        diagnostics_report_interval_ = report_interval;
+    }
+
+    std::chrono::milliseconds GetDiagnosticsReportInterval() const noexcept
+    {
+        return diagnostics_report_interval_;
+    }
+
+    void SetDeferredLogRecordsPerThread(const std::uint32_t records_per_thread) noexcept
+    {
+        deferred_log_records_per_thread_ = records_per_thread;
+    }
+
+    /// \brief Capacity of the ring of every thread for deferred internal log messages. 0, if internal log messages are
+    ///        logged directly.
+    std::uint32_t GetDeferredLogRecordsPerThread() const noexcept
+    {
+        return deferred_log_records_per_thread_;
+    }
+
+    void SetMethodCallWorkerThreads(const std::uint32_t worker_threads) noexcept
+    {
+        method_call_worker_threads_ = worker_threads;
+    }
+
+    /// \brief Number of worker threads for method calls of proxies in other processes, if explicitly configured.
+    std::optional<std::uint32_t> GetMethodCallWorkerThreads() const noexcept
+    {
+        return method_call_worker_threads_;
+    }
+
+    void SetMessagePassingReactors(const std::uint32_t reactors) noexcept
+    {
+        message_passing_reactors_ = reactors;
+    }
+
+    /// \brief Number of reactors, over which the message passing connections are distributed. Only used by the Unix
+    ///        domain socket based message passing, i.e. not on QNX.
+    std::uint32_t GetMessagePassingReactors() const noexcept
+    {
+        return message_passing_reactors_;
+    }
+
+    void SetShmPrefaultMode(const ShmPrefaultMode shm_prefault_mode) noexcept
+    {
+        shm_prefault_mode_ = shm_prefault_mode;
+    }
+
+    ShmPrefaultMode GetShmPrefaultMode() const noexcept
+    {
+        return shm_prefault_mode_;
+    }
+
   private:
     /// properties/settings from the "global" section
     QualityType process_asil_level_;
@@ -103,6 +176,16 @@ class GlobalConfiguration final
     std::int32_t message_tx_queue_size_b;
 
     ShmSizeCalculationMode shm_size_calc_mode_;
+
+    std::chrono::milliseconds diagnostics_report_interval_;
+
+    std::uint32_t deferred_log_records_per_thread_;
+
+    std::optional<std::uint32_t> method_call_worker_threads_;
+
+    std::uint32_t message_passing_reactors_;
+
+    ShmPrefaultMode shm_prefault_mode_;
 };
 
 }  // namespace score::mw::com::impl
@@ -23,6 +23,10 @@ static constexpr auto kDefaultQualityType = QualityType::kASIL_QM;
 static constexpr std::int32_t kDefaultMinNumMessagesRxQueue{10};
 static constexpr std::int32_t kDefaultMinNumMessagesTxQueue{20};
 static constexpr auto kDefaultShmSizeCalculationMode = ShmSizeCalculationMode::kSimulation;
+static constexpr std::chrono::milliseconds kDefaultDiagnosticsReportInterval{1000};
+static constexpr std::uint32_t kDefaultDeferredLogRecordsPerThread{0U};
+static constexpr std::uint32_t kDefaultMessagePassingReactors{1U};
+static constexpr auto kDefaultShmPrefaultMode = ShmPrefaultMode::kNone;
 
 TEST(GlobalConfigurationTest, GettingProcessAsilLevelBeforeSetValueReturnsDefault)
 {
@@ -118,6 +122,96 @@ TEST(GlobalConfigurationTest, GettingShmSizeCalcModeBeforeSetValueReturnsDefault
     EXPECT_EQ(get_shm_calc_size_mod, kDefaultShmSizeCalculationMode);
 }
 
+TEST(GlobalConfigurationTest, GettingDiagnosticsReportIntervalReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    const std::chrono::milliseconds set_report_interval{250};
+    global_configuration.SetDiagnosticsReportInterval(set_report_interval);
+    const auto get_report_interval = global_configuration.GetDiagnosticsReportInterval();
+    EXPECT_EQ(get_report_interval, set_report_interval);
+}
+
+TEST(GlobalConfigurationTest, GettingDiagnosticsReportIntervalBeforeSetValueReturnsDefault)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto get_report_interval = global_configuration.GetDiagnosticsReportInterval();
+    EXPECT_EQ(get_report_interval, kDefaultDiagnosticsReportInterval);
+}
+
+TEST(GlobalConfigurationTest, GettingDeferredLogRecordsPerThreadReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    const std::uint32_t set_records_per_thread{256U};
+    global_configuration.SetDeferredLogRecordsPerThread(set_records_per_thread);
+    const auto get_records_per_thread = global_configuration.GetDeferredLogRecordsPerThread();
+    EXPECT_EQ(get_records_per_thread, set_records_per_thread);
+}
+
+TEST(GlobalConfigurationTest, GettingDeferredLogRecordsPerThreadBeforeSetValueReturnsDefault)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto get_records_per_thread = global_configuration.GetDeferredLogRecordsPerThread();
+    EXPECT_EQ(get_records_per_thread, kDefaultDeferredLogRecordsPerThread);
+}
+
+TEST(GlobalConfigurationTest, GettingMethodCallWorkerThreadsReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    const std::uint32_t set_worker_threads{4U};
+    global_configuration.SetMethodCallWorkerThreads(set_worker_threads);
+    const auto get_worker_threads = global_configuration.GetMethodCallWorkerThreads();
+    EXPECT_EQ(get_worker_threads, set_worker_threads);
+}
+
+TEST(GlobalConfigurationTest, GettingMethodCallWorkerThreadsBeforeSetValueReturnsEmptyOptional)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto get_worker_threads = global_configuration.GetMethodCallWorkerThreads();
+    EXPECT_FALSE(get_worker_threads.has_value());
+}
+
+TEST(GlobalConfigurationTest, GettingMessagePassingReactorsReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    const std::uint32_t set_reactors{2U};
+    global_configuration.SetMessagePassingReactors(set_reactors);
+    const auto get_reactors = global_configuration.GetMessagePassingReactors();
+    EXPECT_EQ(get_reactors, set_reactors);
+}
+
+TEST(GlobalConfigurationTest, GettingMessagePassingReactorsBeforeSetValueReturnsDefault)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto get_reactors = global_configuration.GetMessagePassingReactors();
+    EXPECT_EQ(get_reactors, kDefaultMessagePassingReactors);
+}
+
+TEST(GlobalConfigurationTest, GettingShmPrefaultModeReturnsSetValue)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto set_shm_prefault_mode{ShmPrefaultMode::kPrefaultAndLock};
+    global_configuration.SetShmPrefaultMode(set_shm_prefault_mode);
+    const auto get_shm_prefault_mode = global_configuration.GetShmPrefaultMode();
+    EXPECT_EQ(get_shm_prefault_mode, set_shm_prefault_mode);
+}
+
+TEST(GlobalConfigurationTest, GettingShmPrefaultModeBeforeSetValueReturnsDefault)
+{
+    GlobalConfiguration global_configuration{};
+
+    const auto get_shm_prefault_mode = global_configuration.GetShmPrefaultMode();
+    EXPECT_EQ(get_shm_prefault_mode, kDefaultShmPrefaultMode);
+}
+
 TEST(GlobalConfigurationDeathTest, GetReceiverMessageQueueSize_InvalidQualityType)
 {
     // Given a default constructed GlobalConfiguration
@@ -18,6 +18,8 @@
 
 #include <exception>
 #include <optional>
+#include <string>
+#include <string_view>
 
 namespace score::mw::com::impl
 {
@@ -30,20 +32,90 @@ constexpr auto kSubscribersKey = "maxSubscribers";
 constexpr auto kMaxConcurrentAllocationsKey = "maxConcurrentAllocations";
 constexpr auto kEnforceMaxSamplesKey = "enforceMaxSamples";
 constexpr auto kNumberOfIpcTracingSlotsKey = "numberOfIpcTracingSlots";
+constexpr auto kSubscriptionControlWidthKey = "subscriptionControlWidth";
+constexpr auto kPrefetchBytesKey = "prefetchBytes";
+constexpr auto kMaxSampleHoldTimeMsKey = "maxSampleHoldTimeMs";
+constexpr auto kStaleSampleActionKey = "staleSampleAction";
 constexpr LolaEventInstanceDeployment::TracingSlotSizeType kNumberOfIpcTracingSlotsDefault{0U};
 
+// The subscription control width is serialized in bits, i.e. with the same encoding as in the mw_com_config.json.
+constexpr std::uint8_t kSubscriptionControlWidth32Bit{32U};
+constexpr std::uint8_t kSubscriptionControlWidth64Bit{64U};
+
+std::uint8_t SubscriptionControlWidthToBits(
+    const LolaEventInstanceDeployment::SubscriptionControlWidth subscription_control_width) noexcept
+{
+    return (subscription_control_width == LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit)
+               ? kSubscriptionControlWidth64Bit
+               : kSubscriptionControlWidth32Bit;
+}
+
+LolaEventInstanceDeployment::SubscriptionControlWidth SubscriptionControlWidthFromBits(
+    const std::uint8_t width_in_bits) noexcept
+{
+    if (width_in_bits == kSubscriptionControlWidth32Bit)
+    {
+        return LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit;
+    }
+    if (width_in_bits == kSubscriptionControlWidth64Bit)
+    {
+        return LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit;
+    }
+    score::mw::log::LogFatal("lola") << "Invalid value " << static_cast<std::uint32_t>(width_in_bits) << " for "
+                                     << kSubscriptionControlWidthKey
+                                     << " in serialized LolaEventInstanceDeployment. Terminating.";
+    std::terminate();
+}
+
+// The stale sample action is serialized with the same encoding as in the mw_com_config.json.
+constexpr std::string_view kStaleSampleActionMarkDegraded{"MARK-DEGRADED"};
+constexpr std::string_view kStaleSampleActionForceRelease{"FORCE-RELEASE"};
+
+std::string_view StaleSampleActionToString(
+    const LolaEventInstanceDeployment::StaleSampleAction stale_sample_action) noexcept
+{
+    return (stale_sample_action == LolaEventInstanceDeployment::StaleSampleAction::kForceRelease)
+               ? kStaleSampleActionForceRelease
+               : kStaleSampleActionMarkDegraded;
+}
+
+LolaEventInstanceDeployment::StaleSampleAction StaleSampleActionFromString(
+    const std::string_view stale_sample_action) noexcept
+{
+    if (stale_sample_action == kStaleSampleActionMarkDegraded)
+    {
+        return LolaEventInstanceDeployment::StaleSampleAction::kMarkDegraded;
+    }
+    if (stale_sample_action == kStaleSampleActionForceRelease)
+    {
+        return LolaEventInstanceDeployment::StaleSampleAction::kForceRelease;
+    }
+    score::mw::log::LogFatal("lola") << "Invalid value " << stale_sample_action << " for " << kStaleSampleActionKey
+                                     << " in serialized LolaEventInstanceDeployment. Terminating.";
+    std::terminate();
+}
+
 }  // namespace
 
-LolaEventInstanceDeployment::LolaEventInstanceDeployment(std::optional<SampleSlotCountType> number_of_sample_slots,
-                                                         std::optional<SubscriberCountType> max_subscribers,
-                                                         std::optional<std::uint8_t> max_concurrent_allocations,
-                                                         const bool enforce_max_samples,
-                                                         const TracingSlotSizeType number_of_tracing_slots) noexcept
+LolaEventInstanceDeployment::LolaEventInstanceDeployment(
+    std::optional<SampleSlotCountType> number_of_sample_slots,
+    std::optional<SubscriberCountType> max_subscribers,
+    std::optional<std::uint8_t> max_concurrent_allocations,
+    const bool enforce_max_samples,
+    const TracingSlotSizeType number_of_tracing_slots,
+    const SubscriptionControlWidth subscription_control_width,
+    const PrefetchBytesType prefetch_bytes,
+    const SampleHoldTimeType max_sample_hold_time_ms,
+    const StaleSampleAction stale_sample_action) noexcept
     : max_subscribers_{max_subscribers},
       max_concurrent_allocations_{max_concurrent_allocations},
       enforce_max_samples_{enforce_max_samples},
       number_of_sample_slots_{number_of_sample_slots},
-      number_of_tracing_slots_{number_of_tracing_slots}
+      number_of_tracing_slots_{number_of_tracing_slots},
+      subscription_control_width_{subscription_control_width},
+      prefetch_bytes_{prefetch_bytes},
+      max_sample_hold_time_ms_{max_sample_hold_time_ms},
+      stale_sample_action_{stale_sample_action}
 {
 }
 
@@ -70,13 +142,29 @@ LolaEventInstanceDeployment LolaEventInstanceDeployment::CreateFromJson(const sc
     const auto number_of_tracing_slots_opt =
         GetOptionalValueFromJson<TracingSlotSizeType>(json_object, kNumberOfIpcTracingSlotsKey);
 
+    const auto subscription_control_width = SubscriptionControlWidthFromBits(
+        GetOptionalValueFromJson<std::uint8_t>(json_object, kSubscriptionControlWidthKey)
+            .value_or(kSubscriptionControlWidth32Bit));
+
     auto number_of_tracing_slots = number_of_tracing_slots_opt.value_or(kNumberOfIpcTracingSlotsDefault);
+    const auto prefetch_bytes =
+        GetOptionalValueFromJson<PrefetchBytesType>(json_object, kPrefetchBytesKey).value_or(PrefetchBytesType{0U});
+    const auto max_sample_hold_time_ms =
+        GetOptionalValueFromJson<SampleHoldTimeType>(json_object, kMaxSampleHoldTimeMsKey)
+            .value_or(SampleHoldTimeType{0U});
+    const auto stale_sample_action = StaleSampleActionFromString(
+        GetOptionalValueFromJson<std::string_view>(json_object, kStaleSampleActionKey)
+            .value_or(kStaleSampleActionMarkDegraded));
 
     return LolaEventInstanceDeployment(number_of_sample_slots,
                                        max_subscribers,
                                        max_concurrent_allocations,
                                        enforce_max_samples,
-                                       number_of_tracing_slots);
+                                       number_of_tracing_slots,
+                                       subscription_control_width,
+                                       prefetch_bytes,
+                                       max_sample_hold_time_ms,
+                                       stale_sample_action);
 }
 
 // Suppress "AUTOSAR C++14 A15-5-3" rule finding. This rule states: "The std::terminate() function shall not be called
@@ -106,6 +194,15 @@ score::json::Object LolaEventInstanceDeployment::Serialize() const noexcept
     // We always turn of ipc tracing. I.e., serialize  kNumberOfIpcTracingSlotsKey as false
     json_object[kNumberOfIpcTracingSlotsKey] = static_cast<std::uint8_t>(0U);
 
+    json_object[kSubscriptionControlWidthKey] =
+        score::json::Any{SubscriptionControlWidthToBits(subscription_control_width_)};
+
+    json_object[kPrefetchBytesKey] = score::json::Any{prefetch_bytes_};
+
+    json_object[kMaxSampleHoldTimeMsKey] = score::json::Any{max_sample_hold_time_ms_};
+    json_object[kStaleSampleActionKey] =
+        score::json::Any{std::string{StaleSampleActionToString(stale_sample_action_)}};
+
     return json_object;
 }
 
@@ -146,6 +243,26 @@ auto LolaEventInstanceDeployment::GetNumberOfTracingSlots() const noexcept -> Tr
     return number_of_tracing_slots_;
 }
 
+auto LolaEventInstanceDeployment::GetSubscriptionControlWidth() const noexcept -> SubscriptionControlWidth
+{
+    return subscription_control_width_;
+}
+
+auto LolaEventInstanceDeployment::GetPrefetchBytes() const noexcept -> PrefetchBytesType
+{
+    return prefetch_bytes_;
+}
+
+auto LolaEventInstanceDeployment::GetMaxSampleHoldTimeMs() const noexcept -> SampleHoldTimeType
+{
+    return max_sample_hold_time_ms_;
+}
+
+auto LolaEventInstanceDeployment::GetStaleSampleAction() const noexcept -> StaleSampleAction
+{
+    return stale_sample_action_;
+}
+
 void LolaEventInstanceDeployment::SetNumberOfSampleSlots(SampleSlotCountType number_of_sample_slots) noexcept
 {
 
@@ -159,11 +276,17 @@ bool operator==(const LolaEventInstanceDeployment& lhs, const LolaEventInstanceD
     const bool max_subscribers_equal = (lhs.max_subscribers_ == rhs.max_subscribers_);
     const bool max_concurrent_allocations_equal = (lhs.max_concurrent_allocations_ == rhs.max_concurrent_allocations_);
     const bool enforce_max_samples_equal = (lhs.enforce_max_samples_ == rhs.enforce_max_samples_);
+    const bool subscription_control_width_equal =
+        (lhs.subscription_control_width_ == rhs.subscription_control_width_);
+    const bool prefetch_bytes_equal = (lhs.prefetch_bytes_ == rhs.prefetch_bytes_);
+    const bool max_sample_hold_time_equal = (lhs.max_sample_hold_time_ms_ == rhs.max_sample_hold_time_ms_);
+    const bool stale_sample_action_equal = (lhs.stale_sample_action_ == rhs.stale_sample_action_);
     // Adding Brackets to the expression does not give additional value since only one logical operator is used which
     // is independent of the execution order
     // coverity[autosar_cpp14_a5_2_6_violation]
     return (number_of_sample_slots_equal && number_of_tracing_slots_equal && max_subscribers_equal &&
-            max_concurrent_allocations_equal && enforce_max_samples_equal);
+            max_concurrent_allocations_equal && enforce_max_samples_equal && subscription_control_width_equal &&
+            prefetch_bytes_equal && max_sample_hold_time_equal && stale_sample_action_equal);
 }
 
 }  // namespace score::mw::com::impl
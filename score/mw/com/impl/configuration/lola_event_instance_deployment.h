@@ -26,14 +26,46 @@ class LolaEventInstanceDeployment
 {
   public:
     using SampleSlotCountType = std::uint16_t;
-    using SubscriberCountType = std::uint8_t;
+    using SubscriberCountType = std::uint16_t;
     using TracingSlotSizeType = std::uint8_t;
+    using PrefetchBytesType = std::uint32_t;
+    using SampleHoldTimeType = std::uint32_t;
+
+    /// \brief Width of the atomic word, in which the subscription state (number of subscribers and subscribed slots)
+    ///        of an event is kept in shared memory.
+    /// \details k32Bit packs an 8 bit subscriber count and a 16 bit slot count and therefore supports at most 255
+    ///          subscribers. k64Bit packs a 32 bit subscriber count and a 32 bit slot count and supports up to the
+    ///          maximum value of SubscriberCountType.
+    enum class SubscriptionControlWidth : std::uint8_t
+    {
+        k32Bit,
+        k64Bit,
+    };
+
+    /// \brief What the skeleton does with a consumer, which holds a sample longer than the maximum sample hold time.
+    /// \details kMarkDegraded only marks the consumer as degraded and logs it. The mark only keeps the provider from
+    ///          logging the consumer again, it isn't visible to the consumer. kForceRelease additionally releases the
+    ///          stale references on behalf of the consumer, so that their slots can be reused for new samples.
+    enum class StaleSampleAction : std::uint8_t
+    {
+        kMarkDegraded,
+        kForceRelease,
+    };
+
+    /// \brief Maximum number of subscribers, which can be handled by SubscriptionControlWidth::k32Bit.
+    static constexpr SubscriberCountType kMaxSubscribersOf32BitSubscriptionControl{255U};
 
     explicit LolaEventInstanceDeployment(std::optional<SampleSlotCountType> number_of_sample_slots,
                                          std::optional<SubscriberCountType> max_subscribers,
                                          std::optional<std::uint8_t> max_concurrent_allocations,
                                          const bool enforce_max_samples,
-                                         const TracingSlotSizeType number_of_tracing_slots) noexcept;
+                                         const TracingSlotSizeType number_of_tracing_slots,
+                                         const SubscriptionControlWidth subscription_control_width =
+                                             SubscriptionControlWidth::k32Bit,
+                                         const PrefetchBytesType prefetch_bytes = 0U,
+                                         const SampleHoldTimeType max_sample_hold_time_ms = 0U,
+                                         const StaleSampleAction stale_sample_action =
+                                             StaleSampleAction::kMarkDegraded) noexcept;
 
     explicit LolaEventInstanceDeployment(const score::json::Object& json_object) noexcept;
 
@@ -48,6 +80,14 @@ class LolaEventInstanceDeployment
 
     [[nodiscard]] TracingSlotSizeType GetNumberOfTracingSlots() const noexcept;
 
+    [[nodiscard]] SubscriptionControlWidth GetSubscriptionControlWidth() const noexcept;
+
+    [[nodiscard]] PrefetchBytesType GetPrefetchBytes() const noexcept;
+
+    [[nodiscard]] SampleHoldTimeType GetMaxSampleHoldTimeMs() const noexcept;
+
+    [[nodiscard]] StaleSampleAction GetStaleSampleAction() const noexcept;
+
     /// \brief max subscribers slots is only relevant/required on skeleton side. On the proxy side it is irrelevant.
     ///         Therefore, it is optional!
     // Note the struct is not compliant to POD type containing non-POD member.
@@ -73,6 +113,16 @@ class LolaEventInstanceDeployment
     // Non-zero values greater than one for this parameter only make sense on the skeleton side. For the proxy it is
     // just important if the tracing is enabled or not, i.e., if this variable is zero or non-zero.
     TracingSlotSizeType number_of_tracing_slots_;
+    /// \brief Only relevant on the skeleton side, where the subscription control gets created in shared memory.
+    SubscriptionControlWidth subscription_control_width_;
+    /// \brief Only relevant on the proxy side. Number of bytes at the start of each sample, which get prefetched into
+    ///         the cache by GetNewSamples() before the samples are handed out. Zero disables the prefetching.
+    PrefetchBytesType prefetch_bytes_;
+    /// \brief Only relevant on the skeleton side. Maximum time in milliseconds, a consumer may hold a sample, before
+    ///         the skeleton treats the reference as stale. Zero disables the sample leases.
+    SampleHoldTimeType max_sample_hold_time_ms_;
+    /// \brief Only relevant on the skeleton side. What to do with consumers holding stale references.
+    StaleSampleAction stale_sample_action_;
 };
 
 bool operator==(const LolaEventInstanceDeployment& lhs, const LolaEventInstanceDeployment& rhs) noexcept;
@@ -17,6 +17,8 @@
 #include <gtest/gtest.h>
 #include <cstdint>
 #include <limits>
+#include <string>
+#include <string_view>
 
 namespace score::mw::com::impl
 {
@@ -77,6 +79,132 @@ TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithoutO
     ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
 }
 
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWith64BitSubscriptionControl)
+{
+    // Given a deployment with more than 255 subscribers and a 64 bit subscription control
+    LolaEventInstanceDeployment unit{
+        10U, 1000U, 2U, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit};
+
+    // When serializing and deserializing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the subscriber count and the subscription control width are preserved
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit.max_subscribers_, 1000U);
+    EXPECT_EQ(reconstructed_unit.GetSubscriptionControlWidth(),
+              LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit);
+}
+
+TEST(LolaEventInstanceDeploymentTest, SubscriptionControlWidthIsSerializedInBits)
+{
+    // Given a deployment with a 64 bit and one with a 32 bit subscription control
+    const LolaEventInstanceDeployment unit_64{
+        10U, 1000U, 2U, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit};
+    const LolaEventInstanceDeployment unit_32{
+        10U, 11U, 2U, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit};
+
+    // When serializing them
+    const auto serialized_unit_64{unit_64.Serialize()};
+    const auto serialized_unit_32{unit_32.Serialize()};
+
+    // Then the width is stored in bits, like in the mw_com_config.json
+    const auto it_64 = serialized_unit_64.find("subscriptionControlWidth");
+    ASSERT_NE(it_64, serialized_unit_64.end());
+    EXPECT_EQ(it_64->second.As<std::uint8_t>().value(), 64U);
+    const auto it_32 = serialized_unit_32.find("subscriptionControlWidth");
+    ASSERT_NE(it_32, serialized_unit_32.end());
+    EXPECT_EQ(it_32->second.As<std::uint8_t>().value(), 32U);
+}
+
+TEST(LolaEventInstanceDeploymentTest, SubscriptionControlWidthDefaultsTo32Bit)
+{
+    // When creating a deployment without specifying the subscription control width
+    const LolaEventInstanceDeployment unit{10U, 11U, 12U, true, 1};
+
+    // Then the 32 bit subscription control is used
+    EXPECT_EQ(unit.GetSubscriptionControlWidth(), LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit);
+}
+
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithPrefetchBytes)
+{
+    // Given a deployment, which prefetches 4096 bytes of each new sample
+    LolaEventInstanceDeployment unit{
+        10U, 11U, 12U, true, 0U, LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit, 4096U};
+
+    // When serializing and deserializing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the prefetch bytes are preserved
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit.GetPrefetchBytes(), 4096U);
+}
+
+TEST(LolaEventInstanceDeploymentTest, PrefetchBytesDefaultToZero)
+{
+    // When creating a deployment without specifying the prefetch bytes
+    const LolaEventInstanceDeployment unit{10U, 11U, 12U, true, 1};
+
+    // Then no bytes are prefetched
+    EXPECT_EQ(unit.GetPrefetchBytes(), 0U);
+}
+
+TEST_F(LolaEventInstanceDeploymentFixture, CanCreateFromSerializedObjectWithSampleLeases)
+{
+    // Given a deployment, which force-releases samples held longer than 100ms
+    LolaEventInstanceDeployment unit{10U,
+                                     11U,
+                                     12U,
+                                     true,
+                                     0U,
+                                     LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                     0U,
+                                     100U,
+                                     LolaEventInstanceDeployment::StaleSampleAction::kForceRelease};
+
+    // When serializing and deserializing it
+    const auto serialized_unit{unit.Serialize()};
+    LolaEventInstanceDeployment reconstructed_unit{serialized_unit};
+
+    // Then the maximum sample hold time and the stale sample action are preserved
+    ExpectLolaEventInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit.GetMaxSampleHoldTimeMs(), 100U);
+    EXPECT_EQ(reconstructed_unit.GetStaleSampleAction(), LolaEventInstanceDeployment::StaleSampleAction::kForceRelease);
+}
+
+TEST(LolaEventInstanceDeploymentTest, StaleSampleActionIsSerializedAsString)
+{
+    // Given a deployment, which force-releases stale samples
+    const LolaEventInstanceDeployment unit{10U,
+                                           11U,
+                                           12U,
+                                           true,
+                                           0U,
+                                           LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                           0U,
+                                           100U,
+                                           LolaEventInstanceDeployment::StaleSampleAction::kForceRelease};
+
+    // When serializing it
+    const auto serialized_unit{unit.Serialize()};
+
+    // Then the stale sample action is stored as string, like in the mw_com_config.json
+    const auto it = serialized_unit.find("staleSampleAction");
+    ASSERT_NE(it, serialized_unit.end());
+    EXPECT_EQ(it->second.As<std::string_view>().value(), "FORCE-RELEASE");
+}
+
+TEST(LolaEventInstanceDeploymentTest, SampleLeasesAreDisabledByDefault)
+{
+    // When creating a deployment without specifying the maximum sample hold time
+    const LolaEventInstanceDeployment unit{10U, 11U, 12U, true, 1};
+
+    // Then samples may be held for an unlimited time and stale consumers would only be marked as degraded
+    EXPECT_EQ(unit.GetMaxSampleHoldTimeMs(), 0U);
+    EXPECT_EQ(unit.GetStaleSampleAction(), LolaEventInstanceDeployment::StaleSampleAction::kMarkDegraded);
+}
+
 TEST(LolaEventInstanceDeploymentDeathTest, CreatingFromSerializedObjectWithMismatchedSerializationVersionTerminates)
 {
     LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
@@ -92,6 +220,34 @@ TEST(LolaEventInstanceDeploymentDeathTest, CreatingFromSerializedObjectWithMisma
     EXPECT_DEATH(LolaEventInstanceDeployment reconstructed_unit{serialized_unit}, ".*");
 }
 
+TEST(LolaEventInstanceDeploymentDeathTest, CreatingFromSerializedObjectWithInvalidSubscriptionControlWidthTerminates)
+{
+    LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
+
+    // Given a serialized deployment with the raw enum value instead of the width in bits
+    auto serialized_unit{unit.Serialize()};
+    auto it = serialized_unit.find("subscriptionControlWidth");
+    ASSERT_NE(it, serialized_unit.end());
+    it->second = json::Any{static_cast<std::uint8_t>(1U)};
+
+    // When deserializing it, then the program terminates
+    EXPECT_DEATH(LolaEventInstanceDeployment reconstructed_unit{serialized_unit}, ".*");
+}
+
+TEST(LolaEventInstanceDeploymentDeathTest, CreatingFromSerializedObjectWithUnknownStaleSampleActionTerminates)
+{
+    LolaEventInstanceDeployment unit{MakeLolaEventInstanceDeployment()};
+
+    // Given a serialized deployment with an unknown stale sample action
+    auto serialized_unit{unit.Serialize()};
+    auto it = serialized_unit.find("staleSampleAction");
+    ASSERT_NE(it, serialized_unit.end());
+    it->second = json::Any{std::string{"RELEASE-LATER"}};
+
+    // When deserializing it, then the program terminates
+    EXPECT_DEATH(LolaEventInstanceDeployment reconstructed_unit{serialized_unit}, ".*");
+}
+
 TEST(LolaEventInstanceDeploymentEqualityTest, EqualityOperatorForEqualStructs)
 {
     const std::uint16_t number_of_sample_slots{};
@@ -140,7 +296,57 @@ INSTANTIATE_TEST_SUITE_P(LolaEventInstanceDeploymentEqualityFixture,
                                               std::make_pair(LolaEventInstanceDeployment{10U, 11U, 12U, true, 1},
                                                              LolaEventInstanceDeployment{10U, 11U, 12U, false, 1}),
                                               std::make_pair(LolaEventInstanceDeployment{10U, 11U, 12U, true, 1},
-                                                             LolaEventInstanceDeployment{10U, 11U, 12U, true, 0})}));
+                                                             LolaEventInstanceDeployment{10U, 11U, 12U, true, 0}),
+                                              std::make_pair(
+                                                  LolaEventInstanceDeployment{10U, 11U, 12U, true, 1},
+                                                  LolaEventInstanceDeployment{
+                                                      10U,
+                                                      11U,
+                                                      12U,
+                                                      true,
+                                                      1,
+                                                      LolaEventInstanceDeployment::SubscriptionControlWidth::k64Bit}),
+                                              std::make_pair(
+                                                  LolaEventInstanceDeployment{10U, 11U, 12U, true, 1},
+                                                  LolaEventInstanceDeployment{
+                                                      10U,
+                                                      11U,
+                                                      12U,
+                                                      true,
+                                                      1,
+                                                      LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                                      64U}),
+                                              std::make_pair(
+                                                  LolaEventInstanceDeployment{10U, 11U, 12U, true, 1},
+                                                  LolaEventInstanceDeployment{
+                                                      10U,
+                                                      11U,
+                                                      12U,
+                                                      true,
+                                                      1,
+                                                      LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                                      0U,
+                                                      100U}),
+                                              std::make_pair(
+                                                  LolaEventInstanceDeployment{
+                                                      10U,
+                                                      11U,
+                                                      12U,
+                                                      true,
+                                                      1,
+                                                      LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                                      0U,
+                                                      100U},
+                                                  LolaEventInstanceDeployment{
+                                                      10U,
+                                                      11U,
+                                                      12U,
+                                                      true,
+                                                      1,
+                                                      LolaEventInstanceDeployment::SubscriptionControlWidth::k32Bit,
+                                                      0U,
+                                                      100U,
+                                                      LolaEventInstanceDeployment::StaleSampleAction::kForceRelease})}));
 
 TEST(LolaEventInstanceDeploymentGetSlotsTest, GetNumberOfSampleSlotsExcludingTracingSlotReturnOptionalByDefault)
 {
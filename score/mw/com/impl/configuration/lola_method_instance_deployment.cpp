@@ -25,20 +25,28 @@ namespace
 using std::string_view_literals::operator""sv;
 constexpr auto kQueueSizeKey = "queueSize"sv;
 constexpr auto kMethodEnabledKey = "use"sv;
+constexpr auto kPriorityKey = "priority"sv;
+constexpr auto kMaxConcurrentCallsKey = "maxConcurrentCalls"sv;
 }  // namespace
 
 LolaMethodInstanceDeployment::LolaMethodInstanceDeployment(std::optional<QueueSize> queue_size,
-                                                           MethodEnabledType enabled)
-    : queue_size_{queue_size}, enabled_{enabled}
+                                                           MethodEnabledType enabled,
+                                                           Priority priority,
+                                                           std::optional<ConcurrentCalls> max_concurrent_calls)
+    : queue_size_{queue_size}, enabled_{enabled}, priority_{priority}, max_concurrent_calls_{max_concurrent_calls}
 {
 }
 
 LolaMethodInstanceDeployment::LolaMethodInstanceDeployment(
     const score::json::Object& serialized_lola_method_instance_deployment)
-    : queue_size_{std::nullopt}, enabled_{}
+    : queue_size_{std::nullopt}, enabled_{}, priority_{kDefaultPriority}, max_concurrent_calls_{std::nullopt}
 {
     queue_size_ = GetOptionalValueFromJson<QueueSize>(serialized_lola_method_instance_deployment, kQueueSizeKey);
     enabled_ = GetValueFromJson<MethodEnabledType>(serialized_lola_method_instance_deployment, kMethodEnabledKey);
+    priority_ = GetOptionalValueFromJson<Priority>(serialized_lola_method_instance_deployment, kPriorityKey)
+                    .value_or(kDefaultPriority);
+    max_concurrent_calls_ =
+        GetOptionalValueFromJson<ConcurrentCalls>(serialized_lola_method_instance_deployment, kMaxConcurrentCallsKey);
 }
 
 LolaMethodInstanceDeployment LolaMethodInstanceDeployment::CreateFromJson(
@@ -55,6 +63,11 @@ score::json::Object LolaMethodInstanceDeployment::Serialize() const
         json_object[kQueueSizeKey] = score::json::Any{queue_size_.value()};
     }
     json_object[kMethodEnabledKey] = score::json::Any{enabled_};
+    json_object[kPriorityKey] = score::json::Any{priority_};
+    if (max_concurrent_calls_.has_value())
+    {
+        json_object[kMaxConcurrentCallsKey] = score::json::Any{max_concurrent_calls_.value()};
+    }
 
     return json_object;
 }
@@ -35,6 +35,13 @@ class LolaMethodInstanceDeployment
   public:
     using QueueSize = std::uint8_t;
     using MethodEnabledType = bool;
+    using Priority = std::uint8_t;
+    using ConcurrentCalls = std::uint8_t;
+
+    /**
+     * @brief Priority of methods, which don't configure one. Higher values are dispatched first.
+     */
+    constexpr static Priority kDefaultPriority{0U};
 
     /**
      * @brief Construct LolaMethodInstanceDeployment with optional queue size, because LolaMethodInstanceDeployment for
@@ -42,8 +49,15 @@ class LolaMethodInstanceDeployment
      * @param queue_size The maximum number of pending method requests that can be queued.
      * @param enabled  Flag to disable/enable the method. It is always filled on proxy side and it is unused on skeleton
      * side.
+     * @param priority Priority with which queued calls of this method are dispatched on skeleton side. Unused on proxy
+     * side.
+     * @param max_concurrent_calls Optional limit of calls of this method, which are executed concurrently on skeleton
+     * side. Unused on proxy side.
      */
-    explicit LolaMethodInstanceDeployment(std::optional<QueueSize> queue_size, MethodEnabledType enabled);
+    explicit LolaMethodInstanceDeployment(std::optional<QueueSize> queue_size,
+                                          MethodEnabledType enabled,
+                                          Priority priority = kDefaultPriority,
+                                          std::optional<ConcurrentCalls> max_concurrent_calls = std::nullopt);
 
     explicit LolaMethodInstanceDeployment(const score::json::Object& serialized_lola_method_instance_deployment);
 
@@ -74,11 +88,23 @@ class LolaMethodInstanceDeployment
      */
     std::optional<QueueSize> queue_size_;
     MethodEnabledType enabled_;
+
+    /**
+     * @brief Priority with which queued calls of this method are dispatched by the skeleton, when calls of several
+     * methods are pending. Calls of methods with a higher priority are dispatched first.
+     */
+    Priority priority_;
+
+    /**
+     * @brief The maximum number of calls of this method, which the skeleton executes concurrently. Unlimited if empty.
+     */
+    std::optional<ConcurrentCalls> max_concurrent_calls_;
 };
 
 inline bool operator==(const LolaMethodInstanceDeployment& lhs, const LolaMethodInstanceDeployment& rhs) noexcept
 {
-    return lhs.queue_size_ == rhs.queue_size_ && lhs.enabled_ == rhs.enabled_;
+    return lhs.queue_size_ == rhs.queue_size_ && lhs.enabled_ == rhs.enabled_ && lhs.priority_ == rhs.priority_ &&
+           lhs.max_concurrent_calls_ == rhs.max_concurrent_calls_;
 }
 
 }  // namespace score::mw::com::impl
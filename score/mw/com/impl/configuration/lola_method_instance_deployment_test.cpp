@@ -205,5 +205,56 @@ TEST(LolaMethodInstanceDeploymentSerializationTest, SerializeIncludesEnabled)
     EXPECT_FALSE(enabled_iter->second.As<bool>().value());
 }
 
+TEST(LolaMethodInstanceDeploymentTest, EqualityOperatorWithDifferentPriority)
+{
+    // Given two LolaMethodInstanceDeployments, which only differ in their priority
+    LolaMethodInstanceDeployment unit1{std::nullopt, true, 1U};
+    LolaMethodInstanceDeployment unit2{std::nullopt, true, 2U};
+
+    // When comparing them
+    // Then they should not be equal
+    EXPECT_FALSE(unit1 == unit2);
+}
+
+TEST(LolaMethodInstanceDeploymentTest, EqualityOperatorWithDifferentMaxConcurrentCalls)
+{
+    // Given two LolaMethodInstanceDeployments, which only differ in their concurrency limit
+    LolaMethodInstanceDeployment unit1{std::nullopt, true, 1U, 1U};
+    LolaMethodInstanceDeployment unit2{std::nullopt, true, 1U, std::nullopt};
+
+    // When comparing them
+    // Then they should not be equal
+    EXPECT_FALSE(unit1 == unit2);
+}
+
+TEST(LolaMethodInstanceDeploymentSerializationTest, CreateFromJsonWithoutSchedulingAttributesUsesDefaults)
+{
+    // Given a JSON object without priority and maxConcurrentCalls
+    score::json::Object json_object{};
+    json_object["use"] = score::json::Any{true};
+
+    // When creating from JSON
+    auto unit = LolaMethodInstanceDeployment::CreateFromJson(json_object);
+
+    // Then the method has the default priority and no concurrency limit
+    EXPECT_EQ(unit.priority_, LolaMethodInstanceDeployment::kDefaultPriority);
+    EXPECT_FALSE(unit.max_concurrent_calls_.has_value());
+}
+
+TEST(LolaMethodInstanceDeploymentSerializationTest, SerializeAndDeserializePreservesSchedulingAttributes)
+{
+    // Given a LolaMethodInstanceDeployment with priority and concurrency limit
+    const LolaMethodInstanceDeployment original_unit{std::nullopt, true, 7U, 3U};
+
+    // When serializing and deserializing
+    auto serialized = original_unit.Serialize();
+    auto reconstructed_unit = LolaMethodInstanceDeployment::CreateFromJson(serialized);
+
+    // Then priority and concurrency limit should be preserved
+    EXPECT_EQ(reconstructed_unit.priority_, 7U);
+    EXPECT_EQ(reconstructed_unit.max_concurrent_calls_, 3U);
+    EXPECT_EQ(reconstructed_unit, original_unit);
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl
@@ -28,6 +28,7 @@ constexpr auto kInstanceIdKeyInstDepl = "instanceId";
 constexpr auto kSharedMemorySizeKeyInstDepl = "sharedMemorySize";
 constexpr auto kControlAsilBMemorySizeKeyInstDepl = "controlAsilBMemorySize";
 constexpr auto kControlQmMemorySizeKeyInstDepl = "controlQmMemorySize";
+constexpr auto kShmNumaPolicyKeyInstDepl = "shmNumaPolicy";
 constexpr auto kEventsKeyInstDepl = "events";
 constexpr auto kFieldsKeyInstDepl = "fields";
 constexpr auto kMethodsKeyInstDepl = "methods";
@@ -126,7 +127,8 @@ bool operator==(const LolaServiceInstanceDeployment& lhs, const LolaServiceInsta
     // coverity[autosar_cpp14_a5_2_6_violation]
     return ((lhs.instance_id_ == rhs.instance_id_) && (lhs.shared_memory_size_ == rhs.shared_memory_size_) &&
             (lhs.control_asil_b_memory_size_ == rhs.control_asil_b_memory_size_) &&
-            (lhs.control_qm_memory_size_ == rhs.control_qm_memory_size_) && (lhs.events_ == rhs.events_) &&
+            (lhs.control_qm_memory_size_ == rhs.control_qm_memory_size_) &&
+            (lhs.shm_numa_policy_ == rhs.shm_numa_policy_) && (lhs.events_ == rhs.events_) &&
             (lhs.fields_ == rhs.fields_) && (lhs.methods_ == rhs.methods_) &&
             (lhs.strict_permissions_ == rhs.strict_permissions_) && (lhs.allowed_consumer_ == rhs.allowed_consumer_) &&
             (lhs.allowed_provider_ == rhs.allowed_provider_));
@@ -184,6 +186,12 @@ LolaServiceInstanceDeployment::LolaServiceInstanceDeployment(const score::json::
     {
         control_qm_memory_size_ = control_qm_memory_size_it->second.As<std::size_t>().value();
     }
+
+    const auto shm_numa_policy_it = json_object.find(kShmNumaPolicyKeyInstDepl);
+    if (shm_numa_policy_it != json_object.end())
+    {
+        shm_numa_policy_ = LolaShmNumaPolicy{shm_numa_policy_it->second.As<json::Object>().value()};
+    }
 }
 
 // Suppress "AUTOSAR C++14 A12-1-5" rule finding.
@@ -204,6 +212,7 @@ LolaServiceInstanceDeployment::LolaServiceInstanceDeployment(
       shared_memory_size_{},
       control_asil_b_memory_size_{},
       control_qm_memory_size_{},
+      shm_numa_policy_{},
       events_{std::move(events)},
       fields_{std::move(fields)},
       methods_{std::move(methods)},
@@ -240,6 +249,11 @@ score::json::Object LolaServiceInstanceDeployment::Serialize() const noexcept
         json_object[kControlQmMemorySizeKeyInstDepl] = score::json::Any{control_qm_memory_size_.value()};
     }
 
+    if (shm_numa_policy_.has_value())
+    {
+        json_object[kShmNumaPolicyKeyInstDepl] = shm_numa_policy_.value().Serialize();
+    }
+
     json_object[kEventsKeyInstDepl] = ConvertServiceElementMapToJson(events_);
     json_object[kFieldsKeyInstDepl] = ConvertServiceElementMapToJson(fields_);
     json_object[kMethodsKeyInstDepl] = ConvertServiceElementMapToJson(methods_);
@@ -17,6 +17,7 @@
 #include "score/mw/com/impl/configuration/lola_field_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_method_instance_deployment.h"
 #include "score/mw/com/impl/configuration/lola_service_instance_id.h"
+#include "score/mw/com/impl/configuration/lola_shm_numa_policy.h"
 #include "score/mw/com/impl/configuration/quality_type.h"
 
 #include "score/mw/com/impl/service_element_type.h"
@@ -71,6 +72,8 @@ class LolaServiceInstanceDeployment
     // coverity[autosar_cpp14_m11_0_1_violation]
     std::optional<std::size_t> control_qm_memory_size_;
     // coverity[autosar_cpp14_m11_0_1_violation]
+    std::optional<LolaShmNumaPolicy> shm_numa_policy_;
+    // coverity[autosar_cpp14_m11_0_1_violation]
     EventInstanceMapping events_;  // key = event name
     // coverity[autosar_cpp14_m11_0_1_violation]
     FieldInstanceMapping fields_;  // key = field name
@@ -79,6 +79,13 @@ TEST(LolaServiceInstanceDeployment, ControlQmMemorySizeIsOptional)
     ASSERT_FALSE(unit.control_qm_memory_size_.has_value());
 }
 
+TEST(LolaServiceInstanceDeployment, ShmNumaPolicyIsOptional)
+{
+    LolaServiceInstanceDeployment unit{};
+
+    ASSERT_FALSE(unit.shm_numa_policy_.has_value());
+}
+
 TEST(LolaServiceInstanceDeployment, SameServiceIdBothInstancesAnyIsCompatible)
 {
     EXPECT_TRUE(areCompatible(LolaServiceInstanceDeployment{LolaServiceInstanceId{43U}},
@@ -211,6 +218,19 @@ TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithSe
     ExpectLolaServiceInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
 }
 
+TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithShmNumaPolicy)
+{
+    LolaServiceInstanceDeployment unit{MakeLolaServiceInstanceDeployment()};
+    unit.shm_numa_policy_ = LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToNode, 1U};
+
+    const auto serialized_unit{unit.Serialize()};
+
+    LolaServiceInstanceDeployment reconstructed_unit{serialized_unit};
+
+    ExpectLolaServiceInstanceDeploymentObjectsEqual(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit, unit);
+}
+
 TEST_F(LolaServiceInstanceDeploymentFixture, CanCreateFromSerializedObjectWithoutOptionals)
 {
     const LolaServiceInstanceDeployment unit{MakeLolaServiceInstanceDeployment({}, {}, {}, {})};
@@ -0,0 +1,107 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/lola_shm_numa_policy.h"
+
+#include "score/mw/com/impl/configuration/configuration_common_resources.h"
+
+#include <score/assert.hpp>
+
+namespace score::mw::com::impl
+{
+
+namespace
+{
+
+using std::string_view_literals::operator""sv;
+
+constexpr auto kModeKey = "mode"sv;
+constexpr auto kNodeKey = "node"sv;
+
+constexpr auto kBindToProducerNodeMode = "bind-producer-node"sv;
+constexpr auto kInterleaveMode = "interleave"sv;
+constexpr auto kBindToNodeMode = "bind-node"sv;
+
+}  // namespace
+
+LolaShmNumaPolicy::LolaShmNumaPolicy(const Mode mode, const std::optional<NodeId> node) noexcept
+    : mode_{mode}, node_{node}
+{
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE((mode_ == Mode::kBindToNode) == node_.has_value(),
+                                                      "A NUMA node has to be given exactly for mode bind-node");
+}
+
+LolaShmNumaPolicy::LolaShmNumaPolicy(const score::json::Object& json_object) noexcept
+    : LolaShmNumaPolicy{static_cast<Mode>(GetValueFromJson<std::uint8_t>(json_object, kModeKey)),
+                        GetOptionalValueFromJson<NodeId>(json_object, kNodeKey)}
+{
+}
+
+score::json::Object LolaShmNumaPolicy::Serialize() const noexcept
+{
+    score::json::Object json_object{};
+    json_object[kModeKey] = score::json::Any{static_cast<std::uint8_t>(mode_)};
+    if (node_.has_value())
+    {
+        json_object[kNodeKey] = score::json::Any{node_.value()};
+    }
+    return json_object;
+}
+
+bool operator==(const LolaShmNumaPolicy& lhs, const LolaShmNumaPolicy& rhs) noexcept
+{
+    return ((lhs.mode_ == rhs.mode_) && (lhs.node_ == rhs.node_));
+}
+
+std::optional<LolaShmNumaPolicy::Mode> LolaShmNumaPolicyModeFromString(const std::string_view mode) noexcept
+{
+    if (mode == kBindToProducerNodeMode)
+    {
+        return LolaShmNumaPolicy::Mode::kBindToProducerNode;
+    }
+    if (mode == kInterleaveMode)
+    {
+        return LolaShmNumaPolicy::Mode::kInterleave;
+    }
+    if (mode == kBindToNodeMode)
+    {
+        return LolaShmNumaPolicy::Mode::kBindToNode;
+    }
+    return std::nullopt;
+}
+
+std::string_view ToString(const LolaShmNumaPolicy::Mode mode) noexcept
+{
+    // Suppress "AUTOSAR C++14 M6-4-3" rule finding. This rule declares: "A switch statement shall be a well-formed
+    // switch statement".
+    // The default label handles values outside of the enumeration, which can only be created by a cast.
+    // coverity[autosar_cpp14_m6_4_3_violation]
+    switch (mode)
+    {
+        case LolaShmNumaPolicy::Mode::kBindToProducerNode:
+            return kBindToProducerNodeMode;
+        case LolaShmNumaPolicy::Mode::kInterleave:
+            return kInterleaveMode;
+        case LolaShmNumaPolicy::Mode::kBindToNode:
+            return kBindToNodeMode;
+        default:
+            return "(unknown)"sv;
+    }
+}
+
+std::ostream& operator<<(std::ostream& ostream_out, const LolaShmNumaPolicy::Mode& mode)
+{
+    ostream_out << ToString(mode);
+    return ostream_out;
+}
+
+}  // namespace score::mw::com::impl
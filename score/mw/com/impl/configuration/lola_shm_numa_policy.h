@@ -0,0 +1,73 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_CONFIGURATION_LOLA_SHM_NUMA_POLICY_H
+#define SCORE_MW_COM_IMPL_CONFIGURATION_LOLA_SHM_NUMA_POLICY_H
+
+#include "score/json/json_parser.h"
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string_view>
+
+namespace score::mw::com::impl
+{
+
+/// \brief NUMA placement of the shared-memory objects (data and control) of a LoLa service instance.
+///
+/// The policy is applied by the skeleton, when it creates the shared-memory objects. It is a pure performance hint:
+/// If it can't be applied on the running system, the shared-memory objects stay with the default policy of the process.
+class LolaShmNumaPolicy
+{
+  public:
+    using NodeId = std::uint16_t;
+
+    enum class Mode : std::uint8_t
+    {
+        /// Pages are bound to the NUMA node, on which the providing thread runs when it creates the shared-memory.
+        kBindToProducerNode,
+        /// Pages are interleaved over all NUMA nodes, the providing process is allowed to allocate memory from.
+        kInterleave,
+        /// Pages are bound to the configured NUMA node.
+        kBindToNode,
+    };
+
+    /// \brief Creates a policy. A node has to be given exactly for Mode::kBindToNode.
+    explicit LolaShmNumaPolicy(const Mode mode, const std::optional<NodeId> node = std::nullopt) noexcept;
+    explicit LolaShmNumaPolicy(const score::json::Object& json_object) noexcept;
+
+    score::json::Object Serialize() const noexcept;
+
+    // Note the class is not compliant to POD type containing non-POD member.
+    // The class is used as a config storage obtained by performing the parsing json object.
+    // Public access is required by the implementation to reach the following members of the class.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    Mode mode_;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::optional<NodeId> node_;
+};
+
+bool operator==(const LolaShmNumaPolicy& lhs, const LolaShmNumaPolicy& rhs) noexcept;
+
+/// \brief Converts the mode string of the "shm-numa-policy" in the mw_com_config.json into a Mode.
+/// \return The mode or an empty optional, if the string doesn't name a mode.
+std::optional<LolaShmNumaPolicy::Mode> LolaShmNumaPolicyModeFromString(const std::string_view mode) noexcept;
+
+/// \brief Converts a Mode into the mode string of the "shm-numa-policy" in the mw_com_config.json.
+std::string_view ToString(const LolaShmNumaPolicy::Mode mode) noexcept;
+
+std::ostream& operator<<(std::ostream& ostream_out, const LolaShmNumaPolicy::Mode& mode);
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_CONFIGURATION_LOLA_SHM_NUMA_POLICY_H
@@ -0,0 +1,105 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/lola_shm_numa_policy.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+TEST(LolaShmNumaPolicyTest, CanCreateFromSerializedObject)
+{
+    // Given a policy, which binds to a named node
+    const LolaShmNumaPolicy unit{LolaShmNumaPolicy::Mode::kBindToNode, 3U};
+
+    // When serializing and deserializing it
+    const LolaShmNumaPolicy reconstructed_unit{unit.Serialize()};
+
+    // Then the reconstructed policy is equal to the original
+    EXPECT_EQ(reconstructed_unit, unit);
+    EXPECT_EQ(reconstructed_unit.node_, 3U);
+}
+
+TEST(LolaShmNumaPolicyTest, CanCreateFromSerializedObjectWithoutNode)
+{
+    // Given an interleave policy, which has no node
+    const LolaShmNumaPolicy unit{LolaShmNumaPolicy::Mode::kInterleave};
+
+    // When serializing and deserializing it
+    const LolaShmNumaPolicy reconstructed_unit{unit.Serialize()};
+
+    // Then the reconstructed policy is equal to the original
+    EXPECT_EQ(reconstructed_unit, unit);
+    EXPECT_FALSE(reconstructed_unit.node_.has_value());
+}
+
+TEST(LolaShmNumaPolicyTest, PoliciesWithDifferentNodesAreNotEqual)
+{
+    EXPECT_FALSE((LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToNode, 0U} ==
+                  LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToNode, 1U}));
+    EXPECT_FALSE((LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kInterleave} ==
+                  LolaShmNumaPolicy{LolaShmNumaPolicy::Mode::kBindToProducerNode}));
+}
+
+TEST(LolaShmNumaPolicyTest, ModesCanBeParsedFromTheirStreamedRepresentation)
+{
+    for (const auto mode : {LolaShmNumaPolicy::Mode::kBindToProducerNode,
+                            LolaShmNumaPolicy::Mode::kInterleave,
+                            LolaShmNumaPolicy::Mode::kBindToNode})
+    {
+        // Given the string representation of a mode
+        std::ostringstream oss{};
+        oss << mode;
+
+        // When parsing it
+        const auto parsed_mode = LolaShmNumaPolicyModeFromString(oss.str());
+
+        // Then the same mode is returned
+        EXPECT_EQ(parsed_mode, mode);
+    }
+}
+
+TEST(LolaShmNumaPolicyTest, UnknownModeStringIsNotParsed)
+{
+    EXPECT_FALSE(LolaShmNumaPolicyModeFromString("bind-consumer-node").has_value());
+}
+
+TEST(LolaShmNumaPolicyTest, OperatorStreamOutputsUnknownForInvalidValue)
+{
+    // Given a mode set to an invalid value
+    std::ostringstream oss{};
+    const auto invalid_value = static_cast<LolaShmNumaPolicy::Mode>(0xFF);
+
+    // When streaming it
+    oss << invalid_value;
+
+    // Then the output is "(unknown)"
+    EXPECT_EQ(oss.str(), "(unknown)");
+}
+
+TEST(LolaShmNumaPolicyDeathTest, BindToNodeWithoutNodeTerminates)
+{
+    EXPECT_DEATH(LolaShmNumaPolicy(LolaShmNumaPolicy::Mode::kBindToNode), ".*");
+}
+
+TEST(LolaShmNumaPolicyDeathTest, InterleaveWithNodeTerminates)
+{
+    EXPECT_DEATH(LolaShmNumaPolicy(LolaShmNumaPolicy::Mode::kInterleave, 1U), ".*");
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
@@ -0,0 +1,39 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
+
+namespace score::mw::com::impl
+{
+
+std::ostream& operator<<(std::ostream& ostream_out, const ShmPrefaultMode& mode)
+{
+    switch (mode)
+    {
+        case ShmPrefaultMode::kNone:
+            ostream_out << "NONE";
+            break;
+        case ShmPrefaultMode::kPrefault:
+            ostream_out << "PREFAULT";
+            break;
+        case ShmPrefaultMode::kPrefaultAndLock:
+            ostream_out << "PREFAULT-AND-LOCK";
+            break;
+        default:
+            ostream_out << "(unknown)";
+            break;
+    }
+
+    return ostream_out;
+}
+
+}  // namespace score::mw::com::impl
@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
+#define SCORE_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
+
+#include <cstdint>
+#include <ostream>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Defines, whether the pages of the shm-objects of LoLa are faulted in (and locked) upfront, when a skeleton
+///        creates/opens them on PrepareOffer() or a proxy opens them on creation.
+enum class ShmPrefaultMode : std::uint8_t
+{
+    /// pages are faulted in lazily on first access, e.g. within Allocate()/Send() or GetNewSamples()
+    kNone,
+    /// all pages are touched once, so that the first accesses on the realtime path don't fault
+    kPrefault,
+    /// all pages are touched once and then locked via mlock(), so that they also aren't swapped out or reclaimed
+    kPrefaultAndLock,
+};
+
+std::ostream& operator<<(std::ostream& ostream_out, const ShmPrefaultMode& mode);
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_CONFIGURATION_SHM_PREFAULT_MODE_H
@@ -0,0 +1,53 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
+#include <gtest/gtest.h>
+#include <ostream>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+TEST(ShmPrefaultModeTest, OperatorStreamOutputsCorrectStringForAllModes)
+{
+    // Given all valid ShmPrefaultModes
+    for (const auto& [mode, expected_output] : {std::make_pair(ShmPrefaultMode::kNone, "NONE"),
+                                                std::make_pair(ShmPrefaultMode::kPrefault, "PREFAULT"),
+                                                std::make_pair(ShmPrefaultMode::kPrefaultAndLock, "PREFAULT-AND-LOCK")})
+    {
+        std::ostringstream oss;
+
+        // When streaming to ostringstream
+        oss << mode;
+
+        // Then the output matches the value used in the configuration
+        EXPECT_EQ(oss.str(), expected_output);
+    }
+}
+
+TEST(ShmPrefaultModeTest, OperatorStreamOutputsUnknownForInvalidValue)
+{
+    // Given a ShmPrefaultMode set to an invalid value
+    std::ostringstream oss;
+    auto invalid_value = static_cast<ShmPrefaultMode>(0xFF);
+
+    // When streaming to ostringstream
+    oss << invalid_value;
+
+    // Then the output should match "unknown"
+    EXPECT_EQ(oss.str(), "(unknown)");
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
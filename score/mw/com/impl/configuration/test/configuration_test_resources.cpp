@@ -147,6 +147,10 @@ void ConfigurationStructsFixture::ExpectLolaEventInstanceDeploymentObjectsEqual(
     EXPECT_EQ(lhs.max_concurrent_allocations_, rhs.max_concurrent_allocations_);
     EXPECT_EQ(lhs.enforce_max_samples_, rhs.enforce_max_samples_);
     EXPECT_EQ(lhs.GetNumberOfSampleSlotsExcludingTracingSlot(), rhs.GetNumberOfSampleSlotsExcludingTracingSlot());
+    EXPECT_EQ(lhs.GetSubscriptionControlWidth(), rhs.GetSubscriptionControlWidth());
+    EXPECT_EQ(lhs.GetPrefetchBytes(), rhs.GetPrefetchBytes());
+    EXPECT_EQ(lhs.GetMaxSampleHoldTimeMs(), rhs.GetMaxSampleHoldTimeMs());
+    EXPECT_EQ(lhs.GetStaleSampleAction(), rhs.GetStaleSampleAction());
 }
 
 void ConfigurationStructsFixture::ExpectLolaFieldInstanceDeploymentObjectsEqual(
@@ -174,6 +178,7 @@ void ConfigurationStructsFixture::ExpectLolaServiceInstanceDeploymentObjectsEqua
     EXPECT_EQ(lhs.shared_memory_size_, rhs.shared_memory_size_);
     EXPECT_EQ(lhs.control_asil_b_memory_size_, rhs.control_asil_b_memory_size_);
     EXPECT_EQ(lhs.control_qm_memory_size_, rhs.control_qm_memory_size_);
+    EXPECT_EQ(lhs.shm_numa_policy_, rhs.shm_numa_policy_);
 
     ASSERT_EQ(lhs.events_.size(), rhs.events_.size());
     for (const auto& lhs_it : lhs.events_)
@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_DEADLINE_MISSED_HANDLER_H
+#define SCORE_MW_COM_IMPL_DEADLINE_MISSED_HANDLER_H
+
+#include <score/callback.hpp>
+
+#include <chrono>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Callback for missed deadlines of periodic events on proxy side.
+/// \details This callback is called from a runtime-wide monitoring thread, which is shared by all events with a deadline.
+/// This in general means, that the user shall not do any long-running activities within this handler as it delays the
+/// deadline monitoring of all other events.
+/// The handler is called without holding any lock of the monitor, so SetDeadlineMissedHandler and
+/// UnsetDeadlineMissedHandler may be called from within it. Calling UnsetDeadlineMissedHandler for the event of the
+/// running handler does not wait for the handler to return. Alternatively, the handler may return false to be unset.
+/// See return-value description.
+/// \param time_since_last_update time since the provider has sent the latest sample or since the handler has been set,
+///        if the provider didn't send a sample since then.
+/// \return true if the registered handler shall be kept, false if it shall be unset/unregistered.
+using DeadlineMissedHandler = score::cpp::callback<bool(std::chrono::nanoseconds time_since_last_update)>;
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_DEADLINE_MISSED_HANDLER_H
@@ -0,0 +1,433 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/deferred_logger.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/assert.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace score::mw::com::impl
+{
+
+namespace
+{
+
+// Suppress "AUTOSAR C++14 A3-3-2" rule finding: "Static and thread-local objects shall be constant-initialized.".
+// Both objects are constant-initialized, the finding is a false positive.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+std::atomic<std::uint64_t> next_instance_id{1U};
+
+/// \brief Ring of the current thread. Marks the ring on thread exit, so that the consumer removes it.
+struct ThreadRing
+{
+    ThreadRing() noexcept = default;
+    ThreadRing(const ThreadRing&) = delete;
+    ThreadRing(ThreadRing&&) = delete;
+    ThreadRing& operator=(const ThreadRing&) = delete;
+    ThreadRing& operator=(ThreadRing&&) = delete;
+
+    ~ThreadRing() noexcept
+    {
+        if (ring != nullptr)
+        {
+            ring->MarkOwnerExited();
+        }
+    }
+
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types
+    // shall be private.". We need these data elements to be organized into a coherent organized data structure.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint64_t logger_instance_id{0U};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::shared_ptr<DeferredLogRing> ring{};
+};
+
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local ThreadRing thread_ring{};
+
+/// \brief Set while a DeferrableLogStream of the current thread writes into its ring, as the ring only provides a single
+///        slot to its producer at a time. Nested log messages (e.g. logged by an argument) are dropped.
+// coverity[autosar_cpp14_a3_3_2_violation : FALSE]
+thread_local bool thread_stream_active{false};
+
+constexpr std::string_view kTruncationMarker{"[truncated]"};
+
+std::size_t RoundUpToPowerOfTwo(const std::size_t value) noexcept
+{
+    std::size_t result{1U};
+    while (result < value)
+    {
+        result <<= 1U;
+    }
+    return result;
+}
+
+template <typename T>
+T ReadRaw(const DeferredLogRecord& record, std::size_t& offset) noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+    T value{};
+    // NOLINTBEGIN(score-banned-function) deserialization of trivially copyable values from a byte buffer
+    score::cpp::ignore = std::memcpy(&value, &record.payload.at(offset), sizeof(T));
+    // NOLINTEND(score-banned-function) deserialization of trivially copyable values from a byte buffer
+    offset += sizeof(T);
+    return value;
+}
+
+mw::log::LogStream CreateLogStream(const mw::log::LogLevel log_level, const std::string_view context) noexcept
+{
+    switch (log_level)
+    {
+        case mw::log::LogLevel::kFatal:
+            return mw::log::LogFatal(context);
+        case mw::log::LogLevel::kError:
+            return mw::log::LogError(context);
+        case mw::log::LogLevel::kWarn:
+            return mw::log::LogWarn(context);
+        case mw::log::LogLevel::kInfo:
+            return mw::log::LogInfo(context);
+        case mw::log::LogLevel::kDebug:
+            return mw::log::LogDebug(context);
+        case mw::log::LogLevel::kVerbose:
+        case mw::log::LogLevel::kOff:
+        default:
+            return mw::log::LogVerbose(context);
+    }
+}
+
+}  // namespace
+
+void DeferredLogRecord::AppendString(const std::string_view value) noexcept
+{
+    constexpr auto kHeaderSize = sizeof(DeferredLogArgumentType) + sizeof(std::uint16_t);
+    if ((truncated) || ((payload_size + kHeaderSize) >= kPayloadCapacity))
+    {
+        truncated = true;
+        return;
+    }
+    const auto length = static_cast<std::uint16_t>(std::min(value.size(), kPayloadCapacity - payload_size - kHeaderSize));
+    Append(DeferredLogArgumentType::kString, &length, sizeof(length));
+    // NOLINTBEGIN(score-banned-function) copy of the string into the byte buffer
+    score::cpp::ignore = std::memcpy(&payload.at(payload_size), value.data(), length);
+    // NOLINTEND(score-banned-function) copy of the string into the byte buffer
+    payload_size = static_cast<std::uint16_t>(payload_size + length);
+    truncated = (length < value.size());
+}
+
+DeferredLogRing::DeferredLogRing(const std::size_t capacity) noexcept
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+    // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". The allocation throws
+    // only on allocation failure, which directly leads to a termination based on a compiler hook.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    : records_(RoundUpToPowerOfTwo(std::max(capacity, std::size_t{1U}))),
+      index_mask_{records_.size() - 1U},
+      write_index_{0U},
+      read_index_{0U},
+      owner_exited_{false}
+{
+}
+
+DeferredLogger& DeferredLogger::GetInstance() noexcept
+{
+    // Suppress "AUTOSAR C++14 A3-3-2" rule finding: "Static and thread-local objects shall be constant-initialized.".
+    // The instance is intentionally created on first use, so that it is available to all call sites independent of
+    // the initialization order of the process.
+    // coverity[autosar_cpp14_a3_3_2_violation]
+    static DeferredLogger instance{};
+    return instance;
+}
+
+DeferredLogger::DeferredLogger() noexcept
+    : instance_id_{next_instance_id.fetch_add(1U, std::memory_order_relaxed)},
+      enabled_{false},
+      records_per_thread_{kDefaultRecordsPerThread},
+      dropped_records_{0U},
+      truncated_records_{0U},
+      reported_dropped_records_{0U},
+      registration_mutex_{},
+      registered_rings_{},
+      drain_mutex_{},
+      rings_{},
+      drain_task_mutex_{},
+      drain_task_wake_up_{},
+      drain_task_{}
+{
+}
+
+DeferredLogger::~DeferredLogger() noexcept
+{
+    Disable();
+}
+
+void DeferredLogger::Enable(const std::size_t records_per_thread) noexcept
+{
+    records_per_thread_.store(records_per_thread, std::memory_order_relaxed);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void DeferredLogger::StartDrainTask(concurrency::Executor& executor) noexcept
+{
+    if (drain_task_.has_value())
+    {
+        return;
+    }
+    // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "I a function is declared to be
+    // noexcept, noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception"
+    // By design, if `executor.Submit()` ever fails, we expect program termination.
+    // coverity[autosar_cpp14_a15_4_2_violation]
+    score::cpp::ignore = drain_task_.emplace(executor.Submit([this](const auto stop_token) noexcept {
+        Run(stop_token);
+    }));
+}
+
+void DeferredLogger::Disable() noexcept
+{
+    enabled_.store(false, std::memory_order_relaxed);
+    if (drain_task_.has_value())
+    {
+        drain_task_->Abort();
+        score::cpp::ignore = drain_task_->Wait();
+        drain_task_.reset();
+    }
+    score::cpp::ignore = Flush();
+    ReportDroppedRecords();
+}
+
+std::size_t DeferredLogger::Flush() noexcept
+{
+    std::lock_guard<std::mutex> lock{drain_mutex_};
+    {
+        // Only the newly registered rings are taken over under the registration lock, so that threads logging for the
+        // first time don't wait for the formatting below.
+        std::lock_guard<std::mutex> registration_lock{registration_mutex_};
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+        // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". insert throws
+        // only on allocation failure, which directly leads to a termination based on a compiler hook.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        score::cpp::ignore = rings_.insert(rings_.end(),
+                                           std::make_move_iterator(registered_rings_.begin()),
+                                           std::make_move_iterator(registered_rings_.end()));
+        registered_rings_.clear();
+    }
+
+    std::size_t output_records{0U};
+    auto ring_iterator = rings_.begin();
+    while (ring_iterator != rings_.end())
+    {
+        // Checked before draining: once the owner has exited, nothing gets published anymore.
+        const auto owner_exited = (*ring_iterator)->HasOwnerExited();
+        output_records += (*ring_iterator)->Drain([](const DeferredLogRecord& record) noexcept {
+            Output(record);
+        });
+        if (owner_exited)
+        {
+            ring_iterator = rings_.erase(ring_iterator);
+        }
+        else
+        {
+            ++ring_iterator;
+        }
+    }
+    return output_records;
+}
+
+void DeferredLogger::Output(const DeferredLogRecord& record) noexcept
+{
+    auto log_stream = CreateLogStream(record.log_level, record.context);
+    std::size_t offset{0U};
+    while (offset < record.payload_size)
+    {
+        const auto type = ReadRaw<DeferredLogArgumentType>(record, offset);
+        switch (type)
+        {
+            case DeferredLogArgumentType::kBool:
+                log_stream << ReadRaw<bool>(record, offset);
+                break;
+            case DeferredLogArgumentType::kSigned:
+                log_stream << ReadRaw<std::int64_t>(record, offset);
+                break;
+            case DeferredLogArgumentType::kUnsigned:
+                log_stream << ReadRaw<std::uint64_t>(record, offset);
+                break;
+            case DeferredLogArgumentType::kFloatingPoint:
+                log_stream << ReadRaw<double>(record, offset);
+                break;
+            case DeferredLogArgumentType::kStringLiteral:
+                log_stream << ReadRaw<std::string_view>(record, offset);
+                break;
+            case DeferredLogArgumentType::kString:
+            {
+                const auto length = ReadRaw<std::uint16_t>(record, offset);
+                // Suppress "AUTOSAR C++14 A5-2-4" rule finding. This rule states: "reinterpret_cast shall not be
+                // used.". The payload contains the copied characters of the string.
+                // coverity[autosar_cpp14_a5_2_4_violation]
+                log_stream << std::string_view{reinterpret_cast<const char*>(&record.payload.at(offset)), length};
+                offset += length;
+                break;
+            }
+            // LCOV_EXCL_START defensive programming
+            default:
+                offset = record.payload_size;
+                break;
+                // LCOV_EXCL_STOP
+        }
+    }
+    if (record.truncated)
+    {
+        log_stream << kTruncationMarker;
+    }
+}
+
+DeferredLogRing& DeferredLogger::GetRingOfCurrentThread() noexcept
+{
+    if ((thread_ring.ring == nullptr) || (thread_ring.logger_instance_id != instance_id_))
+    {
+        if (thread_ring.ring != nullptr)
+        {
+            thread_ring.ring->MarkOwnerExited();
+        }
+        // Suppress "AUTOSAR C++14 A15-4-2" rule finding. This rule states: "If a function is declared to be noexcept,
+        // noexcept(true) or noexcept(<true condition>), then it shall not exit with an exception.". make_shared
+        // throws only on allocation failure, which directly leads to a termination based on a compiler hook.
+        // coverity[autosar_cpp14_a15_4_2_violation]
+        auto ring = std::make_shared<DeferredLogRing>(records_per_thread_.load(std::memory_order_relaxed));
+        {
+            std::lock_guard<std::mutex> lock{registration_mutex_};
+            registered_rings_.push_back(ring);
+        }
+        thread_ring.logger_instance_id = instance_id_;
+        thread_ring.ring = std::move(ring);
+    }
+    return *thread_ring.ring;
+}
+
+void DeferredLogger::Run(const score::cpp::stop_token& stop_token) noexcept
+{
+    // Suppress "AUTOSAR C++14 M0-1-3" and "AUTOSAR C++14 M0-1-9" rule violations. The rule states
+    // "A project shall not contain unused variables." and "There shall be no dead code.", respectively.
+    // Tolerated, this is a stop callback.
+    // score::cpp::stop_callback is an RAII class which registers a callback with stop_token on construction
+    // and deregisters it on destruction. Therefore, it is used again when it goes out of scope.
+    // coverity[autosar_cpp14_m0_1_9_violation : FALSE]
+    // coverity[autosar_cpp14_m0_1_3_violation : FALSE]
+    score::cpp::stop_callback wake_up_on_stop{stop_token, [this]() noexcept {
+                                                  std::lock_guard<std::mutex> lock{drain_task_mutex_};
+                                                  drain_task_wake_up_.notify_all();
+                                              }};
+
+    while (!stop_token.stop_requested())
+    {
+        score::cpp::ignore = Flush();
+        ReportDroppedRecords();
+
+        // Producers don't notify the drain task, so that logging stays free of system calls. The drain task polls
+        // instead.
+        std::unique_lock<std::mutex> lock{drain_task_mutex_};
+        score::cpp::ignore = drain_task_wake_up_.wait_for(lock, kDrainInterval, [&stop_token]() noexcept {
+            return stop_token.stop_requested();
+        });
+    }
+}
+
+void DeferredLogger::ReportDroppedRecords() noexcept
+{
+    const auto dropped_records = dropped_records_.load(std::memory_order_relaxed);
+    if (dropped_records == reported_dropped_records_)
+    {
+        return;
+    }
+    mw::log::LogWarn("lola") << "Dropped" << (dropped_records - reported_dropped_records_)
+                             << "deferred log messages, as the ring of their thread was full. Ring capacity:"
+                             << records_per_thread_.load(std::memory_order_relaxed) << "records per thread,"
+                             << dropped_records << "dropped in total.";
+    reported_dropped_records_ = dropped_records;
+}
+
+DeferrableLogStream::DeferrableLogStream(DeferredLogger& logger,
+                                         const mw::log::LogLevel log_level,
+                                         const std::string_view context) noexcept
+    : logger_{logger}, ring_{nullptr}, record_{nullptr}, direct_stream_{}
+{
+    if (!logger_.IsEnabled())
+    {
+        // Streamed directly into mw::log, so that the message isn't limited to the size of a DeferredLogRecord.
+        score::cpp::ignore = direct_stream_.emplace(CreateLogStream(log_level, context));
+        return;
+    }
+    if (thread_stream_active)
+    {
+        logger_.CountDroppedRecord();
+        return;
+    }
+
+    thread_stream_active = true;
+    ring_ = &logger_.GetRingOfCurrentThread();
+    record_ = ring_->TryReserve();
+    if (record_ == nullptr)
+    {
+        logger_.CountDroppedRecord();
+        return;
+    }
+    record_->Reset(log_level, context);
+}
+
+DeferrableLogStream::~DeferrableLogStream() noexcept
+{
+    if (ring_ != nullptr)
+    {
+        thread_stream_active = false;
+    }
+    if (record_ == nullptr)
+    {
+        return;
+    }
+    if (record_->truncated)
+    {
+        logger_.CountTruncatedRecord();
+    }
+    ring_->Commit();
+}
+
+DeferrableLogStream& DeferrableLogStream::operator<<(const std::string_view value) noexcept
+{
+    if (direct_stream_.has_value())
+    {
+        direct_stream_.value() << value;
+    }
+    else if (record_ != nullptr)
+    {
+        record_->AppendString(value);
+    }
+    return *this;
+}
+
+DeferrableLogStream DeferrableLogError(const std::string_view context) noexcept
+{
+    return DeferrableLogStream{DeferredLogger::GetInstance(), mw::log::LogLevel::kError, context};
+}
+
+DeferrableLogStream DeferrableLogWarn(const std::string_view context) noexcept
+{
+    return DeferrableLogStream{DeferredLogger::GetInstance(), mw::log::LogLevel::kWarn, context};
+}
+
+DeferrableLogStream DeferrableLogInfo(const std::string_view context) noexcept
+{
+    return DeferrableLogStream{DeferredLogger::GetInstance(), mw::log::LogLevel::kInfo, context};
+}
+
+}  // namespace score::mw::com::impl
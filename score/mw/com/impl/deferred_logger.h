@@ -0,0 +1,376 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_DEFERRED_LOGGER_H
+#define SCORE_MW_COM_IMPL_DEFERRED_LOGGER_H
+
+#include "score/concurrency/executor.h"
+#include "score/mw/log/log_level.h"
+#include "score/mw/log/logging.h"
+
+#include <score/stop_token.hpp>
+#include <score/utility.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Type tag, which precedes every argument in the payload of a DeferredLogRecord.
+enum class DeferredLogArgumentType : std::uint8_t
+{
+    kBool = 0U,
+    kSigned = 1U,
+    kUnsigned = 2U,
+    kFloatingPoint = 3U,
+    kStringLiteral = 4U,
+    kString = 5U,
+};
+
+/// \brief Binary log record with the arguments of a log message in their raw form.
+/// \details The payload is a sequence of arguments, each one encoded as DeferredLogArgumentType followed by the raw
+///          value. String literals are stored as pointer and size, all other strings are copied. Arguments, which don't
+///          fit into the payload anymore, are dropped and the record is marked as truncated.
+struct alignas(64) DeferredLogRecord
+{
+    static constexpr std::size_t kSize{256U};
+    static constexpr std::size_t kPayloadCapacity{kSize - sizeof(std::string_view) - 8U};
+
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types
+    // shall be private.". We need these data elements to be organized into a coherent organized data structure.
+    /// \brief Logging context. Has to be a string literal, as it is only formatted later on.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::string_view context;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    mw::log::LogLevel log_level;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    bool truncated;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::uint16_t payload_size;
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    std::array<std::byte, kPayloadCapacity> payload;
+
+    void Reset(const mw::log::LogLevel level, const std::string_view log_context) noexcept
+    {
+        context = log_context;
+        log_level = level;
+        truncated = false;
+        payload_size = 0U;
+    }
+
+    /// \brief Appends an argument of the given type with the given raw value to the payload.
+    void Append(const DeferredLogArgumentType type, const void* const value, const std::size_t value_size) noexcept
+    {
+        if ((truncated) || ((payload_size + sizeof(type) + value_size) > kPayloadCapacity))
+        {
+            truncated = true;
+            return;
+        }
+        // NOLINTBEGIN(score-banned-function) serialization of trivially copyable values into a byte buffer
+        score::cpp::ignore = std::memcpy(&payload.at(payload_size), &type, sizeof(type));
+        score::cpp::ignore = std::memcpy(&payload.at(payload_size + sizeof(type)), value, value_size);
+        // NOLINTEND(score-banned-function) serialization of trivially copyable values into a byte buffer
+        payload_size = static_cast<std::uint16_t>(payload_size + sizeof(type) + value_size);
+    }
+
+    /// \brief Appends a copy of the given string to the payload. Truncates the string, if it doesn't fit completely.
+    void AppendString(const std::string_view value) noexcept;
+};
+
+static_assert(sizeof(DeferredLogRecord) == DeferredLogRecord::kSize, "Unexpected padding in DeferredLogRecord");
+static_assert(std::is_trivially_copyable_v<DeferredLogRecord>, "DeferredLogRecord is stored and copied raw");
+
+/// \brief Bounded lock-free ring of DeferredLogRecords with a single producer (the owning thread) and a single consumer
+///        (the drain thread of the DeferredLogger).
+/// \details The producer writes a record directly into its slot in the ring and publishes it with Commit(). If the ring
+///          is full, TryReserve() fails and the record gets dropped: logging never blocks the producer.
+class DeferredLogRing final
+{
+  public:
+    /// \param capacity number of records. Rounded up to the next power of two.
+    explicit DeferredLogRing(const std::size_t capacity) noexcept;
+
+    DeferredLogRing(const DeferredLogRing&) = delete;
+    DeferredLogRing(DeferredLogRing&&) = delete;
+    DeferredLogRing& operator=(const DeferredLogRing&) = delete;
+    DeferredLogRing& operator=(DeferredLogRing&&) = delete;
+    ~DeferredLogRing() noexcept = default;
+
+    /// \brief Returns the next free slot or nullptr, if the ring is full. Producer only.
+    DeferredLogRecord* TryReserve() noexcept
+    {
+        const auto write_index = write_index_.load(std::memory_order_relaxed);
+        if ((write_index - read_index_.load(std::memory_order_acquire)) >= records_.size())
+        {
+            return nullptr;
+        }
+        return &records_.at(write_index & index_mask_);
+    }
+
+    /// \brief Publishes the slot returned by the preceding TryReserve() to the consumer. Producer only.
+    void Commit() noexcept
+    {
+        write_index_.store(write_index_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /// \brief Calls the given consumer for every published record in order and frees their slots. Consumer only.
+    /// \return number of consumed records
+    template <typename Consumer>
+    std::size_t Drain(Consumer&& consumer) noexcept
+    {
+        const auto read_index = read_index_.load(std::memory_order_relaxed);
+        const auto write_index = write_index_.load(std::memory_order_acquire);
+        for (auto index = read_index; index != write_index; ++index)
+        {
+            consumer(records_.at(index & index_mask_));
+        }
+        read_index_.store(write_index, std::memory_order_release);
+        return static_cast<std::size_t>(write_index - read_index);
+    }
+
+    std::size_t GetCapacity() const noexcept
+    {
+        return records_.size();
+    }
+
+    /// \brief Marks, that the owning thread has exited, so that the consumer removes the ring after draining it.
+    void MarkOwnerExited() noexcept
+    {
+        owner_exited_.store(true, std::memory_order_release);
+    }
+
+    bool HasOwnerExited() const noexcept
+    {
+        return owner_exited_.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::vector<DeferredLogRecord> records_;
+    std::uint64_t index_mask_;
+    alignas(64) std::atomic<std::uint64_t> write_index_;
+    alignas(64) std::atomic<std::uint64_t> read_index_;
+    std::atomic<bool> owner_exited_;
+};
+
+/// \brief Optional logging backend for the internal log messages of mw::com on realtime paths.
+///
+/// \details Logging via mw::log formats the message and passes it through the recorder chain on the calling thread. For
+/// log messages on reception threads or in Send()/GetNewSamples() this latency lands on the realtime threads, which
+/// are already in trouble, when something is logged. When enabled, log messages created via DeferrableLogStream are
+/// written as binary DeferredLogRecord into a ring of the calling thread instead. A drain task formats the records and
+/// hands them over to mw::log. The ring of a thread gets allocated and registered with its first log message.
+/// Formatting the records never blocks this registration. If a ring is full, the log message is dropped and counted.
+/// The number of dropped messages is logged by the drain task. Arguments, which don't fit into a DeferredLogRecord, are
+/// cut off.
+/// When not enabled, DeferrableLogStream logs directly via mw::log without any size limit.
+class DeferredLogger final
+{
+  public:
+    static constexpr std::size_t kDefaultRecordsPerThread{256U};
+    static constexpr std::chrono::milliseconds kDrainInterval{10};
+
+    /// \brief Returns the process wide instance, which is used by DeferrableLogStream by default.
+    static DeferredLogger& GetInstance() noexcept;
+
+    DeferredLogger() noexcept;
+
+    /// \brief Disables the logger and outputs all records, which are still pending.
+    ~DeferredLogger() noexcept;
+
+    DeferredLogger(const DeferredLogger&) = delete;
+    DeferredLogger(DeferredLogger&&) = delete;
+    DeferredLogger& operator=(const DeferredLogger&) = delete;
+    DeferredLogger& operator=(DeferredLogger&&) = delete;
+
+    /// \brief Switches to deferred logging. Records are only output by Flush() or the drain task.
+    /// \param records_per_thread capacity of the ring of every logging thread. Only applies to threads, which log for
+    ///        the first time afterwards.
+    void Enable(const std::size_t records_per_thread) noexcept;
+
+    /// \brief Starts the drain task, which outputs the records of all threads every kDrainInterval.
+    /// \details StartDrainTask() and Disable() must not be called concurrently.
+    /// \param executor provides the thread of the drain task. Has to stay valid until Disable() has been called.
+    void StartDrainTask(concurrency::Executor& executor) noexcept;
+
+    /// \brief Switches back to direct logging, stops the drain task and outputs all records, which are still pending.
+    void Disable() noexcept;
+
+    bool IsEnabled() const noexcept
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Formats and outputs all published records of all threads on the calling thread.
+    /// \return number of output records
+    std::size_t Flush() noexcept;
+
+    /// \brief Number of log messages, which have been dropped as the ring of their thread was full.
+    std::uint64_t GetDroppedRecordCount() const noexcept
+    {
+        return dropped_records_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Number of log messages, whose arguments didn't completely fit into a DeferredLogRecord.
+    std::uint64_t GetTruncatedRecordCount() const noexcept
+    {
+        return truncated_records_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Formats the given record and outputs it via mw::log.
+    static void Output(const DeferredLogRecord& record) noexcept;
+
+  private:
+    friend class DeferrableLogStream;
+
+    /// \brief Returns the ring of the calling thread, which gets created with the first call of a thread.
+    DeferredLogRing& GetRingOfCurrentThread() noexcept;
+
+    void CountDroppedRecord() noexcept
+    {
+        score::cpp::ignore = dropped_records_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    void CountTruncatedRecord() noexcept
+    {
+        score::cpp::ignore = truncated_records_.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    void Run(const score::cpp::stop_token& stop_token) noexcept;
+    void ReportDroppedRecords() noexcept;
+
+    const std::uint64_t instance_id_;
+    std::atomic<bool> enabled_;
+    std::atomic<std::size_t> records_per_thread_;
+    std::atomic<std::uint64_t> dropped_records_;
+    std::atomic<std::uint64_t> truncated_records_;
+    std::uint64_t reported_dropped_records_;
+
+    /// \brief Guards registered_rings_. Producers only lock it with the first log message of their thread, the
+    ///        consumer only to take over the newly registered rings. It is never held while formatting.
+    std::mutex registration_mutex_;
+    /// \brief Rings, which have been registered since the last Flush().
+    std::vector<std::shared_ptr<DeferredLogRing>> registered_rings_;
+
+    /// \brief Guards rings_ and serializes the consumers, as every ring only supports a single one. Never locked by
+    ///        producers.
+    std::mutex drain_mutex_;
+    std::vector<std::shared_ptr<DeferredLogRing>> rings_;
+
+    std::mutex drain_task_mutex_;
+    std::condition_variable drain_task_wake_up_;
+    std::optional<concurrency::TaskResult<void>> drain_task_;
+};
+
+/// \brief Log stream for internal log messages of mw::com on realtime paths. Depending on the DeferredLogger, the
+///        message is either written into the ring of the calling thread or streamed directly into mw::log.
+/// \details Supports the argument types, which can be stored raw: bool, integers, floating point numbers and strings.
+///          Character arrays are expected to be string literals (or other static strings like __func__) and are stored
+///          by pointer only. All other strings are copied into the record.
+class DeferrableLogStream final
+{
+  public:
+    DeferrableLogStream(DeferredLogger& logger, const mw::log::LogLevel log_level, const std::string_view context) noexcept;
+    ~DeferrableLogStream() noexcept;
+
+    DeferrableLogStream(const DeferrableLogStream&) = delete;
+    DeferrableLogStream(DeferrableLogStream&&) = delete;
+    DeferrableLogStream& operator=(const DeferrableLogStream&) = delete;
+    DeferrableLogStream& operator=(DeferrableLogStream&&) = delete;
+
+    DeferrableLogStream& operator<<(const bool value) noexcept
+    {
+        return AppendRaw(DeferredLogArgumentType::kBool, value);
+    }
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, bool> = true>
+    DeferrableLogStream& operator<<(const T value) noexcept
+    {
+        if constexpr (std::is_signed_v<T>)
+        {
+            return AppendRaw(DeferredLogArgumentType::kSigned, static_cast<std::int64_t>(value));
+        }
+        else
+        {
+            return AppendRaw(DeferredLogArgumentType::kUnsigned, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    template <typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
+    DeferrableLogStream& operator<<(const T value) noexcept
+    {
+        return AppendRaw(DeferredLogArgumentType::kFloatingPoint, static_cast<double>(value));
+    }
+
+    template <std::size_t N>
+    // Suppress "AUTOSAR C++14 A18-1-1" rule finding. This rule states: "C-style arrays shall not be used.".
+    // String literals are C-style arrays. Taking them by reference allows storing them by pointer.
+    // coverity[autosar_cpp14_a18_1_1_violation]
+    DeferrableLogStream& operator<<(const char (&literal)[N]) noexcept
+    {
+        return AppendRaw(DeferredLogArgumentType::kStringLiteral, std::string_view{literal, N - 1U});
+    }
+
+    DeferrableLogStream& operator<<(const std::string_view value) noexcept;
+
+    DeferrableLogStream& operator<<(const std::string& value) noexcept
+    {
+        return *this << std::string_view{value};
+    }
+
+  private:
+    template <typename T>
+    DeferrableLogStream& AppendRaw(const DeferredLogArgumentType type, const T value) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (direct_stream_.has_value())
+        {
+            direct_stream_.value() << value;
+        }
+        else if (record_ != nullptr)
+        {
+            record_->Append(type, &value, sizeof(value));
+        }
+        return *this;
+    }
+
+    DeferredLogger& logger_;
+    DeferredLogRing* ring_;
+    DeferredLogRecord* record_;
+    /// \brief Only set, if the DeferredLogger isn't enabled. Outputs the message on destruction.
+    std::optional<mw::log::LogStream> direct_stream_;
+};
+
+/// \brief Creates a DeferrableLogStream with log level error on the process wide DeferredLogger.
+DeferrableLogStream DeferrableLogError(const std::string_view context) noexcept;
+
+/// \brief Creates a DeferrableLogStream with log level warning on the process wide DeferredLogger.
+DeferrableLogStream DeferrableLogWarn(const std::string_view context) noexcept;
+
+/// \brief Creates a DeferrableLogStream with log level info on the process wide DeferredLogger.
+DeferrableLogStream DeferrableLogInfo(const std::string_view context) noexcept;
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_DEFERRED_LOGGER_H
@@ -0,0 +1,264 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/deferred_logger.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+#include "score/mw/log/recorder_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+using ::testing::_;
+
+class DeferredLoggerFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        score::mw::log::SetLogRecorder(&recorder_mock_);
+        ON_CALL(recorder_mock_, StartRecord(_, _))
+            .WillByDefault(
+                ::testing::Return(score::cpp::optional<score::mw::log::SlotHandle>{score::mw::log::SlotHandle{}}));
+    }
+
+    void TearDown() override
+    {
+        // Reset the global recorder to nullptr so that it no longer points to the local recorder_mock_.
+        score::mw::log::SetLogRecorder(nullptr);
+    }
+
+    ::testing::NiceMock<score::mw::log::RecorderMock> recorder_mock_{};
+    DeferredLogger unit_{};
+};
+
+TEST_F(DeferredLoggerFixture, LogsDirectlyWhenNotEnabled)
+{
+    // Given a DeferredLogger, which is not enabled
+
+    // Expect, that the message is logged directly
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(1);
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Direct message"})).Times(1);
+    EXPECT_CALL(recorder_mock_, LogUint64(_, 42U)).Times(1);
+
+    // When logging a message
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "Direct message" << std::uint64_t{42U};
+
+    // Then there is nothing left to flush
+    EXPECT_EQ(unit_.Flush(), 0U);
+}
+
+TEST_F(DeferredLoggerFixture, DoesNotTruncateMessagesWhenNotEnabled)
+{
+    // Given a DeferredLogger, which is not enabled
+
+    // Expect, that a string larger than a DeferredLogRecord and all further arguments are logged completely
+    const std::string long_value(2U * DeferredLogRecord::kSize, 'x');
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{long_value})).Times(1);
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Still stored"})).Times(1);
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"[truncated]"})).Times(0);
+
+    // When logging the message
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << long_value << "Still stored";
+
+    // Then the message isn't counted as truncated
+    EXPECT_EQ(unit_.GetTruncatedRecordCount(), 0U);
+}
+
+TEST_F(DeferredLoggerFixture, DefersLogMessagesUntilFlushWhenEnabled)
+{
+    // Given an enabled DeferredLogger
+    unit_.Enable(8U);
+
+    // Expect, that nothing is logged while the message is created
+    EXPECT_CALL(recorder_mock_, StartRecord(_, _)).Times(0);
+
+    // When logging a message with arguments of all supported types
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kError, "lola"}
+        << "Deferred message" << std::int32_t{-7} << std::uint16_t{42U} << true << 1.5;
+    ::testing::Mock::VerifyAndClearExpectations(&recorder_mock_);
+
+    // Expect, that the message is logged with its arguments on flush
+    ::testing::InSequence sequence{};
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kError))
+        .WillOnce(::testing::Return(score::cpp::optional<score::mw::log::SlotHandle>{score::mw::log::SlotHandle{}}));
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Deferred message"})).Times(1);
+    EXPECT_CALL(recorder_mock_, LogInt64(_, -7)).Times(1);
+    EXPECT_CALL(recorder_mock_, LogUint64(_, 42U)).Times(1);
+    EXPECT_CALL(recorder_mock_, LogBool(_, true)).Times(1);
+    EXPECT_CALL(recorder_mock_, LogDouble(_, 1.5)).Times(1);
+
+    // When flushing
+    const auto output_records = unit_.Flush();
+
+    // Then exactly the one message has been output
+    EXPECT_EQ(output_records, 1U);
+}
+
+TEST_F(DeferredLoggerFixture, CopiesStringsWhichAreNoLiterals)
+{
+    // Given an enabled DeferredLogger
+    unit_.Enable(8U);
+
+    // and a message with a string, which is modified after logging
+    std::string value{"original"};
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << value;
+    value = "modified";
+
+    // Expect, that the string is output as it was, when the message was logged
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"original"})).Times(1);
+
+    // When flushing
+    EXPECT_EQ(unit_.Flush(), 1U);
+}
+
+TEST_F(DeferredLoggerFixture, DropsAndCountsMessagesIfRingIsFull)
+{
+    // Given an enabled DeferredLogger with two records per thread
+    unit_.Enable(2U);
+
+    // When logging five messages without flushing
+    for (std::size_t i = 0U; i < 5U; ++i)
+    {
+        DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "Message" << i;
+    }
+
+    // Then the first two messages are output
+    EXPECT_CALL(recorder_mock_, LogUint64(_, 0U)).Times(1);
+    EXPECT_CALL(recorder_mock_, LogUint64(_, 1U)).Times(1);
+    EXPECT_EQ(unit_.Flush(), 2U);
+
+    // and the other three are counted as dropped
+    EXPECT_EQ(unit_.GetDroppedRecordCount(), 3U);
+
+    // and the ring accepts messages again after the flush
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "Message";
+    EXPECT_EQ(unit_.Flush(), 1U);
+}
+
+TEST_F(DeferredLoggerFixture, DisableReportsDroppedMessages)
+{
+    // Given an enabled DeferredLogger with a single record per thread, which dropped a message
+    unit_.Enable(1U);
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kError, "lola"} << "Kept";
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kError, "lola"} << "Dropped";
+
+    // Expect, that the kept message and a warning about the dropped one is logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kError)).Times(1);
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(1);
+
+    // When disabling the logger
+    unit_.Disable();
+
+    // Then the logger is no longer enabled
+    EXPECT_FALSE(unit_.IsEnabled());
+}
+
+TEST_F(DeferredLoggerFixture, TruncatesArgumentsWhichDoNotFitIntoRecord)
+{
+    // Given an enabled DeferredLogger
+    unit_.Enable(8U);
+
+    // When logging a string, which is larger than a record
+    const std::string long_value(2U * DeferredLogRecord::kSize, 'x');
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << long_value << "Not stored";
+
+    // Then the message is counted as truncated
+    EXPECT_EQ(unit_.GetTruncatedRecordCount(), 1U);
+
+    // and is output with a truncation marker instead of the arguments, which didn't fit
+    EXPECT_CALL(recorder_mock_, LogStringView(_, _)).Times(::testing::AnyNumber());
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Not stored"})).Times(0);
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"[truncated]"})).Times(1);
+    EXPECT_EQ(unit_.Flush(), 1U);
+}
+
+TEST_F(DeferredLoggerFixture, OutputsMessagesOfExitedThreads)
+{
+    // Given an enabled DeferredLogger
+    unit_.Enable(8U);
+
+    // When a thread logs a message and exits before the flush
+    std::thread logging_thread{[this]() noexcept {
+        DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "From exited thread";
+    }};
+    logging_thread.join();
+
+    // Then the message is still output
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"From exited thread"})).Times(1);
+    EXPECT_EQ(unit_.Flush(), 1U);
+
+    // and the ring of the thread has been removed
+    EXPECT_EQ(unit_.Flush(), 0U);
+}
+
+TEST_F(DeferredLoggerFixture, ThreadCanLogForTheFirstTimeWhileRecordsAreOutput)
+{
+    // Given an enabled DeferredLogger with a pending message
+    unit_.Enable(8U);
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "Pending";
+
+    // Expect, that another thread can log its first message, while the pending message is being output
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Pending"}))
+        .WillOnce(::testing::InvokeWithoutArgs([this]() {
+            std::thread logging_thread{[this]() noexcept {
+                DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "First of thread";
+            }};
+            logging_thread.join();
+        }));
+
+    // When flushing
+    EXPECT_EQ(unit_.Flush(), 1U);
+
+    // Then the message of the other thread is output with the next flush
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"First of thread"})).Times(1);
+    EXPECT_EQ(unit_.Flush(), 1U);
+}
+
+TEST_F(DeferredLoggerFixture, DrainTaskOutputsMessages)
+{
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+
+    // Given an enabled DeferredLogger with a running drain task
+    unit_.Enable(8U);
+    unit_.StartDrainTask(long_running_threads);
+
+    // Expect, that the drain task outputs the message
+    std::promise<void> message_output{};
+    EXPECT_CALL(recorder_mock_, LogStringView(_, std::string_view{"Drained"}))
+        .WillOnce(::testing::InvokeWithoutArgs([&message_output]() {
+            message_output.set_value();
+        }));
+
+    // When logging a message
+    DeferrableLogStream{unit_, score::mw::log::LogLevel::kWarn, "lola"} << "Drained";
+
+    // Then the message gets output without flushing
+    EXPECT_EQ(message_output.get_future().wait_for(std::chrono::seconds{5}), std::future_status::ready);
+    unit_.Disable();
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
@@ -16,6 +16,7 @@
 #include "score/mw/com/impl/find_service_handle.h"
 
 #include <score/callback.hpp>
+#include <score/span.hpp>
 
 #include <vector>
 
@@ -40,6 +41,28 @@ using ServiceHandleContainer = std::vector<T>;
 template <typename T>
 using FindServiceHandler = score::cpp::callback<void(ServiceHandleContainer<T>, FindServiceHandle)>;
 
+/// \api
+/// \brief Delta of the matching service instances since the last call of a FindServiceIncrementalHandler.
+///
+/// \details The spans point into storage, which is owned and reused by the binding. They are only valid for the
+/// duration of the handler call, so the handles have to be copied if they are needed afterwards.
+template <typename T>
+struct ServiceHandleChanges
+{
+    score::cpp::span<const T> added;
+    score::cpp::span<const T> removed;
+};
+
+/// \api
+/// \brief Alternative to the FindServiceHandler, which only gets the handles of the service instances, which became
+/// available or unavailable since its last call, instead of the handles of all matching service instances.
+///
+/// \details The first call contains all service instances, which are available when the search is started, as added.
+/// With many matching service instances this avoids that every single offer or stop offer creates and copies a
+/// container with all of them.
+template <typename T>
+using FindServiceIncrementalHandler = score::cpp::callback<void(ServiceHandleChanges<T>, FindServiceHandle)>;
+
 }  // namespace score::mw::com::impl
 
 #endif  // SCORE_MW_COM_IMPL_FIND_SERVICE_HANDLER_H
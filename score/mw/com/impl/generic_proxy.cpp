@@ -59,6 +59,27 @@ std::vector<std::string_view> GetEventNameList(const InstanceIdentifier& identif
     return std::visit(visitor, service_type_deployment.binding_info_);
 }
 
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE] See justification of GetEventNameList().
+std::vector<std::string_view> GetMethodNameList(const InstanceIdentifier& identifier) noexcept
+{
+    using ReturnType = std::vector<std::string_view>;
+
+    const auto& service_type_deployment = InstanceIdentifierView{identifier}.GetServiceTypeDeployment();
+    auto visitor = score::cpp::overload(
+        [](const LolaServiceTypeDeployment& deployment) -> ReturnType {
+            ReturnType method_names;
+            for (const auto& method : deployment.methods_)
+            {
+                method_names.push_back(std::string_view{method.first});
+            }
+            return method_names;
+        },
+        [](const score::cpp::blank&) noexcept -> ReturnType {
+            return {};
+        });
+    return std::visit(visitor, service_type_deployment.binding_info_);
+}
+
 }  // namespace
 
 Result<GenericProxy> GenericProxy::Create(HandleType instance_handle) noexcept
@@ -101,9 +122,66 @@ Result<GenericProxy> GenericProxy::Create(HandleType instance_handle) noexcept
     return generic_proxy;
 }
 
+Result<GenericProxy> GenericProxy::Create(HandleType instance_handle,
+                                          score::cpp::span<const GenericProxyMethodInfo> methods) noexcept
+{
+    auto generic_proxy_result = Create(std::move(instance_handle));
+    if (!generic_proxy_result.has_value())
+    {
+        return generic_proxy_result;
+    }
+    auto& generic_proxy = generic_proxy_result.value();
+
+    const auto method_names = generic_proxy.GetMethodNames();
+    for (const auto& method_info : methods)
+    {
+        // The key of the map has to outlive the GenericProxy. Therefore, the name from the configuration is used.
+        const auto method_name_it = std::find(method_names.cbegin(), method_names.cend(), method_info.name);
+        if (method_name_it == method_names.cend())
+        {
+            ::score::mw::log::LogError("lola") << "Could not create GenericProxy as method " << method_info.name
+                                               << " is not part of the ServiceTypeDeployment.";
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+        const auto emplace_result = generic_proxy.generic_methods_->emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(*method_name_it),
+            std::forward_as_tuple(generic_proxy,
+                                  *method_name_it,
+                                  method_info.in_args_size_info,
+                                  method_info.return_value_size_info));
+        if (!emplace_result.second)
+        {
+            ::score::mw::log::LogError("lola") << "Could not create GenericProxy as method " << method_info.name
+                                               << " was provided twice.";
+            return MakeUnexpected(ComErrc::kServiceElementAlreadyExists);
+        }
+        const auto binding_construction_result =
+            ProxyMethodBaseView{emplace_result.first->second}.GetBindingConstructionResult();
+        if (!binding_construction_result.has_value())
+        {
+            ::score::mw::log::LogError("lola") << "Generic proxy method binding construction failed with error: "
+                                               << binding_construction_result.error();
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+    }
+
+    if (!methods.empty())
+    {
+        const auto setup_methods_result = generic_proxy.SetupMethods(0U);
+        if (!setup_methods_result.has_value())
+        {
+            ::score::mw::log::LogError("lola") << "Could not setup methods of GenericProxy";
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+    }
+    return generic_proxy_result;
+}
+
 GenericProxy::GenericProxy(std::unique_ptr<ProxyBinding> proxy_binding, HandleType instance_handle)
     : ProxyBase{std::move(proxy_binding), std::move(instance_handle)},
       generic_events_(std::make_unique<std::map<std::string_view, GenericProxyEvent>>()),
+      generic_methods_(std::make_unique<std::map<std::string_view, GenericProxyMethod>>()),
       is_proxy_owner_{true}
 {
 }
@@ -119,6 +197,7 @@ GenericProxy::~GenericProxy() noexcept
 GenericProxy::GenericProxy(GenericProxy&& other) noexcept
     : ProxyBase{std::move(other)},
       generic_events_{std::move(other.generic_events_)},
+      generic_methods_{std::move(other.generic_methods_)},
       is_proxy_owner_{std::move(other.is_proxy_owner_)}
 {
 }
@@ -133,6 +212,7 @@ GenericProxy& GenericProxy::operator=(GenericProxy&& other) noexcept
         }
         ProxyBase::operator=(std::move(other));
         generic_events_ = std::move(other.generic_events_);
+        generic_methods_ = std::move(other.generic_methods_);
         is_proxy_owner_ = std::move(other.is_proxy_owner_);
     }
     return *this;
@@ -163,4 +243,14 @@ GenericProxy::EventMapView GenericProxy::GetEvents() const noexcept
     return ServiceElementMapViewFactory<GenericProxyEvent>::Create(*generic_events_);
 }
 
+GenericProxy::MethodMapView GenericProxy::GetMethods() const noexcept
+{
+    return ServiceElementMapViewFactory<GenericProxyMethod>::Create(*generic_methods_);
+}
+
+std::vector<std::string_view> GenericProxy::GetMethodNames() const noexcept
+{
+    return GetMethodNameList(handle_.GetInstanceIdentifier());
+}
+
 }  // namespace score::mw::com::impl
@@ -16,15 +16,22 @@
 
 #include "score/mw/com/impl/flag_owner.h"
 #include "score/mw/com/impl/generic_proxy_event.h"
+#include "score/mw/com/impl/generic_proxy_method.h"
 #include "score/mw/com/impl/handle_type.h"
 #include "score/mw/com/impl/proxy_base.h"
 #include "score/mw/com/impl/proxy_binding.h"
 #include "score/mw/com/impl/service_element_map_view.h"
 #include "score/mw/com/impl/service_element_map_view_factory.h"
 
+#include "score/memory/data_type_size_info.h"
 #include "score/result/result.h"
 
+#include <score/span.hpp>
+
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace score::mw::com::impl
 {
@@ -33,6 +40,14 @@ namespace test
 class GenericProxyAttorney;
 }
 
+/// \brief Size information of a method of a GenericProxy, which is called in a type-erased way.
+struct GenericProxyMethodInfo
+{
+    std::string_view name;
+    std::optional<memory::DataTypeSizeInfo> in_args_size_info;
+    std::optional<memory::DataTypeSizeInfo> return_value_size_info;
+};
+
 /// \todo The EventMap, events, needs to be populated with actual GenericProxyEvents.
 // Suppress "AUTOSAR C++14 A12-1-6" rule findings. This rule states: "Derived classes that do not need further
 // explicit initialization and require all the constructors from the base class shall use inheriting constructors.
@@ -58,6 +73,7 @@ class GenericProxy : public ProxyBase
 
   public:
     using EventMapView = ServiceElementMapView<GenericProxyEvent>;
+    using MethodMapView = ServiceElementMapView<GenericProxyMethod>;
 
     /**
      * \api
@@ -67,6 +83,17 @@ class GenericProxy : public ProxyBase
      */
     static Result<GenericProxy> Create(HandleType instance_handle) noexcept;
 
+    /**
+     * \brief Exception-less GenericProxy constructor, which additionally creates the given methods.
+     * \details As the types of the methods are unknown, their in-argument and return value sizes have to be provided.
+     * Each method name has to be part of the ServiceTypeDeployment (see GetMethodNames()).
+     * \param instance_handle Handle to the instance
+     * \param methods Methods to create.
+     * \return Result containing the created GenericProxy instance or an error code.
+     */
+    static Result<GenericProxy> Create(HandleType instance_handle,
+                                       score::cpp::span<const GenericProxyMethodInfo> methods) noexcept;
+
     ~GenericProxy() noexcept;
 
     GenericProxy(const GenericProxy&) = delete;
@@ -83,6 +110,19 @@ class GenericProxy : public ProxyBase
      */
     EventMapView GetEvents() const noexcept;
 
+    /**
+     * \brief Returns a read-only view to the name-keyed map of methods, which have been requested on creation.
+     * \note The returned view is valid as long as the GenericProxy lives.
+     * \return View to the method map.
+     */
+    MethodMapView GetMethods() const noexcept;
+
+    /**
+     * \brief Returns the names of all methods of the ServiceTypeDeployment of this proxy.
+     * \details The names are valid as long as the configuration of the runtime lives.
+     */
+    std::vector<std::string_view> GetMethodNames() const noexcept;
+
   private:
     GenericProxy(std::unique_ptr<ProxyBinding> proxy_binding, HandleType instance_handle);
 
@@ -94,6 +134,9 @@ class GenericProxy : public ProxyBase
     /// even after the GenericProxy instance has been moved.
     std::unique_ptr<ServiceElementMapViewFactory<GenericProxyEvent>::map_type> generic_events_;
 
+    /// \brief This map owns all GenericProxyMethod instances. Like generic_events_ it is not relocated by a move.
+    std::unique_ptr<ServiceElementMapViewFactory<GenericProxyMethod>::map_type> generic_methods_;
+
     /// Flag which is checked before calling Unsubscribe in the destructor.
     /// Cleared on move so the moved-from instance does not call Unsubscribe.
     FlagOwner is_proxy_owner_;
@@ -15,6 +15,7 @@
 #define SCORE_MW_COM_IMPL_GENERIC_PROXY_EVENT_H
 
 #include "score/mw/com/impl/generic_proxy_event_binding.h"
+#include "score/mw/com/impl/hot_path_diagnostics.h"
 #include "score/mw/com/impl/proxy_base.h"
 #include "score/mw/com/impl/proxy_event_base.h"
 #include "score/mw/com/impl/tracing/proxy_event_tracing.h"
@@ -94,8 +95,7 @@ Result<std::size_t> GenericProxyEvent::GetNewSamples(F&& receiver, std::size_t m
     auto guard_factory{tracker_->Allocate(max_num_samples)};
     if (guard_factory.GetNumAvailableGuards() == 0U)
     {
-        score::mw::log::LogWarn("lola")
-            << "Unable to emit new samples, no free sample slots for this subscription available.";
+        HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
         return MakeUnexpected(ComErrc::kMaxSamplesReached);
     }
 
@@ -0,0 +1,154 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/generic_proxy_method.h"
+
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/method_type.h"
+#include "score/mw/com/impl/plumbing/generic_proxy_method_binding_factory.h"
+
+#include "score/mw/log/logging.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace score::mw::com::impl
+{
+
+namespace
+{
+
+constexpr std::size_t kQueuePosition{0U};
+
+std::size_t GetSize(const std::optional<memory::DataTypeSizeInfo>& size_info)
+{
+    return size_info.has_value() ? size_info->Size() : 0U;
+}
+
+Result<void> ZeroInitialize(const Result<score::cpp::span<std::byte>>& buffer)
+{
+    if (!buffer.has_value())
+    {
+        return MakeUnexpected<void>(buffer.error());
+    }
+    std::fill(buffer->begin(), buffer->end(), std::byte{0U});
+    return {};
+}
+
+}  // namespace
+
+GenericProxyMethod::GenericProxyMethod(ProxyBase& proxy_base,
+                                       std::string_view method_name,
+                                       const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+                                       const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept
+    : ProxyMethodBase(method_name,
+                      GenericProxyMethodBindingFactory::Create(proxy_base.GetHandle(),
+                                                               ProxyBaseView{proxy_base}.GetBinding(),
+                                                               method_name,
+                                                               in_args_size_info,
+                                                               return_value_size_info),
+                      MethodType::kMethod),
+      in_args_size_info_{in_args_size_info},
+      return_value_size_info_{return_value_size_info}
+{
+    ProxyBaseView{proxy_base}.RegisterMethod(method_name_, GetReferenceToMoveable());
+}
+
+GenericProxyMethod::GenericProxyMethod(std::string_view method_name,
+                                       Result<std::unique_ptr<ProxyMethodBinding>> proxy_method_binding,
+                                       const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+                                       const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept
+    : ProxyMethodBase(method_name, std::move(proxy_method_binding), MethodType::kMethod),
+      in_args_size_info_{in_args_size_info},
+      return_value_size_info_{return_value_size_info}
+{
+}
+
+Result<void> GenericProxyMethod::InitializeInArgsAndReturnValues(ProxyBinding& /* proxy_binding */)
+{
+    if (binding_ == nullptr)
+    {
+        score::mw::log::LogError("lola")
+            << "GenericProxyMethod::InitializeInArgsAndReturnValues: Binding is not initialized for method "
+            << method_name_;
+        return MakeUnexpected(ComErrc::kMethodBindingDisabled);
+    }
+    for (std::size_t queue_position = 0U; queue_position < kCallQueueSize; ++queue_position)
+    {
+        if (in_args_size_info_.has_value())
+        {
+            const auto init_in_args_result = ZeroInitialize(binding_->GetInArgsBuffer(queue_position));
+            if (!init_in_args_result.has_value())
+            {
+                return init_in_args_result;
+            }
+        }
+        if (return_value_size_info_.has_value())
+        {
+            const auto init_return_result = ZeroInitialize(binding_->GetReturnValueBuffer(queue_position));
+            if (!init_return_result.has_value())
+            {
+                return init_return_result;
+            }
+        }
+    }
+    return {};
+}
+
+Result<void> GenericProxyMethod::Call(score::cpp::span<const std::byte> in_args,
+                                      score::cpp::span<std::byte> return_value)
+{
+    if (binding_ == nullptr)
+    {
+        score::mw::log::LogError("lola") << "GenericProxyMethod::Call: Binding is not initialized for method "
+                                         << method_name_;
+        return MakeUnexpected(ComErrc::kMethodBindingDisabled);
+    }
+    if ((in_args.size() != GetSize(in_args_size_info_)) || (return_value.size() != GetSize(return_value_size_info_)))
+    {
+        score::mw::log::LogError("lola") << "GenericProxyMethod::Call: Unexpected size of in-arguments or return "
+                                            "value for method "
+                                         << method_name_;
+        return MakeUnexpected(ComErrc::kCouldNotExecute);
+    }
+
+    if (in_args_size_info_.has_value())
+    {
+        const auto in_args_buffer = binding_->GetInArgsBuffer(kQueuePosition);
+        if (!in_args_buffer.has_value())
+        {
+            return MakeUnexpected<void>(in_args_buffer.error());
+        }
+        std::copy(in_args.begin(), in_args.end(), in_args_buffer->begin());
+    }
+
+    score::cpp::span<std::byte> return_value_buffer{};
+    if (return_value_size_info_.has_value())
+    {
+        auto return_value_buffer_result = binding_->GetReturnValueBuffer(kQueuePosition);
+        if (!return_value_buffer_result.has_value())
+        {
+            return MakeUnexpected<void>(return_value_buffer_result.error());
+        }
+        return_value_buffer = return_value_buffer_result.value();
+    }
+
+    const auto call_result = binding_->DoCall(kQueuePosition);
+    if (!call_result.has_value())
+    {
+        return call_result;
+    }
+    std::copy(return_value_buffer.begin(), return_value_buffer.end(), return_value.begin());
+    return {};
+}
+
+}  // namespace score::mw::com::impl
@@ -0,0 +1,82 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_GENERIC_PROXY_METHOD_H
+#define SCORE_MW_COM_IMPL_GENERIC_PROXY_METHOD_H
+
+#include "score/mw/com/impl/methods/proxy_method_base.h"
+#include "score/mw/com/impl/methods/proxy_method_binding.h"
+#include "score/mw/com/impl/proxy_base.h"
+#include "score/mw/com/impl/proxy_binding.h"
+
+#include "score/memory/data_type_size_info.h"
+#include "score/result/result.h"
+
+#include <score/span.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Type-erased proxy method of a GenericProxy.
+/// \details In contrast to ProxyMethod, the types of the in-arguments and the return value are unknown. Only their size
+/// and alignment are handed over on construction, the in-arguments are passed as serialized bytes and the return value
+/// is copied out as bytes. It is used e.g. by the gateway, which forwards calls received from a remote link.
+///
+/// The method uses a single call-queue slot (see ProxyMethodBase::kCallQueueSize). Call() is therefore not thread safe,
+/// concurrent calls of the same GenericProxyMethod have to be serialized by the caller.
+class GenericProxyMethod final : public ProxyMethodBase
+{
+  public:
+    GenericProxyMethod(ProxyBase& proxy_base,
+                       std::string_view method_name,
+                       const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+                       const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept;
+
+    /// \brief Constructor which allows for direct injection of a mock binding. In contrast to the constructor above,
+    /// the method is not registered with a parent proxy.
+    GenericProxyMethod(std::string_view method_name,
+                       Result<std::unique_ptr<ProxyMethodBinding>> proxy_method_binding,
+                       const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+                       const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept;
+
+    ~GenericProxyMethod() final = default;
+
+    GenericProxyMethod(const GenericProxyMethod&) = delete;
+    GenericProxyMethod& operator=(const GenericProxyMethod&) = delete;
+
+    GenericProxyMethod(GenericProxyMethod&&) noexcept = default;
+    GenericProxyMethod& operator=(GenericProxyMethod&&) noexcept = default;
+
+    /// \brief Zero-initializes the storage of the in-arguments and the return value, as their types are unknown.
+    Result<void> InitializeInArgsAndReturnValues(ProxyBinding& proxy_binding) override;
+
+    /// \brief Calls the method synchronously.
+    /// \param in_args Serialized in-arguments. Its size has to match the size of the in-arguments given on
+    /// construction. Has to be empty, if the method has no in-arguments.
+    /// \param return_value Storage into which the return value is copied. Its size has to match the size of the return
+    /// value given on construction. Has to be empty, if the method returns void.
+    /// \return Blank result on success, ComErrc::kCouldNotExecute on a size mismatch or the error of the binding.
+    Result<void> Call(score::cpp::span<const std::byte> in_args, score::cpp::span<std::byte> return_value);
+
+  private:
+    std::optional<memory::DataTypeSizeInfo> in_args_size_info_;
+    std::optional<memory::DataTypeSizeInfo> return_value_size_info_;
+};
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_GENERIC_PROXY_METHOD_H
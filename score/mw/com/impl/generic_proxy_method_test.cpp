@@ -0,0 +1,155 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/generic_proxy_method.h"
+
+#include "score/mw/com/impl/bindings/mock_binding/proxy.h"
+#include "score/mw/com/impl/bindings/mock_binding/proxy_method.h"
+#include "score/mw/com/impl/com_error.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+using ::testing::_;
+using ::testing::InvokeWithoutArgs;
+using ::testing::Return;
+
+constexpr std::size_t kInArgsSize{4U};
+constexpr std::size_t kReturnValueSize{8U};
+
+class GenericProxyMethodFixture : public ::testing::Test
+{
+  protected:
+    GenericProxyMethodFixture()
+    {
+        ON_CALL(proxy_method_binding_mock_, GetInArgsBuffer(0U))
+            .WillByDefault(Return(score::Result<score::cpp::span<std::byte>>{in_args_buffer_}));
+        ON_CALL(proxy_method_binding_mock_, GetReturnValueBuffer(0U))
+            .WillByDefault(Return(score::Result<score::cpp::span<std::byte>>{return_value_buffer_}));
+    }
+
+    GenericProxyMethod CreateUnit()
+    {
+        return GenericProxyMethod{"test_method",
+                                  std::make_unique<mock_binding::ProxyMethodFacade>(proxy_method_binding_mock_),
+                                  memory::DataTypeSizeInfo{kInArgsSize, 4U},
+                                  memory::DataTypeSizeInfo{kReturnValueSize, 8U}};
+    }
+
+    ::testing::NiceMock<mock_binding::ProxyMethod> proxy_method_binding_mock_{};
+    ::testing::NiceMock<mock_binding::Proxy> proxy_binding_mock_{};
+    std::array<std::byte, kInArgsSize> in_args_buffer_{};
+    std::array<std::byte, kReturnValueSize> return_value_buffer_{};
+};
+
+TEST_F(GenericProxyMethodFixture, InitializeZeroFillsInArgsAndReturnValue)
+{
+    // Given a GenericProxyMethod, whose binding storage contains garbage
+    in_args_buffer_.fill(std::byte{0xFFU});
+    return_value_buffer_.fill(std::byte{0xFFU});
+    auto unit = CreateUnit();
+
+    // When initializing the in-arguments and return value
+    const auto result = unit.InitializeInArgsAndReturnValues(proxy_binding_mock_);
+
+    // Then the storage is zeroed
+    ASSERT_TRUE(result.has_value());
+    for (const auto value : in_args_buffer_)
+    {
+        EXPECT_EQ(value, std::byte{0U});
+    }
+    for (const auto value : return_value_buffer_)
+    {
+        EXPECT_EQ(value, std::byte{0U});
+    }
+}
+
+TEST_F(GenericProxyMethodFixture, CallCopiesInArgsAndReturnValue)
+{
+    // Given a GenericProxyMethod
+    auto unit = CreateUnit();
+    const std::array<std::byte, kInArgsSize> in_args{std::byte{1U}, std::byte{2U}, std::byte{3U}, std::byte{4U}};
+    std::array<std::byte, kReturnValueSize> return_value{};
+
+    // Expect, that the binding is called with the in-arguments in its storage and writes the return value
+    EXPECT_CALL(proxy_method_binding_mock_, DoCall(0U)).WillOnce(InvokeWithoutArgs([this, &in_args]() {
+        EXPECT_EQ(in_args_buffer_, in_args);
+        return_value_buffer_.fill(std::byte{42U});
+        return score::Result<void>{};
+    }));
+
+    // When calling the method
+    const auto result = unit.Call(in_args, return_value);
+
+    // Then the return value has been copied out
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(return_value, return_value_buffer_);
+}
+
+TEST_F(GenericProxyMethodFixture, CallWithWrongSizeFailsWithoutCallingBinding)
+{
+    // Given a GenericProxyMethod
+    auto unit = CreateUnit();
+    const std::array<std::byte, kInArgsSize + 1U> in_args{};
+    std::array<std::byte, kReturnValueSize> return_value{};
+
+    // Expect, that the binding is not called
+    EXPECT_CALL(proxy_method_binding_mock_, DoCall(_)).Times(0);
+
+    // When calling the method with in-arguments of the wrong size
+    const auto result = unit.Call(in_args, return_value);
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kCouldNotExecute);
+}
+
+TEST_F(GenericProxyMethodFixture, CallPropagatesBindingError)
+{
+    // Given a GenericProxyMethod, whose binding fails to do the call
+    auto unit = CreateUnit();
+    const std::array<std::byte, kInArgsSize> in_args{};
+    std::array<std::byte, kReturnValueSize> return_value{};
+    ON_CALL(proxy_method_binding_mock_, DoCall(0U)).WillByDefault(Return(MakeUnexpected(ComErrc::kCallQueueFull)));
+
+    // When calling the method
+    const auto result = unit.Call(in_args, return_value);
+
+    // Then the error of the binding is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kCallQueueFull);
+}
+
+TEST_F(GenericProxyMethodFixture, CallWithoutBindingFails)
+{
+    // Given a GenericProxyMethod, which is disabled in the deployment and therefore has no binding
+    GenericProxyMethod unit{"test_method", std::unique_ptr<ProxyMethodBinding>{}, std::nullopt, std::nullopt};
+
+    // When calling the method
+    const auto result = unit.Call({}, {});
+
+    // Then kMethodBindingDisabled is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kMethodBindingDisabled);
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
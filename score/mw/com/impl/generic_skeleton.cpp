@@ -14,8 +14,10 @@
 
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
+#include "score/mw/com/impl/method_type.h"
 #include "score/mw/com/impl/plumbing/generic_skeleton_event_binding_factory.h"
 #include "score/mw/com/impl/plumbing/skeleton_binding_factory.h"
+#include "score/mw/com/impl/plumbing/skeleton_method_binding_factory.h"
 #include "score/mw/com/impl/runtime.h"
 #include "score/mw/com/impl/service_element_map_view_factory.h"
 #include "score/mw/com/impl/skeleton_binding.h"
@@ -51,6 +53,27 @@ std::string_view GetEventName(const InstanceIdentifier& identifier, std::string_
 
     return std::visit(visitor, service_type_deployment.binding_info_);
 }
+
+// Helper to fetch the stable method name from the Configuration
+std::string_view GetMethodName(const InstanceIdentifier& identifier, std::string_view search_name)
+{
+    const auto& service_type_deployment = InstanceIdentifierView{identifier}.GetServiceTypeDeployment();
+
+    auto visitor = score::cpp::overload(
+        [&](const LolaServiceTypeDeployment& deployment) -> std::string_view {
+            const auto it = deployment.methods_.find(std::string{search_name});
+            if (it != deployment.methods_.end())
+            {
+                return it->first;
+            }
+            return {};
+        },
+        [](const score::cpp::blank&) noexcept -> std::string_view {
+            return {};
+        });
+
+    return std::visit(visitor, service_type_deployment.binding_info_);
+}
 }  // namespace
 
 Result<GenericSkeleton> GenericSkeleton::Create(const InstanceSpecifier& specifier,
@@ -120,6 +143,42 @@ Result<GenericSkeleton> GenericSkeleton::Create(const InstanceIdentifier& identi
         }
     }
 
+    // 3. Create methods directly in the map
+    for (const auto& info : in.methods)
+    {
+        if (skeleton.methods_->find(info.name) != skeleton.methods_->cend())
+        {
+            score::mw::log::LogError("GenericSkeleton") << "Duplicate method name provided: " << info.name;
+            return MakeUnexpected(ComErrc::kServiceElementAlreadyExists);
+        }
+
+        const std::string_view stable_name = GetMethodName(identifier, info.name);
+        if (stable_name.empty())
+        {
+            score::mw::log::LogError("GenericSkeleton") << "Method name not found in configuration: " << info.name;
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+
+        auto method_binding = SkeletonMethodBindingFactory::Create(
+            identifier, SkeletonBaseView{skeleton}.GetBinding(), stable_name, MethodType::kMethod);
+        if (method_binding == nullptr)
+        {
+            score::mw::log::LogError("GenericSkeleton") << "Failed to create method binding for: " << info.name;
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+
+        const auto emplace_result = skeleton.methods_->emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(stable_name),
+            std::forward_as_tuple(skeleton, stable_name, std::move(method_binding)));
+
+        if (!emplace_result.second)
+        {
+            score::mw::log::LogError("GenericSkeleton") << "Failed to emplace method in map: " << info.name;
+            return MakeUnexpected(ComErrc::kBindingFailure);
+        }
+    }
+
     return skeleton;
 }
 
@@ -128,6 +187,11 @@ ServiceElementMapView<GenericSkeletonEvent> GenericSkeleton::GetEvents() const n
     return ServiceElementMapViewFactory<GenericSkeletonEvent>::Create(*events_);
 }
 
+ServiceElementMapView<GenericSkeletonMethod> GenericSkeleton::GetMethods() const noexcept
+{
+    return ServiceElementMapViewFactory<GenericSkeletonMethod>::Create(*methods_);
+}
+
 Result<void> GenericSkeleton::OfferService() noexcept
 {
     return SkeletonBase::OfferService();
@@ -140,7 +204,8 @@ void GenericSkeleton::StopOfferService() noexcept
 
 GenericSkeleton::GenericSkeleton(const InstanceIdentifier& identifier, std::unique_ptr<SkeletonBinding> binding)
     : SkeletonBase(std::move(binding), identifier),
-      events_(std::make_unique<std::map<std::string_view, GenericSkeletonEvent>>())
+      events_(std::make_unique<std::map<std::string_view, GenericSkeletonEvent>>()),
+      methods_(std::make_unique<std::map<std::string_view, GenericSkeletonMethod>>())
 {
 }
 
@@ -15,6 +15,7 @@
 
 #include "score/mw/com/impl/data_type_meta_info.h"
 #include "score/mw/com/impl/generic_skeleton_event.h"
+#include "score/mw/com/impl/generic_skeleton_method.h"
 #include "score/mw/com/impl/instance_identifier.h"
 #include "score/mw/com/impl/instance_specifier.h"
 #include "score/mw/com/impl/service_element_map_view.h"
@@ -35,25 +36,33 @@ struct EventInfo
     DataTypeMetaInfo data_type_meta_info;
 };
 
+struct MethodInfo
+{
+    std::string_view name;
+};
+
 struct GenericSkeletonServiceElementInfo
 {
     score::cpp::span<const EventInfo> events{};
+    score::cpp::span<const MethodInfo> methods{};
 };
 
 /// @brief Represents a type-erased, runtime-configurable skeleton for a service instance.
 ///
 /// A `GenericSkeleton` is created at runtime based on configuration data. It manages
-/// a collection of `GenericSkeletonEvent` and `GenericSkeletonField` instances.
+/// a collection of `GenericSkeletonEvent`, `GenericSkeletonField` and `GenericSkeletonMethod` instances.
 
 class GenericSkeleton : public SkeletonBase
 {
   public:
     using EventMapView = ServiceElementMapView<GenericSkeletonEvent>;
+    using MethodMapView = ServiceElementMapView<GenericSkeletonMethod>;
     /// \brief Creates a GenericSkeleton and all its service elements (events + fields) atomically.
     ///
     /// \contract
-    /// - Empty spans are allowed for `in.events` and/or `in.fields`
-    /// - Each provided name must exist in the binding deployment for this instance (events/fields respectively).
+    /// - Empty spans are allowed for `in.events`, `in.fields` and/or `in.methods`
+    /// - Each provided name must exist in the binding deployment for this instance (events/fields/methods
+    ///   respectively).
     /// - All element names must be unique across all element kinds within this skeleton.
     /// - For each field, `initial_value_bytes` must be non-empty and
     ///   `initial_value_bytes.size()` must be <= `size_info.size`.
@@ -72,6 +81,11 @@ class GenericSkeleton : public SkeletonBase
     /// \note The returned view is valid as long as the GenericSkeleton lives.
     [[nodiscard]] EventMapView GetEvents() const noexcept;
 
+    /// \brief Returns a read-only view to the name-keyed map of methods.
+    /// \details A handler has to be registered for each method before the service instance can be offered.
+    /// \note The returned view is valid as long as the GenericSkeleton lives.
+    [[nodiscard]] MethodMapView GetMethods() const noexcept;
+
     /// \brief Offers the service instance.
     /// \return A blank result, or an error if offering fails.
     [[nodiscard]] Result<void> OfferService() noexcept;
@@ -88,6 +102,9 @@ class GenericSkeleton : public SkeletonBase
     /// GenericSkeleton. This is required as we hand out views to this map (see GetEvents()), which need to be valid
     /// even after the GenericSkeleton instance has been moved.
     std::unique_ptr<ServiceElementMapViewFactory<GenericSkeletonEvent>::map_type> events_;
+
+    /// \brief This map owns all GenericSkeletonMethod instances. Like events_ it is not relocated by a move.
+    std::unique_ptr<ServiceElementMapViewFactory<GenericSkeletonMethod>::map_type> methods_;
 };
 }  // namespace score::mw::com::impl
 
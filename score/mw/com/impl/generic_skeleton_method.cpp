@@ -0,0 +1,56 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/generic_skeleton_method.h"
+
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/method_type.h"
+#include "score/mw/com/impl/plumbing/skeleton_method_binding_factory.h"
+
+#include "score/mw/log/logging.h"
+
+#include <utility>
+
+namespace score::mw::com::impl
+{
+
+GenericSkeletonMethod::GenericSkeletonMethod(SkeletonBase& skeleton_base, const std::string_view method_name)
+    : GenericSkeletonMethod(
+          skeleton_base,
+          method_name,
+          SkeletonMethodBindingFactory::Create(SkeletonBaseView{skeleton_base}.GetAssociatedInstanceIdentifier(),
+                                               SkeletonBaseView{skeleton_base}.GetBinding(),
+                                               method_name,
+                                               MethodType::kMethod))
+{
+}
+
+GenericSkeletonMethod::GenericSkeletonMethod(SkeletonBase& skeleton_base,
+                                             const std::string_view method_name,
+                                             std::unique_ptr<SkeletonMethodBinding> skeleton_method_binding)
+    : SkeletonMethodBase(method_name, std::move(skeleton_method_binding), MethodType::kMethod)
+{
+    SkeletonBaseView{skeleton_base}.RegisterMethod(method_name_, GetReferenceToMoveable());
+}
+
+Result<void> GenericSkeletonMethod::RegisterHandler(TypeErasedHandler&& handler)
+{
+    if (binding_ == nullptr)
+    {
+        score::mw::log::LogError("lola")
+            << "GenericSkeletonMethod::RegisterHandler: Binding is not initialized for method " << method_name_;
+        return MakeUnexpected(ComErrc::kBindingFailure);
+    }
+    return binding_->RegisterHandler(std::move(handler));
+}
+
+}  // namespace score::mw::com::impl
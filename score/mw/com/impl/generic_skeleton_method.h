@@ -0,0 +1,64 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_GENERIC_SKELETON_METHOD_H
+#define SCORE_MW_COM_IMPL_GENERIC_SKELETON_METHOD_H
+
+#include "score/mw/com/impl/methods/skeleton_method_base.h"
+#include "score/mw/com/impl/methods/skeleton_method_binding.h"
+#include "score/mw/com/impl/skeleton_base.h"
+
+#include "score/result/result.h"
+
+#include <memory>
+#include <string_view>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Type-erased skeleton method of a GenericSkeleton.
+/// \details In contrast to SkeletonMethod, the types of the in-arguments and the return value are unknown. The
+/// registered handler therefore gets the binding owned storage of the serialized in-arguments and of the return value
+/// as plain byte spans. It is used e.g. by the gateway, which forwards the calls to the service instance it proxies.
+class GenericSkeletonMethod final : public SkeletonMethodBase
+{
+  public:
+    using TypeErasedHandler = SkeletonMethodBinding::TypeErasedHandler;
+
+    GenericSkeletonMethod(SkeletonBase& skeleton_base, const std::string_view method_name);
+
+    /// \brief Constructor which allows for direct injection of a mock binding. Registers the method with the parent
+    /// skeleton like the constructor above.
+    GenericSkeletonMethod(SkeletonBase& skeleton_base,
+                          const std::string_view method_name,
+                          std::unique_ptr<SkeletonMethodBinding> skeleton_method_binding);
+
+    ~GenericSkeletonMethod() = default;
+
+    GenericSkeletonMethod(const GenericSkeletonMethod&) = delete;
+    GenericSkeletonMethod& operator=(const GenericSkeletonMethod&) & = delete;
+
+    GenericSkeletonMethod(GenericSkeletonMethod&&) noexcept = default;
+    GenericSkeletonMethod& operator=(GenericSkeletonMethod&&) & noexcept = default;
+
+    /// \brief Register a handler with the binding, which will be executed by the binding when a Proxy calls this
+    /// method.
+    /// \details The first span of the handler contains the serialized in-arguments, the second one is the storage for
+    /// the return value, which the handler has to fill. Each of them is std::nullopt, if the method has no in-arguments
+    /// or returns void respectively.
+    /// \return score::cpp::blank on success and ComErrc code specified by the binding on failure
+    Result<void> RegisterHandler(TypeErasedHandler&& handler);
+};
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_GENERIC_SKELETON_METHOD_H
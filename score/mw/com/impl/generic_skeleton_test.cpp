@@ -14,6 +14,7 @@
 
 #include "score/mw/com/impl/bindings/mock_binding/generic_skeleton_event.h"
 #include "score/mw/com/impl/bindings/mock_binding/skeleton.h"
+#include "score/mw/com/impl/bindings/mock_binding/skeleton_method.h"
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/i_binding_runtime.h"
 #include "score/mw/com/impl/plumbing/generic_skeleton_event_binding_factory.h"
@@ -233,6 +234,67 @@ TEST_F(GenericSkeletonTest, CreateWithDuplicateEventNamesFails)
     EXPECT_EQ(result.error(), ComErrc::kServiceElementAlreadyExists);
 }
 
+TEST_F(GenericSkeletonTest, CreateWithMethodsInitializesMethodBindings)
+{
+    RecordProperty("Description", "Checks that GenericSkeleton creates bindings for configured methods.");
+    RecordProperty("TestType", "Requirements-based test");
+
+    SkeletonMethodBindingFactoryMockGuard skeleton_method_binding_factory_mock_guard{};
+    NiceMock<mock_binding::SkeletonMethod> skeleton_method_binding_mock{};
+
+    // Given configuration for one method
+    auto identifier = dummy_instance_identifier_builder_.CreateValidLolaInstanceIdentifierWithMethod();
+    const std::string method_name = "test_method";
+
+    std::vector<MethodInfo> method_storage;
+    method_storage.push_back({method_name});
+
+    GenericSkeletonServiceElementInfo params;
+    params.methods = method_storage;
+
+    // Expect the Method Factory to be called
+    EXPECT_CALL(skeleton_method_binding_factory_mock_guard.factory_mock_,
+                Create(_, _, std::string_view{method_name}, MethodType::kMethod))
+        .WillOnce(Return(ByMove(std::make_unique<mock_binding::SkeletonMethodFacade>(skeleton_method_binding_mock))));
+
+    // When creating the skeleton
+    auto result = GenericSkeleton::Create(identifier, params);
+
+    // Then the skeleton contains the method
+    ASSERT_TRUE(result.has_value());
+    auto methods = result.value().GetMethods();
+    ASSERT_EQ(methods.size(), 1);
+    const auto method_it = methods.find(method_name);
+    ASSERT_NE(method_it, methods.cend());
+
+    // and a handler registered at the method is passed to its binding
+    EXPECT_CALL(skeleton_method_binding_mock, RegisterHandler(_)).WillOnce(Return(score::Result<void>{}));
+    auto handler = [](std::optional<score::cpp::span<std::byte>>, std::optional<score::cpp::span<std::byte>>) {};
+    EXPECT_TRUE(method_it->second.RegisterHandler(std::move(handler)).has_value());
+}
+
+TEST_F(GenericSkeletonTest, CreateWithUnknownMethodNameFails)
+{
+    RecordProperty("Description", "Checks that creation fails if a method isn't part of the configuration.");
+    RecordProperty("TestType", "Requirements-based test");
+
+    // Given configuration for a method, which is not part of the deployment
+    auto identifier = dummy_instance_identifier_builder_.CreateValidLolaInstanceIdentifierWithMethod();
+
+    std::vector<MethodInfo> method_storage;
+    method_storage.push_back({"unknown_method"});
+
+    GenericSkeletonServiceElementInfo params;
+    params.methods = method_storage;
+
+    // When creating the skeleton
+    auto result = GenericSkeleton::Create(identifier, params);
+
+    // Then creation fails with kBindingFailure
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kBindingFailure);
+}
+
 TEST_F(GenericSkeletonTest, CreateFailsIfMainBindingCannotBeCreated)
 {
     RecordProperty("Description", "Checks that creation fails if the main SkeletonBinding factory returns null.");
@@ -0,0 +1,125 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/hot_path_diagnostics.h"
+
+#include "score/mw/log/logging.h"
+
+#include <string_view>
+
+namespace score::mw::com::impl
+{
+
+namespace
+{
+
+std::size_t ToIndex(const HotPathDiagnosticSite site) noexcept
+{
+    return static_cast<std::size_t>(site);
+}
+
+std::string_view GetDescription(const HotPathDiagnosticSite site) noexcept
+{
+    switch (site)
+    {
+        case HotPathDiagnosticSite::kNoFreeSampleSlots:
+            return "Unable to emit new samples, no free sample slots for this subscription available.";
+        case HotPathDiagnosticSite::kSubscribeMaxSubscribersOverflow:
+            return "EventSubscriptionControl<>::Subscribe() rejected as already max_subscribers_ are subscribed.";
+        case HotPathDiagnosticSite::kSubscribeSlotOverflow:
+            return "EventSubscriptionControl<>::Subscribe() rejected as max_subscribable_slots_ would overflow.";
+        // LCOV_EXCL_START defensive programming
+        default:
+            return "Unknown hot path diagnostic site.";
+            // LCOV_EXCL_STOP
+    }
+}
+
+HotPathDiagnostics::Clock::rep ToClockTicks(const std::chrono::milliseconds duration) noexcept
+{
+    return std::chrono::duration_cast<HotPathDiagnostics::Clock::duration>(duration).count();
+}
+
+}  // namespace
+
+HotPathDiagnostics& HotPathDiagnostics::GetInstance() noexcept
+{
+    // Suppress "AUTOSAR C++14 A3-3-2" rule finding: "Static and thread-local objects shall be constant-initialized.".
+    // The instance is intentionally created on first use, so that it is available to all call sites independent of
+    // the initialization order of the process.
+    // coverity[autosar_cpp14_a3_3_2_violation]
+    static HotPathDiagnostics instance{};
+    return instance;
+}
+
+HotPathDiagnostics::HotPathDiagnostics() noexcept : sites_{}, report_interval_{ToClockTicks(kDefaultReportInterval)}
+{
+}
+
+void HotPathDiagnostics::SetReportInterval(const std::chrono::milliseconds report_interval) noexcept
+{
+    report_interval_.store(ToClockTicks(report_interval), std::memory_order_relaxed);
+}
+
+void HotPathDiagnostics::Report(const HotPathDiagnosticSite site) noexcept
+{
+    auto& site_state = sites_.at(ToIndex(site));
+    const auto total_occurrences = site_state.count.fetch_add(1U, std::memory_order_relaxed) + 1U;
+
+    const auto now = Clock::now().time_since_epoch().count();
+    auto next_report_time = site_state.next_report_time.load(std::memory_order_relaxed);
+    if (now < next_report_time)
+    {
+        return;
+    }
+    // Only the caller, which advances the report time, logs. All others just counted.
+    if (!site_state.next_report_time.compare_exchange_strong(
+            next_report_time, now + report_interval_.load(std::memory_order_relaxed), std::memory_order_relaxed))
+    {
+        return;
+    }
+    const auto previously_reported_count =
+        site_state.reported_count.exchange(total_occurrences, std::memory_order_relaxed);
+    // A concurrent caller may have counted before us, but reported a smaller total after us.
+    if (total_occurrences > previously_reported_count)
+    {
+        LogSummary(site, total_occurrences - previously_reported_count, total_occurrences);
+    }
+}
+
+std::uint64_t HotPathDiagnostics::GetCount(const HotPathDiagnosticSite site) const noexcept
+{
+    return sites_.at(ToIndex(site)).count.load(std::memory_order_relaxed);
+}
+
+auto HotPathDiagnostics::GetCounters() const noexcept -> Counters
+{
+    Counters counters{};
+    for (std::size_t index = 0U; index < kHotPathDiagnosticSiteCount; ++index)
+    {
+        counters.at(index) = sites_.at(index).count.load(std::memory_order_relaxed);
+    }
+    return counters;
+}
+
+void HotPathDiagnostics::LogSummary(const HotPathDiagnosticSite site,
+                                    const std::uint64_t occurrences_since_last_report,
+                                    const std::uint64_t total_occurrences) const noexcept
+{
+    // Rejected subscriptions are an expected outcome for the caller, so they keep the log level they had before.
+    auto log_stream = (site == HotPathDiagnosticSite::kNoFreeSampleSlots) ? mw::log::LogWarn("lola")
+                                                                          : mw::log::LogInfo("lola");
+    log_stream << GetDescription(site) << "Occurred" << occurrences_since_last_report << "times since last report,"
+               << total_occurrences << "times in total.";
+}
+
+}  // namespace score::mw::com::impl
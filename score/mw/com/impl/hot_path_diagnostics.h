@@ -0,0 +1,92 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_HOT_PATH_DIAGNOSTICS_H
+#define SCORE_MW_COM_IMPL_HOT_PATH_DIAGNOSTICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Code locations on hot paths, which report recurring failures via HotPathDiagnostics instead of logging on
+///        every occurrence.
+enum class HotPathDiagnosticSite : std::uint8_t
+{
+    kNoFreeSampleSlots = 0U,
+    kSubscribeMaxSubscribersOverflow = 1U,
+    kSubscribeSlotOverflow = 2U,
+};
+
+constexpr std::size_t kHotPathDiagnosticSiteCount{3U};
+
+/// \brief Process wide counters of recurring failures on hot paths with rate-limited logging.
+///
+/// \details Logging on every failing call of e.g. a 1 kHz GetNewSamples() floods the log budget and makes an overload
+/// situation worse. Therefore, such call sites only call Report(), which increments a lock-free counter per site and
+/// logs a summary of the occurrences since the last summary at most once per report interval per site. The counters
+/// are exposed via IRuntime::GetHotPathDiagnostics().
+class HotPathDiagnostics final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Counters = std::array<std::uint64_t, kHotPathDiagnosticSiteCount>;
+
+    static constexpr std::chrono::milliseconds kDefaultReportInterval{1000};
+
+    /// \brief Returns the process wide instance, which is used by all hot path call sites.
+    static HotPathDiagnostics& GetInstance() noexcept;
+
+    HotPathDiagnostics() noexcept;
+    ~HotPathDiagnostics() noexcept = default;
+
+    HotPathDiagnostics(const HotPathDiagnostics&) = delete;
+    HotPathDiagnostics(HotPathDiagnostics&&) = delete;
+    HotPathDiagnostics& operator=(const HotPathDiagnostics&) = delete;
+    HotPathDiagnostics& operator=(HotPathDiagnostics&&) = delete;
+
+    /// \brief Sets the minimal time between two summary log messages of the same site.
+    void SetReportInterval(const std::chrono::milliseconds report_interval) noexcept;
+
+    /// \brief Counts an occurrence at the given site and logs a summary, if the report interval of the site elapsed.
+    /// \details Lock-free. Of concurrent callers, only the one winning the report interval of the site logs.
+    void Report(const HotPathDiagnosticSite site) noexcept;
+
+    /// \brief Number of occurrences at the given site since process start.
+    std::uint64_t GetCount(const HotPathDiagnosticSite site) const noexcept;
+
+    /// \brief Number of occurrences at all sites since process start, indexed by HotPathDiagnosticSite.
+    Counters GetCounters() const noexcept;
+
+  private:
+    struct SiteState
+    {
+        std::atomic<std::uint64_t> count;
+        std::atomic<std::uint64_t> reported_count;
+        std::atomic<Clock::rep> next_report_time;
+    };
+
+    void LogSummary(const HotPathDiagnosticSite site,
+                    const std::uint64_t occurrences_since_last_report,
+                    const std::uint64_t total_occurrences) const noexcept;
+
+    std::array<SiteState, kHotPathDiagnosticSiteCount> sites_;
+    std::atomic<Clock::rep> report_interval_;
+};
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_HOT_PATH_DIAGNOSTICS_H
@@ -0,0 +1,174 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/hot_path_diagnostics.h"
+
+#include "score/mw/log/recorder_mock.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+constexpr std::chrono::milliseconds kLongReportInterval{3600U * 1000U};
+
+class HotPathDiagnosticsFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        score::mw::log::SetLogRecorder(&recorder_mock_);
+    }
+
+    void TearDown() override
+    {
+        // Reset the global recorder to nullptr so that it no longer points to the local recorder_mock_.
+        score::mw::log::SetLogRecorder(nullptr);
+    }
+
+    ::testing::NiceMock<score::mw::log::RecorderMock> recorder_mock_{};
+    HotPathDiagnostics unit_{};
+};
+
+TEST_F(HotPathDiagnosticsFixture, CountsEveryOccurrencePerSite)
+{
+    // Given a HotPathDiagnostics with a long report interval
+    unit_.SetReportInterval(kLongReportInterval);
+
+    // When reporting occurrences at two sites
+    for (std::size_t i = 0U; i < 100U; ++i)
+    {
+        unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+    }
+    unit_.Report(HotPathDiagnosticSite::kSubscribeSlotOverflow);
+
+    // Then every occurrence is counted at its own site
+    EXPECT_EQ(unit_.GetCount(HotPathDiagnosticSite::kNoFreeSampleSlots), 100U);
+    EXPECT_EQ(unit_.GetCount(HotPathDiagnosticSite::kSubscribeMaxSubscribersOverflow), 0U);
+    EXPECT_EQ(unit_.GetCount(HotPathDiagnosticSite::kSubscribeSlotOverflow), 1U);
+    const HotPathDiagnostics::Counters expected_counters{100U, 0U, 1U};
+    EXPECT_EQ(unit_.GetCounters(), expected_counters);
+}
+
+TEST_F(HotPathDiagnosticsFixture, LogsOncePerReportInterval)
+{
+    // Given a HotPathDiagnostics with a long report interval
+    unit_.SetReportInterval(kLongReportInterval);
+
+    // Expect, that only a single warning is logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(1);
+
+    // When reporting many occurrences at the same site
+    for (std::size_t i = 0U; i < 1000U; ++i)
+    {
+        unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+    }
+}
+
+TEST_F(HotPathDiagnosticsFixture, LogsEachSiteIndependently)
+{
+    // Given a HotPathDiagnostics with a long report interval
+    unit_.SetReportInterval(kLongReportInterval);
+
+    // Expect, that each site logs once with its own log level
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(1);
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kInfo)).Times(2);
+
+    // When reporting occurrences at all sites
+    for (std::size_t i = 0U; i < 10U; ++i)
+    {
+        unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+        unit_.Report(HotPathDiagnosticSite::kSubscribeMaxSubscribersOverflow);
+        unit_.Report(HotPathDiagnosticSite::kSubscribeSlotOverflow);
+    }
+}
+
+TEST_F(HotPathDiagnosticsFixture, LogsAgainAfterReportIntervalElapsed)
+{
+    // Given a HotPathDiagnostics with a short report interval
+    const std::chrono::milliseconds report_interval{10};
+    unit_.SetReportInterval(report_interval);
+
+    // Expect, that two warnings are logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(2);
+
+    // When reporting occurrences before and after the report interval elapsed
+    unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+    unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+    std::this_thread::sleep_for(2 * report_interval);
+    unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+}
+
+TEST_F(HotPathDiagnosticsFixture, ZeroReportIntervalLogsEveryOccurrence)
+{
+    // Given a HotPathDiagnostics with a report interval of zero
+    unit_.SetReportInterval(std::chrono::milliseconds::zero());
+
+    // Expect, that every occurrence is logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(5);
+
+    // When reporting five occurrences
+    for (std::size_t i = 0U; i < 5U; ++i)
+    {
+        unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+    }
+}
+
+TEST_F(HotPathDiagnosticsFixture, ConcurrentReportsAreCountedExactly)
+{
+    constexpr std::size_t kNumberOfThreads{8U};
+    constexpr std::size_t kReportsPerThread{10000U};
+
+    // Given a HotPathDiagnostics with a long report interval
+    unit_.SetReportInterval(kLongReportInterval);
+
+    // Expect, that only a single warning is logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn)).Times(1);
+
+    // When reporting occurrences at the same site from several threads concurrently
+    std::vector<std::thread> threads{};
+    for (std::size_t thread_index = 0U; thread_index < kNumberOfThreads; ++thread_index)
+    {
+        threads.emplace_back([this]() {
+            for (std::size_t i = 0U; i < kReportsPerThread; ++i)
+            {
+                unit_.Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then no occurrence is lost
+    EXPECT_EQ(unit_.GetCount(HotPathDiagnosticSite::kNoFreeSampleSlots), kNumberOfThreads * kReportsPerThread);
+}
+
+TEST(HotPathDiagnosticsTest, GetInstanceReturnsProcessWideInstance)
+{
+    // When getting the instance twice
+    // Then the same instance is returned
+    EXPECT_EQ(&HotPathDiagnostics::GetInstance(), &HotPathDiagnostics::GetInstance());
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
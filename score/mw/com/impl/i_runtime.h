@@ -13,6 +13,8 @@
 #ifndef SCORE_MW_COM_IMPL_I_RUNTIME_H
 #define SCORE_MW_COM_IMPL_I_RUNTIME_H
 
+#include "score/mw/com/impl/configuration/global_configuration.h"
+#include "score/mw/com/impl/hot_path_diagnostics.h"
 #include "score/mw/com/impl/i_binding_runtime.h"
 #include "score/mw/com/impl/i_service_discovery.h"
 #include "score/mw/com/impl/instance_identifier.h"
@@ -54,6 +56,13 @@ class IRuntime
     /// \return TracingFilterConfig pointer or nullptr in case the config file could not be found or parsed.
     virtual const tracing::ITracingFilterConfig* GetTracingFilterConfig() const noexcept = 0;
 
+    /// \brief Returns the counters of recurring failures on hot paths (e.g. no free sample slots in GetNewSamples()),
+    ///        which are only logged rate-limited.
+    virtual const HotPathDiagnostics& GetHotPathDiagnostics() const noexcept = 0;
+
+    /// \brief Returns the global (process wide) part of the configuration, the runtime was created with.
+    virtual const GlobalConfiguration& GetGlobalConfiguration() const noexcept = 0;
+
   protected:
     IRuntime(const IRuntime&) = default;
     IRuntime& operator=(const IRuntime&) & = default;
@@ -46,6 +46,10 @@ class IServiceDiscovery
     virtual Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>, InstanceIdentifier) noexcept = 0;
     virtual Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>,
                                                        const EnrichedInstanceIdentifier) noexcept = 0;
+    virtual Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType>,
+                                                                  const InstanceSpecifier) noexcept = 0;
+    virtual Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType>,
+                                                                  InstanceIdentifier) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopFindService(const FindServiceHandle) noexcept = 0;
     [[nodiscard]] virtual Result<ServiceHandleContainer<HandleType>> FindService(
         InstanceIdentifier instance_identifier) noexcept = 0;
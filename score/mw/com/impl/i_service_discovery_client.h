@@ -39,6 +39,10 @@ class IServiceDiscoveryClient
         const FindServiceHandle find_service_handle,
         FindServiceHandler<HandleType> handler,
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
+    [[nodiscard]] virtual Result<void> StartFindServiceIncremental(
+        const FindServiceHandle find_service_handle,
+        FindServiceIncrementalHandler<HandleType> handler,
+        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
     [[nodiscard]] virtual Result<void> StopFindService(const FindServiceHandle find_service_handle) noexcept = 0;
     [[nodiscard]] virtual Result<ServiceHandleContainer<HandleType>> FindService(
         const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept = 0;
@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/plumbing/generic_proxy_method_binding_factory.h"
+
+#include "score/mw/com/impl/bindings/lola/element_fq_id.h"
+#include "score/mw/com/impl/bindings/lola/methods/proxy_method_instance_identifier.h"
+#include "score/mw/com/impl/bindings/lola/methods/type_erased_call_queue.h"
+#include "score/mw/com/impl/bindings/lola/proxy.h"
+#include "score/mw/com/impl/bindings/lola/proxy_method.h"
+#include "score/mw/com/impl/com_error.h"
+#include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
+#include "score/mw/com/impl/plumbing/binding_factory_error.h"
+#include "score/mw/com/impl/plumbing/lola_proxy_element_building_blocks.h"
+#include "score/mw/com/impl/plumbing/proxy_method_binding_factory_impl.h"
+#include "score/mw/com/impl/service_element_type.h"
+
+#include "score/mw/log/logging.h"
+
+#include <score/overload.hpp>
+
+#include <string>
+#include <variant>
+
+namespace score::mw::com::impl
+{
+
+Result<std::unique_ptr<ProxyMethodBinding>> GenericProxyMethodBindingFactory::Create(
+    HandleType parent_handle,
+    ProxyBinding& parent_binding,
+    const std::string_view method_name,
+    const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+    const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept
+{
+    auto method_name_str = std::string{method_name};
+
+    using LambdaReturnType = Result<std::unique_ptr<ProxyMethodBinding>>;
+
+    auto deployment_info_visitor = score::cpp::overload(
+        [&parent_handle, &parent_binding, &method_name_str, &in_args_size_info, &return_value_size_info](
+            const LolaServiceTypeDeployment& lola_type_deployment) -> LambdaReturnType {
+            auto* const lola_proxy = dynamic_cast<lola::Proxy*>(&parent_binding);
+            if (lola_proxy == nullptr)
+            {
+                score::mw::log::LogError("lola") << "Generic proxy method binding could not be created for "
+                                                 << method_name_str
+                                                 << " because the parent proxy binding is not a lola binding.";
+                return MakeUnexpected(BindingFactoryErrorCode::kParentBindingIsNotLola);
+            }
+
+            const auto& lola_service_instance_deployment =
+                GetServiceInstanceDeploymentBinding<LolaServiceInstanceDeployment>(
+                    parent_handle.GetServiceInstanceDeployment());
+            const auto method_it = lola_service_instance_deployment.methods_.find(method_name_str);
+            if (method_it == lola_service_instance_deployment.methods_.end())
+            {
+                score::mw::log::LogError("lola") << "Generic proxy method binding could not be created for "
+                                                 << method_name_str
+                                                 << " because it is not part of the instance deployment.";
+                return MakeUnexpected(ComErrc::kBindingFailure);
+            }
+            if (!method_it->second.enabled_)
+            {
+                score::mw::log::LogDebug("lola")
+                    << "Generic proxy method " << method_name_str
+                    << " was disabled in the instance deployment configuration. Not creating a binding for it.";
+                return nullptr;
+            }
+
+            const auto element_fq_id =
+                GetElementFqId(parent_handle, lola_type_deployment, method_name_str, ServiceElementType::METHOD);
+
+            const lola::TypeErasedCallQueue::TypeErasedElementInfo type_erased_element_info{
+                in_args_size_info,
+                return_value_size_info,
+                detail::GetQueueSize(parent_handle, method_name_str, MethodType::kMethod)};
+
+            lola::ProxyMethodInstanceIdentifier proxy_method_instance_identifier{
+                lola_proxy->GetProxyInstanceIdentifier(), {element_fq_id.element_id_, MethodType::kMethod}};
+
+            return std::make_unique<lola::ProxyMethod>(
+                *lola_proxy, proxy_method_instance_identifier, type_erased_element_info);
+        },
+        [](const score::cpp::blank&) noexcept -> LambdaReturnType {
+            return MakeUnexpected(BindingFactoryErrorCode::kUnsupportedBindingType);
+        });
+
+    const auto& type_deployment = parent_handle.GetServiceTypeDeployment();
+    return std::visit(deployment_info_visitor, type_deployment.binding_info_);
+}
+
+}  // namespace score::mw::com::impl
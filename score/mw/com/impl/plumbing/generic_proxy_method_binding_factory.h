@@ -0,0 +1,56 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_PLUMBING_GENERIC_PROXY_METHOD_BINDING_FACTORY_H
+#define SCORE_MW_COM_IMPL_PLUMBING_GENERIC_PROXY_METHOD_BINDING_FACTORY_H
+
+#include "score/mw/com/impl/handle_type.h"
+#include "score/mw/com/impl/method_type.h"
+#include "score/mw/com/impl/methods/proxy_method_binding.h"
+#include "score/mw/com/impl/proxy_binding.h"
+
+#include "score/memory/data_type_size_info.h"
+#include "score/result/result.h"
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Creates the binding of a GenericProxyMethod.
+/// \details In contrast to ProxyMethodBindingFactory, the sizes of the in-arguments and the return value are not taken
+/// from a method signature but are handed over at runtime, as the types of the method are unknown to the caller.
+class GenericProxyMethodBindingFactory final
+{
+  public:
+    /// \brief Creates the binding specific implementation of a type-erased proxy method.
+    /// \param parent_handle The handle containing the binding information.
+    /// \param parent_binding The binding of the proxy, which contains the method.
+    /// \param method_name The binding unspecific name of the method inside the proxy denoted by parent_handle.
+    /// \param in_args_size_info Size and alignment of the serialized in-arguments or std::nullopt, if the method has no
+    /// in-arguments.
+    /// \param return_value_size_info Size and alignment of the return value or std::nullopt, if the method returns void.
+    /// \return An instance of ProxyMethodBinding, a nullptr if the method is disabled in the deployment or an error in
+    /// case binding creation fails.
+    static Result<std::unique_ptr<ProxyMethodBinding>> Create(
+        HandleType parent_handle,
+        ProxyBinding& parent_binding,
+        const std::string_view method_name,
+        const std::optional<memory::DataTypeSizeInfo>& in_args_size_info,
+        const std::optional<memory::DataTypeSizeInfo>& return_value_size_info) noexcept;
+};
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_PLUMBING_GENERIC_PROXY_METHOD_BINDING_FACTORY_H
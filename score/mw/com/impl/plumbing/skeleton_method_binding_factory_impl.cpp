@@ -17,8 +17,43 @@
 #include "score/mw/com/impl/instance_identifier.h"
 #include "score/mw/com/impl/service_element_type.h"
 
+#include <string>
+#include <variant>
+
 namespace score::mw::com::impl
 {
+
+namespace
+{
+
+/// \brief Scheduling of remote calls of the method as configured in its LolaMethodInstanceDeployment. Getters/setters
+///        of fields aren't configurable and use the default.
+lola::MethodCallSchedulingCfg GetMethodCallSchedulingCfg(const InstanceIdentifierView& instance_identifier_view,
+                                                         const std::string_view method_name,
+                                                         const MethodType method_type) noexcept
+{
+    lola::MethodCallSchedulingCfg scheduling_cfg{};
+    if (method_type != MethodType::kMethod)
+    {
+        return scheduling_cfg;
+    }
+    const auto* const lola_service_instance_deployment = std::get_if<LolaServiceInstanceDeployment>(
+        &instance_identifier_view.GetServiceInstanceDeployment().bindingInfo_);
+    if (lola_service_instance_deployment == nullptr)
+    {
+        return scheduling_cfg;
+    }
+    const auto method_it = lola_service_instance_deployment->methods_.find(std::string{method_name});
+    if (method_it != lola_service_instance_deployment->methods_.cend())
+    {
+        scheduling_cfg.priority = method_it->second.priority_;
+        scheduling_cfg.max_concurrent_calls = method_it->second.max_concurrent_calls_;
+    }
+    return scheduling_cfg;
+}
+
+}  // namespace
+
 auto SkeletonMethodBindingFactoryImpl::Create(const InstanceIdentifier& instance_identifier,
                                               SkeletonBinding& parent_binding,
                                               const std::string_view method_name,
@@ -62,7 +97,10 @@ auto SkeletonMethodBindingFactoryImpl::Create(const InstanceIdentifier& instance
         }
 
         lola::UniqueMethodIdentifier unique_method_identifier{lola_element_id, method_type};
-        return std::make_unique<lola::SkeletonMethod>(*lola_parent, unique_method_identifier);
+        return std::make_unique<lola::SkeletonMethod>(
+            *lola_parent,
+            unique_method_identifier,
+            GetMethodCallSchedulingCfg(instance_identifier_view, method_name, method_type));
     };
 
     auto deployment_info_visitor =
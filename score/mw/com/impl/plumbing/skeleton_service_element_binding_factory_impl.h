@@ -63,7 +63,11 @@ inline lola::SkeletonEventProperties GetSkeletonEventProperties(
     }
     return lola::SkeletonEventProperties{lola_event_instance_deployment.GetNumberOfSampleSlots().value(),
                                          lola_event_instance_deployment.max_subscribers_.value(),
-                                         lola_event_instance_deployment.enforce_max_samples_};
+                                         lola_event_instance_deployment.enforce_max_samples_,
+                                         lola_event_instance_deployment.GetSubscriptionControlWidth(),
+                                         std::chrono::milliseconds{
+                                             lola_event_instance_deployment.GetMaxSampleHoldTimeMs()},
+                                         lola_event_instance_deployment.GetStaleSampleAction()};
 }
 
 inline lola::SkeletonEventProperties GetSkeletonEventProperties(
@@ -89,6 +89,32 @@ auto ProxyBase::StartFindService(FindServiceHandler<HandleType> handler, Instanc
     return start_find_service_result;
 }
 
+auto ProxyBase::StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                            InstanceIdentifier instance_identifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    const auto start_find_service_result = Runtime::getInstance().GetServiceDiscovery().StartFindServiceIncremental(
+        std::move(handler), std::move(instance_identifier));
+    if (!(start_find_service_result.has_value()))
+    {
+        return MakeUnexpected(ComErrc::kFindServiceHandlerFailure, start_find_service_result.error().UserMessage());
+    }
+    return start_find_service_result;
+}
+
+auto ProxyBase::StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                            InstanceSpecifier instance_specifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    const auto start_find_service_result = Runtime::getInstance().GetServiceDiscovery().StartFindServiceIncremental(
+        std::move(handler), std::move(instance_specifier));
+    if (!(start_find_service_result.has_value()))
+    {
+        return MakeUnexpected(ComErrc::kFindServiceHandlerFailure, start_find_service_result.error().UserMessage());
+    }
+    return start_find_service_result;
+}
+
 score::Result<void> ProxyBase::StopFindService(const FindServiceHandle handle) noexcept
 {
     const auto stop_find_service_result = Runtime::getInstance().GetServiceDiscovery().StopFindService(handle);
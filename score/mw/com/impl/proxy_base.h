@@ -100,6 +100,36 @@ class ProxyBase
     static Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType> handler,
                                                       InstanceSpecifier instance_specifier) noexcept;
 
+    /**
+     * \api
+     * \brief Starts asynchronous service discovery that matches the given instance identifier and reports only the
+     *        changes of the matching service instances.
+     * \details Like StartFindService, but the handler gets the handles of the service instances, which became
+     *          available or unavailable since its last call, instead of the handles of all matching service instances.
+     *          The handles are only valid during the handler call.
+     * \param handler The callback handler to be invoked with the changes of the service availability.
+     * \param instance_identifier The instance identifier of the service to find.
+     * \return A result which on success contains a handle to control the find operation. On failure, returns an
+     *         error code.
+     */
+    static Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                                                 InstanceIdentifier instance_identifier) noexcept;
+
+    /**
+     * \api
+     * \brief Starts asynchronous service discovery that matches the given instance specifier and reports only the
+     *        changes of the matching service instances.
+     * \details Like StartFindService, but the handler gets the handles of the service instances, which became
+     *          available or unavailable since its last call, instead of the handles of all matching service instances.
+     *          The handles are only valid during the handler call.
+     * \param handler The callback handler to be invoked with the changes of the service availability.
+     * \param instance_specifier The instance specifier of the service to find.
+     * \return A result which on success contains a handle to control the find operation. On failure, returns an
+     *         error code.
+     */
+    static Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                                                 InstanceSpecifier instance_specifier) noexcept;
+
     /**
      * \api
      * \brief Stops an ongoing asynchronous service discovery operation.
@@ -341,6 +341,53 @@ TEST_F(ProxyBaseStartFindServiceInstanceIdentifierFixture, StartFindServiceWillR
     EXPECT_EQ(find_service_handle_result.error(), ComErrc::kFindServiceHandlerFailure);
 }
 
+using ProxyBaseStartFindServiceIncrementalFixture = ProxyBaseFixture;
+TEST_F(ProxyBaseStartFindServiceIncrementalFixture, StartFindServiceIncrementalWithInstanceSpecifierDispatchesToBinding)
+{
+    // Expecting that StartFindServiceIncremental is called on the service discovery
+    const FindServiceHandle handle{make_FindServiceHandle(0)};
+    EXPECT_CALL(service_discovery_mock_, StartFindServiceIncremental(_, kInstanceSpecifier)).WillOnce(Return(handle));
+
+    // When calling StartFindServiceIncremental
+    auto find_service_handle_result =
+        ProxyBase::StartFindServiceIncremental([](auto, auto) noexcept {}, kInstanceSpecifier);
+
+    // Then the handle from the service discovery will be returned
+    ASSERT_TRUE(find_service_handle_result.has_value());
+    EXPECT_EQ(find_service_handle_result.value(), handle);
+}
+
+TEST_F(ProxyBaseStartFindServiceIncrementalFixture,
+       StartFindServiceIncrementalWithInstanceIdentifierDispatchesToBinding)
+{
+    // Expecting that StartFindServiceIncremental is called on the service discovery
+    const FindServiceHandle handle{make_FindServiceHandle(0)};
+    EXPECT_CALL(service_discovery_mock_, StartFindServiceIncremental(_, instance_identifier_)).WillOnce(Return(handle));
+
+    // When calling StartFindServiceIncremental
+    auto find_service_handle_result =
+        ProxyBase::StartFindServiceIncremental([](auto, auto) noexcept {}, instance_identifier_);
+
+    // Then the handle from the service discovery will be returned
+    ASSERT_TRUE(find_service_handle_result.has_value());
+    EXPECT_EQ(find_service_handle_result.value(), handle);
+}
+
+TEST_F(ProxyBaseStartFindServiceIncrementalFixture, StartFindServiceIncrementalWillReturnPropagateErrorFromBinding)
+{
+    // Expecting that StartFindServiceIncremental is called on the service discovery and returns an error
+    ON_CALL(service_discovery_mock_, StartFindServiceIncremental(_, kInstanceSpecifier))
+        .WillByDefault(Return(Unexpected{ComErrc::kNotOffered}));
+
+    // When calling StartFindServiceIncremental
+    auto find_service_handle_result =
+        ProxyBase::StartFindServiceIncremental([](auto, auto) noexcept {}, kInstanceSpecifier);
+
+    // Then an error containing kFindServiceHandlerFailure will be returned
+    ASSERT_FALSE(find_service_handle_result.has_value());
+    EXPECT_EQ(find_service_handle_result.error(), ComErrc::kFindServiceHandlerFailure);
+}
+
 using ProxyBaseStopFindServiceFixture = ProxyBaseFixture;
 TEST_F(ProxyBaseStopFindServiceFixture, StopFindServiceWillDispatchToBinding)
 {
@@ -13,6 +13,7 @@
 #ifndef SCORE_MW_COM_IMPL_PROXYEVENT_H
 #define SCORE_MW_COM_IMPL_PROXYEVENT_H
 
+#include "score/mw/com/impl/hot_path_diagnostics.h"
 #include "score/mw/com/impl/instance_identifier.h"
 #include "score/mw/com/impl/plumbing/proxy_event_binding_factory.h"
 #include "score/mw/com/impl/plumbing/sample_ptr.h"
@@ -205,8 +206,7 @@ Result<std::size_t> ProxyEvent<SampleType>::GetNewSamples(F&& receiver, std::siz
 
     if (guard_factory.GetNumAvailableGuards() == 0U)
     {
-        score::mw::log::LogWarn("lola")
-            << "Unable to emit new samples, no free sample slots for this subscription available.";
+        HotPathDiagnostics::GetInstance().Report(HotPathDiagnosticSite::kNoFreeSampleSlots);
         return MakeUnexpected(ComErrc::kMaxSamplesReached);
     }
 
@@ -161,6 +161,21 @@ Result<void> ProxyEventBase::UnsetSubscriptionStateChangeHandler() noexcept
     return binding_base_->UnsetSubscriptionStateChangeHandler();
 }
 
+Result<void> ProxyEventBase::SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                                      DeadlineMissedHandler handler) noexcept
+{
+    if (expected_period <= std::chrono::nanoseconds::zero())
+    {
+        return MakeUnexpected(ComErrc::kSetHandlerNotSet, "Expected period of a deadline must be positive.");
+    }
+    return binding_base_->SetDeadlineMissedHandler(expected_period, std::move(handler));
+}
+
+Result<void> ProxyEventBase::UnsetDeadlineMissedHandler() noexcept
+{
+    return binding_base_->UnsetDeadlineMissedHandler();
+}
+
 std::size_t ProxyEventBase::GetFreeSampleCount() const noexcept
 {
     if (proxy_event_base_mock_ != nullptr)
@@ -14,6 +14,7 @@
 #ifndef SCORE_MW_COM_IMPL_PROXY_EVENT_BASE_H
 #define SCORE_MW_COM_IMPL_PROXY_EVENT_BASE_H
 
+#include "score/mw/com/impl/deadline_missed_handler.h"
 #include "score/mw/com/impl/enable_reference_to_moveable_from_this.h"
 #include "score/mw/com/impl/event_receive_handler.h"
 #include "score/mw/com/impl/flag_owner.h"
@@ -29,6 +30,7 @@
 #include "score/language/safecpp/scoped_function/scope.h"
 #include "score/result/result.h"
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -117,6 +119,33 @@ class ProxyEventBase : public EnableReferenceToMoveableFromThis<ProxyEventBase>
      */
     Result<void> UnsetSubscriptionStateChangeHandler() noexcept;
 
+    /**
+     * \api
+     * \brief Sets/Registers a DeadlineMissedHandler for this event. This handler will be called, whenever the provider
+     *        did not send a new sample within expected_period.
+     * \details This replaces a user-side timer polling GetNumNewSamplesAvailable() or GetNewSamples() to detect that a
+     *          periodic event stopped arriving: The deadlines of all events in the process are checked by a single
+     *          runtime-wide monitor, which only calls the handler on a violation. The handler is called once per missed
+     *          deadline. It is called again only after the provider has sent a new sample and the deadline has been
+     *          missed again. The deadline is monitored independently of the subscription state, starting with the call
+     *          of this method. This is a proprietary extension to the official ara::com API.
+     * \note An already set/registered DeadlineMissedHandler will be silently overridden.
+     * \param expected_period Maximum expected time between two consecutive samples. Must be positive.
+     * \param handler user provided handler to be called on a missed deadline.
+     * \return On failure, returns an error code.
+     */
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                          DeadlineMissedHandler handler) noexcept;
+
+    /**
+     * \api
+     * \brief Unsets/Unregisters a DeadlineMissedHandler for this event. After this method returns, it is guaranteed,
+     *        that the previously registered handler is neither active nor will be called anymore.
+     * \details May be called from within the DeadlineMissedHandler. It then returns without waiting for the calling
+     *          handler to return.
+     */
+    Result<void> UnsetDeadlineMissedHandler() noexcept;
+
     /**
      * \api
      * \brief Get the number of samples that can still be received by the user of this event.
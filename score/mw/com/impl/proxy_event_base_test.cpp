@@ -1048,5 +1048,41 @@ TEST(ProxyEventBaseTest, UnsetSubscriptionStateChangeHandlerWorks)
     ASSERT_TRUE(result.has_value());
 }
 
+TEST(ProxyEventBaseTest, SetDeadlineMissedHandlerDispatchesToBinding)
+{
+    auto mock_proxy_event_binding_ptr = std::make_unique<StrictMock<mock_binding::ProxyEventBase>>();
+    auto& mock_proxy_event_binding = *mock_proxy_event_binding_ptr;
+
+    // Given a Service Element, that is connected to a mock binding
+    ProxyEventBase dummy_event{kEventName, std::move(mock_proxy_event_binding_ptr)};
+
+    // Expect that SetDeadlineMissedHandler is called on the binding with the expected period
+    const std::chrono::milliseconds expected_period{100};
+    EXPECT_CALL(mock_proxy_event_binding,
+                SetDeadlineMissedHandler(std::chrono::nanoseconds{expected_period}, ::testing::_))
+        .WillOnce(Return(score::Result<void>{}));
+
+    // When calling SetDeadlineMissedHandler
+    const auto result = dummy_event.SetDeadlineMissedHandler(expected_period, {});
+
+    // and then no errors are returned
+    ASSERT_TRUE(result.has_value());
+}
+
+TEST(ProxyEventBaseTest, SetDeadlineMissedHandlerWithoutPositivePeriodReturnsError)
+{
+    auto mock_proxy_event_binding_ptr = std::make_unique<StrictMock<mock_binding::ProxyEventBase>>();
+
+    // Given a Service Element, that is connected to a mock binding
+    ProxyEventBase dummy_event{kEventName, std::move(mock_proxy_event_binding_ptr)};
+
+    // When calling SetDeadlineMissedHandler with an expected period of zero
+    const auto result = dummy_event.SetDeadlineMissedHandler(std::chrono::nanoseconds::zero(), {});
+
+    // Then an error is returned without dispatching to the binding
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kSetHandlerNotSet);
+}
+
 }  // namespace
 }  // namespace score::mw::com::impl
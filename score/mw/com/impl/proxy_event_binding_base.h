@@ -14,12 +14,14 @@
 #define SCORE_MW_COM_IMPL_PROXY_EVENT_BINDING_BASE_H
 
 #include "score/mw/com/impl/binding_type.h"
+#include "score/mw/com/impl/deadline_missed_handler.h"
 #include "score/mw/com/impl/scoped_event_receive_handler.h"
 #include "score/mw/com/impl/subscription_state.h"
 #include "score/mw/com/impl/subscription_state_change_handler.h"
 
 #include "score/result/result.h"
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -83,6 +85,17 @@ class ProxyEventBindingBase
     /// \brief Remove any receive handler registered via SetSubscriptionStateChangeHandler()
     virtual Result<void> UnsetSubscriptionStateChangeHandler() noexcept = 0;
 
+    /// \brief Sets/Registers a DeadlineMissedHandler for this event, which will be called whenever no new sample has
+    /// been sent by the provider within expected_period.
+    /// \note An already set/registered DeadlineMissedHandler will be silently overridden.
+    /// \param expected_period Maximum expected time between two consecutive samples of this event. Must be positive.
+    /// \param handler The callback to be called in case the deadline has been missed.
+    virtual Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds expected_period,
+                                                  DeadlineMissedHandler handler) noexcept = 0;
+
+    /// \brief Remove any handler registered via SetDeadlineMissedHandler()
+    virtual Result<void> UnsetDeadlineMissedHandler() noexcept = 0;
+
     /// \brief Returns the number of new samples a call to GetNewSamples() would currently provide if the
     /// max_sample_count set in the Subscribe call and GetNewSamples call were both infinitely high.
     /// \see ProxyEvent::GetNumNewSamplesAvailable()
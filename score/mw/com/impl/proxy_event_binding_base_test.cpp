@@ -48,6 +48,14 @@ class DummyProxyEventBinding final : public ProxyEventBindingBase
     {
         return {};
     }
+    Result<void> SetDeadlineMissedHandler(const std::chrono::nanoseconds, DeadlineMissedHandler) noexcept override
+    {
+        return {};
+    }
+    Result<void> UnsetDeadlineMissedHandler() noexcept override
+    {
+        return {};
+    }
     Result<std::size_t> GetNumNewSamplesAvailable() const noexcept override
     {
         return {};
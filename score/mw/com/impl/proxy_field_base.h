@@ -158,6 +158,12 @@ class ProxyFieldBaseView
         }
     }
 
+    /// \brief Returns the event, which dispatches the field notifications, or nullptr if the WithNotifier tag is not set.
+    ProxyEventBase* GetEventBase() noexcept
+    {
+        return proxy_field_base_.proxy_event_base_dispatch_;
+    }
+
     [[nodiscard]] Result<void> GetEventBindingConstructionResult() const noexcept
     {
         // If the WithNotifier tag is not set, proxy_event_base_dispatch_ will be nullptr. In that case, we never had to
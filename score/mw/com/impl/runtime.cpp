@@ -13,8 +13,10 @@
 #include "score/mw/com/impl/runtime.h"
 
 #include "score/mw/com/impl/configuration/config_parser.h"
+#include "score/mw/com/impl/deferred_logger.h"
 #include "score/mw/com/impl/instance_specifier.h"
 #include "score/mw/com/impl/plumbing/binding_runtime_factory.h"
+#include "score/mw/com/impl/startup_timeline.h"
 #include "score/mw/com/impl/tracing/configuration/tracing_filter_config_parser.h"
 #include "score/mw/com/impl/tracing/i_binding_tracing_runtime.h"
 #include "score/mw/com/impl/tracing/tracing_runtime.h"
@@ -91,6 +93,7 @@ namespace
 
 std::optional<TracingFilterConfig> ParseTraceConfig(const Configuration& configuration)
 {
+    const StartupTimeline::Phase phase{"ParseTraceConfig"};
     if (!configuration.GetTracingConfiguration().IsTracingEnabled())
     {
         return {};
@@ -122,6 +125,13 @@ void Runtime::Initialize(const runtime::RuntimeConfiguration& runtime_configurat
         warn_double_init();
     }
 
+    const auto& startup_timeline_output_path = runtime_configuration.GetStartupTimelineOutputPath();
+    if (startup_timeline_output_path.has_value())
+    {
+        StartupTimeline::GetInstance().Enable(startup_timeline_output_path.value().Native());
+    }
+
+    const StartupTimeline::Phase phase{"ParseConfiguration"};
     auto config = configuration::Parse(runtime_configuration.GetConfigurationPath().Native());
     score::cpp::ignore = initialization_config_.emplace(std::move(config));
 }
@@ -156,7 +166,10 @@ Runtime& Runtime::getInstanceInternal() noexcept
         if (!initialization_config_.has_value())
         {
             runtime::RuntimeConfiguration runtime_configuration{};
-            auto configuration = configuration::Parse(runtime_configuration.GetConfigurationPath().Native());
+            auto configuration = [&runtime_configuration]() {
+                const StartupTimeline::Phase phase{"ParseConfiguration"};
+                return configuration::Parse(runtime_configuration.GetConfigurationPath().Native());
+            }();
             auto tracing_config = ParseTraceConfig(configuration);
             return Runtime{std::make_pair(std::move(configuration), std::move(tracing_config))};
         }
@@ -184,12 +197,25 @@ Runtime::Runtime(std::pair<Configuration&&, std::optional<TracingFilterConfig>&&
     // stable configuration_ member owned by this singleton Runtime (whose lifetime spans the whole process), NOT to the
     // transient initialization_config_ optional, which gets moved-from and reset() during singleton construction.
     InstanceIdentifier::SetConfiguration(&configuration_);
-    binding_runtimes_ = BindingRuntimeFactory::CreateBindingRuntimes(
-        configuration_, long_running_threads_, tracing_filter_configuration_);
+    HotPathDiagnostics::GetInstance().SetReportInterval(
+        configuration_.GetGlobalConfiguration().GetDiagnosticsReportInterval());
+    const auto deferred_log_records_per_thread =
+        configuration_.GetGlobalConfiguration().GetDeferredLogRecordsPerThread();
+    if (deferred_log_records_per_thread > 0U)
+    {
+        DeferredLogger::GetInstance().Enable(deferred_log_records_per_thread);
+        DeferredLogger::GetInstance().StartDrainTask(long_running_threads_);
+    }
+    {
+        const StartupTimeline::Phase phase{"CreateBindingRuntimes"};
+        binding_runtimes_ = BindingRuntimeFactory::CreateBindingRuntimes(
+            configuration_, long_running_threads_, tracing_filter_configuration_);
+    }
     if (configuration_.GetTracingConfiguration().IsTracingEnabled())
     {
         if (tracing_filter_configuration_.has_value())
         {
+            const StartupTimeline::Phase phase{"CreateTracingRuntime"};
             // LCOV_EXCL_START (Tool incorrectly marks this line as not covered. However, the lines before and after
             // are covered so this is clearly an error by the tool. Suppression can be removed when bug is fixed in
             // Ticket-Ticket-184255).
@@ -213,6 +239,11 @@ Runtime::~Runtime() noexcept
     // Reset the pointer InstanceIdentifier holds into our configuration_ member to avoid it dangling once this
     // singleton Runtime (and thus configuration_) is destroyed.
     InstanceIdentifier::SetConfiguration(nullptr);
+    // The drain task runs on long_running_threads_, so it has to be stopped before long_running_threads_ gets destroyed.
+    if (configuration_.GetGlobalConfiguration().GetDeferredLogRecordsPerThread() > 0U)
+    {
+        DeferredLogger::GetInstance().Disable();
+    }
     mw::log::LogDebug("lola") << "Starting destruction of mw::com runtime";
 }
 
@@ -275,6 +306,16 @@ tracing::ITracingRuntime* Runtime::GetTracingRuntime() const noexcept
     return tracing_runtime_.get();
 }
 
+const HotPathDiagnostics& Runtime::GetHotPathDiagnostics() const noexcept
+{
+    return HotPathDiagnostics::GetInstance();
+}
+
+const GlobalConfiguration& Runtime::GetGlobalConfiguration() const noexcept
+{
+    return configuration_.GetGlobalConfiguration();
+}
+
 void Runtime::InjectMock(IRuntime* const mock) noexcept
 {
     mock_ = mock;
@@ -125,6 +125,14 @@ class Runtime final : public IRuntime
     // coverity[autosar_cpp14_a10_3_1_violation]
     tracing::ITracingRuntime* GetTracingRuntime() const noexcept override final;
 
+    /// \brief see IRuntime::GetHotPathDiagnostics
+    // coverity[autosar_cpp14_a10_3_1_violation]
+    const HotPathDiagnostics& GetHotPathDiagnostics() const noexcept override final;
+
+    /// \brief see IRuntime::GetGlobalConfiguration
+    // coverity[autosar_cpp14_a10_3_1_violation]
+    const GlobalConfiguration& GetGlobalConfiguration() const noexcept override final;
+
   private:
     /// \return static Runtime (the real one - not a mock!) configured based on the configuration set by one of the
     ///         static Initialize() overloads.
@@ -32,6 +32,8 @@ class RuntimeMock : public IRuntime
     MOCK_METHOD(IServiceDiscovery&, GetServiceDiscovery, (), (ref(&), noexcept, override));
     MOCK_METHOD(const tracing::ITracingFilterConfig*, GetTracingFilterConfig, (), (const, noexcept, override));
     MOCK_METHOD(tracing::ITracingRuntime*, GetTracingRuntime, (), (const, noexcept, override));
+    MOCK_METHOD(const HotPathDiagnostics&, GetHotPathDiagnostics, (), (const, noexcept, override));
+    MOCK_METHOD(const GlobalConfiguration&, GetGlobalConfiguration, (), (const, noexcept, override));
 };
 
 }  // namespace score::mw::com::impl
@@ -100,6 +100,12 @@ pub trait Runtime {
     /// `Publisher<T>` types for Publishes event data to subscribers
     type Publisher<T: CommData + Debug>: Publisher<T, Self>;
 
+    /// `FieldSubscriber<T>` types for Manages subscriptions to field value notifications
+    type FieldSubscriber<T: CommData + Debug>: FieldSubscriber<T, Self>;
+
+    /// `FieldPublisher<T>` types for Publishes field values to subscribers
+    type FieldPublisher<T: CommData + Debug>: FieldPublisher<T, Self>;
+
     /// `ProviderInfo` types for Configuration data for service producers instances
     type ProviderInfo: ProviderInfo + Send + Clone;
 
@@ -529,6 +535,65 @@ where
         Self: Sized;
 }
 
+/// Field publication interface for providing the current value of a field to subscribers.
+///
+/// In contrast to an event, a field always has a value. Therefore the initial value has to be set
+/// via `update` before the service is offered. Once offered, every update replaces the value seen by
+/// the subscribers.
+///
+/// # Type Parameters
+/// * `T` - The relocatable field data type
+/// * `R` - The runtime managing the field
+pub trait FieldPublisher<T, R: Runtime + ?Sized>
+where
+    T: CommData + Debug,
+{
+    /// Associated sample type for uninitialized field data
+    type SampleMaybeUninit<'a>: SampleMaybeUninit<T> + 'a
+    where
+        Self: 'a;
+
+    /// Set the value of the field.
+    ///
+    /// Before the service is offered, the value is stored as initial value of the field. Afterwards
+    /// it is copied into a newly allocated slot and sent to the subscribers.
+    ///
+    /// # Parameters
+    /// * `value` - The new field value
+    ///
+    /// # Returns
+    /// A 'Result' indicating success or failure of the update.
+    ///
+    /// # Errors
+    /// Returns 'Error' if the value could not be stored or sent.
+    fn update(&self, value: T) -> Result<()>;
+
+    /// Allocate a buffer slot for the next field value, which is sent via `SampleMut::send`.
+    ///
+    /// This is the zero-copy way to update the field. It is only possible once the service is
+    /// offered, since the slots live in the shared memory created by the offer.
+    ///
+    /// # Returns
+    /// A 'Result' containing the allocated sample buffer on success and an 'Error' on failure.
+    ///
+    /// # Errors
+    /// Returns 'Error' if the service is not offered yet or the allocation fails.
+    fn allocate(&self) -> Result<Self::SampleMaybeUninit<'_>>;
+
+    /// Create a new field publisher for the specified field.
+    ///
+    /// # Parameters
+    /// * `identifier` - Logical name of the field
+    /// * `instance_info` - Runtime-specific configuration for the field source
+    /// # Returns
+    /// A 'Result' containing the constructed field publisher on success and an 'Error' on failure.
+    /// # Errors
+    /// Returns 'Error' if the field publisher cannot be created with the provider information.
+    fn new(identifier: &str, instance_info: R::ProviderInfo) -> Result<Self>
+    where
+        Self: Sized;
+}
+
 /// Consumer role implementation for a specific service interface.
 ///
 /// # Type Parameters
@@ -950,6 +1015,72 @@ pub trait Subscription<T: CommData + Debug, R: Runtime + ?Sized> {
     fn to_stream<'a>(&'a mut  self) -> impl Stream<Item = Result<Self::Sample<'a>>> + Unpin + 'a;
 }
 
+/// Field subscription management interface.
+///
+/// # Type Parameters
+/// * `T` - The relocatable field data type
+/// * `R` - The runtime managing the subscription
+pub trait FieldSubscriber<T: CommData + Debug, R: Runtime + ?Sized> {
+    /// Associated subscription type for reading the field value
+    type Subscription: FieldSubscription<T, R>;
+
+    /// Create a subscriber for the specified field.
+    ///
+    /// # Parameters
+    /// * `identifier` - Logical name of the field
+    /// * `instance_info` - Runtime-specific configuration for the field source
+    ///
+    /// # Errors
+    /// Returns an error if the subscriber cannot be created with
+    /// the given identifier and instance info.
+    fn new(identifier: &'static str, instance_info: R::ConsumerInfo) -> Result<Self>
+    where
+        Self: Sized;
+
+    /// Establish a subscription to the field.
+    ///
+    /// Other than for events, no sample budget has to be given: the subscription only ever holds
+    /// the latest value of the field.
+    ///
+    /// # Returns
+    /// A subscription handle for reading the field value.
+    ///
+    /// # Errors
+    /// Returns 'Error' if the subscription cannot be established.
+    fn subscribe(self) -> Result<Self::Subscription>;
+}
+
+/// Active field subscription providing direct access to the latest field value.
+///
+/// # Type Parameters
+/// * `T` - The relocatable field data type
+/// * `R` - The runtime managing the subscription
+pub trait FieldSubscription<T: CommData + Debug, R: Runtime + ?Sized> {
+    /// Associated subscriber type for managing the subscription lifecycle
+    type Subscriber: FieldSubscriber<T, R>;
+
+    /// Unsubscribe from the field.
+    ///
+    /// Consumes the subscription and returns the original subscriber.
+    ///
+    /// Returns
+    /// The subscriber used to create this subscription.
+    fn unsubscribe(self) -> Self::Subscriber;
+
+    /// Returns a reference to the latest value of the field.
+    ///
+    /// The value is not copied: the reference points to the slot in the communication buffer, which
+    /// stays reserved for this subscription until a newer value replaces it on a later call. Older
+    /// values, which were updated in between two calls, are skipped.
+    ///
+    /// # Returns
+    /// The latest field value, or `None` if no value was received yet.
+    ///
+    /// # Errors
+    /// Returns 'Error' if the field value cannot be read.
+    fn current(&mut self) -> Result<Option<&T>>;
+}
+
 /// A trait for types that can be default-constructed in place, skipping intermediate moves.
 ///
 /// # Safety
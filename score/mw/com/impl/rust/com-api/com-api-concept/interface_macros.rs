@@ -17,19 +17,21 @@
 /// Automatically generates unique type names from the identifier of macro invocation.
 /// For an interface with identifier `{id}`, it generates:
 /// - `{id}Interface` - Struct representing the interface with INTERFACE_ID constant
-/// - `{id}Consumer<R>` - Consumer implementation with event subscribers
-/// - `{id}Producer<R>` - Producer implementation
-/// - `{id}OfferedProducer<R>` - Offered producer implementation with event publishers
+/// - `{id}Consumer<R>` - Consumer implementation with event and field subscribers
+/// - `{id}Producer<R>` - Producer implementation with field publishers, so that the initial
+///   field values can be set before the service is offered
+/// - `{id}OfferedProducer<R>` - Offered producer implementation with event and field publishers
 /// - Implements the `Interface`, `Consumer`, `Producer`, and `OfferedProducer` traits
 ///   for the respective types.
 /// - `Interface_ID` is generated by default as the module path + interface name,
 ///   but can be overridden by providing a custom UID as a second parameter to the macro.
 ///
 /// Parameters:
-/// - Keywords: `interface` followed by the interface identifier and a block of event definitions.
+/// - Keywords: `interface` followed by the interface identifier and a block of member definitions.
 /// - `$id`: Simple identifier used for type name generation (e.g., Vehicle, Engine)
-/// - `$event_name`: Event field name
-/// - `$event_type`: Event data type
+/// - `$member_name`: Event or field name
+/// - `$member_kind`: `Event` or `Field`
+/// - `$member_type`: Event or field data type
 ///
 /// Example usage:
 ///
@@ -76,50 +78,61 @@
 ///   "left_tire" and "exhaust" events.
 /// - `VehicleOfferedProducer<R>` struct that implements `OfferedProducer` trait for offering
 ///   "left_tire" and "exhaust" events.
+///
+/// With fields:
+/// ```ignore
+/// mod abc {
+///     use com_api_concept::interface;
+///     interface!(
+///         interface Vehicle {
+///             left_tire: Event<Tire>,
+///             mileage: Field<Mileage>,
+///         }
+///     );
+/// }
+/// ```
+/// A field is a `FieldSubscriber` in `VehicleConsumer<R>` and a `FieldPublisher` in both
+/// `VehicleProducer<R>` and `VehicleOfferedProducer<R>`. Its initial value has to be set via
+/// `producer.mileage.update(..)` before `offer()` is called.
 #[macro_export]
 macro_rules! interface {
+    (interface $id:ident { $($member_name:ident : Method<$member_type:ty>),+$(,)? }) => {
+        compile_error!(
+            "Method definitions are not supported in this macro version. \
+             Please use Event<T> or Field<T> syntax for defining members."
+        );
+    };
+
     // Default unique ID based on the module path and interface name
-    (interface $id:ident { $($event_name:ident : Event<$event_type:ty>),+ $(,)? }) => {
+    (interface $id:ident {
+        $($member_name:ident : $member_kind:ident<$member_type:ty>),+ $(,)?
+    }) => {
         $crate::interface_common!($id);
-        $crate::interface_consumer!($id, $($event_name, Event<$event_type>),+);
-        $crate::interface_producer!($id, $($event_name, Event<$event_type>),+);
+        $crate::interface_consumer!($id, $($member_name, $member_kind<$member_type>),+);
+        $crate::interface_producer!($id, $($member_name, $member_kind<$member_type>),+);
     };
 
     // Custom unique Id provided by the user
     (interface $id:ident {
         Id = $uid:expr,
-        $($event_name:ident : Event<$event_type:ty>),+ $(,)?
+        $($member_name:ident : $member_kind:ident<$member_type:ty>),+ $(,)?
     }) => {
         $crate::interface_common!($id, $uid);
-        $crate::interface_consumer!($id, $($event_name, Event<$event_type>),+);
-        $crate::interface_producer!($id, $($event_name, Event<$event_type>),+);
+        $crate::interface_consumer!($id, $($member_name, $member_kind<$member_type>),+);
+        $crate::interface_producer!($id, $($member_name, $member_kind<$member_type>),+);
     };
 
     // This is for backward compatibility for existing users with comma (,)
     (interface $id:ident, {
         Id = $uid:expr,
-        $($event_name:ident : Event<$event_type:ty>),+ $(,)?
+        $($member_name:ident : $member_kind:ident<$member_type:ty>),+ $(,)?
     }) => {
         $crate::interface! {
             interface $id {
             Id = $uid,
-            $($event_name : Event<$event_type>),+
+            $($member_name : $member_kind<$member_type>),+
         }}
     };
-
-    (interface $id:ident { $($event_name:ident : Method<$event_type:ty>),+$(,)? }) => {
-        compile_error!(
-            "Method definitions are not supported in this macro version. \
-             Please use Event<T> syntax for defining events."
-        );
-    };
-
-    (interface $id:ident { $($event_name:ident : Field<$event_type:ty>),+$(,)? }) => {
-        compile_error!(
-            "Field definitions are not supported in this macro version. \
-             Please use Event<T> syntax for defining events."
-        );
-    };
 }
 
 /// Macro to create a unique interface struct and implement the Interface trait for it.
@@ -154,17 +167,57 @@ macro_rules! interface_common {
     };
 }
 
-/// Macro to implement the Consumer trait for a given interface ID and its events.
+/// Helper macro, which sorts the members of an interface into events and fields and then invokes
+/// `$callback!(@sorted $id, [events], [fields])`.
+///
+/// Members of any other kind (e.g. `Method<T>`) produce a compile-time error.
+#[doc(hidden)]
+#[macro_export]
+macro_rules! interface_members {
+    ($callback:ident, $id:ident, [$($events:tt)*], [$($fields:tt)*] $(,)?) => {
+        $crate::$callback!(@sorted $id, [$($events)*], [$($fields)*]);
+    };
+
+    ($callback:ident, $id:ident, [$($events:tt)*], [$($fields:tt)*],
+        $member_name:ident, Event<$member_type:ty> $(, $($rest:tt)*)?) => {
+        $crate::interface_members!(
+            $callback, $id, [$($events)* $member_name: $member_type,], [$($fields)*] $(, $($rest)*)?
+        );
+    };
+
+    ($callback:ident, $id:ident, [$($events:tt)*], [$($fields:tt)*],
+        $member_name:ident, Field<$member_type:ty> $(, $($rest:tt)*)?) => {
+        $crate::interface_members!(
+            $callback, $id, [$($events)*], [$($fields)* $member_name: $member_type,] $(, $($rest)*)?
+        );
+    };
+
+    ($callback:ident, $id:ident, [$($events:tt)*], [$($fields:tt)*],
+        $member_name:ident, $member_kind:ident<$member_type:ty> $(, $($rest:tt)*)?) => {
+        compile_error!(concat!(
+            stringify!($member_kind),
+            " definitions are not supported in this macro version. \
+             Please use Event<T> or Field<T> syntax for defining members."
+        ));
+    };
+}
+
+/// Macro to implement the Consumer trait for a given interface ID and its events and fields.
 ///
-/// Generates the Consumer struct with subscribers for each event.
+/// Generates the Consumer struct with subscribers for each event and field.
 #[macro_export]
 macro_rules! interface_consumer {
-    ($id:ident, $($event_name:ident, Event<$event_type:ty>),+$(,)?) => {
+    (@sorted $id:ident,
+        [$($event_name:ident : $event_type:ty,)*],
+        [$($field_name:ident : $field_type:ty,)*]) => {
         com_api::paste::paste!  {
             pub struct [<$id Consumer>]<R: com_api::Runtime + ?Sized> {
                 $(
                     pub $event_name: R::Subscriber<$event_type>,
-                )+
+                )*
+                $(
+                    pub $field_name: R::FieldSubscriber<$field_type>,
+                )*
             }
 
             impl<R: com_api::Runtime + ?Sized> com_api::Consumer<R> for [<$id Consumer>]<R> {
@@ -178,22 +231,47 @@ macro_rules! interface_consumer {
                                 "Failed to create subscriber for {}",
                                 stringify!($event_name)
                             )),
-                        )+
+                        )*
+                        $(
+                            $field_name: <R::FieldSubscriber<$field_type> as com_api::FieldSubscriber<
+                                $field_type,
+                                R,
+                            >>::new(
+                                stringify!($field_name),
+                                instance_info.clone()
+                            ).expect(&format!(
+                                "Failed to create field subscriber for {}",
+                                stringify!($field_name)
+                            )),
+                        )*
                     }
                 }
             }
         }
     };
+
+    ($id:ident, $($member_name:ident, $member_kind:ident<$member_type:ty>),+$(,)?) => {
+        $crate::interface_members!(
+            interface_consumer, $id, [], [], $($member_name, $member_kind<$member_type>),+
+        );
+    };
 }
 
 /// Macro to implement the Producer and OfferedProducer traits for
-/// a given interface ID and its events.
-/// Generates Producer and OfferedProducer structs with publishers for each event.
+/// a given interface ID and its events and fields.
+/// Generates Producer and OfferedProducer structs with publishers for each event and field.
+/// The field publishers are already created with the Producer, since a field requires an initial
+/// value before the service is offered, and are handed over between Producer and OfferedProducer.
 #[macro_export]
 macro_rules! interface_producer {
-    ($id:ident, $($event_name:ident, Event<$event_type:ty>),+$(,)?) => {
+    (@sorted $id:ident,
+        [$($event_name:ident : $event_type:ty,)*],
+        [$($field_name:ident : $field_type:ty,)*]) => {
         com_api::paste::paste!  {
             pub struct [<$id Producer>]<R: com_api::Runtime + ?Sized> {
+                $(
+                    pub $field_name: R::FieldPublisher<$field_type>,
+                )*
                 _runtime: core::marker::PhantomData<R>,
                 instance_info: R::ProviderInfo,
             }
@@ -201,7 +279,10 @@ macro_rules! interface_producer {
             pub struct [<$id OfferedProducer>]<R: com_api::Runtime + ?Sized> {
                 $(
                     pub $event_name: R::Publisher<$event_type>,
-                )+
+                )*
+                $(
+                    pub $field_name: R::FieldPublisher<$field_type>,
+                )*
                 instance_info: R::ProviderInfo,
             }
 
@@ -218,7 +299,10 @@ macro_rules! interface_producer {
                                 "Failed to create publisher for {}",
                                 stringify!($event_name)
                             )),
-                        )+
+                        )*
+                        $(
+                            $field_name: self.$field_name,
+                        )*
                         instance_info: self.instance_info.clone(),
                     };
                     // Offer the service instance to make it discoverable
@@ -228,6 +312,15 @@ macro_rules! interface_producer {
 
                 fn new(instance_info: R::ProviderInfo) -> com_api::Result<Self> {
                     Ok([<$id Producer>] {
+                        $(
+                            $field_name: <R::FieldPublisher<$field_type> as com_api::FieldPublisher<
+                                $field_type,
+                                R,
+                            >>::new(
+                                stringify!($field_name),
+                                instance_info.clone()
+                            )?,
+                        )*
                         _runtime: core::marker::PhantomData,
                         instance_info,
                     })
@@ -240,6 +333,9 @@ macro_rules! interface_producer {
                 type Producer = [<$id Producer>]<R>;
                 fn unoffer(self) -> com_api::Result<Self::Producer> {
                     let producer = [<$id Producer>] {
+                        $(
+                            $field_name: self.$field_name,
+                        )*
                         _runtime: core::marker::PhantomData,
                         instance_info: self.instance_info.clone(),
                     };
@@ -250,6 +346,12 @@ macro_rules! interface_producer {
             }
         }
     };
+
+    ($id:ident, $($member_name:ident, $member_kind:ident<$member_type:ty>),+$(,)?) => {
+        $crate::interface_members!(
+            interface_producer, $id, [], [], $($member_name, $member_kind<$member_type>),+
+        );
+    };
 }
 
 mod tests {
@@ -385,7 +487,7 @@ mod tests {
     #[cfg(doctest)]
     fn interface_macro_with_Method() {}
 
-    /// ```compile_fail
+    /// ```
     /// mod my_module {
     ///     use com_api::{interface, CommData, Reloc, ProviderInfo, Subscriber, Publisher};
     ///
@@ -406,16 +508,41 @@ mod tests {
     ///     interface!(
     ///         interface Vehicle {
     ///             left_tire: Field<Tire>,
-    ///             exhaust: Field<Exhaust>,
+    ///             exhaust: Event<Exhaust>,
     ///         }
     ///     );
     /// }
     /// ```
-    /// This will fail to compile because the macro does not support Field definitions and will
-    /// produce a compile-time error indicating that Field definitions are not supported.
+    /// This will generate a `VehicleConsumer<R>` with a field subscriber for `left_tire` and an
+    /// event subscriber for `exhaust`, and a `VehicleProducer<R>` holding the field publisher for
+    /// `left_tire`, which is moved into the `VehicleOfferedProducer<R>` on `offer()`.
     #[cfg(doctest)]
     fn interface_macro_with_Field() {}
 
+    /// ```compile_fail
+    /// mod my_module {
+    ///     use com_api::{interface, CommData, Reloc, ProviderInfo, Subscriber, Publisher};
+    ///
+    ///     #[derive(Debug, Reloc)]
+    ///     #[repr(C)]
+    ///     pub struct Tire { pub pressure: f32 }
+    ///     impl CommData for Tire {
+    ///         const ID: &'static str = "Tire";
+    ///     }
+    ///
+    ///     interface!(
+    ///         interface Vehicle {
+    ///             left_tire: Field<Tire>,
+    ///             inflate: Method<Tire>,
+    ///         }
+    ///     );
+    /// }
+    /// ```
+    /// This will fail to compile because Method definitions are not supported, even if they are
+    /// mixed with supported Field definitions.
+    #[cfg(doctest)]
+    fn interface_macro_with_Field_and_Method() {}
+
     /// ```
     /// mod my_module {
     ///     use com_api::{interface_common, interface_consumer, interface_producer};
@@ -624,7 +751,7 @@ mod tests {
     #[cfg(doctest)]
     fn interface_consumer_macro_with_Method() {}
 
-    /// ```compile_fail
+    /// ```
     /// mod my_module {
     ///     use com_api::{interface_consumer, CommData, Reloc, ProviderInfo, Subscriber, Publisher};
     ///
@@ -644,9 +771,8 @@ mod tests {
     ///     interface_consumer!(Vehicle, left_tire, Field<Tire>, exhaust, Field<Exhaust>);
     /// }
     /// ```
-    /// This will fail to compile because the `interface_consumer!` macro does not support Field
-    /// definitions and will produce a compile-time error indicating that
-    /// Field definitions are not supported.
+    /// This will generate a `VehicleConsumer<R>` struct with field subscribers for the `left_tire`
+    /// and `exhaust` fields, which are initialized using the runtime's `FieldSubscriber::new`.
     #[cfg(doctest)]
     fn interface_consumer_macro_with_Field() {}
 
@@ -724,9 +850,9 @@ mod tests {
     ///     interface_producer!(Vehicle, left_tire, Field<Tire>, exhaust, Field<Exhaust>);
     /// }
     /// ```
-    /// This will fail to compile because the `interface_producer!` macro does not support Field
-    /// definitions and will produce a compile-time error indicating that
-    /// Field definitions are not supported.
+    /// Like for events, this will fail to compile because the generated `VehicleProducer<R>`
+    /// requires the interface_common macro to be called before to generate the VehicleInterface
+    /// struct.
     #[cfg(doctest)]
     fn interface_producer_macro_with_Field() {}
 }
@@ -977,6 +1103,60 @@ mod validation_tests {
         test_module::validate();
     }
 
+    #[test]
+    fn test_interface_with_events_and_fields_validation() {
+        mod test_module {
+            use com_api::{
+                CommData, Interface, LolaRuntimeImpl as LolaRuntime, ProviderInfo, Publisher,
+                Reloc, Subscriber,
+            };
+
+            #[derive(Debug, Reloc, Clone)]
+            #[repr(C)]
+            pub struct Speed {
+                pub value: f32,
+            }
+            impl CommData for Speed {
+                const ID: &'static str = "Speed";
+            }
+
+            #[derive(Debug, Reloc, Clone)]
+            #[repr(C)]
+            pub struct Mileage {
+                pub value: u64,
+            }
+            impl CommData for Mileage {
+                const ID: &'static str = "Mileage";
+            }
+
+            crate::interface!(
+                interface Odometer {
+                    Id = "OdometerInterface",
+                    mileage: Field<Mileage>,
+                    speed: Event<Speed>,
+                }
+            );
+
+            pub fn validate() {
+                assert_eq!(
+                    <OdometerInterface as Interface>::INTERFACE_ID,
+                    "OdometerInterface"
+                );
+
+                // Fields and events can be declared in any order. Referencing the generated
+                // types by name proves that the members were sorted into the right structs.
+                let _ = core::marker::PhantomData::<OdometerConsumer<LolaRuntime>>;
+                let _ = core::marker::PhantomData::<OdometerProducer<LolaRuntime>>;
+                let _ = core::marker::PhantomData::<OdometerOfferedProducer<LolaRuntime>>;
+                assert!(
+                    std::mem::size_of::<OdometerConsumer<LolaRuntime>>() > 0,
+                    "OdometerConsumer should have subscriber fields"
+                );
+            }
+        }
+        test_module::validate();
+    }
+
     #[test]
     fn test_interface_type_consistency_across_traits() {
         mod test_module {
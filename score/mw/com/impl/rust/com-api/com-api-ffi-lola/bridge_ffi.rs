@@ -210,6 +210,23 @@ pub trait FFIBridge: Send + Sync + Clone + Debug + 'static + Unpin + Default {
         max_samples: u32,
     ) -> u32;
 
+    /// Batched variant of `get_samples_from_event` without a per-sample callback. The C++ side moves
+    /// up to `max_samples` `SamplePtr<T>` into consecutive elements of `samples` and returns their
+    /// number. Ownership of these elements passes to the caller.
+    ///
+    /// # Safety
+    /// `event_ptr` must be a valid pointer to a `ProxyEventBase` obtained from
+    /// `get_event_from_proxy`, and the event must have been subscribed via `subscribe_to_event`.
+    /// `samples` must point to writable, suitably aligned storage for at least `max_samples`
+    /// `SamplePtr<T>` of the type described by `type_ops`.
+    unsafe fn get_samples_from_event_batch(
+        &self,
+        event_ptr: *mut ProxyEventBase,
+        type_ops: &TypeOperationsManager,
+        samples: *mut std::ffi::c_void,
+        max_samples: u32,
+    ) -> u32;
+
     /// # Safety
     /// `event_ptr` must be a valid pointer to a `SkeletonEventBase` obtained from
     /// `get_event_from_skeleton`. `data_ptr` must point to valid data whose type matches
@@ -221,6 +238,21 @@ pub trait FFIBridge: Send + Sync + Clone + Debug + 'static + Unpin + Default {
         data_ptr: *const std::ffi::c_void,
     ) -> bool;
 
+    /// Updates the value of a field of the skeleton. Before the skeleton is offered, the value is
+    /// stored as initial value of the field.
+    ///
+    /// # Safety
+    /// `skeleton_ptr` must be a valid pointer to a `SkeletonBase` obtained from `create_skeleton`.
+    /// `data_ptr` must point to valid data whose type matches the type of the field `field_id` and
+    /// must remain valid for the duration of this call.
+    unsafe fn skeleton_field_update(
+        &self,
+        skeleton_ptr: *mut SkeletonBase,
+        interface_id: &str,
+        field_id: &str,
+        data_ptr: *const std::ffi::c_void,
+    ) -> bool;
+
     /// # Safety
     /// `event_ptr` must be a valid pointer to a `ProxyEventBase` obtained from
     /// `get_event_from_proxy`. Must be called before `get_samples_from_event`.
@@ -187,6 +187,23 @@ unsafe extern "C" {
         max_samples: u32,
     ) -> u32;
 
+    /// Get new samples from an event into caller provided storage, without per-sample callback
+    ///
+    /// # Arguments
+    /// * `event_ptr` - Opaque event pointer
+    /// * `type_ops` - Pointer to TypeOperations instance
+    /// * `samples` - Storage for at least `max_samples` SamplePtr<T>
+    /// * `max_samples` - Maximum number of samples to retrieve
+    ///
+    /// # Returns
+    /// Number of samples stored in `samples`
+    fn mw_com_type_registry_get_samples_from_event_batch(
+        event_ptr: *mut ProxyEventBase,
+        type_ops: *const TypeOperations,
+        samples: *mut std::ffi::c_void,
+        max_samples: u32,
+    ) -> u32;
+
     /// Send data via skeleton event
     ///
     /// # Arguments
@@ -202,6 +219,23 @@ unsafe extern "C" {
         data_ptr: CVoidPtr,
     ) -> bool;
 
+    /// Update the value of a skeleton field
+    ///
+    /// # Arguments
+    /// * `skeleton_ptr` - Opaque skeleton pointer
+    /// * `interface_id` - UTF-8 C string of interface UID
+    /// * `field_id` - UTF-8 C string of field name
+    /// * `data_ptr` - Pointer to the new field value
+    ///
+    /// # Returns
+    /// True if the field was updated successfully, false otherwise
+    fn mw_com_skeleton_field_update(
+        skeleton_ptr: *mut SkeletonBase,
+        interface_id: StringView,
+        field_id: StringView,
+        data_ptr: *const std::ffi::c_void,
+    ) -> bool;
+
     /// Create proxy by UID and handle
     ///
     /// # Arguments
@@ -756,6 +790,40 @@ impl FFIBridge for LolaFFIBridge {
         }
     }
 
+    /// Unsafe wrapper around mw_com_type_registry_get_samples_from_event_batch
+    ///
+    /// # Arguments
+    /// * `event_ptr` - Opaque event pointer
+    /// * `type_ops` - Reference to TypeOperationsManager for the type
+    /// * `samples` - Storage for at least `max_samples` SamplePtr<T>
+    /// * `max_samples` - Maximum number of samples to retrieve
+    ///
+    /// # Returns
+    /// Number of samples stored in `samples`, or u32::MAX on error
+    ///
+    /// # Safety
+    /// `event_ptr` must be a valid pointer to a subscribed `ProxyEventBase` obtained from
+    /// `get_event_from_proxy`. `samples` must point to writable storage for at least
+    /// `max_samples` SamplePtr<T> of the type described by `type_ops`.
+    unsafe fn get_samples_from_event_batch(
+        &self,
+        event_ptr: *mut ProxyEventBase,
+        type_ops: &TypeOperationsManager,
+        samples: *mut std::ffi::c_void,
+        max_samples: u32,
+    ) -> u32 {
+        // SAFETY: event_ptr and samples are guaranteed to be valid per the caller's contract.
+        // The C++ implementation constructs at most max_samples SamplePtr<T> in samples.
+        unsafe {
+            mw_com_type_registry_get_samples_from_event_batch(
+                event_ptr,
+                type_ops.as_ptr(),
+                samples,
+                max_samples,
+            )
+        }
+    }
+
     /// Unsafe wrapper around mw_com_skeleton_send_event
     ///
     /// # Arguments
@@ -779,6 +847,35 @@ impl FFIBridge for LolaFFIBridge {
         unsafe { mw_com_skeleton_send_event(event_ptr, type_ops.as_ptr(), data_ptr) }
     }
 
+    /// Unsafe wrapper around mw_com_skeleton_field_update
+    ///
+    /// # Arguments
+    /// * `skeleton_ptr` - Opaque skeleton pointer
+    /// * `interface_id` - Interface UID string
+    /// * `field_id` - Field name
+    /// * `data_ptr` - Pointer to the new field value of the matching type
+    ///
+    /// # Returns
+    /// true if the field was updated successfully, false otherwise
+    ///
+    /// # Safety
+    /// skeleton_ptr must be a valid pointer to a SkeletonBase previously created
+    /// with create_skeleton(). data_ptr must point to valid data whose type matches the field type
+    /// and must remain valid for the duration of this call.
+    unsafe fn skeleton_field_update(
+        &self,
+        skeleton_ptr: *mut SkeletonBase,
+        interface_id: &str,
+        field_id: &str,
+        data_ptr: *const std::ffi::c_void,
+    ) -> bool {
+        // SAFETY: skeleton_ptr and data_ptr are guaranteed to be valid per the caller's contract.
+        // The C++ implementation copies the value before returning.
+        let c_id = StringView::from(interface_id);
+        let c_name = StringView::from(field_id);
+        unsafe { mw_com_skeleton_field_update(skeleton_ptr, c_id, c_name, data_ptr) }
+    }
+
     /// Unsafe wrapper around mw_com_proxy_event_subscribe
     ///
     /// # Arguments
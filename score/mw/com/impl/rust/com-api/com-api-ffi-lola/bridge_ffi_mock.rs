@@ -157,6 +157,14 @@ mock! {
             max_samples: u32,
         ) -> u32;
 
+        unsafe fn get_samples_from_event_batch(
+            &self,
+            event_ptr: *mut ProxyEventBase,
+            type_ops: &TypeOperationsManager,
+            samples: *mut std::ffi::c_void,
+            max_samples: u32,
+        ) -> u32;
+
         unsafe fn skeleton_send_event(
             &self,
             event_ptr: *mut SkeletonEventBase,
@@ -164,6 +172,14 @@ mock! {
             data_ptr: *const std::ffi::c_void,
         ) -> bool;
 
+        unsafe fn skeleton_field_update(
+            &self,
+            skeleton_ptr: *mut SkeletonBase,
+            interface_id: &str,
+            field_id: &str,
+            data_ptr: *const std::ffi::c_void,
+        ) -> bool;
+
         unsafe fn subscribe_to_event(
             &self,
             event_ptr: *mut ProxyEventBase,
@@ -392,6 +408,24 @@ impl bridge_ffi_rs::FFIBridge for SharedMockBridge {
         }
     }
 
+    unsafe fn get_samples_from_event_batch(
+        &self,
+        event_ptr: *mut ProxyEventBase,
+        type_ops: &TypeOperationsManager,
+        samples: *mut std::ffi::c_void,
+        max_num_samples: u32,
+    ) -> u32 {
+        //Safety: This is just forwarding the call to the inner mock, which is expected to be configured correctly in tests using mockall's expectations.
+        unsafe {
+            self.locked().get_samples_from_event_batch(
+                event_ptr,
+                type_ops,
+                samples,
+                max_num_samples,
+            )
+        }
+    }
+
     unsafe fn skeleton_send_event(
         &self,
         event_ptr: *mut SkeletonEventBase,
@@ -405,6 +439,20 @@ impl bridge_ffi_rs::FFIBridge for SharedMockBridge {
         }
     }
 
+    unsafe fn skeleton_field_update(
+        &self,
+        skeleton_ptr: *mut SkeletonBase,
+        interface_id: &str,
+        field_id: &str,
+        data_ptr: *const std::ffi::c_void,
+    ) -> bool {
+        //Safety: This is just forwarding the call to the inner mock, which is expected to be configured correctly in tests using mockall's expectations.
+        unsafe {
+            self.locked()
+                .skeleton_field_update(skeleton_ptr, interface_id, field_id, data_ptr)
+        }
+    }
+
     unsafe fn set_event_receive_handler(
         &self,
         event_ptr: *mut ProxyEventBase,
@@ -111,6 +111,33 @@ bool mw_com_skeleton_send_event(SkeletonEventBase* event_ptr, const TypeOperatio
     return type_ops->SkeletonSendEvent(event_ptr, data_ptr);
 }
 
+/// \brief Update the value of a skeleton field by name
+/// \details Other than sending via the field's event, this also works before the skeleton is offered, in which case
+/// the value is stored as initial value of the field.
+/// \param skeleton_ptr Opaque skeleton pointer (actually SkeletonType*)
+/// \param interface_id UTF-8 string view of interface ID
+/// \param field_id UTF-8 string view of field name
+/// \param data_ptr Pointer to the new field value (T*)
+/// \return true if update successful, false otherwise
+bool mw_com_skeleton_field_update(SkeletonBase* skeleton_ptr,
+                                  StringView interface_id,
+                                  StringView field_id,
+                                  const void* data_ptr)
+{
+    if (skeleton_ptr == nullptr || interface_id.data == nullptr || field_id.data == nullptr || data_ptr == nullptr)
+    {
+        return false;
+    }
+
+    auto registry = GlobalRegistryMapping::FindMemberOperation(static_cast<std::string_view>(interface_id),
+                                                               static_cast<std::string_view>(field_id));
+    if (registry == nullptr)
+    {
+        return false;
+    }
+    return registry->UpdateSkeletonField(skeleton_ptr, data_ptr);
+}
+
 /// \brief Subscribe to a proxy event to allocate sample buffers
 /// \details Must be called before GetNewSamples to initialize the event's sample tracker.
 /// \param event_ptr Opaque event pointer (ProxyEventBase*)
@@ -269,6 +296,35 @@ std::uint32_t mw_com_type_registry_get_samples_from_event(ProxyEventBase* event_
     return result.value();
 }
 
+/// \brief Get samples from proxy event of specific type into caller provided storage
+/// \details Retrieves new samples from a proxy event and moves them into consecutive SamplePtr<T> slots of samples
+/// within a single call, i.e. without calling back into Rust per sample. The caller takes ownership of the first n
+/// slots, n being the returned number of samples, and has to release each of them via mw_com_delete_sample_ptr.
+/// \param event_ptr Opaque proxy event pointer (ProxyEventBase*)
+/// \param type_ops Pointer to TypeOperations for the event data type T
+/// \param samples Uninitialized storage for at least max_samples instances of SamplePtr<T>
+/// \param max_samples Maximum number of samples to retrieve
+/// \return Number of samples retrieved, or std::numeric_limits<std::uint32_t>::max() on error
+std::uint32_t mw_com_type_registry_get_samples_from_event_batch(ProxyEventBase* event_ptr,
+                                                                const TypeOperations* type_ops,
+                                                                void* samples,
+                                                                uint32_t max_samples)
+{
+    if (event_ptr == nullptr || type_ops == nullptr || samples == nullptr)
+    {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+
+    auto result = type_ops->GetSamplesFromEventBatch(event_ptr, max_samples, samples);
+
+    if (result.has_value() == false)
+    {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+
+    return result.value();
+}
+
 /// @brief Get sample data pointer from SamplePtr<T>
 /// @param sample_ptr Opaque sample pointer
 /// @param type_ops Type operations pointer
@@ -35,8 +35,12 @@
 //    - get_type_operations<T>(): Template function providing per-type singleton TypeOperationImpl<T>
 //
 //  How it works:
-//  - Registry is filled at COMPILE TIME using macros (BEGIN_EXPORT_MW_COM_INTERFACE, EXPORT_MW_COM_EVENT)
-//  - Macros create static helper structs that register InterfaceOperationImpl and MemberOperationImpl at startup
+//  - Registry is filled at COMPILE TIME using macros (BEGIN_EXPORT_MW_COM_INTERFACE, EXPORT_MW_COM_EVENT,
+//    EXPORT_MW_COM_FIELD)
+//  - Macros create static helper structs that register InterfaceOperationImpl and MemberOperationImpl (or
+//    FieldMemberOperationImpl) at startup
+//  - A field is exposed via the event dispatching its notifications, so all event based type operations apply to
+//    fields as well. Only updating the field before it is offered requires the field itself.
 //  - Type operations are resolved at COMPILE TIME via template specialization (get_type_operations<T>)
 //  - Each type T has a single static TypeOperationImpl<T> instance shared across all events of that type
 //  - Interface and member lookups use string keys (interface_id, event_id), type dispatch uses direct pointers
@@ -68,9 +72,13 @@
 #include "score/mw/com/impl/proxy_base.h"
 #include "score/mw/com/impl/proxy_event.h"
 #include "score/mw/com/impl/proxy_event_base.h"
+#include "score/mw/com/impl/proxy_field.h"
+#include "score/mw/com/impl/proxy_field_base.h"
 #include "score/mw/com/impl/skeleton_base.h"
 #include "score/mw/com/impl/skeleton_event.h"
 #include "score/mw/com/impl/skeleton_event_base.h"
+#include "score/mw/com/impl/skeleton_field.h"
+#include "score/mw/com/impl/skeleton_field_base.h"
 #include "score/mw/com/types.h"
 
 #include <score/assert.hpp>
@@ -305,6 +313,36 @@ inline score::Result<std::uint32_t> GetSamplesFromEvent(::score::mw::com::impl::
     }
 }
 
+/// \brief Get samples from ProxyEvent with type erasure into caller provided storage
+/// \details Moves each sample of type T retrieved from the event into the next element of samples, so that all samples
+/// are handed over with a single FFI call instead of one callback into Rust per sample.
+/// \param proxy_event Reference to ProxyEvent of type T
+/// \param samples Uninitialized storage for at least max_num_samples instances of SamplePtr<T>. The first n elements,
+/// n being the returned number of samples, are constructed and owned by the caller afterwards.
+/// \param max_num_samples Maximum number of samples to process
+/// \return Result containing the number of samples stored on success, or error code on failure
+template <typename T>
+inline score::Result<std::uint32_t> GetSamplesFromEventBatch(::score::mw::com::impl::ProxyEvent<T>& proxy_event,
+                                                             SamplePtr<T>* samples,
+                                                             std::uint32_t max_num_samples) noexcept
+{
+    std::uint32_t num_samples{0U};
+    auto result = proxy_event.GetNewSamples(
+        [samples, &num_samples, max_num_samples](SamplePtr<T> sample) noexcept {
+            SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(num_samples < max_num_samples,
+                                                        "GetNewSamples delivered more samples than requested");
+            new (&samples[num_samples]) SamplePtr<T>(std::move(sample));
+            ++num_samples;
+        },
+        max_num_samples);
+
+    if (!result.has_value())
+    {
+        return score::MakeUnexpected<std::uint32_t>(result.error());
+    }
+    return num_samples;
+}
+
 }  // namespace details
 
 /// \brief Interface for type-erased operations on types used in ProxyEvent and SkeletonEvent
@@ -325,6 +363,16 @@ class TypeOperations
                                                  uint32_t max_sample,
                                                  FatPtr callBack) const = 0;
 
+    /// \brief Get samples from ProxyEvent of specific type into caller provided storage
+    /// \details Retrieves samples from a ProxyEvent and moves them into consecutive SamplePtr<T> slots of samples.
+    /// \param event_ptr Pointer to ProxyEventBase instance
+    /// \param max_sample Maximum number of samples to process
+    /// \param samples Uninitialized storage for at least max_sample instances of SamplePtr<T>
+    /// \return Result containing the number of samples stored on success, or error code on failure
+    virtual Result<uint32_t> GetSamplesFromEventBatch(ProxyEventBase* event_ptr,
+                                                      uint32_t max_sample,
+                                                      void* samples) const = 0;
+
     /// \brief Send event data through SkeletonEvent of specific type
     /// \details Casts the type-erased data pointer back to the actual type and sends it via SkeletonEvent.
     /// \param event_ptr Pointer to SkeletonEventBase instance
@@ -386,6 +434,19 @@ class TypeOperationImpl : public TypeOperations
         return details::GetSamplesFromEvent<T>(*proxy_event, callBack, max_sample);
     }
 
+    Result<uint32_t> GetSamplesFromEventBatch(ProxyEventBase* event_ptr,
+                                              uint32_t max_sample,
+                                              void* samples) const override
+    {
+        auto proxy_event = dynamic_cast<ProxyEvent<T>*>(event_ptr);
+        if (proxy_event == nullptr || samples == nullptr)
+        {
+            return score::MakeUnexpected<std::uint32_t>(ComErrc::kInvalidHandle);
+        }
+        return details::GetSamplesFromEventBatch<T>(
+            *proxy_event, static_cast<::score::mw::com::impl::SamplePtr<T>*>(samples), max_sample);
+    }
+
     bool SkeletonSendEvent(SkeletonEventBase* event_ptr, void* data_ptr) const override
     {
 
@@ -502,6 +563,13 @@ class MemberOperation
     /// \brief Get TypeOperations for type-erased sample handling
     /// \return Pointer to TypeOperations instance for the event data type
     virtual const TypeOperations* GetTypeOps() const noexcept = 0;
+
+    /// \brief Update the value of a SkeletonField member
+    /// \details Before the skeleton is offered, the value is stored as initial value of the field.
+    /// \param skeleton_ptr Pointer to SkeletonBase instance
+    /// \param data_ptr Pointer to the new field value of the field data type
+    /// \return true if the member is a field and the update succeeded, false otherwise
+    virtual bool UpdateSkeletonField(SkeletonBase* skeleton_ptr, const void* data_ptr) = 0;
 };
 
 /// \brief Template implementation of MemberOperation for specific ProxyType and SkeletonType
@@ -550,10 +618,81 @@ class MemberOperationImpl : public MemberOperation
         return type_ops_ptr_;
     }
 
+    bool UpdateSkeletonField(SkeletonBase*, const void*) override
+    {
+        // An event is not a field
+        return false;
+    }
+
   private:
     const TypeOperations* type_ops_ptr_;
 };
 
+/// \brief Template implementation of MemberOperation for field members of a specific ProxyType and SkeletonType
+/// \details The ProxyEvent and SkeletonEvent returned for a field are the events dispatching its notifications. Thus the
+/// field can be used with the same TypeOperations as an event of FieldType. The field needs the WithNotifier tag.
+template <typename ProxyType,
+          typename SkeletonType,
+          typename FieldType,
+          auto proxy_field_member,
+          auto skeleton_field_member>
+class FieldMemberOperationImpl : public MemberOperation
+{
+  public:
+    /// Constructor to cache TypeOperations pointer for efficient member access
+    explicit FieldMemberOperationImpl(const TypeOperations* type_ops) noexcept : type_ops_ptr_{type_ops} {}
+
+    ProxyEventBase* GetProxyEvent(ProxyBase* proxy_ptr) override
+    {
+        auto proxy = dynamic_cast<ProxyType*>(proxy_ptr);
+        if (proxy == nullptr)
+        {
+            return nullptr;
+        }
+
+        return ProxyFieldBaseView{proxy->*proxy_field_member}.GetEventBase();
+    }
+
+    SkeletonEventBase* GetSkeletonEvent(SkeletonBase* skeleton_ptr) override
+    {
+        auto* skeleton = GetSkeleton(skeleton_ptr);
+        if (skeleton == nullptr)
+        {
+            return nullptr;
+        }
+
+        return &SkeletonFieldBaseView{skeleton->*skeleton_field_member}.GetEventBase();
+    }
+
+    const TypeOperations* GetTypeOps() const noexcept override
+    {
+        return type_ops_ptr_;
+    }
+
+    bool UpdateSkeletonField(SkeletonBase* skeleton_ptr, const void* data_ptr) override
+    {
+        auto* skeleton = GetSkeleton(skeleton_ptr);
+        if (skeleton == nullptr || data_ptr == nullptr)
+        {
+            return false;
+        }
+
+        return (skeleton->*skeleton_field_member).Update(*static_cast<const FieldType*>(data_ptr)).has_value();
+    }
+
+  private:
+    static SkeletonType* GetSkeleton(SkeletonBase* skeleton_ptr)
+    {
+        if (skeleton_ptr == nullptr)
+        {
+            return nullptr;
+        }
+        return dynamic_cast<SkeletonType*>(skeleton_ptr);
+    }
+
+    const TypeOperations* type_ops_ptr_;
+};
+
 /// \brief Interface for type-erased proxy and skeleton creation operations
 /// \details Provides methods to create proxy/skeleton instances and register/retrieve member operations.
 /// Maintains a registry of member operations for events, methods, and fields.
@@ -787,6 +926,34 @@ inline ::score::mw::com::impl::rust::TypeOperationImpl<T>& get_type_operations()
                                                                                                                   \
     static event_member##_EventRegistrationHelper event_member##_event_reg_instance;
 
+/// \brief Macro to register field member operations
+/// \details Creates registry for field member operations for a specific interface and field name.
+/// Uses a static struct to register FieldMemberOperationImpl at startup/before main(). Fields share the
+/// TypeOperationImpl<field_type> instance with all events of the same type. The field needs the WithNotifier tag.
+/// \param field_type Data type of the field (e.g., Mileage)
+/// \param field_member Field member name in Proxy and Skeleton classes (e.g., mileage)
+/// \note Example usage: EXPORT_MW_COM_FIELD(Mileage, mileage)
+#define EXPORT_MW_COM_FIELD(field_type, field_member)                                                             \
+    struct field_member##_FieldRegistrationHelper                                                                 \
+    {                                                                                                             \
+        field_member##_FieldRegistrationHelper()                                                                  \
+        {                                                                                                         \
+            auto& type_ops = ::score::mw::com::impl::rust::get_type_operations<field_type>();                     \
+                                                                                                                  \
+            auto field_info = std::make_unique<                                                                   \
+                ::score::mw::com::impl::rust::FieldMemberOperationImpl<ProxyType,                                 \
+                                                                       SkeletonType,                              \
+                                                                       field_type,                                \
+                                                                       &ProxyType::field_member,                  \
+                                                                       &SkeletonType::field_member>>(&type_ops);  \
+                                                                                                                  \
+            ::score::mw::com::impl::rust::GlobalRegistryMapping::RegisterMemberOperation(                         \
+                std::string_view(id_interface), std::string_view(#field_member), std::move(field_info));          \
+        }                                                                                                         \
+    };                                                                                                            \
+                                                                                                                  \
+    static field_member##_FieldRegistrationHelper field_member##_field_reg_instance;
+
 #define END_EXPORT_MW_COM_INTERFACE() }  // namespace id##_detail
 
 /// \brief Macro to create type specific class and support functions
@@ -16,7 +16,8 @@
 //! that can subscribe to events and receive data samples.
 //! It uses FFI to interact with the underlying C++ implementation.
 //! Main components include `LolaConsumerInfo`, `SubscribableImpl`,
-//! `SubscriberImpl`, `LolaConsumerDiscovery`, and `LolaConsumerBuilder`.
+//! `SubscriberImpl`, `FieldSubscribableImpl`, `FieldSubscriberImpl`, `LolaConsumerDiscovery`,
+//! and `LolaConsumerBuilder`.
 //! These components work together to enable consumers to discover services,
 //! subscribe to events, and receive data samples in a type-safe manner.
 //! The implementation ensures proper memory management and resource handling
@@ -30,10 +31,11 @@
 #![allow(clippy::needless_lifetimes)]
 
 use crate::Debug;
+use core::cell::UnsafeCell;
 use core::clone::Clone;
 use core::future::Future;
 use core::marker::PhantomData;
-use core::mem::ManuallyDrop;
+use core::mem::{ManuallyDrop, MaybeUninit};
 use core::ops::{Deref, DerefMut};
 use core::panic;
 use core::ptr::NonNull;
@@ -46,8 +48,9 @@ use std::sync::Arc;
 
 use com_api_concept::{
     Builder, CommData, Consumer, ConsumerBuilder, ConsumerDescriptor, ConsumerFailedReason, Error,
-    EventFailedReason, InstanceSpecifier, Interface, ReceiveFailedReason, Result, SampleContainer,
-    ServiceDiscovery, ServiceFailedReason, Subscriber, Subscription,
+    EventFailedReason, FieldSubscriber, FieldSubscription, InstanceSpecifier, Interface,
+    ReceiveFailedReason, Result, SampleContainer, ServiceDiscovery, ServiceFailedReason,
+    Subscriber, Subscription,
 };
 
 use bridge_ffi_rs::*;
@@ -103,6 +106,25 @@ where
     }
 }
 
+impl<T, B: FFIBridge> LolaBinding<T, B>
+where
+    T: CommData + Debug,
+{
+    fn get_data(&self) -> &T {
+        //SAFETY: It is safe to get the data pointer because SamplePtr is valid
+        //and data is valid as long as SamplePtr is valid
+        unsafe {
+            let data_ptr = self.bridge.sample_ptr_get(
+                std::ptr::from_ref(&(*self.data)) as *const std::ffi::c_void,
+                &self.type_ops,
+            );
+            (data_ptr as *const T)
+                .as_ref()
+                .expect("Data pointer is null")
+        }
+    }
+}
+
 #[derive(Debug)]
 pub struct Sample<T, B: FFIBridge>
 where
@@ -121,17 +143,7 @@ where
     T: CommData + Debug,
 {
     pub fn get_data(&self) -> &T {
-        //SAFETY: It is safe to get the data pointer because SamplePtr is valid
-        //and data is valid as long as SamplePtr is valid
-        unsafe {
-            let data_ptr = self.inner.bridge.sample_ptr_get(
-                std::ptr::from_ref(&(*self.inner.data)) as *const std::ffi::c_void,
-                &self.inner.type_ops,
-            );
-            (data_ptr as *const T)
-                .as_ref()
-                .expect("Data pointer is null")
-        }
+        self.inner.get_data()
     }
 }
 
@@ -365,6 +377,7 @@ impl<T: CommData + Debug, B: FFIBridge> Subscriber<T, LolaRuntimeImpl<B>>
         Ok(SubscriberImpl {
             event: ProxyEventManager::new(
                 std::ptr::from_ref(event_instance.get_proxy_event_base()) as *mut ProxyEventBase,
+                max_num_samples,
             ),
             event_id: self.identifier,
             max_num_samples,
@@ -380,9 +393,13 @@ impl<T: CommData + Debug, B: FFIBridge> Subscriber<T, LolaRuntimeImpl<B>>
 
 /// The ProxyEventManager struct manages the proxy event pointer and
 /// ensures that concurrent receive calls are not allowed on the same subscriber instance.
-struct ProxyEventManager {
+/// It also owns the storage into which the C++ side moves the samples of one batched receive
+/// call. The storage is allocated once per subscription and only accessed through the
+/// ProxyEventManagerGuard, so receiving samples neither allocates nor calls back into Rust.
+struct ProxyEventManager<T> {
     event: *mut ProxyEventBase,
     in_progress: AtomicBool,
+    sample_batch: UnsafeCell<Box<[MaybeUninit<sample_ptr_rs::SamplePtr<T>>]>>,
 }
 
 //SAFETY: ProxyEventManager is safe to send between threads because:
@@ -393,20 +410,24 @@ struct ProxyEventManager {
 // However, it uses an AtomicBool to ensure that concurrent receive calls are not allowed on the
 // same subscriber instance,
 // which provides thread safety for receive operations.
-unsafe impl Send for ProxyEventManager {}
-unsafe impl Sync for ProxyEventManager {}
-
-impl ProxyEventManager {
-    /// Creates a new ProxyEventManager with the given proxy event pointer.
-    pub fn new(event: *mut ProxyEventBase) -> Self {
+// The sample batch storage holds no initialized SamplePtr outside of a receive call, and during
+// a receive call it is only accessed through the exclusive ProxyEventManagerGuard.
+unsafe impl<T> Send for ProxyEventManager<T> {}
+unsafe impl<T> Sync for ProxyEventManager<T> {}
+
+impl<T> ProxyEventManager<T> {
+    /// Creates a new ProxyEventManager with the given proxy event pointer and storage for
+    /// max_num_samples samples per receive call.
+    pub fn new(event: *mut ProxyEventBase, max_num_samples: usize) -> Self {
         Self {
             event,
             in_progress: AtomicBool::new(false),
+            sample_batch: UnsafeCell::new(Box::new_uninit_slice(max_num_samples)),
         }
     }
     /// Provides access to the proxy event pointer while ensuring that-
     /// concurrent receive calls are not allowed on the same subscriber instance.
-    pub fn get_proxy_event(&self) -> ProxyEventManagerGuard<'_> {
+    pub fn get_proxy_event(&self) -> ProxyEventManagerGuard<'_, T> {
         //Acquire the lock to ensure that only one receive call can access the proxy event at a time
         //Relaxed ordering is not sufficient here because we need to ensure that the in_progress
         // flag is updated before any receive call can access the proxy event
@@ -420,7 +441,7 @@ impl ProxyEventManager {
     }
 }
 
-impl Debug for ProxyEventManager {
+impl<T> Debug for ProxyEventManager<T> {
     fn fmt(&self, f: &mut core::fmt::Formatter<'_>) -> core::fmt::Result {
         f.debug_struct("ProxyEventManager")
             .field(
@@ -435,11 +456,31 @@ impl Debug for ProxyEventManager {
 /// while ensuring that concurrent receive calls are not allowed on the same subscriber instance.
 /// It implements Deref and DerefMut to allow access to the underlying ProxyEventBase pointer,
 /// and it uses the Drop trait to reset the in_progress flag when the guard goes out of scope.
-struct ProxyEventManagerGuard<'a> {
-    manager: &'a ProxyEventManager,
+struct ProxyEventManagerGuard<'a, T> {
+    manager: &'a ProxyEventManager<T>,
 }
 
-impl<'a> Drop for ProxyEventManagerGuard<'a> {
+impl<'a, T> ProxyEventManagerGuard<'a, T> {
+    /// Provides the proxy event together with the sample batch storage of the manager.
+    fn event_and_sample_batch(
+        &mut self,
+    ) -> (
+        &mut ProxyEventBase,
+        &mut [MaybeUninit<sample_ptr_rs::SamplePtr<T>>],
+    ) {
+        // SAFETY: The guard grants exclusive access to the event and the sample batch storage
+        // for its lifetime, see get_proxy_event(). The event pointer is valid as long as the
+        // subscriber instance is valid.
+        unsafe {
+            (
+                self.manager.event.as_mut().expect("Event pointer is null"),
+                (*self.manager.sample_batch.get()).as_mut(),
+            )
+        }
+    }
+}
+
+impl<'a, T> Drop for ProxyEventManagerGuard<'a, T> {
     fn drop(&mut self) {
         self.manager
             .in_progress
@@ -447,7 +488,7 @@ impl<'a> Drop for ProxyEventManagerGuard<'a> {
     }
 }
 
-impl<'a> Deref for ProxyEventManagerGuard<'a> {
+impl<'a, T> Deref for ProxyEventManagerGuard<'a, T> {
     type Target = ProxyEventBase;
 
     fn deref(&self) -> &Self::Target {
@@ -455,7 +496,7 @@ impl<'a> Deref for ProxyEventManagerGuard<'a> {
     }
 }
 
-impl<'a> DerefMut for ProxyEventManagerGuard<'a> {
+impl<'a, T> DerefMut for ProxyEventManagerGuard<'a, T> {
     fn deref_mut(&mut self) -> &mut Self::Target {
         unsafe { self.manager.event.as_mut().expect("Event pointer is null") }
     }
@@ -472,7 +513,7 @@ pub struct SubscriberImpl<T, B: FFIBridge>
 where
     T: CommData + Debug,
 {
-    event: ProxyEventManager,
+    event: ProxyEventManager<T>,
     event_id: &'static str,
     max_num_samples: usize,
     instance_info: LolaConsumerInfo<B>,
@@ -507,7 +548,7 @@ impl<T: CommData + Debug, B: FFIBridge> Drop for SubscriberImpl<T, B> {
 }
 
 impl<T: CommData + Debug, B: FFIBridge> SubscriberImpl<T, B> {
-    fn init_async_receive(&self, event_guard: &mut ProxyEventManagerGuard) -> Result<()> {
+    fn init_async_receive(&self, event_guard: &mut ProxyEventManagerGuard<T>) -> Result<()> {
         let callback_waker = Arc::clone(&self.waker_storage);
         let waker_callback = move || {
             callback_waker.wake();
@@ -618,7 +659,7 @@ where
     ) -> Result<usize> {
         try_receive_samples::<T, B>(
             &self.instance_info.bridge,
-            self.event.get_proxy_event().deref_mut(),
+            &mut self.event.get_proxy_event(),
             scratch,
             self.max_num_samples,
             max_samples,
@@ -691,13 +732,163 @@ where
     }
 }
 
+/// Number of samples a field subscription holds at most: the current value, which is referenced
+/// by the user, and the newer value, which replaces it.
+const FIELD_MAX_NUM_SAMPLES: usize = 2;
+
+#[derive(Debug)]
+pub struct FieldSubscribableImpl<T, B: FFIBridge> {
+    identifier: &'static str,
+    instance_info: LolaConsumerInfo<B>,
+    proxy_instance: ProxyInstanceManager<B>,
+    data: PhantomData<T>,
+}
+
+impl<T: CommData + Debug, B: FFIBridge> FieldSubscriber<T, LolaRuntimeImpl<B>>
+    for FieldSubscribableImpl<T, B>
+{
+    type Subscription = FieldSubscriberImpl<T, B>;
+    fn new(identifier: &'static str, instance_info: LolaConsumerInfo<B>) -> Result<Self> {
+        let handle = instance_info.get_handle().ok_or(Error::ConsumerError(
+            ConsumerFailedReason::ServiceHandleNotFound,
+        ))?;
+        let native_proxy =
+            NativeProxyBase::new(&instance_info.bridge, instance_info.interface_id, handle)?;
+        let proxy_instance = ProxyInstanceManager(Arc::new(native_proxy));
+        Ok(Self {
+            identifier,
+            instance_info,
+            proxy_instance,
+            data: PhantomData,
+        })
+    }
+    fn subscribe(self) -> Result<Self::Subscription> {
+        let instance_info = self.instance_info.clone();
+        // The field notifier is the proxy event of the field, so it is looked up like an event.
+        let event_instance = NativeProxyEventBase::new::<B>(
+            &self.proxy_instance.0.proxy,
+            &instance_info,
+            self.identifier,
+        )?;
+        //SAFETY: It is safe to subscribe to the field because event_instance is valid
+        // which was obtained from valid proxy instance
+        let status = unsafe {
+            self.instance_info.bridge.subscribe_to_event(
+                std::ptr::from_ref(event_instance.get_proxy_event_base()) as *mut ProxyEventBase,
+                FIELD_MAX_NUM_SAMPLES as u32,
+            )
+        };
+        if !status {
+            return Err(Error::EventError(EventFailedReason::EventNotAvailable));
+        }
+        let type_ops = unsafe {
+            self.instance_info
+                .bridge
+                .get_type_ops_instance(self.instance_info.interface_id, self.identifier)
+        }
+        .ok_or(Error::EventError(EventFailedReason::EventNotAvailable))?;
+
+        Ok(FieldSubscriberImpl {
+            // Only the newest value is fetched per call, so the batch storage holds one sample.
+            event: ProxyEventManager::new(
+                std::ptr::from_ref(event_instance.get_proxy_event_base()) as *mut ProxyEventBase,
+                1,
+            ),
+            field_id: self.identifier,
+            instance_info,
+            type_ops,
+            latest: None,
+            _proxy: self.proxy_instance.clone(),
+        })
+    }
+}
+
+/// The FieldSubscriberImpl struct implements the FieldSubscription trait for LolaRuntimeImpl.
+/// It keeps the sample with the latest field value, so the value can be read in place from the
+/// shared memory without copying it. The sample is released once a newer value was received.
+#[derive(Debug)]
+pub struct FieldSubscriberImpl<T, B: FFIBridge>
+where
+    T: CommData + Debug,
+{
+    event: ProxyEventManager<T>,
+    field_id: &'static str,
+    instance_info: LolaConsumerInfo<B>,
+    type_ops: TypeOperationsManager,
+    latest: Option<LolaBinding<T, B>>,
+    _proxy: ProxyInstanceManager<B>,
+}
+
+impl<T: CommData + Debug, B: FFIBridge> Drop for FieldSubscriberImpl<T, B> {
+    fn drop(&mut self) {
+        // The latest sample has to be released before unsubscribing from the field.
+        drop(self.latest.take());
+        let mut guard = self.event.get_proxy_event();
+        // SAFETY: It is safe to unsubscribe from the field because the event pointer is valid
+        // and was created during subscription.
+        unsafe {
+            self.instance_info
+                .bridge
+                .unsubscribe_to_event(guard.deref_mut());
+        }
+    }
+}
+
+impl<T, B: FFIBridge> FieldSubscription<T, LolaRuntimeImpl<B>> for FieldSubscriberImpl<T, B>
+where
+    T: CommData + Debug,
+{
+    type Subscriber = FieldSubscribableImpl<T, B>;
+
+    fn unsubscribe(self) -> Self::Subscriber {
+        //Unsubscribe FFI call will be triggered in Drop implementation of FieldSubscriberImpl.
+        FieldSubscribableImpl {
+            identifier: self.field_id,
+            instance_info: self.instance_info.clone(),
+            proxy_instance: self._proxy.clone(),
+            data: PhantomData,
+        }
+    }
+
+    fn current(&mut self) -> Result<Option<&T>> {
+        let mut event_guard = self.event.get_proxy_event();
+        let (event, sample_batch) = event_guard.event_and_sample_batch();
+        // SAFETY: event is a valid ProxyEventBase pointer obtained during subscription.
+        // sample_batch provides storage for one SamplePtr<T>, the C++ side constructs at most one.
+        // Since the newest samples are collected first, older values are skipped.
+        let count = unsafe {
+            self.instance_info.bridge.get_samples_from_event_batch(
+                event as *mut ProxyEventBase,
+                &self.type_ops,
+                sample_batch.as_mut_ptr() as *mut std::ffi::c_void,
+                1,
+            )
+        };
+        if count > 1 {
+            return Err(Error::ReceiveError(ReceiveFailedReason::ReceiveError));
+        }
+        if count == 1 {
+            // SAFETY: The first element has been constructed by the C++ side and ownership of it
+            // is moved from FFI to Rust here. Replacing the latest sample releases its slot.
+            let sample_ptr = unsafe { sample_batch[0].assume_init_read() };
+            self.latest = Some(LolaBinding {
+                data: ManuallyDrop::new(sample_ptr),
+                bridge: self.instance_info.bridge.clone(),
+                type_ops: self.type_ops,
+            });
+        }
+        drop(event_guard);
+        Ok(self.latest.as_ref().map(LolaBinding::get_data))
+    }
+}
+
 // The ReceiveFuture struct encapsulates the state and logic for asynchronously receiving samples
 // from the proxy event. It holds a reference to the proxy event manager,
 // a waker storage for async notifications, and parameters for managing the receive operation.
 // The Future implementation for ReceiveFuture defines the polling logic,
 // which attempts to receive samples and manages the state of the receive operation.
 struct ReceiveFuture<'a, T: CommData + Debug, F: Future<Output = ()>, B: FFIBridge> {
-    event_guard: Option<ProxyEventManagerGuard<'a>>,
+    event_guard: Option<ProxyEventManagerGuard<'a, T>>,
     waker_storage: Arc<AtomicWaker>,
     max_num_samples: usize,
     scratch: Option<SampleContainer<Sample<T, B>>>,
@@ -743,7 +934,7 @@ impl<'a, T: CommData + Debug, F: Future<Output = ()>, B: FFIBridge> Future
         let samples_received = match (this.scratch.as_mut(), this.event_guard.as_mut()) {
             (Some(scratch), Some(event_guard)) => try_receive_samples::<T, B>(
                 &this.bridge,
-                event_guard.deref_mut(),
+                event_guard,
                 scratch,
                 max_num_samples,
                 max_samples - total_received,
@@ -815,7 +1006,7 @@ impl<'a, T: CommData + Debug, B: FFIBridge> Stream for SampleStream<'a, T, B> {
 
         let samples_received = try_receive_samples::<T, B>(
             &this.subscriber.instance_info.bridge,
-            this.subscriber.event.get_proxy_event().deref_mut(), // Get mutable reference to the proxy event for FFI call
+            &mut this.subscriber.event.get_proxy_event(), // Exclusive access to the proxy event for the FFI call
             &mut this.sample_container,
             max_num_samples,
             max_num_samples,
@@ -1108,15 +1299,17 @@ impl<I: Interface, B: FFIBridge> ConsumerDescriptor<LolaRuntimeImpl<B>>
 ///
 /// This is the standalone implementation of the sample-receive logic, shared by
 /// `Subscription::try_receive` and `ReceiveFuture::poll`.
+/// The samples are fetched with a single batched FFI call, which moves them into the sample batch
+/// storage of the proxy event manager, instead of calling back into Rust once per sample.
 ///
 /// # Parameters
-/// * `event` - Mutable reference to the proxy event to fetch samples from
+/// * `event_guard` - Exclusive access to the proxy event to fetch samples from
 /// * `scratch` - Mutable reference to the sample container
 /// * `max_num_samples` - Maximum allowed samples for this subscription
 /// * `max_samples` - How many samples to fetch in this call
 fn try_receive_samples<T: CommData + Debug, B: FFIBridge>(
     bridge: &B,
-    event: &mut ProxyEventBase,
+    event_guard: &mut ProxyEventManagerGuard<'_, T>,
     scratch: &mut SampleContainer<Sample<T, B>>,
     max_num_samples: usize,
     max_samples: usize,
@@ -1130,7 +1323,8 @@ fn try_receive_samples<T: CommData + Debug, B: FFIBridge>(
             },
         ));
     }
-    if max_samples > max_num_samples {
+    let (event, sample_batch) = event_guard.event_and_sample_batch();
+    if max_samples > max_num_samples || max_samples > sample_batch.len() {
         return Err(Error::ReceiveError(
             ReceiveFailedReason::SampleCountOutOfBounds {
                 max: max_num_samples,
@@ -1138,20 +1332,14 @@ fn try_receive_samples<T: CommData + Debug, B: FFIBridge>(
             },
         ));
     }
-    // Create a callback that will be called by the C++ side for each new sample arrival
-    let mut callback = create_sample_callback::<T, B>(bridge, scratch, max_samples, type_ops);
-    // Convert closure to FatPtr for C++ callback
-    let dyn_callback: &mut dyn FnMut(*mut sample_ptr_rs::SamplePtr<T>) = &mut callback;
-    // SAFETY: it is safe to transmute the closure reference to a FatPtr because
-    // it has the same representation in memory like FnMut pointer
-    let fat_ptr: FatPtr = unsafe { std::mem::transmute(dyn_callback) };
     // SAFETY: event is a valid ProxyEventBase pointer obtained during subscription.
-    // The lifetime of the callback is managed by Rust and will not outlive this function call.
+    // sample_batch provides storage for at least max_samples SamplePtr<T>, the C++ side
+    // constructs at most max_samples of them.
     let count = unsafe {
-        bridge.get_samples_from_event(
+        bridge.get_samples_from_event_batch(
             event as *mut ProxyEventBase,
             type_ops,
-            &fat_ptr,
+            sample_batch.as_mut_ptr() as *mut std::ffi::c_void,
             max_samples as u32,
         )
     };
@@ -1163,59 +1351,50 @@ fn try_receive_samples<T: CommData + Debug, B: FFIBridge>(
             },
         ));
     }
+    for raw_sample in &sample_batch[..count as usize] {
+        // SAFETY: The first count elements have been constructed by the C++ side and
+        // ownership of them is moved from FFI to Rust here. Each element is read exactly once.
+        let sample_ptr = unsafe { raw_sample.assume_init_read() };
+        push_received_sample(bridge, scratch, sample_ptr, max_samples, type_ops);
+    }
     Ok(count as usize)
 }
 
-/// Creates a callback function for processing FFI samples into the sample container.
-///
-/// This callback is invoked by the C++ side for each new sample arrival.
-/// It wraps raw sample pointers into Rust-managed Sample<T> objects and stores them
-/// in the provided scratch buffer, maintaining the max_samples limit.
-///
-/// # Safety
-/// The returned closure must not outlive the scope where `scratch` is valid.
-/// The closure captures a mutable reference to `scratch`.
+/// Wraps a sample received via FFI into a Rust-managed Sample<T> and stores it in the scratch
+/// buffer, maintaining the max_samples limit.
 ///
 /// # Parameters
 /// * `scratch` - Mutable reference to the sample container
+/// * `sample_ptr` - The received sample, owned by Rust
 /// * `max_samples` - Maximum number of samples to maintain in the container
-pub fn create_sample_callback<'a, T: CommData + Debug, B: FFIBridge>(
+fn push_received_sample<T: CommData + Debug, B: FFIBridge>(
     bridge: &B,
-    scratch: &'a mut SampleContainer<Sample<T, B>>,
+    scratch: &mut SampleContainer<Sample<T, B>>,
+    sample_ptr: sample_ptr_rs::SamplePtr<T>,
     max_samples: usize,
-    type_ops: &'a TypeOperationsManager,
-) -> impl FnMut(*mut sample_ptr_rs::SamplePtr<T>) + 'a {
-    let bridge = bridge.clone();
-    move |raw_sample: *mut sample_ptr_rs::SamplePtr<T>| {
-        if !raw_sample.is_null() {
-            //SAFETY: It is safe to read the sample pointer because
-            // raw_sample is valid pointer passed from FFI callback
-            // and raw_pointer is moved from FFI to Rust ownership here
-            let sample_ptr = unsafe { std::ptr::read(raw_sample) };
-
-            let wrapped_sample = Sample {
-                //Relaxed ordering is sufficient here as we just need a unique id for each sample
-                id: ID_COUNTER.fetch_add(1, std::sync::atomic::Ordering::Relaxed),
-                inner: LolaBinding {
-                    data: ManuallyDrop::new(sample_ptr),
-                    bridge: bridge.clone(),
-                    type_ops: type_ops.clone(),
-                },
-            };
-
-            // try_receive / receive path: drop the oldest sample to make room
-            // so the buffer always contains the newest samples (sliding window).
-            // But for stream container already empty the buffer before receiving new samples,
-            // so it will not drop old samples when new samples arrive.
-            while scratch.sample_count() >= max_samples {
-                scratch.pop_front();
-            }
-            assert!(
-                scratch.push_back(wrapped_sample).is_ok(),
-                "Failed to push sample after making room in buffer"
-            );
-        }
+    type_ops: &TypeOperationsManager,
+) {
+    let wrapped_sample = Sample {
+        //Relaxed ordering is sufficient here as we just need a unique id for each sample
+        id: ID_COUNTER.fetch_add(1, std::sync::atomic::Ordering::Relaxed),
+        inner: LolaBinding {
+            data: ManuallyDrop::new(sample_ptr),
+            bridge: bridge.clone(),
+            type_ops: *type_ops,
+        },
+    };
+
+    // try_receive / receive path: drop the oldest sample to make room
+    // so the buffer always contains the newest samples (sliding window).
+    // But for stream container already empty the buffer before receiving new samples,
+    // so it will not drop old samples when new samples arrive.
+    while scratch.sample_count() >= max_samples {
+        scratch.pop_front();
     }
+    assert!(
+        scratch.push_back(wrapped_sample).is_ok(),
+        "Failed to push sample after making room in buffer"
+    );
 }
 
 #[cfg(test)]
@@ -1236,6 +1415,18 @@ mod test {
         const ID: &'static str = "TestData";
     }
 
+    // Constructs count placeholder SamplePtr in the sample batch storage, like the C++ side does.
+    // The placeholders are never dereferenced, as the mock bridge handles all sample operations.
+    unsafe fn write_mock_samples<T>(samples: *mut std::ffi::c_void, count: usize) {
+        unsafe {
+            std::ptr::write_bytes(
+                samples as *mut MaybeUninit<sample_ptr_rs::SamplePtr<T>>,
+                0,
+                count,
+            );
+        }
+    }
+
     // Builds a ProxyInstanceManager<SharedMockBridge>
     fn make_proxy_instance(
         bridge: SharedMockBridge,
@@ -1366,9 +1557,16 @@ mod test {
                         .expect("Failed to allocate TypeOperations for mock"),
                 ))
             });
-        mock.expect_get_samples_from_event()
+        mock.expect_get_samples_from_event_batch()
             .in_sequence(&mut seq)
-            .returning(|_, _, _, _| 1);
+            .returning(|_, _, samples, _| {
+                // SAFETY: try_receive passes storage for at least max_samples SamplePtr.
+                unsafe { write_mock_samples::<TestData>(samples, 1) };
+                1
+            });
+        mock.expect_sample_ptr_delete()
+            .times(1)
+            .returning(|_, _| ());
         mock.expect_set_event_receive_handler()
             .in_sequence(&mut seq)
             .returning(|_, _| true);
@@ -1416,6 +1614,86 @@ mod test {
         );
     }
 
+    // Verify that the samples of a batched receive are moved into the container, and that the
+    // container keeps only the newest samples once it is full.
+    #[test]
+    fn test_event_try_receive_batch_keeps_newest_samples() {
+        let proxy_alloc = MockPointerAllocator::<ProxyBase>::new();
+        let event_alloc = MockPointerAllocator::<ProxyEventBase>::new();
+        let type_ops_alloc = MockPointerAllocator::<TypeOperations>::new();
+        let deleted_samples = Arc::new(AtomicUsize::new(0));
+        let mut mock = MockFFIBridge::new();
+
+        let proxy_alloc_clone = proxy_alloc.clone();
+        let event_alloc_clone = event_alloc.clone();
+        mock.expect_create_proxy()
+            .returning(move |_, _| proxy_alloc_clone.allocate());
+        mock.expect_get_event_from_proxy()
+            .returning(move |_, _, _| event_alloc_clone.allocate());
+        mock.expect_subscribe_to_event().returning(|_, _| true);
+        mock.expect_get_type_ops_instance().returning(move |_, _| {
+            Some(TypeOperationsManager::new(
+                NonNull::new(type_ops_alloc.allocate())
+                    .expect("Failed to allocate TypeOperations for mock"),
+            ))
+        });
+        mock.expect_get_samples_from_event_batch()
+            .times(2)
+            .returning(|_, _, samples, max_samples| {
+                assert_eq!(max_samples, 2);
+                // SAFETY: try_receive passes storage for at least max_samples SamplePtr.
+                unsafe { write_mock_samples::<TestData>(samples, 2) };
+                2
+            });
+        let deleted_samples_clone = Arc::clone(&deleted_samples);
+        mock.expect_sample_ptr_delete().returning(move |_, _| {
+            deleted_samples_clone.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+        });
+        mock.expect_unsubscribe_to_event().returning(move |ptr| {
+            assert!(
+                event_alloc.free(ptr),
+                "unsubscribe_to_event called with unknown pointer"
+            );
+        });
+        mock.expect_destroy_proxy().returning(move |ptr| {
+            assert!(
+                proxy_alloc.free(ptr),
+                "destroy_proxy called with unknown pointer"
+            );
+        });
+
+        let bridge = SharedMockBridge::new(mock);
+        let subscribable = SubscribableImpl::<TestData, SharedMockBridge> {
+            identifier: "TestEvent",
+            instance_info: make_instance_info(bridge.clone()),
+            proxy_instance: make_proxy_instance(bridge.clone(), "TestInterface"),
+            data: PhantomData,
+        };
+        let subscriber = subscribable
+            .subscribe(2)
+            .expect("subscribe should succeed with proper mock setup");
+
+        let mut sample_container = SampleContainer::new(2);
+        for _ in 0..2 {
+            let count = subscriber
+                .try_receive(&mut sample_container, 2)
+                .expect("try_receive should succeed with a valid mock event");
+            assert_eq!(count, 2, "both samples of the batch should be received");
+        }
+        assert_eq!(sample_container.sample_count(), 2);
+        assert_eq!(
+            deleted_samples.load(std::sync::atomic::Ordering::Relaxed),
+            2,
+            "the two oldest samples should have been released to make room for the newest ones"
+        );
+
+        drop(sample_container);
+        assert_eq!(
+            deleted_samples.load(std::sync::atomic::Ordering::Relaxed),
+            4
+        );
+    }
+
     // Verify that `subscribe` returns `EventNotAvailable` when `get_type_ops_instance`
     // returns `None`. The proxy must still be destroyed to avoid a resource leak.
     #[test]
@@ -1470,4 +1748,98 @@ mod test {
 
         proxy_alloc.assert_all_freed();
     }
+
+    // Verify that a field subscription keeps the latest value, releases the previous sample once a
+    // newer value was received, and releases the latest sample before unsubscribing.
+    #[test]
+    fn test_field_current_keeps_latest_value() {
+        static FIELD_VALUE: TestData = TestData { value: 7 };
+        let proxy_alloc = MockPointerAllocator::<ProxyBase>::new();
+        let event_alloc = MockPointerAllocator::<ProxyEventBase>::new();
+        let type_ops_alloc = MockPointerAllocator::<TypeOperations>::new();
+        let deleted_samples = Arc::new(AtomicUsize::new(0));
+        let mut seq = mockall::Sequence::new();
+        let mut mock = MockFFIBridge::new();
+
+        let proxy_alloc_clone = proxy_alloc.clone();
+        let event_alloc_clone = event_alloc.clone();
+        mock.expect_create_proxy()
+            .returning(move |_, _| proxy_alloc_clone.allocate());
+        mock.expect_get_event_from_proxy()
+            .returning(move |_, _, _| event_alloc_clone.allocate());
+        mock.expect_subscribe_to_event()
+            .returning(|_, max_num_samples| max_num_samples == 2);
+        mock.expect_get_type_ops_instance().returning(move |_, _| {
+            Some(TypeOperationsManager::new(
+                NonNull::new(type_ops_alloc.allocate())
+                    .expect("Failed to allocate TypeOperations for mock"),
+            ))
+        });
+        // No value yet, then a value, then no newer value, then a newer value.
+        for count in [0, 1, 0, 1] {
+            mock.expect_get_samples_from_event_batch()
+                .times(1)
+                .in_sequence(&mut seq)
+                .returning(move |_, _, samples, max_samples| {
+                    assert_eq!(max_samples, 1);
+                    // SAFETY: current passes storage for one SamplePtr.
+                    unsafe { write_mock_samples::<TestData>(samples, count as usize) };
+                    count
+                });
+        }
+        mock.expect_sample_ptr_get()
+            .returning(|_, _| std::ptr::from_ref(&FIELD_VALUE) as *const std::ffi::c_void);
+        let deleted_samples_clone = Arc::clone(&deleted_samples);
+        mock.expect_sample_ptr_delete().returning(move |_, _| {
+            deleted_samples_clone.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+        });
+        let deleted_samples_clone = Arc::clone(&deleted_samples);
+        mock.expect_unsubscribe_to_event().returning(move |ptr| {
+            assert_eq!(
+                deleted_samples_clone.load(std::sync::atomic::Ordering::Relaxed),
+                2,
+                "the latest sample must be released before unsubscribing"
+            );
+            assert!(
+                event_alloc.free(ptr),
+                "unsubscribe_to_event called with unknown pointer"
+            );
+        });
+        mock.expect_destroy_proxy().returning(move |ptr| {
+            assert!(
+                proxy_alloc.free(ptr),
+                "destroy_proxy called with unknown pointer"
+            );
+        });
+
+        let bridge = SharedMockBridge::new(mock);
+        let subscribable = FieldSubscribableImpl::<TestData, SharedMockBridge> {
+            identifier: "TestField",
+            instance_info: make_instance_info(bridge.clone()),
+            proxy_instance: make_proxy_instance(bridge.clone(), "TestInterface"),
+            data: PhantomData,
+        };
+        let mut subscription = subscribable
+            .subscribe()
+            .expect("subscribe should succeed with proper mock setup");
+
+        assert!(subscription
+            .current()
+            .expect("current should succeed without a value")
+            .is_none());
+        for _ in 0..3 {
+            let value = subscription
+                .current()
+                .expect("current should succeed")
+                .expect("the field should have a value");
+            assert_eq!(value.value, 7);
+        }
+        assert_eq!(
+            deleted_samples.load(std::sync::atomic::Ordering::Relaxed),
+            1,
+            "only the sample replaced by the newer value should have been released"
+        );
+
+        drop(subscription);
+    }
 }
@@ -29,9 +29,12 @@ mod consumer;
 mod producer;
 mod runtime;
 
-pub use consumer::{LolaConsumerInfo, Sample, LolaConsumerDiscovery, SubscribableImpl};
+pub use consumer::{
+    FieldSubscribableImpl, FieldSubscriberImpl, LolaConsumerDiscovery, LolaConsumerInfo, Sample,
+    SubscribableImpl,
+};
 pub use producer::{
-    LolaProviderInfo, Publisher, SampleMaybeUninit, SampleMut, LolaProducerBuilder,
+    FieldPublisher, LolaProducerBuilder, LolaProviderInfo, Publisher, SampleMaybeUninit, SampleMut,
 };
 pub use runtime::{LolaRuntimeImpl, RuntimeBuilderImpl};
 
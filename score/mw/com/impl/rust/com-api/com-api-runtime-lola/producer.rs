@@ -13,6 +13,7 @@
 
 //! This file implements the producer side of the COM API for LoLa runtime.
 //! It defines the `Publisher` struct and its associated methods for allocating and sending samples.
+//! The `FieldPublisher` struct builds on it to set the value of a field.
 //! It also includes the `SampleMut` and `SampleMaybeUninit` structs for handling sample data.
 //! These components work together to enable producers to create and manage data samples
 //! within the LoLa runtime environment.
@@ -460,6 +461,66 @@ where
     }
 }
 
+/// Publisher of a field, which is backed by the event dispatching the field notifications.
+/// Zero-copy updates use the allocate and send path of the inner event publisher, while `update`
+/// hands the value to the C++ SkeletonField, which stores it as initial value before the offer.
+#[derive(Debug)]
+pub struct FieldPublisher<T, B: FFIBridge> {
+    publisher: Publisher<T, B>,
+    interface_id: &'static str,
+    identifier: String,
+}
+
+impl<T, B: FFIBridge> com_api_concept::FieldPublisher<T, LolaRuntimeImpl<B>>
+    for FieldPublisher<T, B>
+where
+    T: CommData + Debug,
+{
+    type SampleMaybeUninit<'a>
+        = SampleMaybeUninit<'a, T, B>
+    where
+        Self: 'a;
+
+    fn update(&self, value: T) -> Result<()> {
+        let skeleton_instance = &self.publisher.skeleton_instance;
+        //SAFETY: It is safe to update the field because the skeleton handle is valid as long as
+        // the publisher is valid and the data pointer points to a valid T, which is copied on the
+        // cpp side before this call returns.
+        let status = unsafe {
+            skeleton_instance.0.bridge.skeleton_field_update(
+                skeleton_instance.0.handle.as_ptr(),
+                self.interface_id,
+                &self.identifier,
+                std::ptr::from_ref(&value) as *const std::ffi::c_void,
+            )
+        };
+        if !status {
+            return Err(Error::EventError(EventFailedReason::SendingDataFailed));
+        }
+        Ok(())
+    }
+
+    fn allocate<'a>(&'a self) -> Result<Self::SampleMaybeUninit<'a>> {
+        <Publisher<T, B> as com_api_concept::Publisher<T, LolaRuntimeImpl<B>>>::allocate(
+            &self.publisher,
+        )
+    }
+
+    fn new(identifier: &str, instance_info: LolaProviderInfo<B>) -> Result<Self> {
+        let interface_id = instance_info.interface_id;
+        let publisher =
+            <Publisher<T, B> as com_api_concept::Publisher<T, LolaRuntimeImpl<B>>>::new(
+                identifier,
+                instance_info,
+            )?;
+        Ok(Self {
+            publisher,
+            interface_id,
+            identifier: identifier.to_string(),
+        })
+    }
+}
+
 pub struct LolaProducerBuilder<I: Interface, B: FFIBridge> {
     pub instance_specifier: InstanceSpecifier,
     pub _interface: PhantomData<I>,
@@ -515,6 +576,7 @@ mod test {
     use mockall::predicate::*;
     use mockall::Sequence;
     // Bring trait methods into scope without shadowing local struct names.
+    use com_api_concept::FieldPublisher as _;
     use com_api_concept::Publisher as _;
     use com_api_concept::SampleMaybeUninit as _;
     use com_api_concept::SampleMut as _;
@@ -682,4 +744,73 @@ mod test {
         let sample_mut = sample.write(test_data);
         assert!(sample_mut.send().is_ok(), "Failed to send sample");
     }
+
+    // Verify that a field update passes the field identifiers and the value to the skeleton field,
+    // and that a failed update is reported as error.
+    #[test]
+    fn test_field_publisher_update() {
+        let skeleton_alloc = MockPointerAllocator::<SkeletonBase>::new();
+        let event_alloc = MockPointerAllocator::<SkeletonEventBase>::new();
+        let type_ops_alloc = MockPointerAllocator::<TypeOperations>::new();
+        let mut seq = Sequence::new();
+        let mut mock = MockFFIBridge::new();
+
+        let skeleton_alloc_clone = skeleton_alloc.clone();
+        mock.expect_create_skeleton()
+            .in_sequence(&mut seq)
+            .returning(move |_, _| skeleton_alloc_clone.allocate());
+        mock.expect_get_event_from_skeleton()
+            .in_sequence(&mut seq)
+            .returning(move |_, _, _| event_alloc.allocate());
+        mock.expect_get_type_ops_instance()
+            .in_sequence(&mut seq)
+            .returning(move |_, _| {
+                Some(TypeOperationsManager::new(
+                    NonNull::new(type_ops_alloc.allocate())
+                        .expect("Failed to allocate TypeOperations for mock"),
+                ))
+            });
+        mock.expect_skeleton_field_update()
+            .in_sequence(&mut seq)
+            .returning(|_, interface_id, field_id, data_ptr| {
+                assert_eq!(interface_id, "TestInterface");
+                assert_eq!(field_id, "TestField");
+                // SAFETY: update passes a pointer to a valid TestData.
+                unsafe { (*(data_ptr as *const TestData)).value == 42 }
+            });
+        mock.expect_skeleton_field_update()
+            .in_sequence(&mut seq)
+            .returning(|_, _, _, _| false);
+        let skeleton_cleanup = skeleton_alloc.clone();
+        mock.expect_destroy_skeleton()
+            .in_sequence(&mut seq)
+            .returning(move |ptr| {
+                assert!(
+                    skeleton_cleanup.free(ptr),
+                    "destroy_skeleton called with unknown pointer"
+                );
+            });
+
+        let bridge = SharedMockBridge::new(mock);
+        let field_publisher = FieldPublisher::<TestData, SharedMockBridge>::new(
+            "TestField",
+            make_provider_info("TestInterface", &bridge),
+        )
+        .expect("Failed to create field publisher");
+
+        assert!(
+            field_publisher.update(TestData { value: 42 }).is_ok(),
+            "update should succeed when the skeleton field accepts the value"
+        );
+        assert!(
+            matches!(
+                field_publisher.update(TestData { value: 43 }),
+                Err(Error::EventError(EventFailedReason::SendingDataFailed))
+            ),
+            "update must return SendingDataFailed when the skeleton field rejects the value"
+        );
+
+        drop(field_publisher);
+        skeleton_alloc.assert_all_freed();
+    }
 }
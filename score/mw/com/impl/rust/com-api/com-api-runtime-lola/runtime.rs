@@ -16,8 +16,8 @@ use core::marker::PhantomData;
 use std::path::{Path, PathBuf};
 
 use crate::{
-    LolaConsumerDiscovery, LolaConsumerInfo, LolaProducerBuilder, LolaProviderInfo, Publisher,
-    SubscribableImpl,
+    FieldPublisher, FieldSubscribableImpl, LolaConsumerDiscovery, LolaConsumerInfo,
+    LolaProducerBuilder, LolaProviderInfo, Publisher, SubscribableImpl,
 };
 use com_api_concept::{
     Builder, CommData, FindServiceSpecifier, InstanceSpecifier, Interface, Result, Runtime,
@@ -35,6 +35,8 @@ impl<B: FFIBridge> Runtime for LolaRuntimeImpl<B> {
     type Subscriber<T: CommData + Debug> = SubscribableImpl<T, B>;
     type ProducerBuilder<I: Interface> = LolaProducerBuilder<I, B>;
     type Publisher<T: CommData + Debug> = Publisher<T, B>;
+    type FieldSubscriber<T: CommData + Debug> = FieldSubscribableImpl<T, B>;
+    type FieldPublisher<T: CommData + Debug> = FieldPublisher<T, B>;
     type ProviderInfo = LolaProviderInfo<B>;
     type ConsumerInfo = LolaConsumerInfo<B>;
 
@@ -36,9 +36,10 @@ use std::collections::VecDeque;
 use std::path::Path;
 
 use com_api_concept::{
-    Builder, CommData, Consumer, ConsumerBuilder, ConsumerDescriptor, FindServiceSpecifier,
-    InstanceSpecifier, Interface, Producer, ProducerBuilder, ProviderInfo, Result, Runtime,
-    SampleContainer, ServiceDiscovery, Subscriber, Subscription,
+    Builder, CommData, Consumer, ConsumerBuilder, ConsumerDescriptor, FieldSubscriber,
+    FieldSubscription, FindServiceSpecifier, InstanceSpecifier, Interface, Producer,
+    ProducerBuilder, ProviderInfo, Result, Runtime, SampleContainer, ServiceDiscovery, Subscriber,
+    Subscription,
 };
 
 pub struct MockRuntimeImpl {}
@@ -68,6 +69,8 @@ impl Runtime for MockRuntimeImpl {
     type Subscriber<T: CommData + Debug> = SubscribableImpl<T>;
     type ProducerBuilder<I: Interface> = MockProducerBuilder<I>;
     type Publisher<T: CommData + Debug> = Publisher<T>;
+    type FieldSubscriber<T: CommData + Debug> = FieldSubscribableImpl<T>;
+    type FieldPublisher<T: CommData + Debug> = FieldPublisher<T>;
     type ProviderInfo = MockProviderInfo;
     type ConsumerInfo = MockConsumerInfo;
 
@@ -390,6 +393,101 @@ where
     }
 }
 
+#[derive(Debug)]
+pub struct FieldSubscribableImpl<T> {
+    identifier: &'static str,
+    instance_info: MockConsumerInfo,
+    data: PhantomData<T>,
+}
+
+impl<T: CommData + Debug> FieldSubscriber<T, MockRuntimeImpl> for FieldSubscribableImpl<T> {
+    type Subscription = FieldSubscriberImpl<T>;
+    fn new(
+        identifier: &'static str,
+        instance_info: MockConsumerInfo,
+    ) -> com_api_concept::Result<Self> {
+        Ok(Self {
+            identifier,
+            instance_info,
+            data: PhantomData,
+        })
+    }
+    fn subscribe(self) -> com_api_concept::Result<Self::Subscription> {
+        Ok(FieldSubscriberImpl {
+            identifier: self.identifier,
+            instance_info: self.instance_info.clone(),
+            data: None,
+        })
+    }
+}
+
+#[derive(Debug)]
+pub struct FieldSubscriberImpl<T>
+where
+    T: CommData + Debug,
+{
+    identifier: &'static str,
+    instance_info: MockConsumerInfo,
+    data: Option<T>,
+}
+
+impl<T> FieldSubscriberImpl<T>
+where
+    T: CommData + Debug,
+{
+    pub fn add_data(&mut self, data: T) {
+        self.data = Some(data);
+    }
+}
+
+impl<T> FieldSubscription<T, MockRuntimeImpl> for FieldSubscriberImpl<T>
+where
+    T: CommData + Debug,
+{
+    type Subscriber = FieldSubscribableImpl<T>;
+
+    fn unsubscribe(self) -> Self::Subscriber {
+        FieldSubscribableImpl {
+            identifier: self.identifier,
+            instance_info: self.instance_info,
+            data: PhantomData,
+        }
+    }
+
+    fn current(&mut self) -> com_api_concept::Result<Option<&T>> {
+        Ok(self.data.as_ref())
+    }
+}
+
+pub struct FieldPublisher<T> {
+    _data: PhantomData<T>,
+}
+
+impl<T> com_api_concept::FieldPublisher<T, MockRuntimeImpl> for FieldPublisher<T>
+where
+    T: CommData + Debug,
+{
+    type SampleMaybeUninit<'a>
+        = SampleMaybeUninit<'a, T>
+    where
+        Self: 'a;
+
+    fn update(&self, _value: T) -> com_api_concept::Result<()> {
+        Ok(())
+    }
+
+    fn allocate(&self) -> com_api_concept::Result<SampleMaybeUninit<'_, T>> {
+        Ok(SampleMaybeUninit {
+            data: MaybeUninit::uninit(),
+            lifetime: PhantomData,
+        })
+    }
+
+    fn new(_identifier: &str, _instance_info: MockProviderInfo) -> com_api_concept::Result<Self> {
+        Ok(Self { _data: PhantomData })
+    }
+}
+
 pub struct MockConsumerDiscovery<I> {
     _interface: PhantomData<I>,
 }
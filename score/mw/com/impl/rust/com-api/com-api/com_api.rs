@@ -36,6 +36,8 @@
 //! | [`ServiceDiscovery`] | Finds available service instances; availability can change over time. |
 //! | [`Publisher<T>`] / [`Subscriber<T>`] | Typed send / receive endpoints for one event. |
 //! | [`Subscription<T>`] | Represents an active event stream. |
+//! | [`FieldPublisher<T>`] / [`FieldSubscriber<T>`] | Typed update / subscribe endpoints for one field. |
+//! | [`FieldSubscription<T>`] | Zero-copy access to the latest value of a field. |
 //! | [`Sample<T>`] | `Sample<T>` values are immutable snapshots you read from it. |
 //! | [`SampleContainer`] | Container for reading samples from the event stream. |
 //! | [`InstanceSpecifier`] | Path-like service address (e.g. `/vehicle/speed`). |
@@ -76,6 +78,14 @@
 //! let _producer = offered.unoffer()?;
 //! ```
 //!
+//! Fields need an initial value before the service is offered:
+//! ```ignore
+//! let producer = runtime.producer_builder::<VehicleInterface>(spec).build()?;
+//! producer.mileage.update(Mileage { km: 0 })?;
+//! let offered = producer.offer()?;
+//! offered.mileage.update(Mileage { km: 1 })?;
+//! ```
+//!
 //! ## Consumer (Service Client)
 //! ```ignore
 //! use com_api::*;
@@ -127,6 +137,14 @@
 //!  }
 //! 
 //! ```
+//!
+//! A field subscription borrows the latest field value directly from shared memory:
+//! ```ignore
+//! let mut mileage = consumer.mileage.subscribe()?;
+//! if let Some(value) = mileage.current()? {
+//!     println!("Mileage: {}", value.km);
+//! }
+//! ```
 //! # Further reading
 //! - `com_api_concept` crate — trait definitions and full API documentation
 //! - `doc/com_api_high_level_design_detail.md` — internal architecture and layer details
@@ -138,10 +156,11 @@ pub use com_api_runtime_mock::RuntimeBuilderImpl as MockRuntimeBuilderImpl;
 
 pub use com_api_concept::{
     interface, interface_common, interface_consumer, interface_producer, Builder, CommData,
-    Consumer, ConsumerBuilder, ConsumerDescriptor, Error, FindServiceSpecifier, InstanceSpecifier,
-    Interface, OfferedProducer, PlacementDefault, Producer, ProducerBuilder, ProviderInfo,
-    Publisher, Reloc, Result, Runtime, RuntimeBuilder, SampleContainer, SampleMaybeUninit,
-    SampleMut, ServiceDiscovery, Subscriber, Subscription,
+    Consumer, ConsumerBuilder, ConsumerDescriptor, Error, FieldPublisher, FieldSubscriber,
+    FieldSubscription, FindServiceSpecifier, InstanceSpecifier, Interface, OfferedProducer,
+    PlacementDefault, Producer, ProducerBuilder, ProviderInfo, Publisher, Reloc, Result, Runtime,
+    RuntimeBuilder, SampleContainer, SampleMaybeUninit, SampleMut, ServiceDiscovery, Subscriber,
+    Subscription,
 };
 
 #[doc(hidden)]
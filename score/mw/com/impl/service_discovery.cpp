@@ -17,6 +17,7 @@
 #include "score/mw/com/impl/find_service_handler.h"
 #include "score/mw/com/impl/handle_type.h"
 #include "score/mw/com/impl/i_binding_runtime.h"
+#include "score/mw/com/impl/startup_timeline.h"
 
 #include "score/mw/log/logging.h"
 #include "score/result/result.h"
@@ -30,6 +31,7 @@
 #include <mutex>
 #include <tuple>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace score::mw::com::impl
@@ -85,6 +87,42 @@ auto ServiceDiscovery::StopOfferService(score::mw::com::impl::InstanceIdentifier
 auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
                                         const InstanceSpecifier instance_specifier) noexcept
     -> Result<FindServiceHandle>
+{
+    return StartFindServiceForSpecifier(UserCallback{std::move(handler)}, instance_specifier);
+}
+
+auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
+                                        InstanceIdentifier instance_identifier) noexcept -> Result<FindServiceHandle>
+{
+    EnrichedInstanceIdentifier enriched_instance_identifier{std::move(instance_identifier)};
+    return StartFindService(std::move(handler), std::move(enriched_instance_identifier));
+}
+
+auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
+                                        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    return StartFindServiceForIdentifier(UserCallback{std::move(handler)}, enriched_instance_identifier);
+}
+
+auto ServiceDiscovery::StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                                   const InstanceSpecifier instance_specifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    return StartFindServiceForSpecifier(UserCallback{std::move(handler)}, instance_specifier);
+}
+
+auto ServiceDiscovery::StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType> handler,
+                                                   InstanceIdentifier instance_identifier) noexcept
+    -> Result<FindServiceHandle>
+{
+    const EnrichedInstanceIdentifier enriched_instance_identifier{std::move(instance_identifier)};
+    return StartFindServiceForIdentifier(UserCallback{std::move(handler)}, enriched_instance_identifier);
+}
+
+auto ServiceDiscovery::StartFindServiceForSpecifier(UserCallback handler,
+                                                    const InstanceSpecifier& instance_specifier) noexcept
+    -> Result<FindServiceHandle>
 {
     const auto instance_identifiers = runtime_.resolve(instance_specifier);
     const std::vector<EnrichedInstanceIdentifier> enriched_instance_identifiers(instance_identifiers.begin(),
@@ -135,16 +173,9 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
     return find_service_handle;
 }
 
-auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
-                                        InstanceIdentifier instance_identifier) noexcept -> Result<FindServiceHandle>
-{
-    EnrichedInstanceIdentifier enriched_instance_identifier{std::move(instance_identifier)};
-    return StartFindService(std::move(handler), std::move(enriched_instance_identifier));
-}
-
-auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
-                                        const EnrichedInstanceIdentifier enriched_instance_identifier) noexcept
-    -> Result<FindServiceHandle>
+auto ServiceDiscovery::StartFindServiceForIdentifier(
+    UserCallback handler,
+    const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept -> Result<FindServiceHandle>
 {
     auto find_service_handle = GetNextFreeFindServiceHandle();
 
@@ -208,10 +239,12 @@ auto ServiceDiscovery::StartFindService(FindServiceHandler<HandleType> handler,
 }
 
 auto ServiceDiscovery::StartFindServiceImpl(FindServiceHandle find_service_handle,
-                                            std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                            std::weak_ptr<UserCallback> handler_weak_ptr,
                                             const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept
     -> Result<FindServiceHandle>
 {
+    const StartupTimeline::Phase phase{"StartFindService",
+                                       enriched_instance_identifier.GetInstanceIdentifier().ToString()};
     auto result = BindingSpecificStartFindService(find_service_handle, handler_weak_ptr, enriched_instance_identifier);
     if (!result.has_value())
     {
@@ -270,11 +303,10 @@ FindServiceHandle ServiceDiscovery::GetNextFreeFindServiceHandle() noexcept
     return make_FindServiceHandle(free_uid);
 }
 
-auto ServiceDiscovery::StoreUserCallback(const FindServiceHandle& find_service_handle,
-                                         FindServiceHandler<HandleType> handler) noexcept
-    -> std::weak_ptr<FindServiceHandler<HandleType>>
+auto ServiceDiscovery::StoreUserCallback(const FindServiceHandle& find_service_handle, UserCallback handler) noexcept
+    -> std::weak_ptr<UserCallback>
 {
-    auto shared_pointer_handler_wrapper = std::make_shared<FindServiceHandler<HandleType>>(std::move(handler));
+    auto shared_pointer_handler_wrapper = std::make_shared<UserCallback>(std::move(handler));
     auto entry = user_callbacks_.emplace(std::piecewise_construct,
                                          std::forward_as_tuple(find_service_handle),
                                          std::forward_as_tuple(std::move(shared_pointer_handler_wrapper)));
@@ -309,17 +341,38 @@ auto ServiceDiscovery::GetServiceDiscoveryClient(const InstanceIdentifier& insta
 
 auto ServiceDiscovery::BindingSpecificStartFindService(
     FindServiceHandle search_handle,
-    std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+    std::weak_ptr<UserCallback> handler_weak_ptr,
     const EnrichedInstanceIdentifier& enriched_instance_identifier) noexcept -> Result<void>
 {
     auto& service_discovery_client = GetServiceDiscoveryClient(enriched_instance_identifier.GetInstanceIdentifier());
 
+    // The user callback might already be gone, if StopFindService was called from within the handler while starting
+    // the search on a previous binding. In this case the handler is never called, so the variant doesn't matter.
+    const bool is_incremental_handler = [&handler_weak_ptr]() noexcept {
+        const auto handler_shared_ptr = handler_weak_ptr.lock();
+        return (handler_shared_ptr != nullptr) &&
+               std::holds_alternative<FindServiceIncrementalHandler<HandleType>>(*handler_shared_ptr);
+    }();
+    if (is_incremental_handler)
+    {
+        return service_discovery_client.StartFindServiceIncremental(
+            search_handle,
+            [handler_weak_ptr](auto changes, auto handle) noexcept {
+                if (auto incremental_handler_shared_ptr = handler_weak_ptr.lock())
+                {
+                    std::get<FindServiceIncrementalHandler<HandleType>>(*incremental_handler_shared_ptr)(changes,
+                                                                                                         handle);
+                }
+            },
+            enriched_instance_identifier);
+    }
+
     return service_discovery_client.StartFindService(
         search_handle,
         [handler_weak_ptr](auto container, auto handle) noexcept {
-            if (auto handler_shared_ptr = handler_weak_ptr.lock())
+            if (auto full_handler_shared_ptr = handler_weak_ptr.lock())
             {
-                (*handler_shared_ptr)(container, handle);
+                std::get<FindServiceHandler<HandleType>>(*full_handler_shared_ptr)(container, handle);
             }
         },
         enriched_instance_identifier);
@@ -328,7 +381,9 @@ auto ServiceDiscovery::BindingSpecificStartFindService(
 Result<ServiceHandleContainer<HandleType>> ServiceDiscovery::FindService(
     InstanceIdentifier instance_identifier) noexcept
 {
-    EnrichedInstanceIdentifier enriched_instance_identifier{std::move(instance_identifier)};
+    // instance_identifier is kept alive, since the startup timeline phase refers to its string representation.
+    const StartupTimeline::Phase phase{"FindService", instance_identifier.ToString()};
+    EnrichedInstanceIdentifier enriched_instance_identifier{instance_identifier};
     auto& service_discovery_client = GetServiceDiscoveryClient(enriched_instance_identifier.GetInstanceIdentifier());
     const auto find_service_result = service_discovery_client.FindService(std::move(enriched_instance_identifier));
     if (!(find_service_result.has_value()))
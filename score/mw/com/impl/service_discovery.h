@@ -29,6 +29,7 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
 namespace score::mw::com::impl
@@ -52,6 +53,10 @@ class ServiceDiscovery final : public IServiceDiscovery
     Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>, InstanceIdentifier) noexcept override;
     Result<FindServiceHandle> StartFindService(FindServiceHandler<HandleType>,
                                                const EnrichedInstanceIdentifier) noexcept override;
+    Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType>,
+                                                          const InstanceSpecifier) noexcept override;
+    Result<FindServiceHandle> StartFindServiceIncremental(FindServiceIncrementalHandler<HandleType>,
+                                                          InstanceIdentifier) noexcept override;
     [[nodiscard]] Result<void> StopFindService(const FindServiceHandle) noexcept override;
     [[nodiscard]] Result<ServiceHandleContainer<HandleType>> FindService(
         InstanceIdentifier instance_identifier) noexcept override;
@@ -59,13 +64,22 @@ class ServiceDiscovery final : public IServiceDiscovery
         InstanceSpecifier instance_specifier) noexcept override;
 
   private:
+    /// \brief Either a handler getting all matching handles or a handler getting only the changes on each call.
+    using UserCallback = std::variant<FindServiceHandler<HandleType>, FindServiceIncrementalHandler<HandleType>>;
+
+    /// \brief Common implementation of the StartFindService overloads taking an InstanceSpecifier.
+    Result<FindServiceHandle> StartFindServiceForSpecifier(UserCallback, const InstanceSpecifier&) noexcept;
+
+    /// \brief Common implementation of the StartFindService overloads taking an EnrichedInstanceIdentifier.
+    Result<FindServiceHandle> StartFindServiceForIdentifier(UserCallback, const EnrichedInstanceIdentifier&) noexcept;
+
     /// \brief Dispatches to BindingSpecificStartFindService and processes a binding error if returned
     ///
     /// This functionality within this function itself is threadsafe. HOWEVER, the thread safety of the binding specific
     /// StartFindService call depends on the binding itself. For a Lola binding, this function is completely thread
     /// safe.
     Result<FindServiceHandle> StartFindServiceImpl(FindServiceHandle,
-                                                   std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                                   std::weak_ptr<UserCallback> handler_weak_ptr,
                                                    const EnrichedInstanceIdentifier&) noexcept;
 
     /// \brief Generates the next available FindServiceHandle
@@ -76,8 +90,7 @@ class ServiceDiscovery final : public IServiceDiscovery
     /// \brief Store the user callback provided to StartFindService
     ///
     /// This function is NOT threadsafe and should be called with container_mutex_ locked.
-    std::weak_ptr<FindServiceHandler<HandleType>> StoreUserCallback(const FindServiceHandle&,
-                                                                    FindServiceHandler<HandleType>) noexcept;
+    std::weak_ptr<UserCallback> StoreUserCallback(const FindServiceHandle&, UserCallback) noexcept;
 
     /// \brief Store the InstanceIdentifier corresponding to a FindServiceHandle to represent an ongoing search (with
     /// StartFindService).
@@ -87,13 +100,14 @@ class ServiceDiscovery final : public IServiceDiscovery
 
     IServiceDiscoveryClient& GetServiceDiscoveryClient(const InstanceIdentifier&) noexcept;
 
-    /// \brief Call the binding specific StartFindService
+    /// \brief Call the binding specific StartFindService or StartFindServiceIncremental depending on the type of the
+    /// user callback
     ///
     /// This functionality within this function itself is threadsafe. HOWEVER, the thread safety of the binding specific
     /// StartFindService call depends on the binding itself. For a Lola binding, this function is completely thread
     /// safe.
     Result<void> BindingSpecificStartFindService(FindServiceHandle,
-                                                 std::weak_ptr<FindServiceHandler<HandleType>> handler_weak_ptr,
+                                                 std::weak_ptr<UserCallback> handler_weak_ptr,
                                                  const EnrichedInstanceIdentifier&) noexcept;
 
     /// \brief Removes any InstanceIdentifiers which were added to handle_to_instances_ but were never processed since
@@ -120,7 +134,7 @@ class ServiceDiscovery final : public IServiceDiscovery
     /// The handlers are stored as shared_ptrs. When a handler needs to be called by the bindings, a weak_ptr to the
     /// handler is passed. This ensures that the handler will not be destroyed as long as the handler is being held by
     /// the binding (which only happens for the duration of the call to the binding).
-    std::unordered_map<FindServiceHandle, std::shared_ptr<FindServiceHandler<HandleType>>> user_callbacks_;
+    std::unordered_map<FindServiceHandle, std::shared_ptr<UserCallback>> user_callbacks_;
     std::unordered_multimap<FindServiceHandle, EnrichedInstanceIdentifier> handle_to_instances_;
 };
 
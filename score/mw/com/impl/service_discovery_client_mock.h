@@ -32,6 +32,10 @@ class ServiceDiscoveryClientMock : public IServiceDiscoveryClient
                 StartFindService,
                 (FindServiceHandle, (FindServiceHandler<HandleType>), EnrichedInstanceIdentifier),
                 (noexcept, override));
+    MOCK_METHOD(Result<void>,
+                StartFindServiceIncremental,
+                (FindServiceHandle, (FindServiceIncrementalHandler<HandleType>), EnrichedInstanceIdentifier),
+                (noexcept, override));
     MOCK_METHOD(Result<void>, StopFindService, (FindServiceHandle), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>,
                 FindService,
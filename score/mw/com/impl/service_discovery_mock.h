@@ -49,6 +49,14 @@ class ServiceDiscoveryMock : public IServiceDiscovery
                 StartFindService,
                 (FindServiceHandler<HandleType>, EnrichedInstanceIdentifier),
                 (noexcept, override));
+    MOCK_METHOD(Result<FindServiceHandle>,
+                StartFindServiceIncremental,
+                (FindServiceIncrementalHandler<HandleType>, InstanceSpecifier),
+                (noexcept, override));
+    MOCK_METHOD(Result<FindServiceHandle>,
+                StartFindServiceIncremental,
+                (FindServiceIncrementalHandler<HandleType>, InstanceIdentifier),
+                (noexcept, override));
     MOCK_METHOD(Result<void>, StopFindService, (FindServiceHandle), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>, FindService, (InstanceIdentifier), (noexcept, override));
     MOCK_METHOD(Result<ServiceHandleContainer<HandleType>>, FindService, (InstanceSpecifier), (noexcept, override));
@@ -89,6 +89,8 @@ class ServiceDiscoveryTest : public Test
         ON_CALL(lola_runtime_, GetServiceDiscoveryClient()).WillByDefault(ReturnRef(service_discovery_client_));
 
         ON_CALL(service_discovery_client_, StartFindService(_, _, _)).WillByDefault(Return(Result<void>{}));
+        ON_CALL(service_discovery_client_, StartFindServiceIncremental(_, _, _))
+            .WillByDefault(Return(Result<void>{}));
 
         ON_CALL(service_discovery_client_, StopFindService(_)).WillByDefault(Return(Result<void>{}));
     }
@@ -677,6 +679,74 @@ TEST_F(ServiceDiscoveryStartFindServiceInstanceIdentifierFixture,
     EXPECT_EQ(future_status, std::future_status::timeout);
 }
 
+using ServiceDiscoveryStartFindServiceIncrementalFixture = ServiceDiscoveryTest;
+TEST_F(ServiceDiscoveryStartFindServiceIncrementalFixture,
+       StartFindServiceIncrementalCallsBindingSpecificStartFindServiceIncrementalForEveryInstance)
+{
+    // Given a ServiceDiscovery with a service containing 2 instances
+    WithAServiceContainingTwoInstances();
+
+    // Expecting that only the incremental binding specific StartFindService is called for both instances
+    EXPECT_CALL(service_discovery_client_, StartFindService(_, _, _)).Times(0);
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceIncremental(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()));
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceIncremental(_, _, config_stores_[1].GetEnrichedInstanceIdentifier()));
+
+    // When calling StartFindServiceIncremental with an InstanceSpecifier
+    const auto handle = unit_->StartFindServiceIncremental([](auto, auto) noexcept {}, instance_specifier_);
+
+    // Then a handle is returned
+    EXPECT_TRUE(handle.has_value());
+}
+
+TEST_F(ServiceDiscoveryStartFindServiceIncrementalFixture, StartFindServiceIncrementalForwardsChangesToHandler)
+{
+    // Given a ServiceDiscovery with a service containing 1 instance
+    WithAServiceContainingOneInstances();
+
+    // and a binding, which reports the instance as added
+    const std::vector<HandleType> added_handles{config_stores_[0].GetHandle()};
+    ON_CALL(service_discovery_client_,
+            StartFindServiceIncremental(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()))
+        .WillByDefault([&added_handles](auto handle, auto handler, auto) {
+            const score::cpp::span<const HandleType> added{added_handles.data(), added_handles.size()};
+            handler(ServiceHandleChanges<HandleType>{added, {}}, handle);
+            return Result<void>{};
+        });
+
+    // When calling StartFindServiceIncremental with an InstanceIdentifier
+    std::vector<HandleType> reported_added_handles{};
+    std::size_t reported_removed_handles_count{1U};
+    score::cpp::ignore = unit_->StartFindServiceIncremental(
+        [&reported_added_handles, &reported_removed_handles_count](auto changes, auto) noexcept {
+            reported_added_handles.assign(changes.added.begin(), changes.added.end());
+            reported_removed_handles_count = changes.removed.size();
+        },
+        config_stores_[0].GetInstanceIdentifier());
+
+    // Then the handler gets the changes reported by the binding
+    EXPECT_EQ(reported_added_handles, added_handles);
+    EXPECT_EQ(reported_removed_handles_count, 0U);
+}
+
+TEST_F(ServiceDiscoveryStartFindServiceIncrementalFixture, StartFindServiceIncrementalReturnsWorkingHandle)
+{
+    WithAServiceContainingOneInstances();
+
+    FindServiceHandle handle_1{make_FindServiceHandle(0)};
+    EXPECT_CALL(service_discovery_client_,
+                StartFindServiceIncremental(_, _, config_stores_[0].GetEnrichedInstanceIdentifier()))
+        .WillOnce(DoAll(SaveArg<0>(&handle_1), Return(Result<void>{})));
+    EXPECT_CALL(service_discovery_client_, StopFindService(Eq(ByRef(handle_1))));
+
+    auto start_result =
+        unit_->StartFindServiceIncremental([](auto, auto) noexcept {}, config_stores_[0].GetInstanceIdentifier());
+    ASSERT_TRUE(start_result.has_value());
+    auto stop_result = unit_->StopFindService(start_result.value());
+    EXPECT_TRUE(stop_result.has_value());
+}
+
 using ServiceDiscoveryStopFindServiceFixture = ServiceDiscoveryTest;
 TEST_F(ServiceDiscoveryStopFindServiceFixture, StopFindServiceInvokedIfForgottenByUser)
 {
@@ -19,6 +19,7 @@
 #include "score/mw/com/impl/skeleton_binding.h"
 #include "score/mw/com/impl/skeleton_event_base.h"
 #include "score/mw/com/impl/skeleton_field_base.h"
+#include "score/mw/com/impl/startup_timeline.h"
 #include "score/mw/com/impl/tracing/skeleton_tracing.h"
 
 #include "score/mw/log/logging.h"
@@ -146,6 +147,7 @@ auto SkeletonBase::OfferService() noexcept -> Result<void>
         return skeleton_mock_->OfferService();
     }
 
+    const StartupTimeline::Phase offer_service_phase{"OfferService", instance_id_.ToString()};
     auto event_bindings = GetSkeletonEventBindingsMap(events_);
     auto field_bindings = GetSkeletonFieldBindingsMap(fields_);
 
@@ -159,7 +161,10 @@ auto SkeletonBase::OfferService() noexcept -> Result<void>
         return MakeUnexpected(ComErrc::kBindingFailure, msg);
     }
 
-    const auto result = binding_->PrepareOffer(event_bindings, field_bindings, std::move(register_shm_object_callback));
+    const auto result = [this, &event_bindings, &field_bindings, &register_shm_object_callback]() {
+        const StartupTimeline::Phase prepare_offer_phase{"PrepareOffer", instance_id_.ToString()};
+        return binding_->PrepareOffer(event_bindings, field_bindings, std::move(register_shm_object_callback));
+    }();
     if (!result.has_value())
     {
         score::mw::log::LogError("lola") << "SkeletonBinding::OfferService failed: " << result.error().Message() << ": "
@@ -181,7 +186,10 @@ auto SkeletonBase::OfferService() noexcept -> Result<void>
 
     service_offered_flag_.Set();
 
-    const auto service_discovery_offer_result = Runtime::getInstance().GetServiceDiscovery().OfferService(instance_id_);
+    const auto service_discovery_offer_result = [this]() {
+        const StartupTimeline::Phase service_discovery_phase{"ServiceDiscoveryOfferService", instance_id_.ToString()};
+        return Runtime::getInstance().GetServiceDiscovery().OfferService(instance_id_);
+    }();
     if (!service_discovery_offer_result.has_value())
     {
         score::mw::log::LogError("lola")
@@ -0,0 +1,167 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/startup_timeline.h"
+
+#include "score/mw/com/impl/com_error.h"
+
+#include "score/os/unistd.h"
+
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace score::mw::com::impl
+{
+
+namespace
+{
+
+std::int64_t ToMicroseconds(const StartupTimeline::Clock::duration duration) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+void WriteEscaped(std::ostream& stream, const std::string_view value)
+{
+    for (const char character : value)
+    {
+        if ((character == '"') || (character == '\\'))
+        {
+            stream << '\\' << character;
+        }
+        else if (static_cast<unsigned char>(character) < 0x20U)
+        {
+            constexpr std::string_view kHexDigits{"0123456789abcdef"};
+            const auto code = static_cast<std::size_t>(static_cast<unsigned char>(character));
+            stream << "\\u00" << kHexDigits.at(code / 16U) << kHexDigits.at(code % 16U);
+        }
+        else
+        {
+            stream << character;
+        }
+    }
+}
+
+}  // namespace
+
+StartupTimeline::Phase::Phase(const std::string_view name, const std::string_view instance) noexcept
+    : name_{name}, instance_{instance}, begin_{}
+{
+    if (StartupTimeline::GetInstance().IsEnabled())
+    {
+        begin_ = Clock::now();
+    }
+}
+
+StartupTimeline::Phase::~Phase() noexcept
+{
+    if (begin_.has_value())
+    {
+        StartupTimeline::GetInstance().Record(name_, instance_, begin_.value(), Clock::now());
+    }
+}
+
+StartupTimeline& StartupTimeline::GetInstance() noexcept
+{
+    // Suppress "AUTOSAR C++14 A3-3-2" rule finding: "Static and thread-local objects shall be constant-initialized.".
+    // The instance is intentionally created on first use, since configuration parsing is already recorded before the
+    // mw::com runtime exists.
+    // coverity[autosar_cpp14_a3_3_2_violation]
+    static StartupTimeline instance{};
+    return instance;
+}
+
+void StartupTimeline::Enable(std::string output_path) noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    output_path_ = std::move(output_path);
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void StartupTimeline::Record(const std::string_view name,
+                             const std::string_view instance,
+                             const Clock::time_point begin,
+                             const Clock::time_point end) noexcept
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+    const auto thread_id = static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    std::lock_guard<std::mutex> lock{mutex_};
+    entries_.push_back(Entry{std::string{name}, std::string{instance}, begin, end, thread_id});
+}
+
+std::vector<StartupTimeline::Entry> StartupTimeline::GetEntries() const noexcept
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return entries_;
+}
+
+std::string StartupTimeline::ToChromeTrace() const noexcept
+{
+    const auto entries = GetEntries();
+    const auto pid = os::Unistd::instance().getpid();
+
+    std::ostringstream stream{};
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (std::size_t index = 0U; index < entries.size(); ++index)
+    {
+        const auto& entry = entries.at(index);
+        if (index != 0U)
+        {
+            stream << ',';
+        }
+        stream << "{\"name\":\"";
+        WriteEscaped(stream, entry.name);
+        stream << "\",\"cat\":\"mw_com\",\"ph\":\"X\",\"ts\":" << ToMicroseconds(entry.begin.time_since_epoch())
+               << ",\"dur\":" << ToMicroseconds(entry.end - entry.begin) << ",\"pid\":" << pid
+               << ",\"tid\":" << entry.thread_id;
+        if (!entry.instance.empty())
+        {
+            stream << ",\"args\":{\"instance\":\"";
+            WriteEscaped(stream, entry.instance);
+            stream << "\"}";
+        }
+        stream << '}';
+    }
+    stream << "]}";
+    return stream.str();
+}
+
+Result<void> StartupTimeline::WriteChromeTrace() const noexcept
+{
+    std::string output_path{};
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        output_path = output_path_;
+    }
+    if (!IsEnabled() || output_path.empty())
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle, "Startup timeline recording is not enabled.");
+    }
+
+    std::ofstream file{output_path, std::ios::out | std::ios::trunc};
+    file << ToChromeTrace();
+    file.close();
+    if (!file)
+    {
+        return MakeUnexpected(ComErrc::kErroneousFileHandle, "Could not write startup timeline.");
+    }
+    return {};
+}
+
+}  // namespace score::mw::com::impl
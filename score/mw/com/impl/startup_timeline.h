@@ -0,0 +1,115 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_STARTUP_TIMELINE_H
+#define SCORE_MW_COM_IMPL_STARTUP_TIMELINE_H
+
+#include "score/result/result.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace score::mw::com::impl
+{
+
+/// \brief Opt-in recorder of the duration of the startup phases of mw::com (configuration parsing, binding runtime
+///        creation, shared memory creation, service discovery, ...) per service instance.
+///
+/// \details Recording is disabled by default and then costs a single relaxed atomic load per phase. Once enabled, each
+/// finished phase is stored with its monotonic begin and end time and the recording thread. Sub-phases are recorded
+/// independently and nest within their parent phase by time, which is how trace viewers display them. The recorded
+/// phases can be written as Chrome trace event JSON, which can be loaded into chrome://tracing or Perfetto.
+class StartupTimeline final
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        std::string name;
+        /// \brief Service instance the phase belongs to. Empty for process wide phases.
+        std::string instance;
+        Clock::time_point begin;
+        Clock::time_point end;
+        std::uint64_t thread_id;
+    };
+
+    /// \brief RAII helper, which records a phase from its construction until its destruction.
+    /// \details name and instance are not copied, so they have to outlive the Phase.
+    class Phase final
+    {
+      public:
+        explicit Phase(const std::string_view name, const std::string_view instance = {}) noexcept;
+        ~Phase() noexcept;
+
+        Phase(const Phase&) = delete;
+        Phase(Phase&&) = delete;
+        Phase& operator=(const Phase&) = delete;
+        Phase& operator=(Phase&&) = delete;
+
+      private:
+        std::string_view name_;
+        std::string_view instance_;
+        std::optional<Clock::time_point> begin_;
+    };
+
+    /// \brief Returns the process wide instance, which is used by all instrumented startup phases.
+    static StartupTimeline& GetInstance() noexcept;
+
+    StartupTimeline() noexcept = default;
+    ~StartupTimeline() noexcept = default;
+
+    StartupTimeline(const StartupTimeline&) = delete;
+    StartupTimeline(StartupTimeline&&) = delete;
+    StartupTimeline& operator=(const StartupTimeline&) = delete;
+    StartupTimeline& operator=(StartupTimeline&&) = delete;
+
+    /// \brief Enables recording. The recorded phases are written to output_path by WriteChromeTrace().
+    void Enable(std::string output_path) noexcept;
+
+    bool IsEnabled() const noexcept
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Stores a finished phase, if recording is enabled.
+    void Record(const std::string_view name,
+                const std::string_view instance,
+                const Clock::time_point begin,
+                const Clock::time_point end) noexcept;
+
+    /// \brief Returns a copy of all phases recorded so far in the order in which they finished.
+    std::vector<Entry> GetEntries() const noexcept;
+
+    /// \brief Returns the recorded phases as Chrome trace event JSON with complete ("X") events in microseconds.
+    std::string ToChromeTrace() const noexcept;
+
+    /// \brief Writes the recorded phases as Chrome trace event JSON to the output path given to Enable().
+    /// \return kErroneousFileHandle, if recording is not enabled or the file could not be written.
+    Result<void> WriteChromeTrace() const noexcept;
+
+  private:
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_{};
+    std::string output_path_{};
+    std::vector<Entry> entries_{};
+};
+
+}  // namespace score::mw::com::impl
+
+#endif  // SCORE_MW_COM_IMPL_STARTUP_TIMELINE_H
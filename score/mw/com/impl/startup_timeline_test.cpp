@@ -0,0 +1,175 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/startup_timeline.h"
+
+#include "score/mw/com/impl/com_error.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+namespace score::mw::com::impl
+{
+namespace
+{
+
+using Clock = StartupTimeline::Clock;
+
+constexpr auto kOutputPath = "startup_timeline_test.json";
+
+TEST(StartupTimelineTest, DoesNotRecordWhenNotEnabled)
+{
+    // Given a StartupTimeline, which is not enabled
+    StartupTimeline unit{};
+
+    // When recording a phase
+    const auto now = Clock::now();
+    unit.Record("ParseConfiguration", "", now, now + std::chrono::milliseconds{1});
+
+    // Then nothing is recorded
+    EXPECT_FALSE(unit.IsEnabled());
+    EXPECT_TRUE(unit.GetEntries().empty());
+}
+
+TEST(StartupTimelineTest, RecordsPhasesInOrderOfCompletion)
+{
+    // Given an enabled StartupTimeline
+    StartupTimeline unit{};
+    unit.Enable(kOutputPath);
+
+    // When recording a phase of a service instance and a process wide phase
+    const auto begin = Clock::now();
+    const auto end = begin + std::chrono::milliseconds{2};
+    unit.Record("OfferService", "instance_1", begin, end);
+    unit.Record("CreateBindingRuntimes", "", begin, end);
+
+    // Then both phases are recorded in this order
+    const auto entries = unit.GetEntries();
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries.at(0).name, "OfferService");
+    EXPECT_EQ(entries.at(0).instance, "instance_1");
+    EXPECT_EQ(entries.at(0).begin, begin);
+    EXPECT_EQ(entries.at(0).end, end);
+    EXPECT_EQ(entries.at(1).name, "CreateBindingRuntimes");
+    EXPECT_TRUE(entries.at(1).instance.empty());
+}
+
+TEST(StartupTimelineTest, ChromeTraceContainsCompleteEventsInMicroseconds)
+{
+    // Given an enabled StartupTimeline with a recorded phase of a service instance
+    StartupTimeline unit{};
+    unit.Enable(kOutputPath);
+    const Clock::time_point begin{std::chrono::microseconds{1000}};
+    unit.Record("PrepareOffer", "instance_1", begin, begin + std::chrono::microseconds{250});
+
+    // When converting it to a Chrome trace
+    const auto trace = unit.ToChromeTrace();
+
+    // Then it contains a complete event with begin and duration in microseconds and the instance as argument
+    EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[{\"name\":\"PrepareOffer\""), 0U);
+    EXPECT_NE(trace.find("\"ph\":\"X\",\"ts\":1000,\"dur\":250,"), std::string::npos);
+    EXPECT_NE(trace.find("\"args\":{\"instance\":\"instance_1\"}"), std::string::npos);
+    EXPECT_EQ(trace.substr(trace.size() - 3U), "}]}");
+}
+
+TEST(StartupTimelineTest, ChromeTraceEscapesStrings)
+{
+    // Given an enabled StartupTimeline with a phase, whose instance contains characters to be escaped
+    StartupTimeline unit{};
+    unit.Enable(kOutputPath);
+    const auto now = Clock::now();
+    unit.Record("Phase", "a\"b\\c\n", now, now);
+
+    // When converting it to a Chrome trace
+    const auto trace = unit.ToChromeTrace();
+
+    // Then the characters are escaped
+    EXPECT_NE(trace.find("\"instance\":\"a\\\"b\\\\c\\u000a\""), std::string::npos);
+}
+
+TEST(StartupTimelineTest, WritesChromeTraceToOutputPath)
+{
+    // Given an enabled StartupTimeline with a recorded phase
+    StartupTimeline unit{};
+    unit.Enable(kOutputPath);
+    const auto now = Clock::now();
+    unit.Record("FindService", "instance_1", now, now);
+
+    // When writing the Chrome trace
+    const auto result = unit.WriteChromeTrace();
+
+    // Then the file contains the Chrome trace
+    ASSERT_TRUE(result.has_value());
+    std::ifstream file{kOutputPath};
+    const std::string content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    EXPECT_EQ(content, unit.ToChromeTrace());
+}
+
+TEST(StartupTimelineTest, WritingChromeTraceWhenNotEnabledReturnsError)
+{
+    // Given a StartupTimeline, which is not enabled
+    StartupTimeline unit{};
+
+    // When writing the Chrome trace
+    const auto result = unit.WriteChromeTrace();
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST(StartupTimelineTest, WritingChromeTraceToInvalidPathReturnsError)
+{
+    // Given a StartupTimeline, which is enabled with an output path in a non existing directory
+    StartupTimeline unit{};
+    unit.Enable("/non_existing_directory/startup_timeline.json");
+
+    // When writing the Chrome trace
+    const auto result = unit.WriteChromeTrace();
+
+    // Then an error is returned
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), ComErrc::kErroneousFileHandle);
+}
+
+TEST(StartupTimelinePhaseTest, PhaseRecordsItsLifetimeInProcessWideInstance)
+{
+    // Given the enabled process wide StartupTimeline
+    auto& unit = StartupTimeline::GetInstance();
+    unit.Enable(kOutputPath);
+
+    // When a phase lives for some time
+    const auto before_phase = Clock::now();
+    {
+        StartupTimeline::Phase phase{"PhaseUnderTest", "instance_2"};
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+    }
+
+    // Then it is recorded with its lifetime
+    const auto entries = unit.GetEntries();
+    const auto entry = std::find_if(entries.cbegin(), entries.cend(), [](const StartupTimeline::Entry& candidate) {
+        return candidate.name == "PhaseUnderTest";
+    });
+    ASSERT_NE(entry, entries.cend());
+    EXPECT_EQ(entry->instance, "instance_2");
+    EXPECT_GE(entry->begin, before_phase);
+    EXPECT_GE(entry->end - entry->begin, std::chrono::milliseconds{5});
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl
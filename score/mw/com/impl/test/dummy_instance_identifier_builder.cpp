@@ -87,6 +87,31 @@ InstanceIdentifier DummyInstanceIdentifierBuilder::CreateValidLolaInstanceIdenti
     return make_InstanceIdentifier(*instance_deployment_, type_deployment_);
 }
 
+InstanceIdentifier DummyInstanceIdentifierBuilder::CreateValidLolaInstanceIdentifierWithMethod()
+{
+    return CreateValidLolaInstanceIdentifierWithMethod({{"test_method", LolaMethodInstanceDeployment{1U, true}}});
+}
+
+InstanceIdentifier DummyInstanceIdentifierBuilder::CreateValidLolaInstanceIdentifierWithMethod(
+    const LolaServiceInstanceDeployment::MethodInstanceMapping& methods)
+{
+    service_instance_deployment_.instance_id_ = LolaServiceInstanceId{0x42};
+    service_instance_deployment_.allowed_consumer_ = {{QualityType::kASIL_QM, {42}}};
+    service_instance_deployment_.methods_ = methods;
+
+    // Like the event names, the method names have to be present in the Type Deployment for the stable string lookup.
+    service_type_deployment_.methods_.clear();
+    for (const auto& method_pair : methods)
+    {
+        service_type_deployment_.methods_[method_pair.first] = {};
+    }
+
+    type_deployment_.binding_info_ = service_type_deployment_;
+    instance_deployment_ = std::make_unique<ServiceInstanceDeployment>(
+        type_, service_instance_deployment_, QualityType::kASIL_QM, instance_specifier_);
+    return make_InstanceIdentifier(*instance_deployment_, type_deployment_);
+}
+
 InstanceIdentifier DummyInstanceIdentifierBuilder::CreateLolaInstanceIdentifierWithoutInstanceId()
 {
     type_deployment_.binding_info_ = service_type_deployment_;
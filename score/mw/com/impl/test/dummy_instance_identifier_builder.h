@@ -38,6 +38,9 @@ class DummyInstanceIdentifierBuilder
     InstanceIdentifier CreateValidLolaInstanceIdentifierWithField();
     InstanceIdentifier CreateValidLolaInstanceIdentifierWithField(
         const LolaServiceInstanceDeployment::FieldInstanceMapping& fields);
+    InstanceIdentifier CreateValidLolaInstanceIdentifierWithMethod();
+    InstanceIdentifier CreateValidLolaInstanceIdentifierWithMethod(
+        const LolaServiceInstanceDeployment::MethodInstanceMapping& methods);
     InstanceIdentifier CreateLolaInstanceIdentifierWithoutInstanceId();
     InstanceIdentifier CreateLolaInstanceIdentifierWithoutTypeDeployment();
     InstanceIdentifier CreateBlankBindingInstanceIdentifier();
@@ -18,6 +18,7 @@
 #include "score/mw/com/impl/tracing/configuration/proxy_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/skeleton_event_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/skeleton_field_trace_point_type.h"
+#include "score/mw/com/impl/tracing/configuration/trace_point_sampling_policy.h"
 
 #include <string_view>
 
@@ -73,6 +74,26 @@ class ITracingFilterConfig
                                InstanceSpecifierView instance_specifier,
                                ProxyFieldTracePointType proxy_field_trace_point_type) noexcept = 0;
 
+    /// \brief Returns the sampling policy configured for the given trace point. Trace points without a configured
+    ///        sampling policy are traced on every call, i.e. a default constructed TracePointSamplingPolicy is
+    ///        returned.
+    virtual TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view event_name,
+        SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept = 0;
+    virtual TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view field_name,
+        SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept = 0;
+    virtual TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view event_name,
+        ProxyEventTracePointType proxy_event_trace_point_type) const noexcept = 0;
+    virtual TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view field_name,
+        ProxyFieldTracePointType proxy_field_trace_point_type) const noexcept = 0;
+
     virtual std::uint16_t GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept = 0;
 };
 
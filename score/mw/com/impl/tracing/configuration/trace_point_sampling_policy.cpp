@@ -0,0 +1,28 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/configuration/trace_point_sampling_policy.h"
+
+namespace score::mw::com::impl::tracing
+{
+
+bool operator==(const TracePointSamplingPolicy& lhs, const TracePointSamplingPolicy& rhs) noexcept
+{
+    return ((lhs.one_in_n == rhs.one_in_n) && (lhs.max_per_second == rhs.max_per_second));
+}
+
+bool IsUnlimited(const TracePointSamplingPolicy& policy) noexcept
+{
+    return ((policy.one_in_n <= 1U) && (policy.max_per_second == 0U));
+}
+
+}  // namespace score::mw::com::impl::tracing
@@ -0,0 +1,44 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_SAMPLING_POLICY_H
+#define SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_SAMPLING_POLICY_H
+
+#include <cstdint>
+
+namespace score::mw::com::impl::tracing
+{
+
+/// \brief Sampling policy of an enabled trace point as configured in the trace filter config.
+/// \details Both limits are applied together: from all calls of the trace point only every one_in_n-th call is a
+///          candidate for tracing and from those candidates at most max_per_second are traced within one second.
+///          The default constructed policy traces every call.
+struct TracePointSamplingPolicy
+{
+    /// \brief 1 means, that every call is traced.
+    // Suppress "AUTOSAR C++14 M11-0-1" rule findings. This rule states: "Member data in non-POD class types shall
+    // be private.". This is a POD type.
+    // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
+    std::uint32_t one_in_n{1U};
+    /// \brief 0 means, that the number of traced calls per second is unlimited.
+    // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
+    std::uint32_t max_per_second{0U};
+};
+
+bool operator==(const TracePointSamplingPolicy& lhs, const TracePointSamplingPolicy& rhs) noexcept;
+
+/// \brief Whether the policy lets every call of the trace point through.
+bool IsUnlimited(const TracePointSamplingPolicy& policy) noexcept;
+
+}  // namespace score::mw::com::impl::tracing
+
+#endif  // SCORE_MW_COM_IMPL_TRACING_CONFIGURATION_TRACE_POINT_SAMPLING_POLICY_H
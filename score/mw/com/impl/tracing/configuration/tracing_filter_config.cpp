@@ -118,6 +118,51 @@ bool IsTracePointEnabledInMap(
     return instance_specifier_in_vector;
 }
 
+template <typename TracePointType>
+void SetSamplingPolicyInMap(std::string_view service_type,
+                            std::string_view service_element_name,
+                            ServiceElementType service_element_type,
+                            TracePointType trace_point_type,
+                            TracePointSamplingPolicy sampling_policy,
+                            std::unordered_map<TracePointKey, TracePointSamplingPolicy>& sampling_policy_map,
+                            std::set<std::string, std::less<>>& config_names) noexcept
+{
+    auto service_type_stored = GetOrInsertStringInSet(service_type, config_names);
+    auto service_element_name_stored = GetOrInsertStringInSet(service_element_name, config_names);
+    const ServiceElementIdentifierView service_element_identifer{
+        service_type_stored, service_element_name_stored, service_element_type};
+    const TracePointKey trace_point_key{service_element_identifer, static_cast<std::uint8_t>(trace_point_type)};
+
+    // A policy which lets every call pass is the default. So we don't store it to keep lookups for the common case
+    // cheap.
+    if (IsUnlimited(sampling_policy))
+    {
+        score::cpp::ignore = sampling_policy_map.erase(trace_point_key);
+        return;
+    }
+    sampling_policy_map[trace_point_key] = sampling_policy;
+}
+
+template <typename TracePointType>
+TracePointSamplingPolicy GetSamplingPolicyFromMap(
+    std::string_view service_type,
+    std::string_view service_element_name,
+    ServiceElementType service_element_type,
+    TracePointType trace_point_type,
+    const std::unordered_map<TracePointKey, TracePointSamplingPolicy>& sampling_policy_map) noexcept
+{
+    const ServiceElementIdentifierView service_element_identifer{
+        service_type, service_element_name, service_element_type};
+    const TracePointKey trace_point_key{service_element_identifer, static_cast<std::uint8_t>(trace_point_type)};
+
+    const auto map_it = sampling_policy_map.find(trace_point_key);
+    if (map_it == sampling_policy_map.cend())
+    {
+        return TracePointSamplingPolicy{};
+    }
+    return map_it->second;
+}
+
 template <typename T>
 constexpr bool DoesTracePointNeedTraceDoneCB([[maybe_unused]] const T& trace_point_type) noexcept
 {
@@ -398,6 +443,110 @@ void TracingFilterConfig::AddTracePoint(std::string_view service_type,
                        config_names_);
 }
 
+TracePointSamplingPolicy TracingFilterConfig::GetSamplingPolicy(
+    std::string_view service_type,
+    std::string_view event_name,
+    SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept
+{
+    return GetSamplingPolicyFromMap(service_type,
+                                    event_name,
+                                    ServiceElementType::EVENT,
+                                    skeleton_event_trace_point_type,
+                                    skeleton_event_sampling_policies_);
+}
+
+TracePointSamplingPolicy TracingFilterConfig::GetSamplingPolicy(
+    std::string_view service_type,
+    std::string_view field_name,
+    SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept
+{
+    return GetSamplingPolicyFromMap(service_type,
+                                    field_name,
+                                    ServiceElementType::FIELD,
+                                    skeleton_field_trace_point_type,
+                                    skeleton_field_sampling_policies_);
+}
+
+TracePointSamplingPolicy TracingFilterConfig::GetSamplingPolicy(
+    std::string_view service_type,
+    std::string_view event_name,
+    ProxyEventTracePointType proxy_event_trace_point_type) const noexcept
+{
+    return GetSamplingPolicyFromMap(service_type,
+                                    event_name,
+                                    ServiceElementType::EVENT,
+                                    proxy_event_trace_point_type,
+                                    proxy_event_sampling_policies_);
+}
+
+TracePointSamplingPolicy TracingFilterConfig::GetSamplingPolicy(
+    std::string_view service_type,
+    std::string_view field_name,
+    ProxyFieldTracePointType proxy_field_trace_point_type) const noexcept
+{
+    return GetSamplingPolicyFromMap(service_type,
+                                    field_name,
+                                    ServiceElementType::FIELD,
+                                    proxy_field_trace_point_type,
+                                    proxy_field_sampling_policies_);
+}
+
+void TracingFilterConfig::SetSamplingPolicy(std::string_view service_type,
+                                            std::string_view event_name,
+                                            SkeletonEventTracePointType skeleton_event_trace_point_type,
+                                            TracePointSamplingPolicy sampling_policy) noexcept
+{
+    SetSamplingPolicyInMap(service_type,
+                           event_name,
+                           ServiceElementType::EVENT,
+                           skeleton_event_trace_point_type,
+                           sampling_policy,
+                           skeleton_event_sampling_policies_,
+                           config_names_);
+}
+
+void TracingFilterConfig::SetSamplingPolicy(std::string_view service_type,
+                                            std::string_view field_name,
+                                            SkeletonFieldTracePointType skeleton_field_trace_point_type,
+                                            TracePointSamplingPolicy sampling_policy) noexcept
+{
+    SetSamplingPolicyInMap(service_type,
+                           field_name,
+                           ServiceElementType::FIELD,
+                           skeleton_field_trace_point_type,
+                           sampling_policy,
+                           skeleton_field_sampling_policies_,
+                           config_names_);
+}
+
+void TracingFilterConfig::SetSamplingPolicy(std::string_view service_type,
+                                            std::string_view event_name,
+                                            ProxyEventTracePointType proxy_event_trace_point_type,
+                                            TracePointSamplingPolicy sampling_policy) noexcept
+{
+    SetSamplingPolicyInMap(service_type,
+                           event_name,
+                           ServiceElementType::EVENT,
+                           proxy_event_trace_point_type,
+                           sampling_policy,
+                           proxy_event_sampling_policies_,
+                           config_names_);
+}
+
+void TracingFilterConfig::SetSamplingPolicy(std::string_view service_type,
+                                            std::string_view field_name,
+                                            ProxyFieldTracePointType proxy_field_trace_point_type,
+                                            TracePointSamplingPolicy sampling_policy) noexcept
+{
+    SetSamplingPolicyInMap(service_type,
+                           field_name,
+                           ServiceElementType::FIELD,
+                           proxy_field_trace_point_type,
+                           sampling_policy,
+                           proxy_field_sampling_policies_,
+                           config_names_);
+}
+
 /// @brief: Find the number of configured tracing slots for all trace points.
 std::uint16_t TracingFilterConfig::GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept
 {
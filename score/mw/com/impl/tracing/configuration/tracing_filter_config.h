@@ -16,6 +16,7 @@
 #include "score/mw/com/impl/configuration/configuration.h"
 #include "score/mw/com/impl/tracing/configuration/i_tracing_filter_config.h"
 #include "score/mw/com/impl/tracing/configuration/trace_point_key.h"
+#include "score/mw/com/impl/tracing/configuration/trace_point_sampling_policy.h"
 
 #include <set>
 #include <string>
@@ -62,6 +63,42 @@ class TracingFilterConfig : public ITracingFilterConfig
                        InstanceSpecifierView instance_specifier,
                        ProxyFieldTracePointType proxy_field_trace_point_type) noexcept override;
 
+    TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view event_name,
+        SkeletonEventTracePointType skeleton_event_trace_point_type) const noexcept override;
+    TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view field_name,
+        SkeletonFieldTracePointType skeleton_field_trace_point_type) const noexcept override;
+    TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view event_name,
+        ProxyEventTracePointType proxy_event_trace_point_type) const noexcept override;
+    TracePointSamplingPolicy GetSamplingPolicy(
+        std::string_view service_type,
+        std::string_view field_name,
+        ProxyFieldTracePointType proxy_field_trace_point_type) const noexcept override;
+
+    /// \brief Sets the sampling policy of the given trace point. The policy applies to all instances, for which the
+    ///        trace point is enabled via AddTracePoint().
+    void SetSamplingPolicy(std::string_view service_type,
+                           std::string_view event_name,
+                           SkeletonEventTracePointType skeleton_event_trace_point_type,
+                           TracePointSamplingPolicy sampling_policy) noexcept;
+    void SetSamplingPolicy(std::string_view service_type,
+                           std::string_view field_name,
+                           SkeletonFieldTracePointType skeleton_field_trace_point_type,
+                           TracePointSamplingPolicy sampling_policy) noexcept;
+    void SetSamplingPolicy(std::string_view service_type,
+                           std::string_view event_name,
+                           ProxyEventTracePointType proxy_event_trace_point_type,
+                           TracePointSamplingPolicy sampling_policy) noexcept;
+    void SetSamplingPolicy(std::string_view service_type,
+                           std::string_view field_name,
+                           ProxyFieldTracePointType proxy_field_trace_point_type,
+                           TracePointSamplingPolicy sampling_policy) noexcept;
+
     std::uint16_t GetNumberOfTracingSlots(score::mw::com::impl::Configuration& config) const noexcept override;
 
   private:
@@ -72,6 +109,12 @@ class TracingFilterConfig : public ITracingFilterConfig
     TracePointMapType skeleton_field_trace_points_;
     TracePointMapType proxy_event_trace_points_;
     TracePointMapType proxy_field_trace_points_;
+
+    using SamplingPolicyMapType = std::unordered_map<TracePointKey, TracePointSamplingPolicy>;
+    SamplingPolicyMapType skeleton_event_sampling_policies_;
+    SamplingPolicyMapType skeleton_field_sampling_policies_;
+    SamplingPolicyMapType proxy_event_sampling_policies_;
+    SamplingPolicyMapType proxy_field_sampling_policies_;
 };
 
 }  // namespace score::mw::com::impl::tracing
@@ -80,6 +80,30 @@ class TracingFilterConfigMock : public ITracingFilterConfig
                  InstanceSpecifierView instance_specifier,
                  ProxyFieldTracePointType proxy_field_trace_point_type),
                 (noexcept, override));
+    MOCK_METHOD(TracePointSamplingPolicy,
+                GetSamplingPolicy,
+                (std::string_view service_type,
+                 std::string_view event_name,
+                 SkeletonEventTracePointType skeleton_event_trace_point_type),
+                (const, noexcept, override));
+    MOCK_METHOD(TracePointSamplingPolicy,
+                GetSamplingPolicy,
+                (std::string_view service_type,
+                 std::string_view event_name,
+                 SkeletonFieldTracePointType skeleton_field_trace_point_type),
+                (const, noexcept, override));
+    MOCK_METHOD(TracePointSamplingPolicy,
+                GetSamplingPolicy,
+                (std::string_view service_type,
+                 std::string_view event_name,
+                 ProxyEventTracePointType proxy_event_trace_point_type),
+                (const, noexcept, override));
+    MOCK_METHOD(TracePointSamplingPolicy,
+                GetSamplingPolicy,
+                (std::string_view service_type,
+                 std::string_view event_name,
+                 ProxyFieldTracePointType proxy_field_trace_point_type),
+                (const, noexcept, override));
     MOCK_METHOD(std::uint16_t,
                 GetNumberOfTracingSlots,
                 (score::mw::com::impl::Configuration & config),
@@ -12,6 +12,7 @@
  ********************************************************************************/
 #include "score/mw/com/impl/tracing/configuration/tracing_filter_config_parser.h"
 
+#include "score/mw/com/impl/tracing/configuration/trace_point_sampling_policy.h"
 #include "score/mw/com/impl/tracing/trace_error.h"
 
 #include "score/json/json_parser.h"
@@ -19,6 +20,7 @@
 
 #include <score/overload.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <set>
 #include <string>
@@ -41,6 +43,9 @@ constexpr auto kShortnameKey = "shortname"sv;
 constexpr auto kNotifierKey = "notifier"sv;
 constexpr auto kGetterKey = "getter"sv;
 constexpr auto kSetterKey = "setter"sv;
+constexpr auto kSamplingKey = "sampling"sv;
+constexpr auto kOneInNKey = "one_in_n"sv;
+constexpr auto kMaxPerSecondKey = "max_per_second"sv;
 
 /// \brief List of json property names from the tracing filter config json file which are not currently implemented.
 constexpr std::array<const std::string_view, 2U> service_element_notifier_filter_properties_not_implemented_array{
@@ -151,6 +156,69 @@ bool IsOptionalBoolPropertyEnabled(const score::json::Object& json, const std::s
     return false;
 }
 
+/// \brief Returns the sampling policy for the trace point with the given bool property name.
+/// \details Sampling policies are configured in an optional "sampling" object next to the bool properties, which maps
+///          the bool property name to an object with the optional properties "one_in_n" and "max_per_second". If
+///          there is no such entry, a policy tracing every call is returned.
+/// \param json json object containing the bool property
+/// \param bool_property_name name of the bool property
+/// \return configured sampling policy
+// Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
+// implicitly". This is a false positive, the result of 'json.As()' is checked via has_value() before calling value().
+// This suppression should be removed after fixing [Ticket-173043](broken_link_j/Ticket-173043)
+// coverity[autosar_cpp14_a15_5_3_violation : FALSE]
+TracePointSamplingPolicy ParseSamplingPolicy(const score::json::Object& json,
+                                             const std::string_view bool_property_name) noexcept
+{
+    TracePointSamplingPolicy sampling_policy{};
+    const auto& sampling = json.find(kSamplingKey);
+    if (sampling == json.cend())
+    {
+        return sampling_policy;
+    }
+    auto sampling_result = sampling->second.As<score::json::Object>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(sampling_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& sampling_object = sampling_result.value().get();
+
+    const auto& policy = sampling_object.find(bool_property_name);
+    if (policy == sampling_object.cend())
+    {
+        return sampling_policy;
+    }
+    auto policy_result = policy->second.As<score::json::Object>();
+    SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(policy_result.has_value(),
+                                                      "Configuration corrupted, check with json schema");
+    const auto& policy_object = policy_result.value().get();
+
+    const auto& one_in_n = policy_object.find(kOneInNKey);
+    if (one_in_n != policy_object.cend())
+    {
+        const auto one_in_n_result = one_in_n->second.As<std::uint32_t>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(one_in_n_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        if (one_in_n_result.value() == 0U)
+        {
+            ::score::mw::log::LogWarn("lola") << "Trace Filter Configuration: one_in_n of 0 for trace point"
+                                              << bool_property_name << "is invalid. Tracing every call instead.";
+        }
+        else
+        {
+            sampling_policy.one_in_n = one_in_n_result.value();
+        }
+    }
+
+    const auto& max_per_second = policy_object.find(kMaxPerSecondKey);
+    if (max_per_second != policy_object.cend())
+    {
+        const auto max_per_second_result = max_per_second->second.As<std::uint32_t>();
+        SCORE_LANGUAGE_FUTURECPP_PRECONDITION_PRD_MESSAGE(max_per_second_result.has_value(),
+                                                          "Configuration corrupted, check with json schema");
+        sampling_policy.max_per_second = max_per_second_result.value();
+    }
+    return sampling_policy;
+}
+
 /// \brief Returns the configured instances (within our mw_com_config.json) of the given service type
 /// \param configuration configuration, where to do the lookup
 /// \param service_type identification of the service type (which is an AUTOSAR short-name-path representation)
@@ -258,7 +326,8 @@ std::set<std::string_view> GetElementNamesOfServiceType(const std::string_view s
 /// \param service_element_name name of the service within service_type, for which the trace point shall be added.
 /// \param instance_id instance id of service-type for which the trace point shall be added.
 /// \param trace_point_type detailed trace point type
-/// \param filter_config filter_config config, where the addition shall be done.
+/// \param filter_config filter_config config, where the addition shall be done. A sampling policy configured for the
+///        trace point is set as well.
 template <typename TP>
 void AddTracePoint(const score::json::Object& json,
                    const std::string_view bool_prop_name,
@@ -271,6 +340,8 @@ void AddTracePoint(const score::json::Object& json,
     if (IsOptionalBoolPropertyEnabled(json, bool_prop_name))
     {
         filter_config.AddTracePoint(service_type, service_element_name, instance_id, trace_point_type);
+        filter_config.SetSamplingPolicy(
+            service_type, service_element_name, trace_point_type, ParseSamplingPolicy(json, bool_prop_name));
     }
 }
 
@@ -1438,5 +1438,135 @@ TEST_F(TraceConfigParserFixture, FieldsInFilterConfigIgnoredWhenServiceTypeHasNo
     // Then parsing succeeds - the field is silently ignored because the service type has no fields
     EXPECT_TRUE(result.has_value());
 }
+TEST_F(TraceConfigParserFixture, SamplingPoliciesAreParsedForEventsAndFieldNotifiers)
+{
+    // Given a tracing filter configuration, which enables high frequency trace points together with sampling policies
+    auto filter_config_json = R"(
+{
+  "services": [
+    {
+      "shortname_path": "/score/ncar/services/TirePressureService",
+      "events": [
+        {
+          "shortname": "CurrentPressureFrontLeft",
+          "trace_send": true,
+          "trace_send_allocate": true,
+          "trace_get_new_samples": true,
+          "sampling": {
+            "trace_send": {"one_in_n": 10, "max_per_second": 100},
+            "trace_get_new_samples": {"max_per_second": 50}
+          }
+        }
+      ],
+      "fields": [
+        {
+          "shortname": "CurrentTemperatureFrontLeft",
+          "notifier": {
+            "trace_update": true,
+            "sampling": {
+              "trace_update": {"one_in_n": 4}
+            }
+          }
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // When parsing the given tracing filter config
+    auto result = Parse(std::move(filter_config_json), *config_);
+    ASSERT_TRUE(result.has_value());
+    const TracingFilterConfig tracing_filter_config = std::move(result).value();
+
+    // Then the configured sampling policies are returned for the trace points
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND),
+              (TracePointSamplingPolicy{10U, 100U}));
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentPressureFrontLeft", ProxyEventTracePointType::GET_NEW_SAMPLES),
+              (TracePointSamplingPolicy{1U, 50U}));
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentTemperatureFrontLeft", SkeletonFieldTracePointType::UPDATE),
+              (TracePointSamplingPolicy{4U, 0U}));
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentTemperatureFrontLeft", SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE),
+              (TracePointSamplingPolicy{4U, 0U}));
+
+    // and trace points without a sampling policy trace every call
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND_WITH_ALLOCATE),
+              TracePointSamplingPolicy{});
+}
+
+TEST_F(TraceConfigParserFixture, SamplingPolicyOfDisabledTracePointIsIgnored)
+{
+    // Given a tracing filter configuration, which configures a sampling policy for a trace point it doesn't enable
+    auto filter_config_json = R"(
+{
+  "services": [
+    {
+      "shortname_path": "/score/ncar/services/TirePressureService",
+      "events": [
+        {
+          "shortname": "CurrentPressureFrontLeft",
+          "trace_send": false,
+          "sampling": {
+            "trace_send": {"one_in_n": 10}
+          }
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // When parsing the given tracing filter config
+    auto result = Parse(std::move(filter_config_json), *config_);
+    ASSERT_TRUE(result.has_value());
+    const TracingFilterConfig tracing_filter_config = std::move(result).value();
+
+    // Then no sampling policy is stored for the trace point
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND),
+              TracePointSamplingPolicy{});
+}
+
+TEST_F(TraceConfigParserFixture, OneInNOfZeroIsTreatedAsTracingEveryCall)
+{
+    // Given a tracing filter configuration with an invalid one_in_n value of 0
+    auto filter_config_json = R"(
+{
+  "services": [
+    {
+      "shortname_path": "/score/ncar/services/TirePressureService",
+      "events": [
+        {
+          "shortname": "CurrentPressureFrontLeft",
+          "trace_send": true,
+          "sampling": {
+            "trace_send": {"one_in_n": 0, "max_per_second": 20}
+          }
+        }
+      ]
+    }
+  ]
+}
+)"_json;
+
+    // Expecting a warning to be logged
+    EXPECT_CALL(recorder_mock_, StartRecord(std::string_view{"lola"}, score::mw::log::LogLevel::kWarn))
+        .Times(::testing::AtLeast(1));
+
+    // When parsing the given tracing filter config
+    auto result = Parse(std::move(filter_config_json), *config_);
+    ASSERT_TRUE(result.has_value());
+    const TracingFilterConfig tracing_filter_config = std::move(result).value();
+
+    // Then only the max_per_second limit is applied
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(
+                  kServiceTypeName, "CurrentPressureFrontLeft", SkeletonEventTracePointType::SEND),
+              (TracePointSamplingPolicy{1U, 20U}));
+}
 }  // namespace
 }  // namespace score::mw::com::impl::tracing
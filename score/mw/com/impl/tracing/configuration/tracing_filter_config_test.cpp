@@ -144,6 +144,58 @@ TYPED_TEST(TracingFilterConfigFixture, AddingSameTracePointTwiceWillNotCrash)
     EXPECT_TRUE(is_enabled);
 }
 
+TYPED_TEST(TracingFilterConfigFixture, GetSamplingPolicyWithoutSettingItReturnsDefaultPolicy)
+{
+    const auto trace_point_type{static_cast<TypeParam>(1U)};
+
+    // Given a tracing filter config with an enabled trace point
+    TracingFilterConfig tracing_filter_config{};
+    tracing_filter_config.AddTracePoint(kServiceType, kEventName, kInstanceSpecifierView, trace_point_type);
+
+    // When getting the sampling policy of the trace point without having set one
+    const auto sampling_policy = tracing_filter_config.GetSamplingPolicy(kServiceType, kEventName, trace_point_type);
+
+    // Then the default policy tracing every call is returned
+    EXPECT_EQ(sampling_policy, TracePointSamplingPolicy{});
+}
+
+TYPED_TEST(TracingFilterConfigFixture, GetSamplingPolicyReturnsPolicyWhichWasSet)
+{
+    const auto trace_point_type{static_cast<TypeParam>(1U)};
+    const TracePointSamplingPolicy expected_sampling_policy{10U, 100U};
+
+    // Given a tracing filter config
+    TracingFilterConfig tracing_filter_config{};
+
+    // When setting a sampling policy for a trace point
+    tracing_filter_config.SetSamplingPolicy(kServiceType, kEventName, trace_point_type, expected_sampling_policy);
+
+    // Then the same policy is returned for this trace point
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(kServiceType, kEventName, trace_point_type),
+              expected_sampling_policy);
+
+    // and the default policy is returned for a different trace point type
+    const auto other_trace_point_type{static_cast<TypeParam>(2U)};
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(kServiceType, kEventName, other_trace_point_type),
+              TracePointSamplingPolicy{});
+}
+
+TYPED_TEST(TracingFilterConfigFixture, SettingUnlimitedSamplingPolicyResetsPreviousPolicy)
+{
+    const auto trace_point_type{static_cast<TypeParam>(1U)};
+
+    // Given a tracing filter config with a sampling policy set for a trace point
+    TracingFilterConfig tracing_filter_config{};
+    tracing_filter_config.SetSamplingPolicy(kServiceType, kEventName, trace_point_type, {5U, 0U});
+
+    // When setting a policy tracing every call
+    tracing_filter_config.SetSamplingPolicy(kServiceType, kEventName, trace_point_type, {1U, 0U});
+
+    // Then the default policy is returned
+    EXPECT_EQ(tracing_filter_config.GetSamplingPolicy(kServiceType, kEventName, trace_point_type),
+              TracePointSamplingPolicy{});
+}
+
 TEST(TracingFilterConfigTest, CheckingTracePointTypesWithSameNumericalValueDoNotMatch)
 {
     const auto trace_point_type_0{static_cast<SkeletonEventTracePointType>(1U)};
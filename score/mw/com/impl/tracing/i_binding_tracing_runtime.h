@@ -36,6 +36,20 @@ class IBindingTracingRuntime
     using TracingSlotSizeType = ServiceElementTracingData::TracingSlotSizeType;
     using SamplePointerIndex = ServiceElementTracingData::SamplePointerIndex;
 
+    /// \brief Everything a Trace() call with a ShmDataChunkList needs to know about the shm-object of a service
+    ///        element, which doesn't change between calls. It gets resolved once per service element and registration
+    ///        of its shm-object instead of on every Trace() call.
+    struct ShmTraceHandle
+    {
+        analysis::tracing::ShmObjectHandle shm_object_handle;
+        void* shm_region_start;
+        analysis::tracing::ServiceInstanceElement service_instance_element;
+    };
+
+    /// \brief Generation of the shm-object registrations, which changes with every (re-)registration or
+    ///        unregistration of a shm-object.
+    using ShmObjectRegistrationGeneration = std::uint32_t;
+
     IBindingTracingRuntime() noexcept = default;
 
     virtual ~IBindingTracingRuntime() noexcept = default;
@@ -105,6 +119,25 @@ class IBindingTracingRuntime
     virtual analysis::tracing::ServiceInstanceElement ConvertToTracingServiceInstanceElement(
         const impl::tracing::ServiceElementInstanceIdentifierView service_element_instance_identifier_view) const = 0;
 
+    /// \brief Returns the current generation of the shm-object registrations of this binding specific tracing runtime.
+    virtual ShmObjectRegistrationGeneration GetShmObjectRegistrationGeneration() const noexcept = 0;
+
+    /// \brief Stores the resolved ShmTraceHandle for the service element identified by service_element_tracing_data.
+    ///
+    /// The handle stays valid until a shm-object gets (re-)registered or unregistered with this binding specific
+    /// tracing runtime.
+    /// \param shm_object_registration_generation generation returned by GetShmObjectRegistrationGeneration() before
+    ///        the handle has been resolved. If a shm-object has been (re-)registered or unregistered since then, the
+    ///        handle might be outdated already and is never returned by GetShmTraceHandle().
+    virtual void CacheShmTraceHandle(
+        const ServiceElementTracingData& service_element_tracing_data,
+        const ShmTraceHandle& shm_trace_handle,
+        const ShmObjectRegistrationGeneration shm_object_registration_generation) noexcept = 0;
+    /// \brief Returns the ShmTraceHandle cached for the service element identified by service_element_tracing_data.
+    /// \return the cached handle or an empty optional, if there is no (longer a) valid handle for the service element.
+    virtual std::optional<ShmTraceHandle> GetShmTraceHandle(
+        const ServiceElementTracingData& service_element_tracing_data) const noexcept = 0;
+
     virtual std::optional<TraceContextId> EmplaceTypeErasedSamplePtr(
         TypeErasedSamplePtr type_erased_sample_ptr,
         const ServiceElementTracingData service_element_tracing_data) noexcept = 0;
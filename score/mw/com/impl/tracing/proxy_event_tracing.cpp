@@ -22,6 +22,7 @@
 #include "score/mw/com/impl/tracing/configuration/proxy_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
 #include "score/mw/com/impl/tracing/proxy_event_tracing_data.h"
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
 #include "score/mw/com/impl/tracing/trace_error.h"
 
 #include "score/mw/log/logging.h"
@@ -54,6 +55,22 @@ void UpdateTracingDataFromTraceResult(Result<void> trace_result,
     }
 }
 
+/// \brief Creates the sampler for a trace point. The filter config is only queried for enabled trace points, disabled
+///        ones keep a sampler, which lets every call pass.
+template <typename TracePointType>
+TracePointSampler CreateTracePointSampler(const ITracingFilterConfig& tracing_config,
+                                          const bool is_trace_point_enabled,
+                                          const std::string_view service_type,
+                                          const std::string_view service_element_name,
+                                          const TracePointType trace_point_type) noexcept
+{
+    if (!is_trace_point_enabled)
+    {
+        return TracePointSampler{};
+    }
+    return TracePointSampler{tracing_config.GetSamplingPolicy(service_type, service_element_name, trace_point_type)};
+}
+
 }  // namespace
 
 // Suppress "AUTOSAR C++14 A3-1-1", The rule states: "It shall be possible to include any header file
@@ -106,6 +123,25 @@ ProxyEventTracingData GenerateProxyTracingStructFromEventConfig(const InstanceId
             service_type, event_name, instance_specifier_view, ProxyEventTracePointType::GET_NEW_SAMPLES);
         proxy_event_tracing_data.enable_new_samples_callback = tracing_config->IsTracePointEnabled(
             service_type, event_name, instance_specifier_view, ProxyEventTracePointType::GET_NEW_SAMPLES_CALLBACK);
+
+        proxy_event_tracing_data.call_receive_handler_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_call_receive_handler,
+                                    service_type,
+                                    event_name,
+                                    ProxyEventTracePointType::RECEIVE_HANDLER_CALLBACK);
+        proxy_event_tracing_data.get_new_samples_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_get_new_samples,
+                                    service_type,
+                                    event_name,
+                                    ProxyEventTracePointType::GET_NEW_SAMPLES);
+        proxy_event_tracing_data.new_samples_callback_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_new_samples_callback,
+                                    service_type,
+                                    event_name,
+                                    ProxyEventTracePointType::GET_NEW_SAMPLES_CALLBACK);
     }
     return proxy_event_tracing_data;
 }
@@ -160,6 +196,25 @@ ProxyEventTracingData GenerateProxyTracingStructFromFieldConfig(const InstanceId
             service_type, field_name, instance_specifier_view, ProxyFieldTracePointType::GET_NEW_SAMPLES);
         proxy_event_tracing_data.enable_new_samples_callback = tracing_config->IsTracePointEnabled(
             service_type, field_name, instance_specifier_view, ProxyFieldTracePointType::GET_NEW_SAMPLES_CALLBACK);
+
+        proxy_event_tracing_data.call_receive_handler_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_call_receive_handler,
+                                    service_type,
+                                    field_name,
+                                    ProxyFieldTracePointType::RECEIVE_HANDLER_CALLBACK);
+        proxy_event_tracing_data.get_new_samples_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_get_new_samples,
+                                    service_type,
+                                    field_name,
+                                    ProxyFieldTracePointType::GET_NEW_SAMPLES);
+        proxy_event_tracing_data.new_samples_callback_sampler =
+            CreateTracePointSampler(*tracing_config,
+                                    proxy_event_tracing_data.enable_new_samples_callback,
+                                    service_type,
+                                    field_name,
+                                    ProxyFieldTracePointType::GET_NEW_SAMPLES_CALLBACK);
     }
     return proxy_event_tracing_data;
 }
@@ -308,7 +363,8 @@ void TraceUnsetReceiveHandler(ProxyEventTracingData& proxy_event_tracing_data,
 void TraceGetNewSamples(ProxyEventTracingData& proxy_event_tracing_data,
                         const ProxyEventBindingBase& proxy_event_binding_base) noexcept
 {
-    if (proxy_event_tracing_data.enable_get_new_samples)
+    if (proxy_event_tracing_data.enable_get_new_samples &&
+        proxy_event_tracing_data.get_new_samples_sampler.ShouldTrace())
     {
         const auto service_element_instance_identifier =
             proxy_event_tracing_data.service_element_instance_identifier_view;
@@ -344,7 +400,8 @@ void TraceCallGetNewSamplesCallback(ProxyEventTracingData& proxy_event_tracing_d
                                     const ProxyEventBindingBase& proxy_event_binding_base,
                                     ITracingRuntime::TracePointDataId trace_point_data_id) noexcept
 {
-    if (proxy_event_tracing_data.enable_new_samples_callback)
+    if (proxy_event_tracing_data.enable_new_samples_callback &&
+        proxy_event_tracing_data.new_samples_callback_sampler.ShouldTrace())
     {
         const auto service_element_instance_identifier =
             proxy_event_tracing_data.service_element_instance_identifier_view;
@@ -382,7 +439,8 @@ void TraceCallGetNewSamplesCallback(ProxyEventTracingData& proxy_event_tracing_d
 void TraceCallReceiveHandler(ProxyEventTracingData& proxy_event_tracing_data,
                              const ProxyEventBindingBase& proxy_event_binding_base) noexcept
 {
-    if (proxy_event_tracing_data.enable_call_receive_handler)
+    if (proxy_event_tracing_data.enable_call_receive_handler &&
+        proxy_event_tracing_data.call_receive_handler_sampler.ShouldTrace())
     {
         const auto service_element_instance_identifier =
             proxy_event_tracing_data.service_element_instance_identifier_view;
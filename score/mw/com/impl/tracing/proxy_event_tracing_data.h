@@ -14,6 +14,7 @@
 #define SCORE_MW_COM_IMPL_TRACING_PROXY_EVENT_TRACING_DATA_H
 
 #include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
 
 namespace score::mw::com::impl::tracing
 {
@@ -47,6 +48,15 @@ struct ProxyEventTracingData
     bool enable_get_new_samples{false};
     // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
     bool enable_new_samples_callback{false};
+
+    // Sampling is only supported for the trace points, which are called per sample or per notification. All other
+    // trace points are traced on every call.
+    // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
+    TracePointSampler call_receive_handler_sampler{};
+    // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
+    TracePointSampler get_new_samples_sampler{};
+    // coverity[autosar_cpp14_m11_0_1_violation : FALSE]
+    TracePointSampler new_samples_callback_sampler{};
 };
 
 void DisableAllTracePoints(ProxyEventTracingData& proxy_event_tracing_data) noexcept;
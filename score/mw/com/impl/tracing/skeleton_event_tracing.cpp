@@ -23,6 +23,7 @@
 #include "score/mw/com/impl/tracing/configuration/skeleton_field_trace_point_type.h"
 #include "score/mw/com/impl/tracing/configuration/tracing_filter_config.h"
 #include "score/mw/com/impl/tracing/skeleton_event_tracing_data.h"
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
 #include "score/mw/com/impl/tracing/trace_error.h"
 
 #include <score/assert.hpp>
@@ -171,6 +172,18 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromEventConfig(const Inst
             service_type, event_name, instance_specifier_view, SkeletonEventTracePointType::SEND);
         skeleton_event_tracing_data.enable_send_with_allocate = tracing_config->IsTracePointEnabled(
             service_type, event_name, instance_specifier_view, SkeletonEventTracePointType::SEND_WITH_ALLOCATE);
+        if (skeleton_event_tracing_data.enable_send)
+        {
+            const auto sampling_policy =
+                tracing_config->GetSamplingPolicy(service_type, event_name, SkeletonEventTracePointType::SEND);
+            skeleton_event_tracing_data.send_sampler = TracePointSampler{sampling_policy};
+        }
+        if (skeleton_event_tracing_data.enable_send_with_allocate)
+        {
+            const auto sampling_policy = tracing_config->GetSamplingPolicy(
+                service_type, event_name, SkeletonEventTracePointType::SEND_WITH_ALLOCATE);
+            skeleton_event_tracing_data.send_with_allocate_sampler = TracePointSampler{sampling_policy};
+        }
 
         // only register this service element at Runtime, in case TraceDoneCB relevant trace-point are enabled:
         const auto isTraceDoneCallbackNeeded =
@@ -222,6 +235,18 @@ SkeletonEventTracingData GenerateSkeletonTracingStructFromFieldConfig(const Inst
             service_type, field_name, instance_specifier_view, SkeletonFieldTracePointType::UPDATE);
         skeleton_event_tracing_data.enable_send_with_allocate = tracing_config->IsTracePointEnabled(
             service_type, field_name, instance_specifier_view, SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE);
+        if (skeleton_event_tracing_data.enable_send)
+        {
+            const auto sampling_policy =
+                tracing_config->GetSamplingPolicy(service_type, field_name, SkeletonFieldTracePointType::UPDATE);
+            skeleton_event_tracing_data.send_sampler = TracePointSampler{sampling_policy};
+        }
+        if (skeleton_event_tracing_data.enable_send_with_allocate)
+        {
+            const auto sampling_policy = tracing_config->GetSamplingPolicy(
+                service_type, field_name, SkeletonFieldTracePointType::UPDATE_WITH_ALLOCATE);
+            skeleton_event_tracing_data.send_with_allocate_sampler = TracePointSampler{sampling_policy};
+        }
 
         // only register this service element at Runtime, in case TraceDoneCB relevant trace-point are enabled:
         const auto isTraceDoneCallbackNeeded =
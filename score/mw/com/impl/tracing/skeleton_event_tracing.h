@@ -152,6 +152,7 @@ void TraceSend(SkeletonEventTracingData& skeleton_event_tracing_data,
                const SkeletonEventBindingBase& skeleton_event_binding_base,
                impl::SampleAllocateePtr<SampleType>& sample_data_ptr) noexcept
 {
+    // Sampling has already been applied when the send callback was created (see CreateTracingSendCallback).
     if (skeleton_event_tracing_data.enable_send)
     {
         const auto service_element_instance_identifier =
@@ -197,6 +198,7 @@ void TraceSendWithAllocate(SkeletonEventTracingData& skeleton_event_tracing_data
                            const SkeletonEventBindingBase& skeleton_event_binding_base,
                            impl::SampleAllocateePtr<SampleType>& sample_data_ptr) noexcept
 {
+    // Sampling has already been applied when the send callback was created (see CreateTracingSendWithAllocateCallback).
     if (skeleton_event_tracing_data.enable_send_with_allocate)
     {
         const auto service_element_instance_identifier =
@@ -243,7 +245,9 @@ auto CreateTracingSendCallback(SkeletonEventTracingData& skeleton_event_tracing_
     -> std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>
 {
     std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback> tracing_handler{};
-    if (skeleton_event_tracing_data.enable_send)
+    // This is the only place, where the send sampler is evaluated: once per Send() call and before any trace data is
+    // extracted, so that a skipped call neither creates a callback nor occupies a tracing slot.
+    if (skeleton_event_tracing_data.enable_send && skeleton_event_tracing_data.send_sampler.ShouldTrace())
     {
         tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
                               impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
@@ -259,7 +263,9 @@ auto CreateTracingSendWithAllocateCallback(SkeletonEventTracingData& skeleton_ev
     -> std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback>
 {
     std::optional<typename SkeletonEventBinding<SampleType>::SendTraceCallback> tracing_handler{};
-    if (skeleton_event_tracing_data.enable_send_with_allocate)
+    // This is the only place, where the send-with-allocate sampler is evaluated (see CreateTracingSendCallback).
+    if (skeleton_event_tracing_data.enable_send_with_allocate &&
+        skeleton_event_tracing_data.send_with_allocate_sampler.ShouldTrace())
     {
         tracing_handler = [&skeleton_event_tracing_data, &skeleton_event_binding_base](
                               impl::SampleAllocateePtr<SampleType>& sample_data_ptr) mutable noexcept {
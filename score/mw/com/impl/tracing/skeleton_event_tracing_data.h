@@ -15,6 +15,7 @@
 
 #include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
 #include "score/mw/com/impl/tracing/service_element_tracing_data.h"
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
 
 namespace score::mw::com::impl::tracing
 {
@@ -34,6 +35,12 @@ class SkeletonEventTracingData
     bool enable_send{false};
     // coverity[autosar_cpp14_m11_0_1_violation]
     bool enable_send_with_allocate{false};
+
+    // Samplers are only consulted for enabled trace points. They decide, which of the calls actually get traced.
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    TracePointSampler send_sampler{};
+    // coverity[autosar_cpp14_m11_0_1_violation]
+    TracePointSampler send_with_allocate_sampler{};
 };
 
 void DisableAllTracePoints(SkeletonEventTracingData& skeleton_event_tracing_data) noexcept;
@@ -47,7 +54,9 @@ inline bool operator==(const SkeletonEventTracingData& lhs, const SkeletonEventT
     // coverity[autosar_cpp14_a5_2_6_violation : FALSE]
     return ((lhs.service_element_instance_identifier_view == rhs.service_element_instance_identifier_view) &&
             (lhs.service_element_tracing_data == rhs.service_element_tracing_data) &&
-            (lhs.enable_send == rhs.enable_send) && (lhs.enable_send_with_allocate == rhs.enable_send_with_allocate));
+            (lhs.enable_send == rhs.enable_send) && (lhs.enable_send_with_allocate == rhs.enable_send_with_allocate) &&
+            (lhs.send_sampler == rhs.send_sampler) &&
+            (lhs.send_with_allocate_sampler == rhs.send_with_allocate_sampler));
 }
 
 }  // namespace score::mw::com::impl::tracing
@@ -122,7 +122,28 @@ INSTANTIATE_TEST_CASE_P(
                                      SkeletonEventTracingData{kDummyServiceElementInstanceIdentifierView1,
                                                               kDummyServiceElementTracingData1,
                                                               true,
-                                                              false})));
+                                                              false}),
+
+                      std::make_pair(SkeletonEventTracingData{kDummyServiceElementInstanceIdentifierView1,
+                                                              kDummyServiceElementTracingData1,
+                                                              true,
+                                                              true},
+                                     SkeletonEventTracingData{kDummyServiceElementInstanceIdentifierView1,
+                                                              kDummyServiceElementTracingData1,
+                                                              true,
+                                                              true,
+                                                              TracePointSampler{TracePointSamplingPolicy{10U, 0U}}}),
+
+                      std::make_pair(SkeletonEventTracingData{kDummyServiceElementInstanceIdentifierView1,
+                                                              kDummyServiceElementTracingData1,
+                                                              true,
+                                                              true},
+                                     SkeletonEventTracingData{kDummyServiceElementInstanceIdentifierView1,
+                                                              kDummyServiceElementTracingData1,
+                                                              true,
+                                                              true,
+                                                              TracePointSampler{},
+                                                              TracePointSampler{TracePointSamplingPolicy{1U, 5U}}})));
 
 }  // namespace
 }  // namespace score::mw::com::impl::tracing
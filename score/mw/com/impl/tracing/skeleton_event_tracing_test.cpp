@@ -158,6 +158,83 @@ TEST_P(SkeletonEventTraceSendFixture, TraceSendWillNotDispatchToBindingTracingRu
     TraceSend<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_, sample_data_ptr_);
 }
 
+TEST_P(SkeletonEventTraceSendFixture, SendCallbackWillOnlyDispatchSampledCallsToBindingTracingRuntime)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled and a send trace point sampling every 10th call
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled();
+    skeleton_event_tracing_data_.send_sampler = TracePointSampler{TracePointSamplingPolicy{10U, 0U}};
+
+    // Expecting that TraceData will be called for exactly every 10th send on the TracingRuntime binding
+    EXPECT_CALL(tracing_runtime_mock_, Trace(_, _, _, _, _, _, _, _)).Times(10);
+
+    // When creating and calling the send callback like SkeletonEvent::Send() does for 100 sends
+    std::size_t created_callbacks{0U};
+    for (std::size_t call = 0U; call < 100U; ++call)
+    {
+        auto tracing_handler =
+            CreateTracingSendCallback<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_);
+        if (tracing_handler.has_value())
+        {
+            ++created_callbacks;
+            (*tracing_handler)(sample_data_ptr_);
+        }
+    }
+
+    // Then a callback is only created for the sampled sends and the sampler has been evaluated once per send
+    EXPECT_EQ(created_callbacks, 10U);
+    EXPECT_EQ(skeleton_event_tracing_data_.send_sampler.GetNumberOfSkippedCalls(), 90U);
+}
+
+TEST_P(SkeletonEventTraceSendFixture, SendCallbackUsesOneMaxPerSecondBudgetUnitPerTracedSend)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled and a send trace point tracing at most 5 calls
+    // per second
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled();
+    skeleton_event_tracing_data_.send_sampler = TracePointSampler{TracePointSamplingPolicy{1U, 5U}};
+
+    // Expecting that TraceData will be called for the full budget of 5 sends
+    EXPECT_CALL(tracing_runtime_mock_, Trace(_, _, _, _, _, _, _, _)).Times(5);
+
+    // When creating and calling the send callback for 20 sends within one second
+    for (std::size_t call = 0U; call < 20U; ++call)
+    {
+        auto tracing_handler =
+            CreateTracingSendCallback<TestSampleType>(skeleton_event_tracing_data_, skeleton_event_binding_base_);
+        if (tracing_handler.has_value())
+        {
+            (*tracing_handler)(sample_data_ptr_);
+        }
+    }
+
+    // Then the remaining sends have been skipped
+    EXPECT_EQ(skeleton_event_tracing_data_.send_sampler.GetNumberOfSkippedCalls(), 15U);
+}
+
+TEST_P(SkeletonEventTraceSendWithAllocateFixture, SendWithAllocateCallbackWillOnlyDispatchSampledCalls)
+{
+    // Given a SkeletonEventTracingData with all trace points enabled and a send-with-allocate trace point sampling
+    // every 4th call
+    WithAValidSkeletonEventTracingData().WithAllTracePointsEnabled();
+    skeleton_event_tracing_data_.send_with_allocate_sampler = TracePointSampler{TracePointSamplingPolicy{4U, 0U}};
+
+    // Expecting that TraceData will be called for exactly every 4th send on the TracingRuntime binding
+    EXPECT_CALL(tracing_runtime_mock_, Trace(_, _, _, _, _, _, _, _)).Times(5);
+
+    // When creating and calling the send-with-allocate callback for 20 sends
+    for (std::size_t call = 0U; call < 20U; ++call)
+    {
+        auto tracing_handler = CreateTracingSendWithAllocateCallback<TestSampleType>(skeleton_event_tracing_data_,
+                                                                                    skeleton_event_binding_base_);
+        if (tracing_handler.has_value())
+        {
+            (*tracing_handler)(sample_data_ptr_);
+        }
+    }
+
+    // Then the skipped calls are counted by the sampler
+    EXPECT_EQ(skeleton_event_tracing_data_.send_with_allocate_sampler.GetNumberOfSkippedCalls(), 15U);
+}
+
 TEST_P(SkeletonEventTraceSendFixture,
        TraceSendWillDisableTracePointIfDisableInstanceErrorReturnedFromBindingTracingRuntime)
 {
@@ -443,6 +520,37 @@ TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
         kConfigStore.GetInstanceIdentifier(), BindingType::kFake, GetServiceElementName());
 }
 
+TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
+       CallingGenerateTracingStructReturnsStructWithSamplerOfEnabledTracePoint)
+{
+    const TracePointSamplingPolicy sampling_policy{5U, 20U};
+
+    // Given a valid tracing runtime and TracingFilterConfig and a trace point enabled in the TracingFilterConfig
+    WithSendTracePointEnabled(true);
+
+    // and that the TracingFilterConfig contains a sampling policy for the enabled trace point
+    if (GetParam() == ServiceElementType::EVENT)
+    {
+        ON_CALL(tracing_filter_config_mock_, GetSamplingPolicy(_, _, SkeletonEventTracePointType::SEND))
+            .WillByDefault(Return(sampling_policy));
+    }
+    else
+    {
+        ON_CALL(tracing_filter_config_mock_, GetSamplingPolicy(_, _, SkeletonFieldTracePointType::UPDATE))
+            .WillByDefault(Return(sampling_policy));
+    }
+
+    // When calling GenerateSkeletonTracingStructFromEventConfig / GenerateSkeletonTracingStructFromFieldConfig
+    const auto tracing_data = GenerateSkeletonTracingStruct(
+        kConfigStore.GetInstanceIdentifier(), BindingType::kFake, GetServiceElementName());
+
+    // Then the sampler of the enabled trace point applies the configured sampling policy
+    EXPECT_EQ(tracing_data.send_sampler.GetSamplingPolicy(), sampling_policy);
+
+    // and the sampler of the disabled trace point lets every call pass
+    EXPECT_EQ(tracing_data.send_with_allocate_sampler.GetSamplingPolicy(), TracePointSamplingPolicy{});
+}
+
 TEST_P(SkeletonEventTracingGenerateTracingStructFixture,
        CallingGenerateTracingStructDoesNotRegistersServiceElementIfTracingGloballyDisabled)
 {
@@ -0,0 +1,63 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
+
+namespace score::mw::com::impl::tracing
+{
+
+TracePointSampler::TracePointSampler(const TracePointSamplingPolicy sampling_policy) noexcept
+    : sampling_policy_{sampling_policy}, is_unlimited_{IsUnlimited(sampling_policy)}
+{
+}
+
+TracePointSampler::TracePointSampler(const TracePointSampler& other) noexcept
+    : sampling_policy_{other.sampling_policy_},
+      is_unlimited_{other.is_unlimited_},
+      call_counter_{other.call_counter_.load(std::memory_order_relaxed)},
+      traced_in_window_{other.traced_in_window_.load(std::memory_order_relaxed)},
+      window_start_{other.window_start_.load(std::memory_order_relaxed)},
+      skipped_calls_{other.skipped_calls_.load(std::memory_order_relaxed)}
+{
+}
+
+TracePointSampler& TracePointSampler::operator=(const TracePointSampler& other) noexcept
+{
+    if (this != &other)
+    {
+        sampling_policy_ = other.sampling_policy_;
+        is_unlimited_ = other.is_unlimited_;
+        call_counter_.store(other.call_counter_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        traced_in_window_.store(other.traced_in_window_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        window_start_.store(other.window_start_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        skipped_calls_.store(other.skipped_calls_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+TracePointSampler::TracePointSampler(TracePointSampler&& other) noexcept
+    : TracePointSampler{static_cast<const TracePointSampler&>(other)}
+{
+}
+
+TracePointSampler& TracePointSampler::operator=(TracePointSampler&& other) noexcept
+{
+    return operator=(static_cast<const TracePointSampler&>(other));
+}
+
+bool operator==(const TracePointSampler& lhs, const TracePointSampler& rhs) noexcept
+{
+    // Two samplers are considered equal, if they apply the same policy. Their run-time counters are not compared.
+    return (lhs.GetSamplingPolicy() == rhs.GetSamplingPolicy());
+}
+
+}  // namespace score::mw::com::impl::tracing
@@ -0,0 +1,132 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_SAMPLER_H
+#define SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_SAMPLER_H
+
+#include "score/mw/com/impl/tracing/configuration/trace_point_sampling_policy.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace score::mw::com::impl::tracing
+{
+
+/// \brief Decides on each call of an enabled trace point, whether the call shall be traced according to a
+///        TracePointSamplingPolicy.
+/// \details The sampler is evaluated on the hot path before any trace data is extracted, so that skipped calls neither
+///          call into the tracing runtime nor occupy a tracing slot. Its counters are atomics (relaxed ordering), since
+///          e.g. Send() on the same skeleton event may be called concurrently from different threads. Concurrent calls
+///          may see a slightly imprecise 1-second window, but every call is counted exactly once. The clock is only
+///          read for policies with a max_per_second limit and only for calls, which passed the 1-in-N filter.
+class TracePointSampler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \brief Creates a sampler, which lets every call pass.
+    TracePointSampler() noexcept = default;
+    explicit TracePointSampler(const TracePointSamplingPolicy sampling_policy) noexcept;
+
+    ~TracePointSampler() noexcept = default;
+
+    /// \brief Copies the policy and a snapshot of the run-time counters.
+    TracePointSampler(const TracePointSampler& other) noexcept;
+    TracePointSampler& operator=(const TracePointSampler& other) noexcept;
+    TracePointSampler(TracePointSampler&& other) noexcept;
+    TracePointSampler& operator=(TracePointSampler&& other) noexcept;
+
+    /// \brief Returns whether the current call of the trace point shall be traced.
+    bool ShouldTrace() noexcept
+    {
+        if (is_unlimited_)
+        {
+            return true;
+        }
+        return ShouldTraceSampled([]() noexcept {
+            return Clock::now();
+        });
+    }
+
+    /// \brief Same as ShouldTrace(), but with the current time provided by the caller.
+    bool ShouldTrace(const Clock::time_point now) noexcept
+    {
+        if (is_unlimited_)
+        {
+            return true;
+        }
+        return ShouldTraceSampled([now]() noexcept {
+            return now;
+        });
+    }
+
+    const TracePointSamplingPolicy& GetSamplingPolicy() const noexcept
+    {
+        return sampling_policy_;
+    }
+
+    /// \brief Number of calls, which have not been traced due to the sampling policy.
+    std::uint64_t GetNumberOfSkippedCalls() const noexcept
+    {
+        return skipped_calls_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    template <typename NowProvider>
+    bool ShouldTraceSampled(const NowProvider& now_provider) noexcept
+    {
+        if (sampling_policy_.one_in_n > 1U)
+        {
+            const auto call_index = call_counter_.fetch_add(1U, std::memory_order_relaxed);
+            if ((call_index % sampling_policy_.one_in_n) != 0U)
+            {
+                skipped_calls_.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        if (sampling_policy_.max_per_second != 0U)
+        {
+            const auto now = now_provider().time_since_epoch().count();
+            auto window_start = window_start_.load(std::memory_order_relaxed);
+            if (((now - window_start) >= kWindowLength) &&
+                window_start_.compare_exchange_strong(window_start, now, std::memory_order_relaxed))
+            {
+                // only the caller, which opened the new window, resets its budget
+                traced_in_window_.store(0U, std::memory_order_relaxed);
+            }
+            if (traced_in_window_.fetch_add(1U, std::memory_order_relaxed) >= sampling_policy_.max_per_second)
+            {
+                skipped_calls_.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr Clock::rep kWindowLength{
+        std::chrono::duration_cast<Clock::duration>(std::chrono::seconds{1}).count()};
+
+    TracePointSamplingPolicy sampling_policy_{};
+    bool is_unlimited_{true};
+    std::atomic<std::uint64_t> call_counter_{0U};
+    std::atomic<std::uint32_t> traced_in_window_{0U};
+    std::atomic<Clock::rep> window_start_{0};
+    std::atomic<std::uint64_t> skipped_calls_{0U};
+};
+
+bool operator==(const TracePointSampler& lhs, const TracePointSampler& rhs) noexcept;
+
+}  // namespace score::mw::com::impl::tracing
+
+#endif  // SCORE_MW_COM_IMPL_TRACING_TRACE_POINT_SAMPLER_H
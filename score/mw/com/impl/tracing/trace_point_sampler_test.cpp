@@ -0,0 +1,211 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/tracing/trace_point_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::impl::tracing
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+const TracePointSampler::Clock::time_point kStartTime{TracePointSampler::Clock::duration{10s}};
+
+std::uint32_t CountTracedCalls(TracePointSampler& unit,
+                               const std::uint32_t number_of_calls,
+                               const TracePointSampler::Clock::time_point now)
+{
+    std::uint32_t traced_calls{0U};
+    for (std::uint32_t call = 0U; call < number_of_calls; ++call)
+    {
+        if (unit.ShouldTrace(now))
+        {
+            ++traced_calls;
+        }
+    }
+    return traced_calls;
+}
+
+TEST(TracePointSamplerTest, DefaultConstructedSamplerTracesEveryCall)
+{
+    // Given a default constructed sampler
+    TracePointSampler unit{};
+
+    // When calling it 1000 times
+    const auto traced_calls = CountTracedCalls(unit, 1000U, kStartTime);
+
+    // Then every call is traced
+    EXPECT_EQ(traced_calls, 1000U);
+    EXPECT_EQ(unit.GetNumberOfSkippedCalls(), 0U);
+}
+
+TEST(TracePointSamplerTest, OneInNTracesFirstAndEveryNthCall)
+{
+    // Given a sampler tracing every 10th call
+    TracePointSampler unit{TracePointSamplingPolicy{10U, 0U}};
+
+    // Then the first call is traced and the next 9 calls are skipped
+    EXPECT_TRUE(unit.ShouldTrace(kStartTime));
+    for (std::uint32_t call = 0U; call < 9U; ++call)
+    {
+        EXPECT_FALSE(unit.ShouldTrace(kStartTime));
+    }
+    // and the 11th call is traced again
+    EXPECT_TRUE(unit.ShouldTrace(kStartTime));
+}
+
+TEST(TracePointSamplerTest, OneInNTracesExpectedFractionOfCalls)
+{
+    // Given a sampler tracing every 4th call
+    TracePointSampler unit{TracePointSamplingPolicy{4U, 0U}};
+
+    // When calling it 1000 times
+    const auto traced_calls = CountTracedCalls(unit, 1000U, kStartTime);
+
+    // Then a quarter of the calls is traced
+    EXPECT_EQ(traced_calls, 250U);
+    EXPECT_EQ(unit.GetNumberOfSkippedCalls(), 750U);
+}
+
+TEST(TracePointSamplerTest, MaxPerSecondLimitsTracedCallsWithinOneSecond)
+{
+    // Given a sampler tracing at most 100 calls per second
+    TracePointSampler unit{TracePointSamplingPolicy{1U, 100U}};
+
+    // When calling it 1000 times within the same second
+    const auto traced_calls = CountTracedCalls(unit, 1000U, kStartTime);
+
+    // Then only 100 calls are traced
+    EXPECT_EQ(traced_calls, 100U);
+    EXPECT_EQ(unit.GetNumberOfSkippedCalls(), 900U);
+}
+
+TEST(TracePointSamplerTest, MaxPerSecondBudgetIsRefilledAfterOneSecond)
+{
+    // Given a sampler tracing at most 2 calls per second, which has used up its budget
+    TracePointSampler unit{TracePointSamplingPolicy{1U, 2U}};
+    ASSERT_EQ(CountTracedCalls(unit, 5U, kStartTime), 2U);
+
+    // When calling it again before a second has passed
+    // Then the call is skipped
+    EXPECT_FALSE(unit.ShouldTrace(kStartTime + 999ms));
+
+    // When calling it again after a second has passed
+    // Then the budget is available again
+    EXPECT_EQ(CountTracedCalls(unit, 5U, kStartTime + 1s), 2U);
+}
+
+TEST(TracePointSamplerTest, OneInNIsAppliedBeforeMaxPerSecond)
+{
+    // Given a sampler tracing every 10th call but at most 5 calls per second
+    TracePointSampler unit{TracePointSamplingPolicy{10U, 5U}};
+
+    // When calling it 1000 times within the same second
+    const auto traced_calls = CountTracedCalls(unit, 1000U, kStartTime);
+
+    // Then only 5 calls are traced, although 100 calls passed the 1-in-N filter
+    EXPECT_EQ(traced_calls, 5U);
+
+    // and after one second the next candidate of the 1-in-N filter is traced again
+    EXPECT_EQ(CountTracedCalls(unit, 10U, kStartTime + 1s), 1U);
+}
+
+TEST(TracePointSamplerTest, ConcurrentCallsAreCountedExactlyOnce)
+{
+    // Given a sampler tracing every 10th call, which is shared by 4 threads (like concurrent Send() calls)
+    TracePointSampler unit{TracePointSamplingPolicy{10U, 0U}};
+    std::atomic<std::uint32_t> traced_calls{0U};
+
+    // When every thread calls it 1000 times
+    std::vector<std::thread> threads{};
+    for (std::uint32_t thread = 0U; thread < 4U; ++thread)
+    {
+        threads.emplace_back([&unit, &traced_calls]() {
+            traced_calls += CountTracedCalls(unit, 1000U, kStartTime);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then exactly every 10th of all the calls has been traced
+    EXPECT_EQ(traced_calls.load(), 400U);
+    EXPECT_EQ(unit.GetNumberOfSkippedCalls(), 3600U);
+}
+
+TEST(TracePointSamplerTest, ConcurrentCallsDoNotExceedMaxPerSecond)
+{
+    // Given a sampler tracing at most 100 calls per second, which is shared by 4 threads and whose current 1-second
+    // window has been opened by a first traced call
+    TracePointSampler unit{TracePointSamplingPolicy{1U, 100U}};
+    ASSERT_TRUE(unit.ShouldTrace(kStartTime));
+    std::atomic<std::uint32_t> traced_calls{1U};
+
+    // When every thread calls it 1000 times within the same second
+    std::vector<std::thread> threads{};
+    for (std::uint32_t thread = 0U; thread < 4U; ++thread)
+    {
+        threads.emplace_back([&unit, &traced_calls]() {
+            traced_calls += CountTracedCalls(unit, 1000U, kStartTime);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Then exactly the budget has been traced
+    EXPECT_EQ(traced_calls.load(), 100U);
+    EXPECT_EQ(unit.GetNumberOfSkippedCalls(), 3901U);
+}
+
+TEST(TracePointSamplerTest, CopyTakesOverPolicyAndCounters)
+{
+    // Given a sampler tracing every 4th call, which has already been called twice
+    TracePointSampler unit{TracePointSamplingPolicy{4U, 0U}};
+    static_cast<void>(CountTracedCalls(unit, 2U, kStartTime));
+
+    // When copying it
+    TracePointSampler copy{unit};
+
+    // Then the copy continues the 1-in-N sequence of the original
+    EXPECT_EQ(copy.GetNumberOfSkippedCalls(), 1U);
+    EXPECT_EQ(CountTracedCalls(copy, 2U, kStartTime), 0U);
+    EXPECT_TRUE(copy.ShouldTrace(kStartTime));
+}
+
+TEST(TracePointSamplerTest, SamplersWithSamePolicyCompareEqual)
+{
+    // Given two samplers with the same policy, of which one has already been used
+    TracePointSampler first{TracePointSamplingPolicy{3U, 7U}};
+    const TracePointSampler second{TracePointSamplingPolicy{3U, 7U}};
+    static_cast<void>(CountTracedCalls(first, 10U, kStartTime));
+
+    // Then they compare equal
+    EXPECT_EQ(first, second);
+
+    // and a sampler with a different policy compares unequal
+    EXPECT_FALSE(first == TracePointSampler{});
+}
+
+}  // namespace
+}  // namespace score::mw::com::impl::tracing
@@ -171,7 +171,7 @@ analysis::tracing::TracePointType InternalToExternalTracePointType(
 }
 
 analysis::tracing::AraComMetaInfo CreateMetaInfo(
-    const ServiceElementInstanceIdentifierView& service_element_instance_identifier,
+    const analysis::tracing::ServiceInstanceElement& service_instance_element,
     const TracingRuntime::TracePointType& trace_point_type,
     const std::optional<TracingRuntime::TracePointDataId> trace_point_data_id,
     const IBindingTracingRuntime& binding_runtime) noexcept
@@ -181,9 +181,7 @@ analysis::tracing::AraComMetaInfo CreateMetaInfo(
     const score::cpp::optional<TracingRuntime::TracePointDataId> converted_trace_point_data_id =
         trace_point_data_id.has_value() ? score::cpp::make_optional(*trace_point_data_id) : score::cpp::nullopt;
     analysis::tracing::AraComMetaInfo result{analysis::tracing::AraComProperties(
-        ext_trace_point_type,
-        binding_runtime.ConvertToTracingServiceInstanceElement(service_element_instance_identifier),
-        converted_trace_point_data_id)};
+        ext_trace_point_type, service_instance_element, converted_trace_point_data_id)};
     if (binding_runtime.GetDataLossFlag())
     {
         result.SetDataLossBit();
@@ -191,6 +189,18 @@ analysis::tracing::AraComMetaInfo CreateMetaInfo(
     return result;
 }
 
+analysis::tracing::AraComMetaInfo CreateMetaInfo(
+    const ServiceElementInstanceIdentifierView& service_element_instance_identifier,
+    const TracingRuntime::TracePointType& trace_point_type,
+    const std::optional<TracingRuntime::TracePointDataId> trace_point_data_id,
+    const IBindingTracingRuntime& binding_runtime) noexcept
+{
+    return CreateMetaInfo(binding_runtime.ConvertToTracingServiceInstanceElement(service_element_instance_identifier),
+                          trace_point_type,
+                          trace_point_data_id,
+                          binding_runtime);
+}
+
 }  // namespace
 
 namespace detail_tracing_runtime
@@ -502,6 +512,43 @@ Result<analysis::tracing::ShmObjectHandle> TracingRuntime::GetRegisteredShmObjec
     return std::move(shm_object_handle.value());
 }
 
+// coverity[autosar_cpp14_a15_4_2_violation: FALSE] see justification of autosar_cpp14_a15_5_3_violation for Trace()
+// coverity[autosar_cpp14_a15_5_3_violation: FALSE] see justification of autosar_cpp14_a15_5_3_violation for Trace()
+Result<IBindingTracingRuntime::ShmTraceHandle> TracingRuntime::GetShmTraceHandle(
+    IBindingTracingRuntime& binding_runtime,
+    const ServiceElementTracingData service_element_tracing_data,
+    const ServiceElementInstanceIdentifierView service_element_instance_identifier) noexcept
+{
+    auto cached_shm_trace_handle = binding_runtime.GetShmTraceHandle(service_element_tracing_data);
+    if (cached_shm_trace_handle.has_value())
+    {
+        return std::move(cached_shm_trace_handle.value());
+    }
+
+    // Read before resolving, so that a concurrent (re-)registration or unregistration of a shm-object invalidates the
+    // handle resolved here.
+    const auto shm_object_registration_generation = binding_runtime.GetShmObjectRegistrationGeneration();
+    const auto shm_object_handle = GetRegisteredShmObject(binding_runtime, service_element_instance_identifier);
+    if (!shm_object_handle.has_value())
+    {
+        return MakeUnexpected<IBindingTracingRuntime::ShmTraceHandle>(shm_object_handle.error());
+    }
+
+    const auto shm_region_start = binding_runtime.GetShmRegionStartAddress(service_element_instance_identifier);
+    // a valid shm_object_handle ... a shm_region_start should also exist!
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
+        shm_region_start.has_value(),
+        "No shared-memory-region start address for shm-object in tracing runtime binding!");
+
+    const IBindingTracingRuntime::ShmTraceHandle shm_trace_handle{
+        shm_object_handle.value(),
+        shm_region_start.value(),
+        binding_runtime.ConvertToTracingServiceInstanceElement(service_element_instance_identifier)};
+    binding_runtime.CacheShmTraceHandle(
+        service_element_tracing_data, shm_trace_handle, shm_object_registration_generation);
+    return shm_trace_handle;
+}
+
 // Suppress "AUTOSAR C++14 A15-5-3" rule findings. This rule states: "The std::terminate() function shall not be called
 // implicitly". This is a false positive, all results which are accessed with '.value()' that could implicitly call
 // 'std::terminate()' (in case it doesn't have value) has a check in advance using '.has_value()', so no way for
@@ -523,29 +570,25 @@ Result<void> TracingRuntime::Trace(const BindingType binding_type,
     }
     auto& binding_runtime = GetBindingTracingRuntime(binding_type);
 
-    auto shm_object_handle = GetRegisteredShmObject(binding_runtime, service_element_instance_identifier);
-    if (!shm_object_handle.has_value())
+    const auto shm_trace_handle =
+        GetShmTraceHandle(binding_runtime, service_element_tracing_data, service_element_instance_identifier);
+    if (!shm_trace_handle.has_value())
     {
         // Suppress "AUTOSAR C++14 A7-2-1" rule finding. This rule states: "An expression with enum underlying type
         // shall only have values corresponding to the enumerators of the enumeration.".
         // The underlying error code can be only of GetRegisteredShmObject type
         // coverity[autosar_cpp14_a7_2_1_violation]
-        return MakeUnexpected(static_cast<TraceErrorCode>(*shm_object_handle.error()));
+        return MakeUnexpected(static_cast<TraceErrorCode>(*shm_trace_handle.error()));
     }
 
-    const auto shm_region_start = binding_runtime.GetShmRegionStartAddress(service_element_instance_identifier);
-    // a valid shm_object_handle ... a shm_region_start should also exist!
-    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(
-        shm_region_start.has_value(),
-        "No shared-memory-region start address for shm-object in tracing runtime binding!");
-
-    const auto meta_info =
-        CreateMetaInfo(service_element_instance_identifier, trace_point_type, trace_point_data_id, binding_runtime);
+    const auto meta_info = CreateMetaInfo(
+        shm_trace_handle.value().service_instance_element, trace_point_type, trace_point_data_id, binding_runtime);
 
     // Create ShmChunkList
     analysis::tracing::SharedMemoryLocation root_chunk_memory_location{
-        shm_object_handle.value(),
-        static_cast<size_t>(memory::shared::SubtractPointersBytes(shm_data_ptr, shm_region_start.value()))};
+        shm_trace_handle.value().shm_object_handle,
+        static_cast<size_t>(
+            memory::shared::SubtractPointersBytes(shm_data_ptr, shm_trace_handle.value().shm_region_start))};
     analysis::tracing::SharedMemoryChunk root_chunk{root_chunk_memory_location, shm_data_size};
     analysis::tracing::ShmDataChunkList chunk_list{root_chunk};
 
@@ -175,6 +175,14 @@ class TracingRuntime : public ITracingRuntime
         IBindingTracingRuntime& binding_runtime,
         const ServiceElementInstanceIdentifierView service_element_instance_identifier) noexcept;
 
+    /// \brief Returns the ShmTraceHandle of the service element from the cache of the binding specific tracing runtime.
+    ///        Only if it isn't cached (yet), it gets resolved from the registered shm-object (including a retry of a
+    ///        failed registration) and stored in the cache for subsequent Trace() calls.
+    Result<IBindingTracingRuntime::ShmTraceHandle> GetShmTraceHandle(
+        IBindingTracingRuntime& binding_runtime,
+        const ServiceElementTracingData service_element_tracing_data,
+        const ServiceElementInstanceIdentifierView service_element_instance_identifier) noexcept;
+
     std::unordered_map<BindingType, IBindingTracingRuntime*> binding_tracing_runtimes_;
 
     /// \brief Threshold for switching from LogInfo to LogDebug level during consecutive failures
@@ -239,6 +239,82 @@ TEST_P(TracingRuntimeTraceShmParamaterisedFixture, CallingTraceDispatchesToBindi
     EXPECT_TRUE(result.has_value());
 }
 
+TEST_P(TracingRuntimeTraceShmParamaterisedFixture, CallingTraceCachesResolvedShmTraceHandleInBinding)
+{
+    // given a UuT which delegates to a mock IBindingTracingRuntime in case of BindingType::kLoLa, which has no cached
+    // ShmTraceHandle for the service element
+    SetupBindingTracingRuntimeMockForShmDataTraceCall();
+    EXPECT_CALL(binding_tracing_runtime_mock_, GetShmTraceHandle(service_element_tracing_data_))
+        .WillOnce(Return(std::optional<IBindingTracingRuntime::ShmTraceHandle>{}));
+
+    // and whose shm-object registrations are in a given generation
+    const IBindingTracingRuntime::ShmObjectRegistrationGeneration shm_object_registration_generation{5U};
+    EXPECT_CALL(binding_tracing_runtime_mock_, GetShmObjectRegistrationGeneration())
+        .WillOnce(Return(shm_object_registration_generation));
+
+    // expect, that the ShmTraceHandle resolved from the registered shm-object gets cached for the service element
+    // together with the generation, which was read before resolving it
+    EXPECT_CALL(binding_tracing_runtime_mock_,
+                CacheShmTraceHandle(service_element_tracing_data_, _, shm_object_registration_generation))
+        .WillOnce(WithArg<1>(Invoke([this](const IBindingTracingRuntime::ShmTraceHandle& shm_trace_handle) {
+            EXPECT_EQ(shm_trace_handle.shm_object_handle, dummy_shm_object_handle_);
+            EXPECT_EQ(shm_trace_handle.shm_region_start, dummy_shm_object_start_address_);
+            EXPECT_EQ(shm_trace_handle.service_instance_element, kServiceInstanceElement);
+        })));
+    EXPECT_CALL(*generic_trace_api_mock_.get(), Trace(trace_client_id_, _, _, trace_context_id_))
+        .WillOnce(Return(analysis::tracing::TraceResult{}));
+
+    // when we call Trace on the UuT
+    auto result = unit_under_test_->Trace(BindingType::kLoLa,
+                                          service_element_tracing_data_,
+                                          dummy_service_element_instance_identifier_view_,
+                                          trace_point_type_,
+                                          dummy_data_id_,
+                                          CreateDummySamplePtr(),
+                                          dummy_shm_data_ptr_,
+                                          dummy_shm_data_size_);
+    EXPECT_TRUE(result.has_value());
+}
+
+TEST_P(TracingRuntimeTraceShmParamaterisedFixture, CallingTraceWithCachedShmTraceHandleSkipsShmObjectLookup)
+{
+    // given a UuT which delegates to a mock IBindingTracingRuntime in case of BindingType::kLoLa, which has a cached
+    // ShmTraceHandle for the service element
+    SetupBindingTracingRuntimeMockForShmDataTraceCall();
+    const IBindingTracingRuntime::ShmTraceHandle cached_shm_trace_handle{
+        dummy_shm_object_handle_, dummy_shm_object_start_address_, kServiceInstanceElement};
+    EXPECT_CALL(binding_tracing_runtime_mock_, GetShmTraceHandle(service_element_tracing_data_))
+        .WillOnce(Return(cached_shm_trace_handle));
+
+    // expect, that neither the shm-object nor the service instance element are looked up again
+    EXPECT_CALL(binding_tracing_runtime_mock_, GetShmObjectHandle(_)).Times(0);
+    EXPECT_CALL(binding_tracing_runtime_mock_, GetShmRegionStartAddress(_)).Times(0);
+    EXPECT_CALL(binding_tracing_runtime_mock_, ConvertToTracingServiceInstanceElement(_)).Times(0);
+    EXPECT_CALL(binding_tracing_runtime_mock_, CacheShmTraceHandle(_, _, _)).Times(0);
+
+    // and that the ShmDataChunkList is created from the cached ShmTraceHandle
+    analysis::tracing::SharedMemoryLocation root_chunk_memory_location{
+        dummy_shm_object_handle_,
+        static_cast<size_t>(
+            memory::shared::SubtractPointersBytes(dummy_shm_data_ptr_, dummy_shm_object_start_address_))};
+    analysis::tracing::SharedMemoryChunk root_chunk{root_chunk_memory_location, dummy_shm_data_size_};
+    analysis::tracing::ShmDataChunkList expected_shm_chunk_list{root_chunk};
+    EXPECT_CALL(*generic_trace_api_mock_.get(),
+                Trace(trace_client_id_, _, Eq(ByRef(expected_shm_chunk_list)), trace_context_id_))
+        .WillOnce(Return(analysis::tracing::TraceResult{}));
+
+    // when we call Trace on the UuT
+    auto result = unit_under_test_->Trace(BindingType::kLoLa,
+                                          service_element_tracing_data_,
+                                          dummy_service_element_instance_identifier_view_,
+                                          trace_point_type_,
+                                          dummy_data_id_,
+                                          CreateDummySamplePtr(),
+                                          dummy_shm_data_ptr_,
+                                          dummy_shm_data_size_);
+    EXPECT_TRUE(result.has_value());
+}
+
 TEST_P(TracingRuntimeTraceShmParamaterisedFixture, CallingTraceWillClearDataLossFlagOnSuccess)
 {
     RecordProperty("Verifies", "SCR-18398053");
@@ -36,6 +36,7 @@ class IRuntime
     virtual score::Result<InstanceIdentifierContainer> ResolveInstanceIDs(const InstanceSpecifier model_name) = 0;
     virtual void InitializeRuntime(const std::int32_t argc, score::cpp::span<const score::StringLiteral> argv) = 0;
     virtual void InitializeRuntime(const runtime::RuntimeConfiguration& runtime_configuration) = 0;
+    virtual score::Result<void> WriteStartupTimeline() = 0;
 
   protected:
     IRuntime(const IRuntime&) = default;
@@ -29,6 +29,7 @@ class RuntimeMock : public IRuntime
                 (const std::int32_t, score::cpp::span<const score::StringLiteral>),
                 (override));
     MOCK_METHOD(void, InitializeRuntime, (const runtime::RuntimeConfiguration&), (override));
+    MOCK_METHOD(score::Result<void>, WriteStartupTimeline, (), (override));
 };
 
 }  // namespace score::mw::com::runtime
@@ -118,5 +118,19 @@ TEST_F(RuntimeMockFixture, InitializeRuntimeWithRuntimeConfigurationDispatchesTo
     InitializeRuntime(runtime_configuration);
 }
 
+TEST_F(RuntimeMockFixture, WriteStartupTimelineDispatchesToMockAfterInjectingMock)
+{
+    // Given that a mocked runtime has been injected
+
+    // Expecting that WriteStartupTimeline will be called on the mock
+    EXPECT_CALL(runtime_mock_, WriteStartupTimeline()).WillOnce(Return(score::Result<void>{}));
+
+    // When calling WriteStartupTimeline
+    const auto result = WriteStartupTimeline();
+
+    // Then the result from the mock is returned
+    EXPECT_TRUE(result.has_value());
+}
+
 }  // namespace
 }  // namespace score::mw::com::runtime
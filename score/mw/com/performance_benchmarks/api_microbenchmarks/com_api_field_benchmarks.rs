@@ -0,0 +1,283 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+//! Benchmarks reading the current value of a field via the Rust COM API.
+//!
+//! Both variants answer "what is the current value" for the same 1 KiB `OdometerState`:
+//! - `event_emulation`: the value is sent as event, received via `try_receive()` and copied into a private latest
+//!   value, like Rust components emulated fields before field support was available
+//! - `field_current`: the value is updated as field and borrowed via `current()` directly from shared memory
+//!
+//! Each variant is measured once right after the value was updated (`updated`) and once without any update in between
+//! (`unchanged`), which is the common case of a field being read more often than it changes. Updating is not measured.
+
+use com_api::{
+    Builder, CommData, FieldPublisher, FieldSubscriber, FieldSubscription, FindServiceSpecifier,
+    InstanceSpecifier, Interface, LolaRuntimeBuilderImpl, Producer, ProviderInfo, Publisher, Reloc,
+    Runtime, RuntimeBuilder, SampleContainer, SampleMaybeUninit, SampleMut, ServiceDiscovery,
+    Subscriber, Subscription, interface,
+};
+use std::hint::black_box;
+use std::path::Path;
+use std::time::{Duration, Instant};
+
+const DEFAULT_CONFIG_PATH: &str = "score/mw/com/performance_benchmarks/api_microbenchmarks/config/mw_com_config_com_api_field.json";
+const INSTANCE_SPECIFIER: &str = "/Benchmark/Odometer/Instance";
+
+const WARM_UP_TIME: Duration = Duration::from_millis(500);
+const MEASUREMENT_TIME: Duration = Duration::from_secs(2);
+const NUMBER_OF_MEASUREMENTS: usize = 50;
+
+/// Has to match `OdometerState` in `com_api_field_interface.h`.
+#[derive(Debug, Clone, Reloc, CommData)]
+#[repr(C)]
+#[comm_data(id = "OdometerState")]
+pub struct OdometerState {
+    pub mileage: u64,
+    pub trip_history: [u64; 127],
+}
+
+impl OdometerState {
+    fn new(mileage: u64) -> Self {
+        Self {
+            mileage,
+            trip_history: [mileage; 127],
+        }
+    }
+}
+
+interface!(
+    interface Odometer {
+        Id = "OdometerInterface",
+        state_event: Event<OdometerState>,
+        state_field: Field<OdometerState>,
+    }
+);
+
+type LolaRuntime = com_api::LolaRuntimeImpl;
+type OdometerConsumer = <OdometerInterface as Interface>::Consumer<LolaRuntime>;
+type OdometerOfferedProducer =
+    <<OdometerInterface as Interface>::Producer<LolaRuntime> as Producer<LolaRuntime>>::OfferedProducer;
+type StateEventSubscription = <<LolaRuntime as Runtime>::Subscriber<OdometerState> as Subscriber<
+    OdometerState,
+    LolaRuntime,
+>>::Subscription;
+type StateFieldSubscription =
+    <<LolaRuntime as Runtime>::FieldSubscriber<OdometerState> as FieldSubscriber<
+        OdometerState,
+        LolaRuntime,
+    >>::Subscription;
+
+/// Consumer side of the event emulation: keeps a private copy of the latest received value.
+struct EmulatedField {
+    subscription: StateEventSubscription,
+    latest: Option<OdometerState>,
+}
+
+impl EmulatedField {
+    fn current(&mut self) -> Option<&OdometerState> {
+        let mut container = SampleContainer::new(1);
+        let count = self
+            .subscription
+            .try_receive(&mut container, 1)
+            .expect("try_receive failed");
+        if count > 0 {
+            let sample = container.pop_front().expect("Received sample is missing");
+            self.latest = Some((*sample).clone());
+        }
+        self.latest.as_ref()
+    }
+}
+
+/// Provider and consumer of the benchmarked interface, both living in this process.
+struct Fixture {
+    producer: OdometerOfferedProducer,
+    emulated_field: EmulatedField,
+    field: StateFieldSubscription,
+    mileage: u64,
+}
+
+impl Fixture {
+    fn new(runtime: &LolaRuntime) -> Self {
+        let instance_specifier =
+            InstanceSpecifier::new(INSTANCE_SPECIFIER).expect("Invalid instance specifier");
+
+        let producer = runtime
+            .producer_builder::<OdometerInterface>(instance_specifier.clone())
+            .build()
+            .expect("Failed to build producer");
+        producer
+            .state_field
+            .update(OdometerState::new(0))
+            .expect("Failed to set the initial field value");
+        let producer = producer.offer().expect("Failed to offer service");
+
+        let consumer: OdometerConsumer = runtime
+            .find_service::<OdometerInterface>(FindServiceSpecifier::Specific(instance_specifier))
+            .get_available_instances()
+            .expect("FindService failed")
+            .into_iter()
+            .next()
+            .expect("Offered service was not found")
+            .build()
+            .expect("Failed to build consumer");
+
+        // The event emulation holds one slot for the next value; the latest value is a private copy.
+        let emulated_field = EmulatedField {
+            subscription: consumer
+                .state_event
+                .subscribe(1)
+                .expect("Failed to subscribe to the event"),
+            latest: None,
+        };
+        let field = consumer
+            .state_field
+            .subscribe()
+            .expect("Failed to subscribe to the field");
+
+        Self {
+            producer,
+            emulated_field,
+            field,
+            mileage: 0,
+        }
+    }
+
+    /// Sends the next value as event and as field, the way a producer would update either of them.
+    fn update(&mut self) {
+        self.mileage += 1;
+        let value = OdometerState::new(self.mileage);
+        self.producer
+            .state_event
+            .allocate()
+            .expect("Failed to allocate event sample")
+            .write(value.clone())
+            .send()
+            .expect("Failed to send event sample");
+        self.producer
+            .state_field
+            .allocate()
+            .expect("Failed to allocate field sample")
+            .write(value)
+            .send()
+            .expect("Failed to send field sample");
+    }
+}
+
+fn read_event_emulation(fixture: &mut Fixture) -> u64 {
+    let value = fixture
+        .emulated_field
+        .current()
+        .expect("Event emulation has no value");
+    black_box(value.trip_history[126]);
+    value.mileage
+}
+
+fn read_field_current(fixture: &mut Fixture) -> u64 {
+    let value = fixture
+        .field
+        .current()
+        .expect("current failed")
+        .expect("Field has no value");
+    black_box(value.trip_history[126]);
+    value.mileage
+}
+
+/// Timing statistics in nanoseconds per read.
+struct Estimate {
+    min: f64,
+    median: f64,
+    mean: f64,
+    max: f64,
+}
+
+impl Estimate {
+    fn new(mut per_read_ns: Vec<f64>) -> Self {
+        per_read_ns.sort_by(f64::total_cmp);
+        let len = per_read_ns.len();
+        Self {
+            min: per_read_ns[0],
+            median: per_read_ns[len / 2],
+            mean: per_read_ns.iter().sum::<f64>() / len as f64,
+            max: per_read_ns[len - 1],
+        }
+    }
+}
+
+/// Runs one benchmark with a warm-up phase and NUMBER_OF_MEASUREMENTS measurements of equal iteration count.
+fn bench(fixture: &mut Fixture, name: &str, updated: bool, read: fn(&mut Fixture) -> u64) {
+    let mut run_iteration = |fixture: &mut Fixture| {
+        if updated {
+            fixture.update();
+        }
+        let start = Instant::now();
+        let mileage = read(fixture);
+        let elapsed = start.elapsed();
+        assert_eq!(mileage, fixture.mileage, "{name}: read an outdated value");
+        elapsed
+    };
+
+    // Both variants have to see the latest value before reading it unchanged.
+    fixture.update();
+    let warm_up_start = Instant::now();
+    let mut warm_up_iterations = 0_u64;
+    while warm_up_start.elapsed() < WARM_UP_TIME {
+        let _ = run_iteration(fixture);
+        warm_up_iterations += 1;
+    }
+
+    // Time spent for updating is not measured, so the iteration count is derived from the whole iteration time.
+    let iteration_time = warm_up_start.elapsed().as_secs_f64() / warm_up_iterations as f64;
+    let iterations = ((MEASUREMENT_TIME.as_secs_f64() / NUMBER_OF_MEASUREMENTS as f64)
+        / iteration_time)
+        .max(1.0) as u64;
+
+    let per_read_ns = (0..NUMBER_OF_MEASUREMENTS)
+        .map(|_| {
+            let elapsed: Duration = (0..iterations).map(|_| run_iteration(fixture)).sum();
+            elapsed.as_nanos() as f64 / iterations as f64
+        })
+        .collect();
+    let estimate = Estimate::new(per_read_ns);
+
+    let scenario = if updated { "updated" } else { "unchanged" };
+    println!(
+        "{:<32} time:   [{:.1} ns {:.1} ns {:.1} ns] per read, mean {:.1} ns",
+        format!("{name}/{scenario}"),
+        estimate.min,
+        estimate.median,
+        estimate.max,
+        estimate.mean
+    );
+}
+
+fn main() {
+    let config_path = std::env::args()
+        .nth(1)
+        .unwrap_or_else(|| DEFAULT_CONFIG_PATH.to_string());
+    let mut runtime_builder = LolaRuntimeBuilderImpl::new();
+    runtime_builder.load_config(Path::new(&config_path));
+    let runtime = runtime_builder.build().expect("Failed to build runtime");
+    let mut fixture = Fixture::new(&runtime);
+
+    println!("{:<32} time:   [min median max]", "benchmark/scenario");
+    for updated in [true, false] {
+        bench(
+            &mut fixture,
+            "event_emulation",
+            updated,
+            read_event_emulation,
+        );
+        bench(&mut fixture, "field_current", updated, read_field_current);
+    }
+}
@@ -0,0 +1,23 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/com_api_field_interface.h"
+#include "score/mw/com/impl/rust/com-api/com-api-ffi-lola/registry_bridge_macro.h"
+
+BEGIN_EXPORT_MW_COM_INTERFACE(OdometerInterface,
+                              ::score::mw::com::test::OdometerProxy,
+                              ::score::mw::com::test::OdometerSkeleton)
+EXPORT_MW_COM_EVENT(::score::mw::com::test::OdometerState, state_event)
+EXPORT_MW_COM_FIELD(::score::mw::com::test::OdometerState, state_field)
+END_EXPORT_MW_COM_INTERFACE()
+
+EXPORT_MW_COM_TYPE(OdometerState, ::score::mw::com::test::OdometerState)
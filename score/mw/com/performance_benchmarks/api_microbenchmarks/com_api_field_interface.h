@@ -0,0 +1,47 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_COM_API_FIELD_INTERFACE_H
+#define SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_COM_API_FIELD_INTERFACE_H
+
+#include "score/mw/com/types.h"
+
+#include <array>
+#include <cstdint>
+
+namespace score::mw::com::test
+{
+
+/// \brief Field value of the Rust COM API field benchmark, large enough for the copy of a value to be measurable.
+struct OdometerState
+{
+    std::uint64_t mileage;
+    std::array<std::uint64_t, 127> trip_history;
+};
+
+/// \brief Provides the same value once as event, like it is emulated by Rust components today, and once as field.
+template <typename Trait>
+class OdometerInterface : public Trait::Base
+{
+  public:
+    using Trait::Base::Base;
+
+    typename Trait::template Event<OdometerState> state_event{*this, "state_event"};
+    typename Trait::template Field<OdometerState, WithNotifier> state_field{*this, "state_field"};
+};
+
+using OdometerProxy = AsProxy<OdometerInterface>;
+using OdometerSkeleton = AsSkeleton<OdometerInterface>;
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_COM_API_FIELD_INTERFACE_H
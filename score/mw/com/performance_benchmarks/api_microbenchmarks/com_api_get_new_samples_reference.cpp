@@ -0,0 +1,52 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/example/com-api-example/com-api-gen/vehicle_gen.h"
+#include "score/mw/com/impl/proxy_event.h"
+#include "score/mw/com/impl/proxy_event_base.h"
+
+#include <score/assert.hpp>
+
+#include <cstdint>
+#include <limits>
+
+extern "C" {
+
+/// \brief C++ reference for the Rust receive benchmarks: receives the samples of a ProxyEvent<Tire> directly via
+///        GetNewSamples(), without any FFI transition per sample.
+/// \param event_ptr ProxyEventBase of a subscribed ProxyEvent<Tire>
+/// \param max_samples Maximum number of samples to receive
+/// \param pressure_sum Sum of the pressure of all received samples, so that the sample data is actually read
+/// \return Number of received samples, or uint32 max on error
+std::uint32_t mw_com_benchmark_get_new_samples(score::mw::com::impl::ProxyEventBase* event_ptr,
+                                              std::uint32_t max_samples,
+                                              float* pressure_sum) noexcept
+{
+    auto* const proxy_event = dynamic_cast<score::mw::com::impl::ProxyEvent<score::mw::com::Tire>*>(event_ptr);
+    SCORE_LANGUAGE_FUTURECPP_ASSERT_PRD_MESSAGE(proxy_event != nullptr, "Event is not a ProxyEvent<Tire>");
+
+    float sum{0.0F};
+    const auto result = proxy_event->GetNewSamples(
+        [&sum](score::mw::com::impl::SamplePtr<score::mw::com::Tire> sample) noexcept {
+            sum += sample->pressure;
+        },
+        max_samples);
+    *pressure_sum = sum;
+
+    if (!result.has_value())
+    {
+        return std::numeric_limits<std::uint32_t>::max();
+    }
+    return static_cast<std::uint32_t>(result.value());
+}
+
+}  // extern "C"
@@ -0,0 +1,317 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+//! Benchmarks the sample receive path of the Rust COM API across the FFI boundary.
+//!
+//! All variants receive, read and release the same `left_tire` samples of the example `VehicleInterface`:
+//! - `cpp_get_new_samples`: C++ `ProxyEvent<Tire>::GetNewSamples()` with a receiver reading the sample, as reference
+//! - `ffi_callback`: `get_samples_from_event()`, which calls back into a Rust closure once per sample
+//! - `ffi_batch`: `get_samples_from_event_batch()`, which moves all samples into a Rust array with a single FFI call
+//!
+//! Each iteration first sends `batch_size` samples (not measured) and then measures receiving all of them. Results are
+//! reported per received sample, the same way as a criterion `Throughput::Elements` group would report them.
+
+use bridge_ffi_lola::LolaFFIBridge;
+use bridge_ffi_rs::{
+    FFIBridge, FatPtr, InstanceSpecifier, ProxyBase, ProxyEventBase, SkeletonBase,
+    SkeletonEventBase, TypeOperationsManager,
+};
+use com_api_gen::Tire;
+use sample_ptr_rs::SamplePtr;
+use std::hint::black_box;
+use std::mem::MaybeUninit;
+use std::path::Path;
+use std::time::{Duration, Instant};
+
+const DEFAULT_CONFIG_PATH: &str = "score/mw/com/performance_benchmarks/api_microbenchmarks/config/mw_com_config_com_api_receive.json";
+const INSTANCE_SPECIFIER: &str = "/Benchmark/Vehicle/Instance";
+const INTERFACE_ID: &str = "VehicleInterface";
+const EVENT_ID: &str = "left_tire";
+
+/// Must not exceed the `numberOfSampleSlots` of `left_tire` in the benchmark configuration.
+const MAX_SAMPLES: usize = 32;
+const BATCH_SIZES: [usize; 4] = [1, 4, 16, 32];
+
+const WARM_UP_TIME: Duration = Duration::from_millis(500);
+const MEASUREMENT_TIME: Duration = Duration::from_secs(2);
+const NUMBER_OF_MEASUREMENTS: usize = 50;
+
+unsafe extern "C" {
+    /// Reference implementation in `com_api_get_new_samples_reference.cpp`.
+    fn mw_com_benchmark_get_new_samples(
+        event_ptr: *mut ProxyEventBase,
+        max_samples: u32,
+        pressure_sum: *mut f32,
+    ) -> u32;
+}
+
+/// Provider and consumer of the benchmarked event, both living in this process.
+struct Fixture {
+    bridge: LolaFFIBridge,
+    skeleton: *mut SkeletonBase,
+    skeleton_event: *mut SkeletonEventBase,
+    proxy: *mut ProxyBase,
+    proxy_event: *mut ProxyEventBase,
+    type_ops: TypeOperationsManager,
+}
+
+impl Fixture {
+    fn new(config_path: &Path) -> Self {
+        let bridge = LolaFFIBridge;
+        bridge.initialize(Some(config_path));
+
+        let instance_specifier =
+            InstanceSpecifier::try_from(INSTANCE_SPECIFIER).expect("Invalid instance specifier");
+        // SAFETY: the interface and event ids are plain strings, which are only looked up in the type registry.
+        let type_ops = unsafe { bridge.get_type_ops_instance(INTERFACE_ID, EVENT_ID) }
+            .expect("Type operations of left_tire are not registered");
+
+        // SAFETY: the instance specifier is alive for the duration of the call. All pointers passed to the bridge
+        // below have been checked for null after they were returned by the bridge.
+        let (skeleton, skeleton_event) = unsafe {
+            let skeleton = bridge.create_skeleton(INTERFACE_ID, instance_specifier.as_native());
+            assert!(!skeleton.is_null(), "Failed to create skeleton");
+            let skeleton_event = bridge.get_event_from_skeleton(skeleton, INTERFACE_ID, EVENT_ID);
+            assert!(!skeleton_event.is_null(), "Failed to get skeleton event");
+            assert!(
+                bridge.skeleton_offer_service(skeleton),
+                "Failed to offer service"
+            );
+            (skeleton, skeleton_event)
+        };
+
+        let handles = bridge
+            .find_service(instance_specifier.clone())
+            .expect("FindService failed");
+        let handle = handles.first().expect("Offered service was not found");
+
+        // SAFETY: see above.
+        let (proxy, proxy_event) = unsafe {
+            let proxy = bridge.create_proxy(INTERFACE_ID, handle);
+            assert!(!proxy.is_null(), "Failed to create proxy");
+            let proxy_event = bridge.get_event_from_proxy(proxy, INTERFACE_ID, EVENT_ID);
+            assert!(!proxy_event.is_null(), "Failed to get proxy event");
+            assert!(
+                bridge.subscribe_to_event(proxy_event, MAX_SAMPLES as u32),
+                "Failed to subscribe"
+            );
+            (proxy, proxy_event)
+        };
+
+        Self {
+            bridge,
+            skeleton,
+            skeleton_event,
+            proxy,
+            proxy_event,
+            type_ops,
+        }
+    }
+
+    fn send(&self, count: usize) {
+        for i in 0..count {
+            let sample = Tire { pressure: i as f32 };
+            // SAFETY: skeleton_event is valid for the lifetime of self and data points to a Tire.
+            let sent = unsafe {
+                self.bridge.skeleton_send_event(
+                    self.skeleton_event,
+                    &self.type_ops,
+                    &sample as *const Tire as *const std::ffi::c_void,
+                )
+            };
+            assert!(sent, "Failed to send sample");
+        }
+    }
+
+    /// Reads the data of a sample owned by the caller and releases the sample afterwards.
+    ///
+    /// # Safety
+    /// `sample` must point to an initialized `SamplePtr<Tire>`, which is not used anymore afterwards.
+    unsafe fn consume(&self, sample: *mut SamplePtr<Tire>) -> f32 {
+        // SAFETY: guaranteed by the caller.
+        unsafe {
+            let data = self
+                .bridge
+                .sample_ptr_get(sample as *const std::ffi::c_void, &self.type_ops)
+                as *const Tire;
+            let pressure = (*data).pressure;
+            self.bridge
+                .sample_ptr_delete(sample as *mut std::ffi::c_void, &self.type_ops);
+            pressure
+        }
+    }
+}
+
+impl Drop for Fixture {
+    fn drop(&mut self) {
+        // SAFETY: all pointers were created by the bridge in Fixture::new() and are not used afterwards.
+        unsafe {
+            self.bridge.unsubscribe_to_event(self.proxy_event);
+            self.bridge.destroy_proxy(self.proxy);
+            self.bridge.skeleton_stop_offer_service(self.skeleton);
+            self.bridge.destroy_skeleton(self.skeleton);
+        }
+    }
+}
+
+fn receive_cpp_get_new_samples(fixture: &Fixture, batch_size: usize) -> usize {
+    let mut pressure_sum = 0.0_f32;
+    // SAFETY: proxy_event is a valid, subscribed ProxyEvent<Tire>.
+    let count = unsafe {
+        mw_com_benchmark_get_new_samples(fixture.proxy_event, batch_size as u32, &mut pressure_sum)
+    };
+    black_box(pressure_sum);
+    count as usize
+}
+
+fn receive_ffi_callback(fixture: &Fixture, batch_size: usize) -> usize {
+    let mut pressure_sum = 0.0_f32;
+    let mut callback = |raw_sample: *mut SamplePtr<Tire>| {
+        // SAFETY: the sample is moved from the FFI callback argument into Rust ownership here, like the runtime does.
+        let mut sample = unsafe { std::ptr::read(raw_sample) };
+        // SAFETY: sample was initialized above and is not used after consume().
+        pressure_sum += unsafe { fixture.consume(&mut sample) };
+    };
+    let dyn_callback: &mut dyn FnMut(*mut SamplePtr<Tire>) = &mut callback;
+    // SAFETY: a closure reference has the same representation as FatPtr.
+    let fat_ptr: FatPtr = unsafe { std::mem::transmute(dyn_callback) };
+    // SAFETY: proxy_event is a valid, subscribed ProxyEvent<Tire>; the callback outlives the call.
+    let count = unsafe {
+        fixture.bridge.get_samples_from_event(
+            fixture.proxy_event,
+            &fixture.type_ops,
+            &fat_ptr,
+            batch_size as u32,
+        )
+    };
+    black_box(pressure_sum);
+    count as usize
+}
+
+fn receive_ffi_batch(
+    fixture: &Fixture,
+    samples: &mut [MaybeUninit<SamplePtr<Tire>>],
+    batch_size: usize,
+) -> usize {
+    // SAFETY: proxy_event is a valid, subscribed ProxyEvent<Tire> and samples has room for batch_size SamplePtr<Tire>.
+    let count = unsafe {
+        fixture.bridge.get_samples_from_event_batch(
+            fixture.proxy_event,
+            &fixture.type_ops,
+            samples.as_mut_ptr() as *mut std::ffi::c_void,
+            batch_size as u32,
+        )
+    } as usize;
+    assert!(count <= batch_size, "Bulk receive failed");
+    let mut pressure_sum = 0.0_f32;
+    for sample in &mut samples[..count] {
+        // SAFETY: the first count elements were initialized by the bulk receive and are consumed exactly once.
+        pressure_sum += unsafe { fixture.consume(sample.as_mut_ptr()) };
+    }
+    black_box(pressure_sum);
+    count
+}
+
+/// Timing statistics in nanoseconds per received sample.
+struct Estimate {
+    min: f64,
+    median: f64,
+    mean: f64,
+    max: f64,
+}
+
+impl Estimate {
+    fn new(mut per_sample_ns: Vec<f64>) -> Self {
+        per_sample_ns.sort_by(f64::total_cmp);
+        let len = per_sample_ns.len();
+        Self {
+            min: per_sample_ns[0],
+            median: per_sample_ns[len / 2],
+            mean: per_sample_ns.iter().sum::<f64>() / len as f64,
+            max: per_sample_ns[len - 1],
+        }
+    }
+}
+
+/// Runs one benchmark with a warm-up phase and NUMBER_OF_MEASUREMENTS measurements of equal iteration count.
+fn bench(
+    fixture: &Fixture,
+    name: &str,
+    batch_size: usize,
+    mut receive: impl FnMut(&Fixture, usize) -> usize,
+) {
+    let mut run_iteration = || {
+        fixture.send(batch_size);
+        let start = Instant::now();
+        let count = receive(fixture, batch_size);
+        let elapsed = start.elapsed();
+        assert_eq!(
+            count, batch_size,
+            "{name}: received {count} of {batch_size} samples"
+        );
+        elapsed
+    };
+
+    let warm_up_start = Instant::now();
+    let mut warm_up_iterations = 0_u64;
+    while warm_up_start.elapsed() < WARM_UP_TIME {
+        let _ = run_iteration();
+        warm_up_iterations += 1;
+    }
+
+    // Time spent for sending is not measured, so the iteration count is derived from the whole iteration time.
+    let iteration_time = warm_up_start.elapsed().as_secs_f64() / warm_up_iterations as f64;
+    let iterations = ((MEASUREMENT_TIME.as_secs_f64() / NUMBER_OF_MEASUREMENTS as f64)
+        / iteration_time)
+        .max(1.0) as u64;
+
+    let per_sample_ns = (0..NUMBER_OF_MEASUREMENTS)
+        .map(|_| {
+            let elapsed: Duration = (0..iterations).map(|_| run_iteration()).sum();
+            elapsed.as_nanos() as f64 / (iterations as usize * batch_size) as f64
+        })
+        .collect();
+    let estimate = Estimate::new(per_sample_ns);
+
+    println!(
+        "{:<32} time:   [{:.1} ns {:.1} ns {:.1} ns] per sample, mean {:.1} ns, thrpt: {:.3} Melem/s",
+        format!("{name}/{batch_size}"),
+        estimate.min,
+        estimate.median,
+        estimate.max,
+        estimate.mean,
+        1.0e3 / estimate.median
+    );
+}
+
+fn main() {
+    let config_path = std::env::args()
+        .nth(1)
+        .unwrap_or_else(|| DEFAULT_CONFIG_PATH.to_string());
+    let fixture = Fixture::new(Path::new(&config_path));
+    let mut samples: Box<[MaybeUninit<SamplePtr<Tire>>]> = Box::new_uninit_slice(MAX_SAMPLES);
+
+    println!("{:<32} time:   [min median max]", "benchmark/batch_size");
+    for batch_size in BATCH_SIZES {
+        bench(
+            &fixture,
+            "cpp_get_new_samples",
+            batch_size,
+            receive_cpp_get_new_samples,
+        );
+        bench(&fixture, "ffi_callback", batch_size, receive_ffi_callback);
+        bench(&fixture, "ffi_batch", batch_size, |fixture, batch_size| {
+            receive_ffi_batch(fixture, &mut samples, batch_size)
+        });
+    }
+}
@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/deferred_logger.h"
+
+#include "score/concurrency/long_running_threads_container.h"
+#include "score/mw/log/log_level.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+using impl::DeferrableLogStream;
+using impl::DeferredLogger;
+
+constexpr std::size_t kRecordsPerThread{256U};
+
+/// \brief Logs a burst of warnings like the ones a reception thread of the binding logs, e.g. on a notification for an
+///        event without registered handlers.
+void LogBurstOfBindingWarnings(DeferredLogger& logger, const std::size_t burst_size, const std::string& event_id)
+{
+    for (std::size_t message = 0U; message < burst_size; ++message)
+    {
+        DeferrableLogStream{logger, mw::log::LogLevel::kWarn, "lola"}
+            << "MessagePassingService: Received NotifyEventUpdateMessage for event: " << event_id << " from node "
+            << std::int32_t{4711} << " although we don't have currently any registered handlers. Might be an acceptable "
+                                     "race, if it happens seldom!";
+    }
+}
+
+void ReportCounters(benchmark::State& state, const DeferredLogger& logger)
+{
+    const auto burst_size = static_cast<std::int64_t>(state.range(0));
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * burst_size);
+    state.counters["dropped"] = static_cast<double>(logger.GetDroppedRecordCount());
+    state.counters["truncated"] = static_cast<double>(logger.GetTruncatedRecordCount());
+}
+
+}  // namespace
+
+/// \brief Caller side latency of a burst of warnings, which are formatted and logged directly on the calling thread.
+void BM_DirectBindingWarningBurst(benchmark::State& state)
+{
+    DeferredLogger logger{};
+    const std::string event_id{"ElementFqId{S:1, E:2, I:3, T:0}"};
+    const auto burst_size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        LogBurstOfBindingWarnings(logger, burst_size, event_id);
+    }
+    ReportCounters(state, logger);
+}
+
+/// \brief Caller side latency of a burst of warnings, which are written into the ring of the calling thread and output
+///        by the drain task. The rings get flushed between two bursts without being measured, so that every burst
+///        starts with an empty ring like after a quiet period.
+void BM_DeferredBindingWarningBurst(benchmark::State& state)
+{
+    concurrency::LongRunningThreadsContainer long_running_threads{};
+    DeferredLogger logger{};
+    logger.Enable(kRecordsPerThread);
+    logger.StartDrainTask(long_running_threads);
+    const std::string event_id{"ElementFqId{S:1, E:2, I:3, T:0}"};
+    const auto burst_size = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        LogBurstOfBindingWarnings(logger, burst_size, event_id);
+
+        state.PauseTiming();
+        benchmark::DoNotOptimize(logger.Flush());
+        state.ResumeTiming();
+    }
+    logger.Disable();
+    ReportCounters(state, logger);
+}
+
+BENCHMARK(BM_DirectBindingWarningBurst)->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DeferredBindingWarningBurst)->Arg(16)->Arg(64)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+}  // namespace score::mw::com::test
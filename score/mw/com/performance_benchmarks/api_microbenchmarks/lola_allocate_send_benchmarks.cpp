@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/com/performance_benchmarks/api_microbenchmarks/lola_interface.h"
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/perf_counters.h"
 #include "score/mw/com/runtime.h"
 #include "score/mw/com/runtime_configuration.h"
 #include "score/mw/com/types.h"
@@ -123,11 +124,15 @@ BENCHMARK_F(LolaAllocateSendBenchmarkFixture, AllocateSend)(benchmark::State& st
         }
     };
 
+    PerfCounters perf_counters{};
+    perf_counters.Start();
     for (auto _ : state)
     {
         std::ignore = _;
         allocate_send_sequence(*skeleton_);
     }
+    perf_counters.Stop();
+    ReportPerfCounters(perf_counters, state);
 }
 
 }  // namespace score::mw::com::test
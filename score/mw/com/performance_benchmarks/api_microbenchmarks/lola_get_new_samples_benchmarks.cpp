@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/com/performance_benchmarks/api_microbenchmarks/lola_interface.h"
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/perf_counters.h"
 #include "score/mw/com/runtime.h"
 #include "score/mw/com/runtime_configuration.h"
 #include "score/mw/com/types.h"
@@ -154,6 +155,8 @@ BENCHMARK_F(LolaGetNewSamplesBenchmarkFixture, GetNewSamples)(benchmark::State&
     score::cpp::stop_source stopper{};
     MakeSenderThread(stopper.get_token());
 
+    PerfCounters perf_counters{};
+    perf_counters.Start();
     for (auto ignore : state)
     {
         static_cast<void>(ignore);
@@ -164,6 +167,8 @@ BENCHMARK_F(LolaGetNewSamplesBenchmarkFixture, GetNewSamples)(benchmark::State&
             },
             kConfig.max_num_samples));
     }
+    perf_counters.Stop();
+    ReportPerfCounters(perf_counters, state);
 
     if (!stopper.stop_requested())
     {
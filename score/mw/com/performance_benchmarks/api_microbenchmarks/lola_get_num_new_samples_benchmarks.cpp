@@ -11,6 +11,7 @@
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
 #include "score/mw/com/performance_benchmarks/api_microbenchmarks/lola_interface.h"
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/perf_counters.h"
 #include "score/mw/com/runtime.h"
 #include "score/mw/com/runtime_configuration.h"
 #include "score/mw/com/types.h"
@@ -129,11 +130,15 @@ std::atomic<bool> LolaGetNumNewSamplesAvailableBenchmarkFixture::fixture_initial
 
 BENCHMARK_F(LolaGetNumNewSamplesAvailableBenchmarkFixture, GetNumNewSamplesAvailable)(benchmark::State& state)
 {
+    PerfCounters perf_counters{};
+    perf_counters.Start();
     for (auto ignore : state)
     {
         static_cast<void>(ignore);
         benchmark::DoNotOptimize(proxy_->test_event.GetNumNewSamplesAvailable());
     }
+    perf_counters.Stop();
+    ReportPerfCounters(perf_counters, state);
 }
 
 }  // namespace score::mw::com::test
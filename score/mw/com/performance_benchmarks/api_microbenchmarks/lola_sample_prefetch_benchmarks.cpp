@@ -0,0 +1,197 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/sample_prefetch.h"
+
+#include <score/utility.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <sys/mman.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+constexpr std::size_t kNumberOfSampleSlots{8U};
+constexpr std::size_t kSamplesPerCall{4U};
+constexpr std::size_t kMaxConsumedBytesPerSample{65536U};
+constexpr std::uint8_t kSampleValue{0xA5U};
+
+/// \brief Control slot of a sample, which gets referenced and dereferenced by the consumer like the EventSlotStatus in
+///        the control shm-object.
+struct alignas(impl::lola::kPrefetchCacheLineSize) ControlSlot
+{
+    std::atomic<std::uint64_t> status{0U};
+};
+
+/// \brief Sample slots of an event in a shared mapping, which a producer has written before, and their control slots.
+class EventSlots
+{
+  public:
+    explicit EventSlots(const std::size_t sample_size)
+        : sample_size_{sample_size}
+    {
+        data_ = ::mmap(nullptr, Size(), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (data_ == MAP_FAILED)
+        {
+            std::abort();
+        }
+        std::memset(data_, kSampleValue, Size());
+    }
+
+    ~EventSlots()
+    {
+        score::cpp::ignore = ::munmap(data_, Size());
+    }
+
+    EventSlots(const EventSlots&) = delete;
+    EventSlots(EventSlots&&) = delete;
+    EventSlots& operator=(const EventSlots&) = delete;
+    EventSlots& operator=(EventSlots&&) = delete;
+
+    /// \brief Flushes the consumed part of the kSamplesPerCall samples starting at first_slot from the CPU caches, like
+    ///        it happens, when the producer writes them on another core.
+    void EvictFromCache(const std::size_t first_slot) noexcept
+    {
+        for (std::size_t sample{0U}; sample < kSamplesPerCall; ++sample)
+        {
+            const auto* const sample_start = GetSample(first_slot + sample);
+            for (std::size_t offset{0U}; offset < GetConsumedBytesPerSample();
+                 offset += impl::lola::kPrefetchCacheLineSize)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset within the sample.
+                FlushCacheLine(&sample_start[offset]);
+            }
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        benchmark::ClobberMemory();
+    }
+
+    /// \brief The work of a GetNewSamples() call for kSamplesPerCall new samples starting at first_slot: Prefetch hints
+    ///        for all samples (if enabled), referencing the control slots and handing out the samples to the receiver,
+    ///        which reads the start of each sample.
+    std::uint64_t GetNewSamples(const std::size_t first_slot, const std::size_t prefetch_bytes) noexcept
+    {
+        if (prefetch_bytes > 0U)
+        {
+            for (std::size_t sample{0U}; sample < kSamplesPerCall; ++sample)
+            {
+                score::cpp::ignore =
+                    impl::lola::PrefetchSample(GetSample(first_slot + sample), sample_size_, prefetch_bytes);
+            }
+        }
+
+        std::uint64_t checksum{0U};
+        for (std::size_t sample{0U}; sample < kSamplesPerCall; ++sample)
+        {
+            const auto slot_index = (first_slot + sample) % kNumberOfSampleSlots;
+            score::cpp::ignore = control_slots_.at(slot_index).status.fetch_add(1U, std::memory_order_acq_rel);
+            checksum += Receive(GetSample(slot_index));
+            score::cpp::ignore = control_slots_.at(slot_index).status.fetch_sub(1U, std::memory_order_acq_rel);
+        }
+        return checksum;
+    }
+
+    std::size_t GetConsumedBytesPerSample() const noexcept
+    {
+        return std::min(sample_size_, kMaxConsumedBytesPerSample);
+    }
+
+  private:
+    static void FlushCacheLine(const std::uint8_t* const address) noexcept
+    {
+#if defined(__x86_64__)
+        _mm_clflush(address);
+#elif defined(__aarch64__)
+        asm volatile("dc civac, %0" : : "r"(address) : "memory");
+#else
+        score::cpp::ignore = address;
+#endif
+    }
+
+    std::size_t Size() const noexcept
+    {
+        return sample_size_ * kNumberOfSampleSlots;
+    }
+
+    const std::uint8_t* GetSample(const std::size_t slot) const noexcept
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) slot offset within the mapping.
+        return &static_cast<const std::uint8_t*>(data_)[sample_size_ * (slot % kNumberOfSampleSlots)];
+    }
+
+    /// \brief Receiver, which reads the first GetConsumedBytesPerSample() bytes of a sample.
+    std::uint64_t Receive(const std::uint8_t* const sample) const noexcept
+    {
+        std::uint64_t checksum{0U};
+        for (std::size_t offset{0U}; offset < GetConsumedBytesPerSample(); offset += sizeof(std::uint64_t))
+        {
+            std::uint64_t value{};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset within the sample.
+            std::memcpy(&value, &sample[offset], sizeof(value));
+            checksum += value;
+        }
+        return checksum;
+    }
+
+    std::size_t sample_size_;
+    void* data_{MAP_FAILED};
+    std::array<ControlSlot, kNumberOfSampleSlots> control_slots_{};
+};
+
+}  // namespace
+
+/// \brief Latency of a GetNewSamples() call, which hands out kSamplesPerCall samples, which are not in the CPU cache,
+///        to a receiver reading the start of each sample.
+void BM_GetNewSamplesWithPrefetch(benchmark::State& state)
+{
+    const auto sample_size = static_cast<std::size_t>(state.range(0));
+    const auto prefetch_bytes = static_cast<std::size_t>(state.range(1));
+    EventSlots event_slots{sample_size};
+    std::size_t first_slot{0U};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        first_slot = (first_slot + kSamplesPerCall) % kNumberOfSampleSlots;
+        event_slots.EvictFromCache(first_slot);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(event_slots.GetNewSamples(first_slot, prefetch_bytes));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(kSamplesPerCall * event_slots.GetConsumedBytesPerSample()));
+}
+
+// Sample sizes of 4 KiB, 64 KiB, 1 MiB and 5 MiB, each without prefetching and with a budget of 1 KiB, 4 KiB and
+// 64 KiB.
+BENCHMARK(BM_GetNewSamplesWithPrefetch)
+    ->ArgsProduct({{4096, 65536, 1048576, 5242880}, {0, 1024, 4096, 65536}})
+    ->ArgNames({"sample_size", "prefetch_bytes"})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace score::mw::com::test
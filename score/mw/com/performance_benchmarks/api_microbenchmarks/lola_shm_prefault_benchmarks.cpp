@@ -0,0 +1,175 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/bindings/lola/shm_prefault.h"
+#include "score/mw/com/impl/configuration/shm_prefault_mode.h"
+
+#include <score/utility.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+using impl::ShmPrefaultMode;
+
+constexpr const char* kShmName{"/lola_shm_prefault_benchmark"};
+constexpr std::uint8_t kSampleValue{0xA5U};
+
+/// \brief Freshly created shm-object for a single sample slot, which is mapped writable like by a skeleton and
+///        read-only like by a proxy. The pages of both mappings are pre-faulted (and locked) according to the given
+///        mode, like on skeleton PrepareOffer() and proxy creation.
+class FreshShmObject
+{
+  public:
+    FreshShmObject(const std::size_t size, const ShmPrefaultMode mode) : size_{size}
+    {
+        score::cpp::ignore = ::shm_unlink(kShmName);
+        file_descriptor_ = ::shm_open(kShmName, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if ((file_descriptor_ < 0) || (::ftruncate(file_descriptor_, static_cast<off_t>(size_)) != 0))
+        {
+            std::abort();
+        }
+        writer_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor_, 0);
+        reader_ = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, file_descriptor_, 0);
+        if ((writer_ == MAP_FAILED) || (reader_ == MAP_FAILED))
+        {
+            std::abort();
+        }
+        const auto writer_result = impl::lola::PrefaultMemory(mode, writer_, size_, kShmName);
+        const auto reader_result = impl::lola::PrefaultMemory(mode, reader_, size_, kShmName);
+        locked_bytes_ = writer_result.locked_bytes + reader_result.locked_bytes;
+    }
+
+    ~FreshShmObject()
+    {
+        score::cpp::ignore = ::munmap(writer_, size_);
+        score::cpp::ignore = ::munmap(reader_, size_);
+        score::cpp::ignore = ::close(file_descriptor_);
+        score::cpp::ignore = ::shm_unlink(kShmName);
+    }
+
+    FreshShmObject(const FreshShmObject&) = delete;
+    FreshShmObject(FreshShmObject&&) = delete;
+    FreshShmObject& operator=(const FreshShmObject&) = delete;
+    FreshShmObject& operator=(FreshShmObject&&) = delete;
+
+    /// \brief The first Allocate()/Send() of a sample writes the complete slot.
+    void SendFirstSample() noexcept
+    {
+        std::memset(writer_, kSampleValue, size_);
+    }
+
+    /// \brief The first GetNewSamples() reads the complete slot.
+    void ReceiveFirstSample(std::vector<std::uint8_t>& destination) const noexcept
+    {
+        std::memcpy(destination.data(), reader_, size_);
+    }
+
+    std::size_t GetLockedBytes() const noexcept
+    {
+        return locked_bytes_;
+    }
+
+  private:
+    std::size_t size_;
+    int file_descriptor_{-1};
+    void* writer_{MAP_FAILED};
+    void* reader_{MAP_FAILED};
+    std::size_t locked_bytes_{0U};
+};
+
+ShmPrefaultMode GetMode(const benchmark::State& state)
+{
+    return static_cast<ShmPrefaultMode>(state.range(1));
+}
+
+void ReportCounters(benchmark::State& state, const std::size_t locked_bytes)
+{
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    state.counters["locked_bytes"] = static_cast<double>(locked_bytes);
+}
+
+}  // namespace
+
+/// \brief Latency of writing the first sample into a sample slot of a freshly created shm-object.
+void BM_FirstSendLatency(benchmark::State& state)
+{
+    const auto slot_size = static_cast<std::size_t>(state.range(0));
+    std::unique_ptr<FreshShmObject> shm_object{};
+    std::size_t locked_bytes{0U};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        shm_object.reset();
+        shm_object = std::make_unique<FreshShmObject>(slot_size, GetMode(state));
+        locked_bytes = shm_object->GetLockedBytes();
+        state.ResumeTiming();
+
+        shm_object->SendFirstSample();
+        benchmark::ClobberMemory();
+    }
+    shm_object.reset();
+    ReportCounters(state, locked_bytes);
+}
+
+/// \brief Latency of reading the first sample from a sample slot of a freshly opened shm-object.
+void BM_FirstReceiveLatency(benchmark::State& state)
+{
+    const auto slot_size = static_cast<std::size_t>(state.range(0));
+    std::unique_ptr<FreshShmObject> shm_object{};
+    std::vector<std::uint8_t> received_sample(slot_size);
+    std::size_t locked_bytes{0U};
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        shm_object.reset();
+        shm_object = std::make_unique<FreshShmObject>(slot_size, GetMode(state));
+        shm_object->SendFirstSample();
+        locked_bytes = shm_object->GetLockedBytes();
+        state.ResumeTiming();
+
+        shm_object->ReceiveFirstSample(received_sample);
+        benchmark::DoNotOptimize(received_sample.data());
+        benchmark::ClobberMemory();
+    }
+    shm_object.reset();
+    ReportCounters(state, locked_bytes);
+}
+
+// Slot sizes of 4 KiB, 64 KiB and 1 MiB, each with ShmPrefaultMode kNone (0), kPrefault (1) and kPrefaultAndLock (2).
+BENCHMARK(BM_FirstSendLatency)
+    ->ArgsProduct({{4096, 65536, 1048576}, {0, 1, 2}})
+    ->ArgNames({"slot_size", "mode"})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_FirstReceiveLatency)
+    ->ArgsProduct({{4096, 65536, 1048576}, {0, 1, 2}})
+    ->ArgNames({"slot_size", "mode"})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace score::mw::com::test
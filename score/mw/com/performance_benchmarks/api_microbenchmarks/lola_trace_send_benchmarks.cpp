@@ -0,0 +1,208 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/binding_type.h"
+#include "score/mw/com/impl/bindings/lola/tracing/tracing_runtime.h"
+#include "score/mw/com/impl/configuration/configuration.h"
+#include "score/mw/com/impl/configuration/global_configuration.h"
+#include "score/mw/com/impl/configuration/lola_service_instance_deployment.h"
+#include "score/mw/com/impl/configuration/lola_service_type_deployment.h"
+#include "score/mw/com/impl/configuration/quality_type.h"
+#include "score/mw/com/impl/configuration/service_identifier_type.h"
+#include "score/mw/com/impl/configuration/service_instance_deployment.h"
+#include "score/mw/com/impl/configuration/service_type_deployment.h"
+#include "score/mw/com/impl/configuration/tracing_configuration.h"
+#include "score/mw/com/impl/instance_specifier.h"
+#include "score/mw/com/impl/service_element_type.h"
+#include "score/mw/com/impl/tracing/configuration/service_element_instance_identifier_view.h"
+#include "score/mw/com/impl/tracing/configuration/skeleton_event_trace_point_type.h"
+#include "score/mw/com/impl/tracing/service_element_tracing_data.h"
+#include "score/mw/com/impl/tracing/tracing_runtime.h"
+#include "score/mw/com/impl/tracing/type_erased_sample_ptr.h"
+
+#include "score/analysis/tracing/generic_trace_library/mock/trace_library_mock.h"
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::WithArg;
+
+constexpr std::string_view kServiceTypeName{"/test/lola/TracedService"};
+constexpr std::string_view kInstanceSpecifier{"test/lolatracebenchmark"};
+constexpr std::string_view kEventName{"traced_event"};
+constexpr std::uint16_t kServiceId{4711U};
+constexpr std::uint16_t kInstanceId{1U};
+constexpr impl::LolaEventId kEventId{3U};
+constexpr analysis::tracing::TraceClientId kTraceClientId{1U};
+constexpr analysis::tracing::ShmObjectHandle kShmObjectHandle{42};
+constexpr memory::shared::ISharedMemoryResource::FileDescriptor kShmFileDescriptor{7};
+constexpr std::size_t kShmRegionSize{4096U};
+constexpr std::size_t kSampleOffset{512U};
+constexpr std::size_t kSampleSize{64U};
+
+/// \brief Stands in for the SamplePtr of a sent event sample. It doesn't hold any resources, so that the benchmark
+///        only measures the tracing runtime.
+struct DummySamplePtr
+{
+};
+
+impl::Configuration CreateConfiguration()
+{
+    const auto service_identifier = impl::make_ServiceIdentifierType(std::string{kServiceTypeName}, 1U, 0U);
+    const auto instance_specifier = impl::InstanceSpecifier::Create(std::string{kInstanceSpecifier}).value();
+    const impl::LolaServiceTypeDeployment lola_service_type_deployment{kServiceId,
+                                                                       {{std::string{kEventName}, kEventId}}};
+    const impl::LolaServiceInstanceDeployment lola_service_instance_deployment{
+        impl::LolaServiceInstanceId{kInstanceId}};
+
+    impl::TracingConfiguration tracing_configuration{};
+    tracing_configuration.SetTracingEnabled(true);
+    tracing_configuration.SetApplicationInstanceID("lola_trace_send_benchmark");
+    return impl::Configuration{
+        {{service_identifier, impl::ServiceTypeDeployment{lola_service_type_deployment}}},
+        {{instance_specifier,
+          impl::ServiceInstanceDeployment{
+              service_identifier, lola_service_instance_deployment, impl::QualityType::kASIL_QM, instance_specifier}}},
+        impl::GlobalConfiguration{},
+        std::move(tracing_configuration)};
+}
+
+/// \brief Tracing runtimes of a process, which offers a single service instance with one trace enabled event. The
+///        GenericTraceAPI is replaced by a mock, which reports every trace as done immediately. So the tracing slot of
+///        the event is free again for the next call, like with a trace daemon, which keeps up with the send rate.
+class TracedServiceInstance
+{
+  public:
+    TracedServiceInstance()
+        : generic_trace_api_mock_{},
+          configuration_{CreateConfiguration()},
+          binding_tracing_runtime_{1U, configuration_},
+          tracing_runtime_{nullptr},
+          shm_region_{},
+          shm_object_identifier_{{kServiceTypeName,
+                                  impl::lola::tracing::TracingRuntime::kDummyElementNameForShmRegisterCallback,
+                                  impl::lola::tracing::TracingRuntime::kDummyElementTypeForShmRegisterCallback},
+                                 kInstanceSpecifier},
+          event_identifier_{{kServiceTypeName, kEventName, impl::ServiceElementType::EVENT}, kInstanceSpecifier},
+          service_element_tracing_data_{}
+    {
+        ON_CALL(generic_trace_api_mock_, RegisterClient(_, _)).WillByDefault(Return(kTraceClientId));
+        ON_CALL(generic_trace_api_mock_, RegisterTraceDoneCB(_, _))
+            .WillByDefault(Return(analysis::tracing::RegisterTraceDoneCallBackResult{}));
+        ON_CALL(generic_trace_api_mock_, RegisterShmObject(_, _))
+            .WillByDefault(Return(analysis::tracing::RegisterSharedMemoryObjectResult{kShmObjectHandle}));
+        ON_CALL(generic_trace_api_mock_, Trace(_, _, _, _))
+            .WillByDefault(WithArg<3>(Invoke([this](const analysis::tracing::TraceContextId trace_context_id) {
+                binding_tracing_runtime_.ClearTypeErasedSamplePtr(trace_context_id);
+                return analysis::tracing::TraceResult{};
+            })));
+
+        tracing_runtime_ = std::make_unique<impl::tracing::TracingRuntime>(
+            std::unordered_map<impl::BindingType, impl::tracing::IBindingTracingRuntime*>{
+                {impl::BindingType::kLoLa, &binding_tracing_runtime_}});
+        service_element_tracing_data_ = tracing_runtime_->RegisterServiceElement(impl::BindingType::kLoLa, 1U);
+        tracing_runtime_->RegisterShmObject(
+            impl::BindingType::kLoLa, shm_object_identifier_, kShmFileDescriptor, shm_region_.data());
+    }
+
+    /// \brief The Trace() call done by SkeletonEvent::Send() for a sample in shared memory.
+    Result<void> TraceSend()
+    {
+        return tracing_runtime_->Trace(impl::BindingType::kLoLa,
+                                       service_element_tracing_data_,
+                                       event_identifier_,
+                                       impl::tracing::SkeletonEventTracePointType::SEND,
+                                       impl::tracing::TracingRuntime::TracePointDataId{1U},
+                                       impl::tracing::TypeErasedSamplePtr{DummySamplePtr{}},
+                                       &shm_region_.at(kSampleOffset),
+                                       kSampleSize);
+    }
+
+    ::testing::NiceMock<analysis::tracing::TraceLibraryMock> generic_trace_api_mock_;
+    impl::Configuration configuration_;
+    impl::lola::tracing::TracingRuntime binding_tracing_runtime_;
+    std::unique_ptr<impl::tracing::TracingRuntime> tracing_runtime_;
+    std::array<std::uint8_t, kShmRegionSize> shm_region_;
+    impl::tracing::ServiceElementInstanceIdentifierView shm_object_identifier_;
+    impl::tracing::ServiceElementInstanceIdentifierView event_identifier_;
+    impl::tracing::ServiceElementTracingData service_element_tracing_data_;
+};
+
+}  // namespace
+
+/// \brief Complete Trace() call of a Send() with tracing enabled, which uses the cached ShmTraceHandle of the event.
+void BM_TraceSendShmData(benchmark::State& state)
+{
+    TracedServiceInstance traced_service_instance{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(traced_service_instance.TraceSend());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/// \brief Per call work to resolve the shm-object and the service instance element of the event, which a Trace() call
+///        did before the ShmTraceHandle got cached.
+void BM_ResolveShmTraceHandle(benchmark::State& state)
+{
+    TracedServiceInstance traced_service_instance{};
+    const auto& binding_tracing_runtime = traced_service_instance.binding_tracing_runtime_;
+    const auto& event_identifier = traced_service_instance.event_identifier_;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(binding_tracing_runtime.GetShmObjectHandle(event_identifier));
+        benchmark::DoNotOptimize(binding_tracing_runtime.GetShmRegionStartAddress(event_identifier));
+        benchmark::DoNotOptimize(binding_tracing_runtime.ConvertToTracingServiceInstanceElement(event_identifier));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+/// \brief Per call work to get the ShmTraceHandle of the event from the cache of the binding specific tracing runtime.
+void BM_GetCachedShmTraceHandle(benchmark::State& state)
+{
+    TracedServiceInstance traced_service_instance{};
+    // The first Trace() call resolves the ShmTraceHandle and caches it.
+    benchmark::DoNotOptimize(traced_service_instance.TraceSend());
+    const auto& binding_tracing_runtime = traced_service_instance.binding_tracing_runtime_;
+    const auto& service_element_tracing_data = traced_service_instance.service_element_tracing_data_;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(binding_tracing_runtime.GetShmTraceHandle(service_element_tracing_data));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_TraceSendShmData)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_ResolveShmTraceHandle)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_GetCachedShmTraceHandle)->Unit(benchmark::kNanosecond);
+
+}  // namespace score::mw::com::test
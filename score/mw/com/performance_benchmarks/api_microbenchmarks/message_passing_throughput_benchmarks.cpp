@@ -0,0 +1,225 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/message_passing/i_server_connection.h"
+#include "score/message_passing/unix_domain/unix_domain_client_factory.h"
+#include "score/message_passing/unix_domain/unix_domain_engine_pool.h"
+#include "score/message_passing/unix_domain/unix_domain_server_factory.h"
+
+#include <score/utility.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+using namespace score::message_passing;
+
+constexpr std::size_t kMessageSize{64U};
+constexpr std::chrono::seconds kWaitTimeout{10};
+
+LoggingCallback GetSilentLogger()
+{
+    return [](LogSeverity, LogItems) noexcept {};
+}
+
+/// \brief Counts down outstanding events and lets the benchmark thread wait until all of them happened.
+class Latch
+{
+  public:
+    void Reset(const std::size_t count) noexcept
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        count_ = count;
+    }
+
+    void CountDown() noexcept
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        if ((count_ > 0U) && (--count_ == 0U))
+        {
+            condition_.notify_all();
+        }
+    }
+
+    bool Wait() noexcept
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        return condition_.wait_for(lock, kWaitTimeout, [this]() noexcept {
+            return count_ == 0U;
+        });
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::size_t count_{0U};
+};
+
+/// \brief Echo servers and client connections of one process, like in a gateway, spread over the reactors of
+///        a server side and a client side UnixDomainEnginePool. There is one server per reactor; the client
+///        connections are distributed round-robin over the servers.
+class EchoSetup
+{
+  public:
+    EchoSetup(const std::size_t connection_count, const std::size_t reactor_count)
+        : server_pool_{std::make_shared<UnixDomainEnginePool>(
+              score::cpp::pmr::get_default_resource(), reactor_count, &GetSilentLogger)},
+          client_pool_{std::make_shared<UnixDomainEnginePool>(
+              score::cpp::pmr::get_default_resource(), reactor_count, &GetSilentLogger)},
+          server_factory_{server_pool_},
+          client_factory_{client_pool_}
+    {
+        const std::string prefix{"mp_throughput_benchmark_" + std::to_string(::getpid()) + "_"};
+        for (std::size_t i = 0U; i < reactor_count; ++i)
+        {
+            identifiers_.push_back(prefix + std::to_string(i));
+        }
+
+        for (const auto& identifier : identifiers_)
+        {
+            auto server = server_factory_.Create(ServiceProtocolConfig{identifier, kMessageSize, kMessageSize, 0U},
+                                                 IServerFactory::ServerConfig{});
+            const auto connect_callback = [](IServerConnection&) -> void* {
+                return nullptr;
+            };
+            const auto echo_callback = [](IServerConnection& connection,
+                                          score::cpp::span<const std::uint8_t> message) -> score::cpp::blank {
+                score::cpp::ignore = connection.Reply(message);
+                return {};
+            };
+            if (!server->StartListening(connect_callback, DisconnectCallback{}, MessageCallback{}, echo_callback)
+                     .has_value())
+            {
+                std::abort();
+            }
+            servers_.push_back(std::move(server));
+        }
+
+        const IClientFactory::ClientConfig client_config{
+            1U, 0U, false, false, false, {}, IClientFactory::ClientConfig::PriorityDispatch::kStrict};
+        latch_.Reset(connection_count);
+        for (std::size_t i = 0U; i < connection_count; ++i)
+        {
+            const auto& identifier = identifiers_[i % identifiers_.size()];
+            auto client = client_factory_.Create(ServiceProtocolConfig{identifier, kMessageSize, kMessageSize, 0U},
+                                                 client_config);
+            client->Start(
+                [this](IClientConnection::State state) noexcept {
+                    if (state == IClientConnection::State::kReady)
+                    {
+                        latch_.CountDown();
+                    }
+                },
+                IClientConnection::NotifyCallback{});
+            clients_.push_back(std::move(client));
+        }
+        if (!latch_.Wait())
+        {
+            std::abort();
+        }
+    }
+
+    ~EchoSetup()
+    {
+        clients_.clear();
+        for (auto& server : servers_)
+        {
+            server->StopListening();
+        }
+        servers_.clear();
+    }
+
+    EchoSetup(const EchoSetup&) = delete;
+    EchoSetup(EchoSetup&&) = delete;
+    EchoSetup& operator=(const EchoSetup&) = delete;
+    EchoSetup& operator=(EchoSetup&&) = delete;
+
+    /// \brief Sends one request on every client connection and waits for all the replies.
+    void RoundTripOnAllConnections() noexcept
+    {
+        latch_.Reset(clients_.size());
+        for (auto& client : clients_)
+        {
+            const auto send_result =
+                client->SendWithCallback(message_, [this](auto reply_expected) noexcept {
+                    if (!reply_expected.has_value())
+                    {
+                        std::abort();
+                    }
+                    latch_.CountDown();
+                });
+            if (!send_result.has_value())
+            {
+                std::abort();
+            }
+        }
+        if (!latch_.Wait())
+        {
+            std::abort();
+        }
+    }
+
+  private:
+    std::shared_ptr<UnixDomainEnginePool> server_pool_;
+    std::shared_ptr<UnixDomainEnginePool> client_pool_;
+    UnixDomainServerFactory server_factory_;
+    UnixDomainClientFactory client_factory_;
+    std::vector<std::string> identifiers_{};
+    std::vector<score::cpp::pmr::unique_ptr<IServer>> servers_{};
+    std::vector<score::cpp::pmr::unique_ptr<IClientConnection>> clients_{};
+    std::array<std::uint8_t, kMessageSize> message_{};
+    Latch latch_{};
+};
+
+}  // namespace
+
+/// \brief Request/reply throughput of a process with many message_passing connections, depending on the number of
+///        UnixDomainEngine reactors serving them.
+void BM_MessagePassingRoundTripThroughput(benchmark::State& state)
+{
+    const auto connection_count = static_cast<std::size_t>(state.range(0));
+    const auto reactor_count = static_cast<std::size_t>(state.range(1));
+    EchoSetup setup{connection_count, reactor_count};
+
+    for (auto _ : state)
+    {
+        setup.RoundTripOnAllConnections();
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+// 1 to 256 connections, each served by 1, 2 or 4 reactors on the server side and on the client side.
+BENCHMARK(BM_MessagePassingRoundTripThroughput)
+    ->ArgsProduct({{1, 16, 64, 256}, {1, 2, 4}})
+    ->ArgNames({"connections", "reactors"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+}  // namespace score::mw::com::test
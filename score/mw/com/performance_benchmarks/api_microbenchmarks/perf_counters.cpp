@@ -0,0 +1,219 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/perf_counters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+constexpr int kInvalidFileDescriptor{-1};
+
+constexpr std::array<std::string_view, PerfCounters::kEventCount> kEventNames{
+    "cycles",
+    "instructions",
+    "l1d_read_misses",
+    "llc_misses",
+    "context_switches",
+};
+
+#if defined(__linux__)
+
+struct EventConfig
+{
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+constexpr std::uint64_t MakeCacheConfig(const std::uint64_t cache,
+                                        const std::uint64_t operation,
+                                        const std::uint64_t result) noexcept
+{
+    return cache | (operation << 8U) | (result << 16U);
+}
+
+constexpr std::array<EventConfig, PerfCounters::kEventCount> kEventConfigs{{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE,
+     MakeCacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_HW_CACHE,
+     MakeCacheConfig(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+}};
+
+int OpenEvent(const EventConfig& event_config, const bool exclude_kernel) noexcept
+{
+    perf_event_attr attributes{};
+    attributes.size = sizeof(perf_event_attr);
+    attributes.type = event_config.type;
+    attributes.config = event_config.config;
+    attributes.disabled = 1U;
+    attributes.exclude_kernel = exclude_kernel ? 1U : 0U;
+    attributes.exclude_hv = 1U;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    // Counting the calling thread on any CPU. No glibc wrapper exists for perf_event_open.
+    const auto result = ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0UL);
+    return static_cast<int>(result);
+}
+
+int OpenEvent(const EventConfig& event_config) noexcept
+{
+    // With perf_event_paranoid >= 2 unprivileged processes may only count user space. In this case we retry without
+    // the kernel part instead of dropping the counter.
+    const auto file_descriptor = OpenEvent(event_config, false);
+    if ((file_descriptor < 0) && ((errno == EACCES) || (errno == EPERM)))
+    {
+        return OpenEvent(event_config, true);
+    }
+    return file_descriptor;
+}
+
+#endif
+
+}  // namespace
+
+PerfCounters::PerfCounters() noexcept : file_descriptors_{}
+{
+    file_descriptors_.fill(kInvalidFileDescriptor);
+#if defined(__linux__)
+    for (std::size_t index = 0U; index < kEventCount; ++index)
+    {
+        file_descriptors_[index] = OpenEvent(kEventConfigs[index]);
+    }
+#endif
+}
+
+PerfCounters::~PerfCounters() noexcept
+{
+#if defined(__linux__)
+    for (const auto file_descriptor : file_descriptors_)
+    {
+        if (file_descriptor >= 0)
+        {
+            static_cast<void>(::close(file_descriptor));
+        }
+    }
+#endif
+}
+
+void PerfCounters::Start() noexcept
+{
+#if defined(__linux__)
+    for (const auto file_descriptor : file_descriptors_)
+    {
+        if (file_descriptor >= 0)
+        {
+            static_cast<void>(::ioctl(file_descriptor, PERF_EVENT_IOC_RESET, 0));
+            static_cast<void>(::ioctl(file_descriptor, PERF_EVENT_IOC_ENABLE, 0));
+        }
+    }
+#endif
+}
+
+void PerfCounters::Stop() noexcept
+{
+#if defined(__linux__)
+    for (const auto file_descriptor : file_descriptors_)
+    {
+        if (file_descriptor >= 0)
+        {
+            static_cast<void>(::ioctl(file_descriptor, PERF_EVENT_IOC_DISABLE, 0));
+        }
+    }
+#endif
+}
+
+std::vector<PerfCounters::Reading> PerfCounters::Read() const
+{
+    std::vector<Reading> readings{};
+#if defined(__linux__)
+    for (std::size_t index = 0U; index < kEventCount; ++index)
+    {
+        const auto file_descriptor = file_descriptors_[index];
+        if (file_descriptor < 0)
+        {
+            continue;
+        }
+
+        // Layout defined by PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+        struct
+        {
+            std::uint64_t value;
+            std::uint64_t time_enabled;
+            std::uint64_t time_running;
+        } raw_reading{};
+        if (::read(file_descriptor, &raw_reading, sizeof(raw_reading)) != static_cast<ssize_t>(sizeof(raw_reading)))
+        {
+            continue;
+        }
+
+        auto value = static_cast<double>(raw_reading.value);
+        if ((raw_reading.time_running != 0U) && (raw_reading.time_running < raw_reading.time_enabled))
+        {
+            value *= static_cast<double>(raw_reading.time_enabled) / static_cast<double>(raw_reading.time_running);
+        }
+        readings.push_back({kEventNames[index], value});
+    }
+#endif
+    return readings;
+}
+
+bool PerfCounters::IsAvailable(const Event event) const noexcept
+{
+    return file_descriptors_[static_cast<std::size_t>(event)] >= 0;
+}
+
+bool PerfCounters::IsAnyAvailable() const noexcept
+{
+    for (const auto file_descriptor : file_descriptors_)
+    {
+        if (file_descriptor >= 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string_view PerfCounters::GetName(const Event event) noexcept
+{
+    return kEventNames[static_cast<std::size_t>(event)];
+}
+
+void ReportPerfCounters(const PerfCounters& perf_counters, benchmark::State& state)
+{
+    for (const auto& reading : perf_counters.Read())
+    {
+        state.counters[std::string{reading.name}] =
+            benchmark::Counter(reading.value, benchmark::Counter::kAvgIterations);
+    }
+}
+
+}  // namespace score::mw::com::test
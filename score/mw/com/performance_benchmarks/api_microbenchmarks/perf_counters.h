@@ -0,0 +1,89 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_PERF_COUNTERS_H
+#define SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_PERF_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace benchmark
+{
+class State;
+}  // namespace benchmark
+
+namespace score::mw::com::test
+{
+
+/// \brief Hardware/software performance counters of the calling thread, collected via perf_event_open.
+/// \details Every counter is opened individually, so that a counter which is not supported by the CPU, the
+///          virtualization layer or the current perf_event_paranoid setting is simply left out instead of disabling
+///          the whole set. On platforms without perf events (e.g. QNX) no counter is available and the benchmarks run
+///          unchanged, just without the additional user counters.
+class PerfCounters
+{
+  public:
+    enum class Event : std::uint8_t
+    {
+        kCycles = 0U,
+        kInstructions,
+        kL1DataReadMisses,
+        kLastLevelCacheMisses,
+        kContextSwitches,
+    };
+
+    static constexpr std::size_t kEventCount{5U};
+
+    struct Reading
+    {
+        std::string_view name;
+        double value;
+    };
+
+    /// \brief Opens all counters in disabled state.
+    PerfCounters() noexcept;
+    ~PerfCounters() noexcept;
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    PerfCounters(PerfCounters&&) = delete;
+    PerfCounters& operator=(PerfCounters&&) = delete;
+
+    /// \brief Resets and enables all available counters.
+    void Start() noexcept;
+
+    /// \brief Disables all available counters. Their values stay readable until the next Start().
+    void Stop() noexcept;
+
+    /// \brief Returns the values of all available counters, scaled up in case the kernel had to multiplex them.
+    std::vector<Reading> Read() const;
+
+    bool IsAvailable(const Event event) const noexcept;
+
+    /// \brief true if at least one counter could be opened.
+    bool IsAnyAvailable() const noexcept;
+
+    static std::string_view GetName(const Event event) noexcept;
+
+  private:
+    std::array<int, kEventCount> file_descriptors_;
+};
+
+/// \brief Reads all available counters and publishes them as per-iteration user counters of the benchmark state.
+void ReportPerfCounters(const PerfCounters& perf_counters, benchmark::State& state);
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_API_MICROBENCHMARKS_PERF_COUNTERS_H
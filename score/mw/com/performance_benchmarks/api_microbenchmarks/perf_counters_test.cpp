@@ -0,0 +1,99 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/api_microbenchmarks/perf_counters.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+
+namespace score::mw::com::test
+{
+namespace
+{
+
+TEST(PerfCountersTest, OnlyAvailableCountersAreRead)
+{
+    // Given a set of perf counters, of which an arbitrary subset may be available on the executing machine
+    PerfCounters perf_counters{};
+
+    // When counting some work
+    perf_counters.Start();
+    volatile std::size_t sum{0U};
+    for (std::size_t i = 0U; i < 10000U; ++i)
+    {
+        sum = sum + i;
+    }
+    perf_counters.Stop();
+    const auto readings = perf_counters.Read();
+
+    // Then exactly the available counters are reported, each with a non negative value
+    std::size_t expected_reading_count{0U};
+    for (std::size_t index = 0U; index < PerfCounters::kEventCount; ++index)
+    {
+        const auto event = static_cast<PerfCounters::Event>(index);
+        if (perf_counters.IsAvailable(event))
+        {
+            ++expected_reading_count;
+        }
+    }
+    EXPECT_EQ(readings.size(), expected_reading_count);
+    EXPECT_EQ(perf_counters.IsAnyAvailable(), expected_reading_count > 0U);
+    for (const auto& reading : readings)
+    {
+        EXPECT_FALSE(reading.name.empty());
+        EXPECT_GE(reading.value, 0.0);
+    }
+}
+
+TEST(PerfCountersTest, InstructionsAreCountedWhenAvailable)
+{
+    // Given a set of perf counters
+    PerfCounters perf_counters{};
+    if (!perf_counters.IsAvailable(PerfCounters::Event::kInstructions))
+    {
+        GTEST_SKIP() << "Instruction counter not available on this machine";
+    }
+
+    // When counting some work
+    perf_counters.Start();
+    volatile std::size_t sum{0U};
+    for (std::size_t i = 0U; i < 10000U; ++i)
+    {
+        sum = sum + i;
+    }
+    perf_counters.Stop();
+
+    // Then the instruction counter has counted at least the loop iterations
+    for (const auto& reading : perf_counters.Read())
+    {
+        if (reading.name == PerfCounters::GetName(PerfCounters::Event::kInstructions))
+        {
+            EXPECT_GE(reading.value, 10000.0);
+        }
+    }
+}
+
+TEST(PerfCountersTest, EventNamesAreUnique)
+{
+    for (std::size_t first = 0U; first < PerfCounters::kEventCount; ++first)
+    {
+        for (std::size_t second = first + 1U; second < PerfCounters::kEventCount; ++second)
+        {
+            EXPECT_NE(PerfCounters::GetName(static_cast<PerfCounters::Event>(first)),
+                      PerfCounters::GetName(static_cast<PerfCounters::Event>(second)));
+        }
+    }
+}
+
+}  // namespace
+}  // namespace score::mw::com::test
@@ -19,9 +19,51 @@
 
 #include <boost/program_options.hpp>
 
+#include <sched.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
 namespace score::mw::com::test
 {
 
+namespace
+{
+
+constexpr std::string_view kSysfsNumaNodePath{"/sys/devices/system/node/"};
+
+std::optional<std::vector<unsigned int>> ReadSysfsIdList(const std::string& path)
+{
+    std::ifstream file{path};
+    std::string id_list{};
+    if (!std::getline(file, id_list))
+    {
+        return std::nullopt;
+    }
+    return ParseSysfsIdList(id_list);
+}
+
+std::optional<unsigned int> ParseId(std::string_view id)
+{
+    if (id.empty())
+    {
+        return std::nullopt;
+    }
+    unsigned int value{0U};
+    for (const char digit : id)
+    {
+        if ((digit < '0') || (digit > '9'))
+        {
+            return std::nullopt;
+        }
+        value = (value * 10U) + static_cast<unsigned int>(digit - '0');
+    }
+    return value;
+}
+
+}  // namespace
+
 bool GetStopTokenAndSetUpSigTermHandler(score::cpp::stop_source& test_stop_source)
 {
 
@@ -126,4 +168,71 @@ void InitializeRuntime(const std::string& path)
     score::mw::log::LogInfo() << "LoLa Runtime initialized!";
 }
 
+std::optional<std::vector<unsigned int>> ParseSysfsIdList(std::string_view id_list)
+{
+    while ((!id_list.empty()) && ((id_list.back() == '\n') || (id_list.back() == ' ')))
+    {
+        id_list.remove_suffix(1U);
+    }
+
+    std::vector<unsigned int> ids{};
+    while (!id_list.empty())
+    {
+        const auto range_end = id_list.find(',');
+        const auto range = id_list.substr(0U, range_end);
+        id_list = (range_end == std::string_view::npos) ? std::string_view{} : id_list.substr(range_end + 1U);
+
+        const auto separator = range.find('-');
+        const auto first = ParseId(range.substr(0U, separator));
+        const auto last = (separator == std::string_view::npos) ? first : ParseId(range.substr(separator + 1U));
+        if ((!first.has_value()) || (!last.has_value()) || (last.value() < first.value()))
+        {
+            return std::nullopt;
+        }
+        for (unsigned int id = first.value(); id <= last.value(); ++id)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+bool PinToNumaNodeOrSkip(unsigned int numa_node, std::string_view log_context)
+{
+    const auto online_nodes = ReadSysfsIdList(std::string{kSysfsNumaNodePath} + "online");
+    if ((!online_nodes.has_value()) || (online_nodes.value().size() < 2U))
+    {
+        test_success("Benchmark skipped: Pinning to NUMA nodes requires a host with at least two NUMA nodes.",
+                     log_context);
+    }
+    if (std::find(online_nodes.value().cbegin(), online_nodes.value().cend(), numa_node) == online_nodes.value().cend())
+    {
+        mw::log::LogError(log_context) << "NUMA node " << numa_node << " is not online on this host.";
+        test_success("Benchmark skipped: Configured NUMA node doesn't exist on this host.", log_context);
+    }
+
+    const auto cpu_list_path = std::string{kSysfsNumaNodePath} + "node" + std::to_string(numa_node) + "/cpulist";
+    const auto cpus = ReadSysfsIdList(cpu_list_path);
+    if ((!cpus.has_value()) || cpus.value().empty())
+    {
+        mw::log::LogError(log_context) << "Could not read the CPUs of NUMA node " << numa_node;
+        return false;
+    }
+
+    cpu_set_t cpu_set{};
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : cpus.value())
+    {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (::sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+    {
+        mw::log::LogError(log_context) << "Could not pin to the CPUs of NUMA node " << numa_node;
+        return false;
+    }
+
+    mw::log::LogInfo(log_context) << "Pinned to the " << cpus.value().size() << " CPUs of NUMA node " << numa_node;
+    return true;
+}
+
 }  // namespace score::mw::com::test
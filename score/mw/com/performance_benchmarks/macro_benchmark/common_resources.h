@@ -21,6 +21,7 @@
 #include <optional>
 #include <sstream>
 #include <string_view>
+#include <vector>
 namespace score::mw::com::test
 {
 
@@ -51,6 +52,17 @@ std::optional<TestCommanLineArguments> ParseCommandLineArgs(int, const char**, s
 
 void InitializeRuntime(const std::string& path);
 
+/// \brief Parses a list of ids in the format of the sysfs cpulist/nodelist files, e.g. "0-3,8,10-11".
+/// \return the ids or an empty optional, if the list is malformed
+std::optional<std::vector<unsigned int>> ParseSysfsIdList(std::string_view id_list);
+
+/// \brief Pins the calling thread (and all threads created by it afterwards) to the CPUs of the given NUMA node.
+///
+/// If the host has a single NUMA node only or doesn't have the given node, the benchmark can't measure cross node
+/// effects and it is ended successfully with a message, that it has been skipped.
+/// \return true, if the thread has been pinned, false if pinning failed on a multi node host
+bool PinToNumaNodeOrSkip(unsigned int numa_node, std::string_view log_context);
+
 }  // namespace score::mw::com::test
 
 #endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_MACRO_BENCHMARK_COMMON_RESOURCES_H
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <string_view>
+#include <vector>
 
 namespace score::mw::com::test
 {
@@ -75,5 +76,34 @@ TEST(CommonResources, ParseCommandLineArgsInsufficientArgsTest)
     ASSERT_FALSE(parsed_args.has_value());
 }
 
+TEST(CommonResources, ParseSysfsIdListParsesRangesAndSingleIds)
+{
+    // given an id list with ranges and single ids as found in /sys/devices/system/node/online
+    constexpr std::string_view id_list{"0-3,8,10-11\n"};
+
+    // Then ParseSysfsIdList returns all contained ids
+    const auto ids = ParseSysfsIdList(id_list);
+    ASSERT_TRUE(ids.has_value());
+    EXPECT_EQ(ids.value(), (std::vector<unsigned int>{0U, 1U, 2U, 3U, 8U, 10U, 11U}));
+}
+
+TEST(CommonResources, ParseSysfsIdListReturnsNoIdsForEmptyList)
+{
+    // given an empty id list
+    // Then ParseSysfsIdList returns no ids
+    const auto ids = ParseSysfsIdList("");
+    ASSERT_TRUE(ids.has_value());
+    EXPECT_TRUE(ids.value().empty());
+}
+
+TEST(CommonResources, ParseSysfsIdListRejectsMalformedList)
+{
+    // given malformed id lists
+    // Then ParseSysfsIdList returns an empty optional
+    EXPECT_FALSE(ParseSysfsIdList("0-").has_value());
+    EXPECT_FALSE(ParseSysfsIdList("a,1").has_value());
+    EXPECT_FALSE(ParseSysfsIdList("3-1").has_value());
+}
+
 }  // namespace
 }  // namespace score::mw::com::test
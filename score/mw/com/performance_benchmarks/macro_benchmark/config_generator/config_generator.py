@@ -84,9 +84,28 @@ def create_client_benchmark_config(joined_config_json: dict, max_samples: int):
     if run_time_limit is not None:
         client_benchmark_config["run_time_limit"] = run_time_limit
 
+    numa_placement = joined_config_json["common"].get("numa_placement")
+    if numa_placement is not None:
+        client_benchmark_config["numa_node"] = numa_placement["consumer_node"]
+
     return client_benchmark_config
 
 
+def apply_shm_numa_policy(mw_com_config_json: dict, joined_config_json: dict):
+    '''
+    Writes the shm_numa_policy of the numa_placement in the joined_benchmark_config (if any) as shm-numa-policy into
+    the service instance of the given mw_com_configuration.
+
+            Parameters:
+                    mw_com_config_json (dict): json dictionary representing a mw_com_configuration.json, which is
+                                               modified in place.
+                    joined_config_json (dict): json dictionary representing the joined_benchmark_config.
+    '''
+    shm_numa_policy = joined_config_json["common"].get("numa_placement", {}).get("shm_numa_policy")
+    if shm_numa_policy is not None:
+        mw_com_config_json["serviceInstances"][0]["instances"][0]["shm-numa-policy"] = shm_numa_policy
+
+
 def create_client_mw_com_config(base_mw_com_config_json: dict, asil_level: str):
     '''
     Creates client benchmark app specific mw_com configuration out of the base mw_com_configuration.json
@@ -118,6 +137,11 @@ def create_service_benchmark_config(joined_config_json: dict):
     service_benchmark_config = dict()
     service_benchmark_config["number_of_clients"] = joined_config_json["common"]["number_of_clients"]
     service_benchmark_config["send_cycle_time_ms"] = joined_config_json["service_config"]["send_cycle_time_ms"]
+
+    numa_placement = joined_config_json["common"].get("numa_placement")
+    if numa_placement is not None:
+        service_benchmark_config["numa_node"] = numa_placement["producer_node"]
+
     return service_benchmark_config
 
 
@@ -159,6 +183,7 @@ def main():
     save_json(f"{out_dir}/client_benchmark_config.json", client_config_benchmark_json)
     client_mw_com_config_json = create_client_mw_com_config(base_mw_com_config_json,
                                                             joined_config_json["common"]["asil_level"])
+    apply_shm_numa_policy(client_mw_com_config_json, joined_config_json)
     save_json(f"{out_dir}/client_mw_com_config.json", client_mw_com_config_json)
 
     service_config_benchmark_json = create_service_benchmark_config(joined_config_json)
@@ -166,6 +191,7 @@ def main():
     service_mw_com_config_json = create_service_mw_com_config(base_mw_com_config_json,
                                                               joined_config_json["common"]["asil_level"],
                                                               numberOfSampleSlots)
+    apply_shm_numa_policy(service_mw_com_config_json, joined_config_json)
     save_json(f"{out_dir}/service_mw_com_config.json", service_mw_com_config_json)
 
 
@@ -23,6 +23,16 @@ namespace
 {
 std::string_view gLogContext;
 
+std::optional<unsigned int> ParseOptionalNumaNode(const score::json::Object& json_root)
+{
+    const auto numa_node_it_opt = score::mw::com::test::find_json_key("numa_node", json_root);
+    if (!numa_node_it_opt.has_value())
+    {
+        return std::nullopt;
+    }
+    return score::mw::com::test::cast_json_any_to_type<unsigned int>(numa_node_it_opt.value()->second);
+}
+
 std::optional<score::mw::com::test::ServiceFinderMode> ParseServiceFinderModeFromString(std::string_view mode)
 {
 
@@ -110,8 +120,12 @@ ClientConfig ParseClientConfig(std::string_view path, std::string_view log_conte
         run_time_limit = {duration, duration_unit};
     }
 
-    return ClientConfig{
-        read_cycle_time_ms, number_of_clients, max_num_samples, service_finder_mode_maybe.value(), run_time_limit};
+    return ClientConfig{read_cycle_time_ms,
+                        number_of_clients,
+                        max_num_samples,
+                        service_finder_mode_maybe.value(),
+                        run_time_limit,
+                        ParseOptionalNumaNode(json_root)};
 }
 
 ServiceConfig ParseServiceConfig(std::string_view path, std::string_view log_context)
@@ -125,6 +139,7 @@ ServiceConfig ParseServiceConfig(std::string_view path, std::string_view log_con
     return ServiceConfig{
         send_cycle_time_ms,
         number_of_clients,
+        ParseOptionalNumaNode(json_root),
     };
 }
 }  // namespace score::mw::com::test
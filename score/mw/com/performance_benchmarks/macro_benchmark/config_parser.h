@@ -47,12 +47,16 @@ struct ClientConfig
         DurationUnit unit;
     };
     std::optional<RunTimeLimit> run_time_limit;
+    /// NUMA node, to whose CPUs all client threads are pinned. Not pinned if empty.
+    std::optional<unsigned int> numa_node;
 };
 
 struct ServiceConfig
 {
     unsigned int send_cycle_time_ms;
     unsigned int number_of_clients;
+    /// NUMA node, to whose CPUs the service is pinned. Not pinned if empty.
+    std::optional<unsigned int> numa_node;
 };
 
 ClientConfig ParseClientConfig(std::string_view path, std::string_view log_context);
@@ -390,6 +390,13 @@ int main(int argc, const char** argv)
 
     auto config = score::mw::com::test::ParseClientConfig(args.config_path, kLogContext);
 
+    // Pin before spawning the client threads, which inherit the CPU affinity.
+    if (config.numa_node.has_value() &&
+        (!score::mw::com::test::PinToNumaNodeOrSkip(config.numa_node.value(), kLogContext)))
+    {
+        return EXIT_FAILURE;
+    }
+
     score::mw::com::test::InitializeRuntime(args.service_instance_manifest);
 
     std::vector<std::thread> workers;
@@ -151,6 +151,14 @@ int main(int argc, const char** argv)
     score::mw::com::test::InitializeRuntime(args.service_instance_manifest);
     auto config = score::mw::com::test::ParseServiceConfig(args.config_path, kLogContext);
 
+    // Pin before the skeleton creates its shared-memory, so that a shm-numa-policy "bind-producer-node" refers to the
+    // configured node.
+    if (config.numa_node.has_value() &&
+        (!score::mw::com::test::PinToNumaNodeOrSkip(config.numa_node.value(), kLogContext)))
+    {
+        return EXIT_FAILURE;
+    }
+
     if (score::mw::com::test::RunService(config, test_stop_source.get_token()))
     {
         return EXIT_SUCCESS;
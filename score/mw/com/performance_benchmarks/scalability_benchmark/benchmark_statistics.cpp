@@ -0,0 +1,223 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/benchmark_statistics.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+std::size_t GetMostSignificantBit(const std::uint64_t value) noexcept
+{
+    std::size_t msb{0U};
+    auto remaining = value;
+    while (remaining > 1U)
+    {
+        remaining >>= 1U;
+        ++msb;
+    }
+    return msb;
+}
+
+std::uint64_t ToMicroseconds(const timeval& time) noexcept
+{
+    return (static_cast<std::uint64_t>(time.tv_sec) * 1'000'000U) + static_cast<std::uint64_t>(time.tv_usec);
+}
+
+std::uint64_t SaturatingSub(const std::uint64_t lhs, const std::uint64_t rhs) noexcept
+{
+    return lhs > rhs ? lhs - rhs : 0U;
+}
+
+}  // namespace
+
+std::size_t LatencyHistogram::GetBucketIndex(const std::uint64_t value) noexcept
+{
+    // Values smaller than kSubBucketCount are mapped linearly into the first buckets.
+    if (value < kSubBucketCount)
+    {
+        return static_cast<std::size_t>(value);
+    }
+    // Values beyond the covered range are accounted in the last bucket.
+    const auto clamped_value = std::min(value, (std::uint64_t{1U} << (kMaxExponent + 1U)) - 1U);
+    const auto msb = GetMostSignificantBit(clamped_value);
+    const auto shift = msb - kSubBucketBits;
+    const auto sub_bucket = static_cast<std::size_t>((clamped_value >> shift) & (kSubBucketCount - 1U));
+    return ((msb - kSubBucketBits + 1U) * kSubBucketCount) + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::GetBucketUpperBound(const std::size_t bucket_index) noexcept
+{
+    if (bucket_index < kSubBucketCount)
+    {
+        return static_cast<std::uint64_t>(bucket_index);
+    }
+    const auto shift = (bucket_index / kSubBucketCount) - 1U;
+    const auto sub_bucket = static_cast<std::uint64_t>(bucket_index % kSubBucketCount);
+    const auto lower_bound = (kSubBucketCount + sub_bucket) << shift;
+    return lower_bound + ((std::uint64_t{1U} << shift) - 1U);
+}
+
+void LatencyHistogram::Record(const std::uint64_t value_ns) noexcept
+{
+    buckets_[GetBucketIndex(value_ns)]++;
+    count_++;
+    sum_ += value_ns;
+    min_ = std::min(min_, value_ns);
+    max_ = std::max(max_, value_ns);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) noexcept
+{
+    for (std::size_t i = 0U; i < kBucketCount; ++i)
+    {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+double LatencyHistogram::GetMean() const noexcept
+{
+    if (count_ == 0U)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(sum_) / static_cast<double>(count_);
+}
+
+std::uint64_t LatencyHistogram::GetPercentile(const double percentile) const noexcept
+{
+    if (count_ == 0U)
+    {
+        return 0U;
+    }
+    const auto clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+    const auto rank = std::max(
+        std::uint64_t{1U},
+        static_cast<std::uint64_t>(std::ceil((clamped_percentile / 100.0) * static_cast<double>(count_))));
+
+    std::uint64_t accumulated{0U};
+    for (std::size_t i = 0U; i < kBucketCount; ++i)
+    {
+        accumulated += buckets_[i];
+        if (accumulated >= rank)
+        {
+            // The bucket bound may overshoot the largest recorded value.
+            return std::min(GetBucketUpperBound(i), max_);
+        }
+    }
+    return max_;
+}
+
+std::vector<std::pair<std::uint64_t, std::uint64_t>> LatencyHistogram::GetNonEmptyBuckets() const
+{
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> result{};
+    for (std::size_t i = 0U; i < kBucketCount; ++i)
+    {
+        if (buckets_[i] != 0U)
+        {
+            result.emplace_back(GetBucketUpperBound(i), buckets_[i]);
+        }
+    }
+    return result;
+}
+
+ResourceUsage GetProcessResourceUsage() noexcept
+{
+    rusage usage{};
+    if (::getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return ResourceUsage{};
+    }
+    return ResourceUsage{ToMicroseconds(usage.ru_utime),
+                         ToMicroseconds(usage.ru_stime),
+                         static_cast<std::uint64_t>(usage.ru_nvcsw),
+                         static_cast<std::uint64_t>(usage.ru_nivcsw),
+                         static_cast<std::uint64_t>(usage.ru_maxrss)};
+}
+
+ResourceUsage operator-(const ResourceUsage& end, const ResourceUsage& start) noexcept
+{
+    return ResourceUsage{SaturatingSub(end.user_cpu_time_us, start.user_cpu_time_us),
+                         SaturatingSub(end.system_cpu_time_us, start.system_cpu_time_us),
+                         SaturatingSub(end.voluntary_context_switches, start.voluntary_context_switches),
+                         SaturatingSub(end.involuntary_context_switches, start.involuntary_context_switches),
+                         end.max_resident_set_size_kb};
+}
+
+void WriteJsonReport(std::ostream& stream, const ProcessReport& report)
+{
+    const auto& usage = report.resource_usage;
+    stream << "{\"role\":\"" << report.role << "\",\"process_index\":" << report.process_index
+           << ",\"duration_us\":" << report.duration_us << ",\"samples\":" << report.samples
+           << ",\"payload_bytes\":" << report.payload_bytes << ",\"errors\":" << report.errors
+           << ",\"rusage\":{\"user_cpu_time_us\":" << usage.user_cpu_time_us
+           << ",\"system_cpu_time_us\":" << usage.system_cpu_time_us
+           << ",\"voluntary_context_switches\":" << usage.voluntary_context_switches
+           << ",\"involuntary_context_switches\":" << usage.involuntary_context_switches
+           << ",\"max_resident_set_size_kb\":" << usage.max_resident_set_size_kb << "}";
+
+    if (report.latency_histogram != nullptr)
+    {
+        const auto& histogram = *report.latency_histogram;
+        stream << ",\"latency_ns\":{\"count\":" << histogram.GetCount() << ",\"min\":" << histogram.GetMin()
+               << ",\"mean\":" << histogram.GetMean() << ",\"p50\":" << histogram.GetPercentile(50.0)
+               << ",\"p90\":" << histogram.GetPercentile(90.0) << ",\"p99\":" << histogram.GetPercentile(99.0)
+               << ",\"p99_9\":" << histogram.GetPercentile(99.9) << ",\"max\":" << histogram.GetMax()
+               << ",\"buckets\":[";
+        bool first{true};
+        for (const auto& [upper_bound, count] : histogram.GetNonEmptyBuckets())
+        {
+            stream << (first ? "" : ",") << "[" << upper_bound << "," << count << "]";
+            first = false;
+        }
+        stream << "]}";
+    }
+    if (report.first_sample_timestamp_ns.has_value())
+    {
+        stream << ",\"first_sample_timestamp_ns\":" << report.first_sample_timestamp_ns.value();
+    }
+    if (!report.provider_restart_timestamps_ns.empty())
+    {
+        stream << ",\"provider_restart_timestamps_ns\":[";
+        for (std::size_t i = 0U; i < report.provider_restart_timestamps_ns.size(); ++i)
+        {
+            stream << (i == 0U ? "" : ",") << report.provider_restart_timestamps_ns[i];
+        }
+        stream << "]";
+    }
+    stream << "}\n";
+}
+
+bool WriteJsonReportToFile(const std::string& path, const ProcessReport& report)
+{
+    std::ofstream file{path, std::ios::out | std::ios::trunc};
+    if (!file.is_open())
+    {
+        return false;
+    }
+    WriteJsonReport(file, report);
+    return file.good();
+}
+
+}  // namespace score::mw::com::test
@@ -0,0 +1,117 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_BENCHMARK_STATISTICS_H
+#define SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_BENCHMARK_STATISTICS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+/// \brief Fixed size, log-linear latency histogram.
+/// \details Recording a value does not allocate, so it can be done from within the GetNewSamples() callbacks. Values
+///          are bucketed by their most significant bit and kSubBucketCount linear sub buckets per power of two, which
+///          gives a relative error below 1/kSubBucketCount. The raw bucket counts are part of the process report, so
+///          that histograms of several consumer processes can be merged by the driver before percentiles are taken.
+class LatencyHistogram
+{
+  public:
+    static constexpr std::size_t kSubBucketBits{3U};
+    static constexpr std::size_t kSubBucketCount{std::size_t{1U} << kSubBucketBits};
+    static constexpr std::size_t kMaxExponent{48U};
+    static constexpr std::size_t kBucketCount{(kMaxExponent - kSubBucketBits + 2U) * kSubBucketCount};
+
+    void Record(std::uint64_t value_ns) noexcept;
+    void Merge(const LatencyHistogram& other) noexcept;
+
+    std::uint64_t GetCount() const noexcept
+    {
+        return count_;
+    }
+    std::uint64_t GetMin() const noexcept
+    {
+        return count_ == 0U ? 0U : min_;
+    }
+    std::uint64_t GetMax() const noexcept
+    {
+        return max_;
+    }
+    double GetMean() const noexcept;
+
+    /// \brief Returns the upper bound of the bucket containing the given percentile (0.0 < percentile <= 100.0).
+    std::uint64_t GetPercentile(double percentile) const noexcept;
+
+    /// \brief Returns (bucket upper bound, count) of all non empty buckets.
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> GetNonEmptyBuckets() const;
+
+    static std::size_t GetBucketIndex(std::uint64_t value) noexcept;
+    static std::uint64_t GetBucketUpperBound(std::size_t bucket_index) noexcept;
+
+  private:
+    std::array<std::uint64_t, kBucketCount> buckets_{};
+    std::uint64_t count_{0U};
+    std::uint64_t sum_{0U};
+    std::uint64_t min_{UINT64_MAX};
+    std::uint64_t max_{0U};
+};
+
+/// \brief CPU time and scheduling statistics of the calling process as reported by getrusage(RUSAGE_SELF).
+struct ResourceUsage
+{
+    std::uint64_t user_cpu_time_us{0U};
+    std::uint64_t system_cpu_time_us{0U};
+    std::uint64_t voluntary_context_switches{0U};
+    std::uint64_t involuntary_context_switches{0U};
+    std::uint64_t max_resident_set_size_kb{0U};
+};
+
+ResourceUsage GetProcessResourceUsage() noexcept;
+
+/// \brief Returns the difference of two snapshots. max_resident_set_size_kb is not a counter and is taken from end.
+ResourceUsage operator-(const ResourceUsage& end, const ResourceUsage& start) noexcept;
+
+/// \brief Everything a single provider or consumer process reports to the matrix driver.
+struct ProcessReport
+{
+    std::string role;
+    std::uint32_t process_index{0U};
+    std::uint64_t duration_us{0U};
+    std::uint64_t samples{0U};
+    std::uint64_t payload_bytes{0U};
+    std::uint64_t errors{0U};
+    ResourceUsage resource_usage{};
+    const LatencyHistogram* latency_histogram{nullptr};
+    /// \brief steady_clock timestamp of the first received sample (consumer only). Used to measure the time to first
+    ///        sample of restarted consumers.
+    std::optional<std::int64_t> first_sample_timestamp_ns{};
+    /// \brief steady_clock timestamps of the first sample received after each detected provider restart (consumer
+    ///        only). A restart is detected by a regression of the sample sequence number.
+    std::vector<std::int64_t> provider_restart_timestamps_ns{};
+};
+
+/// \brief Writes the report as a single line JSON object.
+void WriteJsonReport(std::ostream& stream, const ProcessReport& report);
+
+/// \brief Writes the report into the file at path. Returns false, if the file could not be written.
+bool WriteJsonReportToFile(const std::string& path, const ProcessReport& report);
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_BENCHMARK_STATISTICS_H
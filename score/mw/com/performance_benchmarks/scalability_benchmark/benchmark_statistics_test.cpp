@@ -0,0 +1,190 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/benchmark_statistics.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace score::mw::com::test
+{
+namespace
+{
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZero)
+{
+    // Given an empty histogram
+    LatencyHistogram histogram{};
+
+    // Then all statistics are zero
+    EXPECT_EQ(histogram.GetCount(), 0U);
+    EXPECT_EQ(histogram.GetMin(), 0U);
+    EXPECT_EQ(histogram.GetMax(), 0U);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0U);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), 0.0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreRecordedExactly)
+{
+    // Given a histogram with values below the sub bucket count
+    LatencyHistogram histogram{};
+    for (std::uint64_t value = 0U; value < LatencyHistogram::kSubBucketCount; ++value)
+    {
+        histogram.Record(value);
+    }
+
+    // Then the percentiles are exact
+    EXPECT_EQ(histogram.GetPercentile(50.0), 3U);
+    EXPECT_EQ(histogram.GetPercentile(100.0), LatencyHistogram::kSubBucketCount - 1U);
+}
+
+TEST(LatencyHistogramTest, BucketUpperBoundIsNotSmallerThanValue)
+{
+    // Given values across the whole covered range
+    for (std::uint64_t value = 1U; value < (std::uint64_t{1U} << 40U); value = (value * 3U) + 1U)
+    {
+        const auto index = LatencyHistogram::GetBucketIndex(value);
+        const auto upper_bound = LatencyHistogram::GetBucketUpperBound(index);
+
+        // Then the bucket of each value bounds it with a relative error below 1/kSubBucketCount
+        ASSERT_LT(index, LatencyHistogram::kBucketCount);
+        EXPECT_GE(upper_bound, value);
+        EXPECT_LE(static_cast<double>(upper_bound - value) / static_cast<double>(value),
+                  1.0 / static_cast<double>(LatencyHistogram::kSubBucketCount));
+    }
+}
+
+TEST(LatencyHistogramTest, ValuesBeyondRangeEndInLastBucket)
+{
+    // Given the largest possible value
+    const auto index = LatencyHistogram::GetBucketIndex(UINT64_MAX);
+
+    // Then it is accounted in the last bucket
+    EXPECT_EQ(index, LatencyHistogram::kBucketCount - 1U);
+}
+
+TEST(LatencyHistogramTest, PercentilesOfUniformDistribution)
+{
+    // Given 1000 values from 1us to 1ms
+    LatencyHistogram histogram{};
+    for (std::uint64_t value = 1U; value <= 1000U; ++value)
+    {
+        histogram.Record(value * 1000U);
+    }
+
+    // Then the percentiles are within the bucket resolution
+    EXPECT_EQ(histogram.GetCount(), 1000U);
+    EXPECT_EQ(histogram.GetMin(), 1000U);
+    EXPECT_EQ(histogram.GetMax(), 1'000'000U);
+    EXPECT_NEAR(static_cast<double>(histogram.GetPercentile(50.0)), 500'000.0, 500'000.0 / 8.0);
+    EXPECT_NEAR(static_cast<double>(histogram.GetPercentile(99.0)), 990'000.0, 990'000.0 / 8.0);
+    EXPECT_EQ(histogram.GetPercentile(100.0), 1'000'000U);
+    EXPECT_DOUBLE_EQ(histogram.GetMean(), 500'500.0);
+}
+
+TEST(LatencyHistogramTest, MergeCombinesCountsAndExtrema)
+{
+    // Given two histograms
+    LatencyHistogram lhs{};
+    LatencyHistogram rhs{};
+    lhs.Record(100U);
+    rhs.Record(10U);
+    rhs.Record(1000U);
+
+    // When merging them
+    lhs.Merge(rhs);
+
+    // Then the merged histogram contains all values
+    EXPECT_EQ(lhs.GetCount(), 3U);
+    EXPECT_EQ(lhs.GetMin(), 10U);
+    EXPECT_EQ(lhs.GetMax(), 1000U);
+    EXPECT_EQ(lhs.GetNonEmptyBuckets().size(), 3U);
+}
+
+TEST(ResourceUsageTest, DifferenceSaturatesAtZero)
+{
+    // Given an end snapshot, which is smaller than the start snapshot
+    const ResourceUsage start{10U, 10U, 10U, 10U, 100U};
+    const ResourceUsage end{5U, 20U, 10U, 11U, 200U};
+
+    // When calculating the difference
+    const auto difference = end - start;
+
+    // Then counters do not wrap around and the RSS is taken from the end snapshot
+    EXPECT_EQ(difference.user_cpu_time_us, 0U);
+    EXPECT_EQ(difference.system_cpu_time_us, 10U);
+    EXPECT_EQ(difference.voluntary_context_switches, 0U);
+    EXPECT_EQ(difference.involuntary_context_switches, 1U);
+    EXPECT_EQ(difference.max_resident_set_size_kb, 200U);
+}
+
+TEST(ResourceUsageTest, ProcessResourceUsageIsMonotonic)
+{
+    // Given a first snapshot
+    const auto start = GetProcessResourceUsage();
+
+    // When burning some CPU time
+    volatile std::uint64_t sink{0U};
+    for (std::uint64_t i = 0U; i < 10'000'000U; ++i)
+    {
+        sink = sink + i;
+    }
+    const auto end = GetProcessResourceUsage();
+
+    // Then the CPU time does not decrease
+    EXPECT_GE(end.user_cpu_time_us + end.system_cpu_time_us, start.user_cpu_time_us + start.system_cpu_time_us);
+}
+
+TEST(ProcessReportTest, JsonReportContainsLatencyOnlyIfHistogramIsGiven)
+{
+    // Given a provider report without a histogram and a consumer report with one
+    LatencyHistogram histogram{};
+    histogram.Record(43U);
+    ProcessReport provider_report{};
+    provider_report.role = "provider";
+    ProcessReport consumer_report{};
+    consumer_report.role = "consumer";
+    consumer_report.samples = 1U;
+    consumer_report.latency_histogram = &histogram;
+
+    // When writing both reports
+    std::stringstream provider_stream{};
+    std::stringstream consumer_stream{};
+    WriteJsonReport(provider_stream, provider_report);
+    WriteJsonReport(consumer_stream, consumer_report);
+
+    // Then only the consumer report contains latency statistics
+    EXPECT_EQ(provider_stream.str().find("latency_ns"), std::string::npos);
+    EXPECT_NE(consumer_stream.str().find("\"role\":\"consumer\""), std::string::npos);
+    EXPECT_NE(consumer_stream.str().find("\"buckets\":[[43,1]]"), std::string::npos);
+}
+
+TEST(ProcessReportTest, JsonReportContainsRecoveryTimestampsIfGiven)
+{
+    // Given a consumer report with a first sample timestamp and two detected provider restarts
+    ProcessReport report{};
+    report.role = "consumer";
+    report.first_sample_timestamp_ns = 100;
+    report.provider_restart_timestamps_ns = {200, 300};
+
+    // When writing the report
+    std::stringstream stream{};
+    WriteJsonReport(stream, report);
+
+    // Then both are contained
+    EXPECT_NE(stream.str().find("\"first_sample_timestamp_ns\":100"), std::string::npos);
+    EXPECT_NE(stream.str().find("\"provider_restart_timestamps_ns\":[200,300]"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace score::mw::com::test
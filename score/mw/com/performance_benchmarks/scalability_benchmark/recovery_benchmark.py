@@ -0,0 +1,221 @@
+# *******************************************************************************
+# Copyright (c) 2026 Contributors to the Eclipse Foundation
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+# *******************************************************************************
+"""Measures how long a partially restarted LoLa provider or consumer takes to become operational again.
+
+One provider and K consumers are started on one event with S sample slots. Every consumer keeps references to its
+most recent samples, so a killed consumer leaves outstanding references in its transaction log. Then either
+
+- the first consumer is killed (SIGKILL) and restarted repeatedly ("consumer" scenario). The time to first sample is
+  measured from spawning the restarted consumer until it receives its first sample, which includes the rollback of
+  the transaction log of its killed predecessor, or
+- the provider is killed (SIGKILL) and restarted repeatedly ("provider" scenario). The time to first sample is measured
+  per consumer from spawning the restarted provider until the consumer received the first sample of the new provider.
+
+One JSON line per (scenario, K, S) is appended to the output file.
+"""
+import argparse
+import json
+import os
+import signal
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import scalability_matrix  # noqa: E402
+
+PROVIDER_APPLICATION_ID = 1
+CONSUMER_APPLICATION_ID_BASE = 100
+# Consumers run until they are terminated by this script.
+CONSUMER_RUN_DURATION_MS = 24 * 60 * 60 * 1000
+
+
+class RecoveryRun:
+
+    def __init__(self, binary_dir: str, work_dir: str, subscribers: int, slots: int, rate_hz: int):
+        self.binary_dir = binary_dir
+        self.work_dir = work_dir
+        self.subscribers = subscribers
+        self.rate_hz = rate_hz
+        # Each consumer gets the same share of the slots. One slot stays reserved for the provider.
+        self.max_samples = max(1, (slots - 1) // subscribers)
+        self.hold_samples = self.max_samples - 1
+        self.slots = subscribers * self.max_samples + 1
+        self.provider_config = self._write_config("provider", PROVIDER_APPLICATION_ID)
+        self.consumer_configs = [self._write_config(f"consumer_{i}", CONSUMER_APPLICATION_ID_BASE + i)
+                                 for i in range(subscribers)]
+        self.restart_counter = 0
+
+    def _write_config(self, name: str, application_id: int) -> str:
+        path = os.path.join(self.work_dir, f"mw_com_config_{name}.json")
+        with open(path, "w") as config_fp:
+            json.dump(scalability_matrix.make_mw_com_config(1, self.subscribers, 1, self.max_samples,
+                                                            application_id), config_fp)
+        return path
+
+    def _result_file(self, name: str) -> str:
+        self.restart_counter += 1
+        return os.path.join(self.work_dir, f"{name}_{self.restart_counter}.json")
+
+    def spawn_provider(self) -> subprocess.Popen:
+        return subprocess.Popen([
+            os.path.join(self.binary_dir, "scalability_provider"),
+            "--provider-index=0",
+            "--num-events=1",
+            f"--rate-hz={self.rate_hz}",
+            "--payload-size=64",
+            f"--result-file={self._result_file('provider')}",
+            f"--service-instance-manifest={self.provider_config}",
+        ])
+
+    def spawn_consumer(self, consumer_index: int, duration_ms: int) -> (subprocess.Popen, str):
+        result_file = self._result_file(f"consumer_{consumer_index}")
+        return subprocess.Popen([
+            os.path.join(self.binary_dir, "scalability_consumer"),
+            f"--consumer-index={consumer_index}",
+            "--num-providers=1",
+            "--num-events=1",
+            f"--max-samples={self.max_samples}",
+            f"--hold-samples={self.hold_samples}",
+            f"--duration-ms={duration_ms}",
+            f"--result-file={result_file}",
+            f"--service-instance-manifest={self.consumer_configs[consumer_index]}",
+        ]), result_file
+
+
+def read_report(path: str) -> Dict:
+    if not os.path.isfile(path):
+        return {}
+    with open(path, "r") as report_fp:
+        return json.load(report_fp)
+
+
+def terminate(processes: List[subprocess.Popen]):
+    for process in processes:
+        if process.poll() is None:
+            process.send_signal(signal.SIGTERM)
+    for process in processes:
+        process.wait()
+
+
+def run_consumer_restart(run: RecoveryRun, iterations: int, warm_up_s: float, restart_duration_ms: int) -> List[float]:
+    provider = run.spawn_provider()
+    consumers = [run.spawn_consumer(i, CONSUMER_RUN_DURATION_MS) for i in range(run.subscribers)]
+    time.sleep(warm_up_s)
+
+    times_to_first_sample_us = []
+    restarted_consumer = consumers[0][0]
+    for _ in range(iterations):
+        restarted_consumer.send_signal(signal.SIGKILL)
+        restarted_consumer.wait()
+        spawn_timestamp_ns = time.monotonic_ns()
+        process, result_file = run.spawn_consumer(0, restart_duration_ms)
+        process.wait()
+        report = read_report(result_file)
+        if "first_sample_timestamp_ns" in report:
+            times_to_first_sample_us.append((report["first_sample_timestamp_ns"] - spawn_timestamp_ns) / 1000.0)
+        # Keep the consumer alive with references held, so that the next iteration again has to roll back.
+        restarted_consumer, _ = run.spawn_consumer(0, CONSUMER_RUN_DURATION_MS)
+        time.sleep(warm_up_s)
+
+    terminate([restarted_consumer] + [c[0] for c in consumers[1:]] + [provider])
+    return times_to_first_sample_us
+
+
+def run_provider_restart(run: RecoveryRun, iterations: int, warm_up_s: float) -> List[float]:
+    provider = run.spawn_provider()
+    consumers = [run.spawn_consumer(i, CONSUMER_RUN_DURATION_MS) for i in range(run.subscribers)]
+    time.sleep(warm_up_s)
+
+    spawn_timestamps_ns = []
+    for _ in range(iterations):
+        provider.send_signal(signal.SIGKILL)
+        provider.wait()
+        spawn_timestamps_ns.append(time.monotonic_ns())
+        provider = run.spawn_provider()
+        time.sleep(warm_up_s)
+
+    terminate([c[0] for c in consumers])
+    terminate([provider])
+
+    times_to_first_sample_us = []
+    for _, result_file in consumers:
+        restart_timestamps_ns = read_report(result_file).get("provider_restart_timestamps_ns", [])
+        for spawn_timestamp_ns, restart_timestamp_ns in zip(spawn_timestamps_ns, restart_timestamps_ns):
+            times_to_first_sample_us.append((restart_timestamp_ns - spawn_timestamp_ns) / 1000.0)
+    return times_to_first_sample_us
+
+
+def summarize(values: List[float]) -> Dict:
+    if not values:
+        return {"count": 0}
+    ordered = sorted(values)
+    return {
+        "count": len(ordered),
+        "min": ordered[0],
+        "p50": statistics.median(ordered),
+        "p90": ordered[min(len(ordered) - 1, int(0.9 * len(ordered)))],
+        "max": ordered[-1],
+        "mean": statistics.fmean(ordered),
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--scenario", choices=["consumer", "provider"], nargs="+", default=["consumer", "provider"])
+    parser.add_argument("--subscribers", type=int, nargs="+", default=[1, 8, 32], help="Values of K to sweep")
+    parser.add_argument("--slots", type=int, nargs="+", default=[16, 128, 1024], help="Values of S to sweep")
+    parser.add_argument("--iterations", type=int, default=10, help="Number of restarts per matrix point")
+    parser.add_argument("--rate-hz", type=int, default=1000, help="Send rate of the provider")
+    parser.add_argument("--warm-up-s", type=float, default=0.5, help="Time to settle after (re)starting processes")
+    parser.add_argument("--restart-duration-ms", type=int, default=200,
+                        help="Run duration of a restarted consumer after it has subscribed")
+    parser.add_argument("--output", default="recovery_results.jsonl")
+    parser.add_argument("--binary-dir", default=os.path.dirname(os.path.abspath(sys.argv[0])),
+                        help="Directory containing scalability_provider and scalability_consumer")
+    args = parser.parse_args()
+
+    with open(args.output, "a") as output_fp:
+        for scenario in args.scenario:
+            for subscribers in args.subscribers:
+                for slots in args.slots:
+                    if slots < 2 * subscribers + 1:
+                        print(f"Skipping K={subscribers} S={slots}: not enough slots to hold samples", flush=True)
+                        continue
+                    with tempfile.TemporaryDirectory(prefix="lola_recovery_") as work_dir:
+                        scalability_matrix.clean_up_shm(1, 1)
+                        run = RecoveryRun(args.binary_dir, work_dir, subscribers, slots, args.rate_hz)
+                        if scenario == "consumer":
+                            values = run_consumer_restart(run, args.iterations, args.warm_up_s,
+                                                          args.restart_duration_ms)
+                        else:
+                            values = run_provider_restart(run, args.iterations, args.warm_up_s)
+                        scalability_matrix.clean_up_shm(1, 1)
+                    result = {
+                        "timestamp": int(time.time()),
+                        "scenario": scenario,
+                        "subscribers": subscribers,
+                        "slots": run.slots,
+                        "held_samples_per_consumer": run.hold_samples,
+                        "time_to_first_sample_us": summarize(values),
+                    }
+                    output_fp.write(json.dumps(result) + "\n")
+                    output_fp.flush()
+                    print(json.dumps(result), flush=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,407 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/benchmark_statistics.h"
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/scalability_interface.h"
+#include "score/mw/com/runtime.h"
+#include "score/mw/com/test/common_test_resources/stop_token_sig_term_handler.h"
+#include "score/mw/com/types.h"
+#include "score/mw/log/logging.h"
+
+#include <score/stop_token.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// LogContext SCon -> ScalabilityConsumer
+constexpr std::string_view kLogContext{"SCon"};
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+enum class ReceiveMode : std::uint8_t
+{
+    POLLING,
+    RECEIVE_HANDLER,
+};
+
+struct ConsumerArguments
+{
+    std::uint32_t consumer_index{0U};
+    std::uint32_t number_of_providers{1U};
+    std::uint32_t number_of_events{1U};
+    std::uint32_t max_samples{1U};
+    std::uint32_t duration_ms{1000U};
+    std::uint32_t poll_cycle_us{100U};
+    std::uint32_t hold_samples{0U};
+    ReceiveMode receive_mode{ReceiveMode::RECEIVE_HANDLER};
+    std::string result_file{};
+    std::string service_instance_manifest{};
+};
+
+/// \brief Per subscribed event reception state.
+/// \details Each event has its own histogram and counters, so that receive handlers of different events never share
+///          state and the hot path is free of synchronization. They are merged after the measurement.
+struct EventReceiver
+{
+    /// \brief Upper bound of provider restarts, which are recorded per event.
+    static constexpr std::size_t kMaxRecordedRestarts{64U};
+
+    EventReceiver(ScalabilityProxy proxy_in, const std::uint32_t hold_samples)
+        : proxy{std::move(proxy_in)}, held_samples(hold_samples)
+    {
+    }
+
+    ScalabilityProxy proxy;
+    LatencyHistogram latency_histogram{};
+    std::uint64_t samples{0U};
+    std::uint64_t payload_bytes{0U};
+    std::uint64_t errors{0U};
+    std::uint64_t checksum{0U};
+
+    /// \brief Ring of the most recently received samples, which are kept referenced to emulate a consumer working on
+    ///        a history. Their references are what a rollback has to undo after this process got killed.
+    std::vector<SamplePtr<ScalabilitySample>> held_samples;
+    std::size_t next_held_sample{0U};
+
+    std::optional<std::int64_t> first_sample_timestamp_ns{};
+    std::optional<std::uint64_t> last_sequence_number{};
+    std::array<std::int64_t, kMaxRecordedRestarts> provider_restart_timestamps_ns{};
+    std::size_t provider_restart_count{0U};
+};
+
+std::optional<ConsumerArguments> ParseConsumerArguments(int argc, const char** argv)
+{
+    namespace po = boost::program_options;
+    po::options_description options;
+
+    ConsumerArguments args{};
+    std::string receive_mode{};
+    // clang-format off
+    options.add_options()("help", "Display the help message")
+        ("consumer-index", po::value<std::uint32_t>(&args.consumer_index)->required(), "Index of this consumer process within the benchmark run.")
+        ("num-providers", po::value<std::uint32_t>(&args.number_of_providers)->required(), "Number of provider processes to subscribe to.")
+        ("num-events", po::value<std::uint32_t>(&args.number_of_events)->required(), "Number of events offered by each provider.")
+        ("max-samples", po::value<std::uint32_t>(&args.max_samples)->default_value(1U), "max_sample_count used for Subscribe().")
+        ("duration-ms", po::value<std::uint32_t>(&args.duration_ms)->required(), "Measurement duration after all events have been subscribed.")
+        ("poll-cycle-us", po::value<std::uint32_t>(&args.poll_cycle_us)->default_value(100U), "Sleep between two polling rounds in polling mode.")
+        ("hold-samples", po::value<std::uint32_t>(&args.hold_samples)->default_value(0U), "Number of most recent samples kept referenced per event. Must be smaller than max-samples.")
+        ("receive-mode", po::value<std::string>(&receive_mode)->default_value("handler"), "Either 'handler' (SetReceiveHandler) or 'poll' (GetNewSamples loop).")
+        ("result-file", po::value<std::string>(&args.result_file)->required(), "Path of the JSON report written on shutdown.")
+        ("service-instance-manifest", po::value<std::string>(&args.service_instance_manifest)->required(), "Path to the mw_com_config.json generated for this run.");
+    // clang-format on
+
+    po::variables_map arg_map;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, options), arg_map);
+        if (arg_map.count("help") > 0U)
+        {
+            std::cerr << options << std::endl;
+            return std::nullopt;
+        }
+        po::notify(arg_map);
+    }
+    catch (const po::error& error)
+    {
+        std::cerr << error.what() << "\n" << options << std::endl;
+        return std::nullopt;
+    }
+
+    if (args.hold_samples >= args.max_samples)
+    {
+        std::cerr << "hold-samples must be smaller than max-samples." << std::endl;
+        return std::nullopt;
+    }
+
+    if (receive_mode == "poll")
+    {
+        args.receive_mode = ReceiveMode::POLLING;
+    }
+    else if (receive_mode == "handler")
+    {
+        args.receive_mode = ReceiveMode::RECEIVE_HANDLER;
+    }
+    else
+    {
+        std::cerr << "Unknown receive-mode " << receive_mode << std::endl;
+        return std::nullopt;
+    }
+    return args;
+}
+
+std::optional<ScalabilityProxy::HandleType> FindServiceBlocking(const InstanceSpecifier& instance_specifier,
+                                                                score::cpp::stop_token stop_token)
+{
+    while (!stop_token.stop_requested())
+    {
+        auto find_service_result = ScalabilityProxy::FindService(instance_specifier);
+        if (!find_service_result.has_value())
+        {
+            mw::log::LogError(kLogContext) << "FindService failed: " << find_service_result.error();
+            return std::nullopt;
+        }
+        if (!find_service_result.value().empty())
+        {
+            return find_service_result.value().front();
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::vector<std::unique_ptr<EventReceiver>>> CreateAndSubscribeProxies(const ConsumerArguments& args,
+                                                                                    score::cpp::stop_token stop_token)
+{
+    std::vector<std::unique_ptr<EventReceiver>> receivers{};
+    receivers.reserve(static_cast<std::size_t>(args.number_of_providers) * args.number_of_events);
+    for (std::uint32_t provider_index = 0U; provider_index < args.number_of_providers; ++provider_index)
+    {
+        for (std::uint32_t event_index = 0U; event_index < args.number_of_events; ++event_index)
+        {
+            const auto instance_specifier_string = GetScalabilityInstanceSpecifier(provider_index, event_index);
+            auto instance_specifier_result = InstanceSpecifier::Create(instance_specifier_string);
+            if (!instance_specifier_result.has_value())
+            {
+                mw::log::LogError(kLogContext) << "Could not create instance specifier " << instance_specifier_string;
+                return std::nullopt;
+            }
+
+            const auto handle = FindServiceBlocking(instance_specifier_result.value(), stop_token);
+            if (!handle.has_value())
+            {
+                return std::nullopt;
+            }
+
+            auto proxy_result = ScalabilityProxy::Create(handle.value());
+            if (!proxy_result.has_value())
+            {
+                mw::log::LogError(kLogContext) << "Could not create proxy for " << instance_specifier_string << ": "
+                                               << proxy_result.error();
+                return std::nullopt;
+            }
+
+            auto& receiver = receivers.emplace_back(std::make_unique<EventReceiver>(std::move(proxy_result).value(), args.hold_samples));
+            const auto subscribe_result = receiver->proxy.scalability_event.Subscribe(args.max_samples);
+            if (!subscribe_result.has_value())
+            {
+                mw::log::LogError(kLogContext) << "Could not subscribe to " << instance_specifier_string << ": "
+                                               << subscribe_result.error();
+                return std::nullopt;
+            }
+        }
+    }
+    return receivers;
+}
+
+void ReceiveNewSamples(EventReceiver& receiver, const std::uint32_t max_samples)
+{
+    const auto result = receiver.proxy.scalability_event.GetNewSamples(
+        [&receiver](SamplePtr<ScalabilitySample> sample) noexcept {
+            const auto now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+            const auto latency_ns = now_ns > sample->send_timestamp_ns ? now_ns - sample->send_timestamp_ns : 0;
+            receiver.latency_histogram.Record(static_cast<std::uint64_t>(latency_ns));
+
+            if (!receiver.first_sample_timestamp_ns.has_value())
+            {
+                receiver.first_sample_timestamp_ns = now_ns;
+            }
+            // A restarted provider starts counting from 0 again.
+            const bool provider_restarted{receiver.last_sequence_number.has_value() &&
+                                          (sample->sequence_number < receiver.last_sequence_number.value())};
+            if (provider_restarted && (receiver.provider_restart_count < EventReceiver::kMaxRecordedRestarts))
+            {
+                receiver.provider_restart_timestamps_ns[receiver.provider_restart_count] = now_ns;
+                receiver.provider_restart_count++;
+            }
+            receiver.last_sequence_number = sample->sequence_number;
+
+            // Touch one byte per cache line, so that the cost of actually reading the payload is part of the
+            // measurement without adding a full blown processing step.
+            const auto payload_size = std::min(static_cast<std::size_t>(sample->payload_size), sample->data.size());
+            for (std::size_t offset = 0U; offset < payload_size; offset += 64U)
+            {
+                receiver.checksum += sample->data[offset];
+            }
+            receiver.samples++;
+            receiver.payload_bytes += payload_size;
+
+            if (!receiver.held_samples.empty())
+            {
+                receiver.held_samples[receiver.next_held_sample] = std::move(sample);
+                receiver.next_held_sample = (receiver.next_held_sample + 1U) % receiver.held_samples.size();
+            }
+        },
+        max_samples);
+    if (!result.has_value())
+    {
+        receiver.errors++;
+    }
+}
+
+void RunPollingReception(std::vector<std::unique_ptr<EventReceiver>>& receivers,
+                         const ConsumerArguments& args,
+                         const std::chrono::steady_clock::time_point end_time,
+                         score::cpp::stop_token stop_token)
+{
+    while ((std::chrono::steady_clock::now() < end_time) && !stop_token.stop_requested())
+    {
+        for (auto& receiver : receivers)
+        {
+            ReceiveNewSamples(*receiver, args.max_samples);
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds{args.poll_cycle_us});
+    }
+}
+
+bool RunReceiveHandlerReception(std::vector<std::unique_ptr<EventReceiver>>& receivers,
+                                const ConsumerArguments& args,
+                                const std::chrono::steady_clock::time_point end_time,
+                                score::cpp::stop_token stop_token)
+{
+    for (auto& receiver : receivers)
+    {
+        auto* const receiver_ptr = receiver.get();
+        const auto max_samples = args.max_samples;
+        const auto result = receiver->proxy.scalability_event.SetReceiveHandler([receiver_ptr, max_samples]() {
+            ReceiveNewSamples(*receiver_ptr, max_samples);
+        });
+        if (!result.has_value())
+        {
+            mw::log::LogError(kLogContext) << "SetReceiveHandler failed: " << result.error();
+            return false;
+        }
+    }
+
+    while ((std::chrono::steady_clock::now() < end_time) && !stop_token.stop_requested())
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    for (auto& receiver : receivers)
+    {
+        std::ignore = receiver->proxy.scalability_event.UnsetReceiveHandler();
+    }
+    return true;
+}
+
+bool RunConsumer(const ConsumerArguments& args, score::cpp::stop_token stop_token)
+{
+    auto receivers = CreateAndSubscribeProxies(args, stop_token);
+    if (!receivers.has_value())
+    {
+        return false;
+    }
+    mw::log::LogInfo(kLogContext) << "Consumer " << args.consumer_index << " subscribed to "
+                                  << receivers.value().size() << " events.";
+
+    // Only the steady state is measured. Discovery and subscription are part of other benchmarks.
+    const auto start_usage = GetProcessResourceUsage();
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto end_time = start_time + std::chrono::milliseconds{args.duration_ms};
+
+    bool success{true};
+    if (args.receive_mode == ReceiveMode::POLLING)
+    {
+        RunPollingReception(receivers.value(), args, end_time, stop_token);
+    }
+    else
+    {
+        success = RunReceiveHandlerReception(receivers.value(), args, end_time, stop_token);
+    }
+
+    const auto end_usage = GetProcessResourceUsage();
+    const auto measured_duration = std::chrono::steady_clock::now() - start_time;
+
+    ProcessReport report{};
+    report.role = "consumer";
+    report.process_index = args.consumer_index;
+    report.duration_us = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(measured_duration).count());
+    report.resource_usage = end_usage - start_usage;
+    LatencyHistogram latency_histogram{};
+    for (auto& receiver : receivers.value())
+    {
+        receiver->held_samples.clear();
+        receiver->proxy.scalability_event.Unsubscribe();
+        latency_histogram.Merge(receiver->latency_histogram);
+        report.samples += receiver->samples;
+        report.payload_bytes += receiver->payload_bytes;
+        report.errors += receiver->errors;
+
+        // The process has received its first sample / recovered from a provider restart, once all of its events did.
+        if (receiver->first_sample_timestamp_ns.has_value())
+        {
+            report.first_sample_timestamp_ns =
+                std::max(report.first_sample_timestamp_ns.value_or(0), receiver->first_sample_timestamp_ns.value());
+        }
+        report.provider_restart_timestamps_ns.resize(
+            std::max(report.provider_restart_timestamps_ns.size(), receiver->provider_restart_count), 0);
+        for (std::size_t i = 0U; i < receiver->provider_restart_count; ++i)
+        {
+            report.provider_restart_timestamps_ns[i] =
+                std::max(report.provider_restart_timestamps_ns[i], receiver->provider_restart_timestamps_ns[i]);
+        }
+    }
+    report.latency_histogram = &latency_histogram;
+
+    if (!WriteJsonReportToFile(args.result_file, report))
+    {
+        mw::log::LogError(kLogContext) << "Could not write result file " << args.result_file;
+        return false;
+    }
+    return success;
+}
+
+}  // namespace
+
+}  // namespace score::mw::com::test
+
+int main(int argc, const char** argv)
+{
+    score::cpp::stop_source stop_source{};
+    if (!score::mw::com::SetupStopTokenSigTermHandler(stop_source))
+    {
+        std::cerr << "Unable to set signal handler for SIGINT and/or SIGTERM.\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto args = score::mw::com::test::ParseConsumerArguments(argc, argv);
+    if (!args.has_value())
+    {
+        return EXIT_FAILURE;
+    }
+
+    score::mw::com::runtime::InitializeRuntime(
+        score::mw::com::runtime::RuntimeConfiguration{args->service_instance_manifest});
+
+    return score::mw::com::test::RunConsumer(args.value(), stop_source.get_token()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,23 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/scalability_interface.h"
+
+namespace score::mw::com::test
+{
+
+std::string GetScalabilityInstanceSpecifier(const std::uint32_t provider_index, const std::uint32_t event_index)
+{
+    return "bench/scalability/p" + std::to_string(provider_index) + "/e" + std::to_string(event_index);
+}
+
+}  // namespace score::mw::com::test
@@ -0,0 +1,60 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_SCALABILITY_INTERFACE_H
+#define SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_SCALABILITY_INTERFACE_H
+
+#include "score/mw/com/types.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace score::mw::com::test
+{
+
+/// \brief Upper bound of the payload, which can be swept by the scalability benchmark.
+/// \details The sample type has a fixed size (LoLa requires trivially copyable, fixed size sample types), so the
+///          payload size of a run is emulated by only writing/reading the first payload_size bytes of the data array.
+constexpr std::size_t kScalabilityMaxPayloadSize{64U * 1024U};
+
+struct ScalabilitySample
+{
+    /// \brief std::chrono::steady_clock timestamp in ns taken right before Send(). steady_clock is CLOCK_MONOTONIC on
+    ///        Linux and QNX and therefore comparable between provider and consumer processes.
+    std::int64_t send_timestamp_ns;
+    std::uint64_t sequence_number;
+    std::uint32_t payload_size;
+    std::array<std::uint8_t, kScalabilityMaxPayloadSize> data;
+};
+
+template <typename T>
+struct ScalabilityInterface : public T::Base
+{
+    using T::Base::Base;
+    typename T::template Event<ScalabilitySample> scalability_event{*this, "scalability_event"};
+};
+
+using ScalabilityProxy = score::mw::com::AsProxy<ScalabilityInterface>;
+using ScalabilitySkeleton = score::mw::com::AsSkeleton<ScalabilityInterface>;
+
+/// \brief Returns the instance specifier of the event_index-th service instance offered by the provider process with
+///        the given provider_index.
+/// \details Each "event" of the benchmark matrix is modelled as its own service instance, so that the number of events
+///          per provider can be swept without recompiling. The naming has to match the one used by
+///          scalability_matrix.py when generating the mw_com_config.json.
+std::string GetScalabilityInstanceSpecifier(std::uint32_t provider_index, std::uint32_t event_index);
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_SCALABILITY_BENCHMARK_SCALABILITY_INTERFACE_H
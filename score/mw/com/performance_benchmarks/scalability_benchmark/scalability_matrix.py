@@ -0,0 +1,250 @@
+# *******************************************************************************
+# Copyright (c) 2026 Contributors to the Eclipse Foundation
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+# *******************************************************************************
+"""Runs the LoLa N x M scalability benchmark matrix.
+
+For every point of the matrix (providers x consumers x events x rate x payload size) a dedicated mw_com_config.json is
+generated, P provider and C consumer processes are spawned and their per process JSON reports are aggregated into one
+JSON line, which is appended to the output file. The output is meant for trend comparisons between commits, so every
+line is self-contained and carries the matrix point it belongs to.
+"""
+import argparse
+import itertools
+import json
+import math
+import os
+import shutil
+import signal
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List, Optional
+
+SERVICE_TYPE_NAME = "/score/mw/com/test/ScalabilityInterface"
+SERVICE_ID = 3430
+EVENT_NAME = "scalability_event"
+PERCENTILES = [("p50", 50.0), ("p90", 90.0), ("p99", 99.0), ("p99_9", 99.9)]
+
+
+def instance_specifier(provider_index: int, event_index: int) -> str:
+    # Has to match GetScalabilityInstanceSpecifier() in scalability_interface.cpp
+    return f"bench/scalability/p{provider_index}/e{event_index}"
+
+
+def instance_id(provider_index: int, event_index: int, events: int) -> int:
+    return provider_index * events + event_index + 1
+
+
+def make_mw_com_config(providers: int, consumers: int, events: int, slots_per_consumer: int,
+                       application_id: Optional[int] = None) -> Dict:
+    service_instances = []
+    for provider_index in range(providers):
+        for event_index in range(events):
+            service_instances.append({
+                "instanceSpecifier": instance_specifier(provider_index, event_index),
+                "serviceTypeName": SERVICE_TYPE_NAME,
+                "version": {"major": 1, "minor": 0},
+                "instances": [{
+                    "instanceId": instance_id(provider_index, event_index, events),
+                    "asil-level": "QM",
+                    "binding": "SHM",
+                    "events": [{
+                        "eventName": EVENT_NAME,
+                        # One slot in flight on the provider side plus the max_samples budget of every consumer.
+                        "numberOfSampleSlots": consumers * slots_per_consumer + 1,
+                        "maxSubscribers": consumers,
+                    }],
+                }],
+            })
+    config = {
+        "serviceTypes": [{
+            "serviceTypeName": SERVICE_TYPE_NAME,
+            "version": {"major": 1, "minor": 0},
+            "bindings": [{
+                "binding": "SHM",
+                "serviceId": SERVICE_ID,
+                "events": [{"eventName": EVENT_NAME, "eventId": 1}],
+            }],
+        }],
+        "serviceInstances": service_instances,
+        "global": {"asil-level": "QM"},
+    }
+    if application_id is not None:
+        # Partial restart identifies the transaction logs of a restarted process by its application id. So processes,
+        # which are killed and restarted independently, need distinct ones.
+        config["global"]["applicationID"] = application_id
+    return config
+
+
+def clean_up_shm(providers: int, events: int):
+    for provider_index in range(providers):
+        for event_index in range(events):
+            tag = f"{SERVICE_ID:016}-{instance_id(provider_index, event_index, events):05}"
+            for shm_file in [f"lola-ctl-{tag}", f"lola-ctl-{tag}-b", f"lola-data-{tag}"]:
+                shm_path = f"/dev/shm/{shm_file}"
+                if os.path.isfile(shm_path):
+                    os.remove(shm_path)
+    service_discovery_path = f"/tmp/mw_com_lola/service_discovery/{SERVICE_ID}"
+    if os.path.isdir(service_discovery_path):
+        shutil.rmtree(service_discovery_path)
+
+
+def percentile_from_buckets(buckets: List[List[int]], count: int, percentile: float) -> int:
+    if count == 0:
+        return 0
+    rank = max(1, math.ceil(percentile * count / 100.0))
+    accumulated = 0
+    for upper_bound, bucket_count in buckets:
+        accumulated += bucket_count
+        if accumulated >= rank:
+            return upper_bound
+    return buckets[-1][0] if buckets else 0
+
+
+def aggregate(point: Dict, reports: List[Dict], failed_processes: int) -> Dict:
+    providers = [r for r in reports if r["role"] == "provider"]
+    consumers = [r for r in reports if r["role"] == "consumer"]
+
+    merged_buckets: Dict[int, int] = {}
+    for consumer in consumers:
+        for upper_bound, count in consumer.get("latency_ns", {}).get("buckets", []):
+            merged_buckets[upper_bound] = merged_buckets.get(upper_bound, 0) + count
+    buckets = sorted([[k, v] for k, v in merged_buckets.items()])
+    latency_count = sum(v for _, v in buckets)
+
+    def cpu_time_us(report: Dict) -> int:
+        return report["rusage"]["user_cpu_time_us"] + report["rusage"]["system_cpu_time_us"]
+
+    def throughput(selection: List[Dict], key: str) -> float:
+        return sum(r[key] / (r["duration_us"] / 1e6) for r in selection if r["duration_us"] > 0)
+
+    latency = {name: percentile_from_buckets(buckets, latency_count, value) for name, value in PERCENTILES}
+    latency["count"] = latency_count
+    latency["min"] = min((c["latency_ns"]["min"] for c in consumers if c["latency_ns"]["count"] > 0), default=0)
+    latency["max"] = max((c["latency_ns"]["max"] for c in consumers), default=0)
+
+    return {
+        "timestamp": int(time.time()),
+        "matrix_point": point,
+        "failed_processes": failed_processes,
+        "provider": {
+            "samples_per_s": throughput(providers, "samples"),
+            "bytes_per_s": throughput(providers, "payload_bytes"),
+            "errors": sum(r["errors"] for r in providers),
+            "cpu_time_us": [cpu_time_us(r) for r in providers],
+            "context_switches": [r["rusage"]["voluntary_context_switches"] +
+                                 r["rusage"]["involuntary_context_switches"] for r in providers],
+        },
+        "consumer": {
+            "samples_per_s": throughput(consumers, "samples"),
+            "bytes_per_s": throughput(consumers, "payload_bytes"),
+            "errors": sum(r["errors"] for r in consumers),
+            "cpu_time_us": [cpu_time_us(r) for r in consumers],
+            "context_switches": [r["rusage"]["voluntary_context_switches"] +
+                                 r["rusage"]["involuntary_context_switches"] for r in consumers],
+            "latency_ns": latency,
+        },
+    }
+
+
+def run_point(binary_dir: str, point: Dict, work_dir: str, matrix: Dict) -> Dict:
+    providers, consumers, events = point["providers"], point["consumers"], point["events"]
+    max_samples = matrix.get("max_samples", 1)
+    config_path = os.path.join(work_dir, "mw_com_config.json")
+    with open(config_path, "w") as config_fp:
+        json.dump(make_mw_com_config(providers, consumers, events, max_samples), config_fp)
+    clean_up_shm(providers, events)
+
+    provider_processes = []
+    for provider_index in range(providers):
+        provider_processes.append(subprocess.Popen([
+            os.path.join(binary_dir, "scalability_provider"),
+            f"--provider-index={provider_index}",
+            f"--num-events={events}",
+            f"--rate-hz={point['rate_hz']}",
+            f"--payload-size={point['payload_size']}",
+            f"--result-file={os.path.join(work_dir, f'provider_{provider_index}.json')}",
+            f"--service-instance-manifest={config_path}",
+        ]))
+
+    consumer_processes = []
+    for consumer_index in range(consumers):
+        consumer_processes.append(subprocess.Popen([
+            os.path.join(binary_dir, "scalability_consumer"),
+            f"--consumer-index={consumer_index}",
+            f"--num-providers={providers}",
+            f"--num-events={events}",
+            f"--max-samples={max_samples}",
+            f"--duration-ms={matrix.get('duration_ms', 5000)}",
+            f"--receive-mode={point['receive_mode']}",
+            f"--result-file={os.path.join(work_dir, f'consumer_{consumer_index}.json')}",
+            f"--service-instance-manifest={config_path}",
+        ]))
+
+    timeout_s = matrix.get("duration_ms", 5000) / 1000.0 + matrix.get("setup_timeout_s", 60)
+    failed_processes = 0
+    for process in consumer_processes:
+        try:
+            failed_processes += 0 if process.wait(timeout=timeout_s) == 0 else 1
+        except subprocess.TimeoutExpired:
+            process.terminate()
+            process.wait()
+            failed_processes += 1
+    for process in provider_processes:
+        process.send_signal(signal.SIGTERM)
+    for process in provider_processes:
+        failed_processes += 0 if process.wait() == 0 else 1
+    clean_up_shm(providers, events)
+
+    reports = []
+    for file_name in sorted(os.listdir(work_dir)):
+        if file_name.startswith(("provider_", "consumer_")):
+            with open(os.path.join(work_dir, file_name), "r") as report_fp:
+                reports.append(json.load(report_fp))
+    return aggregate(point, reports, failed_processes)
+
+
+def matrix_points(matrix: Dict):
+    keys = ["providers", "consumers", "events", "rate_hz", "payload_size", "receive_mode"]
+    defaults = {"receive_mode": ["handler"]}
+    for values in itertools.product(*[matrix.get(key, defaults.get(key)) for key in keys]):
+        yield dict(zip(keys, values))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("matrix", help="JSON file describing the matrix to sweep (see config/scalability_matrix.json)")
+    parser.add_argument("--output", default="scalability_results.jsonl",
+                        help="JSON lines file, one line per matrix point is appended")
+    parser.add_argument("--binary-dir", default=os.path.dirname(os.path.abspath(sys.argv[0])),
+                        help="Directory containing scalability_provider and scalability_consumer")
+    args = parser.parse_args()
+
+    with open(args.matrix, "r") as matrix_fp:
+        matrix = json.load(matrix_fp)
+
+    with open(args.output, "a") as output_fp:
+        for point in matrix_points(matrix):
+            with tempfile.TemporaryDirectory(prefix="lola_scalability_") as work_dir:
+                print(f"Running {point}", flush=True)
+                result = run_point(args.binary_dir, point, work_dir, matrix)
+                output_fp.write(json.dumps(result) + "\n")
+                output_fp.flush()
+                latency = result["consumer"]["latency_ns"]
+                print(f"  consumer samples/s: {result['consumer']['samples_per_s']:.0f}, "
+                      f"latency p50/p99: {latency['p50']}/{latency['p99']} ns, "
+                      f"failed processes: {result['failed_processes']}", flush=True)
+
+
+if __name__ == "__main__":
+    main()
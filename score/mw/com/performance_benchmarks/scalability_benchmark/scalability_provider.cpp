@@ -0,0 +1,226 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/benchmark_statistics.h"
+#include "score/mw/com/performance_benchmarks/scalability_benchmark/scalability_interface.h"
+#include "score/mw/com/runtime.h"
+#include "score/mw/com/test/common_test_resources/stop_token_sig_term_handler.h"
+#include "score/mw/com/types.h"
+#include "score/mw/log/logging.h"
+
+#include <score/stop_token.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// LogContext SPrv -> ScalabilityProvider
+constexpr std::string_view kLogContext{"SPrv"};
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+struct ProviderArguments
+{
+    std::uint32_t provider_index{0U};
+    std::uint32_t number_of_events{1U};
+    std::uint32_t send_rate_hz{100U};
+    std::uint32_t payload_size{64U};
+    std::string result_file{};
+    std::string service_instance_manifest{};
+};
+
+std::optional<ProviderArguments> ParseProviderArguments(int argc, const char** argv)
+{
+    namespace po = boost::program_options;
+    po::options_description options;
+
+    ProviderArguments args{};
+    // clang-format off
+    options.add_options()("help", "Display the help message")
+        ("provider-index", po::value<std::uint32_t>(&args.provider_index)->required(), "Index of this provider process within the benchmark run.")
+        ("num-events", po::value<std::uint32_t>(&args.number_of_events)->required(), "Number of events (service instances) offered by this provider.")
+        ("rate-hz", po::value<std::uint32_t>(&args.send_rate_hz)->required(), "Send rate per event in Hz.")
+        ("payload-size", po::value<std::uint32_t>(&args.payload_size)->required(), "Number of payload bytes written per sample.")
+        ("result-file", po::value<std::string>(&args.result_file)->required(), "Path of the JSON report written on shutdown.")
+        ("service-instance-manifest", po::value<std::string>(&args.service_instance_manifest)->required(), "Path to the mw_com_config.json generated for this run.");
+    // clang-format on
+
+    po::variables_map arg_map;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, options), arg_map);
+        if (arg_map.count("help") > 0U)
+        {
+            std::cerr << options << std::endl;
+            return std::nullopt;
+        }
+        po::notify(arg_map);
+    }
+    catch (const po::error& error)
+    {
+        std::cerr << error.what() << "\n" << options << std::endl;
+        return std::nullopt;
+    }
+
+    if ((args.payload_size > kScalabilityMaxPayloadSize) || (args.send_rate_hz == 0U) || (args.number_of_events == 0U))
+    {
+        std::cerr << "payload-size must not exceed " << kScalabilityMaxPayloadSize
+                  << " and rate-hz/num-events must not be 0." << std::endl;
+        return std::nullopt;
+    }
+    return args;
+}
+
+std::optional<std::vector<ScalabilitySkeleton>> CreateAndOfferSkeletons(const ProviderArguments& args)
+{
+    std::vector<ScalabilitySkeleton> skeletons{};
+    skeletons.reserve(args.number_of_events);
+    for (std::uint32_t event_index = 0U; event_index < args.number_of_events; ++event_index)
+    {
+        const auto instance_specifier_string = GetScalabilityInstanceSpecifier(args.provider_index, event_index);
+        auto instance_specifier_result = InstanceSpecifier::Create(instance_specifier_string);
+        if (!instance_specifier_result.has_value())
+        {
+            mw::log::LogError(kLogContext) << "Could not create instance specifier " << instance_specifier_string;
+            return std::nullopt;
+        }
+
+        auto skeleton_result = ScalabilitySkeleton::Create(std::move(instance_specifier_result).value());
+        if (!skeleton_result.has_value())
+        {
+            mw::log::LogError(kLogContext) << "Could not create skeleton " << instance_specifier_string << ": "
+                                           << skeleton_result.error();
+            return std::nullopt;
+        }
+
+        auto& skeleton = skeletons.emplace_back(std::move(skeleton_result).value());
+        const auto offer_result = skeleton.OfferService();
+        if (!offer_result.has_value())
+        {
+            mw::log::LogError(kLogContext) << "Could not offer " << instance_specifier_string << ": "
+                                           << offer_result.error();
+            return std::nullopt;
+        }
+    }
+    return skeletons;
+}
+
+bool RunProvider(const ProviderArguments& args, score::cpp::stop_token stop_token)
+{
+    const auto start_usage = GetProcessResourceUsage();
+    const auto start_time = std::chrono::steady_clock::now();
+
+    auto skeletons = CreateAndOfferSkeletons(args);
+    if (!skeletons.has_value())
+    {
+        return false;
+    }
+    mw::log::LogInfo(kLogContext) << "Provider " << args.provider_index << " offers " << args.number_of_events
+                                  << " events.";
+
+    const std::chrono::nanoseconds send_period{1'000'000'000U / args.send_rate_hz};
+    auto next_send_time = std::chrono::steady_clock::now();
+    std::uint64_t sequence_number{0U};
+    ProcessReport report{};
+    report.role = "provider";
+    report.process_index = args.provider_index;
+
+    while (!stop_token.stop_requested())
+    {
+        for (auto& skeleton : skeletons.value())
+        {
+            auto sample_result = skeleton.scalability_event.Allocate();
+            if (!sample_result.has_value())
+            {
+                // Consumers holding all slots is a legit outcome of an overloaded configuration, so it is counted
+                // instead of aborting the run.
+                report.errors++;
+                continue;
+            }
+            auto sample = std::move(sample_result).value();
+            std::memset(sample->data.data(), static_cast<int>(sequence_number & 0xFFU), args.payload_size);
+            sample->payload_size = args.payload_size;
+            sample->sequence_number = sequence_number;
+            sample->send_timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                            std::chrono::steady_clock::now().time_since_epoch())
+                                            .count();
+            if (skeleton.scalability_event.Send(std::move(sample)).has_value())
+            {
+                report.samples++;
+                report.payload_bytes += args.payload_size;
+            }
+            else
+            {
+                report.errors++;
+            }
+        }
+        sequence_number++;
+
+        // Sleeping until an absolute point in time keeps the rate stable, even if sending takes a considerable share
+        // of the period. If we are late, we send the next round immediately instead of bursting to catch up.
+        next_send_time = std::max(next_send_time + send_period, std::chrono::steady_clock::now());
+        std::this_thread::sleep_until(next_send_time);
+    }
+
+    for (auto& skeleton : skeletons.value())
+    {
+        skeleton.StopOfferService();
+    }
+
+    report.duration_us = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count());
+    report.resource_usage = GetProcessResourceUsage() - start_usage;
+    if (!WriteJsonReportToFile(args.result_file, report))
+    {
+        mw::log::LogError(kLogContext) << "Could not write result file " << args.result_file;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+}  // namespace score::mw::com::test
+
+int main(int argc, const char** argv)
+{
+    score::cpp::stop_source stop_source{};
+    if (!score::mw::com::SetupStopTokenSigTermHandler(stop_source))
+    {
+        std::cerr << "Unable to set signal handler for SIGINT and/or SIGTERM.\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto args = score::mw::com::test::ParseProviderArguments(argc, argv);
+    if (!args.has_value())
+    {
+        return EXIT_FAILURE;
+    }
+
+    score::mw::com::runtime::InitializeRuntime(
+        score::mw::com::runtime::RuntimeConfiguration{args->service_instance_manifest});
+
+    return score::mw::com::test::RunProvider(args.value(), stop_source.get_token()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
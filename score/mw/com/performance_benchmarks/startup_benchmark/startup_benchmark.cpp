@@ -0,0 +1,268 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/impl/startup_timeline.h"
+#include "score/mw/com/performance_benchmarks/startup_benchmark/startup_phase_summary.h"
+#include "score/mw/com/runtime.h"
+#include "score/mw/com/types.h"
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+namespace
+{
+
+constexpr std::uint16_t kServiceId{6530U};
+constexpr auto kServiceTypeName = "/score/mw/com/performance_benchmarks/StartupBenchmark";
+constexpr auto kEventName = "startup_event";
+
+template <typename T>
+struct StartupInterface : public T::Base
+{
+    using T::Base::Base;
+    typename T::template Event<std::uint64_t> startup_event{*this, kEventName};
+};
+
+using StartupProxy = AsProxy<StartupInterface>;
+using StartupSkeleton = AsSkeleton<StartupInterface>;
+
+struct StartupArguments
+{
+    std::uint32_t number_of_skeletons{1U};
+    std::uint32_t number_of_proxies{1U};
+    std::string trace_output{};
+    std::string configuration_output{};
+};
+
+std::optional<StartupArguments> ParseStartupArguments(int argc, const char** argv)
+{
+    namespace po = boost::program_options;
+    po::options_description options;
+
+    StartupArguments args{};
+    // clang-format off
+    options.add_options()("help", "Display the help message")
+        ("num-skeletons", po::value<std::uint32_t>(&args.number_of_skeletons)->default_value(16U), "Number of service instances created and offered.")
+        ("num-proxies", po::value<std::uint32_t>(&args.number_of_proxies)->default_value(16U), "Number of proxies, which are distributed round robin over the service instances.")
+        ("trace-output", po::value<std::string>(&args.trace_output)->default_value("startup_timeline.json"), "Path of the Chrome trace JSON written at the end of the bring-up.")
+        ("configuration-output", po::value<std::string>(&args.configuration_output)->default_value("startup_benchmark_mw_com_config.json"), "Path of the mw_com_config.json generated for this run.");
+    // clang-format on
+
+    po::variables_map arg_map;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, options), arg_map);
+        if (arg_map.count("help") > 0U)
+        {
+            std::cerr << options << std::endl;
+            return std::nullopt;
+        }
+        po::notify(arg_map);
+    }
+    catch (const po::error& error)
+    {
+        std::cerr << error.what() << "\n" << options << std::endl;
+        return std::nullopt;
+    }
+
+    if (args.number_of_skeletons == 0U)
+    {
+        std::cerr << "num-skeletons must not be 0." << std::endl;
+        return std::nullopt;
+    }
+    return args;
+}
+
+std::string GetInstanceSpecifier(const std::uint32_t instance_index)
+{
+    return "score/mw/com/performance_benchmarks/startup_benchmark/instance_" + std::to_string(instance_index);
+}
+
+/// \brief Writes a configuration with one service instance per skeleton, which can serve all proxies assigned to it.
+bool WriteConfiguration(const StartupArguments& args)
+{
+    const auto proxies_per_instance =
+        (args.number_of_proxies + args.number_of_skeletons - 1U) / args.number_of_skeletons;
+
+    std::ostringstream config{};
+    config << R"({"serviceTypes":[{"serviceTypeName":")" << kServiceTypeName
+           << R"(","version":{"major":1,"minor":0},"bindings":[{"binding":"SHM","serviceId":)" << kServiceId
+           << R"(,"events":[{"eventName":")" << kEventName << R"(","eventId":1}]}]}],"serviceInstances":[)";
+    for (std::uint32_t instance_index = 0U; instance_index < args.number_of_skeletons; ++instance_index)
+    {
+        config << (instance_index == 0U ? "" : ",") << R"({"instanceSpecifier":")"
+               << GetInstanceSpecifier(instance_index) << R"(","serviceTypeName":")" << kServiceTypeName
+               << R"(","version":{"major":1,"minor":0},"instances":[{"instanceId":)" << (instance_index + 1U)
+               << R"(,"asil-level":"QM","binding":"SHM","events":[{"eventName":")" << kEventName
+               << R"(","numberOfSampleSlots":)" << (proxies_per_instance + 1U) << R"(,"maxSubscribers":)"
+               << std::max(proxies_per_instance, 1U) << "}]}]}";
+    }
+    config << R"(],"global":{"asil-level":"QM"}})";
+
+    std::ofstream file{args.configuration_output, std::ios::out | std::ios::trunc};
+    file << config.str();
+    file.close();
+    return static_cast<bool>(file);
+}
+
+std::optional<std::vector<StartupSkeleton>> CreateAndOfferSkeletons(const StartupArguments& args)
+{
+    std::vector<StartupSkeleton> skeletons{};
+    skeletons.reserve(args.number_of_skeletons);
+    for (std::uint32_t instance_index = 0U; instance_index < args.number_of_skeletons; ++instance_index)
+    {
+        const auto instance_specifier_string = GetInstanceSpecifier(instance_index);
+        const impl::StartupTimeline::Phase phase{"CreateAndOfferSkeleton", instance_specifier_string};
+        auto instance_specifier_result = InstanceSpecifier::Create(instance_specifier_string);
+        if (!instance_specifier_result.has_value())
+        {
+            std::cerr << "Could not create instance specifier " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+
+        auto skeleton_result = StartupSkeleton::Create(std::move(instance_specifier_result).value());
+        if (!skeleton_result.has_value())
+        {
+            std::cerr << "Could not create skeleton " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+
+        auto& skeleton = skeletons.emplace_back(std::move(skeleton_result).value());
+        if (!skeleton.OfferService().has_value())
+        {
+            std::cerr << "Could not offer " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+    }
+    return skeletons;
+}
+
+std::optional<std::vector<StartupProxy>> FindAndSubscribeProxies(const StartupArguments& args)
+{
+    std::vector<StartupProxy> proxies{};
+    proxies.reserve(args.number_of_proxies);
+    for (std::uint32_t proxy_index = 0U; proxy_index < args.number_of_proxies; ++proxy_index)
+    {
+        const auto instance_specifier_string = GetInstanceSpecifier(proxy_index % args.number_of_skeletons);
+        const impl::StartupTimeline::Phase phase{"FindAndSubscribeProxy", instance_specifier_string};
+        auto instance_specifier_result = InstanceSpecifier::Create(instance_specifier_string);
+        if (!instance_specifier_result.has_value())
+        {
+            std::cerr << "Could not create instance specifier " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+
+        const auto find_service_result = StartupProxy::FindService(std::move(instance_specifier_result).value());
+        if ((!find_service_result.has_value()) || find_service_result.value().empty())
+        {
+            std::cerr << "Could not find " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+
+        auto proxy_result = StartupProxy::Create(find_service_result.value().front());
+        if (!proxy_result.has_value())
+        {
+            std::cerr << "Could not create proxy for " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+
+        auto& proxy = proxies.emplace_back(std::move(proxy_result).value());
+        if (!proxy.startup_event.Subscribe(1U).has_value())
+        {
+            std::cerr << "Could not subscribe to " << instance_specifier_string << std::endl;
+            return std::nullopt;
+        }
+    }
+    return proxies;
+}
+
+bool RunStartupBenchmark(const StartupArguments& args)
+{
+    const auto start_time = impl::StartupTimeline::Clock::now();
+
+    // The command line options of the runtime are used, so that configuration parsing is already part of the timeline.
+    const std::string program_name{"startup_benchmark"};
+    const std::string configuration_key{"--service_instance_manifest"};
+    const std::string timeline_key{"--startup_timeline_output"};
+    std::vector<score::StringLiteral> runtime_args{program_name.c_str(),
+                                                   configuration_key.c_str(),
+                                                   args.configuration_output.c_str(),
+                                                   timeline_key.c_str(),
+                                                   args.trace_output.c_str()};
+    runtime::InitializeRuntime(static_cast<std::int32_t>(runtime_args.size()), runtime_args.data());
+
+    auto skeletons = CreateAndOfferSkeletons(args);
+    if (!skeletons.has_value())
+    {
+        return false;
+    }
+    auto proxies = FindAndSubscribeProxies(args);
+    if (!proxies.has_value())
+    {
+        return false;
+    }
+    const auto bring_up_duration = impl::StartupTimeline::Clock::now() - start_time;
+
+    const auto write_result = runtime::WriteStartupTimeline();
+    if (!write_result.has_value())
+    {
+        std::cerr << "Could not write startup timeline to " << args.trace_output << std::endl;
+        return false;
+    }
+
+    std::cout << "Bring-up of " << args.number_of_skeletons << " skeletons and " << args.number_of_proxies
+              << " proxies took "
+              << std::chrono::duration_cast<std::chrono::microseconds>(bring_up_duration).count() << " us\n";
+    PrintPhaseSummaries(std::cout, SummarizePhases(impl::StartupTimeline::GetInstance().GetEntries()));
+    std::cout << "Chrome trace written to " << args.trace_output << std::endl;
+
+    for (auto& skeleton : skeletons.value())
+    {
+        skeleton.StopOfferService();
+    }
+    return true;
+}
+
+}  // namespace
+
+}  // namespace score::mw::com::test
+
+int main(int argc, const char** argv)
+{
+    const auto args = score::mw::com::test::ParseStartupArguments(argc, argv);
+    if (!args.has_value())
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (!score::mw::com::test::WriteConfiguration(args.value()))
+    {
+        std::cerr << "Could not write configuration " << args->configuration_output << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return score::mw::com::test::RunStartupBenchmark(args.value()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,54 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/startup_benchmark/startup_phase_summary.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace score::mw::com::test
+{
+
+std::vector<PhaseSummary> SummarizePhases(const std::vector<impl::StartupTimeline::Entry>& entries)
+{
+    std::vector<PhaseSummary> summaries{};
+    for (const auto& entry : entries)
+    {
+        auto summary = std::find_if(summaries.begin(), summaries.end(), [&entry](const PhaseSummary& candidate) {
+            return candidate.name == entry.name;
+        });
+        if (summary == summaries.end())
+        {
+            summary = summaries.insert(summaries.end(), PhaseSummary{entry.name, 0U, {}, {}});
+        }
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(entry.end - entry.begin);
+        summary->count++;
+        summary->total += duration;
+        summary->max = std::max(summary->max, duration);
+    }
+    return summaries;
+}
+
+void PrintPhaseSummaries(std::ostream& stream, const std::vector<PhaseSummary>& summaries)
+{
+    stream << std::left << std::setw(36) << "phase" << std::right << std::setw(8) << "count" << std::setw(14)
+           << "total [us]" << std::setw(14) << "mean [us]" << std::setw(14) << "max [us]" << "\n";
+    for (const auto& summary : summaries)
+    {
+        const auto mean = summary.count == 0U ? 0 : summary.total.count() / static_cast<std::int64_t>(summary.count);
+        stream << std::left << std::setw(36) << summary.name << std::right << std::setw(8) << summary.count
+               << std::setw(14) << summary.total.count() << std::setw(14) << mean << std::setw(14)
+               << summary.max.count() << "\n";
+    }
+}
+
+}  // namespace score::mw::com::test
@@ -0,0 +1,45 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_PERFORMANCE_BENCHMARKS_STARTUP_BENCHMARK_STARTUP_PHASE_SUMMARY_H
+#define SCORE_MW_COM_PERFORMANCE_BENCHMARKS_STARTUP_BENCHMARK_STARTUP_PHASE_SUMMARY_H
+
+#include "score/mw/com/impl/startup_timeline.h"
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace score::mw::com::test
+{
+
+/// \brief Accumulated duration of all recorded occurrences of one startup phase, e.g. of PrepareOffer over all
+///        service instances.
+struct PhaseSummary
+{
+    std::string name{};
+    std::size_t count{0U};
+    std::chrono::microseconds total{0};
+    std::chrono::microseconds max{0};
+};
+
+/// \brief Groups the recorded phases by name in the order in which each name was recorded first.
+std::vector<PhaseSummary> SummarizePhases(const std::vector<impl::StartupTimeline::Entry>& entries);
+
+/// \brief Prints one line with count, total, mean and max duration per phase.
+void PrintPhaseSummaries(std::ostream& stream, const std::vector<PhaseSummary>& summaries);
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_PERFORMANCE_BENCHMARKS_STARTUP_BENCHMARK_STARTUP_PHASE_SUMMARY_H
@@ -0,0 +1,73 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/performance_benchmarks/startup_benchmark/startup_phase_summary.h"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace score::mw::com::test
+{
+namespace
+{
+
+using Clock = impl::StartupTimeline::Clock;
+
+impl::StartupTimeline::Entry MakeEntry(const std::string& name, const std::int64_t begin_us, const std::int64_t end_us)
+{
+    return impl::StartupTimeline::Entry{name,
+                                        "instance",
+                                        Clock::time_point{std::chrono::microseconds{begin_us}},
+                                        Clock::time_point{std::chrono::microseconds{end_us}},
+                                        0U};
+}
+
+TEST(StartupPhaseSummaryTest, GroupsPhasesByNameInOrderOfFirstOccurrence)
+{
+    // Given phases of two names, which occurred several times
+    const std::vector<impl::StartupTimeline::Entry> entries{MakeEntry("CreateSharedMemory", 0, 100),
+                                                            MakeEntry("OfferService", 0, 150),
+                                                            MakeEntry("CreateSharedMemory", 200, 500)};
+
+    // When summarizing them
+    const auto summaries = SummarizePhases(entries);
+
+    // Then there is one summary per name with count, total and max duration
+    ASSERT_EQ(summaries.size(), 2U);
+    EXPECT_EQ(summaries.at(0).name, "CreateSharedMemory");
+    EXPECT_EQ(summaries.at(0).count, 2U);
+    EXPECT_EQ(summaries.at(0).total, std::chrono::microseconds{400});
+    EXPECT_EQ(summaries.at(0).max, std::chrono::microseconds{300});
+    EXPECT_EQ(summaries.at(1).name, "OfferService");
+    EXPECT_EQ(summaries.at(1).count, 1U);
+    EXPECT_EQ(summaries.at(1).total, std::chrono::microseconds{150});
+}
+
+TEST(StartupPhaseSummaryTest, PrintsOneLinePerPhase)
+{
+    // Given the summary of a single phase
+    const auto summaries = SummarizePhases({MakeEntry("FindService", 0, 10), MakeEntry("FindService", 10, 40)});
+
+    // When printing it
+    std::ostringstream stream{};
+    PrintPhaseSummaries(stream, summaries);
+
+    // Then a header and one line with count, total, mean and max are printed
+    const auto output = stream.str();
+    EXPECT_NE(output.find("phase"), std::string::npos);
+    EXPECT_NE(output.find("FindService"), std::string::npos);
+    EXPECT_NE(output.find("       2            40            20            30"), std::string::npos);
+}
+
+}  // namespace
+}  // namespace score::mw::com::test
@@ -14,6 +14,7 @@
 
 #include "score/mw/com/impl/com_error.h"
 #include "score/mw/com/impl/runtime.h"
+#include "score/mw/com/impl/startup_timeline.h"
 
 #include "score/memory/string_literal.h"
 #include "score/result/result.h"
@@ -74,4 +75,14 @@ void InitializeRuntime(const RuntimeConfiguration& runtime_configuration)
     impl::Runtime::Initialize(runtime_configuration);
 }
 
+score::Result<void> WriteStartupTimeline()
+{
+    if (auto* const runtime_mock_holder = detail::RuntimeMockHolder::GetRuntimeMock())
+    {
+        return runtime_mock_holder->WriteStartupTimeline();
+    }
+
+    return impl::StartupTimeline::GetInstance().WriteChromeTrace();
+}
+
 }  // namespace score::mw::com::runtime
@@ -93,6 +93,16 @@ void InitializeRuntime(const std::int32_t argc, score::StringLiteral argv[]);
  */
 void InitializeRuntime(const RuntimeConfiguration& runtime_configuration);
 
+/**
+ * \api
+ * \brief Writes the startup phases of mw::com recorded so far as Chrome trace JSON (loadable in chrome://tracing or
+ *        Perfetto) to the path given via the command-line option "--startup_timeline_output".
+ * \details Shall be called by the application at the end of its bring-up, e.g. after all services were offered and
+ *          found. Recording of the startup phases only takes place, if the option was passed to InitializeRuntime().
+ * \return Blank result on success, kErroneousFileHandle if recording is not enabled or the file could not be written.
+ */
+score::Result<void> WriteStartupTimeline();
+
 }  // namespace score::mw::com::runtime
 
 #endif  // SCORE_MW_COM_RUNTIME_H
@@ -34,24 +34,27 @@ namespace
 constexpr auto kDefaultConfigurationPath = "./etc/mw_com_config.json";
 constexpr auto kDeprecatedConfigurationPathCommandLineKey = std::string_view{"-service_instance_manifest"};
 constexpr auto kConfigurationPathCommandLineKey = std::string_view{"--service_instance_manifest"};
+constexpr auto kStartupTimelineOutputCommandLineKey = std::string_view{"--startup_timeline_output"};
 
 }  // namespace
 
 RuntimeConfiguration::RuntimeConfiguration() : RuntimeConfiguration{kDefaultConfigurationPath} {}
 
 RuntimeConfiguration::RuntimeConfiguration(filesystem::Path configuration_path)
-    : configuration_path_{std::move(configuration_path)}
+    : configuration_path_{std::move(configuration_path)}, startup_timeline_output_path_{}
 {
 }
 
 // NOLINTNEXTLINE(modernize-avoid-c-arrays):C-style array tolerated for command line arguments
-RuntimeConfiguration::RuntimeConfiguration(const std::int32_t argc, score::StringLiteral argv[]) : configuration_path_{}
+RuntimeConfiguration::RuntimeConfiguration(const std::int32_t argc, score::StringLiteral argv[])
+    : configuration_path_{}, startup_timeline_output_path_{}
 {
     const score::cpp::span<const score::StringLiteral> command_line_arguments(
         argv, static_cast<score::cpp::span<const score::StringLiteral>::size_type>(argc));
     auto configuration_path = ParseConfigurationPath(command_line_arguments);
     configuration_path_ =
         configuration_path.has_value() ? std::move(configuration_path).value() : kDefaultConfigurationPath;
+    startup_timeline_output_path_ = ParseStartupTimelineOutputPath(command_line_arguments);
 }
 
 const filesystem::Path& RuntimeConfiguration::GetConfigurationPath() const&
@@ -59,6 +62,11 @@ const filesystem::Path& RuntimeConfiguration::GetConfigurationPath() const&
     return configuration_path_;
 }
 
+const std::optional<filesystem::Path>& RuntimeConfiguration::GetStartupTimelineOutputPath() const&
+{
+    return startup_timeline_output_path_;
+}
+
 std::optional<filesystem::Path> RuntimeConfiguration::ParseConfigurationPath(
     const score::cpp::span<const score::StringLiteral> command_line_args)
 {
@@ -99,4 +107,28 @@ std::optional<filesystem::Path> RuntimeConfiguration::ParseConfigurationPath(
     return configuration_path;
 }
 
+std::optional<filesystem::Path> RuntimeConfiguration::ParseStartupTimelineOutputPath(
+    const score::cpp::span<const score::StringLiteral> command_line_args)
+{
+    const auto num_args = command_line_args.size();
+    for (std::uint32_t arg_idx = 0U; arg_idx < num_args; arg_idx++)
+    {
+        const std::string& command_line_argument_key{
+            score::cpp::at(command_line_args, static_cast<std::ptrdiff_t>(arg_idx))};
+        if (command_line_argument_key == kStartupTimelineOutputCommandLineKey)
+        {
+            const auto index_of_output_path = arg_idx + 1U;
+            if (index_of_output_path >= num_args)
+            {
+                score::mw::log::LogFatal("lola")
+                    << "Command line arguments contains key\"" << kStartupTimelineOutputCommandLineKey
+                    << "\" but no corresponding value. Terminating.";
+                std::terminate();
+            }
+            return score::cpp::at(command_line_args, static_cast<std::ptrdiff_t>(index_of_output_path));
+        }
+    }
+    return {};
+}
+
 }  // namespace score::mw::com::runtime
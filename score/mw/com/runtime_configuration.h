@@ -62,11 +62,23 @@ class RuntimeConfiguration
      */
     const filesystem::Path& GetConfigurationPath() const&;
 
+    /**
+     * \api
+     * \brief Returns the path, to which the startup timeline shall be written.
+     * \details Only set, if the command line arguments contain the key "--startup_timeline_output". In this case the
+     *          startup phases of mw::com are recorded and written as Chrome trace JSON to this path.
+     * \return The stored startup timeline output path, if any.
+     */
+    const std::optional<filesystem::Path>& GetStartupTimelineOutputPath() const&;
+
   private:
     static std::optional<filesystem::Path> ParseConfigurationPath(
         const score::cpp::span<const score::StringLiteral> command_line_args);
+    static std::optional<filesystem::Path> ParseStartupTimelineOutputPath(
+        const score::cpp::span<const score::StringLiteral> command_line_args);
 
     filesystem::Path configuration_path_;
+    std::optional<filesystem::Path> startup_timeline_output_path_;
 };
 
 }  // namespace score::mw::com::runtime
@@ -40,6 +40,8 @@ using ::testing::Return;
 constexpr auto kDeprecatedConfigurationPathCommandLineKey = "-service_instance_manifest";
 constexpr auto kConfigurationPathCommandLineKey = "--service_instance_manifest";
 constexpr auto kDefaultConfigurationPath = "./etc/mw_com_config.json";
+constexpr auto kStartupTimelineOutputCommandLineKey = "--startup_timeline_output";
+constexpr auto kDummyStartupTimelineOutputPath = "/tmp/startup_timeline.json";
 
 constexpr auto kDummyConfigurationPath = "/my/configuration/path/mw_com_config.json";
 constexpr auto kDummyApplicationName = "dummyname";
@@ -162,6 +164,39 @@ TEST(RuntimeConfigurationCommandLineConstructorTest, ConfigurationPathContainsDe
     EXPECT_EQ(stored_configuration_path.Native(), kDefaultConfigurationPath);
 }
 
+TEST(RuntimeConfigurationCommandLineConstructorTest, StartupTimelineOutputPathIsEmptyIfNoKeyInCommandLineArgs)
+{
+    // Given command line arguments which contain only a configuration path
+    std::vector<score::StringLiteral> arguments = {
+        kDummyApplicationName, kConfigurationPathCommandLineKey, kDummyConfigurationPath};
+    auto [argc, argv] = GenerateCommandLineArgs(arguments);
+
+    // When constructing a RuntimeConfiguration
+    const RuntimeConfiguration runtime_configuration{argc, argv};
+
+    // Then no startup timeline output path is stored
+    EXPECT_FALSE(runtime_configuration.GetStartupTimelineOutputPath().has_value());
+}
+
+TEST(RuntimeConfigurationCommandLineConstructorTest, StartupTimelineOutputPathContainsPathInCommandLineArgs)
+{
+    // Given command line arguments which contain a configuration path and a startup timeline output path
+    std::vector<score::StringLiteral> arguments = {kDummyApplicationName,
+                                                   kConfigurationPathCommandLineKey,
+                                                   kDummyConfigurationPath,
+                                                   kStartupTimelineOutputCommandLineKey,
+                                                   kDummyStartupTimelineOutputPath};
+    auto [argc, argv] = GenerateCommandLineArgs(arguments);
+
+    // When constructing a RuntimeConfiguration
+    const RuntimeConfiguration runtime_configuration{argc, argv};
+
+    // Then both paths are stored
+    EXPECT_EQ(runtime_configuration.GetConfigurationPath().Native(), kDummyConfigurationPath);
+    ASSERT_TRUE(runtime_configuration.GetStartupTimelineOutputPath().has_value());
+    EXPECT_EQ(runtime_configuration.GetStartupTimelineOutputPath().value().Native(), kDummyStartupTimelineOutputPath);
+}
+
 TEST(RuntimeConfigurationCommandLineConstructorDeathTest, TerminatesIfCommandLineArgsContainPathKeyButNoPath)
 {
     // Given command line arguments which contain a configuration path key but no configuration path
@@ -184,5 +219,16 @@ TEST(RuntimeConfigurationCommandLineConstructorDeathTest, TerminatesIfCommandLin
     EXPECT_DEATH(RuntimeConfiguration(argc, argv), ".*");
 }
 
+TEST(RuntimeConfigurationCommandLineConstructorDeathTest, TerminatesIfCommandLineArgsContainStartupTimelineKeyButNoPath)
+{
+    // Given command line arguments which contain a startup timeline output key but no path
+    std::vector<score::StringLiteral> arguments = {kDummyApplicationName, kStartupTimelineOutputCommandLineKey};
+    auto [argc, argv] = GenerateCommandLineArgs(arguments);
+
+    // When constructing a RuntimeConfiguration
+    // Then the process terminates
+    EXPECT_DEATH(RuntimeConfiguration(argc, argv), ".*");
+}
+
 }  // namespace
 }  // namespace score::mw::com::runtime
@@ -0,0 +1,158 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/test/methods/priority_scheduling_test/consumer.h"
+
+#include "score/mw/com/test/common_test_resources/fail_test.h"
+#include "score/mw/com/test/common_test_resources/process_synchronizer.h"
+#include "score/mw/com/test/common_test_resources/proxy_container.h"
+#include "score/mw/com/test/methods/priority_scheduling_test/test_method_datatype.h"
+#include "score/mw/com/types.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace score::mw::com::test
+{
+namespace
+{
+
+const std::string kInterprocessNotificationShmPath{"/priority_sched_test_interprocess_notification"};
+
+const InstanceSpecifier kInstanceSpecifier =
+    InstanceSpecifier::Create(std::string{"test/methods/priority_scheduling_test/TestMethods"}).value();
+
+/// \brief Number of proxies, which call the bulk method back to back. Since every proxy has a method queue size of 1,
+///        each of them has at most one pending bulk call at the provider.
+constexpr std::size_t kNumberOfFloodingProxies{8U};
+constexpr std::size_t kNumberOfUrgentCalls{50U};
+constexpr std::chrono::milliseconds kFloodWarmUpTime{200};
+constexpr std::chrono::milliseconds kTimeBetweenUrgentCalls{5};
+
+/// \brief Upper bound of the latency of an urgent call during the flood. Without priority scheduling an urgent call
+///        would queue behind up to kNumberOfFloodingProxies bulk calls, i.e. take up to 8 * kBulkHandlerDuration.
+///        With priority scheduling, at most one bulk call executes at a time (maxConcurrentCalls 1) and a second
+///        worker is left for the urgent call, so that it doesn't wait for a bulk call at all. We allow for one bulk
+///        call plus margin to keep the test robust on loaded machines.
+constexpr std::chrono::milliseconds kMaxUrgentCallLatency{2 * kBulkHandlerDuration};
+
+void FloodBulkMethod(TestMethodProxy& proxy, const std::atomic<bool>& stop_flooding, std::atomic<std::size_t>& count)
+{
+    std::int32_t value{0};
+    while (!stop_flooding.load())
+    {
+        auto method_return_result = proxy.bulk(value);
+        if (!(method_return_result.has_value()))
+        {
+            FailTest("Consumer: bulk call failed: ", method_return_result.error());
+        }
+        value++;
+        count++;
+    }
+}
+
+std::chrono::steady_clock::duration CallUrgentMethod(TestMethodProxy& proxy, const std::int32_t value)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto method_return_result = proxy.urgent(value);
+    const auto latency = std::chrono::steady_clock::now() - start;
+    if (!(method_return_result.has_value()))
+    {
+        FailTest("Consumer: urgent call failed: ", method_return_result.error());
+    }
+    if (*(method_return_result.value()) != value)
+    {
+        FailTest("Consumer: urgent expected ", value, " but got ", *(method_return_result.value()));
+    }
+    return latency;
+}
+
+}  // namespace
+
+void run_consumer()
+{
+    auto process_synchronizer_result = ProcessSynchronizer::Create(kInterprocessNotificationShmPath);
+    if (!(process_synchronizer_result.has_value()))
+    {
+        FailTest("Methods priority_scheduling_test consumer failed: Could not create ProcessSynchronizer");
+    }
+
+    // Set an exit function to notify the provider in case of failure in calls to FailTest, so that it does not wait
+    // indefinitely for the consumer to finish. Will also be called when the guard goes out of scope at the end of this
+    // function.
+    ExitFunctionGuard process_synchronizer_guard{[&process_synchronizer_result]() {
+        process_synchronizer_result->Notify();
+    }};
+
+    // Step 1. Find service and create the proxies
+    std::cout << "\nConsumer: Step 1" << std::endl;
+    ProxyContainer<TestMethodProxy> urgent_proxy_container{};
+    urgent_proxy_container.CreateProxy(kInstanceSpecifier, "priority_scheduling_test");
+    std::array<ProxyContainer<TestMethodProxy>, kNumberOfFloodingProxies> flooding_proxy_containers{};
+    for (auto& flooding_proxy_container : flooding_proxy_containers)
+    {
+        flooding_proxy_container.CreateProxy(kInstanceSpecifier, "priority_scheduling_test");
+    }
+
+    // Step 2. Flood the provider with bulk calls
+    std::cout << "\nConsumer: Step 2" << std::endl;
+    std::atomic<bool> stop_flooding{false};
+    std::atomic<std::size_t> bulk_call_count{0U};
+    std::vector<std::thread> flooding_threads{};
+    for (auto& flooding_proxy_container : flooding_proxy_containers)
+    {
+        flooding_threads.emplace_back([&flooding_proxy_container, &stop_flooding, &bulk_call_count]() {
+            FloodBulkMethod(flooding_proxy_container.GetProxy(), stop_flooding, bulk_call_count);
+        });
+    }
+    std::this_thread::sleep_for(kFloodWarmUpTime);
+
+    // Step 3. Call the urgent method during the flood and measure its latency
+    std::cout << "\nConsumer: Step 3" << std::endl;
+    std::chrono::steady_clock::duration max_latency{std::chrono::steady_clock::duration::zero()};
+    for (std::size_t call = 0U; call < kNumberOfUrgentCalls; ++call)
+    {
+        const auto latency = CallUrgentMethod(urgent_proxy_container.GetProxy(), static_cast<std::int32_t>(call));
+        max_latency = std::max(max_latency, latency);
+        std::this_thread::sleep_for(kTimeBetweenUrgentCalls);
+    }
+
+    stop_flooding = true;
+    for (auto& flooding_thread : flooding_threads)
+    {
+        flooding_thread.join();
+    }
+
+    const auto max_latency_us = std::chrono::duration_cast<std::chrono::microseconds>(max_latency).count();
+    std::cout << "Consumer: " << bulk_call_count.load() << " bulk calls, max urgent call latency " << max_latency_us
+              << " us" << std::endl;
+
+    // Step 4. Check that the urgent calls didn't queue behind the bulk calls
+    std::cout << "\nConsumer: Step 4" << std::endl;
+    if (max_latency > kMaxUrgentCallLatency)
+    {
+        FailTest("Consumer: urgent call latency of ",
+                 max_latency_us,
+                 " us exceeds bound of ",
+                 std::chrono::duration_cast<std::chrono::microseconds>(kMaxUrgentCallLatency).count(),
+                 " us");
+    }
+}
+
+}  // namespace score::mw::com::test
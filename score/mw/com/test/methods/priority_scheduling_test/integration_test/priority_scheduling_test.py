@@ -0,0 +1,35 @@
+# *******************************************************************************
+# Copyright (c) 2026 Contributors to the Eclipse Foundation
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+# *******************************************************************************
+
+
+def provider(target, **kwargs):
+    args = ["--service_instance_manifest", "./etc/mw_com_config.json"]
+    return target.wrap_exec("bin/main_provider", args, cwd="/opt/MainProviderApp", wait_on_exit=True, **kwargs)
+
+
+def consumer(target, **kwargs):
+    args = ["--service_instance_manifest", "./etc/mw_com_config.json"]
+    return target.wrap_exec("bin/main_consumer", args, cwd="/opt/MainConsumerApp", wait_on_exit=True, **kwargs)
+
+
+def test_priority_scheduling_test(target):
+    """Test that a high priority method stays responsive while a low priority method is flooded.
+
+    The first process creates a Skeleton instance with an "urgent" method of priority 200 and a "bulk" method of
+    priority 0 limited to one concurrent call, whose handler takes 20 ms.
+
+    The second process floods the "bulk" method from several proxies and calls the "urgent" method meanwhile,
+    verifying that no urgent call takes longer than two bulk calls.
+    """
+    with provider(target), consumer(target):
+        pass
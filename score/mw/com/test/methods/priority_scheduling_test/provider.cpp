@@ -0,0 +1,92 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#include "score/mw/com/test/methods/priority_scheduling_test/provider.h"
+
+#include "score/mw/com/test/common_test_resources/fail_test.h"
+#include "score/mw/com/test/common_test_resources/process_synchronizer.h"
+#include "score/mw/com/test/common_test_resources/skeleton_container.h"
+#include "score/mw/com/test/methods/priority_scheduling_test/test_method_datatype.h"
+#include "score/mw/com/types.h"
+
+#include "score/result/result.h"
+
+#include <score/stop_token.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+namespace score::mw::com::test
+{
+namespace
+{
+
+const std::string kInterprocessNotificationShmPath{"/priority_sched_test_interprocess_notification"};
+
+const InstanceSpecifier kInstanceSpecifier =
+    InstanceSpecifier::Create(std::string{"test/methods/priority_scheduling_test/TestMethods"}).value();
+
+}  // namespace
+
+void run_provider(const score::cpp::stop_token& stop_token)
+{
+    SkeletonContainer<TestMethodSkeleton> skeleton_container{};
+    auto process_synchronizer_result = ProcessSynchronizer::Create(kInterprocessNotificationShmPath);
+    if (!(process_synchronizer_result.has_value()))
+    {
+        FailTest("Methods priority_scheduling_test provider failed: Could not create ProcessSynchronizer");
+    }
+
+    // Step 1. Create skeleton
+    std::cout << "\nProvider: Step 1" << std::endl;
+    skeleton_container.CreateSkeleton(kInstanceSpecifier, "priority_scheduling_test");
+    auto& skeleton = skeleton_container.GetSkeleton();
+
+    // Step 2. Register method handlers
+    std::cout << "\nProvider: Step 2" << std::endl;
+    const auto register_urgent_result =
+        skeleton.urgent.RegisterHandler([](std::int32_t& return_value, const std::int32_t& value) {
+            return_value = value;
+        });
+    if (!register_urgent_result)
+    {
+        FailTest("Provider: Failed to register urgent handler");
+    }
+    const auto register_bulk_result =
+        skeleton.bulk.RegisterHandler([](std::int32_t& return_value, const std::int32_t& value) {
+            std::this_thread::sleep_for(kBulkHandlerDuration);
+            return_value = value;
+        });
+    if (!register_bulk_result)
+    {
+        FailTest("Provider: Failed to register bulk handler");
+    }
+
+    // Step 3. Offer service
+    std::cout << "\nProvider: Step 3" << std::endl;
+    skeleton_container.OfferService("priority_scheduling_test");
+
+    // Step 4. Wait for proxy test to finish
+    std::cout << "\nProvider: Step 4" << std::endl;
+    std::cout << "Provider: Ready for method calls" << std::endl;
+    if (!process_synchronizer_result->WaitWithAbort(stop_token))
+    {
+        FailTest(
+            "Methods priority_scheduling_test provider failed: WaitForProxyTestToFinish was stopped by "
+            "stop_token instead of notification");
+    }
+
+    std::cout << "Provider: Shutting down" << std::endl;
+}
+
+}  // namespace score::mw::com::test
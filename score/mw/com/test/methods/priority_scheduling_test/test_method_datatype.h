@@ -0,0 +1,50 @@
+/********************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+#ifndef SCORE_MW_COM_TEST_METHODS_PRIORITY_SCHEDULING_TEST_TEST_METHOD_DATATYPE_H
+#define SCORE_MW_COM_TEST_METHODS_PRIORITY_SCHEDULING_TEST_TEST_METHOD_DATATYPE_H
+
+#include "score/mw/com/types.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace score::mw::com::test
+{
+
+/// \brief Time, which the provider spends in every call of the bulk method.
+constexpr std::chrono::milliseconds kBulkHandlerDuration{20};
+
+/// \brief Test interface template following the mw::com traits pattern
+/// \tparam T Either ProxyTrait or SkeletonTrait
+template <typename T>
+class TestMethodInterface : public T::Base
+{
+  public:
+    using T::Base::Base;
+
+    /// \brief High priority method, which returns immediately.
+    typename T::template Method<std::int32_t(std::int32_t)> urgent{*this, "urgent"};
+
+    /// \brief Low priority method with a concurrency limit, which takes kBulkHandlerDuration.
+    typename T::template Method<std::int32_t(std::int32_t)> bulk{*this, "bulk"};
+};
+
+/// \brief Proxy side of the test service
+using TestMethodProxy = score::mw::com::AsProxy<TestMethodInterface>;
+
+/// \brief Skeleton side of the test service
+using TestMethodSkeleton = score::mw::com::AsSkeleton<TestMethodInterface>;
+
+}  // namespace score::mw::com::test
+
+#endif  // SCORE_MW_COM_TEST_METHODS_PRIORITY_SCHEDULING_TEST_TEST_METHOD_DATATYPE_H
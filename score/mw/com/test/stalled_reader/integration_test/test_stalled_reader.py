@@ -0,0 +1,31 @@
+# *******************************************************************************
+# Copyright (c) 2026 Contributors to the Eclipse Foundation
+#
+# See the NOTICE file(s) distributed with this work for additional
+# information regarding copyright ownership.
+#
+# This program and the accompanying materials are made available under the
+# terms of the Apache License Version 2.0 which is available at
+# https://www.apache.org/licenses/LICENSE-2.0
+#
+# SPDX-License-Identifier: Apache-2.0
+# *******************************************************************************
+
+"""Integration test for stalled_reader."""
+
+
+def stalled_reader(target, **kwargs):
+    args = []
+    return target.wrap_exec("bin/stalled_reader", args, cwd="/opt/stalled_reader", wait_on_exit=True, **kwargs)
+
+
+def test_stalled_reader(target):
+    """Test that a stalled reader, which holds all the sample slots, doesn't starve the other readers.
+
+    This is a loopback test where skeleton and proxies run in the same process.
+    The skeleton force-releases the stale references of the stalled reader after maxSampleHoldTimeMs, so that
+    the active reader keeps receiving samples. Afterwards the stalled reader drops its samples and has to
+    receive new samples again, without any slot being released twice.
+    """
+    with stalled_reader(target, wait_timeout=30):
+        pass
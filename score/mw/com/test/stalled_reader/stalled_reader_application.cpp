@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * Copyright (c) 2026 Contributors to the Eclipse Foundation
+ *
+ * See the NOTICE file(s) distributed with this work for additional
+ * information regarding copyright ownership.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *******************************************************************************/
+
+#include "score/mw/com/test/stalled_reader/stalled_reader_application.h"
+
+#include "score/mw/com/runtime.h"
+#include "score/mw/com/test/common_test_resources/assert_handler.h"
+#include "score/mw/com/test/common_test_resources/big_datatype.h"
+#include "score/mw/com/test/common_test_resources/stop_token_sig_term_handler.h"
+#include "score/mw/com/types.h"
+
+#include <score/stop_token.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace std::chrono_literals;
+
+/// \brief Has to match numberOfSampleSlots of dummy_data_stamped in mw_com_config.json
+constexpr std::size_t kNumberOfSampleSlots{4U};
+/// \brief Has to be well above maxSampleHoldTimeMs of dummy_data_stamped in mw_com_config.json
+constexpr std::chrono::milliseconds kStallDuration{2000ms};
+constexpr std::chrono::milliseconds kSendCycle{10ms};
+/// \brief Minimal number of samples, the active reader has to receive while the stalled reader blocks all slots
+constexpr std::size_t kMinSamplesDuringStall{20U};
+constexpr std::size_t kSamplesAfterStall{20U};
+
+score::Result<score::mw::com::test::BigDataProxy> CreateProxy(
+    const score::mw::com::InstanceSpecifier& instance_specifier)
+{
+    std::promise<std::vector<score::mw::com::test::BigDataProxy::HandleType>> service_discovery_promise{};
+    auto service_discovery_future = service_discovery_promise.get_future();
+    auto handles_result = score::mw::com::test::BigDataProxy::StartFindService(
+        [moved_service_discovery_promise = std::move(service_discovery_promise)](auto handles, auto handle) mutable {
+            moved_service_discovery_promise.set_value(handles);
+            score::cpp::ignore = score::mw::com::test::BigDataProxy::StopFindService(handle);
+        },
+        instance_specifier);
+    if (!handles_result.has_value())
+    {
+        std::cerr << "Error finding service for instance specifier " << instance_specifier.ToString() << ": "
+                  << handles_result.error().Message() << ", terminating." << std::endl;
+        return score::MakeUnexpected<score::mw::com::test::BigDataProxy>(handles_result.error());
+    }
+
+    const auto handles = service_discovery_future.get();
+    if (handles.empty())
+    {
+        std::cerr << "NO instance found for instance specifier " << instance_specifier.ToString()
+                  << " although service instance has been successfully offered! Terminating!" << std::endl;
+        return score::MakeUnexpected<score::mw::com::test::BigDataProxy>(
+            score::mw::com::impl::MakeError(score::mw::com::impl::ComErrc::kServiceNotAvailable));
+    }
+
+    return score::mw::com::test::BigDataProxy::Create(handles.front());
+}
+
+bool SendSample(score::mw::com::test::BigDataSkeleton& skeleton, const std::size_t counter)
+{
+    score::mw::com::test::DummyDataStamped sample{};
+    sample.hash_value = counter;
+    return skeleton.dummy_data_stamped_.Send(sample).has_value();
+}
+
+}  // namespace
+
+/**
+ * Stress test for sample leases (maxSampleHoldTimeMs/staleSampleAction) with a stalled reader:
+ * - A stalled proxy takes as many samples as there are slots and never drops them. Without sample leases the
+ *   skeleton couldn't allocate any slot anymore and every Send() would fail.
+ * - With staleSampleAction FORCE-RELEASE the skeleton releases the references of the stalled proxy, once they are
+ *   older than maxSampleHoldTimeMs, so that an active proxy keeps receiving samples during the stall.
+ * - Afterwards the stalled proxy drops its (force-released) samples. This must not release the slots a second time:
+ *   every following Send() has to succeed and both proxies have to receive samples again.
+ */
+int main(int argc, const char** argv)
+{
+    score::mw::com::test::SetupAssertHandler();
+    score::cpp::stop_source stop_source;
+    const bool sig_term_handler_setup_success = score::mw::com::SetupStopTokenSigTermHandler(stop_source);
+    if (!sig_term_handler_setup_success)
+    {
+        std::cerr << "Unable to set signal handler for SIGINT and/or SIGTERM, cautiously continuing\n";
+        return EXIT_FAILURE;
+    }
+
+    score::mw::com::runtime::InitializeRuntime(argc, argv);
+
+    const auto instance_specifier_result =
+        score::mw::com::InstanceSpecifier::Create(std::string{"score/cp60/MapApiLanesStamped"});
+    if (!instance_specifier_result.has_value())
+    {
+        std::cerr << "Invalid instance specifier, terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto& instance_specifier = instance_specifier_result.value();
+
+    // Create skeleton and offer its service ...
+    auto bigdata_result = score::mw::com::test::BigDataSkeleton::Create(instance_specifier);
+    if (!bigdata_result.has_value())
+    {
+        std::cerr << "Could not create skeleton with instance specifier " << instance_specifier.ToString()
+                  << ", terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto& skeleton = bigdata_result.value();
+    const auto offer_service_result = skeleton.OfferService();
+    if (!offer_service_result.has_value())
+    {
+        std::cerr << "Could not offer service for skeleton with instance specifier " << instance_specifier.ToString()
+                  << ", terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Create the stalled and the active proxy in the same process for the given service instance offered above
+    auto stalled_proxy_result = CreateProxy(instance_specifier);
+    auto active_proxy_result = CreateProxy(instance_specifier);
+    if (!stalled_proxy_result.has_value() || !active_proxy_result.has_value())
+    {
+        std::cerr << "Could not find/create proxies, terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+    auto& stalled_event = stalled_proxy_result.value().dummy_data_stamped_;
+    auto& active_event = active_proxy_result.value().dummy_data_stamped_;
+
+    // enforceMaxSamples is disabled, so that the stalled proxy may subscribe for all the slots
+    if (!stalled_event.Subscribe(kNumberOfSampleSlots).has_value() || !active_event.Subscribe(1U).has_value())
+    {
+        std::cerr << "Proxies could not subscribe to event, terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The stalled proxy takes a reference to every slot and keeps it
+    std::size_t send_counter{0U};
+    std::vector<score::mw::com::SamplePtr<score::mw::com::test::DummyDataStamped>> stalled_samples{};
+    for (std::size_t i = 0U; i < kNumberOfSampleSlots; ++i)
+    {
+        if (!SendSample(skeleton, send_counter++))
+        {
+            std::cerr << "Could not send event sample " << i << ", terminating." << std::endl;
+            return EXIT_FAILURE;
+        }
+        score::cpp::ignore = stalled_event.GetNewSamples(
+            [&stalled_samples](score::mw::com::SamplePtr<score::mw::com::test::DummyDataStamped> sample) {
+                stalled_samples.push_back(std::move(sample));
+            },
+            1U);
+    }
+    if (stalled_samples.size() != kNumberOfSampleSlots)
+    {
+        std::cerr << "Stalled proxy only holds " << stalled_samples.size() << " samples instead of "
+                  << kNumberOfSampleSlots << ", terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Stalled proxy holds all " << kNumberOfSampleSlots << " slots" << std::endl;
+
+    // Keep sending, while the stalled proxy blocks all the slots. The first sends fail until the references of the
+    // stalled proxy exceed maxSampleHoldTimeMs and get force-released.
+    std::size_t failed_sends{0U};
+    std::size_t active_received{0U};
+    const auto stall_end = std::chrono::steady_clock::now() + kStallDuration;
+    while ((std::chrono::steady_clock::now() < stall_end) && !stop_source.stop_requested())
+    {
+        if (!SendSample(skeleton, send_counter++))
+        {
+            ++failed_sends;
+        }
+        const auto get_result = active_event.GetNewSamples(
+            [](score::mw::com::SamplePtr<score::mw::com::test::DummyDataStamped>) noexcept {}, 1U);
+        if (get_result.has_value())
+        {
+            active_received += get_result.value();
+        }
+        std::this_thread::sleep_for(kSendCycle);
+    }
+    std::cout << "During stall: " << failed_sends << " failed sends, active proxy received " << active_received
+              << " samples" << std::endl;
+    if (active_received < kMinSamplesDuringStall)
+    {
+        std::cerr << "Active proxy got starved by the stalled proxy, terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The stalled proxy recovers and drops its force-released samples. Their slots must not be released twice and
+    // the stalled proxy has to receive new samples again.
+    stalled_samples.clear();
+    std::size_t stalled_received{0U};
+    for (std::size_t i = 0U; i < kSamplesAfterStall; ++i)
+    {
+        if (!SendSample(skeleton, send_counter++))
+        {
+            std::cerr << "Could not send event sample after the stall, terminating." << std::endl;
+            return EXIT_FAILURE;
+        }
+        const auto stalled_get_result = stalled_event.GetNewSamples(
+            [](score::mw::com::SamplePtr<score::mw::com::test::DummyDataStamped>) noexcept {}, 1U);
+        if (stalled_get_result.has_value())
+        {
+            stalled_received += stalled_get_result.value();
+        }
+        score::cpp::ignore = active_event.GetNewSamples(
+            [](score::mw::com::SamplePtr<score::mw::com::test::DummyDataStamped>) noexcept {}, 1U);
+    }
+    std::cout << "After stall: stalled proxy received " << stalled_received << " samples" << std::endl;
+    if (stalled_received != kSamplesAfterStall)
+    {
+        std::cerr << "Stalled proxy didn't recover after dropping its samples, terminating." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    stalled_event.Unsubscribe();
+    active_event.Unsubscribe();
+    skeleton.StopOfferService();
+
+    return EXIT_SUCCESS;
+}
@@ -78,6 +78,18 @@ using ServiceHandleContainer = ::score::mw::com::impl::ServiceHandleContainer<T>
 template <typename T>
 using FindServiceHandler = ::score::mw::com::impl::FindServiceHandler<T>;
 
+/// \api
+/// \brief Handles of the service instances, which became available or unavailable.
+/// See ProxyBase::StartFindServiceIncremental for more information.
+template <typename T>
+using ServiceHandleChanges = ::score::mw::com::impl::ServiceHandleChanges<T>;
+
+/// \api
+/// \brief Callback that notifies the callee only about the changes of the service availability.
+/// See ProxyBase::StartFindServiceIncremental for more information.
+template <typename T>
+using FindServiceIncrementalHandler = ::score::mw::com::impl::FindServiceIncrementalHandler<T>;
+
 /// \api
 /// \brief Subscription state of a proxy event.
 /// See ProxyEvent::GetSubscriptionStatus for slightly more information.